@@ -27,6 +27,11 @@
 #define COM_READ_TEMP		0x01
 #define COM_READ_COOLING	0x02
 #define COM_READ_HEATING	0x03
+#define COM_READ_LOG		0x04
+#define COM_READ_TIMING		0x05
+#define COM_READ_STATS		0x06
+#define COM_RESET_STATS		0x07
+#define COM_CLOCK_MARK		0x08
 #define COM_ACK			0x9A
 #define COM_NACK		0x66
 
@@ -130,6 +135,81 @@ bool read_command(unsigned char command, int *value){
 	return false;
 }
 
+/* Clock calibration mark, ticks (60ms) counted since the previous mark. The
+ * firmware calibrates its clock (and saves it in EEPROM) when that was an hour.
+ */
+bool clock_mark(unsigned int *ticks){
+	unsigned char xorsum;
+	unsigned char ack;
+        unsigned int data;
+
+	write_byte(COM_CLOCK_MARK);
+	delay(6); // Time for the EEPROM write, as for write_eeprom()
+	data = read_byte();
+	data = (data << 8) | read_byte();
+	xorsum = read_byte();
+        ack = read_byte();
+	if(ack == COM_ACK && xorsum == (COM_CLOCK_MARK ^ ((unsigned char)(data >> 8)) ^ ((unsigned char)data))){
+	        *ticks = data;
+		return true;
+	}
+	return false;
+}
+
+/* Bulk read of the temperature log (LOG firmware), log end followed by size bytes of the ring */
+bool read_log(unsigned char *head, unsigned char *buf, unsigned char size){
+	unsigned char xorsum;
+	unsigned char ack;
+	unsigned char i;
+
+	write_byte(COM_READ_LOG);
+	*head = read_byte();
+	xorsum = COM_READ_LOG ^ *head;
+	for(i=0; i<size; i++){
+		buf[i] = read_byte();
+		xorsum ^= buf[i];
+	}
+	xorsum ^= read_byte();
+	ack = read_byte();
+	return ack == COM_ACK && xorsum == 0;
+}
+
+/* Bulk read of the cycle timing (instrumentation firmware, com_timing), size bytes
+ * (ints little endian). The firmware starts over after each read.
+ */
+bool read_timing(unsigned char *buf, unsigned char size){
+	unsigned char xorsum = COM_READ_TIMING;
+	unsigned char ack;
+	unsigned char i;
+
+	write_byte(COM_READ_TIMING);
+	for(i=0; i<size; i++){
+		buf[i] = read_byte();
+		xorsum ^= buf[i];
+	}
+	xorsum ^= read_byte();
+	ack = read_byte();
+	return ack == COM_ACK && xorsum == 0;
+}
+
+/* Bulk read of the operating statistics, size bytes (little endian).
+ * With COM_RESET_STATS, the firmware starts over after the read.
+ */
+bool read_stats(unsigned char command, unsigned char *buf, unsigned char size){
+	unsigned char xorsum = command;
+	unsigned char ack;
+	unsigned char i;
+
+	write_byte(command);
+	for(i=0; i<size; i++){
+		buf[i] = read_byte();
+		xorsum ^= buf[i];
+	}
+	xorsum ^= read_byte();
+	ack = read_byte();
+	return ack == COM_ACK && xorsum == 0;
+}
+
 bool read_temp(int *temperature){
 	return read_command(COM_READ_TEMP, temperature); 
 }
@@ -158,10 +238,36 @@ enum set_menu_enum {
 	run_mode			// rn (0-5 run profile, 6=thermostat)
 };
 
+// Uncomment for the LOG firmware (com_log), with 2 profiles, the temperature log and statistics
+//#define LOG
+
+// Uncomment for the instrumentation firmware (com_timing), with cycle timing of the hot paths
+//#define TIMING
+
+// Uncomment for the packed profile firmware (com_packed), with 10 profiles of up to 10 steps
+//#define PACKED
+
+// Uncomment for the clock calibration firmware (com_clock)
+//#define CLOCK
+
+#ifdef LOG
+#define NO_OF_PROFILES	2
+#define LOG_SIZE	130	// Bytes in the log, after the menu data and statistics
+#elif defined(PACKED)
+#define NO_OF_PROFILES	10
+#define PROFILE_WORDS	114	// Variable length step records, before the menu data
+#else
+#define NO_OF_PROFILES	6
+#endif
+
 /* Defines for EEPROM config addresses */
+#ifdef PACKED
+#define EEADR_SET_MENU				PROFILE_WORDS
+#else
 #define EEADR_PROFILE_SETPOINT(profile, stp)	(((profile)*19) + ((stp)<<1))
 #define EEADR_PROFILE_DURATION(profile, stp)	(EEADR_PROFILE_SETPOINT(profile, stp) + 1)
-#define EEADR_SET_MENU				EEADR_PROFILE_SETPOINT(6, 0)
+#define EEADR_SET_MENU				EEADR_PROFILE_SETPOINT(NO_OF_PROFILES, 0)
+#endif
 #define EEADR_SET_MENU_ITEM(name)		(EEADR_SET_MENU + (name))
 #define EEADR_POWER_ON				127
 
@@ -229,7 +335,7 @@ void print_config_value(unsigned char address, int value){
 		Serial.print(menu_opt[address-EEADR_SET_MENU]);
 		Serial.print('=');
 		if(address == EEADR_SET_MENU_ITEM(run_mode)){
-			if(value >= 0 && value <= 5){
+			if(value >= 0 && value < NO_OF_PROFILES){
 				Serial.print("Pr");
 				Serial.println(value);
 			} else {
@@ -282,19 +388,21 @@ unsigned char parse_temperature(const char *str, int *temperature){
 unsigned char parse_address(const char *cmd, unsigned char *addr){
 	char i;	
 
+#ifndef PACKED
 	if(!strncmp("SP", cmd, 2)){
-		if(isDigit(cmd[2]) && isDigit(cmd[3]) && cmd[2] < '6'){
+		if(isDigit(cmd[2]) && isDigit(cmd[3]) && cmd[2] < '0' + NO_OF_PROFILES){
 			*addr = EEADR_PROFILE_SETPOINT(cmd[2]-'0', cmd[3]-'0');
 			return 4;
 		}
 	}
 
 	if(!strncmp("dh", cmd, 2)){
-		if(isDigit(cmd[2]) && isDigit(cmd[3]) && cmd[2] < '6' && cmd[3] < '9'){
+		if(isDigit(cmd[2]) && isDigit(cmd[3]) && cmd[2] < '0' + NO_OF_PROFILES && cmd[3] < '9'){
 			*addr = EEADR_PROFILE_DURATION(cmd[2]-'0', cmd[3]-'0');
 			return 4;
 		}
 	}
+#endif
 
 	for(i=0; i<(sizeof(menu_opt)/sizeof(menu_opt[0])); i++){
 		unsigned char len = strlen(menu_opt[i]);
@@ -344,11 +452,11 @@ unsigned char parse_config_value(const char *cmd, int address, bool pretty, int
 		} else if(address == EEADR_SET_MENU_ITEM(run_mode)) {
 			if(!strncmp(cmd, "Pr", 2)){
 				*data = cmd[2] - '0';
-				if(*data >= 0 && *data <= 5){
+				if(*data >= 0 && *data < NO_OF_PROFILES){
 					return 3;
 				}
 			} else if(!strncmp(cmd, "th", 2)){
-				*data = 6;
+				*data = NO_OF_PROFILES;
 				return 2;
 			}
 			return 0;
@@ -386,6 +494,166 @@ unsigned char parse_config_value(const char *cmd, int address, bool pretty, int
 	return i;
 }
 
+#ifdef PACKED
+/* The profiles, as decoded from the step records (see stc1000p.h). Records
+ * are one word, 0x8000 | (setpoint delta to the step before) << 8 | duration,
+ * or two words, setpoint and duration, and a profile ends at duration 0.
+ */
+int profile_words[PROFILE_WORDS];
+int profile_sp[NO_OF_PROFILES][10];
+int profile_dh[NO_OF_PROFILES][10];
+unsigned char profile_steps[NO_OF_PROFILES];
+
+// Read and decode the profiles, walking the records as profile_seek() in the firmware
+bool read_profiles(){
+	unsigned char adr, p, s;
+
+	for(adr=0; adr<PROFILE_WORDS; adr++){
+		if(!read_eeprom(adr, &profile_words[adr])){
+			return false;
+		}
+	}
+
+	adr = 0;
+	for(p=0; p<NO_OF_PROFILES; p++){
+		int sp = 0, dh;
+		s = 0;
+		do {
+			unsigned int rec = adr < PROFILE_WORDS ? profile_words[adr] : 0;
+			if(rec & 0x8000){
+				sp += (int)(((rec >> 8) & 0x7f) ^ 0x40) - 0x40;
+				dh = rec & 0xff;
+				adr++;
+			} else {
+				sp = (int)(rec ^ 0x4000) - 0x4000;
+				dh = adr + 1 < PROFILE_WORDS ? profile_words[adr + 1] : 0;
+				adr += 2;
+			}
+			if(adr >= PROFILE_WORDS){
+				dh = 0;
+			}
+			if(s < 10){
+				profile_sp[p][s] = sp;
+				profile_dh[p][s] = (s < 9) ? dh : 0;
+				s++;
+			}
+		} while(dh != 0);
+		profile_steps[p] = s;
+	}
+	return true;
+}
+
+// Encode the profiles, writing the words that changed if write is set.
+// Returns the number of words used (0 on communication error)
+unsigned char write_profiles(bool write){
+	unsigned char adr = 0, p, s;
+
+	for(p=0; p<NO_OF_PROFILES; p++){
+		int base = 0;
+		for(s=0; s<profile_steps[p]; s++){
+			int sp = profile_sp[p][s], dh = profile_dh[p][s];
+			int rec[2];
+			unsigned char len = 2, i;
+
+			if(sp - base >= -64 && sp - base < 64 && dh < 256){
+				rec[0] = 0x8000 | ((sp - base) & 0x7f) << 8 | dh;
+				len = 1;
+			} else {
+				rec[0] = sp & 0x7fff;
+				rec[1] = dh;
+			}
+			for(i=0; i<len; i++, adr++){
+				if(write && adr < PROFILE_WORDS && profile_words[adr] != rec[i]){
+					if(!write_eeprom(adr, rec[i])){
+						return 0;
+					}
+					profile_words[adr] = rec[i];
+				}
+			}
+			base = sp;
+		}
+	}
+	return adr;
+}
+
+// 'r SPxy', 'r dhxy', 'w SPxy [temperature]' and 'w dhxy [hours]'. As in the
+// menu, dh 0 makes the step the last and dh on the last step adds a step.
+void profile_command(const char *cmd){
+	unsigned char profile = cmd[4] - '0', step = cmd[5] - '0', i = 6;
+	bool dh = (cmd[2] == 'd');
+	int data;
+
+	if(!isDigit(cmd[5]) || (dh && step > 8)){
+		Serial.println("?Syntax error");
+		return;
+	}
+	if(cmd[0] == 'w'){
+		if(!isBlank(cmd[i])){
+			Serial.println("?Syntax error");
+			return;
+		}
+		i++;
+		if(dh){
+			i += parse_config_value(&cmd[i], EEADR_SET_MENU_ITEM(duration), true, &data);
+		} else {
+			i += parse_temperature(&cmd[i], &data);
+		}
+		if(i == 7 || (dh && data < 0)){
+			Serial.println("?Syntax error");
+			return;
+		}
+	}
+	if(!isEOL(cmd[i])){
+		Serial.println("?Syntax error");
+		return;
+	}
+
+	if(!read_profiles()){
+		Serial.println("?Communication error");
+		return;
+	}
+	if(step >= profile_steps[profile]){
+		Serial.println("?No such step");
+		return;
+	}
+
+	if(cmd[0] == 'r'){
+		Serial.print(cmd[2]);
+		Serial.print(cmd[3]);
+		Serial.print(profile);
+		Serial.print(step);
+		Serial.print('=');
+		if(dh){
+			Serial.println(profile_dh[profile][step]);
+		} else {
+			print_temperature(profile_sp[profile][step]);
+		}
+		return;
+	}
+
+	if(!dh){
+		profile_sp[profile][step] = data;
+	} else {
+		if(data == 0){
+			profile_steps[profile] = step + 1;
+		} else if(step == profile_steps[profile] - 1){
+			profile_sp[profile][step + 1] = profile_sp[profile][step];
+			profile_dh[profile][step + 1] = 0;
+			profile_steps[profile]++;
+		}
+		profile_dh[profile][step] = data;
+	}
+
+	if(write_profiles(false) > PROFILE_WORDS){
+		Serial.println("?Profiles full");
+	} else if(write_profiles(true)){
+		Serial.println("Ok");
+	} else {
+		Serial.println("?Communication error");
+	}
+}
+#endif
+
 void parse_command(char *cmd){
 	int data;
 
@@ -422,6 +690,123 @@ void parse_command(char *cmd){
 		} else {
 			Serial.println("?Communication error");
 		}
+#ifdef CLOCK
+	} else if(cmd[0] == 'k'){
+		unsigned int ticks;
+
+		if(!isEOL(cmd[1])){
+			Serial.println("?Syntax error");
+			return;
+		}
+		if(clock_mark(&ticks)){
+			if(ticks >= 58000 && ticks <= 62000){
+				Serial.print("Clock calibrated, ");
+				Serial.print(ticks);
+				Serial.println(" ticks per hour");
+			} else {
+				Serial.println("Clock mark, send 'k' again in exactly one hour to calibrate");
+			}
+		} else {
+			Serial.println("?Communication error");
+		}
+#endif
+#ifdef LOG
+	} else if(cmd[0] == 'l'){
+		static unsigned char buf[LOG_SIZE];
+		unsigned char head, i;
+
+		if(!isEOL(cmd[1])){
+			Serial.println("?Syntax error");
+			return;
+		}
+		if(read_log(&head, buf, LOG_SIZE)){
+			// Hex dump for tools/logdecode, the log end first
+			Serial.println("Log:");
+			Serial.print(head, HEX);
+			for(i=0; i<LOG_SIZE; i++){
+				Serial.print((i & 15) == 15 ? '\n' : ' ');
+				Serial.print(buf[i], HEX);
+			}
+			Serial.println("");
+			Serial.println("End");
+		} else {
+			Serial.println("?Communication error");
+		}
+	} else if(cmd[0] == 's' || cmd[0] == 'S'){
+		// Times in seconds of the firmware (960ms), then cycles and temperature range
+		static const char stats_names[][8] = { "Time", "Cooling", "Heating", "Alarm" };
+		unsigned char buf[24], i;
+		unsigned long t[4];
+		int tmin, tmax;
+
+		if(!isEOL(cmd[1])){
+			Serial.println("?Syntax error");
+			return;
+		}
+		if(read_stats(cmd[0] == 'S' ? COM_RESET_STATS : COM_READ_STATS, buf, sizeof(buf))){
+			for(i=0; i<4; i++){
+				t[i] = buf[i*4] | ((unsigned long)buf[i*4+1] << 8) | ((unsigned long)buf[i*4+2] << 16) | ((unsigned long)buf[i*4+3] << 24);
+				Serial.print(stats_names[i]);
+				Serial.print('=');
+				Serial.print(t[i] * 0.96 / 3600.0, 2);
+				Serial.print(" h");
+				if(i > 0 && t[0]){
+					Serial.print(" (");
+					Serial.print(t[i] * 100.0 / t[0], 1);
+					Serial.print("%)");
+				}
+				if(i == 1 || i == 2){
+					Serial.print(", ");
+					Serial.print((unsigned int)buf[16 + (i-1)*2] | ((unsigned int)buf[17 + (i-1)*2] << 8));
+					Serial.print(" cycles");
+				}
+				Serial.println("");
+			}
+			tmin = (int)((unsigned int)buf[20] | ((unsigned int)buf[21] << 8));
+			tmax = (int)((unsigned int)buf[22] | ((unsigned int)buf[23] << 8));
+			if(tmin <= tmax){ // Else no temperature since reset
+				Serial.print("Min=");
+				print_temperature(tmin);
+				Serial.print("Max=");
+				print_temperature(tmax);
+			}
+			if(cmd[0] == 'S'){
+				Serial.println("Reset");
+			}
+		} else {
+			Serial.println("?Communication error");
+		}
+#endif
+#ifdef TIMING
+	} else if(cmd[0] == 'p'){
+		// Sections as in the firmware, last, min and max each
+		static const char timing_names[][7] = { "second", "menu", "com" };
+		unsigned char buf[23], i, j;
+
+		if(!isEOL(cmd[1])){
+			Serial.println("?Syntax error");
+			return;
+		}
+		if(read_timing(buf, sizeof(buf))){
+			for(i=0; i<4; i++){
+				Serial.print(i < 3 ? timing_names[i] : "isr");
+				for(j=0; j<3; j++){
+					Serial.print(j == 0 ? " last=" : j == 1 ? " min=" : " max=");
+					if(i < 3){
+						Serial.print((unsigned int)buf[i*6 + j*2] | ((unsigned int)buf[i*6 + j*2 + 1] << 8));
+					} else {
+						Serial.print(buf[18 + j]);
+					}
+				}
+				Serial.println(" us");
+			}
+			Serial.print("tmr4 gap max=");
+			Serial.print((unsigned int)buf[21] | ((unsigned int)buf[22] << 8));
+			Serial.println(" ms (60 when on time)");
+		} else {
+			Serial.println("?Communication error");
+		}
+#endif
 	} else if(cmd[0] == 'r' || cmd[0] == 'w') {
 		unsigned char address=0;
 		unsigned char i=0, j;
@@ -432,6 +817,13 @@ void parse_command(char *cmd){
 			return;
 		}
 
+#ifdef PACKED
+		if((!strncmp("SP", &cmd[2], 2) || !strncmp("dh", &cmd[2], 2)) && isDigit(cmd[4])){
+			profile_command(cmd);
+			return;
+		}
+#endif
+
 		j = parse_address(&cmd[2], &address);
 		i+=j+2;
 
@@ -498,8 +890,21 @@ void setup() {
 	Serial.println("          'h' to read state of heating relay");
 	Serial.println("          'r [addr]' to read EEPROM address");
 	Serial.println("          'w [addr] [data]' to write EEPROM address");
+#ifdef CLOCK
+	Serial.println("          'k' to mark the time for clock calibration (twice, an hour apart)");
+#endif
+#ifdef LOG
+	Serial.println("          'l' to read the temperature log");
+	Serial.println("          's' to read statistics, 'S' to read and reset them");
+#endif
+#ifdef TIMING
+	Serial.println("          'p' to read cycle timing (since last read)");
+#endif
 	Serial.println("");
 	Serial.println("[addr] can be literal (0-127) or mnemonic SPxy/dhxy, hy, tc and so on");
+#ifdef PACKED
+	Serial.println("dhxy 0 ends profile x at step y, dhxy on its last step adds a step");
+#endif
 	Serial.println("[data] will also be literal (as stored in EEPROM) or human friendly");
 	Serial.println("depending on addressing mode");
 
@@ -2,8 +2,13 @@
 #include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <unistd.h>
 #include <math.h>
+#include <errno.h>
+#include <libgen.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
 #include "thermistor.h"
 
 #define C_TO_F(t)	((t)*1.8 + 32.0)
@@ -11,37 +16,607 @@
 double R0=R0_DEFAULT;
 int AD_MAX=AD_MAX_DEFAULT;
 int AD_STEP=AD_STEP_DEFAULT;
+int SEGMENTS=0;
+double T_MIN=T_MIN_DEFAULT;
+double T_MAX=T_MAX_DEFAULT;
+model_type MODEL=MODEL_POLY;
+char *OUTPUT=NULL;
+int JOBS=1;
 
 #define LUT_SIZE	(AD_MAX / AD_STEP)
 
+/*
+ * Non-uniform table (10 bit A/D only). Each segment is 16 << shift A/D
+ * values wide (shift 0-3) and starts at a multiple of its width, so the
+ * firmware gets the 6 bit interpolation fraction with a shift, as for the
+ * uniform table. Errors are checked at every filtered A/D value (1/64 A/D
+ * steps) with the integer interpolation of ad_to_temp().
+ */
+#define SEG_UNIT		16
+#define SEG_SHIFT_MAX	3
+#define SEG_NODES		(2 * 1024 / SEG_UNIT)
+/* A/D values covered by the table */
+#define SEG_AD_MIN		32
+#define SEG_AD_MAX		992
+/* Filtered A/D values the firmware accepts (outside, ad_badrange is set) */
+#define FILTER_MIN		(9 << 8)
+#define FILTER_MAX		(248 << 8)
+
+/* Error histogram, bins of HIST_BIN degrees, HIST_BINS on each side of 0 */
+#define HIST_BIN		0.05
+#define HIST_BINS		10
+
+typedef struct {
+	double window;	/* max error within the temperature window */
+	double all;		/* max error over the A/D range */
+} seg_error;
+
+typedef struct {
+	int done;
+	int segments;	/* number of segments, -1 if not possible */
+	int lower;		/* segments in lower half, -1 if a single segment */
+	seg_error error;
+} seg_node;
+
+thermistor th;		/* the fitted model */
+double *temp_c;		/* temperature (Celsius) at each filtered A/D value */
+double *temp_f;		/* and in Fahrenheit */
+double *err_c;		/* error of a table (Celsius) at each filtered A/D value */
+double *err_f;		/* and in Fahrenheit */
+seg_node *nodes;	/* best partition of node n in at most k segments, at [k * SEG_NODES + n] */
+
 /**
  * Convert A/D value to probe resistance value
  * @param ad_value The A/D value (0-1024)
- * @return The probe resistance (in Ohm) 
+ * @return The probe resistance (in Ohm)
  */
-double ad_to_r(int ad_value){
+double ad_to_r(double ad_value){
 	return (((R0 * AD_MAX) / ad_value) - R0);
 }
 
-void usage(char *cmd){
-	printf("Calculate A/D lookup table for NTC thermistor / resistor voltage divider network\n");
-	printf("using temperature-resstance data points from a file for the thermistor as input.\n");
-	printf("Usage: %s [-r R0 (default=10000.0 ohm)] [-m AD_MAX (default=1024)] [-s AD_STEP (default=32)] filename\n", cmd);	
+/**
+ * Table value at an A/D value
+ * @param ad The A/D value
+ * @param fahrenheit Nonzero for Fahrenheit
+ * @return Temperature in 0.1 degrees, rounded
+ */
+int lut_value(int ad, int fahrenheit){
+	double t = temp_c[ad * 64];
+	return (int)round((fahrenheit ? C_TO_F(t) : t) * 10.0);
 }
 
-int main(int argc, char *argv[]){
-	double r;
+/**
+ * Interpolate between two table values as ad_to_temp() in the firmware
+ * @param l0 Table value at the start of the segment
+ * @param l1 Table value at the end of the segment
+ * @param a Interpolation fraction (0-63)
+ * @return Temperature in 0.1 degrees
+ */
+int interpolate(int l0, int l1, int a){
+	return (int)floor((32.0 + (64 - a) * l0 + a * l1) / 64.0);
+}
+
+/**
+ * Max error of the firmware conversion over part of a table
+ * @param start A/D value at the start of the segment
+ * @param end A/D value at the end of the segment
+ * @param fahrenheit Nonzero for Fahrenheit
+ * @return Max error (in degrees) within the temperature window and overall
+ */
+seg_error segment_error(int start, int end, int fahrenheit){
+	int l0 = lut_value(start, fahrenheit), l1 = lut_value(end, fahrenheit);
+	int width = end - start, x;
+	seg_error e = { 0, 0 };
+
+	for(x = start * 64; x < end * 64; x++){
+		double t = temp_c[x], err;
+
+		if(x < FILTER_MIN || x >= FILTER_MAX){
+			continue;
+		}
+		err = fabs(interpolate(l0, l1, (x - start * 64) / width) / 10.0 - (fahrenheit ? C_TO_F(t) : t));
+		e.all = fmax(e.all, err);
+		if(t >= T_MIN && t <= T_MAX){
+			e.window = fmax(e.window, err);
+		}
+	}
+	return e;
+}
+
+/**
+ * Compare errors, first within the window and then overall
+ * @return Nonzero if a is smaller than b
+ */
+int seg_error_less(seg_error a, seg_error b){
+	if(fabs(a.window - b.window) > 1e-9){
+		return a.window < b.window;
+	}
+	return a.all < b.all - 1e-9;
+}
+
+/**
+ * Best partition of an aligned A/D interval, in at most k segments
+ * (dynamic programming over the binary tree of intervals)
+ * @param n Node, 1 for the whole A/D range, 2n and 2n+1 for the halves of n
+ * @param start A/D value at the start of the interval
+ * @param width Width of the interval
+ * @param k Max number of segments
+ * @return The partition
+ */
+seg_node *partition(int n, int start, int width, int k){
+	seg_node *node = &nodes[k * SEG_NODES + n];
+	int k1;
+
+	if(node->done){
+		return node;
+	}
+	node->done = 1;
+	node->segments = -1;
+
+	// Outside of the range, no segments needed
+	if(start >= SEG_AD_MAX || start + width <= SEG_AD_MIN){
+		node->segments = 0;
+		return node;
+	}
+
+	// As a single segment
+	if(k > 0 && width <= (SEG_UNIT << SEG_SHIFT_MAX) && start >= SEG_AD_MIN && start + width <= SEG_AD_MAX){
+		node->segments = 1;
+		node->lower = -1;
+		node->error = segment_error(start, start + width, 0);
+	}
+
+	// Split in halves
+	if(width > SEG_UNIT){
+		for(k1 = 0; k1 <= k; k1++){
+			seg_node *lo = partition(2 * n, start, width / 2, k1);
+			seg_node *hi = partition(2 * n + 1, start + width / 2, width / 2, k - k1);
+			seg_error e;
+
+			if(lo->segments < 0 || hi->segments < 0){
+				continue;
+			}
+			e.window = fmax(lo->error.window, hi->error.window);
+			e.all = fmax(lo->error.all, hi->error.all);
+			if(node->segments < 0 || seg_error_less(e, node->error)){
+				node->segments = lo->segments + hi->segments;
+				node->lower = k1;
+				node->error = e;
+			}
+		}
+	}
+	return node;
+}
+
+/**
+ * Collect the segment starts of a partition, in A/D order
+ * @param starts Array to add the starts to
+ * @return Number of segments added
+ */
+int collect(int n, int start, int width, int k, int *starts){
+	seg_node *node = &nodes[k * SEG_NODES + n];
+	int count;
+
+	if(node->segments == 0){
+		return 0;
+	}
+	if(node->lower < 0){
+		*starts = start;
+		return 1;
+	}
+	count = collect(2 * n, start, width / 2, node->lower, starts);
+	return count + collect(2 * n + 1, start + width / 2, width / 2, k - node->lower, starts + count);
+}
+
+/**
+ * Max error of a whole table
+ * @param starts A/D value at the start of each segment, and at the end of the last
+ * @param segments Number of segments
+ * @param fahrenheit Nonzero for Fahrenheit
+ * @return Max error within the temperature window and overall
+ */
+seg_error table_error(int *starts, int segments, int fahrenheit){
+	seg_error e = { 0, 0 };
+	int i;
+
+	for(i = 0; i < segments; i++){
+		seg_error s = segment_error(starts[i], starts[i + 1], fahrenheit);
+		e.window = fmax(e.window, s.window);
+		e.all = fmax(e.all, s.all);
+	}
+	return e;
+}
+
+seg_error print_error(char *name, int *starts, int segments){
+	seg_error c = table_error(starts, segments, 0);
+	seg_error f = table_error(starts, segments, 1);
+
+	printf("%s: max error %.3fC %.3fF within %.1fC to %.1fC, %.3fC %.3fF for A/D %d to %d\n",
+			name, c.window, f.window, T_MIN, T_MAX, c.all, f.all, FILTER_MIN / 64, FILTER_MAX / 64 - 1);
+	return c;
+}
+
+/**
+ * Error of the firmware conversion over a segment, at every filtered A/D
+ * value. The interpolation fraction is the same for width / 64 values in a
+ * row, so the inner loop only subtracts the model (and vectorises).
+ * @param start A/D value at the start of the segment
+ * @param end A/D value at the end of the segment
+ * @param l0 Table value at the start of the segment
+ * @param l1 Table value at the end of the segment
+ * @param ref Temperature of the model at each filtered A/D value
+ * @param err Error at each filtered A/D value
+ */
+void sweep(int start, int end, int l0, int l1, const double *ref, double *err){
+	int width = end - start, a, x, j;
+
+	for(a = 0; a < 64; a++){
+		double t = ((32 + (64 - a) * l0 + a * l1) >> 6) / 10.0;
+
+		x = start * 64 + a * width;
+		for(j = 0; j < width; j++){
+			err[x + j] = t - ref[x + j];
+		}
+	}
+}
+
+int hist_bin(double err){
+	int bin = (int)floor(err / HIST_BIN) + HIST_BINS + 1;
+	return bin < 0 ? 0 : bin > 2 * HIST_BINS + 1 ? 2 * HIST_BINS + 1 : bin;
+}
+
+/**
+ * Exhaustive check of a table, at every filtered A/D value the firmware
+ * accepts, converted as in ad_to_temp(). Prints a histogram of the errors
+ * (overall and within the temperature window) and the worst case of each
+ * segment, for both scales.
+ * @param name Name of the table
+ * @param starts A/D value at the start of each segment, and at the end of the last
+ * @param lut_c Celsius table values at starts
+ * @param lut_f Fahrenheit table values at starts
+ * @param segments Number of segments
+ */
+void verify(char *name, int *starts, int *lut_c, int *lut_f, int segments){
+	int hist[2 * HIST_BINS + 2][4] = { { 0 } };
+	int i, x, first = -1, last = 0;
+
+	for(i = 0; i < segments; i++){
+		sweep(starts[i], starts[i + 1], lut_c[i], lut_c[i + 1], temp_c, err_c);
+		sweep(starts[i], starts[i + 1], lut_f[i], lut_f[i + 1], temp_f, err_f);
+	}
+
+	for(x = FILTER_MIN; x < FILTER_MAX; x++){
+		int window = temp_c[x] >= T_MIN && temp_c[x] <= T_MAX;
+		int bc = hist_bin(err_c[x]), bf = hist_bin(err_f[x]);
+
+		hist[bc][0]++;
+		hist[bf][2]++;
+		if(window){
+			hist[bc][1]++;
+			hist[bf][3]++;
+		}
+	}
+
+	printf("%s, every filtered A/D value %d to %d (A/D %d to %d), window %.1fC to %.1fC:\n",
+			name, FILTER_MIN, FILTER_MAX - 1, FILTER_MIN / 64, FILTER_MAX / 64 - 1, T_MIN, T_MAX);
+	printf("error (deg)       C all  C window     F all  F window\n");
+	for(i = 0; i < 2 * HIST_BINS + 2; i++){
+		if(hist[i][0] || hist[i][2]){
+			if(first < 0){
+				first = i;
+			}
+			last = i;
+		}
+	}
+	for(i = first; i <= last; i++){
+		double lo = (i - HIST_BINS - 1) * HIST_BIN;
+
+		if(i == 0){
+			printf("    < %5.2f ", lo + HIST_BIN);
+		} else if(i == 2 * HIST_BINS + 1){
+			printf("   >= %5.2f ", lo);
+		} else {
+			printf("%5.2f..%5.2f ", lo, lo + HIST_BIN);
+		}
+		printf("%9d %9d %9d %9d\n", hist[i][0], hist[i][1], hist[i][2], hist[i][3]);
+	}
+
+	printf("Worst case per segment (error, at A/D):\n");
+	printf("    A/D   temperature (C)        C         at        F         at\n");
+	for(i = 0; i < segments; i++){
+		int from = starts[i] * 64, to = starts[i + 1] * 64, wc = -1, wf = -1;
+
+		from = from < FILTER_MIN ? FILTER_MIN : from;
+		to = to > FILTER_MAX ? FILTER_MAX : to;
+		for(x = from; x < to; x++){
+			if(wc < 0 || fabs(err_c[x]) > fabs(err_c[wc])){
+				wc = x;
+			}
+			if(wf < 0 || fabs(err_f[x]) > fabs(err_f[wf])){
+				wf = x;
+			}
+		}
+		if(wc < 0){
+			continue;
+		}
+		printf("%3d-%3d %7.1f to %5.1f %8.3f %10.3f %8.3f %10.3f\n", starts[i], starts[i + 1],
+				temp_c[from], temp_c[to - 1], err_c[wc], wc / 64.0, err_f[wf], wf / 64.0);
+	}
+}
+
+void print_table(FILE *f, char *prefix, int *values, int n){
+	int i;
+
+	fprintf(f, "%sconst int ad_lookup[] = { ", prefix);
+	for(i=0; i<n; i++){
+		fprintf(f, "%s%d", i ? ", " : "", values[i]);
+	}
+	fprintf(f, " };\n");
+}
+
+/* Range of the table values, for the overflow check of the firmware */
+void print_range(FILE *f, int *values, int n){
+	int i, min = values[0], max = values[0];
+
+	for(i=1; i<n; i++){
+		min = values[i] < min ? values[i] : min;
+		max = values[i] > max ? values[i] : max;
+	}
+	fprintf(f, "\t#define AD_LOOKUP_MIN\t(%d)\n\t#define AD_LOOKUP_MAX\t(%d)\n", min, max);
+}
+
+/**
+ * Write the tables as a header for the firmware, Fahrenheit or Celsius
+ * selected by FAHRENHEIT as in page0.c
+ * @param filename The header
+ * @param source The T-R table file
+ * @param segments ad_segments (NULL for a uniform table)
+ * @param n Number of segments, or table values for a uniform table
+ * @return 0 on success, -1 on error
+ */
+int write_header(char *filename, const char *source, unsigned char *segments, int *lut_c, int *lut_f, int n){
+	FILE *f = fopen(filename, "w");
+	int i;
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+
+	fprintf(f, "/* Generated by ntc-lut-generator from %s, do not edit.\n", strrchr(source, '/') ? strrchr(source, '/') + 1 : source);
+	fprintf(f, " * lut -M %s -r %.1f -m %d -s %d", model_name(MODEL), R0, AD_MAX, AD_STEP);
+	if(segments){
+		fprintf(f, " -n %d -w %.1f:%.1f", SEGMENTS, T_MIN, T_MAX);
+	}
+	fprintf(f, "\n */\n");
+	if(segments){
+		fprintf(f, "/* Segments start at A/D value / 16 << 2 | log2(segment width / 16), table values are at the segment starts and the end of the last. */\n");
+		fprintf(f, "const unsigned char ad_segments[] = { ");
+		for(i=0; i<n; i++){
+			fprintf(f, "%s0x%02x", i ? ", " : "", segments[i]);
+		}
+		fprintf(f, " };\n");
+		n++;
+	}
+	fprintf(f, "#ifdef FAHRENHEIT\n");
+	print_table(f, "\t", lut_f, n);
+	print_range(f, lut_f, n);
+	fprintf(f, "#else  // CELSIUS\n");
+	print_table(f, "\t", lut_c, n);
+	print_range(f, lut_c, n);
+	fprintf(f, "#endif\n");
+
+	if(fclose(f)){
+		perror(filename);
+		return -1;
+	}
+	return 0;
+}
+
+/**
+ * Fit the model to a T-R table and calculate the lookup tables
+ * @param filename The T-R table file
+ * @param header Header to write the tables to (NULL for none)
+ * @param summary Where to print a one line summary (NULL for none)
+ * @return 0 on success
+ */
+int generate(char *filename, char *header, FILE *summary){
+	static rt_table table;
+	double residual;
+	seg_error uniform = { 0, 0 }, nonuniform = { 0, 0 };
 	int i;
 	int *lut_c;
 	int *lut_f;
-	polynom *erg;
 
+	if(readtable(filename, &table)){
+		return 1;
+	}
+	if(fit(MODEL, &table, &th)){
+		fprintf(stderr, "%s: too few points for the %s model.\n", filename, model_name(MODEL));
+		return 1;
+	}
+
+	printf("Using: R0 = %lf, AD_MAX = %d, AD_STEP = %d\n", R0, AD_MAX, AD_STEP);
+	residual = testresult(&th, &table, stdout);
+
+	lut_c = malloc(sizeof(int) * LUT_SIZE);
+	lut_f = malloc(sizeof(int) * LUT_SIZE);
+
+	lut_c[0]=0;
+	lut_f[0]=0;
+
+	for(i=1; i<LUT_SIZE; i++){
+		double r = rtot(&th, ad_to_r(i*AD_STEP));
+		lut_c[i] = (int)round(r * 10.0);
+		lut_f[i] = (int)round(C_TO_F(r) * 10.0);
+	}
+
+	if(AD_MAX == 1024){
+		int starts[LUT_SIZE + 1], n = 0;
+
+		// Temperature at every filtered A/D value
+		temp_c = malloc(sizeof(double) * (AD_MAX * 64 + 1));
+		for(i=1; i<=AD_MAX*64; i++){
+			temp_c[i] = rtot(&th, ad_to_r(i / 64.0));
+		}
+		temp_c[0] = temp_c[1];
+		temp_f = malloc(sizeof(double) * (AD_MAX * 64 + 1));
+		for(i=0; i<=AD_MAX*64; i++){
+			temp_f[i] = C_TO_F(temp_c[i]);
+		}
+		err_c = calloc(AD_MAX * 64, sizeof(double));
+		err_f = calloc(AD_MAX * 64, sizeof(double));
+
+		for(i=0; i*AD_STEP<=AD_MAX; i++){
+			if(i*AD_STEP >= SEG_AD_MIN && i*AD_STEP <= SEG_AD_MAX){
+				starts[n++] = i*AD_STEP;
+			}
+		}
+		uniform = print_error("Uniform table", starts, n - 1);
+		verify("Uniform table", starts, &lut_c[starts[0] / AD_STEP], &lut_f[starts[0] / AD_STEP], n - 1);
+	}
+
+	printf("//Celsius\n");
+	print_table(stdout, "", lut_c, LUT_SIZE);
+	printf("//Fahrenheit\n");
+	print_table(stdout, "", lut_f, LUT_SIZE);
+
+	if(SEGMENTS){
+		int starts[SEG_NODES + 1], n;
+		int seg_c[SEG_NODES + 1], seg_f[SEG_NODES + 1];
+		unsigned char segments[SEG_NODES];
+		seg_node *best;
+
+		nodes = calloc((SEGMENTS + 1) * SEG_NODES, sizeof(seg_node));
+		best = partition(1, 0, AD_MAX, SEGMENTS);
+		if(best->segments < 0){
+			fprintf(stderr, "%s: not possible with %d segments.\n", filename, SEGMENTS);
+			return 1;
+		}
+		n = collect(1, 0, AD_MAX, SEGMENTS, starts);
+		starts[n] = SEG_AD_MAX;
+
+		for(i=0; i<=n; i++){
+			seg_c[i] = lut_value(starts[i], 0);
+			seg_f[i] = lut_value(starts[i], 1);
+		}
+		for(i=0; i<n; i++){
+			int shift;
+			for(shift=0; (SEG_UNIT << shift) < starts[i + 1] - starts[i]; shift++);
+			segments[i] = (starts[i] / SEG_UNIT) << 2 | shift;
+		}
+
+		printf("\n");
+		nonuniform = print_error("Non-uniform table", starts, n);
+		verify("Non-uniform table", starts, seg_c, seg_f, n);
+
+		printf("//Segments (start / 16 << 2 | log2(width / 16))\n");
+		printf("const unsigned char ad_segments[] = { ");
+		for(i=0; i<n; i++){
+			printf("%s0x%02x", i ? ", " : "", segments[i]);
+		}
+		printf(" };\n");
+		printf("//Celsius\n");
+		print_table(stdout, "", seg_c, n + 1);
+		printf("//Fahrenheit\n");
+		print_table(stdout, "", seg_f, n + 1);
+
+		if(header && write_header(header, filename, segments, seg_c, seg_f, n)){
+			return 1;
+		}
+	} else if(header && write_header(header, filename, NULL, lut_c, lut_f, LUT_SIZE)){
+		return 1;
+	}
+
+	if(summary){
+		fprintf(summary, "%s: %s fit, max residual %.3fC, max error %.3fC within %.1fC to %.1fC", filename,
+				model_name(MODEL), residual, SEGMENTS ? nonuniform.window : uniform.window, T_MIN, T_MAX);
+		fprintf(summary, header ? ", %s\n" : "\n", header);
+		fflush(summary);
+	}
+	return 0;
+}
+
+/**
+ * Generate the tables for several T-R table files, JOBS at a time. Each
+ * writes OUTPUT/<name>.h, with its output in OUTPUT/<name>.log.
+ * @param files The T-R table files
+ * @param count Number of files
+ * @return Number of files that failed
+ */
+int batch(char **files, int count){
+	int started = 0, running = 0, failed = 0, status;
+
+	if(mkdir(OUTPUT, 0777) && errno != EEXIST){
+		perror(OUTPUT);
+		return count;
+	}
+
+	while(started < count || running > 0){
+		if(started < count && running < JOBS){
+			char *name = strdup(files[started]), *dot, header[1024], log[1024];
+			pid_t pid;
+
+			name = basename(name);
+			if((dot = strrchr(name, '.'))){
+				*dot = 0;
+			}
+			snprintf(header, sizeof(header), "%s/%s.h", OUTPUT, name);
+			snprintf(log, sizeof(log), "%s/%s.log", OUTPUT, name);
+
+			fflush(stdout);
+			pid = fork();
+			if(pid < 0){
+				perror("fork");
+				return failed + count - started;
+			}
+			if(pid == 0){
+				FILE *summary = fdopen(dup(fileno(stdout)), "w");
+				if(!freopen(log, "w", stdout)){
+					perror(log);
+					_exit(1);
+				}
+				_exit(generate(files[started], header, summary));
+			}
+			started++;
+			running++;
+			continue;
+		}
+		if(wait(&status) > 0){
+			running--;
+			if(!WIFEXITED(status) || WEXITSTATUS(status)){
+				failed++;
+			}
+		}
+	}
+
+	if(failed){
+		fprintf(stderr, "%d of %d failed.\n", failed, count);
+	}
+	return failed;
+}
+
+void usage(char *cmd){
+	printf("Calculate A/D lookup table for NTC thermistor / resistor voltage divider network\n");
+	printf("using temperature-resstance data points from a file for the thermistor as input.\n");
+	printf("Usage: %s [-r R0 (default=10000.0 ohm)] [-m AD_MAX (default=1024)] [-s AD_STEP (default=32)]\n", cmd);
+	printf("          [-n SEGMENTS] [-w T_MIN:T_MAX (default=%.1f:%.1f C)] [-M poly|sh|beta (default=poly)]\n", T_MIN_DEFAULT, T_MAX_DEFAULT);
+	printf("          [-o HEADER] filename\n");
+	printf("       %s [options] -o DIR [-j JOBS] filename...\n", cmd);
+	printf("With -n, also calculate a non-uniform table with (at most) SEGMENTS segments,\n");
+	printf("with breakpoints placed for the least max error between T_MIN and T_MAX.\n");
+	printf("-M selects the model fitted to the table: a cubic polynomial in ln(R), Steinhart-Hart or Beta.\n");
+	printf("-o writes the tables (non-uniform with -n) as a header for the firmware.\n");
+	printf("With several files, the header and output of each is written to DIR, JOBS files at a time.\n");
+}
+
+int main(int argc, char *argv[]){
 	/* getopt */
 	int c;
 
 	opterr = 0;
 
-	while((c=getopt(argc, argv, "r:m:s:")) != -1) {
+	while((c=getopt(argc, argv, "r:m:s:n:w:M:o:j:")) != -1) {
 		switch(c) {
 			case 'r':
 				R0=atof(optarg);
@@ -52,8 +627,30 @@ int main(int argc, char *argv[]){
 			case 's':
 				AD_STEP=atoi(optarg);
 				break;
+			case 'n':
+				SEGMENTS=atoi(optarg);
+				break;
+			case 'w':
+				if(sscanf(optarg, "%lf:%lf", &T_MIN, &T_MAX) != 2){
+					T_MAX = T_MIN - 1;
+				}
+				break;
+			case 'M':
+				if((c = model_by_name(optarg)) < 0){
+					fprintf(stderr, "Unknown model '%s'.\n", optarg);
+					usage(argv[0]);
+					return 1;
+				}
+				MODEL = c;
+				break;
+			case 'o':
+				OUTPUT=optarg;
+				break;
+			case 'j':
+				JOBS=atoi(optarg);
+				break;
 			case '?':
-				if (optopt == 'r' || optopt == 'm' || optopt == 's'){
+				if (strchr("rmsnwMoj", optopt)){
 					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
 				} else if (isprint (optopt)) {
 					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
@@ -68,47 +665,14 @@ int main(int argc, char *argv[]){
 
 	}
 
-	if(optind != argc-1 || R0 <=0 || AD_MAX <=0 || AD_STEP <= 0){
+	if(optind >= argc || R0 <=0 || AD_MAX <=0 || AD_STEP <= 0 || SEGMENTS < 0 || T_MAX < T_MIN || JOBS <= 0
+			|| (SEGMENTS && AD_MAX != 1024) || (optind != argc-1 && !OUTPUT)){
 		usage(argv[0]);
 		return 1;
 	}
 
-	printf("Using: R0 = %lf, AD_MAX = %d, AD_STEP = %d\n", R0, AD_MAX, AD_STEP);
-
-	readtable(argv[optind]);
-	orthonormal(basis);
-	erg = approx();
-	testresult(erg);
-
-	for(i=0; i<4; i++){
-		a[i] = (*erg)[i];
+	if(optind == argc-1){
+		return generate(argv[optind], OUTPUT, NULL);
 	}
-
-	lut_c = malloc(sizeof(int) * LUT_SIZE);
-	lut_f = malloc(sizeof(int) * LUT_SIZE);
-
-	lut_c[0]=0;
-	lut_f[0]=0;
-
-	for(i=1; i<LUT_SIZE; i++){
-		r = rtot(ad_to_r(i*AD_STEP));
-		lut_c[i] = (int)round(r * 10.0); 
-		lut_f[i] = (int)round(C_TO_F(r) * 10.0); 
-	}
-
-	printf("//Celsius\n");
-	printf("const int ad_lookup[] = { 0");
-	for(i=1; i<LUT_SIZE; i++){
-		printf(", %d", lut_c[i]);
-	}
-	printf(" };\n");
-	
-	printf("//Fahrenheit\n");
-	printf("const int ad_lookup[] = { 0");
-	for(i=1; i<LUT_SIZE; i++){
-		printf(", %d", lut_f[i]);
-	}
-	printf(" };\n");
-
+	return batch(&argv[optind], argc - optind) ? 1 : 0;
 }
-
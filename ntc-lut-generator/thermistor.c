@@ -0,0 +1,236 @@
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "thermistor.h"
+
+/* Number of basis functions of each model */
+static const int model_size[] = {
+	[MODEL_POLY] = 4,
+	[MODEL_SH] = 3,
+	[MODEL_BETA] = 2,
+};
+
+static const char *model_names[] = {
+	[MODEL_POLY] = "poly",
+	[MODEL_SH] = "sh",
+	[MODEL_BETA] = "beta",
+};
+
+/**
+ * Model for a name
+ * @param name The name (poly, sh or beta)
+ * @return The model, or -1 if unknown
+ */
+int model_by_name(const char *name){
+	int i;
+
+	for(i = 0; i < (int)(sizeof(model_names) / sizeof(model_names[0])); i++){
+		if(!strcmp(name, model_names[i])){
+			return i;
+		}
+	}
+	return -1;
+}
+
+const char *model_name(model_type type){
+	return model_names[type];
+}
+
+/**
+ * Reads all temperature-resistance pairs from a T-R table file, one pair
+ * per line separated by white space. Empty lines and lines starting with
+ * # are skipped.
+ * @param filename The file
+ * @param table The table to fill
+ * @return 0 on success, -1 on error
+ */
+int readtable(const char *filename, rt_table *table){
+	char line[256];
+	int lineno = 0;
+	FILE *f = fopen(filename, "r");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+	table->n = 0;
+	while(fgets(line, sizeof(line), f)){
+		char *p = line;
+		double t, r;
+
+		lineno++;
+		while(isspace((unsigned char)*p)){
+			p++;
+		}
+		if(*p == 0 || *p == '#'){
+			continue;
+		}
+		if(sscanf(p, "%lf %lf", &t, &r) != 2 || r <= 0 || t <= -KELVIN){
+			fprintf(stderr, "%s:%d: expected temperature and resistance.\n", filename, lineno);
+			fclose(f);
+			return -1;
+		}
+		if(table->n == MAX_POINTS){
+			fprintf(stderr, "%s: more than %d points.\n", filename, MAX_POINTS);
+			fclose(f);
+			return -1;
+		}
+		table->t[table->n] = t;
+		table->r[table->n] = r;
+		table->n++;
+	}
+	fclose(f);
+	return 0;
+}
+
+/**
+ * Least squares fit of a model to a T-R table, of 1/T as a polynomial in
+ * ln(R) - x0 (x0 is the mean of ln(R)). Solves the normal equations with
+ * Gaussian elimination (partial pivoting).
+ * @param type The model
+ * @param table The T-R table
+ * @param th The fitted model
+ * @return 0 on success, -1 if too few points
+ */
+int fit(model_type type, const rt_table *table, thermistor *th){
+	double basis[M][M], A[M][M + 1], coeff[M];
+	int n = model_size[type], i, j, k;
+
+	if(table->n < n){
+		return -1;
+	}
+
+	th->type = type;
+	th->x0 = 0;
+	for(k = 0; k < table->n; k++){
+		th->x0 += log(table->r[k]) / table->n;
+	}
+
+	// Basis function j is the sum of basis[j][i] * x^i. Steinhart-Hart has
+	// no ln(R)^2 term, (x + x0)^3 - x0^3 - 3*x0^2*x without it in x.
+	memset(basis, 0, sizeof(basis));
+	for(j = 0; j < n; j++){
+		basis[j][j] = 1;
+	}
+	if(type == MODEL_SH){
+		basis[2][2] = 3 * th->x0;
+		basis[2][3] = 1;
+	}
+
+	memset(A, 0, sizeof(A));
+	for(k = 0; k < table->n; k++){
+		double x = log(table->r[k]) - th->x0, y = 1.0 / (table->t[k] + KELVIN), p[M], f[M];
+
+		p[0] = 1;
+		for(i = 1; i < M; i++){
+			p[i] = p[i - 1] * x;
+		}
+		for(j = 0; j < n; j++){
+			f[j] = 0;
+			for(i = 0; i < M; i++){
+				f[j] += basis[j][i] * p[i];
+			}
+		}
+		for(i = 0; i < n; i++){
+			for(j = 0; j < n; j++){
+				A[i][j] += f[i] * f[j];
+			}
+			A[i][n] += f[i] * y;
+		}
+	}
+
+	for(i = 0; i < n; i++){
+		int pivot = i;
+		for(j = i + 1; j < n; j++){
+			if(fabs(A[j][i]) > fabs(A[pivot][i])){
+				pivot = j;
+			}
+		}
+		if(A[pivot][i] == 0){
+			return -1;
+		}
+		for(k = 0; k <= n; k++){
+			double tmp = A[i][k];
+			A[i][k] = A[pivot][k];
+			A[pivot][k] = tmp;
+		}
+		for(j = i + 1; j < n; j++){
+			double f = A[j][i] / A[i][i];
+			for(k = i; k <= n; k++){
+				A[j][k] -= f * A[i][k];
+			}
+		}
+	}
+
+	for(i = n - 1; i >= 0; i--){
+		double s = A[i][n];
+		for(j = i + 1; j < n; j++){
+			s -= A[i][j] * coeff[j];
+		}
+		coeff[i] = s / A[i][i];
+	}
+
+	memset(th->a, 0, sizeof(th->a));
+	for(j = 0; j < n; j++){
+		for(i = 0; i < M; i++){
+			th->a[i] += coeff[j] * basis[j][i];
+		}
+	}
+	return 0;
+}
+
+/**
+ * Conversion from resistance to temperature
+ * @param th The model
+ * @param r The resistance (in Ohm)
+ * @return The temperature (in Celsius)
+ */
+double rtot(const thermistor *th, double r){
+	double x = log(r) - th->x0;
+	return 1.0 / (th->a[0] + x * (th->a[1] + x * (th->a[2] + x * th->a[3]))) - KELVIN;
+}
+
+/**
+ * Prints the coefficients of the model (in ln(R)), and the residual of
+ * each T-R pair
+ * @param th The model
+ * @param table The T-R table
+ * @param out Where to print
+ * @return The max residual (in degrees)
+ */
+double testresult(const thermistor *th, const rt_table *table, FILE *out){
+	double c[M] = { 0 }, binom[M][M] = { { 1 }, { 1, 1 }, { 1, 2, 1 }, { 1, 3, 3, 1 } };
+	double max = 0, sum = 0;
+	int i, j, k;
+
+	// Expand the polynomial in ln(R) - x0 to ln(R)
+	for(i = 0; i < M; i++){
+		for(j = 0; j <= i; j++){
+			double term = th->a[i] * binom[i][j];
+			for(k = 0; k < i - j; k++){
+				term *= -th->x0;
+			}
+			c[j] += term;
+		}
+	}
+	if(th->type == MODEL_SH){
+		c[2] = 0;
+	}
+
+	fprintf(out, "Model: %s, 1/T = %.9e + %.9e*ln(R) + %.9e*ln(R)^2 + %.9e*ln(R)^3\n",
+			model_name(th->type), c[0], c[1], c[2], c[3]);
+	if(th->type == MODEL_BETA){
+		fprintf(out, "B = %.1f, R25 = %.1f\n", 1.0 / c[1], exp((1.0 / (25.0 + KELVIN) - c[0]) / c[1]));
+	}
+	fprintf(out, "     T (C)       R (Ohm)   fitted T   residual\n");
+	for(i = 0; i < table->n; i++){
+		double t = rtot(th, table->r[i]), res = t - table->t[i];
+		fprintf(out, "%10.2f  %12.2f  %9.3f  %9.4f\n", table->t[i], table->r[i], t, res);
+		max = fmax(max, fabs(res));
+		sum += res * res;
+	}
+	fprintf(out, "Residual: max %.4f, rms %.4f\n", max, table->n ? sqrt(sum / table->n) : 0);
+	return max;
+}
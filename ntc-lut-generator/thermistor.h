@@ -1,43 +1,55 @@
 #ifndef _THERMISTOR_H_
 #define _THERMISTOR_H_
 
+#include <stdio.h>
+
 #define R0_DEFAULT	(10000.0)
 #define AD_MAX_DEFAULT	(1024)
 #define AD_STEP_DEFAULT	(32)
+#define T_MIN_DEFAULT	(-5.0)
+#define T_MAX_DEFAULT	(105.0)
 
 #define M		4
-
-/** Type definition for a polynom. */
-typedef double polynom[M];
-
-extern double a[M];
-extern polynom basis[M];
-
-/* Evaluate p(x) */
-double value(polynom p, double x);
-/* Evaluate [p,q] */
-double skalarpoly(polynom p, polynom q);
-/* Evaluate p *= fact */
-void mult(polynom p, double fact);
-/* Evaluate p += fact*q */
-void linear(polynom p, polynom q, double fact);
-/* Build orthonormal base p from p */
-void orthonormal(polynom p[]);
-/* Evaluate [p, pf] */
-double skalar(polynom p);
-/* Evaluate approximating polynom. */
-polynom *approx(void);
-/* Reads all temperature- resistance pairs from an T-R table file. */
-void readtable(char *filename);
-/* Tests the approximation polynom with all t-r pairs. */
-void testresult(polynom *erg);
-/* Exits with error message in case of errors. */
-void errexit(char *format, ...);
-
-/* Evaluates p(x) for a polynom p. */
-double poly(double x, int degree, double p[]);
-/* Conversion from resistance to temperature. */
-double rtot(double r);
+#define MAX_POINTS	1024
+#define KELVIN		273.15
+
+/**
+ * Models of the thermistor, 1/T as a function of x = ln(R):
+ * MODEL_POLY:	1/T = a0 + a1*x + a2*x^2 + a3*x^3
+ * MODEL_SH:	1/T = a0 + a1*x + a3*x^3 (Steinhart-Hart)
+ * MODEL_BETA:	1/T = a0 + a1*x (1/T0 + ln(R/R0)/B)
+ */
+typedef enum {
+	MODEL_POLY,
+	MODEL_SH,
+	MODEL_BETA
+} model_type;
+
+/** Temperature-resistance table, temperature in Celsius and resistance in Ohm. */
+typedef struct {
+	int n;
+	double t[MAX_POINTS];
+	double r[MAX_POINTS];
+} rt_table;
+
+/** Fitted model. The polynomial is in x - x0, for a better conditioned fit. */
+typedef struct {
+	model_type type;
+	double x0;
+	double a[M];
+} thermistor;
+
+/* Model for a name (poly, sh or beta), -1 if unknown. */
+int model_by_name(const char *name);
+/* Name of a model. */
+const char *model_name(model_type type);
+/* Reads all temperature-resistance pairs from a T-R table file, 0 on success. */
+int readtable(const char *filename, rt_table *table);
+/* Least squares fit of a model to a T-R table (in 1/T), 0 on success. */
+int fit(model_type type, const rt_table *table, thermistor *th);
+/* Conversion from resistance to temperature (Celsius). */
+double rtot(const thermistor *th, double r);
+/* Prints the fit and the residual of each T-R pair, returns the max residual (degrees). */
+double testresult(const thermistor *th, const rt_table *table, FILE *out);
 
 #endif // _THERMISTOR_H_
-
@@ -28,6 +28,9 @@
  * buffer. If you should use another software that does not have this feature you may
  * need to lower the baudrate significantly.
  *
+ * Alternatively, the 'x' and 'y' commands accept the HEX file in a binary, flow
+ * controlled format (see tools/hexupload.cpp), which needs no character delay.
+ *
  */
 
 /* User configurable defines */
@@ -104,7 +107,14 @@
 #define BULK_ERASE_DATA_MEMORY              0x0B    /* Internally Timed */
 #define ROW_ERASE_PROGRAM_MEMORY            0x11    /* Internally Timed */
 
-/* declare hex data */
+/* Packed image format, see tools/pack.h */
+#define PACK_END			0x00
+#define PACK_EXT_ADDR		0x01
+#define PACK_ADDR			0x02
+#define PACK_COPY			0x40
+#define PACK_LITERAL		0x80
+
+/* declare (packed) hex data */
 /* For some reason PROGMEM messes with conditional compilation, */
 /* so better not put #if INCLUDE_???_HEX_DATA around these */
 extern const char hex_celsius[] PROGMEM;
@@ -112,6 +122,18 @@ extern const char hex_eeprom_celsius[] PROGMEM;
 extern const char hex_fahrenheit[] PROGMEM;
 extern const char hex_eeprom_fahrenheit[] PROGMEM;
 
+/* Binary upload protocol, see tools/hexupload.cpp */
+#define BIN_SOH			0x01
+#define BIN_ACK			0x06
+#define BIN_NAK			0x15
+#define BIN_ERR			0x18
+#define BIN_WINDOW		2
+#define BIN_BYTE_TIMEOUT	50		/* ms */
+#define BIN_IDLE_TIMEOUT	5000	/* ms */
+
+/* Set to 0 to suppress progress output (needed in binary mode) */
+unsigned char verbose = 1;
+
 unsigned char hex_nibble(unsigned char data) {
 	data = toupper(data);
 	return (data >= 'A' ? data - 'A' + 10 : data - '0') & 0xf;
@@ -135,36 +157,48 @@ unsigned char handle_hex_file_line(unsigned char bytecount,
 	if (recordtype == 1) {
 		reset_address();
 		device_address = 0;
-		Serial.println("Programming done");
+		if (verbose) {
+			Serial.println("Programming done");
+		}
 		return 1;
 	} else if (recordtype == 04) {
 		if (data[1] == 0) {
-			Serial.println("Programming program memory");
+			if (verbose) {
+				Serial.println("Programming program memory");
+			}
 			reset_address();
 			device_address = 0;
 		} else if (data[1] == 1) {
-			Serial.println("Programming config memory");
+			if (verbose) {
+				Serial.println("Programming config memory");
+			}
 			load_configuration(0);
 			device_address = 0;
 		}
 	} else if (recordtype == 00) {
 		if (address >= 0xE000) {
-			Serial.print("Programming ");
-			Serial.print(bytecount >> 1, DEC);
-			Serial.print(" bytes at EEPROM address 0x");
-			Serial.println((address & 0x1FFF) >> 1, HEX);
+			if (verbose) {
+				Serial.print("Programming ");
+				Serial.print(bytecount >> 1, DEC);
+				Serial.print(" bytes at EEPROM address 0x");
+				Serial.println((address & 0x1FFF) >> 1, HEX);
+			}
 
 			if (device_address != ((address & 0x1FFF) >> 1)
 					|| ((address & 0x1FFF) >> 1) == 0) {
-				Serial.println("Resetting address for EEPROM");
+				if (verbose) {
+					Serial.println("Resetting address for EEPROM");
+				}
 				reset_address();
 				device_address = 0;
 			}
 			while (device_address != ((address & 0x1FFF) >> 1)) {
 				increment_address();
 				device_address++;
-				Serial.print("Incrementing address to 0x");
-				Serial.println(device_address, HEX);
+				if (verbose) {
+					Serial.print("Incrementing address to 0x");
+					Serial.println(device_address, HEX);
+				}
 			}
 
 			for (i = 0; i < bytecount; i += 2) {
@@ -174,28 +208,34 @@ unsigned char handle_hex_file_line(unsigned char bytecount,
 				begin_internally_timed_programming();
 				data_in = read_data_from_data_memory();
 				if (data_in != data_out) {
-					Serial.print("Validation failed for EEPROM address 0x");
-					Serial.print(device_address, HEX);
-					Serial.print(" wrote 0x");
-					Serial.print(data_out, HEX);
-					Serial.print(" but read back 0x");
-					Serial.println(data_in, HEX);
-					return 1;
+					if (verbose) {
+						Serial.print("Validation failed for EEPROM address 0x");
+						Serial.print(device_address, HEX);
+						Serial.print(" wrote 0x");
+						Serial.print(data_out, HEX);
+						Serial.print(" but read back 0x");
+						Serial.println(data_in, HEX);
+					}
+					return 2;
 				}
 				increment_address();
 				device_address++;
 			}
 		} else {
-			Serial.print("Programming ");
-			Serial.print(bytecount >> 1, DEC);
-			Serial.print(" words at address 0x");
-			Serial.println(address >> 1, HEX);
+			if (verbose) {
+				Serial.print("Programming ");
+				Serial.print(bytecount >> 1, DEC);
+				Serial.print(" words at address 0x");
+				Serial.println(address >> 1, HEX);
+			}
 
 			while (device_address != (address >> 1)) {
 				increment_address();
 				device_address++;
-				Serial.print("Incrementing address to 0x");
-				Serial.println(device_address, HEX);
+				if (verbose) {
+					Serial.print("Incrementing address to 0x");
+					Serial.println(device_address, HEX);
+				}
 			}
 
 			for (i = 0; i < bytecount; i += 2) {
@@ -206,13 +246,15 @@ unsigned char handle_hex_file_line(unsigned char bytecount,
 				begin_internally_timed_programming();
 				data_word_in = read_data_from_program_memory();
 				if (data_word_in != data_word_out) {
-					Serial.print("Validation failed for address 0x");
-					Serial.print(device_address, HEX);
-					Serial.print(" wrote 0x");
-					Serial.print(data_word_out, HEX);
-					Serial.print(" but read back 0x");
-					Serial.println(data_word_in, HEX);
-					return 1;
+					if (verbose) {
+						Serial.print("Validation failed for address 0x");
+						Serial.print(device_address, HEX);
+						Serial.print(" wrote 0x");
+						Serial.print(data_word_out, HEX);
+						Serial.print(" but read back 0x");
+						Serial.println(data_word_in, HEX);
+					}
+					return 2;
 				}
 				increment_address();
 				device_address++;
@@ -277,50 +319,213 @@ void upload_hex_file_to_device() {
 	}
 }
 
-void upload_hex_from_progmem(PGM_P hexdata) {
+unsigned int crc16_update(unsigned int crc, unsigned char data) {
+	unsigned char i;
+
+	crc ^= ((unsigned int) data) << 8;
+	for (i = 0; i < 8; i++) {
+		if (crc & 0x8000) {
+			crc = (crc << 1) ^ 0x1021;
+		} else {
+			crc <<= 1;
+		}
+	}
+	return crc;
+}
+
+/* Read a byte from serial, return -1 if none arrives within timeout ms */
+int read_byte_timeout(unsigned int timeout) {
+	unsigned long start = millis();
+
+	while (Serial.available() < 1) {
+		if (millis() - start > timeout) {
+			return -1;
+		}
+	}
+	return Serial.read();
+}
+
+/* Receive one binary frame.
+ * SOH, seq, bytecount, address (high, low), recordtype, data[bytecount], CRC16 (high, low)
+ * return: 1 if a valid frame was received, 0 on error, -1 if host went quiet
+ */
+signed char receive_binary_frame(unsigned char *seq, unsigned char *bytecount,
+		unsigned int *address, unsigned char *recordtype, unsigned char data[]) {
+	unsigned char header[5];
+	unsigned int crc = 0xFFFF;
+	unsigned char i;
+	int rx;
+
+	// Wait for start of frame
+	do {
+		rx = read_byte_timeout(BIN_IDLE_TIMEOUT);
+		if (rx < 0) {
+			return -1;
+		}
+	} while (rx != BIN_SOH);
+
+	for (i = 0; i < 5; i++) {
+		if ((rx = read_byte_timeout(BIN_BYTE_TIMEOUT)) < 0) {
+			return 0;
+		}
+		header[i] = rx;
+		crc = crc16_update(crc, header[i]);
+	}
+
+	*seq = header[0];
+	*bytecount = header[1];
+	*address = (((unsigned int) header[2]) << 8) | header[3];
+	*recordtype = header[4];
+
+	if (*bytecount > 16) {
+		return 0;
+	}
+
+	for (i = 0; i < *bytecount; i++) {
+		if ((rx = read_byte_timeout(BIN_BYTE_TIMEOUT)) < 0) {
+			return 0;
+		}
+		data[i] = rx;
+		crc = crc16_update(crc, data[i]);
+	}
+
+	for (i = 0; i < 2; i++) {
+		if ((rx = read_byte_timeout(BIN_BYTE_TIMEOUT)) < 0) {
+			return 0;
+		}
+		crc ^= ((unsigned int) rx) << (i ? 0 : 8);
+	}
+
+	return crc == 0;
+}
+
+void send_response(unsigned char response, unsigned char seq) {
+	Serial.write(response);
+	Serial.write(seq);
+}
+
+/* Receive the HEX file as binary frames, with windowed acknowledgement.
+ * The host may have up to BIN_WINDOW frames in flight, which fits the
+ * serial receive buffer, so no character delay is needed.
+ */
+void upload_binary_to_device() {
+	unsigned char expected = 0;
 	unsigned char done = 0;
 
-	Serial.println("Programming hex data...");
+	Serial.println("Waiting for binary data...");
+	Serial.flush();
+	verbose = 0;
 
 	while (!done) {
+		unsigned char seq;
 		unsigned char bytecount;
 		unsigned int address;
 		unsigned char recordtype;
 		unsigned char data[16];
-		unsigned char checksum;
-		unsigned char i;
-
-		// Read bytecount
-		bytecount = pgm_read_byte(hexdata++);
-		checksum = bytecount;
+		signed char rv;
 
-		// Read address
-		address = ((unsigned int) pgm_read_byte(hexdata++)) << 8;
-		address |= pgm_read_byte(hexdata++);
-		checksum += ((unsigned char) (address >> 8));
-		checksum += ((unsigned char) (address));
+		rv = receive_binary_frame(&seq, &bytecount, &address, &recordtype, data);
 
-		// Read recordtype
-		recordtype = pgm_read_byte(hexdata++);
-		checksum += recordtype;
-
-		for (i = 0; i < bytecount; i++) {
-			data[i] = pgm_read_byte(hexdata++);
-			checksum += data[i];
+		if (rv < 0) {
+			verbose = 1;
+			Serial.println("Timeout waiting for data!");
+			return;
 		}
 
-		// Read checksum
-		i = pgm_read_byte(hexdata++);
-		checksum += i;
+		if (rv == 0) {
+			// Drop anything in flight and ask for retransmission
+			while (read_byte_timeout(BIN_BYTE_TIMEOUT) >= 0)
+				;
+			send_response(BIN_NAK, expected);
+			continue;
+		}
 
-		if (checksum) {
-			Serial.println("Checksum error!");
-			break;
+		if (seq != expected) {
+			// Acknowledge again if already programmed (lost ACK), else drop it
+			if ((unsigned char) (expected - seq) <= BIN_WINDOW) {
+				send_response(BIN_ACK, seq);
+			}
+			continue;
 		}
 
 		done = handle_hex_file_line(bytecount, address, recordtype, data);
+		send_response(done == 2 ? BIN_ERR : BIN_ACK, seq);
+		expected++;
 	}
 
+	Serial.flush();
+	verbose = 1;
+	Serial.println(done == 2 ? "Validation failed!" : "Programming done");
+}
+
+/* Decode a packed image from PROGMEM and program it.
+ * Words are collected into records of 16 bytes and passed on to
+ * handle_hex_file_line(), the last 256 words are kept for copies.
+ */
+void upload_hex_from_progmem(PGM_P hexdata) {
+	static unsigned int history[256];
+	unsigned char hpos = 0;
+	unsigned char data[16];
+	unsigned char bytecount = 0;
+	unsigned int address = 0;
+	unsigned char done = 0;
+
+	Serial.println("Programming hex data...");
+
+	while (!done) {
+		unsigned char c = pgm_read_byte(hexdata++);
+
+		if (c & (PACK_LITERAL | PACK_COPY)) {
+			unsigned char n, dist = 0, copy = 0;
+
+			if (c & PACK_LITERAL) {
+				n = (c & 0x7F) + 1;
+			} else {
+				n = (c & 0x3F) + 2;
+				dist = pgm_read_byte(hexdata++);
+				copy = 1;
+			}
+
+			while (n-- && !done) {
+				unsigned int word;
+				if (copy) {
+					word = history[(unsigned char) (hpos - dist - 1)];
+				} else {
+					word = pgm_read_byte(hexdata++);
+					word |= ((unsigned int) pgm_read_byte(hexdata++)) << 8;
+				}
+				history[hpos++] = word;
+				data[bytecount++] = (unsigned char) word;
+				data[bytecount++] = (unsigned char) (word >> 8);
+				if (bytecount == 16) {
+					done = handle_hex_file_line(bytecount, address, 0, data);
+					address += bytecount;
+					bytecount = 0;
+				}
+			}
+		} else {
+			// Flush partial record
+			if (bytecount) {
+				done = handle_hex_file_line(bytecount, address, 0, data);
+				address += bytecount;
+				bytecount = 0;
+				if (done) {
+					break;
+				}
+			}
+
+			if (c == PACK_ADDR) {
+				address = ((unsigned int) pgm_read_byte(hexdata++)) << 8;
+				address |= pgm_read_byte(hexdata++);
+			} else if (c == PACK_EXT_ADDR) {
+				data[0] = 0;
+				data[1] = pgm_read_byte(hexdata++);
+				done = handle_hex_file_line(2, 0, 4, data);
+			} else {
+				done = handle_hex_file_line(0, 0, 1, data);
+			}
+		}
+	}
 }
 
 /* low level bit transfer */
@@ -542,6 +747,24 @@ void get_device_id(unsigned int *magic, unsigned int *version,
 	p_exit();
 }
 
+/* Read the EEPROM layout version, stored by the firmware in the high byte
+ * of the power on config (the last EEPROM byte). Not used by OVBSC and RH.
+ */
+unsigned char get_eeprom_layout() {
+	unsigned char layout;
+	unsigned int i;
+
+	lvp_entry();
+	reset_address();
+	for (i = 0; i < 255; i++) {
+		increment_address();
+	}
+	layout = read_data_from_data_memory();
+	p_exit();
+
+	return layout;
+}
+
 void write_magic(unsigned int data_word_out) {
 	Serial.println("Writing magic.");
 	load_configuration(0);
@@ -640,6 +863,18 @@ void loop() {
 			upload_hex_file_to_device();
 			p_exit();
 			break;
+		case 'x':
+			lvp_entry();
+			bulk_erase_program_memory();
+			upload_binary_to_device();
+			p_exit();
+			break;
+		case 'y':
+			lvp_entry();
+			bulk_erase_data_memory();
+			upload_binary_to_device();
+			p_exit();
+			break;
 #if INCLUDE_CELSIUS_HEX_DATA
 		case 'a':
 			lvp_entry();
@@ -663,6 +898,7 @@ void loop() {
 #endif
 		case 'd': {
 			unsigned int magic, ver, deviceid;
+			unsigned char layout;
 			get_device_id(&magic, &ver, &deviceid);
 			Serial.print("Device ID is: 0x");
 			Serial.println(deviceid, HEX);
@@ -681,9 +917,16 @@ void loop() {
 					Serial.print((ver % 100) / 10, DEC);
 					Serial.print((ver % 10), DEC);
 					Serial.println(" detected.");
-					if (ver < STC1000P_EEPROM_VERSION) {
+					layout = get_eeprom_layout();
+					if (layout == STC1000P_EEPROM_VERSION) {
+						Serial.println(
+								"EEPROM layout is up to date (for the same firmware variant).");
+					} else if (layout > 0 && layout < STC1000P_EEPROM_VERSION) {
+						Serial.println(
+								"EEPROM data will be migrated to the current layout on first start, no need to initialize EEPROM.");
+					} else {
 						Serial.println(
-								"EEPROM has changes, consider initializing EEPROM when flashing.");
+								"EEPROM layout unknown, consider initializing EEPROM when flashing.");
 					}
 
 				} else {
@@ -744,1067 +987,790 @@ void loop() {
 
 #if INCLUDE_CELSIUS_HEX_DATA
 const char hex_celsius[] PROGMEM = {
-   0x02,0x00,0x00,0x04,0x00,0x00,0xFA,
-   0x10,0x00,0x00,0x00,0x00,0x00,0x8D,0x31,0x9A,0x2D,0xFF,0x34,0x8A,0x01,0x20,0x00,0x0B,0x1D,0x37,0x28,0x06,
-   0x10,0x00,0x10,0x00,0x22,0x00,0x8C,0x10,0x21,0x00,0x38,0x08,0x03,0x19,0x17,0x28,0x03,0x10,0x21,0x00,0x32,
-   0x10,0x00,0x20,0x00,0xB7,0x0C,0x82,0x30,0x20,0x00,0x95,0x00,0x21,0x00,0xB8,0x01,0x2C,0x28,0x21,0x00,0x57,
-   0x10,0x00,0x30,0x00,0x37,0x08,0x21,0x00,0x35,0x05,0x20,0x00,0xBB,0x00,0x3B,0x08,0x03,0x19,0x24,0x28,0xA0,
-   0x10,0x00,0x40,0x00,0xC1,0x30,0x20,0x00,0x95,0x00,0x27,0x28,0x43,0x30,0x20,0x00,0x95,0x00,0x22,0x00,0x71,
-   0x10,0x00,0x50,0x00,0x8C,0x14,0x01,0x30,0x21,0x00,0xB8,0x00,0x00,0x30,0x21,0x00,0x37,0x04,0x03,0x1D,0x4A,
-   0x10,0x00,0x60,0x00,0x35,0x28,0x21,0x00,0x95,0x16,0x20,0x00,0x8B,0x12,0x20,0x00,0x0B,0x11,0x20,0x00,0x4E,
-   0x10,0x00,0x70,0x00,0x91,0x1C,0x73,0x28,0x03,0x10,0x22,0x00,0x0D,0x0D,0x20,0x00,0xBB,0x00,0x3B,0x08,0xCB,
-   0x10,0x00,0x80,0x00,0x03,0x1D,0x44,0x28,0x10,0x30,0xBB,0x00,0x21,0x00,0x8E,0x01,0x22,0x00,0x8D,0x01,0x89,
-   0x10,0x00,0x90,0x00,0x20,0x00,0x3B,0x08,0x10,0x3A,0x03,0x19,0x5A,0x28,0x3B,0x08,0x20,0x3A,0x03,0x19,0x5C,
-   0x10,0x00,0xA0,0x00,0x5F,0x28,0x3B,0x08,0x40,0x3A,0x03,0x19,0x64,0x28,0x3B,0x08,0x80,0x3A,0x03,0x19,0x4B,
-   0x10,0x00,0xB0,0x00,0x69,0x28,0x6D,0x28,0x21,0x00,0x30,0x08,0x22,0x00,0x8E,0x00,0x6D,0x28,0x21,0x00,0x5B,
-   0x10,0x00,0xC0,0x00,0x31,0x08,0x22,0x00,0x8E,0x00,0x6D,0x28,0x21,0x00,0x32,0x08,0x22,0x00,0x8E,0x00,0xA7,
-   0x10,0x00,0xD0,0x00,0x6D,0x28,0x21,0x00,0x33,0x08,0x22,0x00,0x8E,0x00,0x20,0x00,0x3B,0x08,0x22,0x00,0xFA,
-   0x10,0x00,0xE0,0x00,0x8D,0x00,0x20,0x00,0x91,0x10,0x09,0x00,0x20,0x00,0xBE,0x01,0xBF,0x01,0xC0,0x01,0x59,
-   0x10,0x00,0xF0,0x00,0x80,0x30,0xC1,0x00,0x6A,0x30,0x21,0x00,0x99,0x00,0x0C,0x30,0x8C,0x00,0x22,0x00,0x51,
-   0x10,0x01,0x00,0x00,0x8C,0x01,0x21,0x00,0x8D,0x01,0x22,0x00,0x8D,0x01,0x21,0x00,0x8E,0x01,0x04,0x30,0x1F,
-   0x10,0x01,0x10,0x00,0x23,0x00,0x8C,0x00,0x21,0x00,0x1E,0x16,0x9E,0x17,0x23,0x00,0x8E,0x01,0x05,0x30,0x3F,
-   0x10,0x01,0x20,0x00,0x20,0x00,0x9C,0x00,0xFA,0x30,0x9B,0x00,0x21,0x00,0x91,0x14,0x72,0x30,0x28,0x00,0xBE,
-   0x10,0x01,0x30,0x00,0x97,0x00,0x7F,0x30,0xA0,0x27,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0xA8,0x00,0x1B,
-   0x10,0x01,0x40,0x00,0x28,0x0C,0x03,0x18,0xA5,0x28,0x28,0x00,0x17,0x11,0x03,0x1C,0xA9,0x28,0x28,0x00,0x2B,
-   0x10,0x01,0x50,0x00,0x17,0x15,0xFA,0x30,0x28,0x00,0x96,0x00,0x37,0x30,0x9E,0x00,0xFA,0x30,0x9D,0x00,0xBF,
-   0x10,0x01,0x60,0x00,0x72,0x30,0xA0,0x27,0x20,0x00,0xEB,0x00,0x77,0x08,0xEA,0x00,0xC0,0x30,0x20,0x00,0xA2,
-   0x10,0x01,0x70,0x00,0x8B,0x00,0x21,0x00,0x95,0x11,0x15,0x10,0x95,0x14,0x15,0x11,0x09,0x30,0x9D,0x00,0x63,
-   0x10,0x01,0x80,0x00,0x06,0x30,0x21,0x00,0x36,0x02,0x03,0x18,0x6C,0x29,0x21,0x00,0x37,0x08,0x03,0x1D,0xB0,
-   0x10,0x01,0x90,0x00,0x6C,0x29,0x21,0x00,0x36,0x08,0x03,0x1D,0xD1,0x28,0xFF,0x30,0x21,0x00,0xB5,0x00,0x4D,
-   0x10,0x01,0xA0,0x00,0x41,0x29,0x21,0x00,0x36,0x08,0x01,0x3A,0x03,0x1D,0xDC,0x28,0x45,0x30,0x21,0x00,0x91,
-   0x10,0x01,0xB0,0x00,0xB5,0x00,0x20,0x00,0xC9,0x01,0x41,0x29,0x21,0x00,0x36,0x08,0x02,0x3A,0x03,0x1D,0x7B,
-   0x10,0x01,0xC0,0x00,0x08,0x29,0x75,0x30,0xA0,0x27,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0xA8,0x00,0xFB,
-   0x10,0x01,0xD0,0x00,0x28,0x0E,0xF0,0x39,0xA9,0x00,0x20,0x00,0x6C,0x08,0x20,0x00,0xCA,0x00,0x20,0x00,0x79,
-   0x10,0x01,0xE0,0x00,0x6D,0x08,0x20,0x00,0xCB,0x00,0x20,0x00,0xA8,0x00,0xAB,0x01,0xA8,0x1B,0xAB,0x03,0xCA,
-   0x10,0x01,0xF0,0x00,0x0F,0x30,0xA8,0x05,0xAB,0x01,0x29,0x08,0xAA,0x00,0xAC,0x01,0x28,0x08,0x2A,0x04,0x81,
-   0x10,0x02,0x00,0x00,0xA9,0x00,0x2B,0x08,0x2C,0x04,0xAD,0x00,0x29,0x08,0x21,0x00,0xB5,0x00,0x41,0x29,0xC4,
-   0x10,0x02,0x10,0x00,0x21,0x00,0x36,0x08,0x03,0x3A,0x03,0x1D,0x12,0x29,0x20,0x00,0x4A,0x08,0x21,0x00,0x54,
-   0x10,0x02,0x20,0x00,0xB5,0x00,0x41,0x29,0x21,0x00,0x36,0x08,0x04,0x3A,0x03,0x1D,0x38,0x29,0x20,0x00,0x71,
-   0x10,0x02,0x30,0x00,0xA9,0x01,0x22,0x00,0x8C,0x1E,0x1E,0x29,0x20,0x00,0xA9,0x0A,0x20,0x00,0x29,0x0E,0xD7,
-   0x10,0x02,0x40,0x00,0xF0,0x39,0xA8,0x00,0x03,0x10,0xA8,0x0D,0x03,0x10,0xA8,0x0D,0xA9,0x01,0x22,0x00,0x81,
-   0x10,0x02,0x50,0x00,0x0C,0x1E,0x2C,0x29,0x20,0x00,0xA9,0x0A,0x20,0x00,0x29,0x0E,0xF0,0x39,0xAB,0x00,0x21,
-   0x10,0x02,0x60,0x00,0x28,0x08,0xA9,0x00,0x2B,0x08,0xA8,0x00,0x29,0x04,0x21,0x00,0xB5,0x00,0x41,0x29,0x6D,
-   0x10,0x02,0x70,0x00,0x21,0x00,0x36,0x08,0x05,0x3A,0x03,0x1D,0x41,0x29,0x20,0x00,0x49,0x08,0x21,0x00,0xC4,
-   0x10,0x02,0x80,0x00,0xB5,0x00,0x21,0x00,0x35,0x08,0x20,0x00,0xA9,0x00,0x08,0x30,0xA8,0x00,0x20,0x00,0x92,
-   0x10,0x02,0x90,0x00,0x28,0x08,0xAB,0x00,0xA8,0x03,0x2B,0x08,0x03,0x19,0x63,0x29,0x29,0x08,0x20,0x00,0xAC,
-   0x10,0x02,0xA0,0x00,0x49,0x06,0x20,0x00,0xAB,0x00,0x80,0x30,0xAB,0x05,0x03,0x10,0x20,0x00,0xC9,0x0D,0xCB,
-   0x10,0x02,0xB0,0x00,0x20,0x00,0x2B,0x08,0x03,0x19,0x5F,0x29,0x31,0x30,0x20,0x00,0xC9,0x06,0x03,0x10,0xE4,
-   0x10,0x02,0xC0,0x00,0x20,0x00,0xA9,0x0D,0x47,0x29,0x80,0x30,0x21,0x00,0xB7,0x00,0x20,0x00,0x8B,0x16,0x9F,
-   0x10,0x02,0xD0,0x00,0x21,0x00,0x95,0x12,0x21,0x00,0xB6,0x0A,0x20,0x00,0x93,0x1D,0x82,0x29,0x88,0x31,0x41,
-   0x10,0x02,0xE0,0x00,0x00,0x20,0x81,0x31,0x28,0x00,0x17,0x19,0x80,0x29,0xFF,0x30,0x21,0x00,0xB3,0x00,0x38,
-   0x10,0x02,0xF0,0x00,0x03,0x30,0x21,0x00,0xB0,0x00,0x59,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,0xB1,0x00,0xCC,
-   0x10,0x03,0x00,0x00,0x20,0x00,0x93,0x11,0x20,0x00,0x93,0x1C,0x1A,0x2E,0x20,0x00,0xBE,0x0A,0x03,0x19,0x0E,
-   0x10,0x03,0x10,0x00,0xBF,0x0A,0x3E,0x1C,0xD1,0x29,0x40,0x08,0xF7,0x00,0x41,0x08,0x20,0x00,0xA0,0x00,0x78,
-   0x10,0x03,0x20,0x00,0x77,0x08,0xA1,0x00,0x21,0x00,0x9D,0x14,0x21,0x00,0x9D,0x18,0x94,0x29,0x1D,0x10,0x1B,
-   0x10,0x03,0x30,0x00,0x20,0x00,0x21,0x0E,0x0F,0x39,0xA2,0x00,0x20,0x0E,0xA3,0x00,0xF0,0x39,0xA2,0x04,0xE4,
-   0x10,0x03,0x40,0x00,0xA3,0x06,0x03,0x10,0xA3,0x0C,0xA2,0x0C,0x03,0x10,0xA3,0x0C,0xA2,0x0C,0x22,0x08,0xFA,
-   0x10,0x03,0x50,0x00,0xA1,0x02,0x23,0x08,0x03,0x1C,0x23,0x0F,0xA0,0x02,0x21,0x00,0x1C,0x08,0x20,0x00,0x77,
-   0x10,0x03,0x60,0x00,0xA2,0x00,0xA3,0x01,0x22,0x08,0xA4,0x00,0xA6,0x01,0x21,0x00,0x1B,0x08,0x20,0x00,0x6E,
-   0x10,0x03,0x70,0x00,0xA2,0x00,0xA3,0x01,0x22,0x08,0xA6,0x04,0x23,0x08,0xA4,0x04,0x26,0x08,0xA2,0x00,0xC0,
-   0x10,0x03,0x80,0x00,0x24,0x08,0xA3,0x00,0x22,0x08,0xA1,0x07,0x23,0x08,0x03,0x18,0x23,0x0F,0xA0,0x07,0xAD,
-   0x10,0x03,0x90,0x00,0x21,0x08,0xF7,0x00,0x20,0x08,0xC1,0x00,0x77,0x08,0xC0,0x00,0x09,0x30,0x21,0x00,0xBB,
-   0x10,0x03,0xA0,0x00,0x9D,0x00,0x20,0x00,0x3E,0x08,0x0F,0x39,0x03,0x1D,0x18,0x2E,0x40,0x08,0xF7,0x00,0x5D,
-   0x10,0x03,0xB0,0x00,0x41,0x08,0x20,0x00,0xA0,0x00,0x77,0x08,0xA1,0x00,0x20,0x30,0xA2,0x00,0xA3,0x01,0x7E,
-   0x10,0x03,0xC0,0x00,0xA4,0x01,0xA6,0x01,0x21,0x0E,0x0F,0x39,0xA5,0x00,0x20,0x0E,0xA7,0x00,0xF0,0x39,0xC7,
-   0x10,0x03,0xD0,0x00,0xA5,0x04,0xA7,0x06,0x03,0x10,0xA7,0x0C,0xA5,0x0C,0x3F,0x30,0xA5,0x05,0xA7,0x01,0x8F,
-   0x10,0x03,0xE0,0x00,0x25,0x08,0xA9,0x00,0x03,0x10,0x20,0x0C,0xA5,0x00,0xA7,0x01,0x03,0x10,0xA7,0x0C,0xE5,
-   0x10,0x03,0xF0,0x00,0xA5,0x0C,0x03,0x10,0xA7,0x0C,0xA5,0x0C,0x1F,0x30,0xA5,0x05,0xA7,0x01,0x25,0x08,0x07,
-   0x10,0x04,0x00,0x00,0xA8,0x00,0x20,0x08,0xA5,0x00,0xA7,0x01,0x25,0x08,0xA1,0x00,0xF8,0x30,0x21,0x02,0xB6,
-   0x10,0x04,0x10,0x00,0x03,0x18,0x0E,0x2A,0x09,0x30,0x21,0x02,0x03,0x18,0x10,0x2A,0x21,0x00,0x34,0x14,0x6F,
-   0x10,0x04,0x20,0x00,0x20,0x00,0x28,0x0A,0xA1,0x00,0x02,0x30,0xF7,0x00,0x21,0x08,0x8E,0x31,0xEE,0x26,0xB4,
-   0x10,0x04,0x30,0x00,0x82,0x31,0x20,0x00,0xA0,0x00,0xA5,0x01,0x20,0x08,0x82,0x3E,0xA0,0x00,0x8E,0x30,0x5D,
-   0x10,0x04,0x40,0x00,0xA1,0x00,0x25,0x08,0x03,0x18,0x25,0x0F,0xA1,0x07,0x02,0x30,0xF7,0x00,0x28,0x08,0x8E,
-   0x10,0x04,0x50,0x00,0x8E,0x31,0xEE,0x26,0x82,0x31,0x20,0x00,0xA5,0x00,0xA7,0x01,0x25,0x08,0x82,0x3E,0xBC,
-   0x10,0x04,0x60,0x00,0xA5,0x00,0x27,0x08,0x03,0x18,0x27,0x0F,0x8E,0x3E,0xA7,0x00,0xA8,0x01,0x20,0x00,0x2B,
-   0x10,0x04,0x70,0x00,0x29,0x08,0x28,0x02,0x03,0x1C,0x5F,0x2A,0x25,0x08,0xF6,0x00,0x27,0x08,0xF7,0x00,0x30,
-   0x10,0x04,0x80,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x82,0x31,0x20,0x00,0xAB,0x00,0x77,0x08,0xAA,0x00,0x5D,
-   0x10,0x04,0x90,0x00,0xAC,0x00,0x2B,0x08,0xAD,0x00,0x00,0x30,0xAD,0x1B,0xFF,0x30,0xBD,0x00,0xBC,0x00,0x30,
-   0x10,0x04,0xA0,0x00,0x2C,0x08,0xA2,0x07,0x2D,0x08,0x03,0x18,0x2D,0x0F,0xA3,0x07,0x3C,0x08,0x03,0x18,0xDA,
-   0x10,0x04,0xB0,0x00,0x3C,0x0F,0xA4,0x07,0x3D,0x08,0x03,0x18,0x3D,0x0F,0xA6,0x07,0x82,0x2A,0x20,0x00,0x21,
-   0x10,0x04,0xC0,0x00,0x20,0x08,0xF6,0x00,0x21,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x82,0x31,0xD3,
-   0x10,0x04,0xD0,0x00,0x20,0x00,0xAB,0x00,0x77,0x08,0xAA,0x00,0xAC,0x00,0x2B,0x08,0xAD,0x00,0x00,0x30,0x6C,
-   0x10,0x04,0xE0,0x00,0xAD,0x1B,0xFF,0x30,0xBD,0x00,0xBC,0x00,0x2C,0x08,0xA2,0x07,0x2D,0x08,0x03,0x18,0x6F,
-   0x10,0x04,0xF0,0x00,0x2D,0x0F,0xA3,0x07,0x3C,0x08,0x03,0x18,0x3C,0x0F,0xA4,0x07,0x3D,0x08,0x03,0x18,0x61,
-   0x10,0x05,0x00,0x00,0x3D,0x0F,0xA6,0x07,0x20,0x00,0xA8,0x0A,0x40,0x30,0x28,0x02,0x03,0x1C,0x37,0x2A,0x06,
-   0x10,0x05,0x10,0x00,0x22,0x0E,0x0F,0x39,0xA1,0x00,0x23,0x0E,0xA0,0x00,0xF0,0x39,0xA1,0x04,0xA0,0x06,0x7D,
-   0x10,0x05,0x20,0x00,0x24,0x0E,0xA5,0x00,0xF0,0x39,0xA0,0x04,0xA5,0x06,0x26,0x0E,0xA7,0x00,0xF0,0x39,0x78,
-   0x10,0x05,0x30,0x00,0xA5,0x04,0xA7,0x06,0xF0,0x30,0xA7,0x19,0xA7,0x04,0x03,0x10,0xA7,0x1B,0x03,0x14,0xEE,
-   0x10,0x05,0x40,0x00,0xA7,0x0C,0xA5,0x0C,0xA0,0x0C,0xA1,0x0C,0x03,0x10,0xA7,0x1B,0x03,0x14,0xA7,0x0C,0x4F,
-   0x10,0x05,0x50,0x00,0xA5,0x0C,0xA0,0x0C,0xA1,0x0C,0x21,0x08,0xA2,0x00,0x20,0x08,0xA3,0x00,0x22,0x08,0xD1,
-   0x10,0x05,0x60,0x00,0xF7,0x00,0x23,0x08,0xC3,0x00,0x77,0x08,0xC2,0x00,0x74,0x30,0xA0,0x27,0x20,0x00,0xDA,
-   0x10,0x05,0x70,0x00,0xC5,0x00,0x77,0x08,0xC4,0x00,0x42,0x08,0xC6,0x00,0x43,0x08,0xC7,0x00,0x44,0x08,0x05,
-   0x10,0x05,0x80,0x00,0x46,0x07,0x20,0x00,0xEC,0x00,0x20,0x00,0x47,0x08,0x20,0x00,0xED,0x00,0x20,0x00,0x76,
-   0x10,0x05,0x90,0x00,0x45,0x08,0x03,0x18,0x45,0x0A,0x03,0x19,0xCF,0x2A,0x20,0x00,0xED,0x07,0x03,0x30,0x48,
-   0x10,0x05,0xA0,0x00,0x21,0x00,0x39,0x02,0x03,0x18,0xD6,0x2A,0x21,0x00,0xB6,0x01,0x21,0x00,0x39,0x08,0x9A,
-   0x10,0x05,0xB0,0x00,0x03,0x1D,0xDC,0x2A,0x30,0x30,0xB9,0x00,0x21,0x00,0xB9,0x03,0x21,0x00,0x34,0x1C,0xAE,
-   0x10,0x05,0xC0,0x00,0xE4,0x2A,0x22,0x00,0x0C,0x14,0xE6,0x2A,0x22,0x00,0x0C,0x10,0x21,0x00,0x34,0x10,0x28,
-   0x10,0x05,0xD0,0x00,0x22,0x00,0x0C,0x1C,0x05,0x2B,0x20,0x00,0x99,0x1F,0xF9,0x2A,0x11,0x30,0x21,0x00,0x44,
-   0x10,0x05,0xE0,0x00,0xB0,0x00,0xCB,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,0x6B,
-   0x10,0x05,0xF0,0x00,0xB3,0x00,0x22,0x00,0x0C,0x12,0x8C,0x12,0x3C,0x30,0x21,0x00,0xAE,0x00,0xAF,0x01,0x7F,
-   0x10,0x06,0x00,0x00,0x3C,0x30,0x21,0x00,0xAC,0x00,0xAD,0x01,0x18,0x2E,0x7C,0x30,0xA0,0x27,0x20,0x00,0x2A,
-   0x10,0x06,0x10,0x00,0xC3,0x00,0x77,0x08,0xC2,0x00,0xC4,0x00,0x06,0x30,0x44,0x02,0x03,0x18,0x30,0x2C,0x1F,
-   0x10,0x06,0x20,0x00,0x21,0x00,0x33,0x13,0x03,0x30,0x20,0x00,0x3F,0x02,0x03,0x1D,0x19,0x2B,0xE8,0x30,0x53,
-   0x10,0x06,0x30,0x00,0x3E,0x02,0x03,0x1C,0x35,0x2C,0x7C,0x30,0xA0,0x27,0x20,0x00,0xAC,0x00,0x77,0x08,0x3C,
-   0x10,0x06,0x40,0x00,0xAD,0x00,0xBD,0x00,0x06,0x30,0x3D,0x02,0x03,0x18,0x2B,0x2C,0x77,0x30,0xA0,0x27,0xEB,
-   0x10,0x06,0x50,0x00,0x20,0x00,0xAC,0x00,0x77,0x08,0xAD,0x00,0xBC,0x00,0x20,0x00,0xEE,0x0A,0x03,0x19,0xB2,
-   0x10,0x06,0x60,0x00,0xEF,0x0A,0x09,0x30,0x20,0x00,0x3C,0x02,0x03,0x1C,0x38,0x2B,0x08,0x30,0xBC,0x00,0x84,
-   0x10,0x06,0x70,0x00,0x13,0x30,0xF7,0x00,0x20,0x00,0x3D,0x08,0x8E,0x31,0xEE,0x26,0x83,0x31,0x20,0x00,0x34,
-   0x10,0x06,0x80,0x00,0xAD,0x00,0x03,0x10,0x3C,0x0D,0xBD,0x00,0xAD,0x07,0x2D,0x0A,0xAC,0x00,0xA0,0x27,0x46,
-   0x10,0x06,0x90,0x00,0x20,0x00,0xBD,0x00,0x77,0x08,0xAC,0x00,0x02,0x30,0x2D,0x07,0xAE,0x00,0xA0,0x27,0x77,
-   0x10,0x06,0xA0,0x00,0x20,0x00,0xAF,0x00,0x77,0x08,0xAE,0x00,0x3D,0x08,0x20,0x00,0x6F,0x02,0x03,0x1D,0x58,
-   0x10,0x06,0xB0,0x00,0x5D,0x2B,0x20,0x00,0x2C,0x08,0x20,0x00,0x6E,0x02,0x03,0x1C,0x94,0x2B,0x20,0x00,0xD0,
-   0x10,0x06,0xC0,0x00,0x2E,0x08,0x20,0x00,0xEA,0x00,0x20,0x00,0x2F,0x08,0x20,0x00,0xEB,0x00,0x20,0x00,0x68,
-   0x10,0x06,0xD0,0x00,0x2E,0x08,0xF6,0x00,0x2F,0x08,0xF7,0x00,0x72,0x30,0x63,0x27,0x20,0x00,0x3C,0x08,0x30,
-   0x10,0x06,0xE0,0x00,0x08,0x3A,0x03,0x19,0x7E,0x2B,0x03,0x30,0x2D,0x07,0xB0,0x00,0xA0,0x27,0x20,0x00,0x05,
-   0x10,0x06,0xF0,0x00,0xB1,0x00,0x77,0x08,0xB0,0x00,0x31,0x04,0x03,0x1D,0x85,0x2B,0x06,0x30,0xF6,0x00,0xE9,
-   0x10,0x07,0x00,0x00,0x00,0x30,0xF7,0x00,0x7C,0x30,0x63,0x27,0x2B,0x2C,0x20,0x00,0xEE,0x01,0xEF,0x01,0x36,
-   0x10,0x07,0x10,0x00,0x20,0x00,0xBC,0x0A,0x3C,0x08,0xB0,0x00,0xB1,0x01,0x30,0x08,0xF6,0x00,0x31,0x08,0xE6,
-   0x10,0x07,0x20,0x00,0xF7,0x00,0x77,0x30,0x63,0x27,0x2B,0x2C,0x7B,0x30,0xA0,0x27,0x20,0x00,0xB0,0x00,0x08,
-   0x10,0x07,0x30,0x00,0x77,0x08,0xBC,0x00,0x30,0x04,0x03,0x19,0x2B,0x2C,0x2D,0x08,0xA0,0x27,0x20,0x00,0xBB,
-   0x10,0x07,0x40,0x00,0xBC,0x00,0x77,0x08,0xAD,0x00,0x20,0x00,0x6F,0x0E,0xF0,0x39,0x20,0x00,0xB1,0x00,0x2A,
-   0x10,0x07,0x50,0x00,0x20,0x00,0x6E,0x0E,0x20,0x00,0xB0,0x00,0x0F,0x39,0xB1,0x04,0xB0,0x06,0x03,0x10,0x67,
-   0x10,0x07,0x60,0x00,0xB0,0x0D,0xB1,0x0D,0x03,0x10,0xB0,0x0D,0xB1,0x0D,0x20,0x30,0xB2,0x00,0xB3,0x01,0xCA,
-   0x10,0x07,0x70,0x00,0xB4,0x01,0xB5,0x01,0xB6,0x01,0x20,0x00,0x3D,0x08,0x31,0x02,0x03,0x1D,0xC2,0x2B,0xB2,
-   0x10,0x07,0x80,0x00,0x2C,0x08,0x30,0x02,0x03,0x1C,0xE3,0x2B,0x20,0x00,0x2C,0x08,0xB0,0x02,0x3D,0x08,0x8B,
-   0x10,0x07,0x90,0x00,0x03,0x1C,0x3D,0x0F,0xB1,0x02,0x2E,0x08,0xB7,0x00,0x2F,0x08,0xB8,0x00,0x00,0x30,0x2F,
-   0x10,0x07,0xA0,0x00,0xB8,0x1B,0xFF,0x30,0xBA,0x00,0xB9,0x00,0x37,0x08,0xB2,0x07,0x38,0x08,0x03,0x18,0x81,
-   0x10,0x07,0xB0,0x00,0x38,0x0F,0xB3,0x07,0x39,0x08,0x03,0x18,0x39,0x0F,0xB4,0x07,0x3A,0x08,0x03,0x18,0x7C,
-   0x10,0x07,0xC0,0x00,0x3A,0x0F,0xB5,0x07,0xFB,0x2B,0x20,0x00,0x2D,0x08,0xB7,0x00,0x3C,0x08,0xB8,0x00,0xF6,
-   0x10,0x07,0xD0,0x00,0x00,0x30,0xB8,0x1B,0xFF,0x30,0xBA,0x00,0xB9,0x00,0x37,0x08,0xB2,0x07,0x38,0x08,0x3C,
-   0x10,0x07,0xE0,0x00,0x03,0x18,0x38,0x0F,0xB3,0x07,0x39,0x08,0x03,0x18,0x39,0x0F,0xB4,0x07,0x3A,0x08,0x4C,
-   0x10,0x07,0xF0,0x00,0x03,0x18,0x3A,0x0F,0xB5,0x07,0x20,0x00,0xB6,0x0A,0x40,0x30,0x36,0x02,0x03,0x1C,0x32,
-   0x10,0x08,0x00,0x00,0xBB,0x2B,0x32,0x0E,0x0F,0x39,0xB2,0x00,0x33,0x0E,0xB3,0x00,0xF0,0x39,0xB2,0x04,0xF5,
-   0x10,0x08,0x10,0x00,0xB3,0x06,0x34,0x0E,0xB4,0x00,0xF0,0x39,0xB3,0x04,0xB4,0x06,0x35,0x0E,0xB5,0x00,0x97,
-   0x10,0x08,0x20,0x00,0xF0,0x39,0xB4,0x04,0xB5,0x06,0xF0,0x30,0xB5,0x19,0xB5,0x04,0x03,0x10,0xB5,0x1B,0xA2,
-   0x10,0x08,0x30,0x00,0x03,0x14,0xB5,0x0C,0xB4,0x0C,0xB3,0x0C,0xB2,0x0C,0x03,0x10,0xB5,0x1B,0x03,0x14,0xA9,
-   0x10,0x08,0x40,0x00,0xB5,0x0C,0xB4,0x0C,0xB3,0x0C,0xB2,0x0C,0x32,0x08,0x20,0x00,0xEA,0x00,0x20,0x00,0x46,
-   0x10,0x08,0x50,0x00,0x33,0x08,0x20,0x00,0xEB,0x00,0x08,0x30,0x20,0x00,0xBE,0x00,0xBF,0x01,0x35,0x2C,0x1B,
-   0x10,0x08,0x60,0x00,0x21,0x00,0x33,0x17,0x20,0x00,0xBE,0x01,0xBF,0x01,0x76,0x30,0xA0,0x27,0x20,0x00,0xF1,
-   0x10,0x08,0x70,0x00,0xC3,0x00,0x77,0x08,0xC2,0x00,0x43,0x04,0x03,0x19,0x9D,0x2C,0x20,0x00,0x6A,0x08,0xB6,
-   0x10,0x08,0x80,0x00,0x20,0x00,0x6C,0x02,0x20,0x00,0xC4,0x00,0x20,0x00,0x6B,0x08,0x03,0x1C,0x6B,0x0A,0xCF,
-   0x10,0x08,0x90,0x00,0x20,0x00,0x6D,0x02,0x20,0x00,0xC5,0x00,0x03,0x14,0xC5,0x1F,0x03,0x10,0x03,0x1C,0xB7,
-   0x10,0x08,0xA0,0x00,0x56,0x2C,0xC4,0x09,0xC5,0x09,0xC4,0x0A,0x03,0x19,0xC5,0x0A,0x03,0x14,0x20,0x00,0x3B,
-   0x10,0x08,0xB0,0x00,0xC3,0x1F,0x03,0x10,0x03,0x1C,0x7F,0x2C,0xC2,0x09,0xC3,0x09,0xC2,0x0A,0x03,0x19,0xFA,
-   0x10,0x08,0xC0,0x00,0xC3,0x0A,0x43,0x08,0x80,0x3E,0xC8,0x00,0x45,0x08,0x80,0x3E,0x48,0x02,0x03,0x1D,0x15,
-   0x10,0x08,0xD0,0x00,0x6B,0x2C,0x44,0x08,0x42,0x02,0x20,0x00,0xC6,0x01,0x03,0x1C,0x46,0x14,0x46,0x08,0x43,
-   0x10,0x08,0xE0,0x00,0x00,0x30,0x03,0x19,0x01,0x30,0xC7,0x00,0xC6,0x00,0x46,0x0C,0x03,0x18,0x7A,0x2C,0xEB,
-   0x10,0x08,0xF0,0x00,0x22,0x00,0x0C,0x10,0x03,0x1C,0x7E,0x2C,0x22,0x00,0x0C,0x14,0x9D,0x2C,0x20,0x00,0xC6,
-   0x10,0x09,0x00,0x00,0x45,0x08,0x80,0x3E,0xC8,0x00,0x43,0x08,0x80,0x3E,0x48,0x02,0x03,0x1D,0x8A,0x2C,0xEB,
-   0x10,0x09,0x10,0x00,0x42,0x08,0x44,0x02,0x20,0x00,0xC6,0x01,0x03,0x1C,0x46,0x14,0x46,0x08,0x00,0x30,0x69,
-   0x10,0x09,0x20,0x00,0x03,0x19,0x01,0x30,0xC2,0x00,0xC6,0x00,0x46,0x0C,0x03,0x18,0x99,0x2C,0x22,0x00,0x9E,
-   0x10,0x09,0x30,0x00,0x0C,0x10,0x03,0x1C,0x9D,0x2C,0x22,0x00,0x0C,0x14,0x21,0x00,0x2C,0x08,0x2D,0x04,0xEB,
-   0x10,0x09,0x40,0x00,0x03,0x19,0xA6,0x2C,0xFF,0x30,0xAC,0x07,0x03,0x1C,0xAD,0x03,0x21,0x00,0x2E,0x08,0xB1,
-   0x10,0x09,0x50,0x00,0x2F,0x04,0x03,0x19,0xAF,0x2C,0xFF,0x30,0xAE,0x07,0x03,0x1C,0xAF,0x03,0x20,0x00,0x98,
-   0x10,0x09,0x60,0x00,0xA7,0x01,0x22,0x00,0x0C,0x1E,0xB6,0x2C,0x20,0x00,0xA7,0x0A,0x20,0x00,0x27,0x08,0x91,
-   0x10,0x09,0x70,0x00,0x00,0x30,0x03,0x19,0x01,0x30,0xA9,0x00,0xA7,0x00,0x27,0x0C,0x03,0x18,0xC2,0x2C,0x6E,
-   0x10,0x09,0x80,0x00,0x21,0x00,0xB3,0x13,0x03,0x1C,0xC6,0x2C,0x21,0x00,0xB3,0x17,0x20,0x00,0xA7,0x01,0xBC,
-   0x10,0x09,0x90,0x00,0x22,0x00,0x8C,0x1E,0xCD,0x2C,0x20,0x00,0xA7,0x0A,0x20,0x00,0x27,0x08,0x00,0x30,0x42,
-   0x10,0x09,0xA0,0x00,0x03,0x19,0x01,0x30,0xA9,0x00,0xA7,0x00,0x27,0x0C,0x03,0x18,0xD9,0x2C,0x21,0x00,0x36,
-   0x10,0x09,0xB0,0x00,0xB3,0x11,0x03,0x1C,0xDD,0x2C,0x21,0x00,0xB3,0x15,0x22,0x00,0x0C,0x1E,0xF2,0x2C,0xF8,
-   0x10,0x09,0xC0,0x00,0x20,0x00,0x6B,0x08,0x80,0x3E,0x20,0x00,0xA8,0x00,0x20,0x00,0x6D,0x08,0x80,0x3E,0xBB,
-   0x10,0x09,0xD0,0x00,0x20,0x00,0x28,0x02,0x03,0x1D,0xF0,0x2C,0x20,0x00,0x6C,0x08,0x20,0x00,0x6A,0x02,0x71,
-   0x10,0x09,0xE0,0x00,0x03,0x18,0x07,0x2D,0x22,0x00,0x8C,0x1E,0x65,0x2D,0x20,0x00,0x6D,0x08,0x80,0x3E,0x07,
-   0x10,0x09,0xF0,0x00,0x20,0x00,0xA8,0x00,0x20,0x00,0x6B,0x08,0x80,0x3E,0x20,0x00,0x28,0x02,0x03,0x1D,0x74,
-   0x10,0x0A,0x00,0x00,0x05,0x2D,0x20,0x00,0x6A,0x08,0x20,0x00,0x6C,0x02,0x03,0x1C,0x65,0x2D,0x79,0x30,0x3A,
-   0x10,0x0A,0x10,0x00,0xA0,0x27,0x20,0x00,0xA9,0x00,0x77,0x08,0xA7,0x00,0x29,0x0E,0xF0,0x39,0x21,0x00,0x9F,
-   0x10,0x0A,0x20,0x00,0xAD,0x00,0x20,0x00,0x27,0x0E,0x21,0x00,0xAC,0x00,0x0F,0x39,0xAD,0x04,0xAC,0x06,0x4C,
-   0x10,0x0A,0x30,0x00,0x03,0x10,0xAC,0x0D,0xAD,0x0D,0x03,0x10,0xAC,0x0D,0xAD,0x0D,0x2C,0x0E,0x0F,0x39,0x28,
-   0x10,0x0A,0x40,0x00,0x20,0x00,0xA7,0x00,0x21,0x00,0x2D,0x0E,0x20,0x00,0xA9,0x00,0xF0,0x39,0xA7,0x04,0xE6,
-   0x10,0x0A,0x50,0x00,0xA9,0x06,0x27,0x08,0x21,0x00,0xAC,0x02,0x20,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x46,
-   0x10,0x0A,0x60,0x00,0x03,0x19,0x34,0x2D,0x21,0x00,0xAD,0x02,0x7A,0x30,0xA0,0x27,0x20,0x00,0xA9,0x00,0xFF,
-   0x10,0x0A,0x70,0x00,0x77,0x08,0xA7,0x00,0x29,0x0E,0xF0,0x39,0x21,0x00,0xAF,0x00,0x20,0x00,0x27,0x0E,0xCB,
-   0x10,0x0A,0x80,0x00,0x21,0x00,0xAE,0x00,0x0F,0x39,0xAF,0x04,0xAE,0x06,0x03,0x10,0xAE,0x0D,0xAF,0x0D,0x5E,
-   0x10,0x0A,0x90,0x00,0x03,0x10,0xAE,0x0D,0xAF,0x0D,0x2E,0x0E,0x0F,0x39,0x20,0x00,0xA7,0x00,0x21,0x00,0x60,
-   0x10,0x0A,0xA0,0x00,0x2F,0x0E,0x20,0x00,0xA9,0x00,0xF0,0x39,0xA7,0x04,0xA9,0x06,0x27,0x08,0x21,0x00,0x6D,
-   0x10,0x0A,0xB0,0x00,0xAE,0x02,0x20,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x03,0x19,0x61,0x2D,0x21,0x00,0x18,
-   0x10,0x0A,0xC0,0x00,0xAF,0x02,0x22,0x00,0x0C,0x12,0x8C,0x12,0xE7,0x2D,0x22,0x00,0x0C,0x1A,0xE7,0x2D,0x27,
-   0x10,0x0A,0xD0,0x00,0x8C,0x1A,0xE7,0x2D,0x73,0x30,0xA0,0x27,0x20,0x00,0xA9,0x00,0x77,0x08,0xA7,0x00,0x03,
-   0x10,0x0A,0xE0,0x00,0x20,0x00,0x6A,0x07,0x20,0x00,0xA8,0x00,0x20,0x00,0x6B,0x08,0x20,0x00,0xAB,0x00,0x4F,
-   0x10,0x0A,0xF0,0x00,0x29,0x08,0x03,0x18,0x29,0x0F,0xAB,0x07,0x2B,0x08,0x80,0x3E,0xAA,0x00,0x20,0x00,0x05,
-   0x10,0x0B,0x00,0x00,0x6D,0x08,0x80,0x3E,0x20,0x00,0x2A,0x02,0x03,0x1D,0x8A,0x2D,0x20,0x00,0x6C,0x08,0xFB,
-   0x10,0x0B,0x10,0x00,0x20,0x00,0x28,0x02,0x03,0x18,0xAC,0x2D,0x21,0x00,0x2C,0x08,0x2D,0x04,0x03,0x19,0xF5,
-   0x10,0x0B,0x20,0x00,0xA9,0x2D,0x20,0x00,0xA8,0x01,0x21,0x00,0xB3,0x1F,0x98,0x2D,0x20,0x00,0xA8,0x0A,0x9C,
-   0x10,0x0B,0x30,0x00,0x21,0x00,0x2C,0x08,0x01,0x39,0x20,0x00,0xAB,0x00,0xAA,0x00,0xA8,0x06,0x28,0x0C,0xCF,
-   0x10,0x0B,0x40,0x00,0x03,0x18,0xA4,0x2D,0x21,0x00,0xB3,0x13,0x03,0x1C,0xA8,0x2D,0x21,0x00,0xB3,0x17,0xF3,
-   0x10,0x0B,0x50,0x00,0xE7,0x2D,0x22,0x00,0x0C,0x16,0xE7,0x2D,0x20,0x00,0x27,0x08,0x20,0x00,0x6A,0x02,0x4E,
-   0x10,0x0B,0x60,0x00,0x20,0x00,0xA7,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x20,0x00,0x6B,0x02,0x20,0x00,0x8E,
-   0x10,0x0B,0x70,0x00,0xA9,0x00,0x20,0x00,0x6D,0x08,0x80,0x3E,0x20,0x00,0xAC,0x00,0x29,0x08,0x80,0x3E,0xBE,
-   0x10,0x0B,0x80,0x00,0x2C,0x02,0x03,0x1D,0xC6,0x2D,0x27,0x08,0x20,0x00,0x6C,0x02,0x03,0x18,0xE7,0x2D,0x38,
-   0x10,0x0B,0x90,0x00,0x21,0x00,0x2E,0x08,0x2F,0x04,0x03,0x19,0xE5,0x2D,0x20,0x00,0xA7,0x01,0x21,0x00,0xB4,
-   0x10,0x0B,0xA0,0x00,0xB3,0x1D,0xD4,0x2D,0x20,0x00,0xA7,0x0A,0x21,0x00,0x2E,0x08,0x01,0x39,0x20,0x00,0xF2,
-   0x10,0x0B,0xB0,0x00,0xA9,0x00,0xA8,0x00,0xA7,0x06,0x27,0x0C,0x03,0x18,0xE0,0x2D,0x21,0x00,0xB3,0x11,0xF7,
-   0x10,0x0B,0xC0,0x00,0x03,0x1C,0xE4,0x2D,0x21,0x00,0xB3,0x15,0xE7,0x2D,0x22,0x00,0x8C,0x16,0x20,0x00,0x14,
-   0x10,0x0B,0xD0,0x00,0x99,0x1F,0x18,0x2E,0x22,0x00,0x0C,0x1C,0xFA,0x2D,0x23,0x00,0x1D,0x1F,0xFA,0x2D,0x20,
-   0x10,0x0B,0xE0,0x00,0x61,0x30,0x21,0x00,0xB0,0x00,0x11,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0x40,
-   0x10,0x0B,0xF0,0x00,0xB2,0x00,0x01,0x2E,0x01,0x30,0xF6,0x00,0x20,0x00,0x6C,0x08,0xF7,0x00,0x6D,0x08,0xED,
-   0x10,0x0C,0x00,0x00,0x1D,0x26,0x20,0x00,0xC2,0x01,0x23,0x00,0x1D,0x1F,0x08,0x2E,0x20,0x00,0xC2,0x0A,0x3D,
-   0x10,0x0C,0x10,0x00,0x20,0x00,0x42,0x08,0x00,0x30,0x03,0x19,0x01,0x30,0xC4,0x00,0xC2,0x00,0x42,0x0C,0x19,
-   0x10,0x0C,0x20,0x00,0x03,0x18,0x14,0x2E,0x23,0x00,0x1D,0x13,0x03,0x1C,0x18,0x2E,0x23,0x00,0x1D,0x17,0x58,
-   0x10,0x0C,0x30,0x00,0x20,0x00,0x93,0x10,0x64,0x00,0xC0,0x28,0x08,0x00,0x20,0x00,0xA9,0x00,0x77,0x08,0x55,
-   0x10,0x0C,0x40,0x00,0xA8,0x00,0x76,0x08,0xAB,0x00,0x03,0x14,0xA9,0x1F,0x03,0x10,0x03,0x1C,0x31,0x2E,0x63,
-   0x10,0x0C,0x50,0x00,0x21,0x00,0x33,0x12,0x20,0x00,0xA8,0x09,0xA9,0x09,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0x2A,
-   0x10,0x0C,0x60,0x00,0x33,0x2E,0x21,0x00,0x33,0x16,0x20,0x00,0x2B,0x08,0x01,0x3A,0x03,0x1D,0x3C,0x2E,0xA1,
-   0x10,0x0C,0x70,0x00,0x21,0x00,0xB3,0x12,0x33,0x11,0x3F,0x2E,0x21,0x00,0xB3,0x16,0x33,0x15,0x20,0x00,0x8B,
-   0x10,0x0C,0x80,0x00,0x29,0x08,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x47,0x2E,0xE8,0x30,0x28,0x02,0x03,0x1C,0xC4,
-   0x10,0x0C,0x90,0x00,0x57,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,0x08,0xAC,0x00,0x2A,0x08,0xF7,0x00,0xCF,
-   0x10,0x0C,0xA0,0x00,0x2C,0x08,0xFA,0x26,0x20,0x00,0xA9,0x00,0x77,0x08,0xA8,0x00,0xAB,0x01,0x20,0x00,0x34,
-   0x10,0x0C,0xB0,0x00,0x29,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x5F,0x2E,0x64,0x30,0x28,0x02,0x03,0x1C,0xFD,
-   0x10,0x0C,0xC0,0x00,0x93,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,0x08,0xAC,0x00,0xAD,0x01,0x20,0x00,0xBE,
-   0x10,0x0C,0xD0,0x00,0x2C,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x6F,0x2E,0x64,0x30,0x2A,0x02,0x03,0x1C,0xC8,
-   0x10,0x0C,0xE0,0x00,0x78,0x2E,0x9C,0x30,0x20,0x00,0xAA,0x07,0x03,0x1C,0xAC,0x03,0xAD,0x0A,0x67,0x2E,0xA7,
-   0x10,0x0C,0xF0,0x00,0x20,0x00,0x2A,0x08,0xA8,0x00,0x2C,0x08,0xA9,0x00,0x0F,0x30,0xAD,0x05,0x2D,0x08,0xF7,
-   0x10,0x0D,0x00,0x00,0xF6,0x3E,0xAD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xAA,0x00,0x2D,0x08,0xF6,0x00,0x1C,
-   0x10,0x0D,0x10,0x00,0x2A,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x20,0x00,0xAC,0x00,0xD1,
-   0x10,0x0D,0x20,0x00,0x21,0x00,0xB0,0x00,0x96,0x2E,0xFF,0x30,0x21,0x00,0xB0,0x00,0x20,0x00,0x29,0x08,0xDD,
-   0x10,0x0D,0x30,0x00,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x9E,0x2E,0x0A,0x30,0x28,0x02,0x03,0x18,0xAB,0x2E,0xF3,
-   0x10,0x0D,0x40,0x00,0x20,0x00,0x2B,0x08,0x03,0x1D,0xAB,0x2E,0x21,0x00,0x30,0x08,0x20,0x00,0xAA,0x00,0x34,
-   0x10,0x0D,0x50,0x00,0xFF,0x3A,0x03,0x19,0xE1,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,0x08,0xAC,0x00,0x58,
-   0x10,0x0D,0x60,0x00,0xAD,0x01,0x20,0x00,0x2C,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0xB9,0x2E,0x0A,0x30,0xC4,
-   0x10,0x0D,0x70,0x00,0x2A,0x02,0x03,0x1C,0xC2,0x2E,0xF6,0x30,0x20,0x00,0xAA,0x07,0x03,0x1C,0xAC,0x03,0x73,
-   0x10,0x0D,0x80,0x00,0xAD,0x0A,0xB1,0x2E,0x20,0x00,0x2A,0x08,0xA8,0x00,0x2C,0x08,0xA9,0x00,0x2D,0x08,0xC1,
-   0x10,0x0D,0x90,0x00,0xF6,0x3E,0xAD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xAA,0x00,0x2D,0x08,0xF6,0x00,0x8C,
-   0x10,0x0D,0xA0,0x00,0x2A,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x20,0x00,0xAC,0x00,0x41,
-   0x10,0x0D,0xB0,0x00,0x21,0x00,0xB1,0x00,0x20,0x00,0x2B,0x08,0x03,0x19,0xE4,0x2E,0x21,0x00,0x31,0x10,0x7E,
-   0x10,0x0D,0xC0,0x00,0xE4,0x2E,0xFF,0x30,0x21,0x00,0xB1,0x00,0x20,0x00,0x28,0x08,0xAB,0x00,0xF6,0x3E,0xE1,
-   0x10,0x0D,0xD0,0x00,0xA8,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xA9,0x00,0x28,0x08,0xF6,0x00,0x29,0x08,0x5A,
-   0x10,0x0D,0xE0,0x00,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x20,0x00,0xAB,0x00,0x21,0x00,0x13,
-   0x10,0x0D,0xF0,0x00,0xB2,0x00,0x08,0x00,0x20,0x00,0xA0,0x00,0x77,0x08,0xA1,0x00,0x03,0x10,0x20,0x0C,0x1A,
-   0x10,0x0E,0x00,0x00,0xA2,0x00,0x21,0x0C,0xA3,0x00,0x03,0x10,0x20,0x0C,0xA4,0x00,0x21,0x0C,0xA6,0x00,0xBA,
-   0x10,0x0E,0x10,0x00,0x03,0x10,0xA4,0x0C,0xA6,0x0C,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0x0B,
-   0x10,0x0E,0x20,0x00,0xA2,0x07,0x23,0x0E,0x0F,0x39,0xA6,0x00,0x22,0x0E,0xA4,0x00,0xF0,0x39,0xA6,0x04,0x53,
-   0x10,0x0E,0x30,0x00,0xA4,0x06,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,0x07,0x22,0x08,0xE3,
-   0x10,0x0E,0x40,0x00,0xA6,0x00,0xA4,0x01,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,0x07,0x5C,
-   0x10,0x0E,0x50,0x00,0x03,0x10,0xA2,0x0C,0xA3,0x0C,0x03,0x10,0xA2,0x0C,0xA3,0x0C,0x03,0x10,0xA2,0x0C,0xF1,
-   0x10,0x0E,0x60,0x00,0xA3,0x0C,0x03,0x10,0x23,0x0D,0xA6,0x00,0x22,0x0D,0xA4,0x00,0x03,0x10,0xA6,0x0D,0x51,
-   0x10,0x0E,0x70,0x00,0xA4,0x0D,0x03,0x10,0xA6,0x0D,0xA4,0x0D,0x03,0x10,0x23,0x0D,0xA5,0x00,0x22,0x0D,0x33,
-   0x10,0x0E,0x80,0x00,0xA7,0x00,0x25,0x08,0xA6,0x07,0x27,0x08,0x03,0x18,0x27,0x0F,0xA4,0x07,0x26,0x08,0x88,
-   0x10,0x0E,0x90,0x00,0xA1,0x02,0x24,0x08,0x03,0x1C,0x24,0x0F,0xA0,0x02,0x06,0x30,0xA1,0x07,0x03,0x18,0x96,
-   0x10,0x0E,0xA0,0x00,0xA0,0x0A,0x21,0x0E,0x0F,0x39,0xA6,0x00,0x20,0x0E,0xA4,0x00,0xF0,0x39,0xA6,0x04,0xD6,
-   0x10,0x0E,0xB0,0x00,0xA4,0x06,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,0x07,0x23,0x08,0x62,
-   0x10,0x0E,0xC0,0x00,0xF7,0x00,0x22,0x08,0x08,0x00,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0x76,0x08,0x8C,
-   0x10,0x0E,0xD0,0x00,0xA8,0x00,0x27,0x08,0xA0,0x27,0x20,0x00,0xAB,0x00,0x77,0x08,0xAA,0x00,0x28,0x06,0x52,
-   0x10,0x0E,0xE0,0x00,0x03,0x1D,0x76,0x2F,0x2B,0x08,0x29,0x06,0x03,0x19,0x9F,0x2F,0x03,0x10,0x20,0x00,0xBE,
-   0x10,0x0E,0xF0,0x00,0x27,0x0D,0xAA,0x00,0x20,0x00,0x2A,0x08,0x23,0x00,0x91,0x00,0x20,0x00,0x28,0x08,0xBE,
-   0x10,0x0F,0x00,0x00,0x23,0x00,0x93,0x00,0x15,0x13,0x95,0x13,0x15,0x15,0x20,0x00,0x8B,0x13,0x55,0x30,0xEE,
-   0x10,0x0F,0x10,0x00,0x23,0x00,0x96,0x00,0xAA,0x30,0x96,0x00,0x95,0x14,0x20,0x00,0x8B,0x17,0x23,0x00,0x1A,
-   0x10,0x0F,0x20,0x00,0x15,0x11,0x23,0x00,0x95,0x18,0x91,0x2F,0x20,0x00,0x12,0x12,0x20,0x00,0x29,0x08,0x76,
-   0x10,0x0F,0x30,0x00,0xA8,0x00,0xA9,0x01,0x2A,0x08,0xA7,0x00,0xAA,0x0A,0x27,0x1C,0x7A,0x2F,0x08,0x00,0xDE,
-   0x10,0x0F,0x40,0x00,0x20,0x00,0xA0,0x00,0xA1,0x01,0xA2,0x01,0x03,0x10,0x20,0x0D,0xA3,0x00,0x20,0x00,0x99,
-   0x10,0x0F,0x50,0x00,0x23,0x08,0x23,0x00,0x91,0x00,0x15,0x13,0x95,0x13,0x15,0x14,0x13,0x08,0x20,0x00,0x7E,
-   0x10,0x0F,0x60,0x00,0xA0,0x00,0xA4,0x01,0x20,0x08,0xA6,0x00,0xA5,0x01,0x22,0x08,0xA0,0x00,0xA4,0x01,0x59,
-   0x10,0x0F,0x70,0x00,0x20,0x08,0x25,0x04,0xA1,0x00,0x24,0x08,0x26,0x04,0xA2,0x00,0x23,0x08,0xA0,0x00,0xBC,
-   0x10,0x0F,0x80,0x00,0xA3,0x0A,0x20,0x1C,0xA7,0x2F,0x21,0x08,0xF7,0x00,0x22,0x08,0x08,0x00,0x00,0x3A,0x16,
-   0x10,0x0F,0x90,0x00,0x03,0x19,0xCE,0x2F,0x80,0x3A,0x03,0x19,0xD4,0x2F,0x00,0x34,0x76,0x08,0x84,0x00,0x29,
-   0x10,0x0F,0xA0,0x00,0x77,0x08,0x85,0x00,0x00,0x08,0x08,0x00,0x77,0x08,0x8A,0x00,0x76,0x08,0x82,0x00,0x24,
-   0x10,0x0F,0xB0,0x00,0x08,0x00,0x00,0x3A,0x03,0x19,0xE1,0x2F,0x80,0x3A,0x03,0x19,0xE9,0x2F,0xF7,0x01,0xDD,
-   0x10,0x0F,0xC0,0x00,0x00,0x34,0x76,0x08,0x84,0x00,0x77,0x08,0x85,0x00,0x12,0x00,0xF7,0x00,0x00,0x08,0xD6,
-   0x10,0x0F,0xD0,0x00,0x08,0x00,0x87,0x31,0xD4,0x27,0xF5,0x00,0xF6,0x0F,0xF7,0x03,0xF7,0x0A,0x87,0x31,0xA9,
-   0x10,0x0F,0xE0,0x00,0xD4,0x27,0xF4,0x00,0x75,0x08,0xF7,0x00,0x74,0x08,0x08,0x00,0x03,0x34,0xB7,0x34,0xF8,
-   0x10,0x0F,0xF0,0x00,0x0D,0x34,0x25,0x34,0xB1,0x34,0x61,0x34,0x41,0x34,0x37,0x34,0x01,0x34,0x21,0x34,0x73,
-   0x10,0x10,0x00,0x00,0x20,0x00,0x8B,0x13,0x22,0x00,0x0D,0x08,0x20,0x00,0xDD,0x00,0x21,0x00,0x0E,0x08,0xB7,
-   0x10,0x10,0x10,0x00,0x20,0x00,0xDE,0x00,0x22,0x00,0x8D,0x01,0xD8,0x30,0x21,0x00,0x8E,0x00,0x03,0x10,0x58,
-   0x10,0x10,0x20,0x00,0x21,0x00,0x3E,0x0D,0x20,0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x8E,0x1F,0x1A,0x28,0x65,
-   0x10,0x10,0x30,0x00,0x20,0x00,0xE0,0x0A,0x20,0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x92,
-   0x10,0x10,0x40,0x00,0x21,0x00,0xBE,0x00,0x03,0x10,0x3E,0x0D,0x20,0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x63,
-   0x10,0x10,0x50,0x00,0x0E,0x1E,0x2C,0x28,0x20,0x00,0xE0,0x0A,0x20,0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0x36,
-   0x10,0x10,0x60,0x00,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x03,0x10,0x3E,0x0D,0x20,0x00,0xDF,0x00,0x00,
-   0x10,0x10,0x70,0x00,0xE0,0x01,0x20,0x00,0x0E,0x1F,0x3E,0x28,0x20,0x00,0xE0,0x0A,0x20,0x00,0x5F,0x08,0x4B,
-   0x10,0x10,0x80,0x00,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x03,0x10,0x3E,0x0D,0x96,
-   0x10,0x10,0x90,0x00,0x20,0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x8E,0x1D,0x50,0x28,0x20,0x00,0xE0,0x0A,0x23,
-   0x10,0x10,0xA0,0x00,0x20,0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x4D,
-   0x10,0x10,0xB0,0x00,0x20,0x00,0x5D,0x08,0x22,0x00,0x8D,0x00,0x20,0x00,0x5E,0x08,0x21,0x00,0x8E,0x00,0xC7,
-   0x10,0x10,0xC0,0x00,0x20,0x00,0x8B,0x17,0x21,0x00,0x3D,0x08,0x03,0x1D,0xBD,0x03,0x0F,0x30,0x21,0x00,0xB8,
-   0x10,0x10,0xD0,0x00,0x3A,0x02,0x03,0x18,0x59,0x2C,0x88,0x30,0x8A,0x00,0x72,0x30,0x3A,0x07,0x03,0x18,0xF4,
-   0x10,0x10,0xE0,0x00,0x8A,0x0A,0x82,0x00,0x81,0x28,0xD3,0x28,0xEB,0x28,0xFF,0x28,0x25,0x29,0xEC,0x2B,0xA7,
-   0x10,0x10,0xF0,0x00,0xA8,0x2B,0x09,0x2C,0x15,0x2C,0x59,0x2C,0x59,0x2C,0x49,0x29,0xE2,0x29,0x78,0x2A,0x7E,
-   0x10,0x11,0x00,0x00,0xE0,0x2A,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x08,0x3A,0x03,0x1D,0x5A,
-   0x10,0x11,0x10,0x00,0x90,0x28,0x1B,0x30,0x21,0x00,0xBD,0x00,0x06,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x56,
-   0x10,0x11,0x20,0x00,0x00,0x30,0x21,0x00,0x3E,0x04,0x03,0x19,0x5B,0x2C,0x7F,0x30,0x87,0x31,0xA0,0x27,0x5B,
-   0x10,0x11,0x30,0x00,0x88,0x31,0x20,0x00,0xDE,0x00,0x77,0x08,0xDD,0x00,0x5E,0x04,0x03,0x19,0x5B,0x2C,0x97,
-   0x10,0x11,0x40,0x00,0x33,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x03,0x3A,0x03,0x1D,0xAC,0x28,0xAA,
-   0x10,0x11,0x50,0x00,0x01,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x22,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0x26,
-   0x10,0x11,0x60,0x00,0xDD,0x00,0x02,0x3A,0x03,0x1D,0xB8,0x28,0x02,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0xD2,
-   0x10,0x11,0x70,0x00,0x11,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x01,0x3A,0x03,0x1D,0xC7,0x28,0x83,
-   0x10,0x11,0x80,0x00,0x0D,0x30,0x21,0x00,0xBD,0x00,0x03,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x44,0x30,0x3B,
-   0x10,0x11,0x90,0x00,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x07,0x30,0x96,
-   0x10,0x11,0xA0,0x00,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0xF6,0x00,0x6D,0x30,0xF7,0x00,0x00,0x30,0xF3,
-   0x10,0x11,0xB0,0x00,0x86,0x31,0x1D,0x26,0x88,0x31,0x21,0x00,0x30,0x10,0x21,0x00,0xB3,0x16,0x33,0x15,0xE9,
-   0x10,0x11,0xC0,0x00,0x33,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x33,0x3A,0x03,0x19,0x5B,0x2C,0x4B,
-   0x10,0x11,0xD0,0x00,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x01,0x30,0xF6,0x00,0x20,0x00,0x6A,0x08,0xF7,0x00,0xFC,
-   0x10,0x11,0xE0,0x00,0x6B,0x08,0x86,0x31,0x1D,0x26,0x88,0x31,0x22,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0x03,
-   0x10,0x11,0xF0,0x00,0xDD,0x00,0x22,0x3A,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x7C,0x30,0x04,
-   0x10,0x12,0x00,0x00,0x87,0x31,0xA0,0x27,0x89,0x31,0x20,0x00,0xDF,0x00,0x77,0x08,0xDD,0x00,0xE0,0x00,0x6A,
-   0x10,0x12,0x10,0x00,0x00,0x30,0xF7,0x00,0x60,0x08,0x6D,0x24,0x06,0x30,0x20,0x00,0x60,0x02,0x03,0x18,0xDB,
-   0x10,0x12,0x20,0x00,0x1A,0x29,0x21,0x00,0x3D,0x08,0x03,0x1D,0x1A,0x29,0x11,0x30,0xBD,0x00,0x04,0x30,0x80,
-   0x10,0x12,0x30,0x00,0x21,0x00,0xBA,0x00,0x11,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,0x3A,0xE6,
-   0x10,0x12,0x40,0x00,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x77,0x30,0x87,0x31,0xA0,0x27,0x72,
-   0x10,0x12,0x50,0x00,0x89,0x31,0x20,0x00,0xDF,0x00,0x77,0x08,0xDD,0x00,0x00,0x30,0xF6,0x00,0x5D,0x08,0xEE,
-   0x10,0x12,0x60,0x00,0xF7,0x00,0x5F,0x08,0x86,0x31,0x1D,0x26,0x89,0x31,0x21,0x00,0x3D,0x08,0x03,0x1D,0xE6,
-   0x10,0x12,0x70,0x00,0x3E,0x29,0x0D,0x30,0xBD,0x00,0x05,0x30,0x21,0x00,0xBA,0x00,0x11,0x30,0x21,0x00,0x9B,
-   0x10,0x12,0x80,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,0x3A,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x54,
-   0x10,0x12,0x90,0x00,0x5B,0x2C,0x21,0x00,0x33,0x16,0xB3,0x16,0x33,0x15,0x06,0x30,0x21,0x00,0x3B,0x02,0xB8,
-   0x10,0x12,0xA0,0x00,0x03,0x18,0x7A,0x29,0x21,0x00,0x3C,0x1C,0x5C,0x29,0x85,0x30,0x21,0x00,0xB0,0x00,0xFC,
-   0x10,0x12,0xB0,0x00,0xD1,0x30,0x21,0x00,0xB1,0x00,0x62,0x29,0x61,0x30,0x21,0x00,0xB0,0x00,0x19,0x30,0x25,
-   0x10,0x12,0xC0,0x00,0x21,0x00,0xB1,0x00,0x03,0x10,0x21,0x00,0x3C,0x0C,0x20,0x00,0xDD,0x00,0xF6,0x3E,0x9F,
-   0x10,0x12,0xD0,0x00,0xDD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xDF,0x00,0x5D,0x08,0xF6,0x00,0x5F,0x08,0x7F,
-   0x10,0x12,0xE0,0x00,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xE0,0x00,0x21,0x00,0xD6,
-   0x10,0x12,0xF0,0x00,0xB2,0x00,0xDB,0x29,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,0xD5,
-   0x10,0x13,0x00,0x00,0x89,0x31,0x20,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x9D,
-   0x10,0x13,0x10,0x00,0x03,0x18,0x5F,0x0F,0x8E,0x3E,0xDF,0x00,0x5D,0x08,0xF6,0x00,0x5F,0x08,0xF7,0x00,0xE0,
-   0x10,0x13,0x20,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xE0,0x00,0x21,0x00,0xB0,0x00,0xDC,
-   0x10,0x13,0x30,0x00,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,0x89,0x31,0x20,0x00,0x70,
-   0x10,0x13,0x40,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x03,0x18,0x5F,0x0F,0xAE,
-   0x10,0x13,0x50,0x00,0x8E,0x3E,0xDF,0x00,0xDD,0x0A,0x03,0x19,0xDF,0x0A,0x5D,0x08,0xF6,0x00,0x5F,0x08,0x34,
-   0x10,0x13,0x60,0x00,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xE0,0x00,0x21,0x00,0x55,
-   0x10,0x13,0x70,0x00,0xB1,0x00,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,0x89,0x31,0x9F,
-   0x10,0x13,0x80,0x00,0x20,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x03,0x18,0xBC,
-   0x10,0x13,0x90,0x00,0x5F,0x0F,0x8E,0x3E,0xDF,0x00,0x02,0x30,0xDD,0x07,0x03,0x18,0xDF,0x0A,0x5D,0x08,0xB5,
-   0x10,0x13,0xA0,0x00,0xF6,0x00,0x5F,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xB9,
-   0x10,0x13,0xB0,0x00,0xE0,0x00,0x21,0x00,0xB2,0x00,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0C,0x30,0x21,0x00,0xA1,
-   0x10,0x13,0xC0,0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3D,0x04,0x03,0x1D,0xEA,0x29,0x21,0x00,0xF6,
-   0x10,0x13,0xD0,0x00,0xBA,0x01,0x5B,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x80,0x3A,0xF8,
-   0x10,0x13,0xE0,0x00,0x03,0x1D,0xF6,0x29,0x07,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x22,0x30,0x21,0x00,0xB2,
-   0x10,0x13,0xF0,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x20,0x3A,0x03,0x1D,0x17,0x2A,0x21,0x00,0xBC,0x0A,0x0B,
-   0x10,0x14,0x00,0x00,0x06,0x30,0x21,0x00,0x3B,0x02,0x03,0x18,0x0C,0x2A,0x13,0x30,0x21,0x00,0x3C,0x02,0x55,
-   0x10,0x14,0x10,0x00,0x03,0x1C,0x13,0x2A,0xBC,0x01,0x13,0x2A,0x0B,0x30,0x21,0x00,0x3C,0x02,0x03,0x1C,0xBD,
-   0x10,0x14,0x20,0x00,0x35,0x2A,0xBC,0x01,0x35,0x2A,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x11,0x30,0x63,
-   0x10,0x14,0x30,0x00,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x10,0x3A,0x03,0x1D,0x48,0x2A,0x21,0x00,0x4E,
-   0x10,0x14,0x40,0x00,0xBC,0x03,0x06,0x30,0x21,0x00,0x3B,0x02,0x03,0x18,0x2E,0x2A,0x13,0x30,0x21,0x00,0x72,
-   0x10,0x14,0x50,0x00,0x3C,0x02,0x03,0x1C,0x44,0x2A,0x12,0x30,0xBC,0x00,0x44,0x2A,0x0B,0x30,0x21,0x00,0xF9,
-   0x10,0x14,0x60,0x00,0x3C,0x02,0x03,0x1C,0x35,0x2A,0x0A,0x30,0xBC,0x00,0x21,0x00,0x3C,0x08,0x05,0x3A,0x26,
-   0x10,0x14,0x70,0x00,0x03,0x1D,0x3D,0x2A,0xBC,0x0A,0xBC,0x0A,0x44,0x2A,0x21,0x00,0x3C,0x08,0x06,0x3A,0x46,
-   0x10,0x14,0x80,0x00,0x03,0x1D,0x44,0x2A,0xFE,0x30,0xBC,0x07,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x40,
-   0x10,0x14,0x90,0x00,0x44,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x56,
-   0x10,0x14,0xA0,0x00,0x13,0x30,0xF7,0x00,0x21,0x00,0x3B,0x08,0x8E,0x31,0xEE,0x26,0x8A,0x31,0x20,0x00,0xF0,
-   0x10,0x14,0xB0,0x00,0xDD,0x00,0x21,0x00,0x3C,0x08,0x20,0x00,0xDD,0x07,0x5D,0x08,0x87,0x31,0xA0,0x27,0x02,
-   0x10,0x14,0xC0,0x00,0x8A,0x31,0x20,0x00,0xE4,0x00,0x77,0x08,0xE3,0x00,0x20,0x00,0x5D,0x08,0xF6,0x00,0x80,
-   0x10,0x14,0xD0,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0xAD,0x24,0x20,0x00,0xE4,0x00,0x77,0x08,0xCA,
-   0x10,0x14,0xE0,0x00,0xE3,0x00,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0D,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0xFE,
-   0x10,0x14,0xF0,0x00,0x06,0x30,0x21,0x00,0x3B,0x02,0x03,0x18,0x94,0x2A,0x21,0x00,0x3C,0x1C,0x8A,0x2A,0x52,
-   0x10,0x15,0x00,0x00,0x00,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0x86,0x31,0x1D,0x26,0xCD,
-   0x10,0x15,0x10,0x00,0x8A,0x31,0xD9,0x2A,0x01,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0xF8,
-   0x10,0x15,0x20,0x00,0x86,0x31,0x1D,0x26,0x8A,0x31,0xD9,0x2A,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x73,
-   0x10,0x15,0x30,0x00,0x8E,0x31,0xEE,0x26,0x8A,0x31,0x20,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDB,
-   0x10,0x15,0x40,0x00,0xDD,0x00,0x5F,0x08,0x03,0x18,0x5F,0x0F,0x8E,0x3E,0xDF,0x00,0x03,0x30,0xDD,0x07,0x0C,
-   0x10,0x15,0x50,0x00,0x03,0x18,0xDF,0x0A,0x5D,0x08,0xF6,0x00,0x5F,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0x66,
-   0x10,0x15,0x60,0x00,0xC7,0x27,0x8A,0x31,0x20,0x00,0xE0,0x00,0x04,0x30,0x60,0x02,0x03,0x18,0xC2,0x2A,0x35,
-   0x10,0x15,0x70,0x00,0x01,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0x86,0x31,0x1D,0x26,0x5C,
-   0x10,0x15,0x80,0x00,0x8A,0x31,0xD9,0x2A,0x20,0x00,0x60,0x08,0x07,0x3A,0x03,0x1D,0xD0,0x2A,0x20,0x00,0x9A,
-   0x10,0x15,0x90,0x00,0x63,0x08,0x20,0x00,0xDD,0x00,0x00,0x30,0xF7,0x00,0x5D,0x08,0x6D,0x24,0xD9,0x2A,0xC3,
-   0x10,0x15,0xA0,0x00,0x00,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0x86,0x31,0x1D,0x26,0x2D,
-   0x10,0x15,0xB0,0x00,0x8A,0x31,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0E,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x54,
-   0x10,0x15,0xC0,0x00,0x13,0x30,0xF7,0x00,0x21,0x00,0x3B,0x08,0x8E,0x31,0xEE,0x26,0x8A,0x31,0x20,0x00,0xCF,
-   0x10,0x15,0xD0,0x00,0xDD,0x00,0x21,0x00,0x3C,0x08,0x20,0x00,0xDD,0x07,0x21,0x00,0x3D,0x08,0x03,0x1D,0x3F,
-   0x10,0x15,0xE0,0x00,0xF4,0x2A,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0x3E,
-   0x10,0x15,0xF0,0x00,0xDF,0x00,0x80,0x3A,0x03,0x1D,0x00,0x2B,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x6A,
-   0x10,0x16,0x00,0x00,0x21,0x00,0xBE,0x1E,0x16,0x2B,0x20,0x00,0xE3,0x0A,0x03,0x19,0xE4,0x0A,0x64,0x08,0x19,
-   0x10,0x16,0x10,0x00,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x0E,0x2B,0xE9,0x30,0x63,0x02,0x03,0x1C,0x2C,0x2B,0x04,
-   0x10,0x16,0x20,0x00,0x09,0x30,0x20,0x00,0xE3,0x07,0x03,0x18,0xE4,0x0A,0x2C,0x2B,0x21,0x00,0x3E,0x1E,0x9A,
-   0x10,0x16,0x30,0x00,0x43,0x2B,0xFF,0x30,0x20,0x00,0xE3,0x07,0x03,0x1C,0xE4,0x03,0x64,0x08,0x80,0x3E,0xD3,
-   0x10,0x16,0x40,0x00,0x7D,0x3E,0x03,0x1D,0x25,0x2B,0xE9,0x30,0x63,0x02,0x03,0x1C,0x2C,0x2B,0xF7,0x30,0x54,
-   0x10,0x16,0x50,0x00,0x20,0x00,0xE3,0x07,0x03,0x1C,0xE4,0x03,0x20,0x00,0x5D,0x08,0xF6,0x00,0x20,0x00,0xDF,
-   0x10,0x16,0x60,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0xAD,0x24,0x20,0x00,0xE4,0x00,0x77,0x08,0xE3,0x00,0x75,
-   0x10,0x16,0x70,0x00,0x1F,0x30,0x28,0x00,0x1D,0x02,0x03,0x1C,0x3F,0x2B,0xF8,0x30,0x9D,0x07,0x0D,0x30,0x42,
-   0x10,0x16,0x80,0x00,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x44,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDF,0x00,0x21,
-   0x10,0x16,0x90,0x00,0x40,0x3A,0x03,0x1D,0xA4,0x2B,0x21,0x00,0x3B,0x08,0x06,0x3A,0x03,0x1D,0x96,0x2B,0x5C,
-   0x10,0x16,0xA0,0x00,0x21,0x00,0x3C,0x08,0x0A,0x3A,0x03,0x1D,0x96,0x2B,0x00,0x30,0xF6,0x00,0x00,0x30,0x5A,
-   0x10,0x16,0xB0,0x00,0xF7,0x00,0x77,0x30,0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0xEE,0x01,0xEF,0x01,0x8F,
-   0x10,0x16,0xC0,0x00,0x20,0x00,0x64,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x68,0x2B,0x06,0x30,0x63,0x02,0xC4,
-   0x10,0x16,0xD0,0x00,0x03,0x18,0x96,0x2B,0x20,0x00,0x63,0x08,0x20,0x00,0xDF,0x00,0x13,0x30,0xF7,0x00,0x6A,
-   0x10,0x16,0xE0,0x00,0x5F,0x08,0x8E,0x31,0xEE,0x26,0x8B,0x31,0x20,0x00,0xE0,0x00,0x87,0x31,0xA0,0x27,0x85,
-   0x10,0x16,0xF0,0x00,0x8B,0x31,0x20,0x00,0xEB,0x00,0x77,0x08,0xEA,0x00,0x6A,0x08,0xF6,0x00,0x6B,0x08,0xDF,
-   0x10,0x17,0x00,0x00,0xF7,0x00,0x72,0x30,0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0xE0,0x0A,0x60,0x08,0xD0,
-   0x10,0x17,0x10,0x00,0x87,0x31,0xA0,0x27,0x8B,0x31,0x20,0x00,0xE0,0x00,0x77,0x08,0xDF,0x00,0x60,0x04,0xCC,
-   0x10,0x17,0x20,0x00,0x03,0x1D,0x96,0x2B,0x06,0x30,0x20,0x00,0xE3,0x00,0xE4,0x01,0x20,0x00,0x63,0x08,0x2F,
-   0x10,0x17,0x30,0x00,0xF6,0x00,0x64,0x08,0xF7,0x00,0x20,0x00,0x5D,0x08,0x87,0x31,0x63,0x27,0x8B,0x31,0xCD,
-   0x10,0x17,0x40,0x00,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0xFA,0x30,0x28,0x00,0x9D,0x00,0x5B,0x2C,0x86,
-   0x10,0x17,0x50,0x00,0x00,0x30,0x21,0x00,0x3D,0x04,0x03,0x1D,0xE1,0x2B,0x7F,0x30,0x87,0x31,0xA0,0x27,0x9D,
-   0x10,0x17,0x60,0x00,0x8B,0x31,0x20,0x00,0xDF,0x00,0x77,0x08,0xDD,0x00,0xE0,0x00,0x60,0x08,0x00,0x30,0xEA,
-   0x10,0x17,0x70,0x00,0x03,0x19,0x01,0x30,0xDD,0x00,0xE1,0x00,0xE2,0x01,0xE1,0x1B,0xE2,0x03,0x61,0x08,0x31,
-   0x10,0x17,0x80,0x00,0xF6,0x00,0x62,0x08,0xF7,0x00,0x7F,0x30,0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0x35,
-   0x10,0x17,0x90,0x00,0x60,0x08,0x03,0x19,0xD4,0x2B,0x22,0x00,0x0C,0x10,0x0C,0x12,0x8C,0x12,0x28,0x00,0xA4,
-   0x10,0x17,0xA0,0x00,0x17,0x11,0x20,0x00,0x93,0x10,0xDE,0x2B,0x3C,0x30,0x21,0x00,0xAE,0x00,0xAF,0x01,0x5A,
-   0x10,0x17,0xB0,0x00,0x3C,0x30,0x21,0x00,0xAC,0x00,0xAD,0x01,0x28,0x00,0x17,0x15,0x21,0x00,0xBA,0x01,0x12,
-   0x10,0x17,0xC0,0x00,0x5B,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x88,0x3A,0x03,0x19,0x9B,
-   0x10,0x17,0xD0,0x00,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x00,0x30,0xF6,0x00,0x20,0x00,0x6E,0x08,0x63,
-   0x10,0x17,0xE0,0x00,0xF7,0x00,0x6F,0x08,0x86,0x31,0x1D,0x26,0x8B,0x31,0x21,0x00,0x3D,0x08,0x03,0x1D,0x4F,
-   0x10,0x17,0xF0,0x00,0xFE,0x2B,0x0D,0x30,0xBD,0x00,0x03,0x30,0x21,0x00,0xBA,0x00,0x11,0x30,0x21,0x00,0x56,
-   0x10,0x18,0x00,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,0x3A,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0xCE,
-   0x10,0x18,0x10,0x00,0x5B,0x2C,0x01,0x30,0xF7,0x00,0x21,0x00,0x3B,0x08,0x6D,0x24,0x6E,0x30,0x21,0x00,0x65,
-   0x10,0x18,0x20,0x00,0xBD,0x00,0x08,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3D,0x04,0xCF,
-   0x10,0x18,0x30,0x00,0x03,0x19,0x22,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x80,0x3A,0x6B,
-   0x10,0x18,0x40,0x00,0x03,0x1D,0x25,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x22,0x30,0x21,0x00,0x3E,0x05,0x0E,
-   0x10,0x18,0x50,0x00,0x20,0x00,0xDD,0x00,0x20,0x3A,0x03,0x1D,0x37,0x2C,0x21,0x00,0xBB,0x0A,0x07,0x30,0x91,
-   0x10,0x18,0x60,0x00,0x3B,0x02,0x03,0x18,0xBB,0x01,0x07,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x11,0x30,0x8A,
-   0x10,0x18,0x70,0x00,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x10,0x3A,0x03,0x1D,0x4B,0x2C,0x21,0x00,0x05,
-   0x10,0x18,0x80,0x00,0xBB,0x03,0x07,0x30,0x3B,0x02,0x03,0x1C,0x47,0x2C,0x06,0x30,0xBB,0x00,0x07,0x30,0x6C,
-   0x10,0x18,0x90,0x00,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x44,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,
-   0x10,0x18,0xA0,0x00,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x21,0x00,0xBC,0x01,0x0B,0x30,0x21,0x00,0xBA,0x00,0x23,
-   0x10,0x18,0xB0,0x00,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x21,0x00,0x3A,0x08,0x00,0x30,0x03,0x19,0x01,0x30,0xE5,
-   0x10,0x18,0xC0,0x00,0x20,0x00,0xDD,0x00,0xE0,0x00,0x60,0x0C,0x03,0x18,0x68,0x2C,0x20,0x00,0x99,0x13,0x54,
-   0x10,0x18,0xD0,0x00,0x03,0x1C,0x6C,0x2C,0x20,0x00,0x99,0x17,0x08,0x00,0x20,0x00,0xCD,0x00,0x77,0x08,0x0D,
-   0x10,0x18,0xE0,0x00,0xCC,0x00,0x21,0x00,0x33,0x16,0xB3,0x16,0x33,0x15,0xB3,0x14,0x06,0x30,0x20,0x00,0x94,
-   0x10,0x18,0xF0,0x00,0x4D,0x02,0x03,0x18,0x94,0x2C,0x19,0x30,0x21,0x00,0xB0,0x00,0xDD,0x30,0x21,0x00,0x76,
-   0x10,0x19,0x00,0x00,0xB1,0x00,0x20,0x00,0x4D,0x08,0xF6,0x3E,0xCD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0x9F,
-   0x10,0x19,0x10,0x00,0xCF,0x00,0x4D,0x08,0xF6,0x00,0x4F,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x09,
-   0x10,0x19,0x20,0x00,0x8C,0x31,0x21,0x00,0xB2,0x00,0xAC,0x2C,0x00,0x30,0x20,0x00,0x4C,0x04,0x03,0x19,0x93,
-   0x10,0x19,0x30,0x00,0xA3,0x2C,0x61,0x30,0x21,0x00,0xB0,0x00,0x09,0x30,0x21,0x00,0xB1,0x00,0xC9,0x30,0x72,
-   0x10,0x19,0x40,0x00,0x21,0x00,0xB2,0x00,0xAC,0x2C,0xC9,0x30,0x21,0x00,0xB0,0x00,0xD1,0x30,0x21,0x00,0x00,
-   0x10,0x19,0x50,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x08,0x00,0x20,0x00,0xD4,0x00,0x77,0x08,0x59,
-   0x10,0x19,0x60,0x00,0xD3,0x00,0x76,0x08,0xD5,0x00,0xD6,0x01,0xD7,0x01,0xE7,0x30,0xD8,0x00,0x03,0x30,0x80,
-   0x10,0x19,0x70,0x00,0xD9,0x00,0x72,0x30,0x55,0x02,0x03,0x18,0xD3,0x2C,0x55,0x08,0xDA,0x00,0x13,0x30,0x01,
-   0x10,0x19,0x80,0x00,0x20,0x00,0x5A,0x02,0x03,0x1C,0xC7,0x2C,0xED,0x30,0xDA,0x07,0xBF,0x2C,0x20,0x00,0xC0,
-   0x10,0x19,0x90,0x00,0x5A,0x18,0x52,0x2D,0x70,0x30,0xD6,0x00,0xFE,0x30,0xD7,0x00,0x78,0x30,0xD8,0x00,0x5B,
-   0x10,0x19,0xA0,0x00,0x05,0x30,0xD9,0x00,0x52,0x2D,0x8E,0x30,0x20,0x00,0xD5,0x07,0x04,0x30,0xF7,0x00,0xC5,
-   0x10,0x19,0xB0,0x00,0x55,0x08,0x8E,0x31,0xEE,0x26,0x8C,0x31,0x20,0x00,0xDA,0x00,0xDB,0x01,0x5A,0x08,0x02,
-   0x10,0x19,0xC0,0x00,0xC2,0x3E,0xD5,0x00,0x8E,0x30,0xDC,0x00,0x5B,0x08,0x03,0x18,0x5B,0x0F,0xDC,0x07,0xDD,
-   0x10,0x19,0xD0,0x00,0x03,0x30,0xD5,0x07,0x03,0x18,0xDC,0x0A,0x55,0x08,0xF6,0x00,0x5C,0x08,0xF7,0x00,0x49,
-   0x10,0x19,0xE0,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x8C,0x31,0x20,0x00,0xDA,0x00,0x5A,0x08,0x03,0x1D,0x68,
-   0x10,0x19,0xF0,0x00,0x02,0x2D,0x70,0x30,0xD6,0x00,0xFE,0x30,0xD7,0x00,0x78,0x30,0xD8,0x00,0x05,0x30,0x88,
-   0x10,0x1A,0x00,0x00,0xD9,0x00,0x52,0x2D,0x20,0x00,0x5A,0x08,0x01,0x3A,0x03,0x1D,0x0F,0x2D,0xCE,0x30,0x67,
-   0x10,0x1A,0x10,0x00,0xD6,0x00,0xFF,0x30,0xD7,0x00,0x32,0x30,0xD8,0x00,0xD9,0x01,0x52,0x2D,0x20,0x00,0x37,
-   0x10,0x1A,0x20,0x00,0x5A,0x08,0x09,0x3A,0x03,0x1D,0x18,0x2D,0x01,0x30,0xD8,0x00,0xD9,0x01,0x52,0x2D,0x4A,
-   0x10,0x1A,0x30,0x00,0x20,0x00,0x5A,0x08,0x02,0x3A,0x03,0x1D,0x21,0x2D,0x32,0x30,0xD8,0x00,0xD9,0x01,0x66,
-   0x10,0x1A,0x40,0x00,0x52,0x2D,0x20,0x00,0x5A,0x08,0x04,0x3A,0x03,0x1D,0x2A,0x2D,0x0F,0x30,0xD8,0x00,0xC9,
-   0x10,0x1A,0x50,0x00,0xD9,0x01,0x52,0x2D,0x20,0x00,0x5A,0x08,0x03,0x3A,0x03,0x1D,0x38,0x2D,0x70,0x30,0x49,
-   0x10,0x1A,0x60,0x00,0xD6,0x00,0xFE,0x30,0xD7,0x00,0x90,0x30,0xD8,0x00,0x01,0x30,0xD9,0x00,0x52,0x2D,0x7A,
-   0x10,0x1A,0x70,0x00,0x20,0x00,0x5A,0x08,0x05,0x3A,0x03,0x1D,0x41,0x2D,0x08,0x30,0xD8,0x00,0xD9,0x01,0x2D,
-   0x10,0x1A,0x80,0x00,0x52,0x2D,0x20,0x00,0x5A,0x08,0x06,0x3A,0x03,0x1D,0x4A,0x2D,0x3C,0x30,0xD8,0x00,0x3A,
-   0x10,0x1A,0x90,0x00,0xD9,0x01,0x52,0x2D,0x20,0x00,0x5A,0x08,0x07,0x3A,0x03,0x1D,0x52,0x2D,0x06,0x30,0x55,
-   0x10,0x1A,0xA0,0x00,0xD8,0x00,0xD9,0x01,0x20,0x00,0x58,0x08,0xF3,0x00,0x59,0x08,0xF4,0x00,0x56,0x08,0x5E,
-   0x10,0x1A,0xB0,0x00,0xF5,0x00,0x57,0x08,0xF6,0x00,0x53,0x08,0xF7,0x00,0x54,0x08,0x66,0x25,0x20,0x00,0x83,
-   0x10,0x1A,0xC0,0x00,0xD4,0x00,0x77,0x08,0xD3,0x00,0xF7,0x00,0x54,0x08,0x08,0x00,0x20,0x00,0xCD,0x00,0xA8,
-   0x10,0x1A,0xD0,0x00,0x77,0x08,0xCC,0x00,0x76,0x08,0xCF,0x00,0x75,0x08,0xCE,0x00,0x74,0x08,0xD1,0x00,0xD6,
-   0x10,0x1A,0xE0,0x00,0x73,0x08,0xD0,0x00,0x51,0x08,0x80,0x3E,0xD2,0x00,0x4D,0x08,0x80,0x3E,0x52,0x02,0x5B,
-   0x10,0x1A,0xF0,0x00,0x03,0x1D,0x7C,0x2D,0x4C,0x08,0x50,0x02,0x03,0x18,0x83,0x2D,0x20,0x00,0x4E,0x08,0x36,
-   0x10,0x1B,0x00,0x00,0xF7,0x00,0x4F,0x08,0x99,0x2D,0x20,0x00,0x4D,0x08,0x80,0x3E,0xD2,0x00,0x4F,0x08,0x65,
-   0x10,0x1B,0x10,0x00,0x80,0x3E,0x52,0x02,0x03,0x1D,0x8E,0x2D,0x4E,0x08,0x4C,0x02,0x03,0x18,0x95,0x2D,0x57,
-   0x10,0x1B,0x20,0x00,0x20,0x00,0x50,0x08,0xF7,0x00,0x51,0x08,0x99,0x2D,0x20,0x00,0x4C,0x08,0xF7,0x00,0xBC,
-   0x10,0x1B,0x30,0x00,0x4D,0x08,0x08,0x00,0x1A,0x30,0xF6,0x00,0x8E,0x30,0xF7,0x00,0x80,0x30,0x87,0x31,0xEB,
-   0x10,0x1B,0x40,0x00,0xD9,0x27,0x8D,0x31,0x21,0x00,0xA1,0x00,0x77,0x08,0xA0,0x00,0x1C,0x30,0xA2,0x00,0x08,
-   0x10,0x1B,0x50,0x00,0x8E,0x30,0xA3,0x00,0x21,0x00,0x20,0x08,0xA4,0x00,0x21,0x08,0xA5,0x00,0xFF,0x30,0x3A,
-   0x10,0x1B,0x60,0x00,0xA0,0x07,0x03,0x1C,0xA1,0x03,0x24,0x08,0x25,0x04,0x03,0x19,0x17,0x2E,0x04,0x30,0x21,
-   0x10,0x1B,0x70,0x00,0x22,0x07,0xA4,0x00,0xA5,0x01,0xA5,0x0D,0x23,0x08,0xA5,0x07,0x24,0x08,0xF6,0x00,0x47,
-   0x10,0x1B,0x80,0x00,0x25,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x8D,0x31,0x21,0x00,0xA7,0x00,0x43,
-   0x10,0x1B,0x90,0x00,0x77,0x08,0xA6,0x00,0x22,0x08,0xF6,0x00,0x23,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0x76,
-   0x10,0x1B,0xA0,0x00,0xD9,0x27,0x8D,0x31,0x21,0x00,0xA9,0x00,0xA5,0x00,0x77,0x08,0xA8,0x00,0xA4,0x00,0x3D,
-   0x10,0x1B,0xB0,0x00,0x02,0x30,0x22,0x07,0xA4,0x00,0xA5,0x01,0xA5,0x0D,0x23,0x08,0xA5,0x07,0x24,0x08,0xCB,
-   0x10,0x1B,0xC0,0x00,0xF6,0x00,0x25,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x8D,0x31,0x21,0x00,0xB4,
-   0x10,0x1B,0xD0,0x00,0xA5,0x00,0xAB,0x00,0x77,0x08,0xA4,0x00,0xAA,0x00,0x21,0x00,0x26,0x08,0xAA,0x00,0xEF,
-   0x10,0x1B,0xE0,0x00,0x27,0x08,0xAB,0x00,0xFF,0x30,0xA6,0x07,0x03,0x1C,0xA7,0x03,0x2A,0x08,0x2B,0x04,0x15,
-   0x10,0x1B,0xF0,0x00,0x03,0x19,0x11,0x2E,0x28,0x08,0xF6,0x00,0x29,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD4,
-   0x10,0x1C,0x00,0x00,0xC7,0x27,0x8E,0x31,0x21,0x00,0xAA,0x00,0x24,0x08,0x84,0x00,0x25,0x08,0x85,0x00,0xFA,
-   0x10,0x1C,0x10,0x00,0x2A,0x08,0x80,0x00,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0xA4,0x0A,0x03,0x19,0xA5,0x0A,0x18,
-   0x10,0x1C,0x20,0x00,0xED,0x2D,0x06,0x30,0x21,0x00,0xA2,0x07,0x03,0x18,0xA3,0x0A,0xAA,0x2D,0x80,0x31,0x4A,
-   0x10,0x1C,0x30,0x00,0x74,0x28,0x08,0x00,0x11,0x34,0x00,0x34,0x03,0x34,0x00,0x34,0xB3,0x34,0x00,0x34,0x01,
-   0x10,0x1C,0x40,0x00,0x01,0x34,0x00,0x34,0x15,0x34,0x0F,0x34,0xB4,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1A,
-   0x10,0x1C,0x50,0x00,0x0D,0x34,0x0F,0x34,0x6C,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x16,0x34,0x0F,0x34,0x35,
-   0x10,0x1C,0x60,0x00,0xB5,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x17,0x34,0x0F,0x34,0xB6,0x34,0x00,0x34,0x42,
-   0x10,0x1C,0x70,0x00,0x01,0x34,0x00,0x34,0x18,0x34,0x0F,0x34,0xB7,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0xE4,
-   0x10,0x1C,0x80,0x00,0x19,0x34,0x0F,0x34,0xB8,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1A,0x34,0x0F,0x34,0xAA,
-   0x10,0x1C,0x90,0x00,0xB9,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x0F,0x34,0x0F,0x34,0x6E,0x34,0x00,0x34,0x5E,
-   0x10,0x1C,0xA0,0x00,0x02,0x34,0x00,0x34,0x11,0x34,0x0F,0x34,0xAC,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0xC4,
-   0x10,0x1C,0xB0,0x00,0x13,0x34,0x0F,0x34,0xAE,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x1B,0x34,0x0F,0x34,0x88,
-   0x10,0x1C,0xC0,0x00,0xBA,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1C,0x34,0x0F,0x34,0xBB,0x34,0x00,0x34,0xD3,
-   0x10,0x1C,0xD0,0x00,0x01,0x34,0x00,0x34,0x1D,0x34,0x0F,0x34,0xBC,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x7A,
-   0x10,0x1C,0xE0,0x00,0x1E,0x34,0x0F,0x34,0xBD,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1F,0x34,0x0F,0x34,0x3B,
-   0x10,0x1C,0xF0,0x00,0xBE,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x20,0x34,0x0F,0x34,0xBF,0x34,0x00,0x34,0x97,
-   0x10,0x1D,0x00,0x00,0x01,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x1A,0x34,0xFE,0x34,0x9D,0x34,0xFE,0x34,0x7F,
-   0x10,0x1D,0x10,0x00,0xF2,0x34,0xFE,0x34,0x33,0x34,0xFF,0x34,0x69,0x34,0xFF,0x34,0x98,0x34,0xFF,0x34,0x02,
-   0x10,0x1D,0x20,0x00,0xC3,0x34,0xFF,0x34,0xEB,0x34,0xFF,0x34,0x10,0x34,0x00,0x34,0x33,0x34,0x00,0x34,0x24,
-   0x10,0x1D,0x30,0x00,0x55,0x34,0x00,0x34,0x77,0x34,0x00,0x34,0x98,0x34,0x00,0x34,0xB8,0x34,0x00,0x34,0xE7,
-   0x10,0x1D,0x40,0x00,0xD9,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x1C,0x34,0x01,0x34,0x3E,0x34,0x01,0x34,0xC4,
-   0x10,0x1D,0x50,0x00,0x62,0x34,0x01,0x34,0x87,0x34,0x01,0x34,0xAF,0x34,0x01,0x34,0xD9,0x34,0x01,0x34,0x6E,
-   0x10,0x1D,0x60,0x00,0x07,0x34,0x02,0x34,0x39,0x34,0x02,0x34,0x70,0x34,0x02,0x34,0xB0,0x34,0x02,0x34,0x6B,
-   0x10,0x1D,0x70,0x00,0xFB,0x34,0x02,0x34,0x58,0x34,0x03,0x34,0xD1,0x34,0x03,0x34,0x82,0x34,0x04,0x34,0x11,
-   0x10,0x1D,0x80,0x00,0xCA,0x34,0x05,0x34,0x61,0x34,0x19,0x34,0xFF,0x34,0x00,0x34,0xD1,0x34,0xA1,0x34,0xF9,
-   0x10,0x1D,0x90,0x00,0xFF,0x34,0x02,0x34,0xC9,0x34,0xCD,0x34,0xFF,0x34,0x01,0x34,0x85,0x34,0xB7,0x34,0xD0,
-   0x10,0x1D,0xA0,0x00,0xFF,0x34,0x04,0x34,0x61,0x34,0x11,0x34,0xFF,0x34,0x03,0x34,0x61,0x34,0xC9,0x34,0xF2,
-   0x10,0x1D,0xB0,0x00,0xFF,0x34,0x05,0x34,0x85,0x34,0xD1,0x34,0xFF,0x34,0x08,0x34,0xCD,0x34,0x85,0x34,0xD0,
-   0x10,0x1D,0xC0,0x00,0xFF,0x34,0x06,0x34,0xD1,0x34,0x85,0x34,0xFF,0x34,0x06,0x34,0xDD,0x34,0x19,0x34,0x1D,
-   0x10,0x1D,0xD0,0x00,0xFF,0x34,0x09,0x34,0xDD,0x34,0xD5,0x34,0xFF,0x34,0x07,0x34,0x20,0x00,0xE5,0x00,0x06,
-   0x10,0x1D,0xE0,0x00,0x77,0x08,0xE6,0x00,0xE7,0x01,0x08,0x30,0xE8,0x00,0x20,0x00,0x65,0x1C,0xFA,0x2E,0xBD,
-   0x10,0x1D,0xF0,0x00,0x66,0x08,0xE7,0x07,0x20,0x00,0x65,0x08,0xE9,0x00,0x03,0x10,0x69,0x0C,0xE5,0x00,0xA4,
-   0x10,0x1E,0x00,0x00,0x03,0x10,0x66,0x0D,0xE9,0x00,0xE6,0x00,0x68,0x08,0xE9,0x00,0x69,0x03,0xE8,0x00,0xD0,
-   0x10,0x1E,0x10,0x00,0x68,0x08,0x03,0x1D,0xF5,0x2E,0x67,0x08,0x08,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0xFC,
-   0x10,0x1E,0x20,0x00,0x00,0x34,0x3C,0x34,0x00,0x34,0x3C,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x9A,
-   0x10,0x1E,0x30,0x00,0x00,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xEA,
-   0x02,0x1E,0x40,0x00,0x00,0x34,0x6C,
-   0x02,0x00,0x00,0x04,0x00,0x01,0xF9,
-   0x02,0x00,0x0E,0x00,0xD4,0x0F,0x0D,
-   0x02,0x00,0x10,0x00,0xFF,0x3A,0xB5,
-   0x00,0x00,0x00,0x01,0xFF
+   0x01,0x00,0x02,0x00,0x00,0xA0,0x00,0x00,0x8D,0x31,0x9A,0x2D,0xFF,0x34,0x8A,0x01,
+   0x20,0x00,0x0B,0x1D,0x37,0x28,0x22,0x00,0x8C,0x10,0x21,0x00,0x38,0x08,0x03,0x19,
+   0x17,0x28,0x03,0x10,0x21,0x00,0xB7,0x0C,0x82,0x30,0x20,0x00,0x95,0x00,0x21,0x00,
+   0xB8,0x01,0x2C,0x28,0x21,0x00,0x37,0x08,0x21,0x00,0x35,0x05,0x20,0x00,0xBB,0x00,
+   0x3B,0x08,0x03,0x19,0x24,0x28,0xC1,0x30,0x40,0x0E,0x81,0x27,0x28,0x43,0x30,0x40,
+   0x03,0x95,0x22,0x00,0x8C,0x14,0x01,0x30,0x21,0x00,0xB8,0x00,0x00,0x30,0x21,0x00,
+   0x37,0x04,0x03,0x1D,0x35,0x28,0x21,0x00,0x95,0x16,0x20,0x00,0x8B,0x12,0x20,0x00,
+   0x0B,0x11,0x20,0x00,0x91,0x1C,0x73,0x28,0x03,0x10,0x22,0x00,0x0D,0x0D,0x41,0x21,
+   0x9D,0x03,0x1D,0x44,0x28,0x10,0x30,0xBB,0x00,0x21,0x00,0x8E,0x01,0x22,0x00,0x8D,
+   0x01,0x20,0x00,0x3B,0x08,0x10,0x3A,0x03,0x19,0x5A,0x28,0x3B,0x08,0x20,0x3A,0x03,
+   0x19,0x5F,0x28,0x3B,0x08,0x40,0x3A,0x03,0x19,0x64,0x28,0x3B,0x08,0x80,0x3A,0x03,
+   0x19,0x69,0x28,0x6D,0x28,0x21,0x00,0x30,0x08,0x22,0x00,0x8E,0x00,0x40,0x04,0x80,
+   0x31,0x08,0x42,0x04,0x80,0x32,0x08,0x42,0x04,0x80,0x33,0x08,0x40,0x04,0x40,0x24,
+   0x93,0x22,0x00,0x8D,0x00,0x20,0x00,0x91,0x10,0x09,0x00,0x20,0x00,0xBE,0x01,0xBF,
+   0x01,0xC0,0x01,0x80,0x30,0xC1,0x00,0x6A,0x30,0x21,0x00,0x99,0x00,0x0C,0x30,0x8C,
+   0x00,0x22,0x00,0x8C,0x01,0x21,0x00,0x8D,0x01,0x40,0x3C,0x40,0x40,0xA9,0x04,0x30,
+   0x23,0x00,0x8C,0x00,0x21,0x00,0x1E,0x16,0x9E,0x17,0x23,0x00,0x8E,0x01,0x05,0x30,
+   0x20,0x00,0x9C,0x00,0xFA,0x30,0x9B,0x00,0x21,0x00,0x91,0x14,0x72,0x30,0x28,0x00,
+   0x97,0x00,0x7F,0x30,0xA0,0x27,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0xA8,0x00,
+   0x28,0x0C,0x03,0x18,0xA5,0x28,0x28,0x00,0x17,0x11,0x03,0x1C,0xA9,0x28,0x28,0x00,
+   0x17,0x15,0xFA,0x30,0x28,0x00,0x96,0x00,0x37,0x30,0x9E,0x00,0xFA,0x30,0x9D,0x00,
+   0x72,0x30,0x40,0x16,0x91,0xEB,0x00,0x77,0x08,0xEA,0x00,0xC0,0x30,0x20,0x00,0x8B,
+   0x00,0x21,0x00,0x95,0x11,0x15,0x10,0x95,0x14,0x15,0x11,0x09,0x30,0x9D,0x00,0x06,
+   0x30,0x21,0x00,0x36,0x02,0x03,0x18,0x6C,0x29,0x40,0xAD,0x80,0x03,0x1D,0x40,0x03,
+   0x86,0x36,0x08,0x03,0x1D,0xD1,0x28,0xFF,0x30,0x21,0x00,0xB5,0x00,0x41,0x29,0x40,
+   0x07,0x83,0x01,0x3A,0x03,0x1D,0xDC,0x28,0x45,0x30,0x40,0x08,0x81,0x20,0x00,0xC9,
+   0x01,0x41,0x0A,0x83,0x02,0x3A,0x03,0x1D,0x08,0x29,0x75,0x30,0x44,0x47,0x9C,0x28,
+   0x0E,0xF0,0x39,0xA9,0x00,0x20,0x00,0x6C,0x08,0x20,0x00,0xCA,0x00,0x20,0x00,0x6D,
+   0x08,0x20,0x00,0xCB,0x00,0x20,0x00,0xA8,0x00,0xAB,0x01,0xA8,0x1B,0xAB,0x03,0x0F,
+   0x30,0xA8,0x05,0xAB,0x01,0x29,0x08,0xAA,0x00,0xAC,0x01,0x28,0x08,0x2A,0x04,0xA9,
+   0x00,0x2B,0x08,0x2C,0x04,0xAD,0x00,0x29,0x08,0x43,0x36,0x84,0x03,0x3A,0x03,0x1D,
+   0x12,0x29,0x20,0x00,0x4A,0x08,0x43,0x09,0x8F,0x04,0x3A,0x03,0x1D,0x38,0x29,0x20,
+   0x00,0xA9,0x01,0x22,0x00,0x8C,0x1E,0x1E,0x29,0x20,0x00,0xA9,0x0A,0x20,0x00,0x29,
+   0x0E,0xF0,0x39,0xA8,0x00,0x03,0x10,0xA8,0x0D,0x40,0x01,0x40,0x0D,0x81,0x0C,0x1E,
+   0x2C,0x29,0x43,0x0D,0x81,0xAB,0x00,0x28,0x08,0x40,0x30,0x81,0xA8,0x00,0x29,0x04,
+   0x43,0x25,0x84,0x05,0x3A,0x03,0x1D,0x41,0x29,0x20,0x00,0x49,0x08,0x40,0x09,0x97,
+   0x21,0x00,0x35,0x08,0x20,0x00,0xA9,0x00,0x08,0x30,0xA8,0x00,0x20,0x00,0x28,0x08,
+   0xAB,0x00,0xA8,0x03,0x2B,0x08,0x03,0x19,0x63,0x29,0x29,0x08,0x20,0x00,0x49,0x06,
+   0x20,0x00,0xAB,0x00,0x80,0x30,0xAB,0x05,0x03,0x10,0x20,0x00,0xC9,0x0D,0x20,0x00,
+   0x40,0x0D,0x83,0x5F,0x29,0x31,0x30,0x20,0x00,0xC9,0x06,0x40,0x09,0x93,0xA9,0x0D,
+   0x47,0x29,0x80,0x30,0x21,0x00,0xB7,0x00,0x20,0x00,0x8B,0x16,0x21,0x00,0x95,0x12,
+   0x21,0x00,0xB6,0x0A,0x20,0x00,0x93,0x1D,0x82,0x29,0x88,0x31,0x00,0x20,0x81,0x31,
+   0x28,0x00,0x17,0x19,0x80,0x29,0x40,0xA7,0xAC,0xB3,0x00,0x03,0x30,0x21,0x00,0xB0,
+   0x00,0x59,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,0xB1,0x00,0x20,0x00,0x93,0x11,0x20,
+   0x00,0x93,0x1C,0x1A,0x2E,0x20,0x00,0xBE,0x0A,0x03,0x19,0xBF,0x0A,0x3E,0x1C,0xD1,
+   0x29,0x40,0x08,0xF7,0x00,0x41,0x08,0x20,0x00,0xA0,0x00,0x77,0x08,0xA1,0x00,0x21,
+   0x00,0x9D,0x14,0x21,0x00,0x9D,0x18,0x94,0x29,0x1D,0x10,0x20,0x00,0x21,0x0E,0x0F,
+   0x39,0xA2,0x00,0x20,0x0E,0xA3,0x00,0xF0,0x39,0xA2,0x04,0xA3,0x06,0x03,0x10,0xA3,
+   0x0C,0xA2,0x0C,0x41,0x02,0x8F,0x22,0x08,0xA1,0x02,0x23,0x08,0x03,0x1C,0x23,0x0F,
+   0xA0,0x02,0x21,0x00,0x1C,0x08,0x20,0x00,0xA2,0x00,0xA3,0x01,0x22,0x08,0xA4,0x00,
+   0xA6,0x01,0x21,0x00,0x1B,0x08,0x42,0x07,0x9A,0xA6,0x04,0x23,0x08,0xA4,0x04,0x26,
+   0x08,0xA2,0x00,0x24,0x08,0xA3,0x00,0x22,0x08,0xA1,0x07,0x23,0x08,0x03,0x18,0x23,
+   0x0F,0xA0,0x07,0x21,0x08,0xF7,0x00,0x20,0x08,0xC1,0x00,0x77,0x08,0xC0,0x00,0x09,
+   0x30,0x21,0x00,0x9D,0x00,0x20,0x00,0x3E,0x08,0x0F,0x39,0x03,0x1D,0x18,0x2E,0x45,
+   0x4A,0x80,0x20,0x30,0x40,0x25,0x81,0xA4,0x01,0xA6,0x01,0x40,0x48,0x91,0xA5,0x00,
+   0x20,0x0E,0xA7,0x00,0xF0,0x39,0xA5,0x04,0xA7,0x06,0x03,0x10,0xA7,0x0C,0xA5,0x0C,
+   0x3F,0x30,0xA5,0x05,0xA7,0x01,0x25,0x08,0xA9,0x00,0x03,0x10,0x20,0x0C,0xA5,0x00,
+   0xA7,0x01,0x41,0x0B,0x41,0x02,0x80,0x1F,0x30,0x41,0x0E,0x81,0xA8,0x00,0x20,0x08,
+   0x40,0x0D,0x86,0x25,0x08,0xA1,0x00,0xF8,0x30,0x21,0x02,0x03,0x18,0x0E,0x2A,0x09,
+   0x30,0x40,0x03,0x8B,0x10,0x2A,0x21,0x00,0x34,0x14,0x20,0x00,0x28,0x0A,0xA1,0x00,
+   0x02,0x30,0xF7,0x00,0x21,0x08,0x8E,0x31,0xEE,0x26,0x82,0x31,0x40,0x3F,0x89,0xA5,
+   0x01,0x20,0x08,0x82,0x3E,0xA0,0x00,0x8E,0x30,0xA1,0x00,0x25,0x08,0x03,0x18,0x25,
+   0x0F,0xA1,0x07,0x40,0x11,0x80,0x28,0x08,0x42,0x11,0x41,0x29,0x93,0x82,0x3E,0xA5,
+   0x00,0x27,0x08,0x03,0x18,0x27,0x0F,0x8E,0x3E,0xA7,0x00,0xA8,0x01,0x20,0x00,0x29,
+   0x08,0x28,0x02,0x03,0x1C,0x5F,0x2A,0x25,0x08,0xF6,0x00,0x27,0x08,0xF7,0x00,0x80,
+   0x30,0x87,0x31,0xD9,0x27,0x40,0x18,0x9C,0xAB,0x00,0x77,0x08,0xAA,0x00,0xAC,0x00,
+   0x2B,0x08,0xAD,0x00,0x00,0x30,0xAD,0x1B,0xFF,0x30,0xBD,0x00,0xBC,0x00,0x2C,0x08,
+   0xA2,0x07,0x2D,0x08,0x03,0x18,0x2D,0x0F,0xA3,0x07,0x3C,0x08,0x03,0x18,0x3C,0x0F,
+   0xA4,0x07,0x3D,0x08,0x03,0x18,0x3D,0x0F,0xA6,0x07,0x82,0x2A,0x20,0x00,0x20,0x08,
+   0xF6,0x00,0x40,0x99,0x5C,0x23,0x82,0x20,0x00,0xA8,0x0A,0x40,0x30,0x40,0x4B,0x8E,
+   0x37,0x2A,0x22,0x0E,0x0F,0x39,0xA1,0x00,0x23,0x0E,0xA0,0x00,0xF0,0x39,0xA1,0x04,
+   0xA0,0x06,0x24,0x0E,0xA5,0x00,0xF0,0x39,0xA0,0x04,0xA5,0x06,0x26,0x0E,0x42,0xAF,
+   0x85,0xF0,0x30,0xA7,0x19,0xA7,0x04,0x03,0x10,0xA7,0x1B,0x03,0x14,0x40,0xA5,0x81,
+   0xA0,0x0C,0xA1,0x0C,0x45,0x06,0x82,0x21,0x08,0xA2,0x00,0x20,0x08,0x40,0xEC,0xCF,
+   0xF7,0x00,0x23,0x08,0xC3,0x00,0x77,0x08,0xC2,0x00,0x74,0x30,0xA0,0x27,0x20,0x00,
+   0xC5,0x00,0x77,0x08,0xC4,0x00,0x42,0x08,0xC6,0x00,0x43,0x08,0xC7,0x00,0x44,0x08,
+   0x46,0x07,0x20,0x00,0xEC,0x00,0x20,0x00,0x47,0x08,0x20,0x00,0xED,0x00,0x20,0x00,
+   0x45,0x08,0x03,0x18,0x45,0x0A,0x03,0x19,0xCF,0x2A,0x20,0x00,0xED,0x07,0x03,0x30,
+   0x21,0x00,0x39,0x02,0x03,0x18,0xD6,0x2A,0x21,0x00,0xB6,0x01,0x21,0x00,0x39,0x08,
+   0x03,0x1D,0xDC,0x2A,0x30,0x30,0xB9,0x00,0x21,0x00,0xB9,0x03,0x21,0x00,0x34,0x1C,
+   0xE4,0x2A,0x22,0x00,0x0C,0x14,0xE6,0x2A,0x22,0x00,0x0C,0x10,0x21,0x00,0x34,0x10,
+   0x22,0x00,0x0C,0x1C,0x05,0x2B,0x20,0x00,0x99,0x1F,0xF9,0x2A,0x11,0x30,0x21,0x00,
+   0xB0,0x00,0xCB,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,
+   0xB3,0x00,0x22,0x00,0x0C,0x12,0x8C,0x12,0x3C,0x30,0x21,0x00,0xAE,0x00,0xAF,0x01,
+   0x40,0x03,0x83,0xAC,0x00,0xAD,0x01,0x18,0x2E,0x7C,0x30,0x40,0x4F,0x41,0x55,0x8F,
+   0xC4,0x00,0x06,0x30,0x44,0x02,0x03,0x18,0x30,0x2C,0x21,0x00,0x33,0x13,0x03,0x30,
+   0x20,0x00,0x3F,0x02,0x03,0x1D,0x19,0x2B,0xE8,0x30,0x3E,0x02,0x03,0x1C,0x35,0x2C,
+   0x41,0x15,0x88,0xAC,0x00,0x77,0x08,0xAD,0x00,0xBD,0x00,0x06,0x30,0x3D,0x02,0x03,
+   0x18,0x2B,0x2C,0x77,0x30,0x43,0x0A,0x9A,0xBC,0x00,0x20,0x00,0xEE,0x0A,0x03,0x19,
+   0xEF,0x0A,0x09,0x30,0x20,0x00,0x3C,0x02,0x03,0x1C,0x38,0x2B,0x08,0x30,0xBC,0x00,
+   0x13,0x30,0xF7,0x00,0x20,0x00,0x3D,0x08,0x8E,0x31,0xEE,0x26,0x83,0x31,0x20,0x00,
+   0xAD,0x00,0x03,0x10,0x3C,0x0D,0xBD,0x00,0xAD,0x07,0x2D,0x0A,0xAC,0x00,0x40,0x1F,
+   0x85,0xBD,0x00,0x77,0x08,0xAC,0x00,0x02,0x30,0x2D,0x07,0xAE,0x00,0x40,0x07,0x95,
+   0xAF,0x00,0x77,0x08,0xAE,0x00,0x3D,0x08,0x20,0x00,0x6F,0x02,0x03,0x1D,0x5D,0x2B,
+   0x20,0x00,0x2C,0x08,0x20,0x00,0x6E,0x02,0x03,0x1C,0x94,0x2B,0x20,0x00,0x2E,0x08,
+   0x20,0x00,0xEA,0x00,0x20,0x00,0x2F,0x08,0x20,0x00,0xEB,0x00,0x40,0x07,0x8C,0xF6,
+   0x00,0x2F,0x08,0xF7,0x00,0x72,0x30,0x63,0x27,0x20,0x00,0x3C,0x08,0x08,0x3A,0x03,
+   0x19,0x7E,0x2B,0x03,0x30,0x2D,0x07,0xB0,0x00,0x40,0x26,0x99,0xB1,0x00,0x77,0x08,
+   0xB0,0x00,0x31,0x04,0x03,0x1D,0x85,0x2B,0x06,0x30,0xF6,0x00,0x00,0x30,0xF7,0x00,
+   0x7C,0x30,0x63,0x27,0x2B,0x2C,0x20,0x00,0xEE,0x01,0xEF,0x01,0x20,0x00,0xBC,0x0A,
+   0x3C,0x08,0xB0,0x00,0xB1,0x01,0x30,0x08,0xF6,0x00,0x31,0x08,0xF7,0x00,0x77,0x30,
+   0x40,0x0E,0x80,0x7B,0x30,0x40,0x1E,0x86,0xB0,0x00,0x77,0x08,0xBC,0x00,0x30,0x04,
+   0x03,0x19,0x2B,0x2C,0x2D,0x08,0x40,0x08,0x80,0xBC,0x00,0x40,0x76,0x82,0x20,0x00,
+   0x6F,0x0E,0xF0,0x39,0x40,0x2E,0x81,0x20,0x00,0x6E,0x0E,0x40,0x13,0x85,0x0F,0x39,
+   0xB1,0x04,0xB0,0x06,0x03,0x10,0xB0,0x0D,0xB1,0x0D,0x41,0x02,0x85,0x20,0x30,0xB2,
+   0x00,0xB3,0x01,0xB4,0x01,0xB5,0x01,0xB6,0x01,0x40,0x80,0x86,0x31,0x02,0x03,0x1D,
+   0xC2,0x2B,0x2C,0x08,0x30,0x02,0x03,0x1C,0xE3,0x2B,0x40,0x6A,0xA0,0xB0,0x02,0x3D,
+   0x08,0x03,0x1C,0x3D,0x0F,0xB1,0x02,0x2E,0x08,0xB7,0x00,0x2F,0x08,0xB8,0x00,0x00,
+   0x30,0xB8,0x1B,0xFF,0x30,0xBA,0x00,0xB9,0x00,0x37,0x08,0xB2,0x07,0x38,0x08,0x03,
+   0x18,0x38,0x0F,0xB3,0x07,0x39,0x08,0x03,0x18,0x39,0x0F,0xB4,0x07,0x3A,0x08,0x03,
+   0x18,0x3A,0x0F,0xB5,0x07,0xFB,0x2B,0x20,0x00,0x2D,0x08,0xB7,0x00,0x3C,0x08,0x52,
+   0x18,0xA1,0x20,0x00,0xB6,0x0A,0x40,0x30,0x36,0x02,0x03,0x1C,0xBB,0x2B,0x32,0x0E,
+   0x0F,0x39,0xB2,0x00,0x33,0x0E,0xB3,0x00,0xF0,0x39,0xB2,0x04,0xB3,0x06,0x34,0x0E,
+   0xB4,0x00,0xF0,0x39,0xB3,0x04,0xB4,0x06,0x35,0x0E,0xB5,0x00,0xF0,0x39,0xB4,0x04,
+   0xB5,0x06,0xF0,0x30,0xB5,0x19,0xB5,0x04,0x03,0x10,0xB5,0x1B,0x03,0x14,0xB5,0x0C,
+   0xB4,0x0C,0xB3,0x0C,0xB2,0x0C,0x45,0x06,0x80,0x32,0x08,0x41,0xC3,0x80,0x33,0x08,
+   0x40,0xC3,0x8A,0x08,0x30,0x20,0x00,0xBE,0x00,0xBF,0x01,0x35,0x2C,0x21,0x00,0x33,
+   0x17,0x20,0x00,0xBE,0x01,0xBF,0x01,0x76,0x30,0x40,0x97,0xA0,0xC3,0x00,0x77,0x08,
+   0xC2,0x00,0x43,0x04,0x03,0x19,0x9D,0x2C,0x20,0x00,0x6A,0x08,0x20,0x00,0x6C,0x02,
+   0x20,0x00,0xC4,0x00,0x20,0x00,0x6B,0x08,0x03,0x1C,0x6B,0x0A,0x20,0x00,0x6D,0x02,
+   0x20,0x00,0xC5,0x00,0x03,0x14,0xC5,0x1F,0x03,0x10,0x03,0x1C,0x56,0x2C,0xC4,0x09,
+   0xC5,0x09,0xC4,0x0A,0x03,0x19,0xC5,0x0A,0x03,0x14,0x20,0x00,0xC3,0x1F,0x40,0x0A,
+   0xA2,0x7F,0x2C,0xC2,0x09,0xC3,0x09,0xC2,0x0A,0x03,0x19,0xC3,0x0A,0x43,0x08,0x80,
+   0x3E,0xC8,0x00,0x45,0x08,0x80,0x3E,0x48,0x02,0x03,0x1D,0x6B,0x2C,0x44,0x08,0x42,
+   0x02,0x20,0x00,0xC6,0x01,0x03,0x1C,0x46,0x14,0x46,0x08,0x00,0x30,0x03,0x19,0x01,
+   0x30,0xC7,0x00,0xC6,0x00,0x46,0x0C,0x03,0x18,0x7A,0x2C,0x22,0x00,0x0C,0x10,0x03,
+   0x1C,0x7E,0x2C,0x22,0x00,0x0C,0x14,0x40,0x40,0x40,0x1B,0x80,0xC8,0x00,0x40,0x21,
+   0x40,0x1E,0x82,0x8A,0x2C,0x42,0x08,0x44,0x02,0x46,0x1E,0x80,0xC2,0x00,0x41,0x1E,
+   0x80,0x99,0x2C,0x41,0x1E,0x80,0x9D,0x2C,0x40,0x1E,0x9A,0x21,0x00,0x2C,0x08,0x2D,
+   0x04,0x03,0x19,0xA6,0x2C,0xFF,0x30,0xAC,0x07,0x03,0x1C,0xAD,0x03,0x21,0x00,0x2E,
+   0x08,0x2F,0x04,0x03,0x19,0xAF,0x2C,0xFF,0x30,0xAE,0x07,0x03,0x1C,0xAF,0x03,0x20,
+   0x00,0xA7,0x01,0x22,0x00,0x0C,0x1E,0xB6,0x2C,0x20,0x00,0xA7,0x0A,0x20,0x00,0x27,
+   0x08,0x41,0x28,0x8A,0xA9,0x00,0xA7,0x00,0x27,0x0C,0x03,0x18,0xC2,0x2C,0x21,0x00,
+   0xB3,0x13,0x03,0x1C,0xC6,0x2C,0x21,0x00,0xB3,0x17,0x41,0x16,0x81,0x8C,0x1E,0xCD,
+   0x2C,0x49,0x16,0x86,0xD9,0x2C,0x21,0x00,0xB3,0x11,0x03,0x1C,0xDD,0x2C,0x21,0x00,
+   0xB3,0x15,0x40,0x2B,0x80,0xF2,0x2C,0x40,0x9B,0x84,0x80,0x3E,0x20,0x00,0xA8,0x00,
+   0x20,0x00,0x6D,0x08,0x40,0x04,0x88,0x28,0x02,0x03,0x1D,0xF0,0x2C,0x20,0x00,0x6C,
+   0x08,0x20,0x00,0x6A,0x02,0x03,0x18,0x07,0x2D,0x40,0x29,0x80,0x65,0x2D,0x42,0x0F,
+   0x40,0x14,0x41,0x19,0x40,0x14,0x80,0x05,0x2D,0x42,0xC2,0x82,0x03,0x1C,0x65,0x2D,
+   0x79,0x30,0x40,0xD1,0x90,0xA9,0x00,0x77,0x08,0xA7,0x00,0x29,0x0E,0xF0,0x39,0x21,
+   0x00,0xAD,0x00,0x20,0x00,0x27,0x0E,0x21,0x00,0xAC,0x00,0x0F,0x39,0xAD,0x04,0xAC,
+   0x06,0x03,0x10,0xAC,0x0D,0xAD,0x0D,0x41,0x02,0x85,0x2C,0x0E,0x0F,0x39,0x20,0x00,
+   0xA7,0x00,0x21,0x00,0x2D,0x0E,0x40,0x1A,0x8E,0xF0,0x39,0xA7,0x04,0xA9,0x06,0x27,
+   0x08,0x21,0x00,0xAC,0x02,0x20,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x03,0x19,0x34,
+   0x2D,0x21,0x00,0xAD,0x02,0x7A,0x30,0x46,0x2C,0x80,0xAF,0x00,0x41,0x2C,0x86,0xAE,
+   0x00,0x0F,0x39,0xAF,0x04,0xAE,0x06,0x03,0x10,0xAE,0x0D,0xAF,0x0D,0x41,0x02,0x80,
+   0x2E,0x0E,0x42,0x2C,0x80,0x2F,0x0E,0x45,0x2C,0x80,0xAE,0x02,0x43,0x2C,0x8C,0x61,
+   0x2D,0x21,0x00,0xAF,0x02,0x22,0x00,0x0C,0x12,0x8C,0x12,0xE7,0x2D,0x22,0x00,0x0C,
+   0x1A,0xE7,0x2D,0x8C,0x1A,0xE7,0x2D,0x73,0x30,0x43,0x35,0x81,0x20,0x00,0x6A,0x07,
+   0x42,0x79,0x88,0x20,0x00,0xAB,0x00,0x29,0x08,0x03,0x18,0x29,0x0F,0xAB,0x07,0x2B,
+   0x08,0x80,0x3E,0xAA,0x00,0x42,0x89,0x82,0x2A,0x02,0x03,0x1D,0x8A,0x2D,0x41,0x99,
+   0x82,0x28,0x02,0x03,0x18,0xAC,0x2D,0x42,0xEE,0x87,0xA9,0x2D,0x20,0x00,0xA8,0x01,
+   0x21,0x00,0xB3,0x1F,0x98,0x2D,0x20,0x00,0xA8,0x0A,0x40,0x0B,0x80,0x01,0x39,0x40,
+   0x24,0x84,0xAA,0x00,0xA8,0x06,0x28,0x0C,0x03,0x18,0xA4,0x2D,0x41,0xE1,0x80,0xA8,
+   0x2D,0x40,0xE1,0x40,0x43,0x81,0x0C,0x16,0xE7,0x2D,0x40,0xDE,0x40,0xBF,0x40,0x62,
+   0x41,0x57,0x81,0x20,0x00,0x6B,0x02,0x40,0x4A,0x42,0x39,0x85,0xAC,0x00,0x29,0x08,
+   0x80,0x3E,0x2C,0x02,0x03,0x1D,0xC6,0x2D,0x40,0x15,0x8E,0x6C,0x02,0x03,0x18,0xE7,
+   0x2D,0x21,0x00,0x2E,0x08,0x2F,0x04,0x03,0x19,0xE5,0x2D,0x20,0x00,0xA7,0x01,0x21,
+   0x00,0xB3,0x1D,0xD4,0x2D,0x20,0x00,0xA7,0x0A,0x40,0x0B,0x40,0x3B,0x8B,0xA9,0x00,
+   0xA8,0x00,0xA7,0x06,0x27,0x0C,0x03,0x18,0xE0,0x2D,0x21,0x00,0xB3,0x11,0x03,0x1C,
+   0xE4,0x2D,0x21,0x00,0xB3,0x15,0x40,0x3B,0x95,0x8C,0x16,0x20,0x00,0x99,0x1F,0x18,
+   0x2E,0x22,0x00,0x0C,0x1C,0xFA,0x2D,0x23,0x00,0x1D,0x1F,0xFA,0x2D,0x61,0x30,0x21,
+   0x00,0xB0,0x00,0x11,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x01,
+   0x2E,0x01,0x30,0xF6,0x00,0x40,0x75,0x84,0xF7,0x00,0x6D,0x08,0x1D,0x26,0x20,0x00,
+   0xC2,0x01,0x40,0x15,0x97,0x08,0x2E,0x20,0x00,0xC2,0x0A,0x20,0x00,0x42,0x08,0x00,
+   0x30,0x03,0x19,0x01,0x30,0xC4,0x00,0xC2,0x00,0x42,0x0C,0x03,0x18,0x14,0x2E,0x23,
+   0x00,0x1D,0x13,0x03,0x1C,0x18,0x2E,0x23,0x00,0x1D,0x17,0x20,0x00,0x93,0x10,0x64,
+   0x00,0xC0,0x28,0x08,0x00,0x41,0xB0,0x9E,0xA8,0x00,0x76,0x08,0xAB,0x00,0x03,0x14,
+   0xA9,0x1F,0x03,0x10,0x03,0x1C,0x31,0x2E,0x21,0x00,0x33,0x12,0x20,0x00,0xA8,0x09,
+   0xA9,0x09,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0x33,0x2E,0x21,0x00,0x33,0x16,0x20,0x00,
+   0x2B,0x08,0x01,0x3A,0x03,0x1D,0x3C,0x2E,0x21,0x00,0xB3,0x12,0x33,0x11,0x3F,0x2E,
+   0x21,0x00,0xB3,0x16,0x33,0x15,0x40,0xE5,0x90,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x47,
+   0x2E,0xE8,0x30,0x28,0x02,0x03,0x1C,0x57,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,
+   0x08,0xAC,0x00,0x2A,0x08,0xF7,0x00,0x2C,0x08,0xFA,0x26,0x42,0x34,0x80,0xAB,0x01,
+   0x41,0x17,0x83,0x80,0x3E,0x03,0x1D,0x5F,0x2E,0x64,0x30,0x40,0x17,0x80,0x93,0x2E,
+   0x43,0x17,0x82,0xAD,0x01,0x20,0x00,0x2C,0x08,0x41,0x0F,0x9B,0x6F,0x2E,0x64,0x30,
+   0x2A,0x02,0x03,0x1C,0x78,0x2E,0x9C,0x30,0x20,0x00,0xAA,0x07,0x03,0x1C,0xAC,0x03,
+   0xAD,0x0A,0x67,0x2E,0x20,0x00,0x2A,0x08,0xA8,0x00,0x2C,0x08,0xA9,0x00,0x0F,0x30,
+   0xAD,0x05,0x2D,0x08,0xF6,0x3E,0xAD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xAA,0x00,
+   0x2D,0x08,0xF6,0x00,0x40,0x39,0x83,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x40,
+   0xD1,0x40,0x9E,0x80,0x96,0x2E,0x40,0x9C,0x80,0xB0,0x00,0x43,0x3E,0x84,0x9E,0x2E,
+   0x0A,0x30,0x28,0x02,0x03,0x18,0xAB,0x2E,0x40,0x6C,0x88,0x03,0x1D,0xAB,0x2E,0x21,
+   0x00,0x30,0x08,0x20,0x00,0xAA,0x00,0xFF,0x3A,0x03,0x19,0xE1,0x2E,0x49,0x49,0x81,
+   0xB9,0x2E,0x0A,0x30,0x40,0x49,0x81,0xC2,0x2E,0xF6,0x30,0x43,0x49,0x80,0xB1,0x2E,
+   0x43,0x49,0x50,0x47,0x80,0xB1,0x00,0x40,0x39,0x84,0x03,0x19,0xE4,0x2E,0x21,0x00,
+   0x31,0x10,0xE4,0x2E,0x40,0x4D,0x40,0x09,0x83,0x28,0x08,0xAB,0x00,0xF6,0x3E,0xA8,
+   0x00,0x41,0x1E,0x83,0xA9,0x00,0x28,0x08,0xF6,0x00,0x29,0x08,0x44,0x1E,0x80,0xAB,
+   0x00,0x40,0xFF,0x40,0xDC,0x87,0xA0,0x00,0x77,0x08,0xA1,0x00,0x03,0x10,0x20,0x0C,
+   0xA2,0x00,0x21,0x0C,0xA3,0x00,0x40,0x04,0x93,0xA4,0x00,0x21,0x0C,0xA6,0x00,0x03,
+   0x10,0xA4,0x0C,0xA6,0x0C,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,
+   0x07,0x23,0x0E,0x0F,0x39,0xA6,0x00,0x22,0x0E,0xA4,0x00,0xF0,0x39,0xA6,0x04,0xA4,
+   0x06,0x44,0x0D,0x82,0x22,0x08,0xA6,0x00,0xA4,0x01,0x44,0x08,0x82,0x03,0x10,0xA2,
+   0x0C,0xA3,0x0C,0x45,0x02,0x86,0x23,0x0D,0xA6,0x00,0x22,0x0D,0xA4,0x00,0x03,0x10,
+   0xA6,0x0D,0xA4,0x0D,0x42,0x02,0x94,0x23,0x0D,0xA5,0x00,0x22,0x0D,0xA7,0x00,0x25,
+   0x08,0xA6,0x07,0x27,0x08,0x03,0x18,0x27,0x0F,0xA4,0x07,0x26,0x08,0xA1,0x02,0x24,
+   0x08,0x03,0x1C,0x24,0x0F,0xA0,0x02,0x06,0x30,0xA1,0x07,0x03,0x18,0xA0,0x0A,0x21,
+   0x0E,0x40,0x3F,0x80,0x20,0x0E,0x48,0x3F,0x82,0x23,0x08,0xF7,0x00,0x22,0x08,0x40,
+   0x68,0x86,0xA7,0x00,0x77,0x08,0xA9,0x00,0x76,0x08,0xA8,0x00,0x27,0x08,0xA0,0x27,
+   0x40,0x75,0x8C,0x77,0x08,0xAA,0x00,0x28,0x06,0x03,0x1D,0x76,0x2F,0x2B,0x08,0x29,
+   0x06,0x03,0x19,0x9F,0x2F,0x03,0x10,0x20,0x00,0x27,0x0D,0xAA,0x00,0x40,0xB7,0x81,
+   0x23,0x00,0x91,0x00,0x40,0x99,0x95,0x23,0x00,0x93,0x00,0x15,0x13,0x95,0x13,0x15,
+   0x15,0x20,0x00,0x8B,0x13,0x55,0x30,0x23,0x00,0x96,0x00,0xAA,0x30,0x96,0x00,0x95,
+   0x14,0x20,0x00,0x8B,0x17,0x23,0x00,0x15,0x11,0x23,0x00,0x95,0x18,0x91,0x2F,0x20,
+   0x00,0x12,0x12,0x40,0xFF,0x86,0xA8,0x00,0xA9,0x01,0x2A,0x08,0xA7,0x00,0xAA,0x0A,
+   0x27,0x1C,0x7A,0x2F,0x41,0xA5,0x86,0xA1,0x01,0xA2,0x01,0x03,0x10,0x20,0x0D,0xA3,
+   0x00,0x20,0x00,0x23,0x08,0x40,0x2C,0x40,0x28,0x81,0x15,0x14,0x13,0x08,0x40,0x0E,
+   0x84,0xA4,0x01,0x20,0x08,0xA6,0x00,0xA5,0x01,0x22,0x08,0x41,0x05,0x8A,0x25,0x04,
+   0xA1,0x00,0x24,0x08,0x26,0x04,0xA2,0x00,0x23,0x08,0xA0,0x00,0xA3,0x0A,0x20,0x1C,
+   0xA7,0x2F,0x21,0x08,0x41,0x63,0x90,0x00,0x3A,0x03,0x19,0xCE,0x2F,0x80,0x3A,0x03,
+   0x19,0xD4,0x2F,0x00,0x34,0x76,0x08,0x84,0x00,0x77,0x08,0x85,0x00,0x00,0x08,0x08,
+   0x00,0x77,0x08,0x8A,0x00,0x76,0x08,0x82,0x00,0x41,0x11,0x80,0xE1,0x2F,0x40,0x11,
+   0x81,0xE9,0x2F,0xF7,0x01,0x43,0x12,0x81,0x12,0x00,0xF7,0x00,0x40,0x14,0x85,0x87,
+   0x31,0xD4,0x27,0xF5,0x00,0xF6,0x0F,0xF7,0x03,0xF7,0x0A,0x40,0x05,0x8E,0xF4,0x00,
+   0x75,0x08,0xF7,0x00,0x74,0x08,0x08,0x00,0x03,0x34,0xB7,0x34,0x0D,0x34,0x25,0x34,
+   0xB1,0x34,0x61,0x34,0x41,0x34,0x37,0x34,0x01,0x34,0x21,0x34,0x40,0x7A,0xA0,0x22,
+   0x00,0x0D,0x08,0x20,0x00,0xDD,0x00,0x21,0x00,0x0E,0x08,0x20,0x00,0xDE,0x00,0x22,
+   0x00,0x8D,0x01,0xD8,0x30,0x21,0x00,0x8E,0x00,0x03,0x10,0x21,0x00,0x3E,0x0D,0x20,
+   0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x8E,0x1F,0x1A,0x28,0x20,0x00,0xE0,0x0A,0x20,
+   0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x03,
+   0x10,0x43,0x11,0x81,0x0E,0x1E,0x2C,0x28,0x4E,0x11,0x81,0x0E,0x1F,0x3E,0x28,0x4E,
+   0x11,0x81,0x8E,0x1D,0x50,0x28,0x48,0x11,0x85,0x20,0x00,0x5D,0x08,0x22,0x00,0x8D,
+   0x00,0x20,0x00,0x5E,0x08,0x40,0x50,0x40,0xD2,0xA1,0x21,0x00,0x3D,0x08,0x03,0x1D,
+   0xBD,0x03,0x0F,0x30,0x21,0x00,0x3A,0x02,0x03,0x18,0x59,0x2C,0x88,0x30,0x8A,0x00,
+   0x72,0x30,0x3A,0x07,0x03,0x18,0x8A,0x0A,0x82,0x00,0x81,0x28,0xD3,0x28,0xEB,0x28,
+   0xFF,0x28,0x25,0x29,0xEC,0x2B,0xA8,0x2B,0x09,0x2C,0x15,0x2C,0x59,0x2C,0x59,0x2C,
+   0x49,0x29,0xE2,0x29,0x78,0x2A,0xE0,0x2A,0x88,0x30,0x21,0x00,0x3E,0x05,0x40,0x7F,
+   0x92,0x08,0x3A,0x03,0x1D,0x90,0x28,0x1B,0x30,0x21,0x00,0xBD,0x00,0x06,0x30,0x21,
+   0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3E,0x04,0x03,0x19,0x5B,0x2C,0x7F,
+   0x30,0x87,0x31,0xA0,0x27,0x88,0x31,0x40,0x90,0x82,0x77,0x08,0xDD,0x00,0x5E,0x04,
+   0x40,0x0A,0x80,0x33,0x30,0x42,0x1E,0x83,0x03,0x3A,0x03,0x1D,0xAC,0x28,0x01,0x30,
+   0x41,0x1B,0x80,0x22,0x30,0x42,0x0B,0x83,0x02,0x3A,0x03,0x1D,0xB8,0x28,0x02,0x30,
+   0x41,0x0B,0x80,0x11,0x30,0x42,0x0B,0x83,0x01,0x3A,0x03,0x1D,0xC7,0x28,0x0D,0x30,
+   0x40,0x36,0x80,0x03,0x30,0x41,0x0E,0x80,0x44,0x30,0x42,0x0E,0x83,0x40,0x3A,0x03,
+   0x1D,0x5B,0x2C,0x07,0x30,0x42,0x42,0x8B,0xF6,0x00,0x6D,0x30,0xF7,0x00,0x00,0x30,
+   0x86,0x31,0x1D,0x26,0x88,0x31,0x21,0x00,0x30,0x10,0x21,0x00,0xB3,0x16,0x33,0x15,
+   0x43,0x3F,0x80,0x33,0x3A,0x40,0x47,0x88,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x01,0x30,
+   0xF6,0x00,0x20,0x00,0x6A,0x08,0xF7,0x00,0x6B,0x08,0x41,0x18,0x43,0x47,0x80,0x22,
+   0x3A,0x43,0x13,0x80,0x7C,0x30,0x40,0x69,0x80,0x89,0x31,0x40,0xBA,0x40,0x69,0x89,
+   0xE0,0x00,0x00,0x30,0xF7,0x00,0x60,0x08,0x6D,0x24,0x06,0x30,0x20,0x00,0x60,0x02,
+   0x03,0x18,0x1A,0x29,0x41,0xAE,0x83,0x1A,0x29,0x11,0x30,0xBD,0x00,0x04,0x30,0x40,
+   0x47,0x43,0x61,0x80,0x11,0x3A,0x43,0x25,0x80,0x77,0x30,0x45,0x25,0x40,0x59,0x82,
+   0x5D,0x08,0xF7,0x00,0x5F,0x08,0x40,0x40,0x80,0x89,0x31,0x41,0x23,0x83,0x3E,0x29,
+   0x0D,0x30,0xBD,0x00,0x05,0x30,0x4B,0x23,0x81,0x21,0x00,0x33,0x16,0x40,0x6C,0x40,
+   0xC0,0x8D,0x3B,0x02,0x03,0x18,0x7A,0x29,0x21,0x00,0x3C,0x1C,0x5C,0x29,0x85,0x30,
+   0x21,0x00,0xB0,0x00,0xD1,0x30,0x21,0x00,0xB1,0x00,0x62,0x29,0x61,0x30,0x40,0x06,
+   0x80,0x19,0x30,0x40,0x06,0x82,0x03,0x10,0x21,0x00,0x3C,0x0C,0x40,0x23,0x8C,0xF6,
+   0x3E,0xDD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xDF,0x00,0x5D,0x08,0xF6,0x00,0x5F,
+   0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x40,0x4B,0x89,0xE0,0x00,0x21,0x00,
+   0xB2,0x00,0xDB,0x29,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,
+   0x40,0x0B,0x88,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x03,
+   0x18,0x5F,0x0F,0x8E,0x3E,0x4A,0x1E,0x80,0xB0,0x00,0x50,0x1D,0x82,0xDD,0x0A,0x03,
+   0x19,0xDF,0x0A,0x49,0x20,0x80,0xB1,0x00,0x50,0x20,0x82,0x02,0x30,0xDD,0x07,0x03,
+   0x18,0x4A,0x21,0x84,0xB2,0x00,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0C,0x30,0x40,0xA2,
+   0x85,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3D,0x04,0x03,0x1D,0xEA,0x29,0x41,0xA0,0x80,
+   0x88,0x30,0x42,0xAB,0x83,0x80,0x3A,0x03,0x1D,0xF6,0x29,0x07,0x30,0x41,0x13,0x80,
+   0x22,0x30,0x42,0x0B,0x84,0x20,0x3A,0x03,0x1D,0x17,0x2A,0x21,0x00,0xBC,0x0A,0x42,
+   0xB2,0x88,0x0C,0x2A,0x13,0x30,0x21,0x00,0x3C,0x02,0x03,0x1C,0x13,0x2A,0xBC,0x01,
+   0x13,0x2A,0x0B,0x30,0x41,0x06,0x82,0x35,0x2A,0xBC,0x01,0x35,0x2A,0x40,0x06,0x40,
+   0x20,0x43,0xD8,0x84,0x10,0x3A,0x03,0x1D,0x48,0x2A,0x21,0x00,0xBC,0x03,0x42,0x20,
+   0x80,0x2E,0x2A,0x42,0x20,0x83,0x44,0x2A,0x12,0x30,0xBC,0x00,0x44,0x2A,0x43,0x21,
+   0x81,0x0A,0x30,0xBC,0x00,0x40,0x79,0x85,0x05,0x3A,0x03,0x1D,0x3D,0x2A,0xBC,0x0A,
+   0xBC,0x0A,0x44,0x2A,0x40,0x07,0x84,0x06,0x3A,0x03,0x1D,0x44,0x2A,0xFE,0x30,0xBC,
+   0x07,0x42,0x30,0x80,0x44,0x30,0x42,0x30,0x83,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x13,
+   0x30,0x40,0x96,0x80,0x3B,0x08,0x40,0x96,0x80,0x8A,0x31,0x40,0x0B,0x40,0x1B,0x84,
+   0x20,0x00,0xDD,0x07,0x5D,0x08,0x87,0x31,0xA0,0x27,0x40,0x09,0x83,0xE4,0x00,0x77,
+   0x08,0xE3,0x00,0x20,0x00,0x40,0x96,0x84,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,
+   0xAD,0x24,0x42,0x0B,0x41,0x95,0x80,0x0D,0x30,0x41,0x2F,0x42,0x56,0x84,0x94,0x2A,
+   0x21,0x00,0x3C,0x1C,0x8A,0x2A,0x00,0x30,0x43,0x19,0x84,0x86,0x31,0x1D,0x26,0x8A,
+   0x31,0xD9,0x2A,0x01,0x30,0x47,0x09,0x44,0xDA,0x41,0x43,0x47,0xDA,0x80,0x03,0x30,
+   0x48,0xDA,0x40,0x16,0x84,0xE0,0x00,0x04,0x30,0x60,0x02,0x03,0x18,0xC2,0x2A,0x48,
+   0x2D,0x84,0x20,0x00,0x60,0x08,0x07,0x3A,0x03,0x1D,0xD0,0x2A,0x40,0x0C,0x40,0x2D,
+   0x84,0x00,0x30,0xF7,0x00,0x5D,0x08,0x6D,0x24,0xD9,0x2A,0x47,0x4F,0x41,0x67,0x80,
+   0x0E,0x30,0x41,0x67,0x4B,0x8F,0x87,0x21,0x00,0x3D,0x08,0x03,0x1D,0xF4,0x2A,0x21,
+   0x00,0xBA,0x01,0x5B,0x2C,0x88,0x30,0x41,0xAB,0x83,0xDF,0x00,0x80,0x3A,0x03,0x1D,
+   0x00,0x2B,0x42,0xB7,0x99,0x21,0x00,0xBE,0x1E,0x16,0x2B,0x20,0x00,0xE3,0x0A,0x03,
+   0x19,0xE4,0x0A,0x64,0x08,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x0E,0x2B,0xE9,0x30,0x63,
+   0x02,0x03,0x1C,0x2C,0x2B,0x09,0x30,0x20,0x00,0xE3,0x07,0x03,0x18,0xE4,0x0A,0x2C,
+   0x2B,0x21,0x00,0x3E,0x1E,0x43,0x2B,0xFF,0x30,0x40,0x08,0x81,0x03,0x1C,0xE4,0x03,
+   0x42,0x16,0x80,0x25,0x2B,0x42,0x16,0x80,0xF7,0x30,0x42,0x0D,0x4A,0xC6,0x86,0x1F,
+   0x30,0x28,0x00,0x1D,0x02,0x03,0x1C,0x3F,0x2B,0xF8,0x30,0x9D,0x07,0x42,0xCA,0x42,
+   0xFA,0x80,0xDF,0x00,0x40,0xFA,0x80,0xA4,0x2B,0x40,0x68,0x82,0x06,0x3A,0x03,0x1D,
+   0x96,0x2B,0x40,0x66,0x80,0x0A,0x3A,0x40,0x04,0x40,0x84,0x40,0x8B,0x87,0x77,0x30,
+   0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0xEE,0x01,0xEF,0x01,0x20,0x00,0x40,0x42,
+   0x86,0x80,0x3E,0x03,0x1D,0x68,0x2B,0x06,0x30,0x63,0x02,0x03,0x18,0x96,0x2B,0x41,
+   0xA2,0x80,0xDF,0x00,0x40,0x8D,0x80,0x5F,0x08,0x40,0x8C,0x40,0x16,0x82,0xE0,0x00,
+   0x87,0x31,0xA0,0x27,0x40,0x04,0x87,0xEB,0x00,0x77,0x08,0xEA,0x00,0x6A,0x08,0xF6,
+   0x00,0x6B,0x08,0xF7,0x00,0x72,0x30,0x42,0x27,0x81,0xE0,0x0A,0x60,0x08,0x42,0x11,
+   0x83,0xE0,0x00,0x77,0x08,0xDF,0x00,0x60,0x04,0x40,0x3C,0x83,0x06,0x30,0x20,0x00,
+   0xE3,0x00,0xE4,0x01,0x40,0x2B,0x82,0xF6,0x00,0x64,0x08,0xF7,0x00,0x40,0x6E,0x41,
+   0x1A,0x42,0xA3,0x89,0xFA,0x30,0x28,0x00,0x9D,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,
+   0x3D,0x04,0x03,0x1D,0xE1,0x2B,0x7F,0x30,0x42,0x25,0x90,0xDF,0x00,0x77,0x08,0xDD,
+   0x00,0xE0,0x00,0x60,0x08,0x00,0x30,0x03,0x19,0x01,0x30,0xDD,0x00,0xE1,0x00,0xE2,
+   0x01,0xE1,0x1B,0xE2,0x03,0x61,0x08,0xF6,0x00,0x62,0x08,0xF7,0x00,0x40,0x15,0x41,
+   0x41,0x8F,0x60,0x08,0x03,0x19,0xD4,0x2B,0x22,0x00,0x0C,0x10,0x0C,0x12,0x8C,0x12,
+   0x28,0x00,0x17,0x11,0x20,0x00,0x93,0x10,0xDE,0x2B,0x3C,0x30,0x21,0x00,0xAE,0x00,
+   0xAF,0x01,0x40,0x03,0x83,0xAC,0x00,0xAD,0x01,0x28,0x00,0x17,0x15,0x45,0xEC,0x82,
+   0xDD,0x00,0x88,0x3A,0x03,0x19,0x40,0xE8,0x40,0x0A,0x40,0x96,0x8D,0x20,0x00,0x6E,
+   0x08,0xF7,0x00,0x6F,0x08,0x86,0x31,0x1D,0x26,0x8B,0x31,0x21,0x00,0x3D,0x08,0x03,
+   0x1D,0xFE,0x2B,0x0D,0x30,0xBD,0x00,0x03,0x30,0x40,0x5A,0x80,0x11,0x30,0x42,0x1C,
+   0x80,0x11,0x3A,0x43,0x1C,0x81,0x01,0x30,0xF7,0x00,0x40,0xBF,0x84,0x6D,0x24,0x6E,
+   0x30,0x21,0x00,0xBD,0x00,0x08,0x30,0x41,0x70,0x41,0x6C,0x81,0x03,0x19,0x22,0x2C,
+   0x43,0x38,0x82,0x80,0x3A,0x03,0x1D,0x25,0x2C,0x41,0x1B,0x80,0x22,0x30,0x42,0x0A,
+   0x89,0x20,0x3A,0x03,0x1D,0x37,0x2C,0x21,0x00,0xBB,0x0A,0x07,0x30,0x3B,0x02,0x03,
+   0x18,0xBB,0x01,0x07,0x30,0x41,0x21,0x43,0x38,0x84,0x10,0x3A,0x03,0x1D,0x4B,0x2C,
+   0x21,0x00,0xBB,0x03,0x40,0x11,0x83,0x03,0x1C,0x47,0x2C,0x06,0x30,0xBB,0x00,0x42,
+   0x13,0x80,0x44,0x30,0x42,0x13,0x81,0x40,0x3A,0x03,0x1D,0x40,0x4C,0x80,0xBC,0x01,
+   0x42,0xB4,0x40,0x36,0x81,0x21,0x00,0x3A,0x08,0x41,0xA5,0x40,0x11,0x93,0xE0,0x00,
+   0x60,0x0C,0x03,0x18,0x68,0x2C,0x20,0x00,0x99,0x13,0x03,0x1C,0x6C,0x2C,0x20,0x00,
+   0x99,0x17,0x08,0x00,0x20,0x00,0xCD,0x00,0x77,0x08,0xCC,0x00,0x21,0x00,0x33,0x16,
+   0xB3,0x16,0x33,0x15,0xB3,0x14,0x40,0xE3,0xA1,0x4D,0x02,0x03,0x18,0x94,0x2C,0x19,
+   0x30,0x21,0x00,0xB0,0x00,0xDD,0x30,0x21,0x00,0xB1,0x00,0x20,0x00,0x4D,0x08,0xF6,
+   0x3E,0xCD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xCF,0x00,0x4D,0x08,0xF6,0x00,0x4F,
+   0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x8C,0x31,0x21,0x00,0xB2,0x00,0xAC,
+   0x2C,0x00,0x30,0x20,0x00,0x4C,0x04,0x03,0x19,0xA3,0x2C,0x61,0x30,0x40,0x1D,0x80,
+   0x09,0x30,0x40,0x1D,0x80,0xC9,0x30,0x41,0x0E,0x40,0x03,0x81,0xB0,0x00,0xD1,0x30,
+   0x40,0x09,0x80,0xFF,0x30,0x40,0x09,0x40,0x3F,0xC0,0xD4,0x00,0x77,0x08,0xD3,0x00,
+   0x76,0x08,0xD5,0x00,0xD6,0x01,0xD7,0x01,0xE7,0x30,0xD8,0x00,0x03,0x30,0xD9,0x00,
+   0x72,0x30,0x55,0x02,0x03,0x18,0xD3,0x2C,0x55,0x08,0xDA,0x00,0x13,0x30,0x20,0x00,
+   0x5A,0x02,0x03,0x1C,0xC7,0x2C,0xED,0x30,0xDA,0x07,0xBF,0x2C,0x20,0x00,0x5A,0x18,
+   0x52,0x2D,0x70,0x30,0xD6,0x00,0xFE,0x30,0xD7,0x00,0x78,0x30,0xD8,0x00,0x05,0x30,
+   0xD9,0x00,0x52,0x2D,0x8E,0x30,0x20,0x00,0xD5,0x07,0x04,0x30,0xF7,0x00,0x55,0x08,
+   0x8E,0x31,0xEE,0x26,0x8C,0x31,0x20,0x00,0xDA,0x00,0xDB,0x01,0x5A,0x08,0xC2,0x3E,
+   0xD5,0x00,0x8E,0x30,0xDC,0x00,0x5B,0x08,0x03,0x18,0x5B,0x0F,0xDC,0x07,0x03,0x30,
+   0xD5,0x07,0x03,0x18,0xDC,0x0A,0x55,0x08,0xF6,0x00,0x5C,0x08,0x43,0x62,0x40,0x17,
+   0x82,0x5A,0x08,0x03,0x1D,0x02,0x2D,0x47,0x2E,0x8B,0x20,0x00,0x5A,0x08,0x01,0x3A,
+   0x03,0x1D,0x0F,0x2D,0xCE,0x30,0xD6,0x00,0xFF,0x30,0xD7,0x00,0x32,0x30,0xD8,0x00,
+   0xD9,0x01,0x41,0x0C,0x83,0x09,0x3A,0x03,0x1D,0x18,0x2D,0x01,0x30,0x43,0x08,0x82,
+   0x02,0x3A,0x03,0x1D,0x21,0x2D,0x44,0x11,0x83,0x04,0x3A,0x03,0x1D,0x2A,0x2D,0x0F,
+   0x30,0x43,0x08,0x82,0x03,0x3A,0x03,0x1D,0x38,0x2D,0x42,0x35,0x82,0x90,0x30,0xD8,
+   0x00,0x01,0x30,0x42,0x35,0x83,0x05,0x3A,0x03,0x1D,0x41,0x2D,0x08,0x30,0x43,0x16,
+   0x83,0x06,0x3A,0x03,0x1D,0x4A,0x2D,0x3C,0x30,0x43,0x08,0x83,0x07,0x3A,0x03,0x1D,
+   0x52,0x2D,0x06,0x30,0x40,0x08,0x8C,0x20,0x00,0x58,0x08,0xF3,0x00,0x59,0x08,0xF4,
+   0x00,0x56,0x08,0xF5,0x00,0x57,0x08,0xF6,0x00,0x53,0x08,0xF7,0x00,0x54,0x08,0x66,
+   0x25,0x42,0xB1,0x40,0x06,0x43,0xF8,0x99,0x76,0x08,0xCF,0x00,0x75,0x08,0xCE,0x00,
+   0x74,0x08,0xD1,0x00,0x73,0x08,0xD0,0x00,0x51,0x08,0x80,0x3E,0xD2,0x00,0x4D,0x08,
+   0x80,0x3E,0x52,0x02,0x03,0x1D,0x7C,0x2D,0x4C,0x08,0x50,0x02,0x03,0x18,0x83,0x2D,
+   0x20,0x00,0x4E,0x08,0xF7,0x00,0x4F,0x08,0x99,0x2D,0x20,0x00,0x40,0x0E,0x81,0xD2,
+   0x00,0x4F,0x08,0x41,0x11,0x88,0x8E,0x2D,0x4E,0x08,0x4C,0x02,0x03,0x18,0x95,0x2D,
+   0x20,0x00,0x50,0x08,0xF7,0x00,0x51,0x08,0x40,0x11,0x86,0x4C,0x08,0xF7,0x00,0x4D,
+   0x08,0x08,0x00,0x1A,0x30,0xF6,0x00,0x8E,0x30,0x41,0xAD,0xA0,0xD9,0x27,0x8D,0x31,
+   0x21,0x00,0xA1,0x00,0x77,0x08,0xA0,0x00,0x1C,0x30,0xA2,0x00,0x8E,0x30,0xA3,0x00,
+   0x21,0x00,0x20,0x08,0xA4,0x00,0x21,0x08,0xA5,0x00,0xFF,0x30,0xA0,0x07,0x03,0x1C,
+   0xA1,0x03,0x24,0x08,0x25,0x04,0x03,0x19,0x17,0x2E,0x04,0x30,0x22,0x07,0xA4,0x00,
+   0xA5,0x01,0xA5,0x0D,0x23,0x08,0xA5,0x07,0x24,0x08,0xF6,0x00,0x25,0x08,0x44,0x23,
+   0x85,0xA7,0x00,0x77,0x08,0xA6,0x00,0x22,0x08,0xF6,0x00,0x23,0x08,0x44,0x0B,0x85,
+   0xA9,0x00,0xA5,0x00,0x77,0x08,0xA8,0x00,0xA4,0x00,0x02,0x30,0x4D,0x20,0x94,0xA5,
+   0x00,0xAB,0x00,0x77,0x08,0xA4,0x00,0xAA,0x00,0x21,0x00,0x26,0x08,0xAA,0x00,0x27,
+   0x08,0xAB,0x00,0xFF,0x30,0xA6,0x07,0x03,0x1C,0xA7,0x03,0x2A,0x08,0x2B,0x04,0x03,
+   0x19,0x11,0x2E,0x28,0x08,0xF6,0x00,0x29,0x08,0x41,0x1A,0xA4,0xC7,0x27,0x8E,0x31,
+   0x21,0x00,0xAA,0x00,0x24,0x08,0x84,0x00,0x25,0x08,0x85,0x00,0x2A,0x08,0x80,0x00,
+   0xA8,0x0A,0x03,0x19,0xA9,0x0A,0xA4,0x0A,0x03,0x19,0xA5,0x0A,0xED,0x2D,0x06,0x30,
+   0x21,0x00,0xA2,0x07,0x03,0x18,0xA3,0x0A,0xAA,0x2D,0x80,0x31,0x74,0x28,0x08,0x00,
+   0x11,0x34,0x00,0x34,0x03,0x34,0x00,0x34,0xB3,0x34,0x00,0x34,0x01,0x34,0x00,0x34,
+   0x15,0x34,0x0F,0x34,0xB4,0x34,0x41,0x05,0x88,0x0D,0x34,0x0F,0x34,0x6C,0x34,0x00,
+   0x34,0x02,0x34,0x00,0x34,0x16,0x34,0x0F,0x34,0xB5,0x34,0x41,0x0B,0x82,0x17,0x34,
+   0x0F,0x34,0xB6,0x34,0x41,0x05,0x82,0x18,0x34,0x0F,0x34,0xB7,0x34,0x41,0x05,0x82,
+   0x19,0x34,0x0F,0x34,0xB8,0x34,0x41,0x05,0x82,0x1A,0x34,0x0F,0x34,0xB9,0x34,0x41,
+   0x05,0x82,0x0F,0x34,0x0F,0x34,0x6E,0x34,0x41,0x23,0x82,0x11,0x34,0x0F,0x34,0xAC,
+   0x34,0x41,0x05,0x82,0x13,0x34,0x0F,0x34,0xAE,0x34,0x41,0x05,0x82,0x1B,0x34,0x0F,
+   0x34,0xBA,0x34,0x41,0x17,0x82,0x1C,0x34,0x0F,0x34,0xBB,0x34,0x41,0x05,0x82,0x1D,
+   0x34,0x0F,0x34,0xBC,0x34,0x41,0x05,0x82,0x1E,0x34,0x0F,0x34,0xBD,0x34,0x41,0x05,
+   0x82,0x1F,0x34,0x0F,0x34,0xBE,0x34,0x41,0x05,0x82,0x20,0x34,0x0F,0x34,0xBF,0x34,
+   0x41,0x05,0x40,0x00,0x99,0x1A,0x34,0xFE,0x34,0x9D,0x34,0xFE,0x34,0xF2,0x34,0xFE,
+   0x34,0x33,0x34,0xFF,0x34,0x69,0x34,0xFF,0x34,0x98,0x34,0xFF,0x34,0xC3,0x34,0xFF,
+   0x34,0xEB,0x34,0xFF,0x34,0x10,0x34,0x00,0x34,0x33,0x34,0x00,0x34,0x55,0x34,0x00,
+   0x34,0x77,0x34,0x00,0x34,0x98,0x34,0x00,0x34,0x40,0x5B,0x82,0xD9,0x34,0x00,0x34,
+   0xFA,0x34,0x40,0x3F,0xBD,0x01,0x34,0x3E,0x34,0x01,0x34,0x62,0x34,0x01,0x34,0x87,
+   0x34,0x01,0x34,0xAF,0x34,0x01,0x34,0xD9,0x34,0x01,0x34,0x07,0x34,0x02,0x34,0x39,
+   0x34,0x02,0x34,0x70,0x34,0x02,0x34,0xB0,0x34,0x02,0x34,0xFB,0x34,0x02,0x34,0x58,
+   0x34,0x03,0x34,0xD1,0x34,0x03,0x34,0x82,0x34,0x04,0x34,0xCA,0x34,0x05,0x34,0x61,
+   0x34,0x19,0x34,0xFF,0x34,0x00,0x34,0xD1,0x34,0xA1,0x34,0xFF,0x34,0x02,0x34,0xC9,
+   0x34,0xCD,0x34,0xFF,0x34,0x01,0x34,0x85,0x34,0xB7,0x34,0xFF,0x34,0x04,0x34,0x61,
+   0x34,0x11,0x34,0xFF,0x34,0x03,0x34,0x61,0x34,0xC9,0x34,0xFF,0x34,0x05,0x34,0x85,
+   0x34,0xD1,0x34,0xFF,0x34,0x08,0x34,0xCD,0x34,0x85,0x34,0xFF,0x34,0x06,0x34,0xD1,
+   0x34,0x41,0x03,0x80,0xDD,0x34,0x40,0x23,0xA3,0x09,0x34,0xDD,0x34,0xD5,0x34,0xFF,
+   0x34,0x07,0x34,0x20,0x00,0xE5,0x00,0x77,0x08,0xE6,0x00,0xE7,0x01,0x08,0x30,0xE8,
+   0x00,0x20,0x00,0x65,0x1C,0xFA,0x2E,0x66,0x08,0xE7,0x07,0x20,0x00,0x65,0x08,0xE9,
+   0x00,0x03,0x10,0x69,0x0C,0xE5,0x00,0x03,0x10,0x66,0x0D,0xE9,0x00,0xE6,0x00,0x68,
+   0x08,0xE9,0x00,0x69,0x03,0xE8,0x00,0x68,0x08,0x03,0x1D,0xF5,0x2E,0x67,0x08,0x08,
+   0x00,0x41,0x8B,0x81,0x00,0x34,0x3C,0x34,0x41,0x01,0x43,0x00,0x80,0x18,0x34,0x44,
+   0x06,0x01,0x01,0x02,0x00,0x0E,0x81,0xD4,0x0F,0xFF,0x3A,0x00
 };
 #endif
 #if INCLUDE_FAHRENHEIT_HEX_DATA
 const char hex_fahrenheit[] PROGMEM = {
-   0x02,0x00,0x00,0x04,0x00,0x00,0xFA,
-   0x10,0x00,0x00,0x00,0x00,0x00,0x8D,0x31,0x9A,0x2D,0xFF,0x34,0x8A,0x01,0x20,0x00,0x0B,0x1D,0x37,0x28,0x06,
-   0x10,0x00,0x10,0x00,0x22,0x00,0x8C,0x10,0x21,0x00,0x38,0x08,0x03,0x19,0x17,0x28,0x03,0x10,0x21,0x00,0x32,
-   0x10,0x00,0x20,0x00,0xB7,0x0C,0x82,0x30,0x20,0x00,0x95,0x00,0x21,0x00,0xB8,0x01,0x2C,0x28,0x21,0x00,0x57,
-   0x10,0x00,0x30,0x00,0x37,0x08,0x21,0x00,0x35,0x05,0x20,0x00,0xBB,0x00,0x3B,0x08,0x03,0x19,0x24,0x28,0xA0,
-   0x10,0x00,0x40,0x00,0xC1,0x30,0x20,0x00,0x95,0x00,0x27,0x28,0x43,0x30,0x20,0x00,0x95,0x00,0x22,0x00,0x71,
-   0x10,0x00,0x50,0x00,0x8C,0x14,0x01,0x30,0x21,0x00,0xB8,0x00,0x00,0x30,0x21,0x00,0x37,0x04,0x03,0x1D,0x4A,
-   0x10,0x00,0x60,0x00,0x35,0x28,0x21,0x00,0x95,0x16,0x20,0x00,0x8B,0x12,0x20,0x00,0x0B,0x11,0x20,0x00,0x4E,
-   0x10,0x00,0x70,0x00,0x91,0x1C,0x73,0x28,0x03,0x10,0x22,0x00,0x0D,0x0D,0x20,0x00,0xBB,0x00,0x3B,0x08,0xCB,
-   0x10,0x00,0x80,0x00,0x03,0x1D,0x44,0x28,0x10,0x30,0xBB,0x00,0x21,0x00,0x8E,0x01,0x22,0x00,0x8D,0x01,0x89,
-   0x10,0x00,0x90,0x00,0x20,0x00,0x3B,0x08,0x10,0x3A,0x03,0x19,0x5A,0x28,0x3B,0x08,0x20,0x3A,0x03,0x19,0x5C,
-   0x10,0x00,0xA0,0x00,0x5F,0x28,0x3B,0x08,0x40,0x3A,0x03,0x19,0x64,0x28,0x3B,0x08,0x80,0x3A,0x03,0x19,0x4B,
-   0x10,0x00,0xB0,0x00,0x69,0x28,0x6D,0x28,0x21,0x00,0x30,0x08,0x22,0x00,0x8E,0x00,0x6D,0x28,0x21,0x00,0x5B,
-   0x10,0x00,0xC0,0x00,0x31,0x08,0x22,0x00,0x8E,0x00,0x6D,0x28,0x21,0x00,0x32,0x08,0x22,0x00,0x8E,0x00,0xA7,
-   0x10,0x00,0xD0,0x00,0x6D,0x28,0x21,0x00,0x33,0x08,0x22,0x00,0x8E,0x00,0x20,0x00,0x3B,0x08,0x22,0x00,0xFA,
-   0x10,0x00,0xE0,0x00,0x8D,0x00,0x20,0x00,0x91,0x10,0x09,0x00,0x20,0x00,0xBE,0x01,0xBF,0x01,0xC0,0x01,0x59,
-   0x10,0x00,0xF0,0x00,0x80,0x30,0xC1,0x00,0x6A,0x30,0x21,0x00,0x99,0x00,0x0C,0x30,0x8C,0x00,0x22,0x00,0x51,
-   0x10,0x01,0x00,0x00,0x8C,0x01,0x21,0x00,0x8D,0x01,0x22,0x00,0x8D,0x01,0x21,0x00,0x8E,0x01,0x04,0x30,0x1F,
-   0x10,0x01,0x10,0x00,0x23,0x00,0x8C,0x00,0x21,0x00,0x1E,0x16,0x9E,0x17,0x23,0x00,0x8E,0x01,0x05,0x30,0x3F,
-   0x10,0x01,0x20,0x00,0x20,0x00,0x9C,0x00,0xFA,0x30,0x9B,0x00,0x21,0x00,0x91,0x14,0x72,0x30,0x28,0x00,0xBE,
-   0x10,0x01,0x30,0x00,0x97,0x00,0x7F,0x30,0xA0,0x27,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0xA8,0x00,0x1B,
-   0x10,0x01,0x40,0x00,0x28,0x0C,0x03,0x18,0xA5,0x28,0x28,0x00,0x17,0x11,0x03,0x1C,0xA9,0x28,0x28,0x00,0x2B,
-   0x10,0x01,0x50,0x00,0x17,0x15,0xFA,0x30,0x28,0x00,0x96,0x00,0x37,0x30,0x9E,0x00,0xFA,0x30,0x9D,0x00,0xBF,
-   0x10,0x01,0x60,0x00,0x72,0x30,0xA0,0x27,0x20,0x00,0xEB,0x00,0x77,0x08,0xEA,0x00,0xC0,0x30,0x20,0x00,0xA2,
-   0x10,0x01,0x70,0x00,0x8B,0x00,0x21,0x00,0x95,0x11,0x15,0x10,0x95,0x14,0x15,0x11,0x09,0x30,0x9D,0x00,0x63,
-   0x10,0x01,0x80,0x00,0x06,0x30,0x21,0x00,0x36,0x02,0x03,0x18,0x6C,0x29,0x21,0x00,0x37,0x08,0x03,0x1D,0xB0,
-   0x10,0x01,0x90,0x00,0x6C,0x29,0x21,0x00,0x36,0x08,0x03,0x1D,0xD1,0x28,0xFF,0x30,0x21,0x00,0xB5,0x00,0x4D,
-   0x10,0x01,0xA0,0x00,0x41,0x29,0x21,0x00,0x36,0x08,0x01,0x3A,0x03,0x1D,0xDC,0x28,0x45,0x30,0x21,0x00,0x91,
-   0x10,0x01,0xB0,0x00,0xB5,0x00,0x20,0x00,0xC9,0x01,0x41,0x29,0x21,0x00,0x36,0x08,0x02,0x3A,0x03,0x1D,0x7B,
-   0x10,0x01,0xC0,0x00,0x08,0x29,0x75,0x30,0xA0,0x27,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0xA8,0x00,0xFB,
-   0x10,0x01,0xD0,0x00,0x28,0x0E,0xF0,0x39,0xA9,0x00,0x20,0x00,0x6C,0x08,0x20,0x00,0xCA,0x00,0x20,0x00,0x79,
-   0x10,0x01,0xE0,0x00,0x6D,0x08,0x20,0x00,0xCB,0x00,0x20,0x00,0xA8,0x00,0xAB,0x01,0xA8,0x1B,0xAB,0x03,0xCA,
-   0x10,0x01,0xF0,0x00,0x0F,0x30,0xA8,0x05,0xAB,0x01,0x29,0x08,0xAA,0x00,0xAC,0x01,0x28,0x08,0x2A,0x04,0x81,
-   0x10,0x02,0x00,0x00,0xA9,0x00,0x2B,0x08,0x2C,0x04,0xAD,0x00,0x29,0x08,0x21,0x00,0xB5,0x00,0x41,0x29,0xC4,
-   0x10,0x02,0x10,0x00,0x21,0x00,0x36,0x08,0x03,0x3A,0x03,0x1D,0x12,0x29,0x20,0x00,0x4A,0x08,0x21,0x00,0x54,
-   0x10,0x02,0x20,0x00,0xB5,0x00,0x41,0x29,0x21,0x00,0x36,0x08,0x04,0x3A,0x03,0x1D,0x38,0x29,0x20,0x00,0x71,
-   0x10,0x02,0x30,0x00,0xA9,0x01,0x22,0x00,0x8C,0x1E,0x1E,0x29,0x20,0x00,0xA9,0x0A,0x20,0x00,0x29,0x0E,0xD7,
-   0x10,0x02,0x40,0x00,0xF0,0x39,0xA8,0x00,0x03,0x10,0xA8,0x0D,0x03,0x10,0xA8,0x0D,0xA9,0x01,0x22,0x00,0x81,
-   0x10,0x02,0x50,0x00,0x0C,0x1E,0x2C,0x29,0x20,0x00,0xA9,0x0A,0x20,0x00,0x29,0x0E,0xF0,0x39,0xAB,0x00,0x21,
-   0x10,0x02,0x60,0x00,0x28,0x08,0xA9,0x00,0x2B,0x08,0xA8,0x00,0x29,0x04,0x21,0x00,0xB5,0x00,0x41,0x29,0x6D,
-   0x10,0x02,0x70,0x00,0x21,0x00,0x36,0x08,0x05,0x3A,0x03,0x1D,0x41,0x29,0x20,0x00,0x49,0x08,0x21,0x00,0xC4,
-   0x10,0x02,0x80,0x00,0xB5,0x00,0x21,0x00,0x35,0x08,0x20,0x00,0xA9,0x00,0x08,0x30,0xA8,0x00,0x20,0x00,0x92,
-   0x10,0x02,0x90,0x00,0x28,0x08,0xAB,0x00,0xA8,0x03,0x2B,0x08,0x03,0x19,0x63,0x29,0x29,0x08,0x20,0x00,0xAC,
-   0x10,0x02,0xA0,0x00,0x49,0x06,0x20,0x00,0xAB,0x00,0x80,0x30,0xAB,0x05,0x03,0x10,0x20,0x00,0xC9,0x0D,0xCB,
-   0x10,0x02,0xB0,0x00,0x20,0x00,0x2B,0x08,0x03,0x19,0x5F,0x29,0x31,0x30,0x20,0x00,0xC9,0x06,0x03,0x10,0xE4,
-   0x10,0x02,0xC0,0x00,0x20,0x00,0xA9,0x0D,0x47,0x29,0x80,0x30,0x21,0x00,0xB7,0x00,0x20,0x00,0x8B,0x16,0x9F,
-   0x10,0x02,0xD0,0x00,0x21,0x00,0x95,0x12,0x21,0x00,0xB6,0x0A,0x20,0x00,0x93,0x1D,0x82,0x29,0x88,0x31,0x41,
-   0x10,0x02,0xE0,0x00,0x00,0x20,0x81,0x31,0x28,0x00,0x17,0x19,0x80,0x29,0xFF,0x30,0x21,0x00,0xB3,0x00,0x38,
-   0x10,0x02,0xF0,0x00,0x03,0x30,0x21,0x00,0xB0,0x00,0x59,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,0xB1,0x00,0xCC,
-   0x10,0x03,0x00,0x00,0x20,0x00,0x93,0x11,0x20,0x00,0x93,0x1C,0x1A,0x2E,0x20,0x00,0xBE,0x0A,0x03,0x19,0x0E,
-   0x10,0x03,0x10,0x00,0xBF,0x0A,0x3E,0x1C,0xD1,0x29,0x40,0x08,0xF7,0x00,0x41,0x08,0x20,0x00,0xA0,0x00,0x78,
-   0x10,0x03,0x20,0x00,0x77,0x08,0xA1,0x00,0x21,0x00,0x9D,0x14,0x21,0x00,0x9D,0x18,0x94,0x29,0x1D,0x10,0x1B,
-   0x10,0x03,0x30,0x00,0x20,0x00,0x21,0x0E,0x0F,0x39,0xA2,0x00,0x20,0x0E,0xA3,0x00,0xF0,0x39,0xA2,0x04,0xE4,
-   0x10,0x03,0x40,0x00,0xA3,0x06,0x03,0x10,0xA3,0x0C,0xA2,0x0C,0x03,0x10,0xA3,0x0C,0xA2,0x0C,0x22,0x08,0xFA,
-   0x10,0x03,0x50,0x00,0xA1,0x02,0x23,0x08,0x03,0x1C,0x23,0x0F,0xA0,0x02,0x21,0x00,0x1C,0x08,0x20,0x00,0x77,
-   0x10,0x03,0x60,0x00,0xA2,0x00,0xA3,0x01,0x22,0x08,0xA4,0x00,0xA6,0x01,0x21,0x00,0x1B,0x08,0x20,0x00,0x6E,
-   0x10,0x03,0x70,0x00,0xA2,0x00,0xA3,0x01,0x22,0x08,0xA6,0x04,0x23,0x08,0xA4,0x04,0x26,0x08,0xA2,0x00,0xC0,
-   0x10,0x03,0x80,0x00,0x24,0x08,0xA3,0x00,0x22,0x08,0xA1,0x07,0x23,0x08,0x03,0x18,0x23,0x0F,0xA0,0x07,0xAD,
-   0x10,0x03,0x90,0x00,0x21,0x08,0xF7,0x00,0x20,0x08,0xC1,0x00,0x77,0x08,0xC0,0x00,0x09,0x30,0x21,0x00,0xBB,
-   0x10,0x03,0xA0,0x00,0x9D,0x00,0x20,0x00,0x3E,0x08,0x0F,0x39,0x03,0x1D,0x18,0x2E,0x40,0x08,0xF7,0x00,0x5D,
-   0x10,0x03,0xB0,0x00,0x41,0x08,0x20,0x00,0xA0,0x00,0x77,0x08,0xA1,0x00,0x20,0x30,0xA2,0x00,0xA3,0x01,0x7E,
-   0x10,0x03,0xC0,0x00,0xA4,0x01,0xA6,0x01,0x21,0x0E,0x0F,0x39,0xA5,0x00,0x20,0x0E,0xA7,0x00,0xF0,0x39,0xC7,
-   0x10,0x03,0xD0,0x00,0xA5,0x04,0xA7,0x06,0x03,0x10,0xA7,0x0C,0xA5,0x0C,0x3F,0x30,0xA5,0x05,0xA7,0x01,0x8F,
-   0x10,0x03,0xE0,0x00,0x25,0x08,0xA9,0x00,0x03,0x10,0x20,0x0C,0xA5,0x00,0xA7,0x01,0x03,0x10,0xA7,0x0C,0xE5,
-   0x10,0x03,0xF0,0x00,0xA5,0x0C,0x03,0x10,0xA7,0x0C,0xA5,0x0C,0x1F,0x30,0xA5,0x05,0xA7,0x01,0x25,0x08,0x07,
-   0x10,0x04,0x00,0x00,0xA8,0x00,0x20,0x08,0xA5,0x00,0xA7,0x01,0x25,0x08,0xA1,0x00,0xF8,0x30,0x21,0x02,0xB6,
-   0x10,0x04,0x10,0x00,0x03,0x18,0x0E,0x2A,0x09,0x30,0x21,0x02,0x03,0x18,0x10,0x2A,0x21,0x00,0x34,0x14,0x6F,
-   0x10,0x04,0x20,0x00,0x20,0x00,0x28,0x0A,0xA1,0x00,0x02,0x30,0xF7,0x00,0x21,0x08,0x8E,0x31,0xEE,0x26,0xB4,
-   0x10,0x04,0x30,0x00,0x82,0x31,0x20,0x00,0xA0,0x00,0xA5,0x01,0x20,0x08,0x82,0x3E,0xA0,0x00,0x8E,0x30,0x5D,
-   0x10,0x04,0x40,0x00,0xA1,0x00,0x25,0x08,0x03,0x18,0x25,0x0F,0xA1,0x07,0x02,0x30,0xF7,0x00,0x28,0x08,0x8E,
-   0x10,0x04,0x50,0x00,0x8E,0x31,0xEE,0x26,0x82,0x31,0x20,0x00,0xA5,0x00,0xA7,0x01,0x25,0x08,0x82,0x3E,0xBC,
-   0x10,0x04,0x60,0x00,0xA5,0x00,0x27,0x08,0x03,0x18,0x27,0x0F,0x8E,0x3E,0xA7,0x00,0xA8,0x01,0x20,0x00,0x2B,
-   0x10,0x04,0x70,0x00,0x29,0x08,0x28,0x02,0x03,0x1C,0x5F,0x2A,0x25,0x08,0xF6,0x00,0x27,0x08,0xF7,0x00,0x30,
-   0x10,0x04,0x80,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x82,0x31,0x20,0x00,0xAB,0x00,0x77,0x08,0xAA,0x00,0x5D,
-   0x10,0x04,0x90,0x00,0xAC,0x00,0x2B,0x08,0xAD,0x00,0x00,0x30,0xAD,0x1B,0xFF,0x30,0xBD,0x00,0xBC,0x00,0x30,
-   0x10,0x04,0xA0,0x00,0x2C,0x08,0xA2,0x07,0x2D,0x08,0x03,0x18,0x2D,0x0F,0xA3,0x07,0x3C,0x08,0x03,0x18,0xDA,
-   0x10,0x04,0xB0,0x00,0x3C,0x0F,0xA4,0x07,0x3D,0x08,0x03,0x18,0x3D,0x0F,0xA6,0x07,0x82,0x2A,0x20,0x00,0x21,
-   0x10,0x04,0xC0,0x00,0x20,0x08,0xF6,0x00,0x21,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x82,0x31,0xD3,
-   0x10,0x04,0xD0,0x00,0x20,0x00,0xAB,0x00,0x77,0x08,0xAA,0x00,0xAC,0x00,0x2B,0x08,0xAD,0x00,0x00,0x30,0x6C,
-   0x10,0x04,0xE0,0x00,0xAD,0x1B,0xFF,0x30,0xBD,0x00,0xBC,0x00,0x2C,0x08,0xA2,0x07,0x2D,0x08,0x03,0x18,0x6F,
-   0x10,0x04,0xF0,0x00,0x2D,0x0F,0xA3,0x07,0x3C,0x08,0x03,0x18,0x3C,0x0F,0xA4,0x07,0x3D,0x08,0x03,0x18,0x61,
-   0x10,0x05,0x00,0x00,0x3D,0x0F,0xA6,0x07,0x20,0x00,0xA8,0x0A,0x40,0x30,0x28,0x02,0x03,0x1C,0x37,0x2A,0x06,
-   0x10,0x05,0x10,0x00,0x22,0x0E,0x0F,0x39,0xA1,0x00,0x23,0x0E,0xA0,0x00,0xF0,0x39,0xA1,0x04,0xA0,0x06,0x7D,
-   0x10,0x05,0x20,0x00,0x24,0x0E,0xA5,0x00,0xF0,0x39,0xA0,0x04,0xA5,0x06,0x26,0x0E,0xA7,0x00,0xF0,0x39,0x78,
-   0x10,0x05,0x30,0x00,0xA5,0x04,0xA7,0x06,0xF0,0x30,0xA7,0x19,0xA7,0x04,0x03,0x10,0xA7,0x1B,0x03,0x14,0xEE,
-   0x10,0x05,0x40,0x00,0xA7,0x0C,0xA5,0x0C,0xA0,0x0C,0xA1,0x0C,0x03,0x10,0xA7,0x1B,0x03,0x14,0xA7,0x0C,0x4F,
-   0x10,0x05,0x50,0x00,0xA5,0x0C,0xA0,0x0C,0xA1,0x0C,0x21,0x08,0xA2,0x00,0x20,0x08,0xA3,0x00,0x22,0x08,0xD1,
-   0x10,0x05,0x60,0x00,0xF7,0x00,0x23,0x08,0xC3,0x00,0x77,0x08,0xC2,0x00,0x74,0x30,0xA0,0x27,0x20,0x00,0xDA,
-   0x10,0x05,0x70,0x00,0xC5,0x00,0x77,0x08,0xC4,0x00,0x42,0x08,0xC6,0x00,0x43,0x08,0xC7,0x00,0x44,0x08,0x05,
-   0x10,0x05,0x80,0x00,0x46,0x07,0x20,0x00,0xEC,0x00,0x20,0x00,0x47,0x08,0x20,0x00,0xED,0x00,0x20,0x00,0x76,
-   0x10,0x05,0x90,0x00,0x45,0x08,0x03,0x18,0x45,0x0A,0x03,0x19,0xCF,0x2A,0x20,0x00,0xED,0x07,0x03,0x30,0x48,
-   0x10,0x05,0xA0,0x00,0x21,0x00,0x39,0x02,0x03,0x18,0xD6,0x2A,0x21,0x00,0xB6,0x01,0x21,0x00,0x39,0x08,0x9A,
-   0x10,0x05,0xB0,0x00,0x03,0x1D,0xDC,0x2A,0x30,0x30,0xB9,0x00,0x21,0x00,0xB9,0x03,0x21,0x00,0x34,0x1C,0xAE,
-   0x10,0x05,0xC0,0x00,0xE4,0x2A,0x22,0x00,0x0C,0x14,0xE6,0x2A,0x22,0x00,0x0C,0x10,0x21,0x00,0x34,0x10,0x28,
-   0x10,0x05,0xD0,0x00,0x22,0x00,0x0C,0x1C,0x05,0x2B,0x20,0x00,0x99,0x1F,0xF9,0x2A,0x11,0x30,0x21,0x00,0x44,
-   0x10,0x05,0xE0,0x00,0xB0,0x00,0xCB,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,0x6B,
-   0x10,0x05,0xF0,0x00,0xB3,0x00,0x22,0x00,0x0C,0x12,0x8C,0x12,0x3C,0x30,0x21,0x00,0xAE,0x00,0xAF,0x01,0x7F,
-   0x10,0x06,0x00,0x00,0x3C,0x30,0x21,0x00,0xAC,0x00,0xAD,0x01,0x18,0x2E,0x7C,0x30,0xA0,0x27,0x20,0x00,0x2A,
-   0x10,0x06,0x10,0x00,0xC3,0x00,0x77,0x08,0xC2,0x00,0xC4,0x00,0x06,0x30,0x44,0x02,0x03,0x18,0x30,0x2C,0x1F,
-   0x10,0x06,0x20,0x00,0x21,0x00,0x33,0x13,0x03,0x30,0x20,0x00,0x3F,0x02,0x03,0x1D,0x19,0x2B,0xE8,0x30,0x53,
-   0x10,0x06,0x30,0x00,0x3E,0x02,0x03,0x1C,0x35,0x2C,0x7C,0x30,0xA0,0x27,0x20,0x00,0xAC,0x00,0x77,0x08,0x3C,
-   0x10,0x06,0x40,0x00,0xAD,0x00,0xBD,0x00,0x06,0x30,0x3D,0x02,0x03,0x18,0x2B,0x2C,0x77,0x30,0xA0,0x27,0xEB,
-   0x10,0x06,0x50,0x00,0x20,0x00,0xAC,0x00,0x77,0x08,0xAD,0x00,0xBC,0x00,0x20,0x00,0xEE,0x0A,0x03,0x19,0xB2,
-   0x10,0x06,0x60,0x00,0xEF,0x0A,0x09,0x30,0x20,0x00,0x3C,0x02,0x03,0x1C,0x38,0x2B,0x08,0x30,0xBC,0x00,0x84,
-   0x10,0x06,0x70,0x00,0x13,0x30,0xF7,0x00,0x20,0x00,0x3D,0x08,0x8E,0x31,0xEE,0x26,0x83,0x31,0x20,0x00,0x34,
-   0x10,0x06,0x80,0x00,0xAD,0x00,0x03,0x10,0x3C,0x0D,0xBD,0x00,0xAD,0x07,0x2D,0x0A,0xAC,0x00,0xA0,0x27,0x46,
-   0x10,0x06,0x90,0x00,0x20,0x00,0xBD,0x00,0x77,0x08,0xAC,0x00,0x02,0x30,0x2D,0x07,0xAE,0x00,0xA0,0x27,0x77,
-   0x10,0x06,0xA0,0x00,0x20,0x00,0xAF,0x00,0x77,0x08,0xAE,0x00,0x3D,0x08,0x20,0x00,0x6F,0x02,0x03,0x1D,0x58,
-   0x10,0x06,0xB0,0x00,0x5D,0x2B,0x20,0x00,0x2C,0x08,0x20,0x00,0x6E,0x02,0x03,0x1C,0x94,0x2B,0x20,0x00,0xD0,
-   0x10,0x06,0xC0,0x00,0x2E,0x08,0x20,0x00,0xEA,0x00,0x20,0x00,0x2F,0x08,0x20,0x00,0xEB,0x00,0x20,0x00,0x68,
-   0x10,0x06,0xD0,0x00,0x2E,0x08,0xF6,0x00,0x2F,0x08,0xF7,0x00,0x72,0x30,0x63,0x27,0x20,0x00,0x3C,0x08,0x30,
-   0x10,0x06,0xE0,0x00,0x08,0x3A,0x03,0x19,0x7E,0x2B,0x03,0x30,0x2D,0x07,0xB0,0x00,0xA0,0x27,0x20,0x00,0x05,
-   0x10,0x06,0xF0,0x00,0xB1,0x00,0x77,0x08,0xB0,0x00,0x31,0x04,0x03,0x1D,0x85,0x2B,0x06,0x30,0xF6,0x00,0xE9,
-   0x10,0x07,0x00,0x00,0x00,0x30,0xF7,0x00,0x7C,0x30,0x63,0x27,0x2B,0x2C,0x20,0x00,0xEE,0x01,0xEF,0x01,0x36,
-   0x10,0x07,0x10,0x00,0x20,0x00,0xBC,0x0A,0x3C,0x08,0xB0,0x00,0xB1,0x01,0x30,0x08,0xF6,0x00,0x31,0x08,0xE6,
-   0x10,0x07,0x20,0x00,0xF7,0x00,0x77,0x30,0x63,0x27,0x2B,0x2C,0x7B,0x30,0xA0,0x27,0x20,0x00,0xB0,0x00,0x08,
-   0x10,0x07,0x30,0x00,0x77,0x08,0xBC,0x00,0x30,0x04,0x03,0x19,0x2B,0x2C,0x2D,0x08,0xA0,0x27,0x20,0x00,0xBB,
-   0x10,0x07,0x40,0x00,0xBC,0x00,0x77,0x08,0xAD,0x00,0x20,0x00,0x6F,0x0E,0xF0,0x39,0x20,0x00,0xB1,0x00,0x2A,
-   0x10,0x07,0x50,0x00,0x20,0x00,0x6E,0x0E,0x20,0x00,0xB0,0x00,0x0F,0x39,0xB1,0x04,0xB0,0x06,0x03,0x10,0x67,
-   0x10,0x07,0x60,0x00,0xB0,0x0D,0xB1,0x0D,0x03,0x10,0xB0,0x0D,0xB1,0x0D,0x20,0x30,0xB2,0x00,0xB3,0x01,0xCA,
-   0x10,0x07,0x70,0x00,0xB4,0x01,0xB5,0x01,0xB6,0x01,0x20,0x00,0x3D,0x08,0x31,0x02,0x03,0x1D,0xC2,0x2B,0xB2,
-   0x10,0x07,0x80,0x00,0x2C,0x08,0x30,0x02,0x03,0x1C,0xE3,0x2B,0x20,0x00,0x2C,0x08,0xB0,0x02,0x3D,0x08,0x8B,
-   0x10,0x07,0x90,0x00,0x03,0x1C,0x3D,0x0F,0xB1,0x02,0x2E,0x08,0xB7,0x00,0x2F,0x08,0xB8,0x00,0x00,0x30,0x2F,
-   0x10,0x07,0xA0,0x00,0xB8,0x1B,0xFF,0x30,0xBA,0x00,0xB9,0x00,0x37,0x08,0xB2,0x07,0x38,0x08,0x03,0x18,0x81,
-   0x10,0x07,0xB0,0x00,0x38,0x0F,0xB3,0x07,0x39,0x08,0x03,0x18,0x39,0x0F,0xB4,0x07,0x3A,0x08,0x03,0x18,0x7C,
-   0x10,0x07,0xC0,0x00,0x3A,0x0F,0xB5,0x07,0xFB,0x2B,0x20,0x00,0x2D,0x08,0xB7,0x00,0x3C,0x08,0xB8,0x00,0xF6,
-   0x10,0x07,0xD0,0x00,0x00,0x30,0xB8,0x1B,0xFF,0x30,0xBA,0x00,0xB9,0x00,0x37,0x08,0xB2,0x07,0x38,0x08,0x3C,
-   0x10,0x07,0xE0,0x00,0x03,0x18,0x38,0x0F,0xB3,0x07,0x39,0x08,0x03,0x18,0x39,0x0F,0xB4,0x07,0x3A,0x08,0x4C,
-   0x10,0x07,0xF0,0x00,0x03,0x18,0x3A,0x0F,0xB5,0x07,0x20,0x00,0xB6,0x0A,0x40,0x30,0x36,0x02,0x03,0x1C,0x32,
-   0x10,0x08,0x00,0x00,0xBB,0x2B,0x32,0x0E,0x0F,0x39,0xB2,0x00,0x33,0x0E,0xB3,0x00,0xF0,0x39,0xB2,0x04,0xF5,
-   0x10,0x08,0x10,0x00,0xB3,0x06,0x34,0x0E,0xB4,0x00,0xF0,0x39,0xB3,0x04,0xB4,0x06,0x35,0x0E,0xB5,0x00,0x97,
-   0x10,0x08,0x20,0x00,0xF0,0x39,0xB4,0x04,0xB5,0x06,0xF0,0x30,0xB5,0x19,0xB5,0x04,0x03,0x10,0xB5,0x1B,0xA2,
-   0x10,0x08,0x30,0x00,0x03,0x14,0xB5,0x0C,0xB4,0x0C,0xB3,0x0C,0xB2,0x0C,0x03,0x10,0xB5,0x1B,0x03,0x14,0xA9,
-   0x10,0x08,0x40,0x00,0xB5,0x0C,0xB4,0x0C,0xB3,0x0C,0xB2,0x0C,0x32,0x08,0x20,0x00,0xEA,0x00,0x20,0x00,0x46,
-   0x10,0x08,0x50,0x00,0x33,0x08,0x20,0x00,0xEB,0x00,0x08,0x30,0x20,0x00,0xBE,0x00,0xBF,0x01,0x35,0x2C,0x1B,
-   0x10,0x08,0x60,0x00,0x21,0x00,0x33,0x17,0x20,0x00,0xBE,0x01,0xBF,0x01,0x76,0x30,0xA0,0x27,0x20,0x00,0xF1,
-   0x10,0x08,0x70,0x00,0xC3,0x00,0x77,0x08,0xC2,0x00,0x43,0x04,0x03,0x19,0x9D,0x2C,0x20,0x00,0x6A,0x08,0xB6,
-   0x10,0x08,0x80,0x00,0x20,0x00,0x6C,0x02,0x20,0x00,0xC4,0x00,0x20,0x00,0x6B,0x08,0x03,0x1C,0x6B,0x0A,0xCF,
-   0x10,0x08,0x90,0x00,0x20,0x00,0x6D,0x02,0x20,0x00,0xC5,0x00,0x03,0x14,0xC5,0x1F,0x03,0x10,0x03,0x1C,0xB7,
-   0x10,0x08,0xA0,0x00,0x56,0x2C,0xC4,0x09,0xC5,0x09,0xC4,0x0A,0x03,0x19,0xC5,0x0A,0x03,0x14,0x20,0x00,0x3B,
-   0x10,0x08,0xB0,0x00,0xC3,0x1F,0x03,0x10,0x03,0x1C,0x7F,0x2C,0xC2,0x09,0xC3,0x09,0xC2,0x0A,0x03,0x19,0xFA,
-   0x10,0x08,0xC0,0x00,0xC3,0x0A,0x43,0x08,0x80,0x3E,0xC8,0x00,0x45,0x08,0x80,0x3E,0x48,0x02,0x03,0x1D,0x15,
-   0x10,0x08,0xD0,0x00,0x6B,0x2C,0x44,0x08,0x42,0x02,0x20,0x00,0xC6,0x01,0x03,0x1C,0x46,0x14,0x46,0x08,0x43,
-   0x10,0x08,0xE0,0x00,0x00,0x30,0x03,0x19,0x01,0x30,0xC7,0x00,0xC6,0x00,0x46,0x0C,0x03,0x18,0x7A,0x2C,0xEB,
-   0x10,0x08,0xF0,0x00,0x22,0x00,0x0C,0x10,0x03,0x1C,0x7E,0x2C,0x22,0x00,0x0C,0x14,0x9D,0x2C,0x20,0x00,0xC6,
-   0x10,0x09,0x00,0x00,0x45,0x08,0x80,0x3E,0xC8,0x00,0x43,0x08,0x80,0x3E,0x48,0x02,0x03,0x1D,0x8A,0x2C,0xEB,
-   0x10,0x09,0x10,0x00,0x42,0x08,0x44,0x02,0x20,0x00,0xC6,0x01,0x03,0x1C,0x46,0x14,0x46,0x08,0x00,0x30,0x69,
-   0x10,0x09,0x20,0x00,0x03,0x19,0x01,0x30,0xC2,0x00,0xC6,0x00,0x46,0x0C,0x03,0x18,0x99,0x2C,0x22,0x00,0x9E,
-   0x10,0x09,0x30,0x00,0x0C,0x10,0x03,0x1C,0x9D,0x2C,0x22,0x00,0x0C,0x14,0x21,0x00,0x2C,0x08,0x2D,0x04,0xEB,
-   0x10,0x09,0x40,0x00,0x03,0x19,0xA6,0x2C,0xFF,0x30,0xAC,0x07,0x03,0x1C,0xAD,0x03,0x21,0x00,0x2E,0x08,0xB1,
-   0x10,0x09,0x50,0x00,0x2F,0x04,0x03,0x19,0xAF,0x2C,0xFF,0x30,0xAE,0x07,0x03,0x1C,0xAF,0x03,0x20,0x00,0x98,
-   0x10,0x09,0x60,0x00,0xA7,0x01,0x22,0x00,0x0C,0x1E,0xB6,0x2C,0x20,0x00,0xA7,0x0A,0x20,0x00,0x27,0x08,0x91,
-   0x10,0x09,0x70,0x00,0x00,0x30,0x03,0x19,0x01,0x30,0xA9,0x00,0xA7,0x00,0x27,0x0C,0x03,0x18,0xC2,0x2C,0x6E,
-   0x10,0x09,0x80,0x00,0x21,0x00,0xB3,0x13,0x03,0x1C,0xC6,0x2C,0x21,0x00,0xB3,0x17,0x20,0x00,0xA7,0x01,0xBC,
-   0x10,0x09,0x90,0x00,0x22,0x00,0x8C,0x1E,0xCD,0x2C,0x20,0x00,0xA7,0x0A,0x20,0x00,0x27,0x08,0x00,0x30,0x42,
-   0x10,0x09,0xA0,0x00,0x03,0x19,0x01,0x30,0xA9,0x00,0xA7,0x00,0x27,0x0C,0x03,0x18,0xD9,0x2C,0x21,0x00,0x36,
-   0x10,0x09,0xB0,0x00,0xB3,0x11,0x03,0x1C,0xDD,0x2C,0x21,0x00,0xB3,0x15,0x22,0x00,0x0C,0x1E,0xF2,0x2C,0xF8,
-   0x10,0x09,0xC0,0x00,0x20,0x00,0x6B,0x08,0x80,0x3E,0x20,0x00,0xA8,0x00,0x20,0x00,0x6D,0x08,0x80,0x3E,0xBB,
-   0x10,0x09,0xD0,0x00,0x20,0x00,0x28,0x02,0x03,0x1D,0xF0,0x2C,0x20,0x00,0x6C,0x08,0x20,0x00,0x6A,0x02,0x71,
-   0x10,0x09,0xE0,0x00,0x03,0x18,0x07,0x2D,0x22,0x00,0x8C,0x1E,0x65,0x2D,0x20,0x00,0x6D,0x08,0x80,0x3E,0x07,
-   0x10,0x09,0xF0,0x00,0x20,0x00,0xA8,0x00,0x20,0x00,0x6B,0x08,0x80,0x3E,0x20,0x00,0x28,0x02,0x03,0x1D,0x74,
-   0x10,0x0A,0x00,0x00,0x05,0x2D,0x20,0x00,0x6A,0x08,0x20,0x00,0x6C,0x02,0x03,0x1C,0x65,0x2D,0x79,0x30,0x3A,
-   0x10,0x0A,0x10,0x00,0xA0,0x27,0x20,0x00,0xA9,0x00,0x77,0x08,0xA7,0x00,0x29,0x0E,0xF0,0x39,0x21,0x00,0x9F,
-   0x10,0x0A,0x20,0x00,0xAD,0x00,0x20,0x00,0x27,0x0E,0x21,0x00,0xAC,0x00,0x0F,0x39,0xAD,0x04,0xAC,0x06,0x4C,
-   0x10,0x0A,0x30,0x00,0x03,0x10,0xAC,0x0D,0xAD,0x0D,0x03,0x10,0xAC,0x0D,0xAD,0x0D,0x2C,0x0E,0x0F,0x39,0x28,
-   0x10,0x0A,0x40,0x00,0x20,0x00,0xA7,0x00,0x21,0x00,0x2D,0x0E,0x20,0x00,0xA9,0x00,0xF0,0x39,0xA7,0x04,0xE6,
-   0x10,0x0A,0x50,0x00,0xA9,0x06,0x27,0x08,0x21,0x00,0xAC,0x02,0x20,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x46,
-   0x10,0x0A,0x60,0x00,0x03,0x19,0x34,0x2D,0x21,0x00,0xAD,0x02,0x7A,0x30,0xA0,0x27,0x20,0x00,0xA9,0x00,0xFF,
-   0x10,0x0A,0x70,0x00,0x77,0x08,0xA7,0x00,0x29,0x0E,0xF0,0x39,0x21,0x00,0xAF,0x00,0x20,0x00,0x27,0x0E,0xCB,
-   0x10,0x0A,0x80,0x00,0x21,0x00,0xAE,0x00,0x0F,0x39,0xAF,0x04,0xAE,0x06,0x03,0x10,0xAE,0x0D,0xAF,0x0D,0x5E,
-   0x10,0x0A,0x90,0x00,0x03,0x10,0xAE,0x0D,0xAF,0x0D,0x2E,0x0E,0x0F,0x39,0x20,0x00,0xA7,0x00,0x21,0x00,0x60,
-   0x10,0x0A,0xA0,0x00,0x2F,0x0E,0x20,0x00,0xA9,0x00,0xF0,0x39,0xA7,0x04,0xA9,0x06,0x27,0x08,0x21,0x00,0x6D,
-   0x10,0x0A,0xB0,0x00,0xAE,0x02,0x20,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x03,0x19,0x61,0x2D,0x21,0x00,0x18,
-   0x10,0x0A,0xC0,0x00,0xAF,0x02,0x22,0x00,0x0C,0x12,0x8C,0x12,0xE7,0x2D,0x22,0x00,0x0C,0x1A,0xE7,0x2D,0x27,
-   0x10,0x0A,0xD0,0x00,0x8C,0x1A,0xE7,0x2D,0x73,0x30,0xA0,0x27,0x20,0x00,0xA9,0x00,0x77,0x08,0xA7,0x00,0x03,
-   0x10,0x0A,0xE0,0x00,0x20,0x00,0x6A,0x07,0x20,0x00,0xA8,0x00,0x20,0x00,0x6B,0x08,0x20,0x00,0xAB,0x00,0x4F,
-   0x10,0x0A,0xF0,0x00,0x29,0x08,0x03,0x18,0x29,0x0F,0xAB,0x07,0x2B,0x08,0x80,0x3E,0xAA,0x00,0x20,0x00,0x05,
-   0x10,0x0B,0x00,0x00,0x6D,0x08,0x80,0x3E,0x20,0x00,0x2A,0x02,0x03,0x1D,0x8A,0x2D,0x20,0x00,0x6C,0x08,0xFB,
-   0x10,0x0B,0x10,0x00,0x20,0x00,0x28,0x02,0x03,0x18,0xAC,0x2D,0x21,0x00,0x2C,0x08,0x2D,0x04,0x03,0x19,0xF5,
-   0x10,0x0B,0x20,0x00,0xA9,0x2D,0x20,0x00,0xA8,0x01,0x21,0x00,0xB3,0x1F,0x98,0x2D,0x20,0x00,0xA8,0x0A,0x9C,
-   0x10,0x0B,0x30,0x00,0x21,0x00,0x2C,0x08,0x01,0x39,0x20,0x00,0xAB,0x00,0xAA,0x00,0xA8,0x06,0x28,0x0C,0xCF,
-   0x10,0x0B,0x40,0x00,0x03,0x18,0xA4,0x2D,0x21,0x00,0xB3,0x13,0x03,0x1C,0xA8,0x2D,0x21,0x00,0xB3,0x17,0xF3,
-   0x10,0x0B,0x50,0x00,0xE7,0x2D,0x22,0x00,0x0C,0x16,0xE7,0x2D,0x20,0x00,0x27,0x08,0x20,0x00,0x6A,0x02,0x4E,
-   0x10,0x0B,0x60,0x00,0x20,0x00,0xA7,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x20,0x00,0x6B,0x02,0x20,0x00,0x8E,
-   0x10,0x0B,0x70,0x00,0xA9,0x00,0x20,0x00,0x6D,0x08,0x80,0x3E,0x20,0x00,0xAC,0x00,0x29,0x08,0x80,0x3E,0xBE,
-   0x10,0x0B,0x80,0x00,0x2C,0x02,0x03,0x1D,0xC6,0x2D,0x27,0x08,0x20,0x00,0x6C,0x02,0x03,0x18,0xE7,0x2D,0x38,
-   0x10,0x0B,0x90,0x00,0x21,0x00,0x2E,0x08,0x2F,0x04,0x03,0x19,0xE5,0x2D,0x20,0x00,0xA7,0x01,0x21,0x00,0xB4,
-   0x10,0x0B,0xA0,0x00,0xB3,0x1D,0xD4,0x2D,0x20,0x00,0xA7,0x0A,0x21,0x00,0x2E,0x08,0x01,0x39,0x20,0x00,0xF2,
-   0x10,0x0B,0xB0,0x00,0xA9,0x00,0xA8,0x00,0xA7,0x06,0x27,0x0C,0x03,0x18,0xE0,0x2D,0x21,0x00,0xB3,0x11,0xF7,
-   0x10,0x0B,0xC0,0x00,0x03,0x1C,0xE4,0x2D,0x21,0x00,0xB3,0x15,0xE7,0x2D,0x22,0x00,0x8C,0x16,0x20,0x00,0x14,
-   0x10,0x0B,0xD0,0x00,0x99,0x1F,0x18,0x2E,0x22,0x00,0x0C,0x1C,0xFA,0x2D,0x23,0x00,0x1D,0x1F,0xFA,0x2D,0x20,
-   0x10,0x0B,0xE0,0x00,0x61,0x30,0x21,0x00,0xB0,0x00,0x11,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0x40,
-   0x10,0x0B,0xF0,0x00,0xB2,0x00,0x01,0x2E,0x01,0x30,0xF6,0x00,0x20,0x00,0x6C,0x08,0xF7,0x00,0x6D,0x08,0xED,
-   0x10,0x0C,0x00,0x00,0x1D,0x26,0x20,0x00,0xC2,0x01,0x23,0x00,0x1D,0x1F,0x08,0x2E,0x20,0x00,0xC2,0x0A,0x3D,
-   0x10,0x0C,0x10,0x00,0x20,0x00,0x42,0x08,0x00,0x30,0x03,0x19,0x01,0x30,0xC4,0x00,0xC2,0x00,0x42,0x0C,0x19,
-   0x10,0x0C,0x20,0x00,0x03,0x18,0x14,0x2E,0x23,0x00,0x1D,0x13,0x03,0x1C,0x18,0x2E,0x23,0x00,0x1D,0x17,0x58,
-   0x10,0x0C,0x30,0x00,0x20,0x00,0x93,0x10,0x64,0x00,0xC0,0x28,0x08,0x00,0x20,0x00,0xA9,0x00,0x77,0x08,0x55,
-   0x10,0x0C,0x40,0x00,0xA8,0x00,0x76,0x08,0xAB,0x00,0x03,0x14,0xA9,0x1F,0x03,0x10,0x03,0x1C,0x31,0x2E,0x63,
-   0x10,0x0C,0x50,0x00,0x21,0x00,0x33,0x12,0x20,0x00,0xA8,0x09,0xA9,0x09,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0x2A,
-   0x10,0x0C,0x60,0x00,0x33,0x2E,0x21,0x00,0x33,0x16,0x20,0x00,0x2B,0x08,0x01,0x3A,0x03,0x1D,0x3C,0x2E,0xA1,
-   0x10,0x0C,0x70,0x00,0x21,0x00,0xB3,0x12,0x33,0x15,0x3F,0x2E,0x21,0x00,0xB3,0x16,0x33,0x15,0x20,0x00,0x87,
-   0x10,0x0C,0x80,0x00,0x29,0x08,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x47,0x2E,0xE8,0x30,0x28,0x02,0x03,0x1C,0xC4,
-   0x10,0x0C,0x90,0x00,0x57,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,0x08,0xAC,0x00,0x2A,0x08,0xF7,0x00,0xCF,
-   0x10,0x0C,0xA0,0x00,0x2C,0x08,0xFA,0x26,0x20,0x00,0xA9,0x00,0x77,0x08,0xA8,0x00,0xAB,0x01,0x20,0x00,0x34,
-   0x10,0x0C,0xB0,0x00,0x29,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x5F,0x2E,0x64,0x30,0x28,0x02,0x03,0x1C,0xFD,
-   0x10,0x0C,0xC0,0x00,0x93,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,0x08,0xAC,0x00,0xAD,0x01,0x20,0x00,0xBE,
-   0x10,0x0C,0xD0,0x00,0x2C,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x6F,0x2E,0x64,0x30,0x2A,0x02,0x03,0x1C,0xC8,
-   0x10,0x0C,0xE0,0x00,0x78,0x2E,0x9C,0x30,0x20,0x00,0xAA,0x07,0x03,0x1C,0xAC,0x03,0xAD,0x0A,0x67,0x2E,0xA7,
-   0x10,0x0C,0xF0,0x00,0x20,0x00,0x2A,0x08,0xA8,0x00,0x2C,0x08,0xA9,0x00,0x0F,0x30,0xAD,0x05,0x2D,0x08,0xF7,
-   0x10,0x0D,0x00,0x00,0xF6,0x3E,0xAD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xAA,0x00,0x2D,0x08,0xF6,0x00,0x1C,
-   0x10,0x0D,0x10,0x00,0x2A,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x20,0x00,0xAC,0x00,0xD1,
-   0x10,0x0D,0x20,0x00,0x21,0x00,0xB0,0x00,0x96,0x2E,0xFF,0x30,0x21,0x00,0xB0,0x00,0x20,0x00,0x29,0x08,0xDD,
-   0x10,0x0D,0x30,0x00,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x9E,0x2E,0x0A,0x30,0x28,0x02,0x03,0x18,0xAB,0x2E,0xF3,
-   0x10,0x0D,0x40,0x00,0x20,0x00,0x2B,0x08,0x03,0x1D,0xAB,0x2E,0x21,0x00,0x30,0x08,0x20,0x00,0xAA,0x00,0x34,
-   0x10,0x0D,0x50,0x00,0xFF,0x3A,0x03,0x19,0xE1,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,0x08,0xAC,0x00,0x58,
-   0x10,0x0D,0x60,0x00,0xAD,0x01,0x20,0x00,0x2C,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0xB9,0x2E,0x0A,0x30,0xC4,
-   0x10,0x0D,0x70,0x00,0x2A,0x02,0x03,0x1C,0xC2,0x2E,0xF6,0x30,0x20,0x00,0xAA,0x07,0x03,0x1C,0xAC,0x03,0x73,
-   0x10,0x0D,0x80,0x00,0xAD,0x0A,0xB1,0x2E,0x20,0x00,0x2A,0x08,0xA8,0x00,0x2C,0x08,0xA9,0x00,0x2D,0x08,0xC1,
-   0x10,0x0D,0x90,0x00,0xF6,0x3E,0xAD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xAA,0x00,0x2D,0x08,0xF6,0x00,0x8C,
-   0x10,0x0D,0xA0,0x00,0x2A,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x20,0x00,0xAC,0x00,0x41,
-   0x10,0x0D,0xB0,0x00,0x21,0x00,0xB1,0x00,0x20,0x00,0x2B,0x08,0x03,0x19,0xE4,0x2E,0x21,0x00,0x31,0x10,0x7E,
-   0x10,0x0D,0xC0,0x00,0xE4,0x2E,0xFF,0x30,0x21,0x00,0xB1,0x00,0x20,0x00,0x28,0x08,0xAB,0x00,0xF6,0x3E,0xE1,
-   0x10,0x0D,0xD0,0x00,0xA8,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xA9,0x00,0x28,0x08,0xF6,0x00,0x29,0x08,0x5A,
-   0x10,0x0D,0xE0,0x00,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x20,0x00,0xAB,0x00,0x21,0x00,0x13,
-   0x10,0x0D,0xF0,0x00,0xB2,0x00,0x08,0x00,0x20,0x00,0xA0,0x00,0x77,0x08,0xA1,0x00,0x03,0x10,0x20,0x0C,0x1A,
-   0x10,0x0E,0x00,0x00,0xA2,0x00,0x21,0x0C,0xA3,0x00,0x03,0x10,0x20,0x0C,0xA4,0x00,0x21,0x0C,0xA6,0x00,0xBA,
-   0x10,0x0E,0x10,0x00,0x03,0x10,0xA4,0x0C,0xA6,0x0C,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0x0B,
-   0x10,0x0E,0x20,0x00,0xA2,0x07,0x23,0x0E,0x0F,0x39,0xA6,0x00,0x22,0x0E,0xA4,0x00,0xF0,0x39,0xA6,0x04,0x53,
-   0x10,0x0E,0x30,0x00,0xA4,0x06,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,0x07,0x22,0x08,0xE3,
-   0x10,0x0E,0x40,0x00,0xA6,0x00,0xA4,0x01,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,0x07,0x5C,
-   0x10,0x0E,0x50,0x00,0x03,0x10,0xA2,0x0C,0xA3,0x0C,0x03,0x10,0xA2,0x0C,0xA3,0x0C,0x03,0x10,0xA2,0x0C,0xF1,
-   0x10,0x0E,0x60,0x00,0xA3,0x0C,0x03,0x10,0x23,0x0D,0xA6,0x00,0x22,0x0D,0xA4,0x00,0x03,0x10,0xA6,0x0D,0x51,
-   0x10,0x0E,0x70,0x00,0xA4,0x0D,0x03,0x10,0xA6,0x0D,0xA4,0x0D,0x03,0x10,0x23,0x0D,0xA5,0x00,0x22,0x0D,0x33,
-   0x10,0x0E,0x80,0x00,0xA7,0x00,0x25,0x08,0xA6,0x07,0x27,0x08,0x03,0x18,0x27,0x0F,0xA4,0x07,0x26,0x08,0x88,
-   0x10,0x0E,0x90,0x00,0xA1,0x02,0x24,0x08,0x03,0x1C,0x24,0x0F,0xA0,0x02,0x06,0x30,0xA1,0x07,0x03,0x18,0x96,
-   0x10,0x0E,0xA0,0x00,0xA0,0x0A,0x21,0x0E,0x0F,0x39,0xA6,0x00,0x20,0x0E,0xA4,0x00,0xF0,0x39,0xA6,0x04,0xD6,
-   0x10,0x0E,0xB0,0x00,0xA4,0x06,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,0x07,0x23,0x08,0x62,
-   0x10,0x0E,0xC0,0x00,0xF7,0x00,0x22,0x08,0x08,0x00,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0x76,0x08,0x8C,
-   0x10,0x0E,0xD0,0x00,0xA8,0x00,0x27,0x08,0xA0,0x27,0x20,0x00,0xAB,0x00,0x77,0x08,0xAA,0x00,0x28,0x06,0x52,
-   0x10,0x0E,0xE0,0x00,0x03,0x1D,0x76,0x2F,0x2B,0x08,0x29,0x06,0x03,0x19,0x9F,0x2F,0x03,0x10,0x20,0x00,0xBE,
-   0x10,0x0E,0xF0,0x00,0x27,0x0D,0xAA,0x00,0x20,0x00,0x2A,0x08,0x23,0x00,0x91,0x00,0x20,0x00,0x28,0x08,0xBE,
-   0x10,0x0F,0x00,0x00,0x23,0x00,0x93,0x00,0x15,0x13,0x95,0x13,0x15,0x15,0x20,0x00,0x8B,0x13,0x55,0x30,0xEE,
-   0x10,0x0F,0x10,0x00,0x23,0x00,0x96,0x00,0xAA,0x30,0x96,0x00,0x95,0x14,0x20,0x00,0x8B,0x17,0x23,0x00,0x1A,
-   0x10,0x0F,0x20,0x00,0x15,0x11,0x23,0x00,0x95,0x18,0x91,0x2F,0x20,0x00,0x12,0x12,0x20,0x00,0x29,0x08,0x76,
-   0x10,0x0F,0x30,0x00,0xA8,0x00,0xA9,0x01,0x2A,0x08,0xA7,0x00,0xAA,0x0A,0x27,0x1C,0x7A,0x2F,0x08,0x00,0xDE,
-   0x10,0x0F,0x40,0x00,0x20,0x00,0xA0,0x00,0xA1,0x01,0xA2,0x01,0x03,0x10,0x20,0x0D,0xA3,0x00,0x20,0x00,0x99,
-   0x10,0x0F,0x50,0x00,0x23,0x08,0x23,0x00,0x91,0x00,0x15,0x13,0x95,0x13,0x15,0x14,0x13,0x08,0x20,0x00,0x7E,
-   0x10,0x0F,0x60,0x00,0xA0,0x00,0xA4,0x01,0x20,0x08,0xA6,0x00,0xA5,0x01,0x22,0x08,0xA0,0x00,0xA4,0x01,0x59,
-   0x10,0x0F,0x70,0x00,0x20,0x08,0x25,0x04,0xA1,0x00,0x24,0x08,0x26,0x04,0xA2,0x00,0x23,0x08,0xA0,0x00,0xBC,
-   0x10,0x0F,0x80,0x00,0xA3,0x0A,0x20,0x1C,0xA7,0x2F,0x21,0x08,0xF7,0x00,0x22,0x08,0x08,0x00,0x00,0x3A,0x16,
-   0x10,0x0F,0x90,0x00,0x03,0x19,0xCE,0x2F,0x80,0x3A,0x03,0x19,0xD4,0x2F,0x00,0x34,0x76,0x08,0x84,0x00,0x29,
-   0x10,0x0F,0xA0,0x00,0x77,0x08,0x85,0x00,0x00,0x08,0x08,0x00,0x77,0x08,0x8A,0x00,0x76,0x08,0x82,0x00,0x24,
-   0x10,0x0F,0xB0,0x00,0x08,0x00,0x00,0x3A,0x03,0x19,0xE1,0x2F,0x80,0x3A,0x03,0x19,0xE9,0x2F,0xF7,0x01,0xDD,
-   0x10,0x0F,0xC0,0x00,0x00,0x34,0x76,0x08,0x84,0x00,0x77,0x08,0x85,0x00,0x12,0x00,0xF7,0x00,0x00,0x08,0xD6,
-   0x10,0x0F,0xD0,0x00,0x08,0x00,0x87,0x31,0xD4,0x27,0xF5,0x00,0xF6,0x0F,0xF7,0x03,0xF7,0x0A,0x87,0x31,0xA9,
-   0x10,0x0F,0xE0,0x00,0xD4,0x27,0xF4,0x00,0x75,0x08,0xF7,0x00,0x74,0x08,0x08,0x00,0x03,0x34,0xB7,0x34,0xF8,
-   0x10,0x0F,0xF0,0x00,0x0D,0x34,0x25,0x34,0xB1,0x34,0x61,0x34,0x41,0x34,0x37,0x34,0x01,0x34,0x21,0x34,0x73,
-   0x10,0x10,0x00,0x00,0x20,0x00,0x8B,0x13,0x22,0x00,0x0D,0x08,0x20,0x00,0xDD,0x00,0x21,0x00,0x0E,0x08,0xB7,
-   0x10,0x10,0x10,0x00,0x20,0x00,0xDE,0x00,0x22,0x00,0x8D,0x01,0xD8,0x30,0x21,0x00,0x8E,0x00,0x03,0x10,0x58,
-   0x10,0x10,0x20,0x00,0x21,0x00,0x3E,0x0D,0x20,0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x8E,0x1F,0x1A,0x28,0x65,
-   0x10,0x10,0x30,0x00,0x20,0x00,0xE0,0x0A,0x20,0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x92,
-   0x10,0x10,0x40,0x00,0x21,0x00,0xBE,0x00,0x03,0x10,0x3E,0x0D,0x20,0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x63,
-   0x10,0x10,0x50,0x00,0x0E,0x1E,0x2C,0x28,0x20,0x00,0xE0,0x0A,0x20,0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0x36,
-   0x10,0x10,0x60,0x00,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x03,0x10,0x3E,0x0D,0x20,0x00,0xDF,0x00,0x00,
-   0x10,0x10,0x70,0x00,0xE0,0x01,0x20,0x00,0x0E,0x1F,0x3E,0x28,0x20,0x00,0xE0,0x0A,0x20,0x00,0x5F,0x08,0x4B,
-   0x10,0x10,0x80,0x00,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x03,0x10,0x3E,0x0D,0x96,
-   0x10,0x10,0x90,0x00,0x20,0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x8E,0x1D,0x50,0x28,0x20,0x00,0xE0,0x0A,0x23,
-   0x10,0x10,0xA0,0x00,0x20,0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x4D,
-   0x10,0x10,0xB0,0x00,0x20,0x00,0x5D,0x08,0x22,0x00,0x8D,0x00,0x20,0x00,0x5E,0x08,0x21,0x00,0x8E,0x00,0xC7,
-   0x10,0x10,0xC0,0x00,0x20,0x00,0x8B,0x17,0x21,0x00,0x3D,0x08,0x03,0x1D,0xBD,0x03,0x0F,0x30,0x21,0x00,0xB8,
-   0x10,0x10,0xD0,0x00,0x3A,0x02,0x03,0x18,0x59,0x2C,0x88,0x30,0x8A,0x00,0x72,0x30,0x3A,0x07,0x03,0x18,0xF4,
-   0x10,0x10,0xE0,0x00,0x8A,0x0A,0x82,0x00,0x81,0x28,0xD3,0x28,0xEB,0x28,0xFF,0x28,0x25,0x29,0xEC,0x2B,0xA7,
-   0x10,0x10,0xF0,0x00,0xA8,0x2B,0x09,0x2C,0x15,0x2C,0x59,0x2C,0x59,0x2C,0x49,0x29,0xE2,0x29,0x78,0x2A,0x7E,
-   0x10,0x11,0x00,0x00,0xE0,0x2A,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x08,0x3A,0x03,0x1D,0x5A,
-   0x10,0x11,0x10,0x00,0x90,0x28,0x1B,0x30,0x21,0x00,0xBD,0x00,0x06,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x56,
-   0x10,0x11,0x20,0x00,0x00,0x30,0x21,0x00,0x3E,0x04,0x03,0x19,0x5B,0x2C,0x7F,0x30,0x87,0x31,0xA0,0x27,0x5B,
-   0x10,0x11,0x30,0x00,0x88,0x31,0x20,0x00,0xDE,0x00,0x77,0x08,0xDD,0x00,0x5E,0x04,0x03,0x19,0x5B,0x2C,0x97,
-   0x10,0x11,0x40,0x00,0x33,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x03,0x3A,0x03,0x1D,0xAC,0x28,0xAA,
-   0x10,0x11,0x50,0x00,0x01,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x22,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0x26,
-   0x10,0x11,0x60,0x00,0xDD,0x00,0x02,0x3A,0x03,0x1D,0xB8,0x28,0x02,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0xD2,
-   0x10,0x11,0x70,0x00,0x11,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x01,0x3A,0x03,0x1D,0xC7,0x28,0x83,
-   0x10,0x11,0x80,0x00,0x0D,0x30,0x21,0x00,0xBD,0x00,0x03,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x44,0x30,0x3B,
-   0x10,0x11,0x90,0x00,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x07,0x30,0x96,
-   0x10,0x11,0xA0,0x00,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0xF6,0x00,0x6D,0x30,0xF7,0x00,0x00,0x30,0xF3,
-   0x10,0x11,0xB0,0x00,0x86,0x31,0x1D,0x26,0x88,0x31,0x21,0x00,0x30,0x10,0x21,0x00,0xB3,0x16,0x33,0x15,0xE9,
-   0x10,0x11,0xC0,0x00,0x33,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x33,0x3A,0x03,0x19,0x5B,0x2C,0x4B,
-   0x10,0x11,0xD0,0x00,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x01,0x30,0xF6,0x00,0x20,0x00,0x6A,0x08,0xF7,0x00,0xFC,
-   0x10,0x11,0xE0,0x00,0x6B,0x08,0x86,0x31,0x1D,0x26,0x88,0x31,0x22,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0x03,
-   0x10,0x11,0xF0,0x00,0xDD,0x00,0x22,0x3A,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x7C,0x30,0x04,
-   0x10,0x12,0x00,0x00,0x87,0x31,0xA0,0x27,0x89,0x31,0x20,0x00,0xDF,0x00,0x77,0x08,0xDD,0x00,0xE0,0x00,0x6A,
-   0x10,0x12,0x10,0x00,0x00,0x30,0xF7,0x00,0x60,0x08,0x6D,0x24,0x06,0x30,0x20,0x00,0x60,0x02,0x03,0x18,0xDB,
-   0x10,0x12,0x20,0x00,0x1A,0x29,0x21,0x00,0x3D,0x08,0x03,0x1D,0x1A,0x29,0x11,0x30,0xBD,0x00,0x04,0x30,0x80,
-   0x10,0x12,0x30,0x00,0x21,0x00,0xBA,0x00,0x11,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,0x3A,0xE6,
-   0x10,0x12,0x40,0x00,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x77,0x30,0x87,0x31,0xA0,0x27,0x72,
-   0x10,0x12,0x50,0x00,0x89,0x31,0x20,0x00,0xDF,0x00,0x77,0x08,0xDD,0x00,0x00,0x30,0xF6,0x00,0x5D,0x08,0xEE,
-   0x10,0x12,0x60,0x00,0xF7,0x00,0x5F,0x08,0x86,0x31,0x1D,0x26,0x89,0x31,0x21,0x00,0x3D,0x08,0x03,0x1D,0xE6,
-   0x10,0x12,0x70,0x00,0x3E,0x29,0x0D,0x30,0xBD,0x00,0x05,0x30,0x21,0x00,0xBA,0x00,0x11,0x30,0x21,0x00,0x9B,
-   0x10,0x12,0x80,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,0x3A,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x54,
-   0x10,0x12,0x90,0x00,0x5B,0x2C,0x21,0x00,0x33,0x16,0xB3,0x16,0x33,0x15,0x06,0x30,0x21,0x00,0x3B,0x02,0xB8,
-   0x10,0x12,0xA0,0x00,0x03,0x18,0x7A,0x29,0x21,0x00,0x3C,0x1C,0x5C,0x29,0x85,0x30,0x21,0x00,0xB0,0x00,0xFC,
-   0x10,0x12,0xB0,0x00,0xD1,0x30,0x21,0x00,0xB1,0x00,0x62,0x29,0x61,0x30,0x21,0x00,0xB0,0x00,0x19,0x30,0x25,
-   0x10,0x12,0xC0,0x00,0x21,0x00,0xB1,0x00,0x03,0x10,0x21,0x00,0x3C,0x0C,0x20,0x00,0xDD,0x00,0xF6,0x3E,0x9F,
-   0x10,0x12,0xD0,0x00,0xDD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xDF,0x00,0x5D,0x08,0xF6,0x00,0x5F,0x08,0x7F,
-   0x10,0x12,0xE0,0x00,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xE0,0x00,0x21,0x00,0xD6,
-   0x10,0x12,0xF0,0x00,0xB2,0x00,0xDB,0x29,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,0xD5,
-   0x10,0x13,0x00,0x00,0x89,0x31,0x20,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x9D,
-   0x10,0x13,0x10,0x00,0x03,0x18,0x5F,0x0F,0x8E,0x3E,0xDF,0x00,0x5D,0x08,0xF6,0x00,0x5F,0x08,0xF7,0x00,0xE0,
-   0x10,0x13,0x20,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xE0,0x00,0x21,0x00,0xB0,0x00,0xDC,
-   0x10,0x13,0x30,0x00,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,0x89,0x31,0x20,0x00,0x70,
-   0x10,0x13,0x40,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x03,0x18,0x5F,0x0F,0xAE,
-   0x10,0x13,0x50,0x00,0x8E,0x3E,0xDF,0x00,0xDD,0x0A,0x03,0x19,0xDF,0x0A,0x5D,0x08,0xF6,0x00,0x5F,0x08,0x34,
-   0x10,0x13,0x60,0x00,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xE0,0x00,0x21,0x00,0x55,
-   0x10,0x13,0x70,0x00,0xB1,0x00,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,0x89,0x31,0x9F,
-   0x10,0x13,0x80,0x00,0x20,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x03,0x18,0xBC,
-   0x10,0x13,0x90,0x00,0x5F,0x0F,0x8E,0x3E,0xDF,0x00,0x02,0x30,0xDD,0x07,0x03,0x18,0xDF,0x0A,0x5D,0x08,0xB5,
-   0x10,0x13,0xA0,0x00,0xF6,0x00,0x5F,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x89,0x31,0x20,0x00,0xB9,
-   0x10,0x13,0xB0,0x00,0xE0,0x00,0x21,0x00,0xB2,0x00,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0C,0x30,0x21,0x00,0xA1,
-   0x10,0x13,0xC0,0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3D,0x04,0x03,0x1D,0xEA,0x29,0x21,0x00,0xF6,
-   0x10,0x13,0xD0,0x00,0xBA,0x01,0x5B,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x80,0x3A,0xF8,
-   0x10,0x13,0xE0,0x00,0x03,0x1D,0xF6,0x29,0x07,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x22,0x30,0x21,0x00,0xB2,
-   0x10,0x13,0xF0,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x20,0x3A,0x03,0x1D,0x17,0x2A,0x21,0x00,0xBC,0x0A,0x0B,
-   0x10,0x14,0x00,0x00,0x06,0x30,0x21,0x00,0x3B,0x02,0x03,0x18,0x0C,0x2A,0x13,0x30,0x21,0x00,0x3C,0x02,0x55,
-   0x10,0x14,0x10,0x00,0x03,0x1C,0x13,0x2A,0xBC,0x01,0x13,0x2A,0x0B,0x30,0x21,0x00,0x3C,0x02,0x03,0x1C,0xBD,
-   0x10,0x14,0x20,0x00,0x35,0x2A,0xBC,0x01,0x35,0x2A,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x11,0x30,0x63,
-   0x10,0x14,0x30,0x00,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x10,0x3A,0x03,0x1D,0x48,0x2A,0x21,0x00,0x4E,
-   0x10,0x14,0x40,0x00,0xBC,0x03,0x06,0x30,0x21,0x00,0x3B,0x02,0x03,0x18,0x2E,0x2A,0x13,0x30,0x21,0x00,0x72,
-   0x10,0x14,0x50,0x00,0x3C,0x02,0x03,0x1C,0x44,0x2A,0x12,0x30,0xBC,0x00,0x44,0x2A,0x0B,0x30,0x21,0x00,0xF9,
-   0x10,0x14,0x60,0x00,0x3C,0x02,0x03,0x1C,0x35,0x2A,0x0A,0x30,0xBC,0x00,0x21,0x00,0x3C,0x08,0x05,0x3A,0x26,
-   0x10,0x14,0x70,0x00,0x03,0x1D,0x3D,0x2A,0xBC,0x0A,0xBC,0x0A,0x44,0x2A,0x21,0x00,0x3C,0x08,0x06,0x3A,0x46,
-   0x10,0x14,0x80,0x00,0x03,0x1D,0x44,0x2A,0xFE,0x30,0xBC,0x07,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x40,
-   0x10,0x14,0x90,0x00,0x44,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x56,
-   0x10,0x14,0xA0,0x00,0x13,0x30,0xF7,0x00,0x21,0x00,0x3B,0x08,0x8E,0x31,0xEE,0x26,0x8A,0x31,0x20,0x00,0xF0,
-   0x10,0x14,0xB0,0x00,0xDD,0x00,0x21,0x00,0x3C,0x08,0x20,0x00,0xDD,0x07,0x5D,0x08,0x87,0x31,0xA0,0x27,0x02,
-   0x10,0x14,0xC0,0x00,0x8A,0x31,0x20,0x00,0xE4,0x00,0x77,0x08,0xE3,0x00,0x20,0x00,0x5D,0x08,0xF6,0x00,0x80,
-   0x10,0x14,0xD0,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0xAD,0x24,0x20,0x00,0xE4,0x00,0x77,0x08,0xCA,
-   0x10,0x14,0xE0,0x00,0xE3,0x00,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0D,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0xFE,
-   0x10,0x14,0xF0,0x00,0x06,0x30,0x21,0x00,0x3B,0x02,0x03,0x18,0x94,0x2A,0x21,0x00,0x3C,0x1C,0x8A,0x2A,0x52,
-   0x10,0x15,0x00,0x00,0x00,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0x86,0x31,0x1D,0x26,0xCD,
-   0x10,0x15,0x10,0x00,0x8A,0x31,0xD9,0x2A,0x01,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0xF8,
-   0x10,0x15,0x20,0x00,0x86,0x31,0x1D,0x26,0x8A,0x31,0xD9,0x2A,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x73,
-   0x10,0x15,0x30,0x00,0x8E,0x31,0xEE,0x26,0x8A,0x31,0x20,0x00,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDB,
-   0x10,0x15,0x40,0x00,0xDD,0x00,0x5F,0x08,0x03,0x18,0x5F,0x0F,0x8E,0x3E,0xDF,0x00,0x03,0x30,0xDD,0x07,0x0C,
-   0x10,0x15,0x50,0x00,0x03,0x18,0xDF,0x0A,0x5D,0x08,0xF6,0x00,0x5F,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0x66,
-   0x10,0x15,0x60,0x00,0xC7,0x27,0x8A,0x31,0x20,0x00,0xE0,0x00,0x04,0x30,0x60,0x02,0x03,0x18,0xC2,0x2A,0x35,
-   0x10,0x15,0x70,0x00,0x01,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0x86,0x31,0x1D,0x26,0x5C,
-   0x10,0x15,0x80,0x00,0x8A,0x31,0xD9,0x2A,0x20,0x00,0x60,0x08,0x07,0x3A,0x03,0x1D,0xD0,0x2A,0x20,0x00,0x9A,
-   0x10,0x15,0x90,0x00,0x63,0x08,0x20,0x00,0xDD,0x00,0x00,0x30,0xF7,0x00,0x5D,0x08,0x6D,0x24,0xD9,0x2A,0xC3,
-   0x10,0x15,0xA0,0x00,0x00,0x30,0xF6,0x00,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0x86,0x31,0x1D,0x26,0x2D,
-   0x10,0x15,0xB0,0x00,0x8A,0x31,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0E,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x54,
-   0x10,0x15,0xC0,0x00,0x13,0x30,0xF7,0x00,0x21,0x00,0x3B,0x08,0x8E,0x31,0xEE,0x26,0x8A,0x31,0x20,0x00,0xCF,
-   0x10,0x15,0xD0,0x00,0xDD,0x00,0x21,0x00,0x3C,0x08,0x20,0x00,0xDD,0x07,0x21,0x00,0x3D,0x08,0x03,0x1D,0x3F,
-   0x10,0x15,0xE0,0x00,0xF4,0x2A,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0x3E,
-   0x10,0x15,0xF0,0x00,0xDF,0x00,0x80,0x3A,0x03,0x1D,0x00,0x2B,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x6A,
-   0x10,0x16,0x00,0x00,0x21,0x00,0xBE,0x1E,0x16,0x2B,0x20,0x00,0xE3,0x0A,0x03,0x19,0xE4,0x0A,0x64,0x08,0x19,
-   0x10,0x16,0x10,0x00,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x0E,0x2B,0xE9,0x30,0x63,0x02,0x03,0x1C,0x2C,0x2B,0x04,
-   0x10,0x16,0x20,0x00,0x09,0x30,0x20,0x00,0xE3,0x07,0x03,0x18,0xE4,0x0A,0x2C,0x2B,0x21,0x00,0x3E,0x1E,0x9A,
-   0x10,0x16,0x30,0x00,0x43,0x2B,0xFF,0x30,0x20,0x00,0xE3,0x07,0x03,0x1C,0xE4,0x03,0x64,0x08,0x80,0x3E,0xD3,
-   0x10,0x16,0x40,0x00,0x7D,0x3E,0x03,0x1D,0x25,0x2B,0xE9,0x30,0x63,0x02,0x03,0x1C,0x2C,0x2B,0xF7,0x30,0x54,
-   0x10,0x16,0x50,0x00,0x20,0x00,0xE3,0x07,0x03,0x1C,0xE4,0x03,0x20,0x00,0x5D,0x08,0xF6,0x00,0x20,0x00,0xDF,
-   0x10,0x16,0x60,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,0xAD,0x24,0x20,0x00,0xE4,0x00,0x77,0x08,0xE3,0x00,0x75,
-   0x10,0x16,0x70,0x00,0x1F,0x30,0x28,0x00,0x1D,0x02,0x03,0x1C,0x3F,0x2B,0xF8,0x30,0x9D,0x07,0x0D,0x30,0x42,
-   0x10,0x16,0x80,0x00,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x44,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDF,0x00,0x21,
-   0x10,0x16,0x90,0x00,0x40,0x3A,0x03,0x1D,0xA4,0x2B,0x21,0x00,0x3B,0x08,0x06,0x3A,0x03,0x1D,0x96,0x2B,0x5C,
-   0x10,0x16,0xA0,0x00,0x21,0x00,0x3C,0x08,0x0A,0x3A,0x03,0x1D,0x96,0x2B,0x00,0x30,0xF6,0x00,0x00,0x30,0x5A,
-   0x10,0x16,0xB0,0x00,0xF7,0x00,0x77,0x30,0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0xEE,0x01,0xEF,0x01,0x8F,
-   0x10,0x16,0xC0,0x00,0x20,0x00,0x64,0x08,0x80,0x3E,0x80,0x3E,0x03,0x1D,0x68,0x2B,0x06,0x30,0x63,0x02,0xC4,
-   0x10,0x16,0xD0,0x00,0x03,0x18,0x96,0x2B,0x20,0x00,0x63,0x08,0x20,0x00,0xDF,0x00,0x13,0x30,0xF7,0x00,0x6A,
-   0x10,0x16,0xE0,0x00,0x5F,0x08,0x8E,0x31,0xEE,0x26,0x8B,0x31,0x20,0x00,0xE0,0x00,0x87,0x31,0xA0,0x27,0x85,
-   0x10,0x16,0xF0,0x00,0x8B,0x31,0x20,0x00,0xEB,0x00,0x77,0x08,0xEA,0x00,0x6A,0x08,0xF6,0x00,0x6B,0x08,0xDF,
-   0x10,0x17,0x00,0x00,0xF7,0x00,0x72,0x30,0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0xE0,0x0A,0x60,0x08,0xD0,
-   0x10,0x17,0x10,0x00,0x87,0x31,0xA0,0x27,0x8B,0x31,0x20,0x00,0xE0,0x00,0x77,0x08,0xDF,0x00,0x60,0x04,0xCC,
-   0x10,0x17,0x20,0x00,0x03,0x1D,0x96,0x2B,0x06,0x30,0x20,0x00,0xE3,0x00,0xE4,0x01,0x20,0x00,0x63,0x08,0x2F,
-   0x10,0x17,0x30,0x00,0xF6,0x00,0x64,0x08,0xF7,0x00,0x20,0x00,0x5D,0x08,0x87,0x31,0x63,0x27,0x8B,0x31,0xCD,
-   0x10,0x17,0x40,0x00,0x0B,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0xFA,0x30,0x28,0x00,0x9D,0x00,0x5B,0x2C,0x86,
-   0x10,0x17,0x50,0x00,0x00,0x30,0x21,0x00,0x3D,0x04,0x03,0x1D,0xE1,0x2B,0x7F,0x30,0x87,0x31,0xA0,0x27,0x9D,
-   0x10,0x17,0x60,0x00,0x8B,0x31,0x20,0x00,0xDF,0x00,0x77,0x08,0xDD,0x00,0xE0,0x00,0x60,0x08,0x00,0x30,0xEA,
-   0x10,0x17,0x70,0x00,0x03,0x19,0x01,0x30,0xDD,0x00,0xE1,0x00,0xE2,0x01,0xE1,0x1B,0xE2,0x03,0x61,0x08,0x31,
-   0x10,0x17,0x80,0x00,0xF6,0x00,0x62,0x08,0xF7,0x00,0x7F,0x30,0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0x35,
-   0x10,0x17,0x90,0x00,0x60,0x08,0x03,0x19,0xD4,0x2B,0x22,0x00,0x0C,0x10,0x0C,0x12,0x8C,0x12,0x28,0x00,0xA4,
-   0x10,0x17,0xA0,0x00,0x17,0x11,0x20,0x00,0x93,0x10,0xDE,0x2B,0x3C,0x30,0x21,0x00,0xAE,0x00,0xAF,0x01,0x5A,
-   0x10,0x17,0xB0,0x00,0x3C,0x30,0x21,0x00,0xAC,0x00,0xAD,0x01,0x28,0x00,0x17,0x15,0x21,0x00,0xBA,0x01,0x12,
-   0x10,0x17,0xC0,0x00,0x5B,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x88,0x3A,0x03,0x19,0x9B,
-   0x10,0x17,0xD0,0x00,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x00,0x30,0xF6,0x00,0x20,0x00,0x6E,0x08,0x63,
-   0x10,0x17,0xE0,0x00,0xF7,0x00,0x6F,0x08,0x86,0x31,0x1D,0x26,0x8B,0x31,0x21,0x00,0x3D,0x08,0x03,0x1D,0x4F,
-   0x10,0x17,0xF0,0x00,0xFE,0x2B,0x0D,0x30,0xBD,0x00,0x03,0x30,0x21,0x00,0xBA,0x00,0x11,0x30,0x21,0x00,0x56,
-   0x10,0x18,0x00,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,0x3A,0x03,0x19,0x5B,0x2C,0x21,0x00,0xBA,0x01,0xCE,
-   0x10,0x18,0x10,0x00,0x5B,0x2C,0x01,0x30,0xF7,0x00,0x21,0x00,0x3B,0x08,0x6D,0x24,0x6E,0x30,0x21,0x00,0x65,
-   0x10,0x18,0x20,0x00,0xBD,0x00,0x08,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3D,0x04,0xCF,
-   0x10,0x18,0x30,0x00,0x03,0x19,0x22,0x2C,0x88,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x80,0x3A,0x6B,
-   0x10,0x18,0x40,0x00,0x03,0x1D,0x25,0x2C,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x22,0x30,0x21,0x00,0x3E,0x05,0x0E,
-   0x10,0x18,0x50,0x00,0x20,0x00,0xDD,0x00,0x20,0x3A,0x03,0x1D,0x37,0x2C,0x21,0x00,0xBB,0x0A,0x07,0x30,0x91,
-   0x10,0x18,0x60,0x00,0x3B,0x02,0x03,0x18,0xBB,0x01,0x07,0x30,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x11,0x30,0x8A,
-   0x10,0x18,0x70,0x00,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x10,0x3A,0x03,0x1D,0x4B,0x2C,0x21,0x00,0x05,
-   0x10,0x18,0x80,0x00,0xBB,0x03,0x07,0x30,0x3B,0x02,0x03,0x1C,0x47,0x2C,0x06,0x30,0xBB,0x00,0x07,0x30,0x6C,
-   0x10,0x18,0x90,0x00,0x21,0x00,0xBA,0x00,0x5B,0x2C,0x44,0x30,0x21,0x00,0x3E,0x05,0x20,0x00,0xDD,0x00,0x11,
-   0x10,0x18,0xA0,0x00,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x21,0x00,0xBC,0x01,0x0B,0x30,0x21,0x00,0xBA,0x00,0x23,
-   0x10,0x18,0xB0,0x00,0x5B,0x2C,0x21,0x00,0xBA,0x01,0x21,0x00,0x3A,0x08,0x00,0x30,0x03,0x19,0x01,0x30,0xE5,
-   0x10,0x18,0xC0,0x00,0x20,0x00,0xDD,0x00,0xE0,0x00,0x60,0x0C,0x03,0x18,0x68,0x2C,0x20,0x00,0x99,0x13,0x54,
-   0x10,0x18,0xD0,0x00,0x03,0x1C,0x6C,0x2C,0x20,0x00,0x99,0x17,0x08,0x00,0x20,0x00,0xCD,0x00,0x77,0x08,0x0D,
-   0x10,0x18,0xE0,0x00,0xCC,0x00,0x21,0x00,0x33,0x16,0xB3,0x16,0x33,0x15,0xB3,0x14,0x06,0x30,0x20,0x00,0x94,
-   0x10,0x18,0xF0,0x00,0x4D,0x02,0x03,0x18,0x94,0x2C,0x19,0x30,0x21,0x00,0xB0,0x00,0xDD,0x30,0x21,0x00,0x76,
-   0x10,0x19,0x00,0x00,0xB1,0x00,0x20,0x00,0x4D,0x08,0xF6,0x3E,0xCD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0x9F,
-   0x10,0x19,0x10,0x00,0xCF,0x00,0x4D,0x08,0xF6,0x00,0x4F,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x09,
-   0x10,0x19,0x20,0x00,0x8C,0x31,0x21,0x00,0xB2,0x00,0xAC,0x2C,0x00,0x30,0x20,0x00,0x4C,0x04,0x03,0x19,0x93,
-   0x10,0x19,0x30,0x00,0xA3,0x2C,0x61,0x30,0x21,0x00,0xB0,0x00,0x09,0x30,0x21,0x00,0xB1,0x00,0xC9,0x30,0x72,
-   0x10,0x19,0x40,0x00,0x21,0x00,0xB2,0x00,0xAC,0x2C,0xC9,0x30,0x21,0x00,0xB0,0x00,0xD1,0x30,0x21,0x00,0x00,
-   0x10,0x19,0x50,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x08,0x00,0x20,0x00,0xD4,0x00,0x77,0x08,0x59,
-   0x10,0x19,0x60,0x00,0xD3,0x00,0x76,0x08,0xD5,0x00,0xD6,0x01,0xD7,0x01,0xE7,0x30,0xD8,0x00,0x03,0x30,0x80,
-   0x10,0x19,0x70,0x00,0xD9,0x00,0x72,0x30,0x55,0x02,0x03,0x18,0xD3,0x2C,0x55,0x08,0xDA,0x00,0x13,0x30,0x01,
-   0x10,0x19,0x80,0x00,0x20,0x00,0x5A,0x02,0x03,0x1C,0xC7,0x2C,0xED,0x30,0xDA,0x07,0xBF,0x2C,0x20,0x00,0xC0,
-   0x10,0x19,0x90,0x00,0x5A,0x18,0x52,0x2D,0x70,0x30,0xD6,0x00,0xFE,0x30,0xD7,0x00,0xC4,0x30,0xD8,0x00,0x0F,
-   0x10,0x19,0xA0,0x00,0x09,0x30,0xD9,0x00,0x52,0x2D,0x8E,0x30,0x20,0x00,0xD5,0x07,0x04,0x30,0xF7,0x00,0xC1,
-   0x10,0x19,0xB0,0x00,0x55,0x08,0x8E,0x31,0xEE,0x26,0x8C,0x31,0x20,0x00,0xDA,0x00,0xDB,0x01,0x5A,0x08,0x02,
-   0x10,0x19,0xC0,0x00,0xC2,0x3E,0xD5,0x00,0x8E,0x30,0xDC,0x00,0x5B,0x08,0x03,0x18,0x5B,0x0F,0xDC,0x07,0xDD,
-   0x10,0x19,0xD0,0x00,0x03,0x30,0xD5,0x07,0x03,0x18,0xDC,0x0A,0x55,0x08,0xF6,0x00,0x5C,0x08,0xF7,0x00,0x49,
-   0x10,0x19,0xE0,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x8C,0x31,0x20,0x00,0xDA,0x00,0x5A,0x08,0x03,0x1D,0x68,
-   0x10,0x19,0xF0,0x00,0x02,0x2D,0x70,0x30,0xD6,0x00,0xFE,0x30,0xD7,0x00,0xC4,0x30,0xD8,0x00,0x09,0x30,0x38,
-   0x10,0x1A,0x00,0x00,0xD9,0x00,0x52,0x2D,0x20,0x00,0x5A,0x08,0x01,0x3A,0x03,0x1D,0x0F,0x2D,0x9C,0x30,0x99,
-   0x10,0x1A,0x10,0x00,0xD6,0x00,0xFF,0x30,0xD7,0x00,0x64,0x30,0xD8,0x00,0xD9,0x01,0x52,0x2D,0x20,0x00,0x05,
-   0x10,0x1A,0x20,0x00,0x5A,0x08,0x09,0x3A,0x03,0x1D,0x18,0x2D,0x01,0x30,0xD8,0x00,0xD9,0x01,0x52,0x2D,0x4A,
-   0x10,0x1A,0x30,0x00,0x20,0x00,0x5A,0x08,0x02,0x3A,0x03,0x1D,0x21,0x2D,0x64,0x30,0xD8,0x00,0xD9,0x01,0x34,
-   0x10,0x1A,0x40,0x00,0x52,0x2D,0x20,0x00,0x5A,0x08,0x04,0x3A,0x03,0x1D,0x2A,0x2D,0x0F,0x30,0xD8,0x00,0xC9,
-   0x10,0x1A,0x50,0x00,0xD9,0x01,0x52,0x2D,0x20,0x00,0x5A,0x08,0x03,0x3A,0x03,0x1D,0x38,0x2D,0xE0,0x30,0xD9,
-   0x10,0x1A,0x60,0x00,0xD6,0x00,0xFC,0x30,0xD7,0x00,0x20,0x30,0xD8,0x00,0x03,0x30,0xD9,0x00,0x52,0x2D,0xEA,
-   0x10,0x1A,0x70,0x00,0x20,0x00,0x5A,0x08,0x05,0x3A,0x03,0x1D,0x41,0x2D,0x08,0x30,0xD8,0x00,0xD9,0x01,0x2D,
-   0x10,0x1A,0x80,0x00,0x52,0x2D,0x20,0x00,0x5A,0x08,0x06,0x3A,0x03,0x1D,0x4A,0x2D,0x3C,0x30,0xD8,0x00,0x3A,
-   0x10,0x1A,0x90,0x00,0xD9,0x01,0x52,0x2D,0x20,0x00,0x5A,0x08,0x07,0x3A,0x03,0x1D,0x52,0x2D,0x06,0x30,0x55,
-   0x10,0x1A,0xA0,0x00,0xD8,0x00,0xD9,0x01,0x20,0x00,0x58,0x08,0xF3,0x00,0x59,0x08,0xF4,0x00,0x56,0x08,0x5E,
-   0x10,0x1A,0xB0,0x00,0xF5,0x00,0x57,0x08,0xF6,0x00,0x53,0x08,0xF7,0x00,0x54,0x08,0x66,0x25,0x20,0x00,0x83,
-   0x10,0x1A,0xC0,0x00,0xD4,0x00,0x77,0x08,0xD3,0x00,0xF7,0x00,0x54,0x08,0x08,0x00,0x20,0x00,0xCD,0x00,0xA8,
-   0x10,0x1A,0xD0,0x00,0x77,0x08,0xCC,0x00,0x76,0x08,0xCF,0x00,0x75,0x08,0xCE,0x00,0x74,0x08,0xD1,0x00,0xD6,
-   0x10,0x1A,0xE0,0x00,0x73,0x08,0xD0,0x00,0x51,0x08,0x80,0x3E,0xD2,0x00,0x4D,0x08,0x80,0x3E,0x52,0x02,0x5B,
-   0x10,0x1A,0xF0,0x00,0x03,0x1D,0x7C,0x2D,0x4C,0x08,0x50,0x02,0x03,0x18,0x83,0x2D,0x20,0x00,0x4E,0x08,0x36,
-   0x10,0x1B,0x00,0x00,0xF7,0x00,0x4F,0x08,0x99,0x2D,0x20,0x00,0x4D,0x08,0x80,0x3E,0xD2,0x00,0x4F,0x08,0x65,
-   0x10,0x1B,0x10,0x00,0x80,0x3E,0x52,0x02,0x03,0x1D,0x8E,0x2D,0x4E,0x08,0x4C,0x02,0x03,0x18,0x95,0x2D,0x57,
-   0x10,0x1B,0x20,0x00,0x20,0x00,0x50,0x08,0xF7,0x00,0x51,0x08,0x99,0x2D,0x20,0x00,0x4C,0x08,0xF7,0x00,0xBC,
-   0x10,0x1B,0x30,0x00,0x4D,0x08,0x08,0x00,0x1A,0x30,0xF6,0x00,0x8E,0x30,0xF7,0x00,0x80,0x30,0x87,0x31,0xEB,
-   0x10,0x1B,0x40,0x00,0xD9,0x27,0x8D,0x31,0x21,0x00,0xA1,0x00,0x77,0x08,0xA0,0x00,0x1C,0x30,0xA2,0x00,0x08,
-   0x10,0x1B,0x50,0x00,0x8E,0x30,0xA3,0x00,0x21,0x00,0x20,0x08,0xA4,0x00,0x21,0x08,0xA5,0x00,0xFF,0x30,0x3A,
-   0x10,0x1B,0x60,0x00,0xA0,0x07,0x03,0x1C,0xA1,0x03,0x24,0x08,0x25,0x04,0x03,0x19,0x17,0x2E,0x04,0x30,0x21,
-   0x10,0x1B,0x70,0x00,0x22,0x07,0xA4,0x00,0xA5,0x01,0xA5,0x0D,0x23,0x08,0xA5,0x07,0x24,0x08,0xF6,0x00,0x47,
-   0x10,0x1B,0x80,0x00,0x25,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x8D,0x31,0x21,0x00,0xA7,0x00,0x43,
-   0x10,0x1B,0x90,0x00,0x77,0x08,0xA6,0x00,0x22,0x08,0xF6,0x00,0x23,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0x76,
-   0x10,0x1B,0xA0,0x00,0xD9,0x27,0x8D,0x31,0x21,0x00,0xA9,0x00,0xA5,0x00,0x77,0x08,0xA8,0x00,0xA4,0x00,0x3D,
-   0x10,0x1B,0xB0,0x00,0x02,0x30,0x22,0x07,0xA4,0x00,0xA5,0x01,0xA5,0x0D,0x23,0x08,0xA5,0x07,0x24,0x08,0xCB,
-   0x10,0x1B,0xC0,0x00,0xF6,0x00,0x25,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD9,0x27,0x8D,0x31,0x21,0x00,0xB4,
-   0x10,0x1B,0xD0,0x00,0xA5,0x00,0xAB,0x00,0x77,0x08,0xA4,0x00,0xAA,0x00,0x21,0x00,0x26,0x08,0xAA,0x00,0xEF,
-   0x10,0x1B,0xE0,0x00,0x27,0x08,0xAB,0x00,0xFF,0x30,0xA6,0x07,0x03,0x1C,0xA7,0x03,0x2A,0x08,0x2B,0x04,0x15,
-   0x10,0x1B,0xF0,0x00,0x03,0x19,0x11,0x2E,0x28,0x08,0xF6,0x00,0x29,0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xD4,
-   0x10,0x1C,0x00,0x00,0xC7,0x27,0x8E,0x31,0x21,0x00,0xAA,0x00,0x24,0x08,0x84,0x00,0x25,0x08,0x85,0x00,0xFA,
-   0x10,0x1C,0x10,0x00,0x2A,0x08,0x80,0x00,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0xA4,0x0A,0x03,0x19,0xA5,0x0A,0x18,
-   0x10,0x1C,0x20,0x00,0xED,0x2D,0x06,0x30,0x21,0x00,0xA2,0x07,0x03,0x18,0xA3,0x0A,0xAA,0x2D,0x80,0x31,0x4A,
-   0x10,0x1C,0x30,0x00,0x74,0x28,0x08,0x00,0x11,0x34,0x00,0x34,0x03,0x34,0x00,0x34,0xB3,0x34,0x00,0x34,0x01,
-   0x10,0x1C,0x40,0x00,0x01,0x34,0x00,0x34,0x15,0x34,0x0F,0x34,0xB4,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1A,
-   0x10,0x1C,0x50,0x00,0x0D,0x34,0x0F,0x34,0x6C,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x16,0x34,0x0F,0x34,0x35,
-   0x10,0x1C,0x60,0x00,0xB5,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x17,0x34,0x0F,0x34,0xB6,0x34,0x00,0x34,0x42,
-   0x10,0x1C,0x70,0x00,0x01,0x34,0x00,0x34,0x18,0x34,0x0F,0x34,0xB7,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0xE4,
-   0x10,0x1C,0x80,0x00,0x19,0x34,0x0F,0x34,0xB8,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1A,0x34,0x0F,0x34,0xAA,
-   0x10,0x1C,0x90,0x00,0xB9,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x0F,0x34,0x0F,0x34,0x6E,0x34,0x00,0x34,0x5E,
-   0x10,0x1C,0xA0,0x00,0x02,0x34,0x00,0x34,0x11,0x34,0x0F,0x34,0xAC,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0xC4,
-   0x10,0x1C,0xB0,0x00,0x13,0x34,0x0F,0x34,0xAE,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x1B,0x34,0x0F,0x34,0x88,
-   0x10,0x1C,0xC0,0x00,0xBA,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1C,0x34,0x0F,0x34,0xBB,0x34,0x00,0x34,0xD3,
-   0x10,0x1C,0xD0,0x00,0x01,0x34,0x00,0x34,0x1D,0x34,0x0F,0x34,0xBC,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x7A,
-   0x10,0x1C,0xE0,0x00,0x1E,0x34,0x0F,0x34,0xBD,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x1F,0x34,0x0F,0x34,0x3B,
-   0x10,0x1C,0xF0,0x00,0xBE,0x34,0x00,0x34,0x01,0x34,0x00,0x34,0x20,0x34,0x0F,0x34,0xBF,0x34,0x00,0x34,0x97,
-   0x10,0x1D,0x00,0x00,0x01,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xD5,0x34,0xFD,0x34,0xC1,0x34,0xFE,0x34,0xA1,
-   0x10,0x1D,0x10,0x00,0x59,0x34,0xFF,0x34,0xCF,0x34,0xFF,0x34,0x30,0x34,0x00,0x34,0x86,0x34,0x00,0x34,0x47,
-   0x10,0x1D,0x20,0x00,0xD3,0x34,0x00,0x34,0x1A,0x34,0x01,0x34,0x5C,0x34,0x01,0x34,0x9C,0x34,0x01,0x34,0x2B,
-   0x10,0x1D,0x30,0x00,0xDA,0x34,0x01,0x34,0x16,0x34,0x02,0x34,0x51,0x34,0x02,0x34,0x8C,0x34,0x02,0x34,0x2F,
-   0x10,0x1D,0x40,0x00,0xC7,0x34,0x02,0x34,0x02,0x34,0x03,0x34,0x3F,0x34,0x03,0x34,0x7D,0x34,0x03,0x34,0x63,
-   0x10,0x1D,0x50,0x00,0xBD,0x34,0x03,0x34,0x01,0x34,0x04,0x34,0x48,0x34,0x04,0x34,0x94,0x34,0x04,0x34,0x3A,
-   0x10,0x1D,0x60,0x00,0xE5,0x34,0x04,0x34,0x3F,0x34,0x05,0x34,0xA4,0x34,0x05,0x34,0x17,0x34,0x06,0x34,0xE0,
-   0x10,0x1D,0x70,0x00,0x9E,0x34,0x06,0x34,0x44,0x34,0x07,0x34,0x1E,0x34,0x08,0x34,0x5D,0x34,0x09,0x34,0x48,
-   0x10,0x1D,0x80,0x00,0xAB,0x34,0x0B,0x34,0x61,0x34,0x19,0x34,0xFF,0x34,0x00,0x34,0xD1,0x34,0xA1,0x34,0x12,
-   0x10,0x1D,0x90,0x00,0xFF,0x34,0x02,0x34,0xC9,0x34,0xCD,0x34,0xFF,0x34,0x01,0x34,0x85,0x34,0xB7,0x34,0xD0,
-   0x10,0x1D,0xA0,0x00,0xFF,0x34,0x04,0x34,0x61,0x34,0x11,0x34,0xFF,0x34,0x03,0x34,0x61,0x34,0xC9,0x34,0xF2,
-   0x10,0x1D,0xB0,0x00,0xFF,0x34,0x05,0x34,0x85,0x34,0xD1,0x34,0xFF,0x34,0x08,0x34,0xCD,0x34,0x85,0x34,0xD0,
-   0x10,0x1D,0xC0,0x00,0xFF,0x34,0x06,0x34,0xD1,0x34,0x85,0x34,0xFF,0x34,0x06,0x34,0xDD,0x34,0x19,0x34,0x1D,
-   0x10,0x1D,0xD0,0x00,0xFF,0x34,0x09,0x34,0xDD,0x34,0xD5,0x34,0xFF,0x34,0x07,0x34,0x20,0x00,0xE5,0x00,0x06,
-   0x10,0x1D,0xE0,0x00,0x77,0x08,0xE6,0x00,0xE7,0x01,0x08,0x30,0xE8,0x00,0x20,0x00,0x65,0x1C,0xFA,0x2E,0xBD,
-   0x10,0x1D,0xF0,0x00,0x66,0x08,0xE7,0x07,0x20,0x00,0x65,0x08,0xE9,0x00,0x03,0x10,0x69,0x0C,0xE5,0x00,0xA4,
-   0x10,0x1E,0x00,0x00,0x03,0x10,0x66,0x0D,0xE9,0x00,0xE6,0x00,0x68,0x08,0xE9,0x00,0x69,0x03,0xE8,0x00,0xD0,
-   0x10,0x1E,0x10,0x00,0x68,0x08,0x03,0x1D,0xF5,0x2E,0x67,0x08,0x08,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0xFC,
-   0x10,0x1E,0x20,0x00,0x00,0x34,0x3C,0x34,0x00,0x34,0x3C,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x9A,
-   0x10,0x1E,0x30,0x00,0x00,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xEA,
-   0x02,0x1E,0x40,0x00,0x00,0x34,0x6C,
-   0x02,0x00,0x00,0x04,0x00,0x01,0xF9,
-   0x02,0x00,0x0E,0x00,0xD4,0x0F,0x0D,
-   0x02,0x00,0x10,0x00,0xFF,0x3A,0xB5,
-   0x00,0x00,0x00,0x01,0xFF
+   0x01,0x00,0x02,0x00,0x00,0xA0,0x00,0x00,0x8D,0x31,0x9A,0x2D,0xFF,0x34,0x8A,0x01,
+   0x20,0x00,0x0B,0x1D,0x37,0x28,0x22,0x00,0x8C,0x10,0x21,0x00,0x38,0x08,0x03,0x19,
+   0x17,0x28,0x03,0x10,0x21,0x00,0xB7,0x0C,0x82,0x30,0x20,0x00,0x95,0x00,0x21,0x00,
+   0xB8,0x01,0x2C,0x28,0x21,0x00,0x37,0x08,0x21,0x00,0x35,0x05,0x20,0x00,0xBB,0x00,
+   0x3B,0x08,0x03,0x19,0x24,0x28,0xC1,0x30,0x40,0x0E,0x81,0x27,0x28,0x43,0x30,0x40,
+   0x03,0x95,0x22,0x00,0x8C,0x14,0x01,0x30,0x21,0x00,0xB8,0x00,0x00,0x30,0x21,0x00,
+   0x37,0x04,0x03,0x1D,0x35,0x28,0x21,0x00,0x95,0x16,0x20,0x00,0x8B,0x12,0x20,0x00,
+   0x0B,0x11,0x20,0x00,0x91,0x1C,0x73,0x28,0x03,0x10,0x22,0x00,0x0D,0x0D,0x41,0x21,
+   0x9D,0x03,0x1D,0x44,0x28,0x10,0x30,0xBB,0x00,0x21,0x00,0x8E,0x01,0x22,0x00,0x8D,
+   0x01,0x20,0x00,0x3B,0x08,0x10,0x3A,0x03,0x19,0x5A,0x28,0x3B,0x08,0x20,0x3A,0x03,
+   0x19,0x5F,0x28,0x3B,0x08,0x40,0x3A,0x03,0x19,0x64,0x28,0x3B,0x08,0x80,0x3A,0x03,
+   0x19,0x69,0x28,0x6D,0x28,0x21,0x00,0x30,0x08,0x22,0x00,0x8E,0x00,0x40,0x04,0x80,
+   0x31,0x08,0x42,0x04,0x80,0x32,0x08,0x42,0x04,0x80,0x33,0x08,0x40,0x04,0x40,0x24,
+   0x93,0x22,0x00,0x8D,0x00,0x20,0x00,0x91,0x10,0x09,0x00,0x20,0x00,0xBE,0x01,0xBF,
+   0x01,0xC0,0x01,0x80,0x30,0xC1,0x00,0x6A,0x30,0x21,0x00,0x99,0x00,0x0C,0x30,0x8C,
+   0x00,0x22,0x00,0x8C,0x01,0x21,0x00,0x8D,0x01,0x40,0x3C,0x40,0x40,0xA9,0x04,0x30,
+   0x23,0x00,0x8C,0x00,0x21,0x00,0x1E,0x16,0x9E,0x17,0x23,0x00,0x8E,0x01,0x05,0x30,
+   0x20,0x00,0x9C,0x00,0xFA,0x30,0x9B,0x00,0x21,0x00,0x91,0x14,0x72,0x30,0x28,0x00,
+   0x97,0x00,0x7F,0x30,0xA0,0x27,0x20,0x00,0xA7,0x00,0x77,0x08,0xA9,0x00,0xA8,0x00,
+   0x28,0x0C,0x03,0x18,0xA5,0x28,0x28,0x00,0x17,0x11,0x03,0x1C,0xA9,0x28,0x28,0x00,
+   0x17,0x15,0xFA,0x30,0x28,0x00,0x96,0x00,0x37,0x30,0x9E,0x00,0xFA,0x30,0x9D,0x00,
+   0x72,0x30,0x40,0x16,0x91,0xEB,0x00,0x77,0x08,0xEA,0x00,0xC0,0x30,0x20,0x00,0x8B,
+   0x00,0x21,0x00,0x95,0x11,0x15,0x10,0x95,0x14,0x15,0x11,0x09,0x30,0x9D,0x00,0x06,
+   0x30,0x21,0x00,0x36,0x02,0x03,0x18,0x6C,0x29,0x40,0xAD,0x80,0x03,0x1D,0x40,0x03,
+   0x86,0x36,0x08,0x03,0x1D,0xD1,0x28,0xFF,0x30,0x21,0x00,0xB5,0x00,0x41,0x29,0x40,
+   0x07,0x83,0x01,0x3A,0x03,0x1D,0xDC,0x28,0x45,0x30,0x40,0x08,0x81,0x20,0x00,0xC9,
+   0x01,0x41,0x0A,0x83,0x02,0x3A,0x03,0x1D,0x08,0x29,0x75,0x30,0x44,0x47,0x9C,0x28,
+   0x0E,0xF0,0x39,0xA9,0x00,0x20,0x00,0x6C,0x08,0x20,0x00,0xCA,0x00,0x20,0x00,0x6D,
+   0x08,0x20,0x00,0xCB,0x00,0x20,0x00,0xA8,0x00,0xAB,0x01,0xA8,0x1B,0xAB,0x03,0x0F,
+   0x30,0xA8,0x05,0xAB,0x01,0x29,0x08,0xAA,0x00,0xAC,0x01,0x28,0x08,0x2A,0x04,0xA9,
+   0x00,0x2B,0x08,0x2C,0x04,0xAD,0x00,0x29,0x08,0x43,0x36,0x84,0x03,0x3A,0x03,0x1D,
+   0x12,0x29,0x20,0x00,0x4A,0x08,0x43,0x09,0x8F,0x04,0x3A,0x03,0x1D,0x38,0x29,0x20,
+   0x00,0xA9,0x01,0x22,0x00,0x8C,0x1E,0x1E,0x29,0x20,0x00,0xA9,0x0A,0x20,0x00,0x29,
+   0x0E,0xF0,0x39,0xA8,0x00,0x03,0x10,0xA8,0x0D,0x40,0x01,0x40,0x0D,0x81,0x0C,0x1E,
+   0x2C,0x29,0x43,0x0D,0x81,0xAB,0x00,0x28,0x08,0x40,0x30,0x81,0xA8,0x00,0x29,0x04,
+   0x43,0x25,0x84,0x05,0x3A,0x03,0x1D,0x41,0x29,0x20,0x00,0x49,0x08,0x40,0x09,0x97,
+   0x21,0x00,0x35,0x08,0x20,0x00,0xA9,0x00,0x08,0x30,0xA8,0x00,0x20,0x00,0x28,0x08,
+   0xAB,0x00,0xA8,0x03,0x2B,0x08,0x03,0x19,0x63,0x29,0x29,0x08,0x20,0x00,0x49,0x06,
+   0x20,0x00,0xAB,0x00,0x80,0x30,0xAB,0x05,0x03,0x10,0x20,0x00,0xC9,0x0D,0x20,0x00,
+   0x40,0x0D,0x83,0x5F,0x29,0x31,0x30,0x20,0x00,0xC9,0x06,0x40,0x09,0x93,0xA9,0x0D,
+   0x47,0x29,0x80,0x30,0x21,0x00,0xB7,0x00,0x20,0x00,0x8B,0x16,0x21,0x00,0x95,0x12,
+   0x21,0x00,0xB6,0x0A,0x20,0x00,0x93,0x1D,0x82,0x29,0x88,0x31,0x00,0x20,0x81,0x31,
+   0x28,0x00,0x17,0x19,0x80,0x29,0x40,0xA7,0xAC,0xB3,0x00,0x03,0x30,0x21,0x00,0xB0,
+   0x00,0x59,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,0xB1,0x00,0x20,0x00,0x93,0x11,0x20,
+   0x00,0x93,0x1C,0x1A,0x2E,0x20,0x00,0xBE,0x0A,0x03,0x19,0xBF,0x0A,0x3E,0x1C,0xD1,
+   0x29,0x40,0x08,0xF7,0x00,0x41,0x08,0x20,0x00,0xA0,0x00,0x77,0x08,0xA1,0x00,0x21,
+   0x00,0x9D,0x14,0x21,0x00,0x9D,0x18,0x94,0x29,0x1D,0x10,0x20,0x00,0x21,0x0E,0x0F,
+   0x39,0xA2,0x00,0x20,0x0E,0xA3,0x00,0xF0,0x39,0xA2,0x04,0xA3,0x06,0x03,0x10,0xA3,
+   0x0C,0xA2,0x0C,0x41,0x02,0x8F,0x22,0x08,0xA1,0x02,0x23,0x08,0x03,0x1C,0x23,0x0F,
+   0xA0,0x02,0x21,0x00,0x1C,0x08,0x20,0x00,0xA2,0x00,0xA3,0x01,0x22,0x08,0xA4,0x00,
+   0xA6,0x01,0x21,0x00,0x1B,0x08,0x42,0x07,0x9A,0xA6,0x04,0x23,0x08,0xA4,0x04,0x26,
+   0x08,0xA2,0x00,0x24,0x08,0xA3,0x00,0x22,0x08,0xA1,0x07,0x23,0x08,0x03,0x18,0x23,
+   0x0F,0xA0,0x07,0x21,0x08,0xF7,0x00,0x20,0x08,0xC1,0x00,0x77,0x08,0xC0,0x00,0x09,
+   0x30,0x21,0x00,0x9D,0x00,0x20,0x00,0x3E,0x08,0x0F,0x39,0x03,0x1D,0x18,0x2E,0x45,
+   0x4A,0x80,0x20,0x30,0x40,0x25,0x81,0xA4,0x01,0xA6,0x01,0x40,0x48,0x91,0xA5,0x00,
+   0x20,0x0E,0xA7,0x00,0xF0,0x39,0xA5,0x04,0xA7,0x06,0x03,0x10,0xA7,0x0C,0xA5,0x0C,
+   0x3F,0x30,0xA5,0x05,0xA7,0x01,0x25,0x08,0xA9,0x00,0x03,0x10,0x20,0x0C,0xA5,0x00,
+   0xA7,0x01,0x41,0x0B,0x41,0x02,0x80,0x1F,0x30,0x41,0x0E,0x81,0xA8,0x00,0x20,0x08,
+   0x40,0x0D,0x86,0x25,0x08,0xA1,0x00,0xF8,0x30,0x21,0x02,0x03,0x18,0x0E,0x2A,0x09,
+   0x30,0x40,0x03,0x8B,0x10,0x2A,0x21,0x00,0x34,0x14,0x20,0x00,0x28,0x0A,0xA1,0x00,
+   0x02,0x30,0xF7,0x00,0x21,0x08,0x8E,0x31,0xEE,0x26,0x82,0x31,0x40,0x3F,0x89,0xA5,
+   0x01,0x20,0x08,0x82,0x3E,0xA0,0x00,0x8E,0x30,0xA1,0x00,0x25,0x08,0x03,0x18,0x25,
+   0x0F,0xA1,0x07,0x40,0x11,0x80,0x28,0x08,0x42,0x11,0x41,0x29,0x93,0x82,0x3E,0xA5,
+   0x00,0x27,0x08,0x03,0x18,0x27,0x0F,0x8E,0x3E,0xA7,0x00,0xA8,0x01,0x20,0x00,0x29,
+   0x08,0x28,0x02,0x03,0x1C,0x5F,0x2A,0x25,0x08,0xF6,0x00,0x27,0x08,0xF7,0x00,0x80,
+   0x30,0x87,0x31,0xD9,0x27,0x40,0x18,0x9C,0xAB,0x00,0x77,0x08,0xAA,0x00,0xAC,0x00,
+   0x2B,0x08,0xAD,0x00,0x00,0x30,0xAD,0x1B,0xFF,0x30,0xBD,0x00,0xBC,0x00,0x2C,0x08,
+   0xA2,0x07,0x2D,0x08,0x03,0x18,0x2D,0x0F,0xA3,0x07,0x3C,0x08,0x03,0x18,0x3C,0x0F,
+   0xA4,0x07,0x3D,0x08,0x03,0x18,0x3D,0x0F,0xA6,0x07,0x82,0x2A,0x20,0x00,0x20,0x08,
+   0xF6,0x00,0x40,0x99,0x5C,0x23,0x82,0x20,0x00,0xA8,0x0A,0x40,0x30,0x40,0x4B,0x8E,
+   0x37,0x2A,0x22,0x0E,0x0F,0x39,0xA1,0x00,0x23,0x0E,0xA0,0x00,0xF0,0x39,0xA1,0x04,
+   0xA0,0x06,0x24,0x0E,0xA5,0x00,0xF0,0x39,0xA0,0x04,0xA5,0x06,0x26,0x0E,0x42,0xAF,
+   0x85,0xF0,0x30,0xA7,0x19,0xA7,0x04,0x03,0x10,0xA7,0x1B,0x03,0x14,0x40,0xA5,0x81,
+   0xA0,0x0C,0xA1,0x0C,0x45,0x06,0x82,0x21,0x08,0xA2,0x00,0x20,0x08,0x40,0xEC,0xCF,
+   0xF7,0x00,0x23,0x08,0xC3,0x00,0x77,0x08,0xC2,0x00,0x74,0x30,0xA0,0x27,0x20,0x00,
+   0xC5,0x00,0x77,0x08,0xC4,0x00,0x42,0x08,0xC6,0x00,0x43,0x08,0xC7,0x00,0x44,0x08,
+   0x46,0x07,0x20,0x00,0xEC,0x00,0x20,0x00,0x47,0x08,0x20,0x00,0xED,0x00,0x20,0x00,
+   0x45,0x08,0x03,0x18,0x45,0x0A,0x03,0x19,0xCF,0x2A,0x20,0x00,0xED,0x07,0x03,0x30,
+   0x21,0x00,0x39,0x02,0x03,0x18,0xD6,0x2A,0x21,0x00,0xB6,0x01,0x21,0x00,0x39,0x08,
+   0x03,0x1D,0xDC,0x2A,0x30,0x30,0xB9,0x00,0x21,0x00,0xB9,0x03,0x21,0x00,0x34,0x1C,
+   0xE4,0x2A,0x22,0x00,0x0C,0x14,0xE6,0x2A,0x22,0x00,0x0C,0x10,0x21,0x00,0x34,0x10,
+   0x22,0x00,0x0C,0x1C,0x05,0x2B,0x20,0x00,0x99,0x1F,0xF9,0x2A,0x11,0x30,0x21,0x00,
+   0xB0,0x00,0xCB,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x21,0x00,
+   0xB3,0x00,0x22,0x00,0x0C,0x12,0x8C,0x12,0x3C,0x30,0x21,0x00,0xAE,0x00,0xAF,0x01,
+   0x40,0x03,0x83,0xAC,0x00,0xAD,0x01,0x18,0x2E,0x7C,0x30,0x40,0x4F,0x41,0x55,0x8F,
+   0xC4,0x00,0x06,0x30,0x44,0x02,0x03,0x18,0x30,0x2C,0x21,0x00,0x33,0x13,0x03,0x30,
+   0x20,0x00,0x3F,0x02,0x03,0x1D,0x19,0x2B,0xE8,0x30,0x3E,0x02,0x03,0x1C,0x35,0x2C,
+   0x41,0x15,0x88,0xAC,0x00,0x77,0x08,0xAD,0x00,0xBD,0x00,0x06,0x30,0x3D,0x02,0x03,
+   0x18,0x2B,0x2C,0x77,0x30,0x43,0x0A,0x9A,0xBC,0x00,0x20,0x00,0xEE,0x0A,0x03,0x19,
+   0xEF,0x0A,0x09,0x30,0x20,0x00,0x3C,0x02,0x03,0x1C,0x38,0x2B,0x08,0x30,0xBC,0x00,
+   0x13,0x30,0xF7,0x00,0x20,0x00,0x3D,0x08,0x8E,0x31,0xEE,0x26,0x83,0x31,0x20,0x00,
+   0xAD,0x00,0x03,0x10,0x3C,0x0D,0xBD,0x00,0xAD,0x07,0x2D,0x0A,0xAC,0x00,0x40,0x1F,
+   0x85,0xBD,0x00,0x77,0x08,0xAC,0x00,0x02,0x30,0x2D,0x07,0xAE,0x00,0x40,0x07,0x95,
+   0xAF,0x00,0x77,0x08,0xAE,0x00,0x3D,0x08,0x20,0x00,0x6F,0x02,0x03,0x1D,0x5D,0x2B,
+   0x20,0x00,0x2C,0x08,0x20,0x00,0x6E,0x02,0x03,0x1C,0x94,0x2B,0x20,0x00,0x2E,0x08,
+   0x20,0x00,0xEA,0x00,0x20,0x00,0x2F,0x08,0x20,0x00,0xEB,0x00,0x40,0x07,0x8C,0xF6,
+   0x00,0x2F,0x08,0xF7,0x00,0x72,0x30,0x63,0x27,0x20,0x00,0x3C,0x08,0x08,0x3A,0x03,
+   0x19,0x7E,0x2B,0x03,0x30,0x2D,0x07,0xB0,0x00,0x40,0x26,0x99,0xB1,0x00,0x77,0x08,
+   0xB0,0x00,0x31,0x04,0x03,0x1D,0x85,0x2B,0x06,0x30,0xF6,0x00,0x00,0x30,0xF7,0x00,
+   0x7C,0x30,0x63,0x27,0x2B,0x2C,0x20,0x00,0xEE,0x01,0xEF,0x01,0x20,0x00,0xBC,0x0A,
+   0x3C,0x08,0xB0,0x00,0xB1,0x01,0x30,0x08,0xF6,0x00,0x31,0x08,0xF7,0x00,0x77,0x30,
+   0x40,0x0E,0x80,0x7B,0x30,0x40,0x1E,0x86,0xB0,0x00,0x77,0x08,0xBC,0x00,0x30,0x04,
+   0x03,0x19,0x2B,0x2C,0x2D,0x08,0x40,0x08,0x80,0xBC,0x00,0x40,0x76,0x82,0x20,0x00,
+   0x6F,0x0E,0xF0,0x39,0x40,0x2E,0x81,0x20,0x00,0x6E,0x0E,0x40,0x13,0x85,0x0F,0x39,
+   0xB1,0x04,0xB0,0x06,0x03,0x10,0xB0,0x0D,0xB1,0x0D,0x41,0x02,0x85,0x20,0x30,0xB2,
+   0x00,0xB3,0x01,0xB4,0x01,0xB5,0x01,0xB6,0x01,0x40,0x80,0x86,0x31,0x02,0x03,0x1D,
+   0xC2,0x2B,0x2C,0x08,0x30,0x02,0x03,0x1C,0xE3,0x2B,0x40,0x6A,0xA0,0xB0,0x02,0x3D,
+   0x08,0x03,0x1C,0x3D,0x0F,0xB1,0x02,0x2E,0x08,0xB7,0x00,0x2F,0x08,0xB8,0x00,0x00,
+   0x30,0xB8,0x1B,0xFF,0x30,0xBA,0x00,0xB9,0x00,0x37,0x08,0xB2,0x07,0x38,0x08,0x03,
+   0x18,0x38,0x0F,0xB3,0x07,0x39,0x08,0x03,0x18,0x39,0x0F,0xB4,0x07,0x3A,0x08,0x03,
+   0x18,0x3A,0x0F,0xB5,0x07,0xFB,0x2B,0x20,0x00,0x2D,0x08,0xB7,0x00,0x3C,0x08,0x52,
+   0x18,0xA1,0x20,0x00,0xB6,0x0A,0x40,0x30,0x36,0x02,0x03,0x1C,0xBB,0x2B,0x32,0x0E,
+   0x0F,0x39,0xB2,0x00,0x33,0x0E,0xB3,0x00,0xF0,0x39,0xB2,0x04,0xB3,0x06,0x34,0x0E,
+   0xB4,0x00,0xF0,0x39,0xB3,0x04,0xB4,0x06,0x35,0x0E,0xB5,0x00,0xF0,0x39,0xB4,0x04,
+   0xB5,0x06,0xF0,0x30,0xB5,0x19,0xB5,0x04,0x03,0x10,0xB5,0x1B,0x03,0x14,0xB5,0x0C,
+   0xB4,0x0C,0xB3,0x0C,0xB2,0x0C,0x45,0x06,0x80,0x32,0x08,0x41,0xC3,0x80,0x33,0x08,
+   0x40,0xC3,0x8A,0x08,0x30,0x20,0x00,0xBE,0x00,0xBF,0x01,0x35,0x2C,0x21,0x00,0x33,
+   0x17,0x20,0x00,0xBE,0x01,0xBF,0x01,0x76,0x30,0x40,0x97,0xA0,0xC3,0x00,0x77,0x08,
+   0xC2,0x00,0x43,0x04,0x03,0x19,0x9D,0x2C,0x20,0x00,0x6A,0x08,0x20,0x00,0x6C,0x02,
+   0x20,0x00,0xC4,0x00,0x20,0x00,0x6B,0x08,0x03,0x1C,0x6B,0x0A,0x20,0x00,0x6D,0x02,
+   0x20,0x00,0xC5,0x00,0x03,0x14,0xC5,0x1F,0x03,0x10,0x03,0x1C,0x56,0x2C,0xC4,0x09,
+   0xC5,0x09,0xC4,0x0A,0x03,0x19,0xC5,0x0A,0x03,0x14,0x20,0x00,0xC3,0x1F,0x40,0x0A,
+   0xA2,0x7F,0x2C,0xC2,0x09,0xC3,0x09,0xC2,0x0A,0x03,0x19,0xC3,0x0A,0x43,0x08,0x80,
+   0x3E,0xC8,0x00,0x45,0x08,0x80,0x3E,0x48,0x02,0x03,0x1D,0x6B,0x2C,0x44,0x08,0x42,
+   0x02,0x20,0x00,0xC6,0x01,0x03,0x1C,0x46,0x14,0x46,0x08,0x00,0x30,0x03,0x19,0x01,
+   0x30,0xC7,0x00,0xC6,0x00,0x46,0x0C,0x03,0x18,0x7A,0x2C,0x22,0x00,0x0C,0x10,0x03,
+   0x1C,0x7E,0x2C,0x22,0x00,0x0C,0x14,0x40,0x40,0x40,0x1B,0x80,0xC8,0x00,0x40,0x21,
+   0x40,0x1E,0x82,0x8A,0x2C,0x42,0x08,0x44,0x02,0x46,0x1E,0x80,0xC2,0x00,0x41,0x1E,
+   0x80,0x99,0x2C,0x41,0x1E,0x80,0x9D,0x2C,0x40,0x1E,0x9A,0x21,0x00,0x2C,0x08,0x2D,
+   0x04,0x03,0x19,0xA6,0x2C,0xFF,0x30,0xAC,0x07,0x03,0x1C,0xAD,0x03,0x21,0x00,0x2E,
+   0x08,0x2F,0x04,0x03,0x19,0xAF,0x2C,0xFF,0x30,0xAE,0x07,0x03,0x1C,0xAF,0x03,0x20,
+   0x00,0xA7,0x01,0x22,0x00,0x0C,0x1E,0xB6,0x2C,0x20,0x00,0xA7,0x0A,0x20,0x00,0x27,
+   0x08,0x41,0x28,0x8A,0xA9,0x00,0xA7,0x00,0x27,0x0C,0x03,0x18,0xC2,0x2C,0x21,0x00,
+   0xB3,0x13,0x03,0x1C,0xC6,0x2C,0x21,0x00,0xB3,0x17,0x41,0x16,0x81,0x8C,0x1E,0xCD,
+   0x2C,0x49,0x16,0x86,0xD9,0x2C,0x21,0x00,0xB3,0x11,0x03,0x1C,0xDD,0x2C,0x21,0x00,
+   0xB3,0x15,0x40,0x2B,0x80,0xF2,0x2C,0x40,0x9B,0x84,0x80,0x3E,0x20,0x00,0xA8,0x00,
+   0x20,0x00,0x6D,0x08,0x40,0x04,0x88,0x28,0x02,0x03,0x1D,0xF0,0x2C,0x20,0x00,0x6C,
+   0x08,0x20,0x00,0x6A,0x02,0x03,0x18,0x07,0x2D,0x40,0x29,0x80,0x65,0x2D,0x42,0x0F,
+   0x40,0x14,0x41,0x19,0x40,0x14,0x80,0x05,0x2D,0x42,0xC2,0x82,0x03,0x1C,0x65,0x2D,
+   0x79,0x30,0x40,0xD1,0x90,0xA9,0x00,0x77,0x08,0xA7,0x00,0x29,0x0E,0xF0,0x39,0x21,
+   0x00,0xAD,0x00,0x20,0x00,0x27,0x0E,0x21,0x00,0xAC,0x00,0x0F,0x39,0xAD,0x04,0xAC,
+   0x06,0x03,0x10,0xAC,0x0D,0xAD,0x0D,0x41,0x02,0x85,0x2C,0x0E,0x0F,0x39,0x20,0x00,
+   0xA7,0x00,0x21,0x00,0x2D,0x0E,0x40,0x1A,0x8E,0xF0,0x39,0xA7,0x04,0xA9,0x06,0x27,
+   0x08,0x21,0x00,0xAC,0x02,0x20,0x00,0x29,0x08,0x03,0x1C,0x29,0x0A,0x03,0x19,0x34,
+   0x2D,0x21,0x00,0xAD,0x02,0x7A,0x30,0x46,0x2C,0x80,0xAF,0x00,0x41,0x2C,0x86,0xAE,
+   0x00,0x0F,0x39,0xAF,0x04,0xAE,0x06,0x03,0x10,0xAE,0x0D,0xAF,0x0D,0x41,0x02,0x80,
+   0x2E,0x0E,0x42,0x2C,0x80,0x2F,0x0E,0x45,0x2C,0x80,0xAE,0x02,0x43,0x2C,0x8C,0x61,
+   0x2D,0x21,0x00,0xAF,0x02,0x22,0x00,0x0C,0x12,0x8C,0x12,0xE7,0x2D,0x22,0x00,0x0C,
+   0x1A,0xE7,0x2D,0x8C,0x1A,0xE7,0x2D,0x73,0x30,0x43,0x35,0x81,0x20,0x00,0x6A,0x07,
+   0x42,0x79,0x88,0x20,0x00,0xAB,0x00,0x29,0x08,0x03,0x18,0x29,0x0F,0xAB,0x07,0x2B,
+   0x08,0x80,0x3E,0xAA,0x00,0x42,0x89,0x82,0x2A,0x02,0x03,0x1D,0x8A,0x2D,0x41,0x99,
+   0x82,0x28,0x02,0x03,0x18,0xAC,0x2D,0x42,0xEE,0x87,0xA9,0x2D,0x20,0x00,0xA8,0x01,
+   0x21,0x00,0xB3,0x1F,0x98,0x2D,0x20,0x00,0xA8,0x0A,0x40,0x0B,0x80,0x01,0x39,0x40,
+   0x24,0x84,0xAA,0x00,0xA8,0x06,0x28,0x0C,0x03,0x18,0xA4,0x2D,0x41,0xE1,0x80,0xA8,
+   0x2D,0x40,0xE1,0x40,0x43,0x81,0x0C,0x16,0xE7,0x2D,0x40,0xDE,0x40,0xBF,0x40,0x62,
+   0x41,0x57,0x81,0x20,0x00,0x6B,0x02,0x40,0x4A,0x42,0x39,0x85,0xAC,0x00,0x29,0x08,
+   0x80,0x3E,0x2C,0x02,0x03,0x1D,0xC6,0x2D,0x40,0x15,0x8E,0x6C,0x02,0x03,0x18,0xE7,
+   0x2D,0x21,0x00,0x2E,0x08,0x2F,0x04,0x03,0x19,0xE5,0x2D,0x20,0x00,0xA7,0x01,0x21,
+   0x00,0xB3,0x1D,0xD4,0x2D,0x20,0x00,0xA7,0x0A,0x40,0x0B,0x40,0x3B,0x8B,0xA9,0x00,
+   0xA8,0x00,0xA7,0x06,0x27,0x0C,0x03,0x18,0xE0,0x2D,0x21,0x00,0xB3,0x11,0x03,0x1C,
+   0xE4,0x2D,0x21,0x00,0xB3,0x15,0x40,0x3B,0x95,0x8C,0x16,0x20,0x00,0x99,0x1F,0x18,
+   0x2E,0x22,0x00,0x0C,0x1C,0xFA,0x2D,0x23,0x00,0x1D,0x1F,0xFA,0x2D,0x61,0x30,0x21,
+   0x00,0xB0,0x00,0x11,0x30,0x21,0x00,0xB1,0x00,0xFF,0x30,0x21,0x00,0xB2,0x00,0x01,
+   0x2E,0x01,0x30,0xF6,0x00,0x40,0x75,0x84,0xF7,0x00,0x6D,0x08,0x1D,0x26,0x20,0x00,
+   0xC2,0x01,0x40,0x15,0x97,0x08,0x2E,0x20,0x00,0xC2,0x0A,0x20,0x00,0x42,0x08,0x00,
+   0x30,0x03,0x19,0x01,0x30,0xC4,0x00,0xC2,0x00,0x42,0x0C,0x03,0x18,0x14,0x2E,0x23,
+   0x00,0x1D,0x13,0x03,0x1C,0x18,0x2E,0x23,0x00,0x1D,0x17,0x20,0x00,0x93,0x10,0x64,
+   0x00,0xC0,0x28,0x08,0x00,0x41,0xB0,0x9E,0xA8,0x00,0x76,0x08,0xAB,0x00,0x03,0x14,
+   0xA9,0x1F,0x03,0x10,0x03,0x1C,0x31,0x2E,0x21,0x00,0x33,0x12,0x20,0x00,0xA8,0x09,
+   0xA9,0x09,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0x33,0x2E,0x21,0x00,0x33,0x16,0x20,0x00,
+   0x2B,0x08,0x01,0x3A,0x03,0x1D,0x3C,0x2E,0x21,0x00,0xB3,0x12,0x33,0x15,0x3F,0x2E,
+   0x21,0x00,0xB3,0x16,0x33,0x15,0x40,0xE5,0x90,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x47,
+   0x2E,0xE8,0x30,0x28,0x02,0x03,0x1C,0x57,0x2E,0x20,0x00,0x28,0x08,0xAA,0x00,0x29,
+   0x08,0xAC,0x00,0x2A,0x08,0xF7,0x00,0x2C,0x08,0xFA,0x26,0x42,0x34,0x80,0xAB,0x01,
+   0x41,0x17,0x83,0x80,0x3E,0x03,0x1D,0x5F,0x2E,0x64,0x30,0x40,0x17,0x80,0x93,0x2E,
+   0x43,0x17,0x82,0xAD,0x01,0x20,0x00,0x2C,0x08,0x41,0x0F,0x9B,0x6F,0x2E,0x64,0x30,
+   0x2A,0x02,0x03,0x1C,0x78,0x2E,0x9C,0x30,0x20,0x00,0xAA,0x07,0x03,0x1C,0xAC,0x03,
+   0xAD,0x0A,0x67,0x2E,0x20,0x00,0x2A,0x08,0xA8,0x00,0x2C,0x08,0xA9,0x00,0x0F,0x30,
+   0xAD,0x05,0x2D,0x08,0xF6,0x3E,0xAD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xAA,0x00,
+   0x2D,0x08,0xF6,0x00,0x40,0x39,0x83,0x80,0x30,0x87,0x31,0xC7,0x27,0x86,0x31,0x40,
+   0xD1,0x40,0x9E,0x80,0x96,0x2E,0x40,0x9C,0x80,0xB0,0x00,0x43,0x3E,0x84,0x9E,0x2E,
+   0x0A,0x30,0x28,0x02,0x03,0x18,0xAB,0x2E,0x40,0x6C,0x88,0x03,0x1D,0xAB,0x2E,0x21,
+   0x00,0x30,0x08,0x20,0x00,0xAA,0x00,0xFF,0x3A,0x03,0x19,0xE1,0x2E,0x49,0x49,0x81,
+   0xB9,0x2E,0x0A,0x30,0x40,0x49,0x81,0xC2,0x2E,0xF6,0x30,0x43,0x49,0x80,0xB1,0x2E,
+   0x43,0x49,0x50,0x47,0x80,0xB1,0x00,0x40,0x39,0x84,0x03,0x19,0xE4,0x2E,0x21,0x00,
+   0x31,0x10,0xE4,0x2E,0x40,0x4D,0x40,0x09,0x83,0x28,0x08,0xAB,0x00,0xF6,0x3E,0xA8,
+   0x00,0x41,0x1E,0x83,0xA9,0x00,0x28,0x08,0xF6,0x00,0x29,0x08,0x44,0x1E,0x80,0xAB,
+   0x00,0x40,0xFF,0x40,0xDC,0x87,0xA0,0x00,0x77,0x08,0xA1,0x00,0x03,0x10,0x20,0x0C,
+   0xA2,0x00,0x21,0x0C,0xA3,0x00,0x40,0x04,0x93,0xA4,0x00,0x21,0x0C,0xA6,0x00,0x03,
+   0x10,0xA4,0x0C,0xA6,0x0C,0x26,0x08,0xA3,0x07,0x24,0x08,0x03,0x18,0x24,0x0F,0xA2,
+   0x07,0x23,0x0E,0x0F,0x39,0xA6,0x00,0x22,0x0E,0xA4,0x00,0xF0,0x39,0xA6,0x04,0xA4,
+   0x06,0x44,0x0D,0x82,0x22,0x08,0xA6,0x00,0xA4,0x01,0x44,0x08,0x82,0x03,0x10,0xA2,
+   0x0C,0xA3,0x0C,0x45,0x02,0x86,0x23,0x0D,0xA6,0x00,0x22,0x0D,0xA4,0x00,0x03,0x10,
+   0xA6,0x0D,0xA4,0x0D,0x42,0x02,0x94,0x23,0x0D,0xA5,0x00,0x22,0x0D,0xA7,0x00,0x25,
+   0x08,0xA6,0x07,0x27,0x08,0x03,0x18,0x27,0x0F,0xA4,0x07,0x26,0x08,0xA1,0x02,0x24,
+   0x08,0x03,0x1C,0x24,0x0F,0xA0,0x02,0x06,0x30,0xA1,0x07,0x03,0x18,0xA0,0x0A,0x21,
+   0x0E,0x40,0x3F,0x80,0x20,0x0E,0x48,0x3F,0x82,0x23,0x08,0xF7,0x00,0x22,0x08,0x40,
+   0x68,0x86,0xA7,0x00,0x77,0x08,0xA9,0x00,0x76,0x08,0xA8,0x00,0x27,0x08,0xA0,0x27,
+   0x40,0x75,0x8C,0x77,0x08,0xAA,0x00,0x28,0x06,0x03,0x1D,0x76,0x2F,0x2B,0x08,0x29,
+   0x06,0x03,0x19,0x9F,0x2F,0x03,0x10,0x20,0x00,0x27,0x0D,0xAA,0x00,0x40,0xB7,0x81,
+   0x23,0x00,0x91,0x00,0x40,0x99,0x95,0x23,0x00,0x93,0x00,0x15,0x13,0x95,0x13,0x15,
+   0x15,0x20,0x00,0x8B,0x13,0x55,0x30,0x23,0x00,0x96,0x00,0xAA,0x30,0x96,0x00,0x95,
+   0x14,0x20,0x00,0x8B,0x17,0x23,0x00,0x15,0x11,0x23,0x00,0x95,0x18,0x91,0x2F,0x20,
+   0x00,0x12,0x12,0x40,0xFF,0x86,0xA8,0x00,0xA9,0x01,0x2A,0x08,0xA7,0x00,0xAA,0x0A,
+   0x27,0x1C,0x7A,0x2F,0x41,0xA5,0x86,0xA1,0x01,0xA2,0x01,0x03,0x10,0x20,0x0D,0xA3,
+   0x00,0x20,0x00,0x23,0x08,0x40,0x2C,0x40,0x28,0x81,0x15,0x14,0x13,0x08,0x40,0x0E,
+   0x84,0xA4,0x01,0x20,0x08,0xA6,0x00,0xA5,0x01,0x22,0x08,0x41,0x05,0x8A,0x25,0x04,
+   0xA1,0x00,0x24,0x08,0x26,0x04,0xA2,0x00,0x23,0x08,0xA0,0x00,0xA3,0x0A,0x20,0x1C,
+   0xA7,0x2F,0x21,0x08,0x41,0x63,0x90,0x00,0x3A,0x03,0x19,0xCE,0x2F,0x80,0x3A,0x03,
+   0x19,0xD4,0x2F,0x00,0x34,0x76,0x08,0x84,0x00,0x77,0x08,0x85,0x00,0x00,0x08,0x08,
+   0x00,0x77,0x08,0x8A,0x00,0x76,0x08,0x82,0x00,0x41,0x11,0x80,0xE1,0x2F,0x40,0x11,
+   0x81,0xE9,0x2F,0xF7,0x01,0x43,0x12,0x81,0x12,0x00,0xF7,0x00,0x40,0x14,0x85,0x87,
+   0x31,0xD4,0x27,0xF5,0x00,0xF6,0x0F,0xF7,0x03,0xF7,0x0A,0x40,0x05,0x8E,0xF4,0x00,
+   0x75,0x08,0xF7,0x00,0x74,0x08,0x08,0x00,0x03,0x34,0xB7,0x34,0x0D,0x34,0x25,0x34,
+   0xB1,0x34,0x61,0x34,0x41,0x34,0x37,0x34,0x01,0x34,0x21,0x34,0x40,0x7A,0xA0,0x22,
+   0x00,0x0D,0x08,0x20,0x00,0xDD,0x00,0x21,0x00,0x0E,0x08,0x20,0x00,0xDE,0x00,0x22,
+   0x00,0x8D,0x01,0xD8,0x30,0x21,0x00,0x8E,0x00,0x03,0x10,0x21,0x00,0x3E,0x0D,0x20,
+   0x00,0xDF,0x00,0xE0,0x01,0x20,0x00,0x8E,0x1F,0x1A,0x28,0x20,0x00,0xE0,0x0A,0x20,
+   0x00,0x5F,0x08,0xE1,0x00,0x60,0x08,0xDF,0x00,0x61,0x04,0x21,0x00,0xBE,0x00,0x03,
+   0x10,0x43,0x11,0x81,0x0E,0x1E,0x2C,0x28,0x4E,0x11,0x81,0x0E,0x1F,0x3E,0x28,0x4E,
+   0x11,0x81,0x8E,0x1D,0x50,0x28,0x48,0x11,0x85,0x20,0x00,0x5D,0x08,0x22,0x00,0x8D,
+   0x00,0x20,0x00,0x5E,0x08,0x40,0x50,0x40,0xD2,0xA1,0x21,0x00,0x3D,0x08,0x03,0x1D,
+   0xBD,0x03,0x0F,0x30,0x21,0x00,0x3A,0x02,0x03,0x18,0x59,0x2C,0x88,0x30,0x8A,0x00,
+   0x72,0x30,0x3A,0x07,0x03,0x18,0x8A,0x0A,0x82,0x00,0x81,0x28,0xD3,0x28,0xEB,0x28,
+   0xFF,0x28,0x25,0x29,0xEC,0x2B,0xA8,0x2B,0x09,0x2C,0x15,0x2C,0x59,0x2C,0x59,0x2C,
+   0x49,0x29,0xE2,0x29,0x78,0x2A,0xE0,0x2A,0x88,0x30,0x21,0x00,0x3E,0x05,0x40,0x7F,
+   0x92,0x08,0x3A,0x03,0x1D,0x90,0x28,0x1B,0x30,0x21,0x00,0xBD,0x00,0x06,0x30,0x21,
+   0x00,0xBA,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3E,0x04,0x03,0x19,0x5B,0x2C,0x7F,
+   0x30,0x87,0x31,0xA0,0x27,0x88,0x31,0x40,0x90,0x82,0x77,0x08,0xDD,0x00,0x5E,0x04,
+   0x40,0x0A,0x80,0x33,0x30,0x42,0x1E,0x83,0x03,0x3A,0x03,0x1D,0xAC,0x28,0x01,0x30,
+   0x41,0x1B,0x80,0x22,0x30,0x42,0x0B,0x83,0x02,0x3A,0x03,0x1D,0xB8,0x28,0x02,0x30,
+   0x41,0x0B,0x80,0x11,0x30,0x42,0x0B,0x83,0x01,0x3A,0x03,0x1D,0xC7,0x28,0x0D,0x30,
+   0x40,0x36,0x80,0x03,0x30,0x41,0x0E,0x80,0x44,0x30,0x42,0x0E,0x83,0x40,0x3A,0x03,
+   0x1D,0x5B,0x2C,0x07,0x30,0x42,0x42,0x8B,0xF6,0x00,0x6D,0x30,0xF7,0x00,0x00,0x30,
+   0x86,0x31,0x1D,0x26,0x88,0x31,0x21,0x00,0x30,0x10,0x21,0x00,0xB3,0x16,0x33,0x15,
+   0x43,0x3F,0x80,0x33,0x3A,0x40,0x47,0x88,0x21,0x00,0xBA,0x01,0x5B,0x2C,0x01,0x30,
+   0xF6,0x00,0x20,0x00,0x6A,0x08,0xF7,0x00,0x6B,0x08,0x41,0x18,0x43,0x47,0x80,0x22,
+   0x3A,0x43,0x13,0x80,0x7C,0x30,0x40,0x69,0x80,0x89,0x31,0x40,0xBA,0x40,0x69,0x89,
+   0xE0,0x00,0x00,0x30,0xF7,0x00,0x60,0x08,0x6D,0x24,0x06,0x30,0x20,0x00,0x60,0x02,
+   0x03,0x18,0x1A,0x29,0x41,0xAE,0x83,0x1A,0x29,0x11,0x30,0xBD,0x00,0x04,0x30,0x40,
+   0x47,0x43,0x61,0x80,0x11,0x3A,0x43,0x25,0x80,0x77,0x30,0x45,0x25,0x40,0x59,0x82,
+   0x5D,0x08,0xF7,0x00,0x5F,0x08,0x40,0x40,0x80,0x89,0x31,0x41,0x23,0x83,0x3E,0x29,
+   0x0D,0x30,0xBD,0x00,0x05,0x30,0x4B,0x23,0x81,0x21,0x00,0x33,0x16,0x40,0x6C,0x40,
+   0xC0,0x8D,0x3B,0x02,0x03,0x18,0x7A,0x29,0x21,0x00,0x3C,0x1C,0x5C,0x29,0x85,0x30,
+   0x21,0x00,0xB0,0x00,0xD1,0x30,0x21,0x00,0xB1,0x00,0x62,0x29,0x61,0x30,0x40,0x06,
+   0x80,0x19,0x30,0x40,0x06,0x82,0x03,0x10,0x21,0x00,0x3C,0x0C,0x40,0x23,0x8C,0xF6,
+   0x3E,0xDD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xDF,0x00,0x5D,0x08,0xF6,0x00,0x5F,
+   0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x40,0x4B,0x89,0xE0,0x00,0x21,0x00,
+   0xB2,0x00,0xDB,0x29,0x04,0x30,0xF7,0x00,0x21,0x00,0x3C,0x08,0x8E,0x31,0xEE,0x26,
+   0x40,0x0B,0x88,0xDD,0x00,0xDF,0x01,0x5D,0x08,0xC2,0x3E,0xDD,0x00,0x5F,0x08,0x03,
+   0x18,0x5F,0x0F,0x8E,0x3E,0x4A,0x1E,0x80,0xB0,0x00,0x50,0x1D,0x82,0xDD,0x0A,0x03,
+   0x19,0xDF,0x0A,0x49,0x20,0x80,0xB1,0x00,0x50,0x20,0x82,0x02,0x30,0xDD,0x07,0x03,
+   0x18,0x4A,0x21,0x84,0xB2,0x00,0x6E,0x30,0x21,0x00,0xBD,0x00,0x0C,0x30,0x40,0xA2,
+   0x85,0x5B,0x2C,0x00,0x30,0x21,0x00,0x3D,0x04,0x03,0x1D,0xEA,0x29,0x41,0xA0,0x80,
+   0x88,0x30,0x42,0xAB,0x83,0x80,0x3A,0x03,0x1D,0xF6,0x29,0x07,0x30,0x41,0x13,0x80,
+   0x22,0x30,0x42,0x0B,0x84,0x20,0x3A,0x03,0x1D,0x17,0x2A,0x21,0x00,0xBC,0x0A,0x42,
+   0xB2,0x88,0x0C,0x2A,0x13,0x30,0x21,0x00,0x3C,0x02,0x03,0x1C,0x13,0x2A,0xBC,0x01,
+   0x13,0x2A,0x0B,0x30,0x41,0x06,0x82,0x35,0x2A,0xBC,0x01,0x35,0x2A,0x40,0x06,0x40,
+   0x20,0x43,0xD8,0x84,0x10,0x3A,0x03,0x1D,0x48,0x2A,0x21,0x00,0xBC,0x03,0x42,0x20,
+   0x80,0x2E,0x2A,0x42,0x20,0x83,0x44,0x2A,0x12,0x30,0xBC,0x00,0x44,0x2A,0x43,0x21,
+   0x81,0x0A,0x30,0xBC,0x00,0x40,0x79,0x85,0x05,0x3A,0x03,0x1D,0x3D,0x2A,0xBC,0x0A,
+   0xBC,0x0A,0x44,0x2A,0x40,0x07,0x84,0x06,0x3A,0x03,0x1D,0x44,0x2A,0xFE,0x30,0xBC,
+   0x07,0x42,0x30,0x80,0x44,0x30,0x42,0x30,0x83,0x40,0x3A,0x03,0x1D,0x5B,0x2C,0x13,
+   0x30,0x40,0x96,0x80,0x3B,0x08,0x40,0x96,0x80,0x8A,0x31,0x40,0x0B,0x40,0x1B,0x84,
+   0x20,0x00,0xDD,0x07,0x5D,0x08,0x87,0x31,0xA0,0x27,0x40,0x09,0x83,0xE4,0x00,0x77,
+   0x08,0xE3,0x00,0x20,0x00,0x40,0x96,0x84,0x20,0x00,0x63,0x08,0xF7,0x00,0x64,0x08,
+   0xAD,0x24,0x42,0x0B,0x41,0x95,0x80,0x0D,0x30,0x41,0x2F,0x42,0x56,0x84,0x94,0x2A,
+   0x21,0x00,0x3C,0x1C,0x8A,0x2A,0x00,0x30,0x43,0x19,0x84,0x86,0x31,0x1D,0x26,0x8A,
+   0x31,0xD9,0x2A,0x01,0x30,0x47,0x09,0x44,0xDA,0x41,0x43,0x47,0xDA,0x80,0x03,0x30,
+   0x48,0xDA,0x40,0x16,0x84,0xE0,0x00,0x04,0x30,0x60,0x02,0x03,0x18,0xC2,0x2A,0x48,
+   0x2D,0x84,0x20,0x00,0x60,0x08,0x07,0x3A,0x03,0x1D,0xD0,0x2A,0x40,0x0C,0x40,0x2D,
+   0x84,0x00,0x30,0xF7,0x00,0x5D,0x08,0x6D,0x24,0xD9,0x2A,0x47,0x4F,0x41,0x67,0x80,
+   0x0E,0x30,0x41,0x67,0x4B,0x8F,0x87,0x21,0x00,0x3D,0x08,0x03,0x1D,0xF4,0x2A,0x21,
+   0x00,0xBA,0x01,0x5B,0x2C,0x88,0x30,0x41,0xAB,0x83,0xDF,0x00,0x80,0x3A,0x03,0x1D,
+   0x00,0x2B,0x42,0xB7,0x99,0x21,0x00,0xBE,0x1E,0x16,0x2B,0x20,0x00,0xE3,0x0A,0x03,
+   0x19,0xE4,0x0A,0x64,0x08,0x80,0x3E,0x7D,0x3E,0x03,0x1D,0x0E,0x2B,0xE9,0x30,0x63,
+   0x02,0x03,0x1C,0x2C,0x2B,0x09,0x30,0x20,0x00,0xE3,0x07,0x03,0x18,0xE4,0x0A,0x2C,
+   0x2B,0x21,0x00,0x3E,0x1E,0x43,0x2B,0xFF,0x30,0x40,0x08,0x81,0x03,0x1C,0xE4,0x03,
+   0x42,0x16,0x80,0x25,0x2B,0x42,0x16,0x80,0xF7,0x30,0x42,0x0D,0x4A,0xC6,0x86,0x1F,
+   0x30,0x28,0x00,0x1D,0x02,0x03,0x1C,0x3F,0x2B,0xF8,0x30,0x9D,0x07,0x42,0xCA,0x42,
+   0xFA,0x80,0xDF,0x00,0x40,0xFA,0x80,0xA4,0x2B,0x40,0x68,0x82,0x06,0x3A,0x03,0x1D,
+   0x96,0x2B,0x40,0x66,0x80,0x0A,0x3A,0x40,0x04,0x40,0x84,0x40,0x8B,0x87,0x77,0x30,
+   0x87,0x31,0x63,0x27,0x8B,0x31,0x20,0x00,0xEE,0x01,0xEF,0x01,0x20,0x00,0x40,0x42,
+   0x86,0x80,0x3E,0x03,0x1D,0x68,0x2B,0x06,0x30,0x63,0x02,0x03,0x18,0x96,0x2B,0x41,
+   0xA2,0x80,0xDF,0x00,0x40,0x8D,0x80,0x5F,0x08,0x40,0x8C,0x40,0x16,0x82,0xE0,0x00,
+   0x87,0x31,0xA0,0x27,0x40,0x04,0x87,0xEB,0x00,0x77,0x08,0xEA,0x00,0x6A,0x08,0xF6,
+   0x00,0x6B,0x08,0xF7,0x00,0x72,0x30,0x42,0x27,0x81,0xE0,0x0A,0x60,0x08,0x42,0x11,
+   0x83,0xE0,0x00,0x77,0x08,0xDF,0x00,0x60,0x04,0x40,0x3C,0x83,0x06,0x30,0x20,0x00,
+   0xE3,0x00,0xE4,0x01,0x40,0x2B,0x82,0xF6,0x00,0x64,0x08,0xF7,0x00,0x40,0x6E,0x41,
+   0x1A,0x42,0xA3,0x89,0xFA,0x30,0x28,0x00,0x9D,0x00,0x5B,0x2C,0x00,0x30,0x21,0x00,
+   0x3D,0x04,0x03,0x1D,0xE1,0x2B,0x7F,0x30,0x42,0x25,0x90,0xDF,0x00,0x77,0x08,0xDD,
+   0x00,0xE0,0x00,0x60,0x08,0x00,0x30,0x03,0x19,0x01,0x30,0xDD,0x00,0xE1,0x00,0xE2,
+   0x01,0xE1,0x1B,0xE2,0x03,0x61,0x08,0xF6,0x00,0x62,0x08,0xF7,0x00,0x40,0x15,0x41,
+   0x41,0x8F,0x60,0x08,0x03,0x19,0xD4,0x2B,0x22,0x00,0x0C,0x10,0x0C,0x12,0x8C,0x12,
+   0x28,0x00,0x17,0x11,0x20,0x00,0x93,0x10,0xDE,0x2B,0x3C,0x30,0x21,0x00,0xAE,0x00,
+   0xAF,0x01,0x40,0x03,0x83,0xAC,0x00,0xAD,0x01,0x28,0x00,0x17,0x15,0x45,0xEC,0x82,
+   0xDD,0x00,0x88,0x3A,0x03,0x19,0x40,0xE8,0x40,0x0A,0x40,0x96,0x8D,0x20,0x00,0x6E,
+   0x08,0xF7,0x00,0x6F,0x08,0x86,0x31,0x1D,0x26,0x8B,0x31,0x21,0x00,0x3D,0x08,0x03,
+   0x1D,0xFE,0x2B,0x0D,0x30,0xBD,0x00,0x03,0x30,0x40,0x5A,0x80,0x11,0x30,0x42,0x1C,
+   0x80,0x11,0x3A,0x43,0x1C,0x81,0x01,0x30,0xF7,0x00,0x40,0xBF,0x84,0x6D,0x24,0x6E,
+   0x30,0x21,0x00,0xBD,0x00,0x08,0x30,0x41,0x70,0x41,0x6C,0x81,0x03,0x19,0x22,0x2C,
+   0x43,0x38,0x82,0x80,0x3A,0x03,0x1D,0x25,0x2C,0x41,0x1B,0x80,0x22,0x30,0x42,0x0A,
+   0x89,0x20,0x3A,0x03,0x1D,0x37,0x2C,0x21,0x00,0xBB,0x0A,0x07,0x30,0x3B,0x02,0x03,
+   0x18,0xBB,0x01,0x07,0x30,0x41,0x21,0x43,0x38,0x84,0x10,0x3A,0x03,0x1D,0x4B,0x2C,
+   0x21,0x00,0xBB,0x03,0x40,0x11,0x83,0x03,0x1C,0x47,0x2C,0x06,0x30,0xBB,0x00,0x42,
+   0x13,0x80,0x44,0x30,0x42,0x13,0x81,0x40,0x3A,0x03,0x1D,0x40,0x4C,0x80,0xBC,0x01,
+   0x42,0xB4,0x40,0x36,0x81,0x21,0x00,0x3A,0x08,0x41,0xA5,0x40,0x11,0x93,0xE0,0x00,
+   0x60,0x0C,0x03,0x18,0x68,0x2C,0x20,0x00,0x99,0x13,0x03,0x1C,0x6C,0x2C,0x20,0x00,
+   0x99,0x17,0x08,0x00,0x20,0x00,0xCD,0x00,0x77,0x08,0xCC,0x00,0x21,0x00,0x33,0x16,
+   0xB3,0x16,0x33,0x15,0xB3,0x14,0x40,0xE3,0xA1,0x4D,0x02,0x03,0x18,0x94,0x2C,0x19,
+   0x30,0x21,0x00,0xB0,0x00,0xDD,0x30,0x21,0x00,0xB1,0x00,0x20,0x00,0x4D,0x08,0xF6,
+   0x3E,0xCD,0x00,0x87,0x30,0x03,0x18,0x01,0x3E,0xCF,0x00,0x4D,0x08,0xF6,0x00,0x4F,
+   0x08,0xF7,0x00,0x80,0x30,0x87,0x31,0xC7,0x27,0x8C,0x31,0x21,0x00,0xB2,0x00,0xAC,
+   0x2C,0x00,0x30,0x20,0x00,0x4C,0x04,0x03,0x19,0xA3,0x2C,0x61,0x30,0x40,0x1D,0x80,
+   0x09,0x30,0x40,0x1D,0x80,0xC9,0x30,0x41,0x0E,0x40,0x03,0x81,0xB0,0x00,0xD1,0x30,
+   0x40,0x09,0x80,0xFF,0x30,0x40,0x09,0x40,0x3F,0xC0,0xD4,0x00,0x77,0x08,0xD3,0x00,
+   0x76,0x08,0xD5,0x00,0xD6,0x01,0xD7,0x01,0xE7,0x30,0xD8,0x00,0x03,0x30,0xD9,0x00,
+   0x72,0x30,0x55,0x02,0x03,0x18,0xD3,0x2C,0x55,0x08,0xDA,0x00,0x13,0x30,0x20,0x00,
+   0x5A,0x02,0x03,0x1C,0xC7,0x2C,0xED,0x30,0xDA,0x07,0xBF,0x2C,0x20,0x00,0x5A,0x18,
+   0x52,0x2D,0x70,0x30,0xD6,0x00,0xFE,0x30,0xD7,0x00,0xC4,0x30,0xD8,0x00,0x09,0x30,
+   0xD9,0x00,0x52,0x2D,0x8E,0x30,0x20,0x00,0xD5,0x07,0x04,0x30,0xF7,0x00,0x55,0x08,
+   0x8E,0x31,0xEE,0x26,0x8C,0x31,0x20,0x00,0xDA,0x00,0xDB,0x01,0x5A,0x08,0xC2,0x3E,
+   0xD5,0x00,0x8E,0x30,0xDC,0x00,0x5B,0x08,0x03,0x18,0x5B,0x0F,0xDC,0x07,0x03,0x30,
+   0xD5,0x07,0x03,0x18,0xDC,0x0A,0x55,0x08,0xF6,0x00,0x5C,0x08,0x43,0x62,0x40,0x17,
+   0x82,0x5A,0x08,0x03,0x1D,0x02,0x2D,0x47,0x2E,0x8B,0x20,0x00,0x5A,0x08,0x01,0x3A,
+   0x03,0x1D,0x0F,0x2D,0x9C,0x30,0xD6,0x00,0xFF,0x30,0xD7,0x00,0x64,0x30,0xD8,0x00,
+   0xD9,0x01,0x41,0x0C,0x83,0x09,0x3A,0x03,0x1D,0x18,0x2D,0x01,0x30,0x43,0x08,0x82,
+   0x02,0x3A,0x03,0x1D,0x21,0x2D,0x44,0x11,0x83,0x04,0x3A,0x03,0x1D,0x2A,0x2D,0x0F,
+   0x30,0x43,0x08,0x87,0x03,0x3A,0x03,0x1D,0x38,0x2D,0xE0,0x30,0xD6,0x00,0xFC,0x30,
+   0xD7,0x00,0x20,0x30,0x41,0x7D,0x41,0x0D,0x83,0x05,0x3A,0x03,0x1D,0x41,0x2D,0x08,
+   0x30,0x43,0x16,0x83,0x06,0x3A,0x03,0x1D,0x4A,0x2D,0x3C,0x30,0x43,0x08,0x83,0x07,
+   0x3A,0x03,0x1D,0x52,0x2D,0x06,0x30,0x40,0x08,0x8C,0x20,0x00,0x58,0x08,0xF3,0x00,
+   0x59,0x08,0xF4,0x00,0x56,0x08,0xF5,0x00,0x57,0x08,0xF6,0x00,0x53,0x08,0xF7,0x00,
+   0x54,0x08,0x66,0x25,0x42,0xB1,0x40,0x06,0x43,0xF8,0x99,0x76,0x08,0xCF,0x00,0x75,
+   0x08,0xCE,0x00,0x74,0x08,0xD1,0x00,0x73,0x08,0xD0,0x00,0x51,0x08,0x80,0x3E,0xD2,
+   0x00,0x4D,0x08,0x80,0x3E,0x52,0x02,0x03,0x1D,0x7C,0x2D,0x4C,0x08,0x50,0x02,0x03,
+   0x18,0x83,0x2D,0x20,0x00,0x4E,0x08,0xF7,0x00,0x4F,0x08,0x99,0x2D,0x20,0x00,0x40,
+   0x0E,0x81,0xD2,0x00,0x4F,0x08,0x41,0x11,0x88,0x8E,0x2D,0x4E,0x08,0x4C,0x02,0x03,
+   0x18,0x95,0x2D,0x20,0x00,0x50,0x08,0xF7,0x00,0x51,0x08,0x40,0x11,0x86,0x4C,0x08,
+   0xF7,0x00,0x4D,0x08,0x08,0x00,0x1A,0x30,0xF6,0x00,0x8E,0x30,0x41,0xAD,0xA0,0xD9,
+   0x27,0x8D,0x31,0x21,0x00,0xA1,0x00,0x77,0x08,0xA0,0x00,0x1C,0x30,0xA2,0x00,0x8E,
+   0x30,0xA3,0x00,0x21,0x00,0x20,0x08,0xA4,0x00,0x21,0x08,0xA5,0x00,0xFF,0x30,0xA0,
+   0x07,0x03,0x1C,0xA1,0x03,0x24,0x08,0x25,0x04,0x03,0x19,0x17,0x2E,0x04,0x30,0x22,
+   0x07,0xA4,0x00,0xA5,0x01,0xA5,0x0D,0x23,0x08,0xA5,0x07,0x24,0x08,0xF6,0x00,0x25,
+   0x08,0x44,0x23,0x85,0xA7,0x00,0x77,0x08,0xA6,0x00,0x22,0x08,0xF6,0x00,0x23,0x08,
+   0x44,0x0B,0x85,0xA9,0x00,0xA5,0x00,0x77,0x08,0xA8,0x00,0xA4,0x00,0x02,0x30,0x4D,
+   0x20,0x94,0xA5,0x00,0xAB,0x00,0x77,0x08,0xA4,0x00,0xAA,0x00,0x21,0x00,0x26,0x08,
+   0xAA,0x00,0x27,0x08,0xAB,0x00,0xFF,0x30,0xA6,0x07,0x03,0x1C,0xA7,0x03,0x2A,0x08,
+   0x2B,0x04,0x03,0x19,0x11,0x2E,0x28,0x08,0xF6,0x00,0x29,0x08,0x41,0x1A,0xA4,0xC7,
+   0x27,0x8E,0x31,0x21,0x00,0xAA,0x00,0x24,0x08,0x84,0x00,0x25,0x08,0x85,0x00,0x2A,
+   0x08,0x80,0x00,0xA8,0x0A,0x03,0x19,0xA9,0x0A,0xA4,0x0A,0x03,0x19,0xA5,0x0A,0xED,
+   0x2D,0x06,0x30,0x21,0x00,0xA2,0x07,0x03,0x18,0xA3,0x0A,0xAA,0x2D,0x80,0x31,0x74,
+   0x28,0x08,0x00,0x11,0x34,0x00,0x34,0x03,0x34,0x00,0x34,0xB3,0x34,0x00,0x34,0x01,
+   0x34,0x00,0x34,0x15,0x34,0x0F,0x34,0xB4,0x34,0x41,0x05,0x88,0x0D,0x34,0x0F,0x34,
+   0x6C,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x16,0x34,0x0F,0x34,0xB5,0x34,0x41,0x0B,
+   0x82,0x17,0x34,0x0F,0x34,0xB6,0x34,0x41,0x05,0x82,0x18,0x34,0x0F,0x34,0xB7,0x34,
+   0x41,0x05,0x82,0x19,0x34,0x0F,0x34,0xB8,0x34,0x41,0x05,0x82,0x1A,0x34,0x0F,0x34,
+   0xB9,0x34,0x41,0x05,0x82,0x0F,0x34,0x0F,0x34,0x6E,0x34,0x41,0x23,0x82,0x11,0x34,
+   0x0F,0x34,0xAC,0x34,0x41,0x05,0x82,0x13,0x34,0x0F,0x34,0xAE,0x34,0x41,0x05,0x82,
+   0x1B,0x34,0x0F,0x34,0xBA,0x34,0x41,0x17,0x82,0x1C,0x34,0x0F,0x34,0xBB,0x34,0x41,
+   0x05,0x82,0x1D,0x34,0x0F,0x34,0xBC,0x34,0x41,0x05,0x82,0x1E,0x34,0x0F,0x34,0xBD,
+   0x34,0x41,0x05,0x82,0x1F,0x34,0x0F,0x34,0xBE,0x34,0x41,0x05,0x82,0x20,0x34,0x0F,
+   0x34,0xBF,0x34,0x41,0x05,0x40,0x00,0x8C,0xD5,0x34,0xFD,0x34,0xC1,0x34,0xFE,0x34,
+   0x59,0x34,0xFF,0x34,0xCF,0x34,0xFF,0x34,0x30,0x34,0x00,0x34,0x86,0x34,0x00,0x34,
+   0xD3,0x34,0x40,0x4B,0xCF,0x01,0x34,0x5C,0x34,0x01,0x34,0x9C,0x34,0x01,0x34,0xDA,
+   0x34,0x01,0x34,0x16,0x34,0x02,0x34,0x51,0x34,0x02,0x34,0x8C,0x34,0x02,0x34,0xC7,
+   0x34,0x02,0x34,0x02,0x34,0x03,0x34,0x3F,0x34,0x03,0x34,0x7D,0x34,0x03,0x34,0xBD,
+   0x34,0x03,0x34,0x01,0x34,0x04,0x34,0x48,0x34,0x04,0x34,0x94,0x34,0x04,0x34,0xE5,
+   0x34,0x04,0x34,0x3F,0x34,0x05,0x34,0xA4,0x34,0x05,0x34,0x17,0x34,0x06,0x34,0x9E,
+   0x34,0x06,0x34,0x44,0x34,0x07,0x34,0x1E,0x34,0x08,0x34,0x5D,0x34,0x09,0x34,0xAB,
+   0x34,0x0B,0x34,0x61,0x34,0x19,0x34,0xFF,0x34,0x00,0x34,0xD1,0x34,0xA1,0x34,0xFF,
+   0x34,0x02,0x34,0xC9,0x34,0xCD,0x34,0xFF,0x34,0x01,0x34,0x85,0x34,0xB7,0x34,0xFF,
+   0x34,0x04,0x34,0x61,0x34,0x11,0x34,0xFF,0x34,0x03,0x34,0x61,0x34,0xC9,0x34,0xFF,
+   0x34,0x05,0x34,0x85,0x34,0xD1,0x34,0xFF,0x34,0x08,0x34,0xCD,0x34,0x85,0x34,0xFF,
+   0x34,0x06,0x34,0xD1,0x34,0x41,0x03,0x80,0xDD,0x34,0x40,0x23,0xA3,0x09,0x34,0xDD,
+   0x34,0xD5,0x34,0xFF,0x34,0x07,0x34,0x20,0x00,0xE5,0x00,0x77,0x08,0xE6,0x00,0xE7,
+   0x01,0x08,0x30,0xE8,0x00,0x20,0x00,0x65,0x1C,0xFA,0x2E,0x66,0x08,0xE7,0x07,0x20,
+   0x00,0x65,0x08,0xE9,0x00,0x03,0x10,0x69,0x0C,0xE5,0x00,0x03,0x10,0x66,0x0D,0xE9,
+   0x00,0xE6,0x00,0x68,0x08,0xE9,0x00,0x69,0x03,0xE8,0x00,0x68,0x08,0x03,0x1D,0xF5,
+   0x2E,0x67,0x08,0x08,0x00,0x41,0x8B,0x81,0x00,0x34,0x3C,0x34,0x41,0x01,0x43,0x00,
+   0x80,0x18,0x34,0x44,0x06,0x01,0x01,0x02,0x00,0x0E,0x81,0xD4,0x0F,0xFF,0x3A,0x00
 };
 #endif
 #if INCLUDE_CELSIUS_HEX_DATA
 const char hex_eeprom_celsius[] PROGMEM = {
-   0x02,0x00,0x00,0x04,0x00,0x00,0xFA,
-   0x02,0x00,0x00,0x04,0x00,0x01,0xF9,
-   0x10,0xE0,0x00,0x00,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xF6,
-   0x10,0xE0,0x10,0x00,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,
-   0x10,0xE0,0x20,0x00,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0xCE,
-   0x10,0xE0,0x30,0x00,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x18,
-   0x10,0xE0,0x40,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x90,
-   0x10,0xE0,0x50,0x00,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x92,
-   0x10,0xE0,0x60,0x00,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x5A,
-   0x10,0xE0,0x70,0x00,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0x1E,
-   0x10,0xE0,0x80,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xF0,
-   0x10,0xE0,0x90,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x28,
-   0x10,0xE0,0xA0,0x00,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x42,
-   0x10,0xE0,0xB0,0x00,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0x92,
-   0x10,0xE0,0xC0,0x00,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x5E,
-   0x10,0xE0,0xD0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,
-   0x10,0xE0,0xE0,0x00,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x2E,
-   0x10,0xE0,0xF0,0x00,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0xDE,
-   0x10,0xE1,0x00,0x00,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x05,
-   0x10,0xE1,0x10,0x00,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x07,
-   0x10,0xE1,0x20,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x4F,
-   0x10,0xE1,0x30,0x00,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC5,
-   0x10,0xE1,0x40,0x00,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x8D,
-   0x10,0xE1,0x50,0x00,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x9D,
-   0x10,0xE1,0x60,0x00,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xE7,
-   0x10,0xE1,0x70,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x5F,
-   0x10,0xE1,0x80,0x00,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x61,
-   0x10,0xE1,0x90,0x00,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x29,
-   0x10,0xE1,0xA0,0x00,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0xED,
-   0x10,0xE1,0xB0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xBF,
-   0x10,0xE1,0xC0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x05,0x34,0x00,0x34,0xE2,
-   0x10,0xE1,0xD0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x9F,
-   0x10,0xE1,0xE0,0x00,0x00,0x34,0x00,0x34,0x05,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x88,
-   0x04,0xE1,0xF0,0x00,0x06,0x34,0x00,0x34,0xBD,
-   0x00,0x00,0x00,0x01,0xFF
+   0x01,0x00,0x01,0x01,0x02,0xE0,0x00,0x84,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,
+   0xAA,0x34,0x41,0x03,0x80,0xB4,0x34,0x41,0x03,0x80,0xBE,0x34,0x41,0x03,0x89,0xC8,
+   0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,
+   0x34,0x00,0x34,0x4A,0x00,0x7F,0x25,0x7F,0x25,0x7A,0x25,0x40,0x15,0x80,0x05,0x34,
+   0x49,0x0D,0x40,0x0B,0x80,0x02,0x34,0x41,0x05,0x81,0x06,0x34,0x00,0x34,0x00
 };
 #endif
 #if INCLUDE_FAHRENHEIT_HEX_DATA
 const char hex_eeprom_fahrenheit[] PROGMEM = {
-   0x02,0x00,0x00,0x04,0x00,0x00,0xFA,
-   0x02,0x00,0x00,0x04,0x00,0x01,0xF9,
-   0x10,0xE0,0x00,0x00,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xF6,
-   0x10,0xE0,0x10,0x00,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,
-   0x10,0xE0,0x20,0x00,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0xCE,
-   0x10,0xE0,0x30,0x00,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x18,
-   0x10,0xE0,0x40,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x90,
-   0x10,0xE0,0x50,0x00,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x92,
-   0x10,0xE0,0x60,0x00,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x5A,
-   0x10,0xE0,0x70,0x00,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0x1E,
-   0x10,0xE0,0x80,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xF0,
-   0x10,0xE0,0x90,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x28,
-   0x10,0xE0,0xA0,0x00,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x42,
-   0x10,0xE0,0xB0,0x00,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0x92,
-   0x10,0xE0,0xC0,0x00,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x5E,
-   0x10,0xE0,0xD0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,
-   0x10,0xE0,0xE0,0x00,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x2E,
-   0x10,0xE0,0xF0,0x00,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0xDE,
-   0x10,0xE1,0x00,0x00,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x05,
-   0x10,0xE1,0x10,0x00,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x07,
-   0x10,0xE1,0x20,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x4F,
-   0x10,0xE1,0x30,0x00,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC5,
-   0x10,0xE1,0x40,0x00,0xB4,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0x8D,
-   0x10,0xE1,0x50,0x00,0xC8,0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x9D,
-   0x10,0xE1,0x60,0x00,0x28,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xE7,
-   0x10,0xE1,0x70,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA0,0x34,0x00,0x34,0x5F,
-   0x10,0xE1,0x80,0x00,0x18,0x34,0x00,0x34,0xAA,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xB4,0x34,0x00,0x34,0x61,
-   0x10,0xE1,0x90,0x00,0x18,0x34,0x00,0x34,0xBE,0x34,0x00,0x34,0x18,0x34,0x00,0x34,0xC8,0x34,0x00,0x34,0x29,
-   0x10,0xE1,0xA0,0x00,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,0x34,0x00,0x34,0xED,
-   0x10,0xE1,0xB0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xBF,
-   0x10,0xE1,0xC0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0xA8,0x34,0x02,0x34,0x0A,0x34,0x00,0x34,0xFB,
-   0x10,0xE1,0xD0,0x00,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x9F,
-   0x10,0xE1,0xE0,0x00,0x00,0x34,0x00,0x34,0x05,0x34,0x00,0x34,0x02,0x34,0x00,0x34,0x00,0x34,0x00,0x34,0x88,
-   0x04,0xE1,0xF0,0x00,0x06,0x34,0x00,0x34,0xBD,
-   0x00,0x00,0x00,0x01,0xFF
+   0x01,0x00,0x01,0x01,0x02,0xE0,0x00,0x84,0xA0,0x34,0x00,0x34,0x18,0x34,0x00,0x34,
+   0xAA,0x34,0x41,0x03,0x80,0xB4,0x34,0x41,0x03,0x80,0xBE,0x34,0x41,0x03,0x89,0xC8,
+   0x34,0x00,0x34,0x90,0x34,0x00,0x34,0xFA,0x34,0x00,0x34,0x30,0x34,0x00,0x34,0x28,
+   0x34,0x00,0x34,0x4A,0x00,0x7F,0x25,0x7F,0x25,0x7A,0x25,0x82,0xA8,0x34,0x02,0x34,
+   0x0A,0x34,0x49,0x0D,0x82,0x05,0x34,0x00,0x34,0x02,0x34,0x41,0x05,0x81,0x06,0x34,
+   0x00,0x34,0x00
 };
 #endif
@@ -0,0 +1,12 @@
+var stc1000p_manifest={"version":109, "eeprom_version":12, "variants":{
+	"":"firmware/stc1000p.js",
+	"_com":"firmware/stc1000p_com.js",
+	"_fo433":"firmware/stc1000p_fo433.js",
+	"_minute":"firmware/stc1000p_minute.js",
+	"_minute_com":"firmware/stc1000p_minute_com.js",
+	"_minute_fo433":"firmware/stc1000p_minute_fo433.js",
+	"_minute_probe2":"firmware/stc1000p_minute_probe2.js",
+	"_ovbsc":"firmware/stc1000p_ovbsc.js",
+	"_probe2":"firmware/stc1000p_probe2.js",
+	"_rh":"firmware/stc1000p_rh.js",
+}};
@@ -0,0 +1,989 @@
+stc1000p_loaded("picprog", '' +
+'/*\n' +
+' * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.\n' +
+' *\n' +
+' * Copyright 2014 Mats Staffansson\n' +
+' *\n' +
+' * This file is part of STC1000+.\n' +
+' *\n' +
+' * STC1000+ is free software: you can redistribute it and/or modify\n' +
+' * it under the terms of the GNU General Public License as published by\n' +
+' * the Free Software Foundation, either version 3 of the License, or\n' +
+' * (at your option) any later version.\n' +
+' *\n' +
+' * STC1000+ is distributed in the hope that it will be useful,\n' +
+' * but WITHOUT ANY WARRANTY; without even the implied warranty of\n' +
+' * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n' +
+' * GNU General Public License for more details.\n' +
+' *\n' +
+' * You should have received a copy of the GNU General Public License\n' +
+' * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.\n' +
+' *\n' +
+' * The idea of an Arduino based PIC programmer came from here\n' +
+' * http://forum.arduino.cc/index.php?topic=92929.0\n' +
+' * but was completely rewritten.\n' +
+' *\n' +
+' * This sketch allows the generated HEX file for the STC-1000 to be uploaded\n' +
+' * from the Arduino by sending it over serial. I use CuteCom under linux to upload the\n' +
+' * file, which works wonderfully. It allows to set a character delay, to not overrun the\n' +
+' * buffer. If you should use another software that does not have this feature you may\n' +
+' * need to lower the baudrate significantly.\n' +
+' *\n' +
+' * Alternatively, the \'x\' and \'y\' commands accept the HEX file in a binary, flow\n' +
+' * controlled format (see tools/hexupload.cpp), which needs no character delay.\n' +
+' *\n' +
+' */\n' +
+'\n' +
+'/* User configurable defines */\n' +
+'\n' +
+'/* Set to 0 to omit Fahrenheit version from sketch */\n' +
+'#define INCLUDE_FAHRENHEIT_HEX_DATA		1\n' +
+'/* Set to 0 to omit Celsius version from sketch */\n' +
+'#define INCLUDE_CELSIUS_HEX_DATA		1\n' +
+'\n' +
+'/* Set to 1 to enable automatic upload of Fahrenheit version */\n' +
+'#define AUTOMATIC_UPLOAD_FAHRENHEIT		0\n' +
+'/* Set to 1 to enable automatic upload of Celsius version */\n' +
+'#define AUTOMATIC_UPLOAD_CELSIUS		0\n' +
+'\n' +
+'/* End of user configurable defines - DO NOT EDIT BEYOND THIS POINT - unless you know what you\'re doing that is... */\n' +
+'\n' +
+'/* Sanity check */\n' +
+'\n' +
+'#if AUTOMATIC_UPLOAD_FAHRENHEIT && AUTOMATIC_UPLOAD_CELSIUS\n' +
+'#error "Cannot automatically upload both versions, set *just one* of AUTOMATIC_UPLOAD_FAHRENHEIT or AUTOMATIC_UPLOAD_CELSIUS."\n' +
+'#endif\n' +
+'\n' +
+'#if !INCLUDE_FAHRENHEIT_HEX_DATA && !INCLUDE_CELSIUS_HEX_DATA\n' +
+'#error "No HEX data selected, set *at least one* of INCLUDE_FAHRENHEIT_HEX_DATA or INCLUDE_CELSIUS_HEX_DATA to 1."\n' +
+'#endif\n' +
+'\n' +
+'#if AUTOMATIC_UPLOAD_FAHRENHEIT && !INCLUDE_FAHRENHEIT_HEX_DATA\n' +
+'#error "To automatically upload Fahrenheit version, INCLUDE_FAHRENHEIT_HEX_DATA must be set to 1."\n' +
+'#endif\n' +
+'\n' +
+'#if AUTOMATIC_UPLOAD_CELSIUS && !INCLUDE_CELSIUS_HEX_DATA\n' +
+'#error "To automatically upload Celsius version, INCLUDE_CELSIUS_HEX_DATA must be set to 1."\n' +
+'#endif\n' +
+'\n' +
+'/* Define STC-1000+ version number (XYY, X=major, YY=minor) and EEROM revision */\n' +
+'#define STC1000P_MAGIC_F		0x192C\n' +
+'#define STC1000P_MAGIC_C		0x26D3\n' +
+'#define STC1000P_VERSION			(109)\n' +
+'#define STC1000P_EEPROM_VERSION		(12)\n' +
+'\n' +
+'/* Pin configuration */\n' +
+'#define ICSPCLK 9\n' +
+'#define ICSPDAT 8 \n' +
+'#define VDD1    6\n' +
+'#define VDD2    5\n' +
+'#define VDD3    4\n' +
+'#define nMCLR   3 \n' +
+'\n' +
+'/* Delays */\n' +
+'#define TDLY()  delayMicroseconds(1)    /* 1.0us minimum */\n' +
+'#define TCKH()  delayMicroseconds(1)    /* 100ns minimum */\n' +
+'#define TCKL()  delayMicroseconds(1)    /* 100ns minimum */\n' +
+'#define TERAB() delay(5)    		    /* 5ms maximum */\n' +
+'#define TERAR() delay(3)    		    /* 2.5ms maximum */\n' +
+'#define TPINT() delay(5)    		    /* 5ms maximum */\n' +
+'#define TPEXT() delay(2)                /* 1.0ms minimum, 2.1ms maximum*/\n' +
+'#define TDIS()  delayMicroseconds(1)    /* 300ns minimum */\n' +
+'#define TENTS() delayMicroseconds(1)    /* 100ns minimum */\n' +
+'#define TENTH() delay(3)  		        /* 250us minimum */ /* Needs a lot more when powered by arduino */\n' +
+'#define TEXIT() delayMicroseconds(1)    /* 1us minimum */\n' +
+'\n' +
+'/* Commands */\n' +
+'#define LOAD_CONFIGURATION                  0x00    /* 0, data(14), 0 */\n' +
+'#define LOAD_DATA_FOR_PROGRAM_MEMORY        0x02    /* 0, data(14), 0 */\n' +
+'#define LOAD_DATA_FOR_DATA_MEMORY           0x03    /* 0, data(14), zero(6), 0 */\n' +
+'#define READ_DATA_FROM_PROGRAM_MEMORY       0x04    /* 0, data(14), 0 */\n' +
+'#define READ_DATA_FROM_DATA_MEMORY          0x05    /* 0, data(14), zero(6), 0 */\n' +
+'#define INCREMENT_ADDRESS                   0x06    /* - */\n' +
+'#define RESET_ADDRESS                       0x16    /* - */\n' +
+'#define BEGIN_INTERNALLY_TIMED_PROGRAMMING  0x08    /* - */\n' +
+'#define BEGIN_EXTERNALLY_TIMED_PROGRAMMING  0x18    /* - */\n' +
+'#define END_EXTERNALLY_TIMED_PROGRAMMING    0x0A    /* - */\n' +
+'#define BULK_ERASE_PROGRAM_MEMORY           0x09    /* Internally Timed */\n' +
+'#define BULK_ERASE_DATA_MEMORY              0x0B    /* Internally Timed */\n' +
+'#define ROW_ERASE_PROGRAM_MEMORY            0x11    /* Internally Timed */\n' +
+'\n' +
+'/* Packed image format, see tools/pack.h */\n' +
+'#define PACK_END			0x00\n' +
+'#define PACK_EXT_ADDR		0x01\n' +
+'#define PACK_ADDR			0x02\n' +
+'#define PACK_COPY			0x40\n' +
+'#define PACK_LITERAL		0x80\n' +
+'\n' +
+'/* declare (packed) hex data */\n' +
+'/* For some reason PROGMEM messes with conditional compilation, */\n' +
+'/* so better not put #if INCLUDE_???_HEX_DATA around these */\n' +
+'extern const char hex_celsius[] PROGMEM;\n' +
+'extern const char hex_eeprom_celsius[] PROGMEM;\n' +
+'extern const char hex_fahrenheit[] PROGMEM;\n' +
+'extern const char hex_eeprom_fahrenheit[] PROGMEM;\n' +
+'\n' +
+'/* Binary upload protocol, see tools/hexupload.cpp */\n' +
+'#define BIN_SOH			0x01\n' +
+'#define BIN_ACK			0x06\n' +
+'#define BIN_NAK			0x15\n' +
+'#define BIN_ERR			0x18\n' +
+'#define BIN_WINDOW		2\n' +
+'#define BIN_BYTE_TIMEOUT	50		/* ms */\n' +
+'#define BIN_IDLE_TIMEOUT	5000	/* ms */\n' +
+'\n' +
+'/* Set to 0 to suppress progress output (needed in binary mode) */\n' +
+'unsigned char verbose = 1;\n' +
+'\n' +
+'unsigned char hex_nibble(unsigned char data) {\n' +
+'	data = toupper(data);\n' +
+'	return (data >= \'A\' ? data - \'A\' + 10 : data - \'0\') & 0xf;\n' +
+'}\n' +
+'\n' +
+'unsigned char parse_hex() {\n' +
+'	unsigned char data;\n' +
+'	while (Serial.available() < 2)\n' +
+'		;\n' +
+'	data = hex_nibble(Serial.read()) << 4;\n' +
+'	data |= hex_nibble(Serial.read());\n' +
+'\n' +
+'	return data;\n' +
+'}\n' +
+'\n' +
+'unsigned char handle_hex_file_line(unsigned char bytecount,\n' +
+'		unsigned int address, unsigned char recordtype, unsigned char data[]) {\n' +
+'	static unsigned int device_address = 0;\n' +
+'	unsigned char i;\n' +
+'\n' +
+'	if (recordtype == 1) {\n' +
+'		reset_address();\n' +
+'		device_address = 0;\n' +
+'		if (verbose) {\n' +
+'			Serial.println("Programming done");\n' +
+'		}\n' +
+'		return 1;\n' +
+'	} else if (recordtype == 04) {\n' +
+'		if (data[1] == 0) {\n' +
+'			if (verbose) {\n' +
+'				Serial.println("Programming program memory");\n' +
+'			}\n' +
+'			reset_address();\n' +
+'			device_address = 0;\n' +
+'		} else if (data[1] == 1) {\n' +
+'			if (verbose) {\n' +
+'				Serial.println("Programming config memory");\n' +
+'			}\n' +
+'			load_configuration(0);\n' +
+'			device_address = 0;\n' +
+'		}\n' +
+'	} else if (recordtype == 00) {\n' +
+'		if (address >= 0xE000) {\n' +
+'			if (verbose) {\n' +
+'				Serial.print("Programming ");\n' +
+'				Serial.print(bytecount >> 1, DEC);\n' +
+'				Serial.print(" bytes at EEPROM address 0x");\n' +
+'				Serial.println((address & 0x1FFF) >> 1, HEX);\n' +
+'			}\n' +
+'\n' +
+'			if (device_address != ((address & 0x1FFF) >> 1)\n' +
+'					|| ((address & 0x1FFF) >> 1) == 0) {\n' +
+'				if (verbose) {\n' +
+'					Serial.println("Resetting address for EEPROM");\n' +
+'				}\n' +
+'				reset_address();\n' +
+'				device_address = 0;\n' +
+'			}\n' +
+'			while (device_address != ((address & 0x1FFF) >> 1)) {\n' +
+'				increment_address();\n' +
+'				device_address++;\n' +
+'				if (verbose) {\n' +
+'					Serial.print("Incrementing address to 0x");\n' +
+'					Serial.println(device_address, HEX);\n' +
+'				}\n' +
+'			}\n' +
+'\n' +
+'			for (i = 0; i < bytecount; i += 2) {\n' +
+'				unsigned char data_out = data[i];\n' +
+'				unsigned char data_in;\n' +
+'				load_data_for_data_memory(data_out);\n' +
+'				begin_internally_timed_programming();\n' +
+'				data_in = read_data_from_data_memory();\n' +
+'				if (data_in != data_out) {\n' +
+'					if (verbose) {\n' +
+'						Serial.print("Validation failed for EEPROM address 0x");\n' +
+'						Serial.print(device_address, HEX);\n' +
+'						Serial.print(" wrote 0x");\n' +
+'						Serial.print(data_out, HEX);\n' +
+'						Serial.print(" but read back 0x");\n' +
+'						Serial.println(data_in, HEX);\n' +
+'					}\n' +
+'					return 2;\n' +
+'				}\n' +
+'				increment_address();\n' +
+'				device_address++;\n' +
+'			}\n' +
+'		} else {\n' +
+'			if (verbose) {\n' +
+'				Serial.print("Programming ");\n' +
+'				Serial.print(bytecount >> 1, DEC);\n' +
+'				Serial.print(" words at address 0x");\n' +
+'				Serial.println(address >> 1, HEX);\n' +
+'			}\n' +
+'\n' +
+'			while (device_address != (address >> 1)) {\n' +
+'				increment_address();\n' +
+'				device_address++;\n' +
+'				if (verbose) {\n' +
+'					Serial.print("Incrementing address to 0x");\n' +
+'					Serial.println(device_address, HEX);\n' +
+'				}\n' +
+'			}\n' +
+'\n' +
+'			for (i = 0; i < bytecount; i += 2) {\n' +
+'				unsigned int data_word_out = (((unsigned int) data[i + 1]) << 8)\n' +
+'						| data[i];\n' +
+'				unsigned int data_word_in;\n' +
+'				load_data_for_program_memory(data_word_out);\n' +
+'				begin_internally_timed_programming();\n' +
+'				data_word_in = read_data_from_program_memory();\n' +
+'				if (data_word_in != data_word_out) {\n' +
+'					if (verbose) {\n' +
+'						Serial.print("Validation failed for address 0x");\n' +
+'						Serial.print(device_address, HEX);\n' +
+'						Serial.print(" wrote 0x");\n' +
+'						Serial.print(data_word_out, HEX);\n' +
+'						Serial.print(" but read back 0x");\n' +
+'						Serial.println(data_word_in, HEX);\n' +
+'					}\n' +
+'					return 2;\n' +
+'				}\n' +
+'				increment_address();\n' +
+'				device_address++;\n' +
+'			}\n' +
+'		}\n' +
+'	}\n' +
+'	return 0;\n' +
+'}\n' +
+'\n' +
+'void upload_hex_file_to_device() {\n' +
+'	unsigned char done = 0;\n' +
+'\n' +
+'	Serial.println("Waiting for hex data...");\n' +
+'\n' +
+'	while (!done) {\n' +
+'		unsigned char bytecount;\n' +
+'		unsigned int address;\n' +
+'		unsigned char recordtype;\n' +
+'		unsigned char data[16];\n' +
+'		unsigned char checksum;\n' +
+'		unsigned char i;\n' +
+'\n' +
+'		// Read start of line\n' +
+'		while (1) {\n' +
+'			while (Serial.available() < 1)\n' +
+'				;\n' +
+'			char rx = Serial.read();\n' +
+'			if (rx == \':\') {\n' +
+'				break;\n' +
+'			}\n' +
+'		}\n' +
+'\n' +
+'		// Read bytecount\n' +
+'		bytecount = parse_hex();\n' +
+'		checksum = bytecount;\n' +
+'\n' +
+'		// Read address\n' +
+'		address = ((unsigned int) parse_hex()) << 8;\n' +
+'		address |= parse_hex();\n' +
+'		checksum += ((unsigned char) (address >> 8));\n' +
+'		checksum += ((unsigned char) (address));\n' +
+'\n' +
+'		// Read recordtype\n' +
+'		recordtype = parse_hex();\n' +
+'		checksum += recordtype;\n' +
+'\n' +
+'		for (i = 0; i < bytecount; i++) {\n' +
+'			data[i] = parse_hex();\n' +
+'			checksum += data[i];\n' +
+'		}\n' +
+'\n' +
+'		// Read checksum\n' +
+'		i = parse_hex();\n' +
+'		checksum += i;\n' +
+'\n' +
+'		if (checksum) {\n' +
+'			Serial.println("Checksum error!");\n' +
+'			break;\n' +
+'		}\n' +
+'\n' +
+'		done = handle_hex_file_line(bytecount, address, recordtype, data);\n' +
+'	}\n' +
+'}\n' +
+'\n' +
+'unsigned int crc16_update(unsigned int crc, unsigned char data) {\n' +
+'	unsigned char i;\n' +
+'\n' +
+'	crc ^= ((unsigned int) data) << 8;\n' +
+'	for (i = 0; i < 8; i++) {\n' +
+'		if (crc & 0x8000) {\n' +
+'			crc = (crc << 1) ^ 0x1021;\n' +
+'		} else {\n' +
+'			crc <<= 1;\n' +
+'		}\n' +
+'	}\n' +
+'	return crc;\n' +
+'}\n' +
+'\n' +
+'/* Read a byte from serial, return -1 if none arrives within timeout ms */\n' +
+'int read_byte_timeout(unsigned int timeout) {\n' +
+'	unsigned long start = millis();\n' +
+'\n' +
+'	while (Serial.available() < 1) {\n' +
+'		if (millis() - start > timeout) {\n' +
+'			return -1;\n' +
+'		}\n' +
+'	}\n' +
+'	return Serial.read();\n' +
+'}\n' +
+'\n' +
+'/* Receive one binary frame.\n' +
+' * SOH, seq, bytecount, address (high, low), recordtype, data[bytecount], CRC16 (high, low)\n' +
+' * return: 1 if a valid frame was received, 0 on error, -1 if host went quiet\n' +
+' */\n' +
+'signed char receive_binary_frame(unsigned char *seq, unsigned char *bytecount,\n' +
+'		unsigned int *address, unsigned char *recordtype, unsigned char data[]) {\n' +
+'	unsigned char header[5];\n' +
+'	unsigned int crc = 0xFFFF;\n' +
+'	unsigned char i;\n' +
+'	int rx;\n' +
+'\n' +
+'	// Wait for start of frame\n' +
+'	do {\n' +
+'		rx = read_byte_timeout(BIN_IDLE_TIMEOUT);\n' +
+'		if (rx < 0) {\n' +
+'			return -1;\n' +
+'		}\n' +
+'	} while (rx != BIN_SOH);\n' +
+'\n' +
+'	for (i = 0; i < 5; i++) {\n' +
+'		if ((rx = read_byte_timeout(BIN_BYTE_TIMEOUT)) < 0) {\n' +
+'			return 0;\n' +
+'		}\n' +
+'		header[i] = rx;\n' +
+'		crc = crc16_update(crc, header[i]);\n' +
+'	}\n' +
+'\n' +
+'	*seq = header[0];\n' +
+'	*bytecount = header[1];\n' +
+'	*address = (((unsigned int) header[2]) << 8) | header[3];\n' +
+'	*recordtype = header[4];\n' +
+'\n' +
+'	if (*bytecount > 16) {\n' +
+'		return 0;\n' +
+'	}\n' +
+'\n' +
+'	for (i = 0; i < *bytecount; i++) {\n' +
+'		if ((rx = read_byte_timeout(BIN_BYTE_TIMEOUT)) < 0) {\n' +
+'			return 0;\n' +
+'		}\n' +
+'		data[i] = rx;\n' +
+'		crc = crc16_update(crc, data[i]);\n' +
+'	}\n' +
+'\n' +
+'	for (i = 0; i < 2; i++) {\n' +
+'		if ((rx = read_byte_timeout(BIN_BYTE_TIMEOUT)) < 0) {\n' +
+'			return 0;\n' +
+'		}\n' +
+'		crc ^= ((unsigned int) rx) << (i ? 0 : 8);\n' +
+'	}\n' +
+'\n' +
+'	return crc == 0;\n' +
+'}\n' +
+'\n' +
+'void send_response(unsigned char response, unsigned char seq) {\n' +
+'	Serial.write(response);\n' +
+'	Serial.write(seq);\n' +
+'}\n' +
+'\n' +
+'/* Receive the HEX file as binary frames, with windowed acknowledgement.\n' +
+' * The host may have up to BIN_WINDOW frames in flight, which fits the\n' +
+' * serial receive buffer, so no character delay is needed.\n' +
+' */\n' +
+'void upload_binary_to_device() {\n' +
+'	unsigned char expected = 0;\n' +
+'	unsigned char done = 0;\n' +
+'\n' +
+'	Serial.println("Waiting for binary data...");\n' +
+'	Serial.flush();\n' +
+'	verbose = 0;\n' +
+'\n' +
+'	while (!done) {\n' +
+'		unsigned char seq;\n' +
+'		unsigned char bytecount;\n' +
+'		unsigned int address;\n' +
+'		unsigned char recordtype;\n' +
+'		unsigned char data[16];\n' +
+'		signed char rv;\n' +
+'\n' +
+'		rv = receive_binary_frame(&seq, &bytecount, &address, &recordtype, data);\n' +
+'\n' +
+'		if (rv < 0) {\n' +
+'			verbose = 1;\n' +
+'			Serial.println("Timeout waiting for data!");\n' +
+'			return;\n' +
+'		}\n' +
+'\n' +
+'		if (rv == 0) {\n' +
+'			// Drop anything in flight and ask for retransmission\n' +
+'			while (read_byte_timeout(BIN_BYTE_TIMEOUT) >= 0)\n' +
+'				;\n' +
+'			send_response(BIN_NAK, expected);\n' +
+'			continue;\n' +
+'		}\n' +
+'\n' +
+'		if (seq != expected) {\n' +
+'			// Acknowledge again if already programmed (lost ACK), else drop it\n' +
+'			if ((unsigned char) (expected - seq) <= BIN_WINDOW) {\n' +
+'				send_response(BIN_ACK, seq);\n' +
+'			}\n' +
+'			continue;\n' +
+'		}\n' +
+'\n' +
+'		done = handle_hex_file_line(bytecount, address, recordtype, data);\n' +
+'		send_response(done == 2 ? BIN_ERR : BIN_ACK, seq);\n' +
+'		expected++;\n' +
+'	}\n' +
+'\n' +
+'	Serial.flush();\n' +
+'	verbose = 1;\n' +
+'	Serial.println(done == 2 ? "Validation failed!" : "Programming done");\n' +
+'}\n' +
+'\n' +
+'/* Decode a packed image from PROGMEM and program it.\n' +
+' * Words are collected into records of 16 bytes and passed on to\n' +
+' * handle_hex_file_line(), the last 256 words are kept for copies.\n' +
+' */\n' +
+'void upload_hex_from_progmem(PGM_P hexdata) {\n' +
+'	static unsigned int history[256];\n' +
+'	unsigned char hpos = 0;\n' +
+'	unsigned char data[16];\n' +
+'	unsigned char bytecount = 0;\n' +
+'	unsigned int address = 0;\n' +
+'	unsigned char done = 0;\n' +
+'\n' +
+'	Serial.println("Programming hex data...");\n' +
+'\n' +
+'	while (!done) {\n' +
+'		unsigned char c = pgm_read_byte(hexdata++);\n' +
+'\n' +
+'		if (c & (PACK_LITERAL | PACK_COPY)) {\n' +
+'			unsigned char n, dist = 0, copy = 0;\n' +
+'\n' +
+'			if (c & PACK_LITERAL) {\n' +
+'				n = (c & 0x7F) + 1;\n' +
+'			} else {\n' +
+'				n = (c & 0x3F) + 2;\n' +
+'				dist = pgm_read_byte(hexdata++);\n' +
+'				copy = 1;\n' +
+'			}\n' +
+'\n' +
+'			while (n-- && !done) {\n' +
+'				unsigned int word;\n' +
+'				if (copy) {\n' +
+'					word = history[(unsigned char) (hpos - dist - 1)];\n' +
+'				} else {\n' +
+'					word = pgm_read_byte(hexdata++);\n' +
+'					word |= ((unsigned int) pgm_read_byte(hexdata++)) << 8;\n' +
+'				}\n' +
+'				history[hpos++] = word;\n' +
+'				data[bytecount++] = (unsigned char) word;\n' +
+'				data[bytecount++] = (unsigned char) (word >> 8);\n' +
+'				if (bytecount == 16) {\n' +
+'					done = handle_hex_file_line(bytecount, address, 0, data);\n' +
+'					address += bytecount;\n' +
+'					bytecount = 0;\n' +
+'				}\n' +
+'			}\n' +
+'		} else {\n' +
+'			// Flush partial record\n' +
+'			if (bytecount) {\n' +
+'				done = handle_hex_file_line(bytecount, address, 0, data);\n' +
+'				address += bytecount;\n' +
+'				bytecount = 0;\n' +
+'				if (done) {\n' +
+'					break;\n' +
+'				}\n' +
+'			}\n' +
+'\n' +
+'			if (c == PACK_ADDR) {\n' +
+'				address = ((unsigned int) pgm_read_byte(hexdata++)) << 8;\n' +
+'				address |= pgm_read_byte(hexdata++);\n' +
+'			} else if (c == PACK_EXT_ADDR) {\n' +
+'				data[0] = 0;\n' +
+'				data[1] = pgm_read_byte(hexdata++);\n' +
+'				done = handle_hex_file_line(2, 0, 4, data);\n' +
+'			} else {\n' +
+'				done = handle_hex_file_line(0, 0, 1, data);\n' +
+'			}\n' +
+'		}\n' +
+'	}\n' +
+'}\n' +
+'\n' +
+'/* low level bit transfer */\n' +
+'void write_bit(unsigned char bit) {\n' +
+'	digitalWrite(ICSPCLK, HIGH);\n' +
+'	digitalWrite(ICSPDAT, bit ? HIGH : LOW);\n' +
+'	TCKH();\n' +
+'	digitalWrite(ICSPCLK, LOW);\n' +
+'	TCKL();\n' +
+'	//  digitalWrite(ICSPDAT,LOW); // REM?\n' +
+'}\n' +
+'\n' +
+'unsigned char read_bit() {\n' +
+'	unsigned char rv;\n' +
+'\n' +
+'	digitalWrite(ICSPCLK, HIGH);\n' +
+'	TCKH();\n' +
+'	rv = (digitalRead(ICSPDAT) == HIGH);\n' +
+'	digitalWrite(ICSPCLK, LOW);\n' +
+'	TCKL();\n' +
+'\n' +
+'	return rv;\n' +
+'}\n' +
+'\n' +
+'/* Program/verify mode entry and exit */\n' +
+'void hvp_entry() {\n' +
+'\n' +
+'	Serial.println("Enter high voltage programming mode");\n' +
+'\n' +
+'	pinMode(ICSPCLK, OUTPUT);\n' +
+'	pinMode(VDD1, OUTPUT);\n' +
+'	pinMode(VDD2, OUTPUT);\n' +
+'	pinMode(VDD3, OUTPUT);\n' +
+'	pinMode(ICSPDAT, OUTPUT);\n' +
+'	// Set VPP to VIHH (9v)\n' +
+'\n' +
+'	TENTS();\n' +
+'	digitalWrite(VDD1, HIGH);\n' +
+'	digitalWrite(VDD2, HIGH);\n' +
+'	digitalWrite(VDD3, HIGH);\n' +
+'	TENTH();\n' +
+'}\n' +
+'\n' +
+'void lvp_entry() {\n' +
+'	unsigned long LVP_magic = 0b01001101010000110100100001010000;\n' +
+'	unsigned char i;\n' +
+'\n' +
+'	Serial.println("Enter low voltage programming mode");\n' +
+'\n' +
+'	pinMode(nMCLR, OUTPUT);\n' +
+'	pinMode(VDD1, OUTPUT);\n' +
+'	pinMode(VDD2, OUTPUT);\n' +
+'	pinMode(VDD3, OUTPUT);\n' +
+'\n' +
+'	digitalWrite(nMCLR, HIGH);\n' +
+'	digitalWrite(VDD1, HIGH);\n' +
+'	digitalWrite(VDD2, HIGH);\n' +
+'	digitalWrite(VDD3, HIGH);\n' +
+'	TENTS();\n' +
+'	digitalWrite(nMCLR, LOW);\n' +
+'	pinMode(ICSPCLK, OUTPUT);\n' +
+'	pinMode(ICSPDAT, OUTPUT);\n' +
+'	TENTH();\n' +
+'\n' +
+'	// Send "MCHP" backwards, to unlock LVP mode\n' +
+'	for (i = 0; i < 32; i++) {\n' +
+'		write_bit((LVP_magic >> i) & 1);\n' +
+'	}\n' +
+'	write_bit(0);\n' +
+'}\n' +
+'\n' +
+'void p_exit() {\n' +
+'\n' +
+'	Serial.println("Leaving programming mode");\n' +
+'\n' +
+'	digitalWrite(nMCLR, LOW); // LVP mode\n' +
+'	digitalWrite(ICSPCLK, LOW);\n' +
+'	digitalWrite(ICSPDAT, LOW);\n' +
+'	digitalWrite(VDD1, LOW);\n' +
+'	digitalWrite(VDD2, LOW);\n' +
+'	digitalWrite(VDD3, LOW);\n' +
+'	TEXIT();\n' +
+'\n' +
+'	pinMode(nMCLR, INPUT); // LVP mode\n' +
+'	pinMode(ICSPCLK, INPUT);\n' +
+'	pinMode(VDD1, INPUT);\n' +
+'	pinMode(VDD2, INPUT);\n' +
+'	pinMode(VDD3, INPUT);\n' +
+'	pinMode(ICSPDAT, INPUT);\n' +
+'}\n' +
+'\n' +
+'/* low level command transfer */\n' +
+'void write_command(unsigned char command) {\n' +
+'	unsigned char i;\n' +
+'\n' +
+'	for (i = 0; i < 5; i++) {\n' +
+'		write_bit((command >> i) & 1);\n' +
+'	}\n' +
+'	write_bit(0);\n' +
+'	TDLY();\n' +
+'}\n' +
+'\n' +
+'void write_command_with_data(unsigned char command, unsigned int data) {\n' +
+'	unsigned char i;\n' +
+'\n' +
+'	write_command(command);\n' +
+'\n' +
+'	write_bit(0);\n' +
+'	for (i = 0; i < 14; i++) {\n' +
+'		write_bit((data >> i) & 1);\n' +
+'	}\n' +
+'	write_bit(0);\n' +
+'}\n' +
+'\n' +
+'unsigned int read_command(unsigned char command) {\n' +
+'	unsigned char i;\n' +
+'	unsigned int data = 0;\n' +
+'\n' +
+'	write_command(command);\n' +
+'\n' +
+'	pinMode(ICSPDAT, INPUT);\n' +
+'\n' +
+'	read_bit();\n' +
+'	for (i = 0; i < 14; i++) {\n' +
+'		data |= ((unsigned int) (read_bit() & 0x1) << i);\n' +
+'	}\n' +
+'	read_bit();\n' +
+'\n' +
+'	pinMode(ICSPDAT, OUTPUT);\n' +
+'\n' +
+'	return data;\n' +
+'}\n' +
+'\n' +
+'/* high level commands */\n' +
+'void load_configuration(unsigned int data) {\n' +
+'	write_command_with_data(LOAD_CONFIGURATION, data);\n' +
+'}\n' +
+'\n' +
+'void load_data_for_program_memory(unsigned int data) {\n' +
+'	write_command_with_data(LOAD_DATA_FOR_PROGRAM_MEMORY, data);\n' +
+'}\n' +
+'\n' +
+'void load_data_for_data_memory(unsigned char data) {\n' +
+'	write_command_with_data(LOAD_DATA_FOR_DATA_MEMORY, data);\n' +
+'}\n' +
+'\n' +
+'unsigned int read_data_from_program_memory() {\n' +
+'	return read_command(READ_DATA_FROM_PROGRAM_MEMORY);\n' +
+'}\n' +
+'\n' +
+'unsigned char read_data_from_data_memory() {\n' +
+'	return (unsigned char) read_command(READ_DATA_FROM_DATA_MEMORY);\n' +
+'}\n' +
+'\n' +
+'void increment_address() {\n' +
+'	write_command(INCREMENT_ADDRESS);\n' +
+'}\n' +
+'\n' +
+'void reset_address() {\n' +
+'	write_command(RESET_ADDRESS);\n' +
+'}\n' +
+'\n' +
+'void begin_internally_timed_programming() {\n' +
+'	write_command(BEGIN_INTERNALLY_TIMED_PROGRAMMING);\n' +
+'	TPINT();\n' +
+'}\n' +
+'\n' +
+'void begin_externally_timed_programming() {\n' +
+'	write_command(BEGIN_EXTERNALLY_TIMED_PROGRAMMING);\n' +
+'	TPEXT();\n' +
+'}\n' +
+'\n' +
+'void end_externally_timed_programming() {\n' +
+'	write_command(END_EXTERNALLY_TIMED_PROGRAMMING);\n' +
+'	TDIS();\n' +
+'}\n' +
+'\n' +
+'void bulk_erase_program_memory() {\n' +
+'	Serial.println("Bulk erasing program memory");\n' +
+'	write_command(BULK_ERASE_PROGRAM_MEMORY);\n' +
+'	TERAB();\n' +
+'}\n' +
+'\n' +
+'void bulk_erase_data_memory() {\n' +
+'	Serial.println("Bulk erasing data memory");\n' +
+'	write_command(BULK_ERASE_DATA_MEMORY);\n' +
+'	TERAB();\n' +
+'}\n' +
+'\n' +
+'void row_erase_program_memory() {\n' +
+'	write_command(ROW_ERASE_PROGRAM_MEMORY);\n' +
+'	TERAR();\n' +
+'}\n' +
+'\n' +
+'/* algorithms */\n' +
+'void bulk_erase_device() {\n' +
+'	Serial.println("Bulk erasing device");\n' +
+'	load_configuration(0);\n' +
+'	bulk_erase_program_memory();\n' +
+'	bulk_erase_data_memory();\n' +
+'}\n' +
+'\n' +
+'void get_device_id(unsigned int *magic, unsigned int *version,\n' +
+'		unsigned int *deviceid) {\n' +
+'	lvp_entry();\n' +
+'	load_configuration(0);\n' +
+'	*magic = read_data_from_program_memory();\n' +
+'	increment_address();\n' +
+'	*version = read_data_from_program_memory();\n' +
+'	increment_address();\n' +
+'\n' +
+'	increment_address();\n' +
+'	increment_address();\n' +
+'	increment_address();\n' +
+'	increment_address();\n' +
+'\n' +
+'	*deviceid = read_data_from_program_memory();\n' +
+'\n' +
+'	p_exit();\n' +
+'}\n' +
+'\n' +
+'/* Read the EEPROM layout version, stored by the firmware in the high byte\n' +
+' * of the power on config (the last EEPROM byte). Not used by OVBSC and RH.\n' +
+' */\n' +
+'unsigned char get_eeprom_layout() {\n' +
+'	unsigned char layout;\n' +
+'	unsigned int i;\n' +
+'\n' +
+'	lvp_entry();\n' +
+'	reset_address();\n' +
+'	for (i = 0; i < 255; i++) {\n' +
+'		increment_address();\n' +
+'	}\n' +
+'	layout = read_data_from_data_memory();\n' +
+'	p_exit();\n' +
+'\n' +
+'	return layout;\n' +
+'}\n' +
+'\n' +
+'void write_magic(unsigned int data_word_out) {\n' +
+'	Serial.println("Writing magic.");\n' +
+'	load_configuration(0);\n' +
+'	load_data_for_program_memory(data_word_out);\n' +
+'	begin_internally_timed_programming();\n' +
+'}\n' +
+'\n' +
+'void write_version(unsigned int data_word_out) {\n' +
+'	Serial.println("Writing version.");\n' +
+'	load_configuration(0);\n' +
+'	increment_address();\n' +
+'	load_data_for_program_memory(data_word_out);\n' +
+'	begin_internally_timed_programming();\n' +
+'}\n' +
+'\n' +
+'void setup() {\n' +
+'	pinMode(ICSPCLK, INPUT);\n' +
+'	digitalWrite(ICSPCLK, LOW); // Disable pull-up\n' +
+'	pinMode(ICSPDAT, INPUT);\n' +
+'	digitalWrite(ICSPDAT, LOW); // Disable pull-up\n' +
+'	pinMode(nMCLR, INPUT);\n' +
+'	digitalWrite(nMCLR, LOW); // Disable pull-up\n' +
+'\n' +
+'	Serial.begin(115200);\n' +
+'\n' +
+'	delay(2);\n' +
+'\n' +
+'	Serial.println("STC-1000+ firmware sketch.");\n' +
+'	Serial.println("Copyright 2014 Mats Staffansson");\n' +
+'	Serial.println("");\n' +
+'	Serial.println("Send \'d\' to check for STC-1000");\n' +
+'\n' +
+'#if AUTOMATIC_UPLOAD_CELSIUS || AUTOMATIC_UPLOAD_FAHRENHEIT\n' +
+'	{\n' +
+'		unsigned int magic, ver, deviceid;\n' +
+'		delay(100); // Make sure STC has time to wake up.\n' +
+'		get_device_id(&magic, &ver, &deviceid);\n' +
+'\n' +
+'		if((deviceid & 0x3FE0) == 0x27C0) {\n' +
+'			Serial.println("STC-1000 detected");\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_device();\n' +
+'#if AUTOMATIC_UPLOAD_FAHRENHEIT\n' +
+'			upload_hex_from_progmem(hex_fahrenheit);\n' +
+'			upload_hex_from_progmem(hex_eeprom_fahrenheit);\n' +
+'			write_magic(STC1000P_MAGIC_F);\n' +
+'#else // AUTOMATIC_UPLOAD_CELSIUS\n' +
+'			upload_hex_from_progmem(hex_celsius);\n' +
+'			upload_hex_from_progmem(hex_eeprom_celsius);\n' +
+'			write_magic(STC1000P_MAGIC_C);\n' +
+'#endif\n' +
+'			write_version(STC1000P_VERSION);\n' +
+'			p_exit();\n' +
+'		} else {\n' +
+'			Serial.println("No STC-1000 detected");\n' +
+'		}\n' +
+'	}\n' +
+'#endif\n' +
+'\n' +
+'}\n' +
+'\n' +
+'void loop() {\n' +
+'	if (Serial.available() > 0) {\n' +
+'		char command = Serial.read();\n' +
+'		switch (command) {\n' +
+'		case \'h\':\n' +
+'			hvp_entry();\n' +
+'			break;\n' +
+'		case \'l\':\n' +
+'			lvp_entry();\n' +
+'			break;\n' +
+'		case \'e\':\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'		case \'c\':\n' +
+'			load_configuration(0);\n' +
+'			break;\n' +
+'		case \'p\':\n' +
+'			Serial.print(\'0\');\n' +
+'			Serial.print(\'x\');\n' +
+'			Serial.print(read_data_from_program_memory(), HEX);\n' +
+'			Serial.println();\n' +
+'			break;\n' +
+'		case \'i\':\n' +
+'			increment_address();\n' +
+'			break;\n' +
+'		case \'u\':\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_program_memory();\n' +
+'			upload_hex_file_to_device();\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'		case \'v\':\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_data_memory();\n' +
+'			upload_hex_file_to_device();\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'		case \'x\':\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_program_memory();\n' +
+'			upload_binary_to_device();\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'		case \'y\':\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_data_memory();\n' +
+'			upload_binary_to_device();\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'#if INCLUDE_CELSIUS_HEX_DATA\n' +
+'		case \'a\':\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_device();\n' +
+'			upload_hex_from_progmem (hex_celsius);\n' +
+'			upload_hex_from_progmem (hex_eeprom_celsius);\n' +
+'			write_magic(STC1000P_MAGIC_C);\n' +
+'			write_version(STC1000P_VERSION);\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'		case \'b\':\n' +
+'			lvp_entry();\n' +
+'			load_configuration(0);\n' +
+'			bulk_erase_program_memory();\n' +
+'			reset_address();\n' +
+'			upload_hex_from_progmem(hex_celsius);\n' +
+'			write_magic(STC1000P_MAGIC_C);\n' +
+'			write_version(STC1000P_VERSION);\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'#endif\n' +
+'		case \'d\': {\n' +
+'			unsigned int magic, ver, deviceid;\n' +
+'			unsigned char layout;\n' +
+'			get_device_id(&magic, &ver, &deviceid);\n' +
+'			Serial.print("Device ID is: 0x");\n' +
+'			Serial.println(deviceid, HEX);\n' +
+'			if ((deviceid & 0x3FE0) == 0x27C0) {\n' +
+'				Serial.println("STC-1000 detected.");\n' +
+'				if (magic == STC1000P_MAGIC_C || magic == STC1000P_MAGIC_F) {\n' +
+'					Serial.print("STC-1000+ ");\n' +
+'					if (magic == STC1000P_MAGIC_F) {\n' +
+'						Serial.print("Fahrenheit ");\n' +
+'					} else {\n' +
+'						Serial.print("Celsius ");\n' +
+'					}\n' +
+'					Serial.print("firmware with version ");\n' +
+'					Serial.print(ver / 100, DEC);\n' +
+'					Serial.print(".");\n' +
+'					Serial.print((ver % 100) / 10, DEC);\n' +
+'					Serial.print((ver % 10), DEC);\n' +
+'					Serial.println(" detected.");\n' +
+'					layout = get_eeprom_layout();\n' +
+'					if (layout == STC1000P_EEPROM_VERSION) {\n' +
+'						Serial.println(\n' +
+'								"EEPROM layout is up to date (for the same firmware variant).");\n' +
+'					} else if (layout > 0 && layout < STC1000P_EEPROM_VERSION) {\n' +
+'						Serial.println(\n' +
+'								"EEPROM data will be migrated to the current layout on first start, no need to initialize EEPROM.");\n' +
+'					} else {\n' +
+'						Serial.println(\n' +
+'								"EEPROM layout unknown, consider initializing EEPROM when flashing.");\n' +
+'					}\n' +
+'\n' +
+'				} else {\n' +
+'					Serial.println("No previous STC-1000+ firmware detected.");\n' +
+'					Serial.println(\n' +
+'							"Consider initializing EEPROM when flashing.");\n' +
+'				}\n' +
+'				Serial.print("Sketch has version ");\n' +
+'				Serial.print(STC1000P_VERSION / 100, DEC);\n' +
+'				Serial.print(".");\n' +
+'				Serial.print((STC1000P_VERSION % 100) / 10, DEC);\n' +
+'				Serial.print((STC1000P_VERSION % 10), DEC);\n' +
+'				Serial.println("");\n' +
+'				Serial.println("");\n' +
+'#if INCLUDE_CELSIUS_HEX_DATA\n' +
+'				Serial.println(\n' +
+'						"Send \'a\' to upload Celsius version and initialize EEPROM data.");\n' +
+'				Serial.println(\n' +
+'						"Send \'b\' to upload Celsius version (program memory only).");\n' +
+'#endif\n' +
+'#if INCLUDE_FAHRENHEIT_HEX_DATA\n' +
+'				Serial.println(\n' +
+'						"Send \'f\' to upload Fahrenheit version and initialize EEPROM data.");\n' +
+'				Serial.println(\n' +
+'						"Send \'g\' to upload Fahrenheit version (program memory only).");\n' +
+'#endif\n' +
+'			} else {\n' +
+'				Serial.println("STC-1000 NOT detected. Check wiring.");\n' +
+'			}\n' +
+'		}\n' +
+'			break;\n' +
+'#if INCLUDE_FAHRENHEIT_HEX_DATA\n' +
+'		case \'f\':\n' +
+'			lvp_entry();\n' +
+'			bulk_erase_device();\n' +
+'			upload_hex_from_progmem (hex_fahrenheit);\n' +
+'			upload_hex_from_progmem (hex_eeprom_fahrenheit);\n' +
+'			write_magic(STC1000P_MAGIC_F);\n' +
+'			write_version(STC1000P_VERSION);\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'		case \'g\':\n' +
+'			lvp_entry();\n' +
+'			load_configuration(0);\n' +
+'			bulk_erase_program_memory();\n' +
+'			reset_address();\n' +
+'			upload_hex_from_progmem(hex_fahrenheit);\n' +
+'			write_magic(STC1000P_MAGIC_F);\n' +
+'			write_version(STC1000P_VERSION);\n' +
+'			p_exit();\n' +
+'			break;\n' +
+'#endif\n' +
+'		default:\n' +
+'			break;\n' +
+'		}\n' +
+'	}\n' +
+'}\n' +
+'\n' +
+'');
@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p", {
+	"hex_celsius":"AQACAACrAACGMd0u/zSKASAAkRxBKAMQIgANDSAAvQA9CAMdEigQML0AIQCOASIAjQEgAD0IEDoDGSgoPQggOgMZLSg9CEA6AxkyKD0IgDoDGTcoOyghACsIIgCOAEAEgCwIQgSALQhCBIAuCEAEQCSTIgCNACAAkRAJACAAwAHBAcIBgDDDAGowIQCZAA4wjAAiAIwBIQCNAUA8QEDmBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzC2JiAApwB3CKkAqAAoDAMYcygoABcRAxx3KCgAFxX6MCgAlgA3MJ4A+jCdAMAwIACLAAkwIQCdACAAkx2aKIgxACCAMSgAFxmYKP8wIQCuAAMwIQCrAFkwIQCtACEArAAgAJMRIACTHDAtIADACgMZwQpAHOkoQgj3AEMIIACgAHcIoQAhAJ0UIQCdGKwoHRAgACEODzmiACAOowDwOaIEowYDEKMMogxBAo8iCKECIwgDHCMPoAIhABwIIACiAKMBIgikAKYBIQAbCEIHkqYEIwikBCYIogAkCKMAIgihByMIAxgjD6AHIQj3ACAIwwB3CMIAQmSDQAgPOQMdLi1FSoAgMEAlgaQBpgFASJGlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxgmKQkwQAOLKCkhAC8UIAAoCqEAAjD3ACEIhzHhJ4ExQD+JpQEgCKE+oACHMKEAJQgDGCUPoQdAEYAoCEIRQSmToT6lACcIAxgnD4c+pwCoASAAKQgoAgMcdyklCPYAJwj3AIAwjTHCJUAYnKsAdwiqAKwAKwitAAAwrRv/ML8AvgAsCKIHLQgDGC0Powc+CAMYPg+kBz8IAxg/D6YHmikgACAI9gBAmVwjgiAAqApAMEBLjk8pIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoIhCKIAIAhA7MD3ACMIxQB3CMQAdDC2JiAAxwB3CMYARAjIAEUIyQBGCEgHIQClACAASQghAKYAIABHCAMYRwoDGecpIQCmByEALxztKSIADBTvKSIADBAhAC8QIgAMHA4qIACZHwIqETAhAKsAyzAhAKwA/zAhAK0AIQCuACIADBKMEjwwIQCpAKoBQANAvYEuLXswQEBBRpTGAAYwRgIDGEYrIQAuEyAAQAjEAEEIxQDGAccBRwiAPoA+Ax0xKgAwRgJAA4HqMEUCQAODYDBEAgMcSytBJIisAHcIrQC/AAYwPwIDGEIrdjBDCoG+AHcwQwaYrQoDGawKCTA+AgMcVCoIML4AEzD3ACAAPwiHMeEngjEgAK4AAxA+Db8ALge/AD8KrgBAHYWvAHcIrgACMD8HsABAB5mxAHcIsAAvCCwCAx13Ki4ILQIDHKUqIAAwCPYAMQj3AHIweSYgAD4ICDoDGZAqAzA/B7IAQBubswB3CLIAMwQDHZcqBjD2AAAw9wB7MHkmQisgAK0BrAG+Cj4IsgCzATII9gAzCPcAdjB5JjsrejBAHYayAHcIvgAyBAMZOys/CEAIjb4Adwi/ACwO8DmzAC0OsgAPObMEsgYDELINsw1BAq0gMLQAtQG2AbcBuAEgAC8IMwIDHc8qLggyAgMc8CogAC4IsgIvCAMcLw+zAjAIuQAxCLoAADC6G/8wvAC7ADkItAc6CAMYOg+1BzsIAxg7D7YHPAgDGDwPtwcIK0CZgbkAPghSGKEgALgKQDA4AgMcyCo0Dg85tAA1DrUA8Dm0BLUGNg62APA5tQS2BjcOtwDwObYEtwbwMLcZtwQDELcbAxS3DLYMtQy0DEUGhjQIvwA1CL4APwj2AD4IQrqELQj2ACwI9wB3MEAGhMABwQFLKyEALhdBBYB1MECchsUAdwjEAEUEAxm7K3IwQAifxwB3CMYAIQAlCCAAyAAhACYIIADJAEYISALGAEcIAxxHCkkCxwADFMcfAxADHHQrxgnHCcYKAxnHCgMUIADFH0AKpJ0rxAnFCcQKAxnFCkUIgD7KAEcIgD5KAgMdiStGCEQCIADIAQMcSBRICAAwAxkBMMkAyABIDAMYmCsiAAwQAxycKyIADBS7KyAAQBuAygBAIUAegqgrRAhGAkYegMQAQR6AtytBHoC7K0AeQWadpwB3CKkAIQAnCCgEAxnKK/8wpwcDHKgDIQApCCoEAxnTK/8wqQcDHKoDIACoASIADB7aKyAAqAogACgIQS6KqwCoACgMAxjmKyEArhMDHOorIQCuF0EWgYwe8StJFob9KyEArhEDHAEsIQCuFUArhBUsIAAnCIA+qgBAqYSAPiAAKgIDHRMsQbSCKQIDGCcsQCiAhSxCD4CqAEAXQBKGJSwpCCEAJQIDHIUseDBAa5CrAHcIqAArDvA5IQCoACAAKA4hAKcADzmoBKcGAxCnDagNQQKFJw4POSAAqAAhACgOQBqO8DmoBKsGKAghAKcCIAArCAMcKwoDGVQsIQCoAnkwRiyAqgBBLIapAA85qgSpBgMQqQ2qDUECgCkOQiyAKg5FLICpAkMsjIEsIQCqAiIADBKMEv0sIgAMGv0sjBr9LHMwQzWAKQdAdIesACsIAxgrD6wHLAiAPq0AQoKCLQIDHaYsQZKCKgIDGMgsQuaHxSwgAKoBIQCuH7QsIACqCkALhwE5IACsAK0AqgYqDAMYwCxB2YDELEDZQD+BDBb9LEDWgKkCQFCBKw+nAkIzgL8AQLaCPwIDHdwsQbaNAxj9LCEAKQgqBAMZ+ywgAKkBIQCuHeosIACpCkALQDWFpwCoAKkGKQwDGPYsQfiA+ixA+EA1lYwWIACZHy4tIgAMHBAtIwAdHxAtYTAhAKsAETAhAKwA/zAhAK0AFy0BMPYAQG+E9wAmCDMlIADEAUAVmR4tIADECiAARAgAMAMZATDGAMQARAwDGCotIwAdEwMcLi0jAB0XIACTEGQAhCgIACAAqQBAppF2CKsAAxSpHwMQAxxHLSEALhIgAKgJqQmoCgMZqQpJLSEALhZAz5MBOgMdUi0hAK4SLhFVLSEArhYuFSAAKQiAPn0+Ax1dLegwKAIDHG0tQJaGqgApCKwAKgj3ACwIECZCNICrAUEXg4A+Ax11LWQwQBeAqS1DF4GtASAAQOVAD5uFLWQwKgIDHI4tnDAgAKoHAxysA60KfS0gACoIqAAsCKkADzCtBS0IBz6tAI4wAxgBPqoALQj2AEA5g4AwjTGwJYUxQOxAnoCsLUCcgKsAQz6EtC0KMCgCAxjBLUBsiAMdwS0hACsIIACqAP86Axn3LUlJgc8tCjBASYHYLfYwQ0mAxy1DSVBHgKwAQDmEAxn6LSEALBD6LUBNQAmDKAirAAc+qABBHoOpACgI9gApCEIegoYxIACrAED/QNyHoAB3CKEAAxAgDKIAIQyjAEAEk6QAIQymAAMQpAymDCYIowckCAMYJA+iByMODzmmACIOpADwOaYEpAZEDYIiCKYApAFECIIDEKIMowxFAoYjDaYAIg2kAAMQpg2kDUIClCMNpQAiDacAJQimBycIAxgnD6QHJgihAiQIAxwkD6ACBjChBwMYoAohDkA/gCAOSD+CIwj3ACIIQGiGpwB3CKkAdgioACcItiZAdYx3CKoAKAYDHYwuKwgpBgMZtS4DECAAJw2qAEC3gSMAkQBAmZUjAJMAFROVExUVIACLE1UwIwCWAKowlgCVFCAAixcjABURIwCVGKcuIAASEkD/hqgAqQEqCKcAqgonHJAuQaWGoQGiAQMQIA2jACAAIwhALEAogRUUEwhADoSkASAIpgClASIIQQWKJQShACQIJgSiACMIoACjCiAcvS4hCEFjgl0w9gCHMEHZgMIlQNmd5QB3COQAXzDmAIcw5wAgAGQI6ABlCOkA/zDkBwMc5QNoCGkEAxlaLwQwZgfoAOkB6Q1nCOkHaAj2AGkIQiOHhzEgAOsAdwjqAGYI9gBnCEQLhe0A6QB3COwA6AACME0glOkA7wB3COgA7gAgAGoI7gBrCO8A/zDqBwMc6wNuCG8EAxlUL2wI9gBtCEEagLAlQBqh7gBoCIQAaQiFAG4IgADsCgMZ7QroCgMZ6QowLwYwIADmBwMY5wrtLoAxQigIAAs0ADQDNAA0rjQANAE0ADQXNA40rzRBBYgRNA40pTQANAI0ADQTNA40pzRBBYIVNA40qTRBBYIYNA40sDRBF4IZNA40sTRBBYIaNA40sjRBBYIbNA40szRBBYIcNA40tDRBBYIdNA40tTRBBUAAnho0/jSdNP408jT+NDM0/zRpNP80mDT/NMM0/zTrNP80EDQANDM0ADRVNAA0dzQANJg0ADS4NAA02TQANPo0QC3eATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNCEAoAB3CKEAogEIMKMAIQAgHO0vIQiiByEAIAikAAMQJAygAAMQIQ2kAKEAIwikACQDowAjCAMd6C8iCAgAIACLEyIADQggANwAIQAOCCAA3QAiAI0B2DAhAI4AAxAhADQNIADeAN8BIACOHxooIADfCiAAXgjgAF8I3gBgBCEAtAADEEMRgQ4eLChOEYEOHz4oThGBjh1QKEgRhSAAXAgiAI0AIABdCEBQoyAAixchADMIAx2zAw8wIQAwAgMYeCyIMIoAcjAwBwMYigqCAIEo0yjrKAYpLCkELMArKCw0LHgseCxQKekpjCr0KogwIQA0BUB/kgg6Ax2QKBswIQCzAAYwIQCwAHosADAhADQEAxl6LH8whjG2JogxQJCCdwjcAF0EQAqAMzBCHoMDOgMdrCgBMEEbgCIwQguDAjoDHbgoAjBBC4ARMEILgwE6Ax3HKA0wQDaAAzBBDoBEMEIOg0A6Ax16LAcwQkKL9gBtMPcAADCFMTMliDEhACsQIQCuFi4VQz+AMzpAR4MhALABeixyMEJVgN4AQFWEATD2AFwI9wBeCEEfQ06AIjpDGoB7MEAagIkxQhqJ3wAAMPcAXwiMJAYwIABfAgMYISlBtYMhKREwswAEMEBOQ2iAETpDJYB2MEUlQGBDQICJMUEjg0UpDTCzAAUwSyOBIQAuFkBzQMeNMQIDGIEpIQAyHGMphTAhAKsA0TAhAKwAaSlhMEAGgBkwQAaCAxAhADIMQCOMBz7cAI4wAxgBPt4AXAj2AF4I9wCAMI0xsCVAS4nfACEArQDiKQQw9wAhADIIhzHhJ0ALiNwA3gFcCN8+3ABeCAMYXg+NPkoegKsAUB2C3AoDGd4KSSCArABQIIICMNwHAxhKIYStAG4wIQCzAAwwQKKFeiwAMCEAMwQDHfEpQaCAiDBCq4OAOgMd/SkHMEETgCIwQguEIDoDHR4qIQCyCkKyiBMqEzAhADICAxwaKrIBGioKMEEGgzwqsgE8KgswQSBD2IQQOgMdXCohALIDQiCANSpCIINYKhIwsgBYKkMhjAkwsgB7MIYxtiaKMSAA3gB3CNwA3wAGMF8CQBZAhoQEOgMdUSqyCrIKQQeEBToDHVgq/jCyB0I9gEQwQj2DQDoDHXosEzBAo4AxCECjQCqA3ABAG4IgANwHXAhCNIPjAHcI4gAgAECjhCAAYgj3AGMIzCRCC0GigA0wQS9CY4SoKiEAMhyeKgAwQxmEhTEzJYox7SoBMEcJROdBQ0fngAMwSOdAFoTfAAQwXwIDGNYqSC2EIABfCAY6Ax3kKkAMQC2EADD3AFwIjCTtKkdPQWeADjBBZ0uPhyEAMwgDHQgrIQCwAXosiDBBq4PeAIA6Ax0UK0K3mSEAtB4qKyAA4goDGeMKYwiAPn0+Ax0iK+kwYgIDHEArCTAgAOIHAxjjCkArIQA0Hlcr/zBACIEDHOMDQhaAOStCFoD3MEINSsaGHzAoAB0CAxxTK/gwnQdCykL6gN4AQPqAvCtAaECIgK4rQGaACTpABECEQIuDdjCGMXkmizFCB4B3MEEHgCAAQEeGgD4DHYErBjBiAgMYritBp4DeAECSgF4IQJFAE4LfAIYxtiZABIbgAHcI3gD2AGAI9wByMEIjgd8KXwhCEIDfAEAQgF8EQECDBjAgAOIA4wFAKoL2AGMI9wBAckEaQqeJ+jAoAJ0AeiwAMCEAMwQDHfkrfzBCJZDeAHcI3ADfAF8IADADGQEw3ADgAOEB4BvhA2AI9gBhCPcAQBVBQY9fCAMZ7CsiAAwQDBKMEigAFxEgAJMQ9is8MCEAqQCqAUADg6cAqAEoABcVRfCC3ACIOgMZQOxACkCOgbYmjDFBZIDcAECajFwI9wBfCIUxMyWMMSEAMwgDHR0sDTCzAAMwQGGAETBCI4AROkMjgQEw9wBAyoSMJG4wIQCzAAgwQXdBc4EDGUEsQz+CgDoDHUQsQRuAIjBCCokgOgMdViwhALEKBzAxAgMYsQEHMEEhQziEEDoDHWosIQCxA0ARgwMcZiwGMLEAQhOARDBCE4FAOgMdQEyAsgFCu0A2gSEAMAhBrEARk98AXwwDGIcsIACZEwMciywgAJkXCAAgAMwAdwjLACEALhauFi4VrhRA6pdMAgMYsywZMCEAqwDdMCEArAAgAEwIBz7MAI4wAxgBPs4ATAj2AE4I9wCAMI0xsCVAm4etAMssADAgAEsEAxnCLGEwQB2ACTBAHYDJMEEOQAOBqwDRMEAJgP8wQAlAP6zTAHcI0gB2CNQA1QHWAecw1wADMNgAcjBUAgMY8ixUCNkAEzAgAFkCAxzmLO0w2QfeLCAAWRhoLXAw1QD+MNYAeDDXAAUw2ABoLY4wIADUBwQw9wBUCIcx4SdA8pHZANoBWQjfPtQAjTDbAFoIAxhaD9sHAzDUBwMY2wpUCPYAWwhCYoCNMUAXglkIAx0hLUcuiyAAWQgBOgMdLi3OMNUA/zDWADIw1wDYAUEMgwg6Ax03LQEwQwiCAjoDHUAtRBGCAzoDHU4tQiyCkDDXAAEwQiyDBDoDHVctCDBDFoMFOgMdYC08MEMIgwY6Ax1oLQYwQAiMIABXCPMAWAj0AFUI9QBWCPYAUgj3AFMIfCVCqEAGQ++YdgjOAHUIzQB0CNAAcwjPAFAIgD7RAEwIgD5RAgMdki1LCE8CAxiZLSAATQj3AE4Iry1A+EARgE4IQRGIpC1NCEsCAxirLSAATwj3AFAIQBGUSwj3AEwICAAAOgMZty2AOgMZvS0ANHYIhAB3CIUAAAgIAHcIigB2CIIAQRGAyi1AEYHSLfcBQxKBEgD3AEAUhY0xvSX1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH5EINN001TT/NAY0AzS3NA00JTSxNGE0QTQ3NAE0ITQANAA0PDRBAUUAAQECAA6B1A//OgA=",
+	"hex_fahrenheit":"AQACAACrAACGMd0u/zSKASAAkRxBKAMQIgANDSAAvQA9CAMdEigQML0AIQCOASIAjQEgAD0IEDoDGSgoPQggOgMZLSg9CEA6AxkyKD0IgDoDGTcoOyghACsIIgCOAEAEgCwIQgSALQhCBIAuCEAEQCSTIgCNACAAkRAJACAAwAHBAcIBgDDDAGowIQCZAA4wjAAiAIwBIQCNAUA8QEDmBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzC2JiAApwB3CKkAqAAoDAMYcygoABcRAxx3KCgAFxX6MCgAlgA3MJ4A+jCdAMAwIACLAAkwIQCdACAAkx2aKIgxACCAMSgAFxmYKP8wIQCuAAMwIQCrAFkwIQCtACEArAAgAJMRIACTHDAtIADACgMZwQpAHOkoQgj3AEMIIACgAHcIoQAhAJ0UIQCdGKwoHRAgACEODzmiACAOowDwOaIEowYDEKMMogxBAo8iCKECIwgDHCMPoAIhABwIIACiAKMBIgikAKYBIQAbCEIHkqYEIwikBCYIogAkCKMAIgihByMIAxgjD6AHIQj3ACAIwwB3CMIAQmSDQAgPOQMdLi1FSoAgMEAlgaQBpgFASJGlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxgmKQkwQAOLKCkhAC8UIAAoCqEAAjD3ACEIhzHhJ4ExQD+JpQEgCKE+oACHMKEAJQgDGCUPoQdAEYAoCEIRQSmToT6lACcIAxgnD4c+pwCoASAAKQgoAgMcdyklCPYAJwj3AIAwjTHCJUAYnKsAdwiqAKwAKwitAAAwrRv/ML8AvgAsCKIHLQgDGC0Powc+CAMYPg+kBz8IAxg/D6YHmikgACAI9gBAmVwjgiAAqApAMEBLjk8pIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoIhCKIAIAhA7MD3ACMIxQB3CMQAdDC2JiAAxwB3CMYARAjIAEUIyQBGCEgHIQClACAASQghAKYAIABHCAMYRwoDGecpIQCmByEALxztKSIADBTvKSIADBAhAC8QIgAMHA4qIACZHwIqETAhAKsAyzAhAKwA/zAhAK0AIQCuACIADBKMEjwwIQCpAKoBQANAvYEuLXswQEBBRpTGAAYwRgIDGEYrIQAuEyAAQAjEAEEIxQDGAccBRwiAPoA+Ax0xKgAwRgJAA4HqMEUCQAODYDBEAgMcSytBJIisAHcIrQC/AAYwPwIDGEIrdjBDCoG+AHcwQwaYrQoDGawKCTA+AgMcVCoIML4AEzD3ACAAPwiHMeEngjEgAK4AAxA+Db8ALge/AD8KrgBAHYWvAHcIrgACMD8HsABAB5mxAHcIsAAvCCwCAx13Ki4ILQIDHKUqIAAwCPYAMQj3AHIweSYgAD4ICDoDGZAqAzA/B7IAQBubswB3CLIAMwQDHZcqBjD2AAAw9wB7MHkmQisgAK0BrAG+Cj4IsgCzATII9gAzCPcAdjB5JjsrejBAHYayAHcIvgAyBAMZOys/CEAIjb4Adwi/ACwO8DmzAC0OsgAPObMEsgYDELINsw1BAq0gMLQAtQG2AbcBuAEgAC8IMwIDHc8qLggyAgMc8CogAC4IsgIvCAMcLw+zAjAIuQAxCLoAADC6G/8wvAC7ADkItAc6CAMYOg+1BzsIAxg7D7YHPAgDGDwPtwcIK0CZgbkAPghSGKEgALgKQDA4AgMcyCo0Dg85tAA1DrUA8Dm0BLUGNg62APA5tQS2BjcOtwDwObYEtwbwMLcZtwQDELcbAxS3DLYMtQy0DEUGhjQIvwA1CL4APwj2AD4IQrqELQj2ACwI9wB3MEAGhMABwQFLKyEALhdBBYB1MECchsUAdwjEAEUEAxm7K3IwQAifxwB3CMYAIQAlCCAAyAAhACYIIADJAEYISALGAEcIAxxHCkkCxwADFMcfAxADHHQrxgnHCcYKAxnHCgMUIADFH0AKpJ0rxAnFCcQKAxnFCkUIgD7KAEcIgD5KAgMdiStGCEQCIADIAQMcSBRICAAwAxkBMMkAyABIDAMYmCsiAAwQAxycKyIADBS7KyAAQBuAygBAIUAegqgrRAhGAkYegMQAQR6AtytBHoC7K0AeQWadpwB3CKkAIQAnCCgEAxnKK/8wpwcDHKgDIQApCCoEAxnTK/8wqQcDHKoDIACoASIADB7aKyAAqAogACgIQS6KqwCoACgMAxjmKyEArhMDHOorIQCuF0EWgYwe8StJFob9KyEArhEDHAEsIQCuFUArhBUsIAAnCIA+qgBAqYSAPiAAKgIDHRMsQbSCKQIDGCcsQCiAhSxCD4CqAEAXQBKGJSwpCCEAJQIDHIUseDBAa5CrAHcIqAArDvA5IQCoACAAKA4hAKcADzmoBKcGAxCnDagNQQKFJw4POSAAqAAhACgOQBqO8DmoBKsGKAghAKcCIAArCAMcKwoDGVQsIQCoAnkwRiyAqgBBLIapAA85qgSpBgMQqQ2qDUECgCkOQiyAKg5FLICpAkMsjIEsIQCqAiIADBKMEv0sIgAMGv0sjBr9LHMwQzWAKQdAdIesACsIAxgrD6wHLAiAPq0AQoKCLQIDHaYsQZKCKgIDGMgsQuaHxSwgAKoBIQCuH7QsIACqCkALhwE5IACsAK0AqgYqDAMYwCxB2YDELEDZQD+BDBb9LEDWgKkCQFCBKw+nAkIzgL8AQLaCPwIDHdwsQbaNAxj9LCEAKQgqBAMZ+ywgAKkBIQCuHeosIACpCkALQDWFpwCoAKkGKQwDGPYsQfiA+ixA+EA1lYwWIACZHy4tIgAMHBAtIwAdHxAtYTAhAKsAETAhAKwA/zAhAK0AFy0BMPYAQG+E9wAmCDMlIADEAUAVmR4tIADECiAARAgAMAMZATDGAMQARAwDGCotIwAdEwMcLi0jAB0XIACTEGQAhCgIACAAqQBAppF2CKsAAxSpHwMQAxxHLSEALhIgAKgJqQmoCgMZqQpJLSEALhZAz5MBOgMdUi0hAK4SLhVVLSEArhYuFSAAKQiAPn0+Ax1dLegwKAIDHG0tQJaGqgApCKwAKgj3ACwIECZCNICrAUEXg4A+Ax11LWQwQBeAqS1DF4GtASAAQOVAD5uFLWQwKgIDHI4tnDAgAKoHAxysA60KfS0gACoIqAAsCKkADzCtBS0IBz6tAI4wAxgBPqoALQj2AEA5g4AwjTGwJYUxQOxAnoCsLUCcgKsAQz6EtC0KMCgCAxjBLUBsiAMdwS0hACsIIACqAP86Axn3LUlJgc8tCjBASYHYLfYwQ0mAxy1DSVBHgKwAQDmEAxn6LSEALBD6LUBNQAmDKAirAAc+qABBHoOpACgI9gApCEIegoYxIACrAED/QNyHoAB3CKEAAxAgDKIAIQyjAEAEk6QAIQymAAMQpAymDCYIowckCAMYJA+iByMODzmmACIOpADwOaYEpAZEDYIiCKYApAFECIIDEKIMowxFAoYjDaYAIg2kAAMQpg2kDUIClCMNpQAiDacAJQimBycIAxgnD6QHJgihAiQIAxwkD6ACBjChBwMYoAohDkA/gCAOSD+CIwj3ACIIQGiGpwB3CKkAdgioACcItiZAdYx3CKoAKAYDHYwuKwgpBgMZtS4DECAAJw2qAEC3gSMAkQBAmZUjAJMAFROVExUVIACLE1UwIwCWAKowlgCVFCAAixcjABURIwCVGKcuIAASEkD/hqgAqQEqCKcAqgonHJAuQaWGoQGiAQMQIA2jACAAIwhALEAogRUUEwhADoSkASAIpgClASIIQQWKJQShACQIJgSiACMIoACjCiAcvS4hCEFjgl0w9gCHMEHZgMIlQNmd5QB3COQAXzDmAIcw5wAgAGQI6ABlCOkA/zDkBwMc5QNoCGkEAxlaLwQwZgfoAOkB6Q1nCOkHaAj2AGkIQiOHhzEgAOsAdwjqAGYI9gBnCEQLhe0A6QB3COwA6AACME0glOkA7wB3COgA7gAgAGoI7gBrCO8A/zDqBwMc6wNuCG8EAxlUL2wI9gBtCEEagLAlQBqh7gBoCIQAaQiFAG4IgADsCgMZ7QroCgMZ6QowLwYwIADmBwMY5wrtLoAxQigIAAs0ADQDNAA0rjQANAE0ADQXNA40rzRBBYgRNA40pTQANAI0ADQTNA40pzRBBYIVNA40qTRBBYIYNA40sDRBF4IZNA40sTRBBYIaNA40sjRBBYIbNA40szRBBYIcNA40tDRBBYIdNA40tTRBBUAAjNU0/TTBNP40WTT/NM80/zQwNAA0hjQANNM0QCfwATRcNAE0nDQBNNo0ATQWNAI0UTQCNIw0AjTHNAI0AjQDND80AzR9NAM0vTQDNAE0BDRINAQ0lDQENOU0BDQ/NAU0pDQFNBc0BjSeNAY0RDQHNB40CDRdNAk0qzQLNCEAoAB3CKEAogEIMKMAIQAgHO0vIQiiByEAIAikAAMQJAygAAMQIQ2kAKEAIwikACQDowAjCAMd6C8iCAgAIACLEyIADQggANwAIQAOCCAA3QAiAI0B2DAhAI4AAxAhADQNIADeAN8BIACOHxooIADfCiAAXgjgAF8I3gBgBCEAtAADEEMRgQ4eLChOEYEOHz4oThGBjh1QKEgRhSAAXAgiAI0AIABdCEBQoyAAixchADMIAx2zAw8wIQAwAgMYeCyIMIoAcjAwBwMYigqCAIEo0yjrKAYpLCkELMArKCw0LHgseCxQKekpjCr0KogwIQA0BUB/kgg6Ax2QKBswIQCzAAYwIQCwAHosADAhADQEAxl6LH8whjG2JogxQJCCdwjcAF0EQAqAMzBCHoMDOgMdrCgBMEEbgCIwQguDAjoDHbgoAjBBC4ARMEILgwE6Ax3HKA0wQDaAAzBBDoBEMEIOg0A6Ax16LAcwQkKL9gBtMPcAADCFMTMliDEhACsQIQCuFi4VQz+AMzpAR4MhALABeixyMEJVgN4AQFWEATD2AFwI9wBeCEEfQ06AIjpDGoB7MEAagIkxQhqJ3wAAMPcAXwiMJAYwIABfAgMYISlBtYMhKREwswAEMEBOQ2iAETpDJYB2MEUlQGBDQICJMUEjg0UpDTCzAAUwSyOBIQAuFkBzQMeNMQIDGIEpIQAyHGMphTAhAKsA0TAhAKwAaSlhMEAGgBkwQAaCAxAhADIMQCOMBz7cAI4wAxgBPt4AXAj2AF4I9wCAMI0xsCVAS4nfACEArQDiKQQw9wAhADIIhzHhJ0ALiNwA3gFcCN8+3ABeCAMYXg+NPkoegKsAUB2C3AoDGd4KSSCArABQIIICMNwHAxhKIYStAG4wIQCzAAwwQKKFeiwAMCEAMwQDHfEpQaCAiDBCq4OAOgMd/SkHMEETgCIwQguEIDoDHR4qIQCyCkKyiBMqEzAhADICAxwaKrIBGioKMEEGgzwqsgE8KgswQSBD2IQQOgMdXCohALIDQiCANSpCIINYKhIwsgBYKkMhjAkwsgB7MIYxtiaKMSAA3gB3CNwA3wAGMF8CQBZAhoQEOgMdUSqyCrIKQQeEBToDHVgq/jCyB0I9gEQwQj2DQDoDHXosEzBAo4AxCECjQCqA3ABAG4IgANwHXAhCNIPjAHcI4gAgAECjhCAAYgj3AGMIzCRCC0GigA0wQS9CY4SoKiEAMhyeKgAwQxmEhTEzJYox7SoBMEcJROdBQ0fngAMwSOdAFoTfAAQwXwIDGNYqSC2EIABfCAY6Ax3kKkAMQC2EADD3AFwIjCTtKkdPQWeADjBBZ0uPhyEAMwgDHQgrIQCwAXosiDBBq4PeAIA6Ax0UK0K3mSEAtB4qKyAA4goDGeMKYwiAPn0+Ax0iK+kwYgIDHEArCTAgAOIHAxjjCkArIQA0Hlcr/zBACIEDHOMDQhaAOStCFoD3MEINSsaGHzAoAB0CAxxTK/gwnQdCykL6gN4AQPqAvCtAaECIgK4rQGaACTpABECEQIuDdjCGMXkmizFCB4B3MEEHgCAAQEeGgD4DHYErBjBiAgMYritBp4DeAECSgF4IQJFAE4LfAIYxtiZABIbgAHcI3gD2AGAI9wByMEIjgd8KXwhCEIDfAEAQgF8EQECDBjAgAOIA4wFAKoL2AGMI9wBAckEaQqeJ+jAoAJ0AeiwAMCEAMwQDHfkrfzBCJZDeAHcI3ADfAF8IADADGQEw3ADgAOEB4BvhA2AI9gBhCPcAQBVBQY9fCAMZ7CsiAAwQDBKMEigAFxEgAJMQ9is8MCEAqQCqAUADg6cAqAEoABcVRfCC3ACIOgMZQOxACkCOgbYmjDFBZIDcAECajFwI9wBfCIUxMyWMMSEAMwgDHR0sDTCzAAMwQGGAETBCI4AROkMjgQEw9wBAyoSMJG4wIQCzAAgwQXdBc4EDGUEsQz+CgDoDHUQsQRuAIjBCCokgOgMdViwhALEKBzAxAgMYsQEHMEEhQziEEDoDHWosIQCxA0ARgwMcZiwGMLEAQhOARDBCE4FAOgMdQEyAsgFCu0A2gSEAMAhBrEARk98AXwwDGIcsIACZEwMciywgAJkXCAAgAMwAdwjLACEALhauFi4VrhRA6pdMAgMYsywZMCEAqwDdMCEArAAgAEwIBz7MAI4wAxgBPs4ATAj2AE4I9wCAMI0xsCVAm4etAMssADAgAEsEAxnCLGEwQB2ACTBAHYDJMEEOQAOBqwDRMEAJgP8wQAlAP6zTAHcI0gB2CNQA1QHWAecw1wADMNgAcjBUAgMY8ixUCNkAEzAgAFkCAxzmLO0w2QfeLCAAWRhoLXAw1QD+MNYAxDDXAAkw2ABoLY4wIADUBwQw9wBUCIcx4SdA8pHZANoBWQjfPtQAjTDbAFoIAxhaD9sHAzDUBwMY2wpUCPYAWwhCYoCNMUAXglkIAx0hLUcuiyAAWQgBOgMdLi2cMNUA/zDWAGQw1wDYAUEMgwg6Ax03LQEwQwiCAjoDHUAtRBGHAzoDHU4t4DDVAPww1gAgMEF0QQ2DBDoDHVctCDBDFoMFOgMdYC08MEMIgwY6Ax1oLQYwQAiMIABXCPMAWAj0AFUI9QBWCPYAUgj3AFMIfCVCqEAGQ++YdgjOAHUIzQB0CNAAcwjPAFAIgD7RAEwIgD5RAgMdki1LCE8CAxiZLSAATQj3AE4Iry1A+EARgE4IQRGIpC1NCEsCAxirLSAATwj3AFAIQBGUSwj3AEwICAAAOgMZty2AOgMZvS0ANHYIhAB3CIUAAAgIAHcIigB2CIIAQRGAyi1AEYHSLfcBQxKBEgD3AEAUhY0xvSX1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH5EINN001TT/NAY0AzS3NA00JTSxNGE0QTQ3NAE0ITQANAA0PDRBAUUAAQECAA6B1A//OgA=",
+});
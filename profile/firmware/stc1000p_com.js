@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_com", {
+	"hex_celsius":"AQACAACRAACGMTsu/zSKAScAkxwjKCAAixEnAJEQIQA2CAMZFyghALUfQAKejBAiAIwUCjAhALcABTAgAJUAIQCVEiAAixYnAJMBIAALHUIoIQCVFiAAixIhAIwUIgCMEAMQIQC1DSEAuApAJoYDHTwoIACMHDwoIQA1FEAaqpEUIACLFQsRIACRHIooAxAiAA0NIAC8ADwIAx1PKBAwvAAhAI4BIgCNASAAPAgQOgMZZSg8CCA6AxlqKDwIQDoDGW8oPAiAOgMZdCh4KCEAMAgiAI4AQASAMQhCBIAyCEIEgDMIQARAJJoiAI0AIQA3CAMZgii3A4goIQC5ASEAuAEhALYBIACREAkAIACLEyIADQggAOEAIQAOCCAA4gBAQ4LYMCEAjgBAa5E+DSAA4wDkASAAjh+lKCAA5AogAGMI5QBkCOMAZQQhAL4AAxBDEYEOHrcoThGBDh/JKE4RgY4d2yhIEYEgAGEIQGqBIABiCEBQoyAAixchAD0IAx29Aw8wIQA6AgMYAy2AMIoA/TA6BwMYigqCAAwpXil2KZEptymPLEsssyy/LAMtAy3bKXQqFyt/K4gwIQA+BUB/kgg6Ax0bKRswIQC9AAYwIQC6AAUtADAhAD4EAxkFLX8wjzGXJ4ExQJCCdwjhAGIEQAqAMzBCHoMDOgMdNykBMEEbgCIwQguDAjoDHUMpAjBBC4ARMEILgwE6Ax1SKQ0wQDaAAzBBDoBEMEIOg0A6Ax0FLQcwQkKL9gBtMPcAADCOMRQmgTEhADAQIQCzFjMVQz+AMzpAR4MhALoBBS1yMEJVgOMAQFWEATD2AGEI9wBjCEEfQ06AIjpDGoB7MEUaieQAADD3AGQIFyUGMCAAZAIDGKwpQbWDrCkRML0ABDBATkNogBE6QyWAdjBFJUBgREBBI4PQKQ0wvQAFMEsjgSEAMxZAc0DHjTsCAxgMKiEAPBzuKYUwIQCwANEwIQCxAPQpYTBABoAZMEAGggMQIQA8DEAjmJM+4QCHMAMYAT7jAGEI9gBjCPcAgDCHMR0ngjEgAOQAIQCyAG0qBDD3ACEAPAiHMXQnQAuI4QDjAWEITD7hAGMIAxhjD4c+Sh6AsABQHYLhCgMZ4wpJIICxAFAgggIw4QcDGEohhLIAbjAhAL0ADDBAooUFLQAwIQA9BAMdfCpBoICIMEKrg4A6Ax2IKgcwQROAIjBCC4QgOgMdqSohALwKQrKInioTMCEAPAIDHKUqvAGlKgowQQaDxyq8AccqCzBBIEPYhBA6Ax3nKiEAvANCIIDAKkIgg+MqEjC8AOMqQyGECTC8AHswjzGXJ0BhheMAdwjhAOQABjBkAkAWQIaEBDoDHdwqvAq8CkEHhAU6Ax3jKv4wvAdCPYBEMEI9g0A6Ax0FLRMwQKOAOwhDo0AbgiAA4QdhCEI0g+gAdwjnACAAQKOEIABnCPcAaAhXJUILQaKADTBBL0JjhDMrIQA8HCkrADBDGYSOMRQmgzF4KwEwRwlE54CDMUnngAMwSOdAFoTkAAQwZAIDGGErSC2EIABkCAY6Ax1vK0AMQC2EADD3AGEIFyV4K0dPQWeADjBBZ0SPQUtCj4chAD0IAx2TKyEAugEFLYgwQauD4wCAOgMdnytCt5khAL4etSsgAOcKAxnoCmgIgD59PgMdrSvpMGcCAxzLKwkwIADnBwMY6ArLKyEAPh7iK/8wQAiBAxzoA0IWgMQrQhaA9zBCDUrGhh8wKAAdAgMc3iv4MJ0HQspC+oDjAED6gEcsQGhAiIA5LEBmgAk6QARAhECLg3YwjzFaJ4MxQgeAdzBAB4GEMSAAQEeGgD4DHQwsBjBnAgMYOSxBp4DjAECSgGMIQJFAE4LkAI8xlydABIblAHcI4wD2AGUI9wByMEIjgeQKZAhCEIDkAEAQgGQEQECDBjAgAOcA6AFAKoL2AGgI9wBAckEaQqeJ+jAoAJ0ABS0AMCEAPQQDHYQsfzBCJZDjAHcI4QDkAGQIADADGQEw4QDlAOYB5RvmA2UI9gBmCPcAQBVBQY9kCAMZdywiAAwQDBKMEigAFxEgAJMQgSw8MCEArgCvAUADg6wArQEoABcVRfCC4QCIOgMZQOxACkCOQ2SA4QBAmoxhCPcAZAiOMRQmhDEhAD0IAx2oLA0wvQADMEBhgBEwQiOAETpDI4EBMPcAQMqEFyVuMCEAvQAIMEF3QXOBAxnMLEM/goA6Ax3PLEEbgCIwQgqJIDoDHeEsIQC7CgcwOwIDGLsBBzBBIUM4hBA6Ax31LCEAuwNAEYMDHPEsBjC7AEITgEQwQhOBQDoDHUBMgLwBQrtANoEhADoIQaxAEZPkAGQMAxgSLSAAmRMDHBYtIACZFwgAIADRAHcI0AAhADMWsxYzFbMUQOqhUQIDGD4tGTAhALAA3TAhALEAIABRCJM+0QCHMAMYAT7TAFEI9gBTCPcAgDCHMR0nhTEhALIAVi0AMCAAUAQDGU0tYTBAHYAJMEAdgMkwQQ5AA4GwANEwQAmA/zBACUA/wNgAdwjXAHYI2QDaAdsB5zDcAAMw3QByMFkCAxh9LVkI3gATMCAAXgIDHHEt7TDeB2ktIABeGPMtcDDaAP4w2wB4MNwABTDdAPMtjjAgANkHBDD3AFkIhzF0J4UxIADeAN8BXghMPtkAhzDgAF8IAxhfD+AHAzDZBwMY4ApZCPYAYAhDYkAXgl4IAx2sLUcuiyAAXggBOgMduS3OMNoA/zDbADIw3ADdAUEMgwg6Ax3CLQEwQwiCAjoDHcstRBGCAzoDHdktQiyCkDDcAAEwQiyDBDoDHeItCDBDFoMFOgMd6y08MEMIgwY6Ax3zLQYwQAiMIABcCPMAXQj0AFoI9QBbCPYAVwj3AFgIByZCqEAGQ++YdgjTAHUI0gB0CNUAcwjUAFUIgD7WAFEIgD5WAgMdHS5QCFQCAxgkLiAAUgj3AFMIOi5A+EARgFMIQRGILy5SCFACAxg2LiAAVAj3AFUIQBGGUAj3AFEICAC7MPYAhjBBpKAvJ4YxIQChAHcIoAC9MKIAhjCjACEAIAikACEIpQD/MKAHAxyhAyQIJQQDGbguBDAiB6QApQGlDSMIpQckCPYAJQhEI4WnAHcIpgAiCPYAIwhEC4WpAKUAdwioAKQAAjBNIJSlAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZsi4oCPYAKQhBGoAdJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKji4GMCEAogcDGKMKSy6IMQAoCAAQNAA0AzQANLM0ADQBNAA0oTQHNLQ0QQWI/jQPNG40ADQCNAA0ojQHNLU0QQuCozQHNLY0QQWCpDQHNLc0QQWCpTQHNLg0QQWCpjQHNLk0QQWCnTQHNKw0QSOCnzQHNK40QQWCpzQHNLo0QRGCqDQHNLs0QQWCqTQHNLw0QQWCqjQHNL00QQWCqzQHNL40QQWCrDQHNL80QQWRADoDGSQvgDoDGSovADR2CIQAdwiFAAAICAB3CIoAdgiCAAgAQBGANy9AEYE/L/cBQxKBEgD3AEAUhYcxKif1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH68INN001TT/NAY0IADpAHcI6gDrAQgw7AAgAGkcgC9qCOsHIABpCO0AAxBtDOkAAxBqDe0A6gBsCO0AbQPsAGwIAx17L2sICAADNLc0DTQlNLE0YTRBNDc0ATQhNDw0ADRAAUoAAhAA5CAAwAHBAcIBgDDDAGowIQCZAA4wjAAiAIwBIQCNASIAjQEhAI4BBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzCXJyAApwB3CKkAqAAoDAMYMSgoABcRAxw1KCgAFxX6MCgAlgA3MJ4A+jCdAMgwIACLAAIwJwCRAJIBCTAhAJ0AIACLEwgwIQA4AgMcZCkhADUIIADEACEAuAEgAIsXIABECCAArAAgAMsGIQC2ASEAOQgDHbEoIAAsCCAAzABBA4/LACAAzQEgAEwIIDoDGXQoTAjgOgMdeCgBMCEAuQBOKUASiwE6Ax2JKCAAbgggAM4AIABvCCAAzwAFMEMQigI6Ax2dKK0BIgAMHpQoIACtCiAALQhAFoDPAUQTggM6Ax1OKUATgYweqChJE0BTQDiAzihBUIDNAEBOQEqBwygCMEIlgE0IQJ6CzwB3CM4ARByDAjoDGdcoOQhANIrrKCAATgggAL0ArQEsCL4AvwE+CC0EQWGBPwg9BEAfgSEAuQpBHIYEOgMdECkgAEsIAx0HKUEcQJ6GTwggAK0ALAj2AC0I9wBAPIVaJ5owIQC1AAopZjBAA0CVgrYAIQC5AUEkggY6Ax0gKUAgQw6ABzBDUYIHOgMdQSlAJIEgAEwGRDKDvQEtCL4ArAZBPoGtACwGQyBA9EIggAg6QKNBQkM+QAyCBToDGVcpQUGAZClBK4CsAEB/RBW5uQogAIsXkx17KYAxiyCJMSgAFxl5Kf8wIQCzAAMwIQCwAFkwIQCyACEAsQAgAJMRIACTHBEuIADACgMZwQpAHMopQgj3AEMIIACgAHcIoQAhAJ0UIQCdGI0pHRAgACEODzmiACAOowDwOaIEowYDEKMMogxBAo8iCKECIwgDHCMPoAIhABwIIACiAKMBIgikAKYBIQAbCEIHmqYEIwikBCYIogAkCKMAIgihByMIAxgjD6AHIQj3ACAIwwB3CMIACTAhAJ0AIABACA85Ax0PLkVKgCAwQCWBpAGmAUBIkaUAIA6nAPA5pQSnBgMQpwylDD8wpQWnASUIqQADECAMpQCnAUELQQKAHzBBDoGoACAIQA2GJQihAPgwIQIDGAcqCTBAA4sJKiEANBQgACgKoQACMPcAIQiHMXQnijFAP4mlASAIvj6gAI8woQAlCAMYJQ+hB0ARgCgIQhFBKZO+PqUAJwgDGCcPjz6nAKgBIAApCCgCAxxYKiUI9gAnCPcAgDCHMS8nQBicqwB3CKoArAArCK0AADCtG/8wvQC+ACwIogctCAMYLQ+jBz4IAxg+D6QHPQgDGD0Ppgd7KiAAIAj2AECZXCOCIACoCkAwQEuOMCoiDg85oQAjDqAA8DmhBKAGJA6lAPA5oASlBiYOQq+F8DCnGacEAxCnGwMUQKWBoAyhDEUGgiEIogAgCEDswPcAIwjFAHcIxAB0MJcnIADHAHcIxgBECMgARQjJAEYISAcgAO4AIABJCCAA7wAgAEcIAxhHCgMZyCogAO8HIQA0HM4qIgAMFNAqIgAMECEANBAiAAwc7yogAJkf4yoRMCEAsADLMCEAsQD/MCEAsgAhALMAIgAMEowSPDAhAK4ArwFAA4OsAK0BDy57MEBAQUaUxgAGMEYCAxgnLCEAMxMgAEAIxABBCMUAxgHHAUcIgD6APgMdEisAMEYCQAOB6jBFAkADg2AwRAIDHCwsQSSIrAB3CK0AvQAGMD0CAxgjLHYwQwqBvgB3MEMGmK0KAxmsCgkwPgIDHDUrCDC+ABMw9wAgAD0IhzF0J4sxIAC/AAMQPg29AD8HvQA9Cr8AQB2FrgB3CL8AAjA9B68AQAeZsAB3CK8ALggsAgMdWCs/CC0CAxyGKyAALwj2ADAI9wByMFonIAA+CAg6AxlxKwMwPQexAEAbm7IAdwixADIEAx14KwYw9gAAMPcAezBaJyMsIACtAawBvgo+CLEAsgExCPYAMgj3AHYwWiccLHowQB2GsQB3CL4AMQQDGRwsPQhACI2+AHcIvQAsDvA5sgAtDrEADzmyBLEGAxCxDbINQQKtIDCzALQBtQG2AbcBIAAuCDICAx2wKz8IMQIDHNErIAA/CLECLggDHC4PsgIvCLgAMAi5AAAwuRv/MLsAugA4CLMHOQgDGDkPtAc6CAMYOg+1BzsIAxg7D7YH6StAmYG4AD4IUhihIAC3CkAwNwIDHKkrMw4PObMANA60APA5swS0BjUOtQDwObQEtQY2DrYA8Dm1BLYG8DC2GbYEAxC2GwMUtgy1DLQMswxFBoYzCL0ANAi+AD0I9gA+CEK6hC0I9gAsCPcAdzBABoTAAcEBLCwhADMXQQWAdTBAnIbFAHcIxABFBAMZnCxyMEAIn8cAdwjGACAAbgggAMgAIABvCCAAyQBGCEgCxgBHCAMcRwpJAscAAxTHHwMQAxxVLMYJxwnGCgMZxwoDFCAAxR9ACqR+LMQJxQnECgMZxQpFCIA+ygBHCIA+SgIDHWosRghEAiAAyAEDHEgUSAgAMAMZATDJAMgASAwDGHksIgAMEAMcfSwiAAwUnCwgAEAbgMoAQCFAHoKJLEQIRgJGHoDEAEEegJgsQR6AnCxAHkFmnacAdwipACEALAgtBAMZqyz/MKwHAxytAyEALggvBAMZtCz/MK4HAxyvAyAAqAEiAAweuywgAKgKIAAoCEEuiqsAqAAoDAMYxywhALMTAxzLLCEAsxdBFoGMHtIsSRaG3iwhALMRAxziLCEAsxVAK4T2LCAAJwiAPqoAQKmEgD4gACoCAx30LEG0gikCAxgILUAogGYtQg+AqgBAF0AShgYtKQggAG4CAxxmLXgwQGuQqwB3CKgAKw7wOSEArQAgACgOIQCsAA85rQSsBgMQrA2tDUEChSwODzkgAKgAIQAtDkAajvA5qASrBigIIQCsAiAAKwgDHCsKAxk1LSEArQJ5MEYsgK8AQSyGrgAPOa8ErgYDEK4Nrw1BAoAuDkIsgC8ORSyArgJDLIxiLSEArwIiAAwSjBLeLSIADBreLYwa3i1zMEM1gCkHQHSGrAArCAMYKw+sBywIgD5AaUGCgi0CAx2HLUGSgioCAxipLULmh6YtIACqASEAsx+VLSAAqgpAC4cBOSAArACtAKoGKgwDGKEtQdmApS1A2UA/gQwW3i1A1oCpAkBQgSsPpwJCM4C9AEC2gj0CAx29LUG2jQMY3i0hAC4ILwQDGdwtIACpASEAsx3LLSAAqQpAC0A1hacAqACpBikMAxjXLUH4gNstQPhANZWMFiAAmR8PLiIADBzxLSMAHR/xLWEwIQCwABEwIQCxAP8wIQCyAPgtATD2AEBvhPcAbwgUJiAAxAFAFZn/LSAAxAogAEQIADADGQEwxgDEAEQMAxgLLiMAHRMDHA8uIwAdFyAAkxBkAEYoCAAgAKkAQKaRdgirAAMUqR8DEAMcKC4hADMSIACoCakJqAoDGakKKi4hADMWQM+TAToDHTMuIQCzEjMRNi4hALMWMxUgACkIgD59PgMdPi7oMCgCAxxOLkCWhqoAKQisACoI9wAsCPEmQjSAqwFBF4OAPgMdVi5kMEAXgIouQxeBrQEgAEDlQA+bZi5kMCoCAxxvLpwwIACqBwMcrAOtCl4uIAAqCKgALAipAA8wrQUtCJM+rQCHMAMYAT6qAC0I9gBAOYOAMIcxHSeOMUDsQJ6AjS5AnICwAEM+hJUuCjAoAgMYoi5AbIgDHaIuIQAwCCAAqgD/OgMZ2C5JSYGwLgowQEmBuS72MENJgKguQ0lQR4CxAEA5hAMZ2y4hADEQ2y5ATUAJgygIqwCTPqgAQR6DqQAoCPYAKQhEHoCrAED/QNyHoAB3CKEAAxAgDKIAIQyjAEAEk6QAIQymAAMQpAymDCYIowckCAMYJA+iByMODzmmACIOpADwOaYEpAZEDYIiCKYApAFECIIDEKIMowxFAoYjDaYAIg2kAAMQpg2kDUIClCMNpQAiDacAJQimBycIAxgnD6QHJgihAiQIAxwkD6ACBjChBwMYoAohDkA/gCAOSD+CIwj3ACIIQGiGpwB3CKkAdgioACcIlydAdYx3CKoAKAYDHW0vKwgpBgMZli8DECAAJw2qAEC3gSMAkQBAmZUjAJMAFROVExUVIACLE1UwIwCWAKowlgCVFCAAixcjABURIwCVGIgvIAASEkD/hqgAqQEqCKcAqgonHHEvQaWGoQGiAQMQIA2jACAAIwhALEAogRUUEwhADoSkASAIpgClASIIQQWKJQShACQIJgSiACMIoACjCiAcni8hCEFjvwA0ADQaNP40nTT+NPI0/jQzNP80aTT/NJg0/zTDNP806zT/NBA0ADQzNAA0VTQANHc0ADSYNAA0uDQANNk0ADT6NAA0HDQBND40ATRiNAE0hzQBNK80ATTZNAE0BzQCNDk0AjRwNAI0sDQCNPs0AjRYNAM00TQDNII0BDTKNAU0QD8BAQIADoHUD/86AA==",
+	"hex_fahrenheit":"AQACAACRAACGMTsu/zSKAScAkxwjKCAAixEnAJEQIQA2CAMZFyghALUfQAKejBAiAIwUCjAhALcABTAgAJUAIQCVEiAAixYnAJMBIAALHUIoIQCVFiAAixIhAIwUIgCMEAMQIQC1DSEAuApAJoYDHTwoIACMHDwoIQA1FEAaqpEUIACLFQsRIACRHIooAxAiAA0NIAC8ADwIAx1PKBAwvAAhAI4BIgCNASAAPAgQOgMZZSg8CCA6AxlqKDwIQDoDGW8oPAiAOgMZdCh4KCEAMAgiAI4AQASAMQhCBIAyCEIEgDMIQARAJJoiAI0AIQA3CAMZgii3A4goIQC5ASEAuAEhALYBIACREAkAIACLEyIADQggAOEAIQAOCCAA4gBAQ4LYMCEAjgBAa5E+DSAA4wDkASAAjh+lKCAA5AogAGMI5QBkCOMAZQQhAL4AAxBDEYEOHrcoThGBDh/JKE4RgY4d2yhIEYEgAGEIQGqBIABiCEBQoyAAixchAD0IAx29Aw8wIQA6AgMYAy2AMIoA/TA6BwMYigqCAAwpXil2KZEptymPLEsssyy/LAMtAy3bKXQqFyt/K4gwIQA+BUB/kgg6Ax0bKRswIQC9AAYwIQC6AAUtADAhAD4EAxkFLX8wjzGXJ4ExQJCCdwjhAGIEQAqAMzBCHoMDOgMdNykBMEEbgCIwQguDAjoDHUMpAjBBC4ARMEILgwE6Ax1SKQ0wQDaAAzBBDoBEMEIOg0A6Ax0FLQcwQkKL9gBtMPcAADCOMRQmgTEhADAQIQCzFjMVQz+AMzpAR4MhALoBBS1yMEJVgOMAQFWEATD2AGEI9wBjCEEfQ06AIjpDGoB7MEUaieQAADD3AGQIFyUGMCAAZAIDGKwpQbWDrCkRML0ABDBATkNogBE6QyWAdjBFJUBgREBBI4PQKQ0wvQAFMEsjgSEAMxZAc0DHjTsCAxgMKiEAPBzuKYUwIQCwANEwIQCxAPQpYTBABoAZMEAGggMQIQA8DEAjmJM+4QCHMAMYAT7jAGEI9gBjCPcAgDCHMR0ngjEgAOQAIQCyAG0qBDD3ACEAPAiHMXQnQAuI4QDjAWEITD7hAGMIAxhjD4c+Sh6AsABQHYLhCgMZ4wpJIICxAFAgggIw4QcDGEohhLIAbjAhAL0ADDBAooUFLQAwIQA9BAMdfCpBoICIMEKrg4A6Ax2IKgcwQROAIjBCC4QgOgMdqSohALwKQrKInioTMCEAPAIDHKUqvAGlKgowQQaDxyq8AccqCzBBIEPYhBA6Ax3nKiEAvANCIIDAKkIgg+MqEjC8AOMqQyGECTC8AHswjzGXJ0BhheMAdwjhAOQABjBkAkAWQIaEBDoDHdwqvAq8CkEHhAU6Ax3jKv4wvAdCPYBEMEI9g0A6Ax0FLRMwQKOAOwhDo0AbgiAA4QdhCEI0g+gAdwjnACAAQKOEIABnCPcAaAhXJUILQaKADTBBL0JjhDMrIQA8HCkrADBDGYSOMRQmgzF4KwEwRwlE54CDMUnngAMwSOdAFoTkAAQwZAIDGGErSC2EIABkCAY6Ax1vK0AMQC2EADD3AGEIFyV4K0dPQWeADjBBZ0SPQUtCj4chAD0IAx2TKyEAugEFLYgwQauD4wCAOgMdnytCt5khAL4etSsgAOcKAxnoCmgIgD59PgMdrSvpMGcCAxzLKwkwIADnBwMY6ArLKyEAPh7iK/8wQAiBAxzoA0IWgMQrQhaA9zBCDUrGhh8wKAAdAgMc3iv4MJ0HQspC+oDjAED6gEcsQGhAiIA5LEBmgAk6QARAhECLg3YwjzFaJ4MxQgeAdzBAB4GEMSAAQEeGgD4DHQwsBjBnAgMYOSxBp4DjAECSgGMIQJFAE4LkAI8xlydABIblAHcI4wD2AGUI9wByMEIjgeQKZAhCEIDkAEAQgGQEQECDBjAgAOcA6AFAKoL2AGgI9wBAckEaQqeJ+jAoAJ0ABS0AMCEAPQQDHYQsfzBCJZDjAHcI4QDkAGQIADADGQEw4QDlAOYB5RvmA2UI9gBmCPcAQBVBQY9kCAMZdywiAAwQDBKMEigAFxEgAJMQgSw8MCEArgCvAUADg6wArQEoABcVRfCC4QCIOgMZQOxACkCOQ2SA4QBAmoxhCPcAZAiOMRQmhDEhAD0IAx2oLA0wvQADMEBhgBEwQiOAETpDI4EBMPcAQMqEFyVuMCEAvQAIMEF3QXOBAxnMLEM/goA6Ax3PLEEbgCIwQgqJIDoDHeEsIQC7CgcwOwIDGLsBBzBBIUM4hBA6Ax31LCEAuwNAEYMDHPEsBjC7AEITgEQwQhOBQDoDHUBMgLwBQrtANoEhADoIQaxAEZPkAGQMAxgSLSAAmRMDHBYtIACZFwgAIADRAHcI0AAhADMWsxYzFbMUQOqhUQIDGD4tGTAhALAA3TAhALEAIABRCJM+0QCHMAMYAT7TAFEI9gBTCPcAgDCHMR0nhTEhALIAVi0AMCAAUAQDGU0tYTBAHYAJMEAdgMkwQQ5AA4GwANEwQAmA/zBACUA/wNgAdwjXAHYI2QDaAdsB5zDcAAMw3QByMFkCAxh9LVkI3gATMCAAXgIDHHEt7TDeB2ktIABeGPMtcDDaAP4w2wDEMNwACTDdAPMtjjAgANkHBDD3AFkIhzF0J4UxIADeAN8BXghMPtkAhzDgAF8IAxhfD+AHAzDZBwMY4ApZCPYAYAhDYkAXgl4IAx2sLUcuiyAAXggBOgMduS2cMNoA/zDbAGQw3ADdAUEMgwg6Ax3CLQEwQwiCAjoDHcstRBGHAzoDHdkt4DDaAPww2wAgMEF0QQ2DBDoDHeItCDBDFoMFOgMd6y08MEMIgwY6Ax3zLQYwQAiMIABcCPMAXQj0AFoI9QBbCPYAVwj3AFgIByZCqEAGQ++YdgjTAHUI0gB0CNUAcwjUAFUIgD7WAFEIgD5WAgMdHS5QCFQCAxgkLiAAUgj3AFMIOi5A+EARgFMIQRGILy5SCFACAxg2LiAAVAj3AFUIQBGGUAj3AFEICAC7MPYAhjBBpKAvJ4YxIQChAHcIoAC9MKIAhjCjACEAIAikACEIpQD/MKAHAxyhAyQIJQQDGbguBDAiB6QApQGlDSMIpQckCPYAJQhEI4WnAHcIpgAiCPYAIwhEC4WpAKUAdwioAKQAAjBNIJSlAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZsi4oCPYAKQhBGoAdJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKji4GMCEAogcDGKMKSy6IMQAoCAAQNAA0AzQANLM0ADQBNAA0oTQHNLQ0QQWI/jQPNG40ADQCNAA0ojQHNLU0QQuCozQHNLY0QQWCpDQHNLc0QQWCpTQHNLg0QQWCpjQHNLk0QQWCnTQHNKw0QSOCnzQHNK40QQWCpzQHNLo0QRGCqDQHNLs0QQWCqTQHNLw0QQWCqjQHNL00QQWCqzQHNL40QQWCrDQHNL80QQWRADoDGSQvgDoDGSovADR2CIQAdwiFAAAICAB3CIoAdgiCAAgAQBGANy9AEYE/L/cBQxKBEgD3AEAUhYcxKif1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH68INN001TT/NAY0IADpAHcI6gDrAQgw7AAgAGkcgC9qCOsHIABpCO0AAxBtDOkAAxBqDe0A6gBsCO0AbQPsAGwIAx17L2sICAADNLc0DTQlNLE0YTRBNDc0ATQhNDw0ADRAAUoAAhAA5CAAwAHBAcIBgDDDAGowIQCZAA4wjAAiAIwBIQCNASIAjQEhAI4BBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzCXJyAApwB3CKkAqAAoDAMYMSgoABcRAxw1KCgAFxX6MCgAlgA3MJ4A+jCdAMgwIACLAAIwJwCRAJIBCTAhAJ0AIACLEwgwIQA4AgMcZCkhADUIIADEACEAuAEgAIsXIABECCAArAAgAMsGIQC2ASEAOQgDHbEoIAAsCCAAzABBA4/LACAAzQEgAEwIIDoDGXQoTAjgOgMdeCgBMCEAuQBOKUASiwE6Ax2JKCAAbgggAM4AIABvCCAAzwAFMEMQigI6Ax2dKK0BIgAMHpQoIACtCiAALQhAFoDPAUQTggM6Ax1OKUATgYweqChJE0BTQDiAzihBUIDNAEBOQEqBwygCMEIlgE0IQJ6CzwB3CM4ARByDAjoDGdcoOQhANIrrKCAATgggAL0ArQEsCL4AvwE+CC0EQWGBPwg9BEAfgSEAuQpBHIYEOgMdECkgAEsIAx0HKUEcQJ6GTwggAK0ALAj2AC0I9wBAPIVaJ5owIQC1AAopZjBAA0CVgrYAIQC5AUEkggY6Ax0gKUAgQw6ABzBDUYIHOgMdQSlAJIEgAEwGRDKDvQEtCL4ArAZBPoGtACwGQyBA9EIggAg6QKNBQkM+QAyCBToDGVcpQUGAZClBK4CsAEB/RBW5uQogAIsXkx17KYAxiyCJMSgAFxl5Kf8wIQCzAAMwIQCwAFkwIQCyACEAsQAgAJMRIACTHBEuIADACgMZwQpAHMopQgj3AEMIIACgAHcIoQAhAJ0UIQCdGI0pHRAgACEODzmiACAOowDwOaIEowYDEKMMogxBAo8iCKECIwgDHCMPoAIhABwIIACiAKMBIgikAKYBIQAbCEIHmqYEIwikBCYIogAkCKMAIgihByMIAxgjD6AHIQj3ACAIwwB3CMIACTAhAJ0AIABACA85Ax0PLkVKgCAwQCWBpAGmAUBIkaUAIA6nAPA5pQSnBgMQpwylDD8wpQWnASUIqQADECAMpQCnAUELQQKAHzBBDoGoACAIQA2GJQihAPgwIQIDGAcqCTBAA4sJKiEANBQgACgKoQACMPcAIQiHMXQnijFAP4mlASAIvj6gAI8woQAlCAMYJQ+hB0ARgCgIQhFBKZO+PqUAJwgDGCcPjz6nAKgBIAApCCgCAxxYKiUI9gAnCPcAgDCHMS8nQBicqwB3CKoArAArCK0AADCtG/8wvQC+ACwIogctCAMYLQ+jBz4IAxg+D6QHPQgDGD0Ppgd7KiAAIAj2AECZXCOCIACoCkAwQEuOMCoiDg85oQAjDqAA8DmhBKAGJA6lAPA5oASlBiYOQq+F8DCnGacEAxCnGwMUQKWBoAyhDEUGgiEIogAgCEDswPcAIwjFAHcIxAB0MJcnIADHAHcIxgBECMgARQjJAEYISAcgAO4AIABJCCAA7wAgAEcIAxhHCgMZyCogAO8HIQA0HM4qIgAMFNAqIgAMECEANBAiAAwc7yogAJkf4yoRMCEAsADLMCEAsQD/MCEAsgAhALMAIgAMEowSPDAhAK4ArwFAA4OsAK0BDy57MEBAQUaUxgAGMEYCAxgnLCEAMxMgAEAIxABBCMUAxgHHAUcIgD6APgMdEisAMEYCQAOB6jBFAkADg2AwRAIDHCwsQSSIrAB3CK0AvQAGMD0CAxgjLHYwQwqBvgB3MEMGmK0KAxmsCgkwPgIDHDUrCDC+ABMw9wAgAD0IhzF0J4sxIAC/AAMQPg29AD8HvQA9Cr8AQB2FrgB3CL8AAjA9B68AQAeZsAB3CK8ALggsAgMdWCs/CC0CAxyGKyAALwj2ADAI9wByMFonIAA+CAg6AxlxKwMwPQexAEAbm7IAdwixADIEAx14KwYw9gAAMPcAezBaJyMsIACtAawBvgo+CLEAsgExCPYAMgj3AHYwWiccLHowQB2GsQB3CL4AMQQDGRwsPQhACI2+AHcIvQAsDvA5sgAtDrEADzmyBLEGAxCxDbINQQKtIDCzALQBtQG2AbcBIAAuCDICAx2wKz8IMQIDHNErIAA/CLECLggDHC4PsgIvCLgAMAi5AAAwuRv/MLsAugA4CLMHOQgDGDkPtAc6CAMYOg+1BzsIAxg7D7YH6StAmYG4AD4IUhihIAC3CkAwNwIDHKkrMw4PObMANA60APA5swS0BjUOtQDwObQEtQY2DrYA8Dm1BLYG8DC2GbYEAxC2GwMUtgy1DLQMswxFBoYzCL0ANAi+AD0I9gA+CEK6hC0I9gAsCPcAdzBABoTAAcEBLCwhADMXQQWAdTBAnIbFAHcIxABFBAMZnCxyMEAIn8cAdwjGACAAbgggAMgAIABvCCAAyQBGCEgCxgBHCAMcRwpJAscAAxTHHwMQAxxVLMYJxwnGCgMZxwoDFCAAxR9ACqR+LMQJxQnECgMZxQpFCIA+ygBHCIA+SgIDHWosRghEAiAAyAEDHEgUSAgAMAMZATDJAMgASAwDGHksIgAMEAMcfSwiAAwUnCwgAEAbgMoAQCFAHoKJLEQIRgJGHoDEAEEegJgsQR6AnCxAHkFmnacAdwipACEALAgtBAMZqyz/MKwHAxytAyEALggvBAMZtCz/MK4HAxyvAyAAqAEiAAweuywgAKgKIAAoCEEuiqsAqAAoDAMYxywhALMTAxzLLCEAsxdBFoGMHtIsSRaG3iwhALMRAxziLCEAsxVAK4T2LCAAJwiAPqoAQKmEgD4gACoCAx30LEG0gikCAxgILUAogGYtQg+AqgBAF0AShgYtKQggAG4CAxxmLXgwQGuQqwB3CKgAKw7wOSEArQAgACgOIQCsAA85rQSsBgMQrA2tDUEChSwODzkgAKgAIQAtDkAajvA5qASrBigIIQCsAiAAKwgDHCsKAxk1LSEArQJ5MEYsgK8AQSyGrgAPOa8ErgYDEK4Nrw1BAoAuDkIsgC8ORSyArgJDLIxiLSEArwIiAAwSjBLeLSIADBreLYwa3i1zMEM1gCkHQHSGrAArCAMYKw+sBywIgD5AaUGCgi0CAx2HLUGSgioCAxipLULmh6YtIACqASEAsx+VLSAAqgpAC4cBOSAArACtAKoGKgwDGKEtQdmApS1A2UA/gQwW3i1A1oCpAkBQgSsPpwJCM4C9AEC2gj0CAx29LUG2jQMY3i0hAC4ILwQDGdwtIACpASEAsx3LLSAAqQpAC0A1hacAqACpBikMAxjXLUH4gNstQPhANZWMFiAAmR8PLiIADBzxLSMAHR/xLWEwIQCwABEwIQCxAP8wIQCyAPgtATD2AEBvhPcAbwgUJiAAxAFAFZn/LSAAxAogAEQIADADGQEwxgDEAEQMAxgLLiMAHRMDHA8uIwAdFyAAkxBkAEYoCAAgAKkAQKaRdgirAAMUqR8DEAMcKC4hADMSIACoCakJqAoDGakKKi4hADMWQM+TAToDHTMuIQCzEjMVNi4hALMWMxUgACkIgD59PgMdPi7oMCgCAxxOLkCWhqoAKQisACoI9wAsCPEmQjSAqwFBF4OAPgMdVi5kMEAXgIouQxeBrQEgAEDlQA+bZi5kMCoCAxxvLpwwIACqBwMcrAOtCl4uIAAqCKgALAipAA8wrQUtCJM+rQCHMAMYAT6qAC0I9gBAOYOAMIcxHSeOMUDsQJ6AjS5AnICwAEM+hJUuCjAoAgMYoi5AbIgDHaIuIQAwCCAAqgD/OgMZ2C5JSYGwLgowQEmBuS72MENJgKguQ0lQR4CxAEA5hAMZ2y4hADEQ2y5ATUAJgygIqwCTPqgAQR6DqQAoCPYAKQhEHoCrAED/QNyHoAB3CKEAAxAgDKIAIQyjAEAEk6QAIQymAAMQpAymDCYIowckCAMYJA+iByMODzmmACIOpADwOaYEpAZEDYIiCKYApAFECIIDEKIMowxFAoYjDaYAIg2kAAMQpg2kDUIClCMNpQAiDacAJQimBycIAxgnD6QHJgihAiQIAxwkD6ACBjChBwMYoAohDkA/gCAOSD+CIwj3ACIIQGiGpwB3CKkAdgioACcIlydAdYx3CKoAKAYDHW0vKwgpBgMZli8DECAAJw2qAEC3gSMAkQBAmZUjAJMAFROVExUVIACLE1UwIwCWAKowlgCVFCAAixcjABURIwCVGIgvIAASEkD/hqgAqQEqCKcAqgonHHEvQaWGoQGiAQMQIA2jACAAIwhALEAogRUUEwhADoSkASAIpgClASIIQQWKJQShACQIJgSiACMIoACjCiAcni8hCEFjvwA0ADTVNP00wTT+NFk0/zTPNP80MDQANIY0ADTTNAA0GjQBNFw0ATScNAE02jQBNBY0AjRRNAI0jDQCNMc0AjQCNAM0PzQDNH00AzS9NAM0ATQENEg0BDSUNAQ05TQEND80BTSkNAU0FzQGNJ40BjRENAc0HjQINF00CTSrNAs0QD8BAQIADoHUD/86AA==",
+});
@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_fo433", {
+	"hex_celsius":"AQACAACgAACNMbkt/zSKASAACx03KCIAjBAhADYIAxkXKAMQIQC1DIIwIACVACEAtgEsKCEANQghADMFIAC9AD0IAxkkKMEwQA6BJyhDMEADlSIAjBQBMCEAtgAAMCEANQQDHTUoIQCVFiAAixIgAAsRIACRHHMoAxAiAA0NQSGdAx1EKBAwvQAhAI4BIgCNASAAPQgQOgMZWig9CCA6AxlfKD0IQDoDGWQoPQiAOgMZaShtKCEALggiAI4AQASALwhCBIAwCEIEgDEIQARAJJMiAI0AIACREAkAIADAAcEBwgGAMMMAajAhAJkADDCMACIAjAEhAI0BQDxAQLcEMCMAjAAhAB4WnhcjAI4BBTAgAJwA+jCbACEAkRRyMCgAlwB/MKcnIACnAHcIqQCoACgMAxilKCgAFxEDHKkoKAAXFfowKACWADcwngD6MJ0AwDAgAIsAIQCVERUQlRQVEQkwnQAGMCEANAIDGGYpQKeAAx1AA4Y0CAMdyyj/MCEAswA7KUAHgwE6Ax3WKEUwQAiBIADLAUEKgwI6Ax0CKXUwREGcKA7wOakAIABsCCAAzAAgAG0IIADNACAAqACrAagbqwMPMKgFqwEpCKoArAEoCCoEqQArCCwErQApCEM2hAM6Ax0MKSAATAhDCY8EOgMdMikgAKkBIgCMHhgpIACpCiAAKQ7wOagAAxCoDUABQA2BDB4mKUMNgasAKAhAMIGoACkEQyWEBToDHTspIABLCEAJlyEAMwggAKkACDCoACAAKAirAKgDKwgDGV0pKQggAEsGIACrAIAwqwUDECAAyw0gAEANg1kpMTAgAMsGQAmTqQ1BKYAwIQC1ACAAixYhAJUSIQC0CiAAkx18KYgxACCBMSgAFxl6KUCnrLEAAzAhAK4AWTAhALAAIQCvACAAkxEgAJMcIS4gAMAKAxnBCkAcyylCCPcAQwggAKAAdwihACEAnRQhAJ0YjikdECAAIQ4POaIAIA6jAPA5ogSjBgMQowyiDEECjyIIoQIjCAMcIw+gAiEAHAggAKIAowEiCKQApgEhABsIQgeapgQjCKQEJgiiACQIowAiCKEHIwgDGCMPoAchCPcAIAjDAHcIwgAJMCEAnQAgAEAIDzkDHR8uRUqAIDBAJYGkAaYBQEiRpQAgDqcA8DmlBKcGAxCnDKUMPzClBacBJQipAAMQIAylAKcBQQtBAoAfMEEOgagAIAhADYYlCKEA+DAhAgMYCCoJMEADiwoqIQAyFCAAKAqhAAIw9wAhCI8xByeCMUA/iaUBIAibPqAAjjChACUIAxglD6EHQBGAKAhCEUEpk5s+pQAnCAMYJw+OPqcAqAEgACkIKAIDHFkqJQj2ACcI9wCAMIcx4CdAGJyrAHcIqgCsACsIrQAAMK0b/zC/AL4ALAiiBy0IAxgtD6MHPggDGD4PpAc/CAMYPw+mB3wqIAAgCPYAQJlcI4IgAKgKQDBAS44xKiIODzmhACMOoADwOaEEoAYkDqUA8DmgBKUGJg5Cr4XwMKcZpwQDEKcbAxRApYGgDKEMRQaCIQiiACAIQOzV9wAjCMUAdwjEAHQwpycgAMcAdwjGAEQIyABFCMkARghIByAA7AAgAEkIIADtACAARwgDGEcKAxnJKiAA7QcDMCEANwIDGNAqIQC0ASEANwgDHdYqMDC3ACEAtwMhADIc3ioiAAwU4CoiAAwQIQAyECIADBz/KiAAmR/zKhEwIQCuAMswIQCvAP8wIQCwACEAsQAiAAwSjBI8MCEArACtATwwIADuAO8BHy58MEBPQVWUxgAGMEYCAxg3LCEAMRMgAEAIxABBCMUAxgHHAUcIgD6APgMdIisAMEYCQAOB6jBFAkADg2AwRAIDHDwsQSSIrAB3CK0AvwAGMD8CAxgzLHcwQwqBvgB4MEMGmK0KAxmsCgkwPgIDHEUrCDC+ABMw9wAgAD8IjzEHJ4MxIACuAAMQPg2/AC4HvwA/Cq4AQB2FrwB3CK4AAjA/B7AAQAeZsQB3CLAALwgsAgMdaCsuCC0CAxyWKyAAMAj2ADEI9wByMGonIAA+CAg6AxmBKwMwPweyAEAbm7MAdwiyADMEAx2IKwYw9gAAMPcAfDBqJzMsIACtAawBvgo+CLIAswEyCPYAMwj3AHcwaicsLHswQB2GsgB3CL4AMgQDGSwsPwhACI2+AHcIvwAsDvA5swAtDrIADzmzBLIGAxCyDbMNQQKtIDC0ALUBtgG3AbgBIAAvCDMCAx3AKy4IMgIDHOErIAAuCLICLwgDHC8PswIwCLkAMQi6AAAwuhv/MLwAuwA5CLQHOggDGDoPtQc7CAMYOw+2BzwIAxg8D7cH+StAmYG5AD4IUhihIAC4CkAwOAIDHLkrNA4PObQANQ61APA5tAS1BjYOtgDwObUEtgY3DrcA8Dm2BLcG8DC3GbcEAxC3GwMUtwy2DLUMtAxFBoY0CL8ANQi+AD8I9gA+CEK6hC0I9gAsCPcAeDBABoTAAcEBPCwhADEXQQWAdjBAnIbFAHcIxABFBAMZrCxyMEAIn8cAdwjGACAAbAggAMgAIABtCCAAyQBGCEgCxgBHCAMcRwpJAscAAxTHHwMQAxxlLMYJxwnGCgMZxwoDFCAAxR9ACqSOLMQJxQnECgMZxQpFCIA+ygBHCIA+SgIDHXosRghEAiAAyAEDHEgUSAgAMAMZATDJAMgASAwDGIksIgAMEAMcjSwiAAwUrCwgAEAbgMoAQCFAHoKZLEQIRgJGHoDEAEEegKgsQR6ArCxAHkFmnacAdwipACAAbghvBAMZuyz/MO4HAxzvAyEALAgtBAMZxCz/MKwHAxytAyAAqAEiAAweyywgAKgKIAAoCEEuiqsAqAAoDAMY1ywhALETAxzbLCEAsRdBFoGMHuIsSRaG7iwhALERAxzyLCEAsRVAK4QGLSAAJwiAPqoAQKmEgD4gACoCAx0ELUG0gikCAxgYLUAogHYtQg+AqgBAF0AShhYtKQggAGwCAxx2LXkwQGuQqwB3CKgAKw7wOSAA7wAgACgOIADuAA857wTuBgMQ7g3vDUEChW4ODzkgAKgAIABvDkAajvA5qASrBigIIADuAiAAKwgDHCsKAxlFLSAA7wJ6MEUsgSEArQBALIchAKwADzmtBKwGAxCsDa0NQQKALA5BLIEhAC0ORCyBIQCsAkMsjHItIQCtAiIADBKMEu4tIgAMGu4tjBruLXMwQzWAKQdAdIasACsIAxgrD6wHLAiAPkA8QYKCLQIDHZctQZKCKgIDGLktQuaHti0gAKoBIQCxH6UtIACqCkALhwE5IACsAK0AqgYqDAMYsS1B2YC1LUDZQD+BDBbuLUDWgKkCQFCBKw+nAkIzgL8AQLaCPwIDHc0tQbaNAxjuLSEALAgtBAMZ7C0gAKkBIQCxHdstIACpCkALQDWFpwCoAKkGKQwDGOctQfiA6y1A+EA1lYwWIACZHx8uIgAMHAEuIwAdHwEuYTAhAK4AETAhAK8A/zAhALAACC4BMPYAQG+E9wBtCCQmIADEAUAVmQ8uIADECiAARAgAMAMZATDGAMQARAwDGBsuIwAdEwMcHy4jAB0XIACTEGQAuigIACAAqQBAppF2CKsAAxSpHwMQAxw4LiEAMRIgAKgJqQmoCgMZqQo6LiEAMRZAz5MBOgMdQy4hALESMRFGLiEAsRYxFSAAKQiAPn0+Ax1OLugwKAIDHF4uQJaGqgApCKwAKgj3ACwIASdCNICrAUEXg4A+Ax1mLmQwQBeAmi5DF4GtASAAQOVAD5t2LmQwKgIDHH8unDAgAKoHAxysA60Kbi4gACoIqAAsCKkADzCtBS0IJj6tAI8wAxgBPqoALQj2AEA5g4AwhzHOJ4YxQOxAnoCdLkCcgK4AQz6EpS4KMCgCAxiyLkBsiAMdsi4hAC4IIACqAP86AxnoLklJgcAuCjBASYHJLvYwQ0mAuC5DSVBHgK8AQDmEAxnrLiEALxDrLkBNQAmDKAirACY+qABBHoOpACgI9gApCEQegKsAQP9A3IegAHcIoQADECAMogAhDKMAQASTpAAhDKYAAxCkDKYMJgijByQIAxgkD6IHIw4POaYAIg6kAPA5pgSkBkQNgiIIpgCkAUQIggMQogyjDEUChiMNpgAiDaQAAxCmDaQNQgKUIw2lACINpwAlCKYHJwgDGCcPpAcmCKECJAgDHCQPoAIGMKEHAxigCiEOQD+AIA5IP4IjCPcAIghAaIanAHcIqQB2CKgAJwinJ0B1jHcIqgAoBgMdfS8rCCkGAxmmLwMQIAAnDaoAQLeBIwCRAECZlSMAkwAVE5UTFRUgAIsTVTAjAJYAqjCWAJUUIACLFyMAFREjAJUYmC8gABISQP+GqACpASoIpwCqCiccgS9BpYahAaIBAxAgDaMAIAAjCEAsQCiBFRQTCEAOhKQBIAimAKUBIghBBYolBKEAJAgmBKIAIwigAKMKIByuLyEIQWOQADoDGdUvgDoDGdsvADR2CIQAdwiFAAAICAB3CIoAdgiCAEERgOgvQBGB8C/3AUMSgRIA9wBAFIWHMdsn9QD2D/cD9wpABYX0AHUI9wB0CAgAADRAAEBzoCIADQggAN8AIQAOCCAA4AAiAI0B2DAhAI4AAxAhADwNIADhAOIBIACOHxooIADiCiAAYQjjAGII4QBjBCEAvAADEEMRgQ4eLChOEYEOHz4oThGBjh1QKEgRhSAAXwgiAI0AIABgCEBQQMuhIQA7CAMduwMPMCEAOAIDGHgsiDCKAHIwOAcDGIoKggCBKNMo6ygGKSwpBCzAKygsNCx4LHgsUCnpKYwq9CqIMCEAPAVAf5IIOgMdkCgbMCEAuwAGMCEAuAB6LAAwIQA8BAMZeix/MIcxpyeIMUCQgncI3wBgBEAKgDMwQh6DAzoDHawoATBBG4AiMEILgwI6Ax24KAIwQQuAETBCC4MBOgMdxygNMEA2gAMwQQ6ARDBCDoNAOgMdeiwHMEJCi/YAbTD3AAAwhjEkJogxIQAuECEAsRYxFUM/gDM6QEeDIQC4AXoscjBCVYDhAEBVhAEw9gBfCPcAYQhBH0NOgCI6QxqAfDBAGoCJMUIaieIAADD3AGIIjCQGMCAAYgIDGCEpQbWDISkRMLsABDBATkNogBE6QyWAdzBFJUBgQ0CAiTFBI4NFKQ0wuwAFMEsjgSEAMRZAc0DHjTkCAxiBKSEAOhxjKYUwIQCuANEwIQCvAGkpYTBABoAZMEAGggMQIQA6DEAjjCY+3wCPMAMYAT7hAF8I9gBhCPcAgDCHMc4nQEuJ4gAhALAA4ikEMPcAIQA6CI8xBydAC4jfAOEBXwjbPt8AYQgDGGEPjj5KHoCuAFAdgt8KAxnhCkkggK8AUCCCAjDfBwMYSiGEsABuMCEAuwAMMECihXosADAhADsEAx3xKUGggIgwQquDgDoDHf0pBzBBE4AiMEILhCA6Ax0eKiEAugpCsogTKhMwIQA6AgMcGiq6ARoqCzBBBoI8KroBPCpABkAgQ9iEEDoDHVwqIQC6A0IggDUqQiCDWCoSMLoAWCpDIYwKMLoAfDCHMacnijEgAOEAdwjfAOIABjBiAkAWQIaEBToDHVEqugq6CkEHhAY6Ax1YKv4wugdCPYBEMEI9g0A6Ax16LBMwQKOAOQhAo0AqgN8AQBuCIADfB18IQjSD5gB3COUAIABAo4QgAGUI9wBmCMwkQgtBooANMEEvQmOEqCohADocnioAMEMZhIYxJCaKMe0qATBHCUTnQUNH54ADMEjnQBaE4gAEMGICAxjWKkgthCAAYggHOgMd5CpADEAthAAw9wBfCIwk7SpHT0FngA4wQWdLj4chADsIAx0IKyEAuAF6LIgwQauD4QCAOgMdFCtCt5khALweKisgAOUKAxnmCmYIgD59PgMdIivpMGUCAxxAKwkwIADlBwMY5gpAKyEAPB5XK/8wQAiBAxzmA0IWgDkrQhaA9zBCDUrGhh8wKAAdAgMcUyv4MJ0HQspC+oDhAED6gLwrQGiCBjoDHa4rQGaACjpABECEQIuDdzCHMWonizFCB4B4MEEHgCAAQEeGgD4DHYErBjBlAgMYritBp4DhAECSgGEIQJFAE4LiAIcxpydABIbjAHcI4QD2AGMI9wByMEIjgeIKYghCEIDiAEAQgGIEQECDBjAgAOUA5gFAKoL2AGYI9wBAckEaQqeJ+jAoAJ0AeiwAMCEAOwQDHfkrfzBCJZDhAHcI3wDiAGIIADADGQEw3wDjAOQB4xvkA2MI9gBkCPcAQBVBQZViCAMZ7CsiAAwQDBKMEigAFxEgAJMQ9is8MCEArACtATwwIADuAO8BKAAXFUXwgt8AiDoDGUDsQApAjoGnJ4wxQWSA3wBAmoxfCPcAYgiGMSQmjDEhADsIAx0dLA0wuwADMEBhgBEwQiOAETpDI4EBMPcAQMqEjCRuMCEAuwAIMEF3QXOBAxlBLEM/goA6Ax1ELEEbgCIwQgqJIDoDHVYsIQC5CgcwOQIDGLkBBzBBIUM4hBA6Ax1qLCEAuQNAEYMDHGYsBjC5AEITgEQwQhOBQDoDHUBMgLoBQrtANoEhADgIQaxAEZPiAGIMAxiHLCAAmRMDHIssIACZFwgAIADPAHcIzgAhADEWsRYxFbEUQOqXTwIDGLMsGTAhAK4A3TAhAK8AIABPCCY+zwCPMAMYAT7RAE8I9gBRCPcAgDCHMc4nQJuHsADLLAAwIABOBAMZwixhMEAdgAkwQB2AyTBBDkADga4A0TBACYD/MEAJQD+s1gB3CNUAdgjXANgB2QHnMNoAAzDbAHIwVwIDGPIsVwjcABMwIABcAgMc5iztMNwH3iwgAFwYcS1wMNgA/jDZAHgw2gAFMNsAcS2OMCAA1wcEMPcAVwiPMQcnQPKR3ADdAVwI2z7XAI4w3gBdCAMYXQ/eBwMw1wcDGN4KVwj2AF4IQmKAjTFAF4JcCAMdIS1HLosgAFwIAToDHS4tzjDYAP8w2QAyMNoA2wFBDIMJOgMdNy0BMEMIggI6Ax1ALUQRgwQ6Ax1JLQ8wQwiCAzoDHVctQjWCkDDaAAEwQjWDBToDHWAtCDBDFoMGOgMdaS08MEMIgwc6Ax1xLQYwQAiMIABaCPMAWwj0AFgI9QBZCPYAVQj3AFYIhSVCsUAGQ/iZdgjRAHUI0AB0CNMAcwjSAFMIgD7UAE8IgD5UAgMdmy1OCFICAxiiLSAAUAj3AFEIuC0gAEAOgdQAUQhBEYitLVAITgIDGLQtIABSCPcAUwhAEYZOCPcATwgIADkw9gCOMEGtoOAnjTEhAKEAdwigADswogCOMKMAIQAgCKQAIQilAP8woAcDHKEDJAglBAMZNi4EMCIHpAClAaUNIwilByQI9gAlCEQjhacAdwimACII9gAjCEQLhakApQB3CKgApAACMEsglo4xIQClAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZMC4oCPYAKQhBGoDOJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKDC4GMCEAogcDGKMKyS2AMXQoCAAQNAA0AzQANLE0ADQBNAA0/zQHNLI0QQWI/TQHNGw0ADQCNAA0NDQPNLM0QQuCNTQPNLQ0QQWCNjQPNLU0QQWCNzQPNLY0QQWCODQPNLc0QQWCMDQPNG40QSOCMjQPNKw0QQWCOTQPNLg0QRGCOjQPNLk0QQWCOzQPNLo0QQWCPDQPNLs0QQWCPTQPNLw0QQWCPjQPNL00QQVAAI8aNP40nTT+NPI0/jQzNP80aTT/NJg0/zTDNP806zT/NEBzhzM0ADRVNAA0dzQANJg0ADRAPcLZNAA0+jQANBw0ATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNGE0GTT/NAA00TShNP80AjTJNM00/zQBNIU0tzT/NAQ0YTQRNP80AzRhNMk0/zQFNIU00TT/NAg0zTSFNP80BjTRNEEDgN00QCOCCTTdNNU0QMOpIADnAHcI6ADpAQgw6gAgAGccEy9oCOkHIABnCOsAAxBrDOcAAxBoDesA6ABqCOsAawPqAGoIAx0OL2kICAADNLc0DTQlNLE0YTRBNDc0ATQhNDw0QKhBmEAAgBg0QwWAADQBAQIADoHUD/86AA==",
+	"hex_fahrenheit":"AQACAACgAACNMbkt/zSKASAACx03KCIAjBAhADYIAxkXKAMQIQC1DIIwIACVACEAtgEsKCEANQghADMFIAC9AD0IAxkkKMEwQA6BJyhDMEADlSIAjBQBMCEAtgAAMCEANQQDHTUoIQCVFiAAixIgAAsRIACRHHMoAxAiAA0NQSGdAx1EKBAwvQAhAI4BIgCNASAAPQgQOgMZWig9CCA6AxlfKD0IQDoDGWQoPQiAOgMZaShtKCEALggiAI4AQASALwhCBIAwCEIEgDEIQARAJJMiAI0AIACREAkAIADAAcEBwgGAMMMAajAhAJkADDCMACIAjAEhAI0BQDxAQLcEMCMAjAAhAB4WnhcjAI4BBTAgAJwA+jCbACEAkRRyMCgAlwB/MKcnIACnAHcIqQCoACgMAxilKCgAFxEDHKkoKAAXFfowKACWADcwngD6MJ0AwDAgAIsAIQCVERUQlRQVEQkwnQAGMCEANAIDGGYpQKeAAx1AA4Y0CAMdyyj/MCEAswA7KUAHgwE6Ax3WKEUwQAiBIADLAUEKgwI6Ax0CKXUwREGcKA7wOakAIABsCCAAzAAgAG0IIADNACAAqACrAagbqwMPMKgFqwEpCKoArAEoCCoEqQArCCwErQApCEM2hAM6Ax0MKSAATAhDCY8EOgMdMikgAKkBIgCMHhgpIACpCiAAKQ7wOagAAxCoDUABQA2BDB4mKUMNgasAKAhAMIGoACkEQyWEBToDHTspIABLCEAJlyEAMwggAKkACDCoACAAKAirAKgDKwgDGV0pKQggAEsGIACrAIAwqwUDECAAyw0gAEANg1kpMTAgAMsGQAmTqQ1BKYAwIQC1ACAAixYhAJUSIQC0CiAAkx18KYgxACCBMSgAFxl6KUCnrLEAAzAhAK4AWTAhALAAIQCvACAAkxEgAJMcIS4gAMAKAxnBCkAcyylCCPcAQwggAKAAdwihACEAnRQhAJ0YjikdECAAIQ4POaIAIA6jAPA5ogSjBgMQowyiDEECjyIIoQIjCAMcIw+gAiEAHAggAKIAowEiCKQApgEhABsIQgeapgQjCKQEJgiiACQIowAiCKEHIwgDGCMPoAchCPcAIAjDAHcIwgAJMCEAnQAgAEAIDzkDHR8uRUqAIDBAJYGkAaYBQEiRpQAgDqcA8DmlBKcGAxCnDKUMPzClBacBJQipAAMQIAylAKcBQQtBAoAfMEEOgagAIAhADYYlCKEA+DAhAgMYCCoJMEADiwoqIQAyFCAAKAqhAAIw9wAhCI8xByeCMUA/iaUBIAibPqAAjjChACUIAxglD6EHQBGAKAhCEUEpk5s+pQAnCAMYJw+OPqcAqAEgACkIKAIDHFkqJQj2ACcI9wCAMIcx4CdAGJyrAHcIqgCsACsIrQAAMK0b/zC/AL4ALAiiBy0IAxgtD6MHPggDGD4PpAc/CAMYPw+mB3wqIAAgCPYAQJlcI4IgAKgKQDBAS44xKiIODzmhACMOoADwOaEEoAYkDqUA8DmgBKUGJg5Cr4XwMKcZpwQDEKcbAxRApYGgDKEMRQaCIQiiACAIQOzV9wAjCMUAdwjEAHQwpycgAMcAdwjGAEQIyABFCMkARghIByAA7AAgAEkIIADtACAARwgDGEcKAxnJKiAA7QcDMCEANwIDGNAqIQC0ASEANwgDHdYqMDC3ACEAtwMhADIc3ioiAAwU4CoiAAwQIQAyECIADBz/KiAAmR/zKhEwIQCuAMswIQCvAP8wIQCwACEAsQAiAAwSjBI8MCEArACtATwwIADuAO8BHy58MEBPQVWUxgAGMEYCAxg3LCEAMRMgAEAIxABBCMUAxgHHAUcIgD6APgMdIisAMEYCQAOB6jBFAkADg2AwRAIDHDwsQSSIrAB3CK0AvwAGMD8CAxgzLHcwQwqBvgB4MEMGmK0KAxmsCgkwPgIDHEUrCDC+ABMw9wAgAD8IjzEHJ4MxIACuAAMQPg2/AC4HvwA/Cq4AQB2FrwB3CK4AAjA/B7AAQAeZsQB3CLAALwgsAgMdaCsuCC0CAxyWKyAAMAj2ADEI9wByMGonIAA+CAg6AxmBKwMwPweyAEAbm7MAdwiyADMEAx2IKwYw9gAAMPcAfDBqJzMsIACtAawBvgo+CLIAswEyCPYAMwj3AHcwaicsLHswQB2GsgB3CL4AMgQDGSwsPwhACI2+AHcIvwAsDvA5swAtDrIADzmzBLIGAxCyDbMNQQKtIDC0ALUBtgG3AbgBIAAvCDMCAx3AKy4IMgIDHOErIAAuCLICLwgDHC8PswIwCLkAMQi6AAAwuhv/MLwAuwA5CLQHOggDGDoPtQc7CAMYOw+2BzwIAxg8D7cH+StAmYG5AD4IUhihIAC4CkAwOAIDHLkrNA4PObQANQ61APA5tAS1BjYOtgDwObUEtgY3DrcA8Dm2BLcG8DC3GbcEAxC3GwMUtwy2DLUMtAxFBoY0CL8ANQi+AD8I9gA+CEK6hC0I9gAsCPcAeDBABoTAAcEBPCwhADEXQQWAdjBAnIbFAHcIxABFBAMZrCxyMEAIn8cAdwjGACAAbAggAMgAIABtCCAAyQBGCEgCxgBHCAMcRwpJAscAAxTHHwMQAxxlLMYJxwnGCgMZxwoDFCAAxR9ACqSOLMQJxQnECgMZxQpFCIA+ygBHCIA+SgIDHXosRghEAiAAyAEDHEgUSAgAMAMZATDJAMgASAwDGIksIgAMEAMcjSwiAAwUrCwgAEAbgMoAQCFAHoKZLEQIRgJGHoDEAEEegKgsQR6ArCxAHkFmnacAdwipACAAbghvBAMZuyz/MO4HAxzvAyEALAgtBAMZxCz/MKwHAxytAyAAqAEiAAweyywgAKgKIAAoCEEuiqsAqAAoDAMY1ywhALETAxzbLCEAsRdBFoGMHuIsSRaG7iwhALERAxzyLCEAsRVAK4QGLSAAJwiAPqoAQKmEgD4gACoCAx0ELUG0gikCAxgYLUAogHYtQg+AqgBAF0AShhYtKQggAGwCAxx2LXkwQGuQqwB3CKgAKw7wOSAA7wAgACgOIADuAA857wTuBgMQ7g3vDUEChW4ODzkgAKgAIABvDkAajvA5qASrBigIIADuAiAAKwgDHCsKAxlFLSAA7wJ6MEUsgSEArQBALIchAKwADzmtBKwGAxCsDa0NQQKALA5BLIEhAC0ORCyBIQCsAkMsjHItIQCtAiIADBKMEu4tIgAMGu4tjBruLXMwQzWAKQdAdIasACsIAxgrD6wHLAiAPkA8QYKCLQIDHZctQZKCKgIDGLktQuaHti0gAKoBIQCxH6UtIACqCkALhwE5IACsAK0AqgYqDAMYsS1B2YC1LUDZQD+BDBbuLUDWgKkCQFCBKw+nAkIzgL8AQLaCPwIDHc0tQbaNAxjuLSEALAgtBAMZ7C0gAKkBIQCxHdstIACpCkALQDWFpwCoAKkGKQwDGOctQfiA6y1A+EA1lYwWIACZHx8uIgAMHAEuIwAdHwEuYTAhAK4AETAhAK8A/zAhALAACC4BMPYAQG+E9wBtCCQmIADEAUAVmQ8uIADECiAARAgAMAMZATDGAMQARAwDGBsuIwAdEwMcHy4jAB0XIACTEGQAuigIACAAqQBAppF2CKsAAxSpHwMQAxw4LiEAMRIgAKgJqQmoCgMZqQo6LiEAMRZAz5MBOgMdQy4hALESMRVGLiEAsRYxFSAAKQiAPn0+Ax1OLugwKAIDHF4uQJaGqgApCKwAKgj3ACwIASdCNICrAUEXg4A+Ax1mLmQwQBeAmi5DF4GtASAAQOVAD5t2LmQwKgIDHH8unDAgAKoHAxysA60Kbi4gACoIqAAsCKkADzCtBS0IJj6tAI8wAxgBPqoALQj2AEA5g4AwhzHOJ4YxQOxAnoCdLkCcgK4AQz6EpS4KMCgCAxiyLkBsiAMdsi4hAC4IIACqAP86AxnoLklJgcAuCjBASYHJLvYwQ0mAuC5DSVBHgK8AQDmEAxnrLiEALxDrLkBNQAmDKAirACY+qABBHoOpACgI9gApCEQegKsAQP9A3IegAHcIoQADECAMogAhDKMAQASTpAAhDKYAAxCkDKYMJgijByQIAxgkD6IHIw4POaYAIg6kAPA5pgSkBkQNgiIIpgCkAUQIggMQogyjDEUChiMNpgAiDaQAAxCmDaQNQgKUIw2lACINpwAlCKYHJwgDGCcPpAcmCKECJAgDHCQPoAIGMKEHAxigCiEOQD+AIA5IP4IjCPcAIghAaIanAHcIqQB2CKgAJwinJ0B1jHcIqgAoBgMdfS8rCCkGAxmmLwMQIAAnDaoAQLeBIwCRAECZlSMAkwAVE5UTFRUgAIsTVTAjAJYAqjCWAJUUIACLFyMAFREjAJUYmC8gABISQP+GqACpASoIpwCqCiccgS9BpYahAaIBAxAgDaMAIAAjCEAsQCiBFRQTCEAOhKQBIAimAKUBIghBBYolBKEAJAgmBKIAIwigAKMKIByuLyEIQWOQADoDGdUvgDoDGdsvADR2CIQAdwiFAAAICAB3CIoAdgiCAEERgOgvQBGB8C/3AUMSgRIA9wBAFIWHMdsn9QD2D/cD9wpABYX0AHUI9wB0CAgAADRAAEBzoCIADQggAN8AIQAOCCAA4AAiAI0B2DAhAI4AAxAhADwNIADhAOIBIACOHxooIADiCiAAYQjjAGII4QBjBCEAvAADEEMRgQ4eLChOEYEOHz4oThGBjh1QKEgRhSAAXwgiAI0AIABgCEBQQMuhIQA7CAMduwMPMCEAOAIDGHgsiDCKAHIwOAcDGIoKggCBKNMo6ygGKSwpBCzAKygsNCx4LHgsUCnpKYwq9CqIMCEAPAVAf5IIOgMdkCgbMCEAuwAGMCEAuAB6LAAwIQA8BAMZeix/MIcxpyeIMUCQgncI3wBgBEAKgDMwQh6DAzoDHawoATBBG4AiMEILgwI6Ax24KAIwQQuAETBCC4MBOgMdxygNMEA2gAMwQQ6ARDBCDoNAOgMdeiwHMEJCi/YAbTD3AAAwhjEkJogxIQAuECEAsRYxFUM/gDM6QEeDIQC4AXoscjBCVYDhAEBVhAEw9gBfCPcAYQhBH0NOgCI6QxqAfDBAGoCJMUIaieIAADD3AGIIjCQGMCAAYgIDGCEpQbWDISkRMLsABDBATkNogBE6QyWAdzBFJUBgQ0CAiTFBI4NFKQ0wuwAFMEsjgSEAMRZAc0DHjTkCAxiBKSEAOhxjKYUwIQCuANEwIQCvAGkpYTBABoAZMEAGggMQIQA6DEAjjCY+3wCPMAMYAT7hAF8I9gBhCPcAgDCHMc4nQEuJ4gAhALAA4ikEMPcAIQA6CI8xBydAC4jfAOEBXwjbPt8AYQgDGGEPjj5KHoCuAFAdgt8KAxnhCkkggK8AUCCCAjDfBwMYSiGEsABuMCEAuwAMMECihXosADAhADsEAx3xKUGggIgwQquDgDoDHf0pBzBBE4AiMEILhCA6Ax0eKiEAugpCsogTKhMwIQA6AgMcGiq6ARoqCzBBBoI8KroBPCpABkAgQ9iEEDoDHVwqIQC6A0IggDUqQiCDWCoSMLoAWCpDIYwKMLoAfDCHMacnijEgAOEAdwjfAOIABjBiAkAWQIaEBToDHVEqugq6CkEHhAY6Ax1YKv4wugdCPYBEMEI9g0A6Ax16LBMwQKOAOQhAo0AqgN8AQBuCIADfB18IQjSD5gB3COUAIABAo4QgAGUI9wBmCMwkQgtBooANMEEvQmOEqCohADocnioAMEMZhIYxJCaKMe0qATBHCUTnQUNH54ADMEjnQBaE4gAEMGICAxjWKkgthCAAYggHOgMd5CpADEAthAAw9wBfCIwk7SpHT0FngA4wQWdLj4chADsIAx0IKyEAuAF6LIgwQauD4QCAOgMdFCtCt5khALweKisgAOUKAxnmCmYIgD59PgMdIivpMGUCAxxAKwkwIADlBwMY5gpAKyEAPB5XK/8wQAiBAxzmA0IWgDkrQhaA9zBCDUrGhh8wKAAdAgMcUyv4MJ0HQspC+oDhAED6gLwrQGiCBjoDHa4rQGaACjpABECEQIuDdzCHMWonizFCB4B4MEEHgCAAQEeGgD4DHYErBjBlAgMYritBp4DhAECSgGEIQJFAE4LiAIcxpydABIbjAHcI4QD2AGMI9wByMEIjgeIKYghCEIDiAEAQgGIEQECDBjAgAOUA5gFAKoL2AGYI9wBAckEaQqeJ+jAoAJ0AeiwAMCEAOwQDHfkrfzBCJZDhAHcI3wDiAGIIADADGQEw3wDjAOQB4xvkA2MI9gBkCPcAQBVBQZViCAMZ7CsiAAwQDBKMEigAFxEgAJMQ9is8MCEArACtATwwIADuAO8BKAAXFUXwgt8AiDoDGUDsQApAjoGnJ4wxQWSA3wBAmoxfCPcAYgiGMSQmjDEhADsIAx0dLA0wuwADMEBhgBEwQiOAETpDI4EBMPcAQMqEjCRuMCEAuwAIMEF3QXOBAxlBLEM/goA6Ax1ELEEbgCIwQgqJIDoDHVYsIQC5CgcwOQIDGLkBBzBBIUM4hBA6Ax1qLCEAuQNAEYMDHGYsBjC5AEITgEQwQhOBQDoDHUBMgLoBQrtANoEhADgIQaxAEZPiAGIMAxiHLCAAmRMDHIssIACZFwgAIADPAHcIzgAhADEWsRYxFbEUQOqXTwIDGLMsGTAhAK4A3TAhAK8AIABPCCY+zwCPMAMYAT7RAE8I9gBRCPcAgDCHMc4nQJuHsADLLAAwIABOBAMZwixhMEAdgAkwQB2AyTBBDkADga4A0TBACYD/MEAJQD+s1gB3CNUAdgjXANgB2QHnMNoAAzDbAHIwVwIDGPIsVwjcABMwIABcAgMc5iztMNwH3iwgAFwYcS1wMNgA/jDZAMQw2gAJMNsAcS2OMCAA1wcEMPcAVwiPMQcnQPKR3ADdAVwI2z7XAI4w3gBdCAMYXQ/eBwMw1wcDGN4KVwj2AF4IQmKAjTFAF4JcCAMdIS1HLosgAFwIAToDHS4tnDDYAP8w2QBkMNoA2wFBDIMJOgMdNy0BMEMIggI6Ax1ALUQRgwQ6Ax1JLQ8wQwiHAzoDHVct4DDYAPww2QAgMEF9QQ2DBToDHWAtCDBDFoMGOgMdaS08MEMIgwc6Ax1xLQYwQAiMIABaCPMAWwj0AFgI9QBZCPYAVQj3AFYIhSVCsUAGQ/iZdgjRAHUI0AB0CNMAcwjSAFMIgD7UAE8IgD5UAgMdmy1OCFICAxiiLSAAUAj3AFEIuC0gAEAOgdQAUQhBEYitLVAITgIDGLQtIABSCPcAUwhAEYZOCPcATwgIADkw9gCOMEGtoOAnjTEhAKEAdwigADswogCOMKMAIQAgCKQAIQilAP8woAcDHKEDJAglBAMZNi4EMCIHpAClAaUNIwilByQI9gAlCEQjhacAdwimACII9gAjCEQLhakApQB3CKgApAACMEsglo4xIQClAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZMC4oCPYAKQhBGoDOJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKDC4GMCEAogcDGKMKyS2AMXQoCAAQNAA0AzQANLE0ADQBNAA0/zQHNLI0QQWI/TQHNGw0ADQCNAA0NDQPNLM0QQuCNTQPNLQ0QQWCNjQPNLU0QQWCNzQPNLY0QQWCODQPNLc0QQWCMDQPNG40QSOCMjQPNKw0QQWCOTQPNLg0QRGCOjQPNLk0QQWCOzQPNLo0QQWCPDQPNLs0QQWCPTQPNLw0QQWCPjQPNL00QQVAAN7VNP00wTT+NFk0/zTPNP80MDQANIY0ADTTNAA0GjQBNFw0ATScNAE02jQBNBY0AjRRNAI0jDQCNMc0AjQCNAM0PzQDNH00AzS9NAM0ATQENEg0BDSUNAQ05TQEND80BTSkNAU0FzQGNJ40BjRENAc0HjQINF00CTSrNAs0YTQZNP80ADTRNKE0/zQCNMk0zTT/NAE0hTS3NP80BDRhNBE0/zQDNGE0yTT/NAU0hTTRNP80CDTNNIU0/zQGNNE0QQOA3TRAI4IJNN001TRAw6kgAOcAdwjoAOkBCDDqACAAZxwTL2gI6QcgAGcI6wADEGsM5wADEGgN6wDoAGoI6wBrA+oAaggDHQ4vaQgIAAM0tzQNNCU0sTRhNEE0NzQBNCE0PDRAqEGYQACAGDRDBYAANAEBAgAOgdQP/zoA",
+});
@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_minute", {
+	"hex_celsius":"AQACAACrAACGMdYu/zSKASAAkRxBKAMQIgANDSAAuwA7CAMdEigQMLsAIQCOASIAjQEgADsIEDoDGSgoOwggOgMZLSg7CEA6AxkyKDsIgDoDGTcoOyghAC0IIgCOAEAEgC4IQgSALwhCBIAwCEAEQCSTIgCNACAAkRAJACAAvgG/AcABgDDBAGowIQCZAA4wjAAiAIwBIQCNAUA8QECpBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzCvJiAApwB3CKkAqAAoDAMYcygoABcRAxx3KCgAFxX6MCgAlgA3MJ4A+jCdAHIwQBbA7wB3CO4AwDAgAIsACTAhAJ0AIACTHaAoiDEAIIAxKAAXGZ4o/zAhALAAAzAhAK0AWTAhAK8AIQCuACAAkxEgAJMcKS0gAL4KAxm/Cj4c7yhACPcAQQggAKAAdwihACEAnRQhAJ0YsigdECAAIQ4POaIAIA6jAPA5ogSjBgMQowyiDEECjyIIoQIjCAMcIw+gAiEAHAggAKIAowEiCKQApgEhABsIQgeSpgQjCKQEJgiiACQIowAiCKEHIwgDGCMPoAchCPcAIAjBAHcIwABCZIM+CA85Ax0nLUVKgCAwQCWBpAGmAUBIkaUAIA6nAPA5pQSnBgMQpwylDD8wpQWnASUIqQADECAMpQCnAUELQQKAHzBBDoGoACAIQA2GJQihAPgwIQIDGCwpCTBAA4suKSEAMRQgACgKoQACMPcAIQiHMeAngTFAP4mlASAIoD6gAIcwoQAlCAMYJQ+hB0ARgCgIQhFBKZOgPqUAJwgDGCcPhz6nAKgBIAApCCgCAxx9KSUI9gAnCPcAgDCNMaMlQBicqwB3CKoArAArCK0AADCtG/8wvQC8ACwIogctCAMYLQ+jBzwIAxg8D6QHPQgDGD0PpgegKSAAIAj2AECZXCOCIACoCkAwQEuOVSkiDg85oQAjDqAA8DmhBKAGJA6lAPA5oASlBiYOQq+F8DCnGacEAxCnGwMUQKWBoAyhDEUGgiEIogAgCEDswPcAIwjDAHcIwgB0MK8mIADFAHcIxABCCMYAQwjHAEQIRgchAKUAIABHCCEApgAgAEUIAxhFCgMZ7SkhAKYHIQAxHPMpIgAMFPUpIgAMECEAMRAiAAwcFCogAJkfCCoRMCEArQDLMCEArgD/MCEArwAhALAAIgAMEowSPDAhAKsArAFAA4OpAKoBJy17MEBAQUaPxAAGMEQCAxg/KyEAMBMDMCAAPwIDHSgq6DA+AgMcRCtBFYisAHcIrQC9AAYwPQIDGDordjBDCpq8ACEApwoDGagKCTAgADwCAxxHKggwvAATMPcAIAA9CIcx4CeCMSAArQADEDwNvQCtBy0KrABAH4W9AHcIrAACMC0HrgBAB5WvAHcIrgA9CCEAKAIDHWwqIAAsCCEAJwIDHKMqIAAuCCAA7gAgAC8IIADvAEAHjPYALwj3AHIwciYgADwICDoDGY0qAzAtB7AAQCaZsQB3CLAAMQQDHZQqBjD2AAAw9wB7MHImOishAKcBqAEgALwKPAiwALEBMAj2ADEI9wB2MEAOgHowQB6GsAB3CLwAMAQDGTorLQhACIC8AEB2giEAKA7wOUAugSEAJw5AE4UPObEEsAYDELANsQ1BAoUgMLIAswG0AbUBtgFAgIYxAgMd0SosCDACAxzyKkBqoLACPQgDHD0PsQIuCLcALwi4AAAwuBv/MLoAuQA3CLIHOAgDGDgPswc5CAMYOQ+0BzoIAxg6D7UHCisgAC0ItwA8CFIYoSAAtgpAMDYCAxzKKjIODzmyADMOswDwObIEswY0DrQA8DmzBLQGNQ61APA5tAS1BvAwtRm1BAMQtRsDFLUMtAyzDLIMRQaAMghBw4AzCEDDiggwIAC+AL8BRCshADAXIAC+Ab8BdTBAl6DDAHcIwgBDBAMZrCsgAG4IIQAlAiAAxAAgAG8IAxxvCiEAJgIgAMUAAxTFHwMQAxxlK8QJxQnECgMZxQoDFCAAwx9ACqKOK8IJwwnCCgMZwwpDCIA+yABFCIA+SAIDHXorRAhCAiAAxgEDHEYURggAMAMZATDHAMYARgwDGIkrIgAMEAMcjSsiAAwUQEBAG4DIAEAhQB6CmStCCEQCRh6AwgBBHoCoK0EegKwrQB6aIQApCCoEAxm1K/8wqQcDHKoDIQArCCwEAxm+K/8wqwcDHKwDIACnASIADB7FKyAApwogACcIQSiKqQCnACcMAxjRKyEAsBMDHNUrIQCwF0EWgYwe3CtJFoboKyEAsBEDHOwrIQCwFUArgAEsQJuEgD4gAKgAIQAmCEAEiCgCAx3/KyEAJQggAG4CAxgWLEApgHQsQg+AqABCGUAUgBQsQsKCAxx0LHgwQNGQqQB3CKcAKQ7wOSEAqgAgACcOIQCpAA85qgSpBgMQqQ2qDUEChSkODzkgAKcAIQAqDkAajvA5pwSpBicIIQCpAiAAKQgDHCkKAxlDLCEAqgJ5MEYsgKwAQSyGqwAPOawEqwYDEKsNrA1BAoArDkIsgCwORSyAqwJDLIxwLCEArAIiAAwSjBL2LCIADBr2LIwa9ixzMEM1gSAAbgdCeYggAKsAKQgDGCkPqwcrCIA+qgBCiYIqAgMdmSxBmYIoAgMYuyxC7oe4LCAAqAEhALAfpywgAKgKQAuAATlAJISqAKgGKAwDGLMsQeGAtyxA4UBDgQwW9ixA3kC/QGJBV4EgAG8CQEpCOYWsACkIgD4sAgMd1SxAbI4lAgMY9iwhACsILAQDGfQsIACnASEAsB3jLCAApwpAC0A7i6kAqACnBicMAxjvLCEAsBEDHPMsIQCwFUA7lYwWIACZHyctIgAMHAktIwAdHwktYTAhAK0AETAhAK4A/zAhAK8AEC0BMPYAQHWE9wAmCCwlIADCAUAVlxctIADCCiAAQggAMAMZATDEAMIAQgwDGCMtIwAdEwMcJy0jAB0XIACTEGQAiigIAEGwnqgAdgirAAMUqR8DEAMcQC0hADASIACoCakJqAoDGakKQi0hADAWIAArCAE6Ax1LLSEAsBIwEU4tIQCwFjAVQOWQgD59PgMdVi3oMCgCAxxmLSAAKAiqACkIrAAqCPcALAgJJkI0gKsBQReDgD4DHW4tZDBAF4CiLUMXgq0BIAAsCEEPm34tZDAqAgMchy2cMCAAqgcDHKwDrQp2LSAAKgioACwIqQAPMK0FLQjoPq0AjTADGAE+qgAtCPYAQDmDgDCNMZElhTFA0UCegKUtQJyArQBDPoStLQowKAIDGLotQGyIAx26LSEALQggAKoA/zoDGfAtSUmByC0KMEBJgdEt9jBDSYDALUNJUEeArgBAOYQDGfMtIQAuEPMtQE1ACYMoCKsA6D6oAEEeg6kAKAj2ACkIQh6ChjEgAKsAQP9A3IegAHcIoQADECAMogAhDKMAQASTpAAhDKYAAxCkDKYMJgijByQIAxgkD6IHIw4POaYAIg6kAPA5pgSkBkQNgiIIpgCkAUQIggMQogyjDEUChiMNpgAiDaQAAxCmDaQNQgKUIw2lACINpwAlCKYHJwgDGCcPpAcmCKECJAgDHCQPoAIGMKEHAxigCiEOQD+AIA5IP4IjCPcAIghAaIanAHcIqQB2CKgAJwivJkB1jHcIqgAoBgMdhS4rCCkGAxmuLgMQIAAnDaoAQLeBIwCRAECZlSMAkwAVE5UTFRUgAIsTVTAjAJYAqjCWAJUUIACLFyMAFREjAJUYoC4gABISQP+GqACpASoIpwCqCicciS5BpYahAaIBAxAgDaMAIAAjCEAsQCiBFRQTCEAOhKQBIAimAKUBIghBBYolBKEAJAgmBKIAIwigAKMKIBy2LiEIQWOCVjD2AIcwQdmAoyVA2Z3jAHcI4gBYMOQAhzDlACAAYgjmAGMI5wD/MOIHAxzjA2YIZwQDGVMvBDBkB+YA5wHnDWUI5wdmCPYAZwhCI4eHMSAA6QB3COgAZAj2AGUIRAuF6wDnAHcI6gDmAAIwTSCU5wDtAHcI5gDsACAAaAjsAGkI7QD/MOgHAxzpA2wIbQQDGU0vagj2AGsIQRqAkSVAGqHsAGYIhABnCIUAbAiAAOoKAxnrCuYKAxnnCikvBjAgAOQHAxjlCuYugDFCKAgADDQANAM0ADSwNAA0ATQANP80BzSxNEEFiPI0DTSlNAA0AjQANPQ0DTSnNEEFgvY0DTSpNEEFgvg0DTSrNEEFgvo0DTSyNEEdgvs0DTSzNEEFgvw0DTS0NEEFgv00DTS1NEEFgv40DTS2NEI7gQ00tzRBBUAAnBo0/jSdNP408jT+NDM0/zRpNP80mDT/NMM0/zTrNP80EDQANDM0ADRVNAA0dzQANJg0ADS4NAA02TRAQ+EANBw0ATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNCEAoAB3CKEAogEIMKMAIQAgHOwvIQiiByEAIAikAAMQJAygAAMQIQ2kAKEAIwikACQDowAjCAMd5y8iCAgAADQgAIsTIgANCCAA2gAhAA4IIADbACIAjQHYMCEAjgADECEANg0gANwA3QEgAI4fGiggAN0KIABcCN4AXQjcAF4EIQC2AAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABaCCIAjQAgAFsIQFCjIACLFyEANQgDHbUDDzAhADICAxhZLIgwigByMDIHAxiKCoIAgSjTKOso/yglKewrqCsJLBUsWSxZLEkp4il4KuAqiDAhADYFQH+SCDoDHZAoGzAhALUABjAhALIAWywAMCEANgQDGVssfzCGMa8miDFAkIJ3CNoAWwRACoAzMEIegwM6Ax2sKAEwQRuAIjBCC4MCOgMduCgCMEELgBEwQguDAToDHccoDTBANoADMEEOgEQwQg6DQDoDHVssBzBCQov2AG0w9wAAMIUxLCWIMSEALRAhALAWMBVDP4AzOkBHiCEAsgFbLAEw9gAgAG4I9wBvCEEYQ0eAIjpDE4B7MEBpgIkxQLpAaYndAAAw9wBdCG0kBjAgAF0CAxgaKUGugxopETC1AAQwQEdDYYAROkMlgHYwRSVAWYJaCPcAXAhAQICJMUEjgz4pDTC1AAUwSyOBIQAwFkBsQMCNMwIDGHopIQA0HFwphTAhAK0A0TAhAK4AYilhMEAGgBkwQAaCAxAhADQMQCOM6D7aAI0wAxgBPtwAWgj2AFwI9wCAMI0xkSVAS4ndACEArwDbKQQw9wAhADQIhzHgJ0ALiNoA3AFaCMA+2gBcCAMYXA+NPkoegK0AUB2C2goDGdwKSSCArgBQIIICMNoHAxhKIYSvAG4wIQC1AAwwQKKFWywAMCEANQQDHeopQaCAiDBCq4OAOgMd9ikHMEETgCIwQguEIDoDHRcqIQC0CkKyiAwqEzAhADQCAxwTKrQBEyoKMEEGgzUqtAE1KgswQSBD2IQQOgMdSCohALQDQiCALipCIINEKhIwtABEKkMhgQkwtABAeYUEOgMdPSq0CrQKRCpAB4QFOgMdRCr+MLQHQjCARDBCMINAOgMdWywTMECWgDMIQJaAijFAC0AbhCAA2gdaCIYxryZACYPhAHcI4AAgAECWhCAAYAj3AGEIrSRCC0GVgA0wQS9CVoSUKiEANByKKgAwQxmEhTEsJYox2SoBMEcJRNpBQ0fagAMwSNpAFoTdAAQwXQIDGMIqSC2EIABdCAY6Ax3QKkAMQC2EADD3AFoIbSTZKkdPQWeADjBBZ0uPhyEANQgDHfQqIQCyAVssiDBBq4PcAIA6Ax0AK0K3mSEAth4WKyAA4AoDGeEKYQiAPn0+Ax0OK+kwYAIDHCwrCTAgAOAHAxjhCiwrIQA2HkMr/zBACIEDHOEDQhaAJStCFoD3MEINSsaGHzAoAB0CAxw/K/gwnQdCykL6gNwAQPqApCtAaECIgJYrQGaACTpABECEQIuHdjCGMXImizEhAKcBqAEgAEBChoA+Ax1oKwYwYAIDGJYrQaKA3ABAjYBcCECMgIsxQMGBhjGvJkAEh+8AdwjuAG4I9gBvCPcAcjBBJ4IgAN0KXQhCEYPdAHcI3ABdBEA8gwYwIADgAOEBQCuC9gBhCPcAQG5BGkKjifowKACdAFssADAhADUEAx3hK38wQiWQ3AB3CNoA3QBdCAAwAxkBMNoA3gDfAd4b3wNeCPYAXwj3AEAVQUGPXQgDGdQrIgAMEAwSjBIoABcRIACTEN4rPDAhAKsArAFAA4OpAKoBKAAXFUXsgtoAiDoDGUDoQApAloUhACcI9wAoCIUxLCVAl4U1CAMd/isNMLUAAzBAWoARMEIcgBE6QxyBATD3AEC/hG0kbjAhALUACDBBcEFsgQMZIixDOIKAOgMdJSxBG4AiMEIKiSA6Ax03LCEAswoHMDMCAxizAQcwQSFDOIQQOgMdSywhALMDQBGDAxxHLAYwswBCE4BEMEITgUA6Ax1ATIC0AUK0QDaBIQAyCEGlQBGT3QBdDAMYaCwgAJkTAxxsLCAAmRcIACAAygB3CMkAIQAwFrAWMBWwFEDjoUoCAxiULBkwIQCtAN0wIQCuACAASgjoPsoAjTADGAE+zABKCPYATAj3AIAwjTGRJYwxIQCvAKwsADAgAEkEAxmjLGEwQB2ACTBAHYDJMEEOQAOBrQDRMEAJgP8wQAlAP8DRAHcI0AB2CNIA0wHUAecw1QADMNYAcjBSAgMY0yxSCNcAEzAgAFcCAxzHLO0w1we/LCAAVxhJLXAw0wD+MNQAeDDVAAUw1gBJLY4wIADSBwQw9wBSCIcx4CeMMSAA1wDYAVcIwD7SAI0w2QBYCAMYWA/ZBwMw0gcDGNkKUgj2AFkIQ2JAF4JXCAMdAi1HLosgAFcIAToDHQ8tzjDTAP8w1AAyMNUA1gFBDIMIOgMdGC0BMEMIggI6Ax0hLUQRggM6Ax0vLUIsgpAw1QABMEIsgwQ6Ax04LQgwQxaDBToDHUEtPDBDCIMGOgMdSS0GMEAIjCAAVQjzAFYI9ABTCPUAVAj2AFAI9wBRCF0lQqhABkPvmHYIzAB1CMsAdAjOAHMIzQBOCIA+zwBKCIA+TwIDHXMtSQhNAgMYei0gAEsI9wBMCJAtQPhAEYBMCEERiIUtSwhJAgMYjC0gAE0I9wBOCEARlEkI9wBKCAgAADoDGZgtgDoDGZ4tADR2CIQAdwiFAAAICAB3CIoAdgiCAEERgKstQBGBsy33AUMSgRIA9wBAFIWNMZ4l9QD2D/cD9wpABaH0AHUI9wB0CAgAYTQZNP80ADTRNKE0/zQCNMk0zTT/NAE0YTQRNP80AzRhNMk0/zQENIU00TT/NAc0zTSFNP80BTTRNEEDgN00QB+PCDTdNNU0/zQGNAM0tzQNNCU0sTRhNEE0NzQBNCE0ADRBAIA8NEEBRAABAQIADoHUD/86AA==",
+	"hex_fahrenheit":"AQACAACrAACGMdYu/zSKASAAkRxBKAMQIgANDSAAuwA7CAMdEigQMLsAIQCOASIAjQEgADsIEDoDGSgoOwggOgMZLSg7CEA6AxkyKDsIgDoDGTcoOyghAC0IIgCOAEAEgC4IQgSALwhCBIAwCEAEQCSTIgCNACAAkRAJACAAvgG/AcABgDDBAGowIQCZAA4wjAAiAIwBIQCNAUA8QECpBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzCvJiAApwB3CKkAqAAoDAMYcygoABcRAxx3KCgAFxX6MCgAlgA3MJ4A+jCdAHIwQBbA7wB3CO4AwDAgAIsACTAhAJ0AIACTHaAoiDEAIIAxKAAXGZ4o/zAhALAAAzAhAK0AWTAhAK8AIQCuACAAkxEgAJMcKS0gAL4KAxm/Cj4c7yhACPcAQQggAKAAdwihACEAnRQhAJ0YsigdECAAIQ4POaIAIA6jAPA5ogSjBgMQowyiDEECjyIIoQIjCAMcIw+gAiEAHAggAKIAowEiCKQApgEhABsIQgeSpgQjCKQEJgiiACQIowAiCKEHIwgDGCMPoAchCPcAIAjBAHcIwABCZIM+CA85Ax0nLUVKgCAwQCWBpAGmAUBIkaUAIA6nAPA5pQSnBgMQpwylDD8wpQWnASUIqQADECAMpQCnAUELQQKAHzBBDoGoACAIQA2GJQihAPgwIQIDGCwpCTBAA4suKSEAMRQgACgKoQACMPcAIQiHMeAngTFAP4mlASAIoD6gAIcwoQAlCAMYJQ+hB0ARgCgIQhFBKZOgPqUAJwgDGCcPhz6nAKgBIAApCCgCAxx9KSUI9gAnCPcAgDCNMaMlQBicqwB3CKoArAArCK0AADCtG/8wvQC8ACwIogctCAMYLQ+jBzwIAxg8D6QHPQgDGD0PpgegKSAAIAj2AECZXCOCIACoCkAwQEuOVSkiDg85oQAjDqAA8DmhBKAGJA6lAPA5oASlBiYOQq+F8DCnGacEAxCnGwMUQKWBoAyhDEUGgiEIogAgCEDswPcAIwjDAHcIwgB0MK8mIADFAHcIxABCCMYAQwjHAEQIRgchAKUAIABHCCEApgAgAEUIAxhFCgMZ7SkhAKYHIQAxHPMpIgAMFPUpIgAMECEAMRAiAAwcFCogAJkfCCoRMCEArQDLMCEArgD/MCEArwAhALAAIgAMEowSPDAhAKsArAFAA4OpAKoBJy17MEBAQUaPxAAGMEQCAxg/KyEAMBMDMCAAPwIDHSgq6DA+AgMcRCtBFYisAHcIrQC9AAYwPQIDGDordjBDCpq8ACEApwoDGagKCTAgADwCAxxHKggwvAATMPcAIAA9CIcx4CeCMSAArQADEDwNvQCtBy0KrABAH4W9AHcIrAACMC0HrgBAB5WvAHcIrgA9CCEAKAIDHWwqIAAsCCEAJwIDHKMqIAAuCCAA7gAgAC8IIADvAEAHjPYALwj3AHIwciYgADwICDoDGY0qAzAtB7AAQCaZsQB3CLAAMQQDHZQqBjD2AAAw9wB7MHImOishAKcBqAEgALwKPAiwALEBMAj2ADEI9wB2MEAOgHowQB6GsAB3CLwAMAQDGTorLQhACIC8AEB2giEAKA7wOUAugSEAJw5AE4UPObEEsAYDELANsQ1BAoUgMLIAswG0AbUBtgFAgIYxAgMd0SosCDACAxzyKkBqoLACPQgDHD0PsQIuCLcALwi4AAAwuBv/MLoAuQA3CLIHOAgDGDgPswc5CAMYOQ+0BzoIAxg6D7UHCisgAC0ItwA8CFIYoSAAtgpAMDYCAxzKKjIODzmyADMOswDwObIEswY0DrQA8DmzBLQGNQ61APA5tAS1BvAwtRm1BAMQtRsDFLUMtAyzDLIMRQaAMghBw4AzCEDDiggwIAC+AL8BRCshADAXIAC+Ab8BdTBAl6DDAHcIwgBDBAMZrCsgAG4IIQAlAiAAxAAgAG8IAxxvCiEAJgIgAMUAAxTFHwMQAxxlK8QJxQnECgMZxQoDFCAAwx9ACqKOK8IJwwnCCgMZwwpDCIA+yABFCIA+SAIDHXorRAhCAiAAxgEDHEYURggAMAMZATDHAMYARgwDGIkrIgAMEAMcjSsiAAwUQEBAG4DIAEAhQB6CmStCCEQCRh6AwgBBHoCoK0EegKwrQB6aIQApCCoEAxm1K/8wqQcDHKoDIQArCCwEAxm+K/8wqwcDHKwDIACnASIADB7FKyAApwogACcIQSiKqQCnACcMAxjRKyEAsBMDHNUrIQCwF0EWgYwe3CtJFoboKyEAsBEDHOwrIQCwFUArgAEsQJuEgD4gAKgAIQAmCEAEiCgCAx3/KyEAJQggAG4CAxgWLEApgHQsQg+AqABCGUAUgBQsQsKCAxx0LHgwQNGQqQB3CKcAKQ7wOSEAqgAgACcOIQCpAA85qgSpBgMQqQ2qDUEChSkODzkgAKcAIQAqDkAajvA5pwSpBicIIQCpAiAAKQgDHCkKAxlDLCEAqgJ5MEYsgKwAQSyGqwAPOawEqwYDEKsNrA1BAoArDkIsgCwORSyAqwJDLIxwLCEArAIiAAwSjBL2LCIADBr2LIwa9ixzMEM1gSAAbgdCeYggAKsAKQgDGCkPqwcrCIA+qgBCiYIqAgMdmSxBmYIoAgMYuyxC7oe4LCAAqAEhALAfpywgAKgKQAuAATlAJISqAKgGKAwDGLMsQeGAtyxA4UBDgQwW9ixA3kC/QGJBV4EgAG8CQEpCOYWsACkIgD4sAgMd1SxAbI4lAgMY9iwhACsILAQDGfQsIACnASEAsB3jLCAApwpAC0A7i6kAqACnBicMAxjvLCEAsBEDHPMsIQCwFUA7lYwWIACZHyctIgAMHAktIwAdHwktYTAhAK0AETAhAK4A/zAhAK8AEC0BMPYAQHWE9wAmCCwlIADCAUAVlxctIADCCiAAQggAMAMZATDEAMIAQgwDGCMtIwAdEwMcJy0jAB0XIACTEGQAiigIAEGwnqgAdgirAAMUqR8DEAMcQC0hADASIACoCakJqAoDGakKQi0hADAWIAArCAE6Ax1LLSEAsBIwFU4tIQCwFjAVQOWQgD59PgMdVi3oMCgCAxxmLSAAKAiqACkIrAAqCPcALAgJJkI0gKsBQReDgD4DHW4tZDBAF4CiLUMXgq0BIAAsCEEPm34tZDAqAgMchy2cMCAAqgcDHKwDrQp2LSAAKgioACwIqQAPMK0FLQjoPq0AjTADGAE+qgAtCPYAQDmDgDCNMZElhTFA0UCegKUtQJyArQBDPoStLQowKAIDGLotQGyIAx26LSEALQggAKoA/zoDGfAtSUmByC0KMEBJgdEt9jBDSYDALUNJUEeArgBAOYQDGfMtIQAuEPMtQE1ACYMoCKsA6D6oAEEeg6kAKAj2ACkIQh6ChjEgAKsAQP9A3IegAHcIoQADECAMogAhDKMAQASTpAAhDKYAAxCkDKYMJgijByQIAxgkD6IHIw4POaYAIg6kAPA5pgSkBkQNgiIIpgCkAUQIggMQogyjDEUChiMNpgAiDaQAAxCmDaQNQgKUIw2lACINpwAlCKYHJwgDGCcPpAcmCKECJAgDHCQPoAIGMKEHAxigCiEOQD+AIA5IP4IjCPcAIghAaIanAHcIqQB2CKgAJwivJkB1jHcIqgAoBgMdhS4rCCkGAxmuLgMQIAAnDaoAQLeBIwCRAECZlSMAkwAVE5UTFRUgAIsTVTAjAJYAqjCWAJUUIACLFyMAFREjAJUYoC4gABISQP+GqACpASoIpwCqCicciS5BpYahAaIBAxAgDaMAIAAjCEAsQCiBFRQTCEAOhKQBIAimAKUBIghBBYolBKEAJAgmBKIAIwigAKMKIBy2LiEIQWOCVjD2AIcwQdmAoyVA2Z3jAHcI4gBYMOQAhzDlACAAYgjmAGMI5wD/MOIHAxzjA2YIZwQDGVMvBDBkB+YA5wHnDWUI5wdmCPYAZwhCI4eHMSAA6QB3COgAZAj2AGUIRAuF6wDnAHcI6gDmAAIwTSCU5wDtAHcI5gDsACAAaAjsAGkI7QD/MOgHAxzpA2wIbQQDGU0vagj2AGsIQRqAkSVAGqHsAGYIhABnCIUAbAiAAOoKAxnrCuYKAxnnCikvBjAgAOQHAxjlCuYugDFCKAgADDQANAM0ADSwNAA0ATQANP80BzSxNEEFiPI0DTSlNAA0AjQANPQ0DTSnNEEFgvY0DTSpNEEFgvg0DTSrNEEFgvo0DTSyNEEdgvs0DTSzNEEFgvw0DTS0NEEFgv00DTS1NEEFgv40DTS2NEI7gQ00tzRBBUAA/9U0/TTBNP40WTT/NM80/zQwNAA0hjQANNM0ADQaNAE0XDQBNJw0ATTaNAE0FjQCNFE0AjSMNAI0xzQCNAI0AzQ/NAM0fTQDNL00AzQBNAQ0SDQENJQ0BDTlNAQ0PzQFNKQ0BTQXNAY0njQGNEQ0BzQeNAg0XTQJNKs0CzQhAKAAdwihAKIBCDCjACEAIBzsLyEIogchACAIpAADECQMoAADECENpAChACMIpAAkA6MAIwgDHecvIggIAAA0IACLEyIADQggANoAIQAOCCAA2wAiAI0B2DAhAI4AAxAhADYNIADcAN0BIACOHxooIADdCiAAXAjeAF0I3ABeBCEAtgCAAxBDEYEOHiwoThGBDh8+KE4RgY4dUChIEYUgAFoIIgCNACAAWwhAUKMgAIsXIQA1CAMdtQMPMCEAMgIDGFksiDCKAHIwMgcDGIoKggCBKNMo6yj/KCUp7CuoKwksFSxZLFksSSniKXgq4CqIMCEANgVAf5IIOgMdkCgbMCEAtQAGMCEAsgBbLAAwIQA2BAMZWyx/MIYxryaIMUCQgncI2gBbBEAKgDMwQh6DAzoDHawoATBBG4AiMEILgwI6Ax24KAIwQQuAETBCC4MBOgMdxygNMEA2gAMwQQ6ARDBCDoNAOgMdWywHMEJCi/YAbTD3AAAwhTEsJYgxIQAtECEAsBYwFUM/gDM6QEeIIQCyAVssATD2ACAAbgj3AG8IQRhDR4AiOkMTgHswQGmAiTFAukBpid0AADD3AF0IbSQGMCAAXQIDGBopQa6DGikRMLUABDBAR0NhgBE6QyWAdjBFJUBZgloI9wBcCEBAgIkxQSODPikNMLUABTBLI4EhADAWQGxAwI0zAgMYeikhADQcXCmFMCEArQDRMCEArgBiKWEwQAaAGTBABoIDECEANAxAI4zoPtoAjTADGAE+3ABaCPYAXAj3AIAwjTGRJUBLid0AIQCvANspBDD3ACEANAiHMeAnQAuI2gDcAVoIwD7aAFwIAxhcD40+Sh6ArQBQHYLaCgMZ3ApJIICuAFAgggIw2gcDGEohhK8AbjAhALUADDBAooVbLAAwIQA1BAMd6ilBoICIMEKrg4A6Ax32KQcwQROAIjBCC4QgOgMdFyohALQKQrKIDCoTMCEANAIDHBMqtAETKgowQQaDNSq0ATUqCzBBIEPYhBA6Ax1IKiEAtANCIIAuKkIgg0QqEjC0AEQqQyGBCTC0AEB5hQQ6Ax09KrQKtApEKkAHhAU6Ax1EKv4wtAdCMIBEMEIwg0A6Ax1bLBMwQJaAMwhAloCKMUALQBuEIADaB1oIhjGvJkAJg+EAdwjgACAAQJaEIABgCPcAYQitJEILQZWADTBBL0JWhJQqIQA0HIoqADBDGYSFMSwlijHZKgEwRwlE2kFDR9qAAzBI2kAWhN0ABDBdAgMYwipILYQgAF0IBjoDHdAqQAxALYQAMPcAWghtJNkqR09BZ4AOMEFnS4+HIQA1CAMd9CohALIBWyyIMEGrg9wAgDoDHQArQreZIQC2HhYrIADgCgMZ4QphCIA+fT4DHQ4r6TBgAgMcLCsJMCAA4AcDGOEKLCshADYeQyv/MEAIgQMc4QNCFoAlK0IWgPcwQg1KxoYfMCgAHQIDHD8r+DCdB0LKQvqA3ABA+oCkK0BoQIiAlitAZoAJOkAEQIRAi4d2MIYxciaLMSEApwGoASAAQEKGgD4DHWgrBjBgAgMYlitBooDcAECNgFwIQIyAizFAwYGGMa8mQASH7wB3CO4Abgj2AG8I9wByMEEngiAA3QpdCEIRg90AdwjcAF0EQDyDBjAgAOAA4QFAK4L2AGEI9wBAbkEaQqOJ+jAoAJ0AWywAMCEANQQDHeErfzBCJZDcAHcI2gDdAF0IADADGQEw2gDeAN8B3hvfA14I9gBfCPcAQBVBQY9dCAMZ1CsiAAwQDBKMEigAFxEgAJMQ3is8MCEAqwCsAUADg6kAqgEoABcVReyC2gCIOgMZQOhACkCWhSEAJwj3ACgIhTEsJUCXhTUIAx3+Kw0wtQADMEBagBEwQhyAETpDHIEBMPcAQL+EbSRuMCEAtQAIMEFwQWyBAxkiLEM4goA6Ax0lLEEbgCIwQgqJIDoDHTcsIQCzCgcwMwIDGLMBBzBBIUM4hBA6Ax1LLCEAswNAEYMDHEcsBjCzAEITgEQwQhOBQDoDHUBMgLQBQrRANoEhADIIQaVAEZPdAF0MAxhoLCAAmRMDHGwsIACZFwgAIADKAHcIyQAhADAWsBYwFbAUQOOhSgIDGJQsGTAhAK0A3TAhAK4AIABKCOg+ygCNMAMYAT7MAEoI9gBMCPcAgDCNMZEljDEhAK8ArCwAMCAASQQDGaMsYTBAHYAJMEAdgMkwQQ5AA4GtANEwQAmA/zBACUA/wNEAdwjQAHYI0gDTAdQB5zDVAAMw1gByMFICAxjTLFII1wATMCAAVwIDHMcs7TDXB78sIABXGEktcDDTAP4w1ADEMNUACTDWAEktjjAgANIHBDD3AFIIhzHgJ4wxIADXANgBVwjAPtIAjTDZAFgIAxhYD9kHAzDSBwMY2QpSCPYAWQhDYkAXglcIAx0CLUcuiyAAVwgBOgMdDy2cMNMA/zDUAGQw1QDWAUEMgwg6Ax0YLQEwQwiCAjoDHSEtRBGHAzoDHS8t4DDTAPww1AAgMEF0QQ2DBDoDHTgtCDBDFoMFOgMdQS08MEMIgwY6Ax1JLQYwQAiMIABVCPMAVgj0AFMI9QBUCPYAUAj3AFEIXSVCqEAGQ++YdgjMAHUIywB0CM4AcwjNAE4IgD7PAEoIgD5PAgMdcy1JCE0CAxh6LSAASwj3AEwIkC1A+EARgEwIQRGIhS1LCEkCAxiMLSAATQj3AE4IQBGUSQj3AEoICAAAOgMZmC2AOgMZni0ANHYIhAB3CIUAAAgIAHcIigB2CIIAQRGAqy1AEYGzLfcBQxKBEgD3AEAUhY0xniX1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH48INN001TT/NAY0AzS3NA00JTSxNGE0QTQ3NAE0ITQANEEAgDw0QQFEAAEBAgAOgdQP/zoA",
+});
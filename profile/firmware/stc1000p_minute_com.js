@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_minute_com", {
+	"hex_celsius":"AQACAACRAACGMRwu/zSKAScAkxwjKCAAixEnAJEQIQA4CAMZFyghALcfQAKejBAiAIwUCjAhALkABTAgAJUAIQCVEiAAixYnAJMBIAALHUIoIQCVFiAAixIhAIwUIgCMEAMQIQC3DSEAugpAJoYDHTwoIACMHDwoIQA3FEAaqpEUIACLFQsRIACRHIooAxAiAA0NIAC6ADoIAx1PKBAwugAhAI4BIgCNASAAOggQOgMZZSg6CCA6AxlqKDoIQDoDGW8oOgiAOgMZdCh4KCEAMggiAI4AQASAMwhCBIA0CEIEgDUIQARAJJoiAI0AIQA5CAMZgii5A4goIQC7ASEAugEhALgBIACREAkAIACLEyIADQggAN8AIQAOCCAA4ABAQ4LYMCEAjgBAa5FADSAA4QDiASAAjh+lKCAA4gogAGEI4wBiCOEAYwQhAMAAAxBDEYEOHrcoThGBDh/JKE4RgY4d2yhIEYEgAF8IQGqBIABgCEBQoyAAixchAD8IAx2/Aw8wIQA8AgMY5CyAMIoA/TA8BwMYigqCAAwpXil2KYopsCl3LDMslCygLOQs5CzUKW0qAytrK4gwIQBABUB/kgg6Ax0bKRswIQC/AAYwIQC8AOYsADAhAEAEAxnmLH8wjzGQJ4ExQJCCdwjfAGAEQAqAMzBCHoMDOgMdNykBMEEbgCIwQguDAjoDHUMpAjBBC4ARMEILgwE6Ax1SKQ0wQDaAAzBBDoBEMEIOg0A6Ax3mLAcwQkKL9gBtMPcAADCOMQ0mgTEhADIQIQC1FjUVQz+AMzpAR4ghALwB5iwBMPYAIABsCPcAbQhBGENHgCI6QxOAezBCaYDhAEBpieIAADD3AGII+CQGMCAAYgIDGKUpQa6DpSkRML8ABDBAR0NhgBE6QyWAdjBFJUBZgl8I9wBhCEJZQCODySkNML8ABTBLI4EhADUWQGxAwI09AgMYBSohAD4c5ymFMCEAsgDRMCEAswDtKWEwQAaAGTBABoIDECEAPgxAI4x6Pt8AhzADGAE+4QBfCPYAYQj3AIAwhzEEJ0BLiuIAIQC0AGYqBDD3ACEAPgiHMVsngjFAG4fhAV8IMz7fAGEIAxhhD4c+Rh5AEkAegLIAUB2C3woDGeEKSSCAswBQIIICMN8HAxhKIYS0AG4wIQC/AAwwQKKF5iwAMCEAPwQDHXUqQaCAiDBCq4OAOgMdgSoHMEETgCIwQguEIDoDHaIqIQC+CkKyiJcqEzAhAD4CAxyeKr4BnioKMEEGg8AqvgHAKgswQSBD2IQQOgMd0yohAL4DQiCAuSpCIIPPKhIwvgDPKkMhgQkwvgBAeYUEOgMdyCq+Cr4KzypAB4QFOgMdzyr+ML4HQjCARDBCMINAOgMd5iwTMECWgD0IQ5ZAG4QgAN8HXwiPMZAnQAmD5gB3COUAIABAloQgAGUI9wBmCDglQgtBlYANMEEvQlaEHyshAD4cFSsAMEMZhI4xDSaDMWQrATBHCUTagIMxSdqAAzBI2kAWhOIABDBiAgMYTStILYQgAGIIBjoDHVsrQAxALYQAMPcAXwj4JGQrR09BZ4AOMEFnRI9BS0KPhyEAPwgDHX8rIQC8AeYsiDBBq4PhAIA6Ax2LK0K3mSEAwB6hKyAA5QoDGeYKZgiAPn0+Ax2ZK+kwZQIDHLcrCTAgAOUHAxjmCrcrIQBAHs4r/zBACIEDHOYDQhaAsCtCFoD3MEINSsaGHzAoAB0CAxzKK/gwnQdCykL6gOEAQPqALyxAaECIgCEsQGaACTpABECEQIuHdjCPMVMngzEhAKwBrQEgAEBChoA+Ax3zKwYwZQIDGCEsQaKA4QBAjYBhCEKMjOIAjzGQJ4QxIADtAHcI7ABsCPYAbQj3AHIwQCdAC4HiCmIIQhGD4gB3COEAYgRAPIMGMCAA5QDmAUArgvYAZgj3AEBuQRpCo4n6MCgAnQDmLAAwIQA/BAMdbCx/MEIlkOEAdwjfAOIAYggAMAMZATDfAOMA5AHjG+QDYwj2AGQI9wBAFUFBj2IIAxlfLCIADBAMEowSKAAXESAAkxBpLDwwIQCwALEBQAODrgCvASgAFxVF7ILfAIg6AxlA6EAKQJaNIQAsCPcALQiOMQ0mhDEhAD8IAx2JLA0wvwADMEBagBEwQhyAETpDHIEBMPcAQL+E+CRuMCEAvwAIMEFwQWyBAxmtLEM4goA6Ax2wLEEbgCIwQgqJIDoDHcIsIQC9CgcwPQIDGL0BBzBBIUM4hBA6Ax3WLCEAvQNAEYMDHNIsBjC9AEITgEQwQhOBQDoDHUBMgL4BQrRANoEhADwIQaVAEZPiAGIMAxjzLCAAmRMDHPcsIACZFwgAIADPAHcIzgAhADUWtRY1FbUUQOOhTwIDGB8tGTAhALIA3TAhALMAIABPCHo+zwCHMAMYAT7RAE8I9gBRCPcAgDCHMQQnhTEhALQANy0AMCAATgQDGS4tYTBAHYAJMEAdgMkwQQ5AA4GyANEwQAmA/zBACUA/wNYAdwjVAHYI1wDYAdkB5zDaAAMw2wByMFcCAxheLVcI3AATMCAAXAIDHFIt7TDcB0otIABcGNQtcDDYAP4w2QB4MNoABTDbANQtjjAgANcHBDD3AFcIhzFbJ4UxIADcAN0BXAgzPtcAhzDeAF0IAxhdD94HAzDXBwMY3gpXCPYAXghDYkAXglwIAx2NLUcuiyAAXAgBOgMdmi3OMNgA/zDZADIw2gDbAUEMgwg6Ax2jLQEwQwiCAjoDHawtRBGCAzoDHbotQiyCkDDaAAEwQiyDBDoDHcMtCDBDFoMFOgMdzC08MEMIgwY6Ax3ULQYwQAiMIABaCPMAWwj0AFgI9QBZCPYAVQj3AFYI6CVCqEAGQ++YdgjRAHUI0AB0CNMAcwjSAFMIgD7UAE8IgD5UAgMd/i1OCFICAxgFLiAAUAj3AFEIGy5A+EARgFEIQRGIEC5QCE4CAxgXLiAAUgj3AFMIQBGGTgj3AE8ICACcMPYAhjBBpKAWJ4YxIQChAHcIoACeMKIAhjCjACEAIAikACEIpQD/MKAHAxyhAyQIJQQDGZkuBDAiB6QApQGlDSMIpQckCPYAJQhEI4WnAHcIpgAiCPYAIwhEC4WpAKUAdwioAKQAAjBNIJSlAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZky4oCPYAKQhBGoAEJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKby4GMCEAogcDGKMKLC6IMQAoCAARNAA0AzQANLU0ADQBNAA0/zQPNLY0QQWI9zQPNG40ADQCNAA0hDQHNLc0QQuChTQHNLg0QQWChjQHNLk0QQWChzQHNLo0QQWCiDQHNLs0QQWC+TQPNKw0QSOC+zQPNK40QQWC/TQPNLA0QQWCiTQHNLw0QReCijQHNL00QQWCizQHNL40QQWCjDQHNL80QQWCjTQHNMA0QQWCjjQHNME0QQWRADoDGQsvgDoDGREvADR2CIQAdwiFAAAICAB3CIoAdgiCAAgAQBGAHi9AEYEmL/cBQxKBEgD3AEAUhYcxESf1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH64INN001TT/NAY0IADnAHcI6ADpAQgw6gAgAGccZy9oCOkHIABnCOsAAxBrDOcAAxBoDesA6ABqCOsAawPqAGoIAx1iL2kICAADNLc0DTQlNLE0YTRBNDc0ATQhNAA0SAACEAC8IAC+Ab8BwAGAMMEAajAhAJkADjCMACIAjAEhAI0BIgCNASEAjgEEMCMAjAAhAB4WnhcjAI4BBTAgAJwA+jCbACEAkRRyMCgAlwB/MJAnIACnAHcIqQCoACgMAxgxKCgAFxEDHDUoKAAXFfowKACWADcwngD6MJ0AcjBAFqvtAHcI7ADIMCAAiwACMCcAkQCSAQkwIQCdACAAixMIMCEAOgIDHGopIQA3CCAAwgAhALoBIACLFyAAQgggAKwAIADJBiEAuAEhADsIAx23KCAALAggAMoAQQOPyQAgAMsBIABKCCA6Axl6KEoI4DoDHX4oATAhALsAVClAEosBOgMdjyggAG4IIADMACAAbwggAM0ABTBDEIoCOgMdoyitASIADB6aKCAArQogAC0IQBaAzQFEE4IDOgMdVClAE4GMHq4oSRNAU0A4gNQoQVCAywBATkBKgckoAjBCJYBLCECNgs0AdwjMAEQcgwI6AxndKDsIQDSK8SggAEwIIAC7AK0BLAi8AL0BPAgtBEFhgT0IOwRAH4EhALsKQRyGBDoDHRYpIABJCAMdDSlBHECehk0IIACtACwI9gAtCPcAQDyFUyeaMCEAtwAQKWYwQANAlYK4ACEAuwFBJIIGOgMdJilAIEMOgAcwQ1GCBzoDHUcpQCSBIABKBkQyg7sBLQi8AKwGQT6BrQAsBkMgQPRCIIAIOkCjQUJDPkAMggU6AxldKUFBgGopQSuArABAf0QVubsKIACLF5MdgSmAMYsgiTEoABcZfyn/MCEAtQADMCEAsgBZMCEAtAAhALMAIACTESAAkxwKLiAAvgoDGb8KPhzQKUAI9wBBCCAAoAB3CKEAIQCdFCEAnRiTKR0QIAAhDg85ogAgDqMA8DmiBKMGAxCjDKIMQQKPIgihAiMIAxwjD6ACIQAcCCAAogCjASIIpACmASEAGwhCB5qmBCMIpAQmCKIAJAijACIIoQcjCAMYIw+gByEI9wAgCMEAdwjAAAkwIQCdACAAPggPOQMdCC5FSoAgMEAlgaQBpgFASJGlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxgNKgkwQAOLDyohADYUIAAoCqEAAjD3ACEIhzFbJ4oxQD+JpQEgCLc+oACPMKEAJQgDGCUPoQdAEYAoCEIRQSmTtz6lACcIAxgnD48+pwCoASAAKQgoAgMcXiolCPYAJwj3AIAwhzEWJ0AYnKsAdwiqAKwAKwitAAAwrRv/MLsAvAAsCKIHLQgDGC0Powc8CAMYPA+kBzsIAxg7D6YHgSogACAI9gBAmVwjgiAAqApAMEBLjjYqIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoIhCKIAIAhA7MD3ACMIwwB3CMIAdDCQJyAAxQB3CMQAQgjGAEMIxwBECEYHIADuACAARwggAO8AIABFCAMYRQoDGc4qIADvByEANhzUKiIADBTWKiIADBAhADYQIgAMHPUqIACZH+kqETAhALIAyzAhALMA/zAhALQAIQC1ACIADBKMEjwwIQCwALEBQAODrgCvAQguezBAQEFGj8QABjBEAgMYICwhADUTAzAgAD8CAx0JK+gwPgIDHCUsQRWIrAB3CK0AuwAGMDsCAxgbLHYwQwqavAAhAKwKAxmtCgkwIAA8AgMcKCsIMLwAEzD3ACAAOwiHMVsnizEgAK0AAxA8DbsArQctCqwAQB+FuwB3CKwAAjAtB70AQAeVrgB3CL0AOwghAC0CAx1NKyAALAghACwCAxyEKyAAPQggAOwAIAAuCCAA7QBAB4z2AC4I9wByMFMnIAA8CAg6AxluKwMwLQevAEAmmbAAdwivADAEAx11KwYw9gAAMPcAezBTJxssIQCsAa0BIAC8CjwIrwCwAS8I9gAwCPcAdjBADoB6MEAehq8Adwi8AC8EAxkbLC0IQAiAvABAdoIhAC0O8DlALoEhACwOQBOFDzmwBK8GAxCvDbANQQKFIDCxALIBswG0AbUBQICGMAIDHbIrLAgvAgMc0ytAaqCvAjsIAxw7D7ACPQi2AC4ItwAAMLcb/zC5ALgANgixBzcIAxg3D7IHOAgDGDgPswc5CAMYOQ+0B+srIAAtCLYAPAhSGKEgALUKQDA1AgMcqysxDg85sQAyDrIA8DmxBLIGMw6zAPA5sgSzBjQOtADwObMEtAbwMLQZtAQDELQbAxS0DLMMsgyxDEUGgDEIQcOAMghAw4oIMCAAvgC/ASUsIQA1FyAAvgG/AXUwQJegwwB3CMIAQwQDGY0sIABsCCAAbgIgAMQAIABtCAMcbQogAG8CIADFAAMUxR8DEAMcRizECcUJxAoDGcUKAxQgAMMfQAqibyzCCcMJwgoDGcMKQwiAPsgARQiAPkgCAx1bLEQIQgIgAMYBAxxGFEYIADADGQEwxwDGAEYMAxhqLCIADBADHG4sIgAMFEBAQBuAyABAIUAegnosQghEAkYegMIAQR6AiSxBHoCNLEAemiEALggvBAMZliz/MK4HAxyvAyEAMAgxBAMZnyz/MLAHAxyxAyAApwEiAAwepiwgAKcKIAAnCEEoiqkApwAnDAMYsiwhALUTAxy2LCEAtRdBFoGMHr0sSRaGySwhALURAxzNLCEAtRVAK4DiLECbhIA+IACoACAAbwhABIgoAgMd4CwgAG4IIABsAgMY9yxAKYBVLUIPQBRBGUAUgPUsQsKCAxxVLXgwQNGQqQB3CKcAKQ7wOSEArwAgACcOIQCuAA85rwSuBgMQrg2vDUEChS4ODzkgAKcAIQAvDkAajvA5pwSpBicIIQCuAiAAKQgDHCkKAxkkLSEArwJ5MEYsgLEAQSyGsAAPObEEsAYDELANsQ1BAoAwDkIsgDEORSyAsAJDLIxRLSEAsQIiAAwSjBLXLSIADBrXLYwa1y1zMEM1gSAAbAdCeYggAKsAKQgDGCkPqwcrCIA+qgBCiYIqAgMdei1BmYIoAgMYnC1C7oeZLSAAqAEhALUfiC0gAKgKQAuAATlAJISqAKgGKAwDGJQtQeGAmC1A4UBDgQwW1y1A3kC/QGJBV4EgAG0CQEpCOYWsACkIgD4sAgMdti1AFY5uAgMY1y0hADAIMQQDGdUtIACnASEAtR3ELSAApwpAC0A7i6kAqACnBicMAxjQLSEAtREDHNQtIQC1FUA7lYwWIACZHwguIgAMHOotIwAdH+otYTAhALIAETAhALMA/zAhALQA8S0BMPYAQHWE9wBvCA0mIADCAUAVl/gtIADCCiAAQggAMAMZATDEAMIAQgwDGAQuIwAdEwMcCC4jAB0XIACTEGQATCgIAEGwnqgAdgirAAMUqR8DEAMcIS4hADUSIACoCakJqAoDGakKIy4hADUWIAArCAE6Ax0sLiEAtRI1ES8uIQC1FjUVQOWQgD59PgMdNy7oMCgCAxxHLiAAKAiqACkIrAAqCPcALAjqJkI0gKsBQReDgD4DHU8uZDBAF4CDLkMXgq0BIAAsCEEPm18uZDAqAgMcaC6cMCAAqgcDHKwDrQpXLiAAKgioACwIqQAPMK0FLQh6Pq0AhzADGAE+qgAtCPYAQDmDgDCHMQQnjjFA0UCegIYuQJyAsgBDPoSOLgowKAIDGJsuQGyIAx2bLiEAMgggAKoA/zoDGdEuSUmBqS4KMEBJgbIu9jBDSYChLkNJUEeAswBAOYQDGdQuIQAzENQuQE1ACYMoCKsAej6oAEEeg6kAKAj2ACkIRB6AqwBA/0Dch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCJAnQHWMdwiqACgGAx1mLysIKQYDGY8vAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRiBLyAAEhJA/4aoAKkBKginAKoKJxxqL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHJcvIQhBY78ANAA0GjT+NJ00/jTyNP40MzT/NGk0/zSYNP80wzT/NOs0/zQQNAA0MzQANFU0ADR3NAA0mDQANLg0ADTZNAA0+jQANBw0ATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNEA/QACAPDRBAYAANAEBAgAOgdQP/zoA",
+	"hex_fahrenheit":"AQACAACRAACGMRwu/zSKAScAkxwjKCAAixEnAJEQIQA4CAMZFyghALcfQAKejBAiAIwUCjAhALkABTAgAJUAIQCVEiAAixYnAJMBIAALHUIoIQCVFiAAixIhAIwUIgCMEAMQIQC3DSEAugpAJoYDHTwoIACMHDwoIQA3FEAaqpEUIACLFQsRIACRHIooAxAiAA0NIAC6ADoIAx1PKBAwugAhAI4BIgCNASAAOggQOgMZZSg6CCA6AxlqKDoIQDoDGW8oOgiAOgMZdCh4KCEAMggiAI4AQASAMwhCBIA0CEIEgDUIQARAJJoiAI0AIQA5CAMZgii5A4goIQC7ASEAugEhALgBIACREAkAIACLEyIADQggAN8AIQAOCCAA4ABAQ4LYMCEAjgBAa5FADSAA4QDiASAAjh+lKCAA4gogAGEI4wBiCOEAYwQhAMAAAxBDEYEOHrcoThGBDh/JKE4RgY4d2yhIEYEgAF8IQGqBIABgCEBQoyAAixchAD8IAx2/Aw8wIQA8AgMY5CyAMIoA/TA8BwMYigqCAAwpXil2KYopsCl3LDMslCygLOQs5CzUKW0qAytrK4gwIQBABUB/kgg6Ax0bKRswIQC/AAYwIQC8AOYsADAhAEAEAxnmLH8wjzGQJ4ExQJCCdwjfAGAEQAqAMzBCHoMDOgMdNykBMEEbgCIwQguDAjoDHUMpAjBBC4ARMEILgwE6Ax1SKQ0wQDaAAzBBDoBEMEIOg0A6Ax3mLAcwQkKL9gBtMPcAADCOMQ0mgTEhADIQIQC1FjUVQz+AMzpAR4ghALwB5iwBMPYAIABsCPcAbQhBGENHgCI6QxOAezBCaYDhAEBpieIAADD3AGII+CQGMCAAYgIDGKUpQa6DpSkRML8ABDBAR0NhgBE6QyWAdjBFJUBZgl8I9wBhCEJZQCODySkNML8ABTBLI4EhADUWQGxAwI09AgMYBSohAD4c5ymFMCEAsgDRMCEAswDtKWEwQAaAGTBABoIDECEAPgxAI4x6Pt8AhzADGAE+4QBfCPYAYQj3AIAwhzEEJ0BLiuIAIQC0AGYqBDD3ACEAPgiHMVsngjFAG4fhAV8IMz7fAGEIAxhhD4c+Rh5AEkAegLIAUB2C3woDGeEKSSCAswBQIIICMN8HAxhKIYS0AG4wIQC/AAwwQKKF5iwAMCEAPwQDHXUqQaCAiDBCq4OAOgMdgSoHMEETgCIwQguEIDoDHaIqIQC+CkKyiJcqEzAhAD4CAxyeKr4BnioKMEEGg8AqvgHAKgswQSBD2IQQOgMd0yohAL4DQiCAuSpCIIPPKhIwvgDPKkMhgQkwvgBAeYUEOgMdyCq+Cr4KzypAB4QFOgMdzyr+ML4HQjCARDBCMINAOgMd5iwTMECWgD0IQ5ZAG4QgAN8HXwiPMZAnQAmD5gB3COUAIABAloQgAGUI9wBmCDglQgtBlYANMEEvQlaEHyshAD4cFSsAMEMZhI4xDSaDMWQrATBHCUTagIMxSdqAAzBI2kAWhOIABDBiAgMYTStILYQgAGIIBjoDHVsrQAxALYQAMPcAXwj4JGQrR09BZ4AOMEFnRI9BS0KPhyEAPwgDHX8rIQC8AeYsiDBBq4PhAIA6Ax2LK0K3mSEAwB6hKyAA5QoDGeYKZgiAPn0+Ax2ZK+kwZQIDHLcrCTAgAOUHAxjmCrcrIQBAHs4r/zBACIEDHOYDQhaAsCtCFoD3MEINSsaGHzAoAB0CAxzKK/gwnQdCykL6gOEAQPqALyxAaECIgCEsQGaACTpABECEQIuHdjCPMVMngzEhAKwBrQEgAEBChoA+Ax3zKwYwZQIDGCEsQaKA4QBAjYBhCEKMjOIAjzGQJ4QxIADtAHcI7ABsCPYAbQj3AHIwQCdAC4HiCmIIQhGD4gB3COEAYgRAPIMGMCAA5QDmAUArgvYAZgj3AEBuQRpCo4n6MCgAnQDmLAAwIQA/BAMdbCx/MEIlkOEAdwjfAOIAYggAMAMZATDfAOMA5AHjG+QDYwj2AGQI9wBAFUFBj2IIAxlfLCIADBAMEowSKAAXESAAkxBpLDwwIQCwALEBQAODrgCvASgAFxVF7ILfAIg6AxlA6EAKQJaNIQAsCPcALQiOMQ0mhDEhAD8IAx2JLA0wvwADMEBagBEwQhyAETpDHIEBMPcAQL+E+CRuMCEAvwAIMEFwQWyBAxmtLEM4goA6Ax2wLEEbgCIwQgqJIDoDHcIsIQC9CgcwPQIDGL0BBzBBIUM4hBA6Ax3WLCEAvQNAEYMDHNIsBjC9AEITgEQwQhOBQDoDHUBMgL4BQrRANoEhADwIQaVAEZPiAGIMAxjzLCAAmRMDHPcsIACZFwgAIADPAHcIzgAhADUWtRY1FbUUQOOhTwIDGB8tGTAhALIA3TAhALMAIABPCHo+zwCHMAMYAT7RAE8I9gBRCPcAgDCHMQQnhTEhALQANy0AMCAATgQDGS4tYTBAHYAJMEAdgMkwQQ5AA4GyANEwQAmA/zBACUA/wNYAdwjVAHYI1wDYAdkB5zDaAAMw2wByMFcCAxheLVcI3AATMCAAXAIDHFIt7TDcB0otIABcGNQtcDDYAP4w2QDEMNoACTDbANQtjjAgANcHBDD3AFcIhzFbJ4UxIADcAN0BXAgzPtcAhzDeAF0IAxhdD94HAzDXBwMY3gpXCPYAXghDYkAXglwIAx2NLUcuiyAAXAgBOgMdmi2cMNgA/zDZAGQw2gDbAUEMgwg6Ax2jLQEwQwiCAjoDHawtRBGHAzoDHbot4DDYAPww2QAgMEF0QQ2DBDoDHcMtCDBDFoMFOgMdzC08MEMIgwY6Ax3ULQYwQAiMIABaCPMAWwj0AFgI9QBZCPYAVQj3AFYI6CVCqEAGQ++YdgjRAHUI0AB0CNMAcwjSAFMIgD7UAE8IgD5UAgMd/i1OCFICAxgFLiAAUAj3AFEIGy5A+EARgFEIQRGIEC5QCE4CAxgXLiAAUgj3AFMIQBGGTgj3AE8ICACcMPYAhjBBpKAWJ4YxIQChAHcIoACeMKIAhjCjACEAIAikACEIpQD/MKAHAxyhAyQIJQQDGZkuBDAiB6QApQGlDSMIpQckCPYAJQhEI4WnAHcIpgAiCPYAIwhEC4WpAKUAdwioAKQAAjBNIJSlAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZky4oCPYAKQhBGoAEJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKby4GMCEAogcDGKMKLC6IMQAoCAARNAA0AzQANLU0ADQBNAA0/zQPNLY0QQWI9zQPNG40ADQCNAA0hDQHNLc0QQuChTQHNLg0QQWChjQHNLk0QQWChzQHNLo0QQWCiDQHNLs0QQWC+TQPNKw0QSOC+zQPNK40QQWC/TQPNLA0QQWCiTQHNLw0QReCijQHNL00QQWCizQHNL40QQWCjDQHNL80QQWCjTQHNMA0QQWCjjQHNME0QQWRADoDGQsvgDoDGREvADR2CIQAdwiFAAAICAB3CIoAdgiCAAgAQBGAHi9AEYEmL/cBQxKBEgD3AEAUhYcxESf1APYP9wP3CkAFofQAdQj3AHQICABhNBk0/zQANNE0oTT/NAI0yTTNNP80ATRhNBE0/zQDNGE0yTT/NAQ0hTTRNP80BzTNNIU0/zQFNNE0QQOA3TRAH64INN001TT/NAY0IADnAHcI6ADpAQgw6gAgAGccZy9oCOkHIABnCOsAAxBrDOcAAxBoDesA6ABqCOsAawPqAGoIAx1iL2kICAADNLc0DTQlNLE0YTRBNDc0ATQhNAA0SAACEAC8IAC+Ab8BwAGAMMEAajAhAJkADjCMACIAjAEhAI0BIgCNASEAjgEEMCMAjAAhAB4WnhcjAI4BBTAgAJwA+jCbACEAkRRyMCgAlwB/MJAnIACnAHcIqQCoACgMAxgxKCgAFxEDHDUoKAAXFfowKACWADcwngD6MJ0AcjBAFqvtAHcI7ADIMCAAiwACMCcAkQCSAQkwIQCdACAAixMIMCEAOgIDHGopIQA3CCAAwgAhALoBIACLFyAAQgggAKwAIADJBiEAuAEhADsIAx23KCAALAggAMoAQQOPyQAgAMsBIABKCCA6Axl6KEoI4DoDHX4oATAhALsAVClAEosBOgMdjyggAG4IIADMACAAbwggAM0ABTBDEIoCOgMdoyitASIADB6aKCAArQogAC0IQBaAzQFEE4IDOgMdVClAE4GMHq4oSRNAU0A4gNQoQVCAywBATkBKgckoAjBCJYBLCECNgs0AdwjMAEQcgwI6AxndKDsIQDSK8SggAEwIIAC7AK0BLAi8AL0BPAgtBEFhgT0IOwRAH4EhALsKQRyGBDoDHRYpIABJCAMdDSlBHECehk0IIACtACwI9gAtCPcAQDyFUyeaMCEAtwAQKWYwQANAlYK4ACEAuwFBJIIGOgMdJilAIEMOgAcwQ1GCBzoDHUcpQCSBIABKBkQyg7sBLQi8AKwGQT6BrQAsBkMgQPRCIIAIOkCjQUJDPkAMggU6AxldKUFBgGopQSuArABAf0QVubsKIACLF5MdgSmAMYsgiTEoABcZfyn/MCEAtQADMCEAsgBZMCEAtAAhALMAIACTESAAkxwKLiAAvgoDGb8KPhzQKUAI9wBBCCAAoAB3CKEAIQCdFCEAnRiTKR0QIAAhDg85ogAgDqMA8DmiBKMGAxCjDKIMQQKPIgihAiMIAxwjD6ACIQAcCCAAogCjASIIpACmASEAGwhCB5qmBCMIpAQmCKIAJAijACIIoQcjCAMYIw+gByEI9wAgCMEAdwjAAAkwIQCdACAAPggPOQMdCC5FSoAgMEAlgaQBpgFASJGlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxgNKgkwQAOLDyohADYUIAAoCqEAAjD3ACEIhzFbJ4oxQD+JpQEgCLc+oACPMKEAJQgDGCUPoQdAEYAoCEIRQSmTtz6lACcIAxgnD48+pwCoASAAKQgoAgMcXiolCPYAJwj3AIAwhzEWJ0AYnKsAdwiqAKwAKwitAAAwrRv/MLsAvAAsCKIHLQgDGC0Powc8CAMYPA+kBzsIAxg7D6YHgSogACAI9gBAmVwjgiAAqApAMEBLjjYqIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoIhCKIAIAhA7MD3ACMIwwB3CMIAdDCQJyAAxQB3CMQAQgjGAEMIxwBECEYHIADuACAARwggAO8AIABFCAMYRQoDGc4qIADvByEANhzUKiIADBTWKiIADBAhADYQIgAMHPUqIACZH+kqETAhALIAyzAhALMA/zAhALQAIQC1ACIADBKMEjwwIQCwALEBQAODrgCvAQguezBAQEFGj8QABjBEAgMYICwhADUTAzAgAD8CAx0JK+gwPgIDHCUsQRWIrAB3CK0AuwAGMDsCAxgbLHYwQwqavAAhAKwKAxmtCgkwIAA8AgMcKCsIMLwAEzD3ACAAOwiHMVsnizEgAK0AAxA8DbsArQctCqwAQB+FuwB3CKwAAjAtB70AQAeVrgB3CL0AOwghAC0CAx1NKyAALAghACwCAxyEKyAAPQggAOwAIAAuCCAA7QBAB4z2AC4I9wByMFMnIAA8CAg6AxluKwMwLQevAEAmmbAAdwivADAEAx11KwYw9gAAMPcAezBTJxssIQCsAa0BIAC8CjwIrwCwAS8I9gAwCPcAdjBADoB6MEAehq8Adwi8AC8EAxkbLC0IQAiAvABAdoIhAC0O8DlALoEhACwOQBOFDzmwBK8GAxCvDbANQQKFIDCxALIBswG0AbUBQICGMAIDHbIrLAgvAgMc0ytAaqCvAjsIAxw7D7ACPQi2AC4ItwAAMLcb/zC5ALgANgixBzcIAxg3D7IHOAgDGDgPswc5CAMYOQ+0B+srIAAtCLYAPAhSGKEgALUKQDA1AgMcqysxDg85sQAyDrIA8DmxBLIGMw6zAPA5sgSzBjQOtADwObMEtAbwMLQZtAQDELQbAxS0DLMMsgyxDEUGgDEIQcOAMghAw4oIMCAAvgC/ASUsIQA1FyAAvgG/AXUwQJegwwB3CMIAQwQDGY0sIABsCCAAbgIgAMQAIABtCAMcbQogAG8CIADFAAMUxR8DEAMcRizECcUJxAoDGcUKAxQgAMMfQAqibyzCCcMJwgoDGcMKQwiAPsgARQiAPkgCAx1bLEQIQgIgAMYBAxxGFEYIADADGQEwxwDGAEYMAxhqLCIADBADHG4sIgAMFEBAQBuAyABAIUAegnosQghEAkYegMIAQR6AiSxBHoCNLEAemiEALggvBAMZliz/MK4HAxyvAyEAMAgxBAMZnyz/MLAHAxyxAyAApwEiAAwepiwgAKcKIAAnCEEoiqkApwAnDAMYsiwhALUTAxy2LCEAtRdBFoGMHr0sSRaGySwhALURAxzNLCEAtRVAK4DiLECbhIA+IACoACAAbwhABIgoAgMd4CwgAG4IIABsAgMY9yxAKYBVLUIPQBRBGUAUgPUsQsKCAxxVLXgwQNGQqQB3CKcAKQ7wOSEArwAgACcOIQCuAA85rwSuBgMQrg2vDUEChS4ODzkgAKcAIQAvDkAajvA5pwSpBicIIQCuAiAAKQgDHCkKAxkkLSEArwJ5MEYsgLEAQSyGsAAPObEEsAYDELANsQ1BAoAwDkIsgDEORSyAsAJDLIxRLSEAsQIiAAwSjBLXLSIADBrXLYwa1y1zMEM1gSAAbAdCeYggAKsAKQgDGCkPqwcrCIA+qgBCiYIqAgMdei1BmYIoAgMYnC1C7oeZLSAAqAEhALUfiC0gAKgKQAuAATlAJISqAKgGKAwDGJQtQeGAmC1A4UBDgQwW1y1A3kC/QGJBV4EgAG0CQEpCOYWsACkIgD4sAgMdti1AFY5uAgMY1y0hADAIMQQDGdUtIACnASEAtR3ELSAApwpAC0A7i6kAqACnBicMAxjQLSEAtREDHNQtIQC1FUA7lYwWIACZHwguIgAMHOotIwAdH+otYTAhALIAETAhALMA/zAhALQA8S0BMPYAQHWE9wBvCA0mIADCAUAVl/gtIADCCiAAQggAMAMZATDEAMIAQgwDGAQuIwAdEwMcCC4jAB0XIACTEGQATCgIAEGwnqgAdgirAAMUqR8DEAMcIS4hADUSIACoCakJqAoDGakKIy4hADUWIAArCAE6Ax0sLiEAtRI1FS8uIQC1FjUVQOWQgD59PgMdNy7oMCgCAxxHLiAAKAiqACkIrAAqCPcALAjqJkI0gKsBQReDgD4DHU8uZDBAF4CDLkMXgq0BIAAsCEEPm18uZDAqAgMcaC6cMCAAqgcDHKwDrQpXLiAAKgioACwIqQAPMK0FLQh6Pq0AhzADGAE+qgAtCPYAQDmDgDCHMQQnjjFA0UCegIYuQJyAsgBDPoSOLgowKAIDGJsuQGyIAx2bLiEAMgggAKoA/zoDGdEuSUmBqS4KMEBJgbIu9jBDSYChLkNJUEeAswBAOYQDGdQuIQAzENQuQE1ACYMoCKsAej6oAEEeg6kAKAj2ACkIRB6AqwBA/0Dch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCJAnQHWMdwiqACgGAx1mLysIKQYDGY8vAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRiBLyAAEhJA/4aoAKkBKginAKoKJxxqL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHJcvIQhBY78ANAA01TT9NME0/jRZNP80zzT/NDA0ADSGNAA00zQANBo0ATRcNAE0nDQBNNo0ATQWNAI0UTQCNIw0AjTHNAI0AjQDND80AzR9NAM0vTQDNAE0BDRINAQ0lDQENOU0BDQ/NAU0pDQFNBc0BjSeNAY0RDQHNB40CDRdNAk0qzQLNEA/QACAPDRBAYAANAEBAgAOgdQP/zoA",
+});
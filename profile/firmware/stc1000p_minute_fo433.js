@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_minute_fo433", {
+	"hex_celsius":"AQACAACgAACNMZot/zSKASAACx03KCIAjBAhADgIAxkXKAMQIQC3DIIwIACVACEAuAEsKCEANwghADUFIAC7ADsIAxkkKMEwQA6BJyhDMEADlSIAjBQBMCEAuAAAMCEANwQDHTUoIQCVFiAAixIgAAsRIACRHHMoAxAiAA0NQSGdAx1EKBAwuwAhAI4BIgCNASAAOwgQOgMZWig7CCA6AxlfKDsIQDoDGWQoOwiAOgMZaShtKCEAMAgiAI4AQASAMQhCBIAyCEIEgDMIQARAJJMiAI0AIACREAkAIAC+Ab8BwAGAMMEAajAhAJkADDCMACIAjAEhAI0BQDxAQKkEMCMAjAAhAB4WnhcjAI4BBTAgAJwA+jCbACEAkRRyMCgAlwB/MKAnIACnAHcIqQCoACgMAxilKCgAFxEDHKkoKAAXFfowKACWADcwngD6MJ0AcjBAFpHrAHcI6gDAMCAAiwAhAJURFRCVFBURCTCdAAYwIQA2AgMYbClArYADHUADhjYIAx3RKP8wIQC1AEEpQAeDAToDHdwoRTBACIEgAMkBQQqDAjoDHQgpdTBER5woDvA5qQAgAGwIIADKACAAbQggAMsAIACoAKsBqBurAw8wqAWrASkIqgCsASgIKgSpACsILAStACkIQzaEAzoDHRIpIABKCEMJjwQ6Ax04KSAAqQEiAIweHikgAKkKIAApDvA5qAADEKgNQAFADYEMHiwpQw2BqwAoCEAwgagAKQRDJYQFOgMdQSkgAEkIQAmXIQA1CCAAqQAIMKgAIAAoCKsAqAMrCAMZYykpCCAASQYgAKsAgDCrBQMQIADJDSAAQA2DXykxMCAAyQZACZOpDUcpgDAhALcAIACLFiEAlRIhALYKIACTHYIpiDEAIIExKAAXGYApQKesswADMCEAsABZMCEAsgAhALEAIACTESAAkxwaLiAAvgoDGb8KPhzRKUAI9wBBCCAAoAB3CKEAIQCdFCEAnRiUKR0QIAAhDg85ogAgDqMA8DmiBKMGAxCjDKIMQQKPIgihAiMIAxwjD6ACIQAcCCAAogCjASIIpACmASEAGwhCB5qmBCMIpAQmCKIAJAijACIIoQcjCAMYIw+gByEI9wAgCMEAdwjAAAkwIQCdACAAPggPOQMdGC5FSoAgMEAlgaQBpgFASJGlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxgOKgkwQAOLECohADQUIAAoCqEAAjD3ACEIjjHuJoIxQD+JpQEgCII+oACOMKEAJQgDGCUPoQdAEYAoCEIRQSmTgj6lACcIAxgnD44+pwCoASAAKQgoAgMcXyolCPYAJwj3AIAwhzHZJ0AYnKsAdwiqAKwAKwitAAAwrRv/ML0AvAAsCKIHLQgDGC0Powc8CAMYPA+kBz0IAxg9D6YHgiogACAI9gBAmVwjgiAAqApAMEBLjjcqIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoIhCKIAIAhA7M/3ACMIwwB3CMIAdDCgJyAAxQB3CMQAQgjGAEMIxwBECEYHIADsACAARwggAO0AIABFCAMYRQoDGc8qIADtBwMwIQA5AgMY1iohALYBIQA5CAMd3CowMLkAIQC5AyEANBzkKiIADBTmKiIADBAhADQQIgAMHAUrIACZH/kqETAhALAAyzAhALEA/zAhALIAIQCzACIADBKMEjwwIQCuAK8BQAODrACtARgufDBAT0FVj8QABjBEAgMYMCwhADMTAzAgAD8CAx0ZK+gwPgIDHDUsQRWIrAB3CK0AvQAGMD0CAxgrLHcwQwqavAAgAO4KAxnvCgkwIAA8AgMcOCsIMLwAEzD3ACAAPQiOMe4mgzEgAK0AAxA8Db0ArQctCqwAQB+FvQB3CKwAAjAtB64AQAeVrwB3CK4APQggAG8CAx1dKyAALAggAG4CAxyUKyAALgggAOoAIAAvCCAA6wBAB4z2AC8I9wByMGMnIAA8CAg6Axl+KwMwLQewAEAmmbEAdwiwADEEAx2FKwYw9gAAMPcAfDBjJyssIADuAe8BIAC8CjwIsACxATAI9gAxCPcAdzBADoB7MEAehrAAdwi8ADAEAxkrLC0IQAiAvABAdoIgAG8O8DlALoEgAG4OQBOFDzmxBLAGAxCwDbENQQKFIDCyALMBtAG1AbYBQICGMQIDHcIrLAgwAgMc4ytAaqCwAj0IAxw9D7ECLgi3AC8IuAAAMLgb/zC6ALkANwiyBzgIAxg4D7MHOQgDGDkPtAc6CAMYOg+1B/srIAAtCLcAPAhSGKEgALYKQDA2AgMcuysyDg85sgAzDrMA8DmyBLMGNA60APA5swS0BjUOtQDwObQEtQbwMLUZtQQDELUbAxS1DLQMswyyDEUGgDIIQcOAMwhAw4oIMCAAvgC/ATUsIQAzFyAAvgG/AXYwQJegwwB3CMIAQwQDGZ0sIABqCCAAbAIgAMQAIABrCAMcawogAG0CIADFAAMUxR8DEAMcVizECcUJxAoDGcUKAxQgAMMfQAqifyzCCcMJwgoDGcMKQwiAPsgARQiAPkgCAx1rLEQIQgIgAMYBAxxGFEYIADADGQEwxwDGAEYMAxh6LCIADBADHH4sIgAMFEBAQBuAyABAIUAegoosQghEAkYegMIAQR6AmSxBHoCdLEAemiEALAgtBAMZpiz/MKwHAxytAyEALggvBAMZryz/MK4HAxyvAyAApwEiAAwetiwgAKcKIAAnCEEoiqkApwAnDAMYwiwhALMTAxzGLCEAsxdBFoGMHs0sSRaG2SwhALMRAxzdLCEAsxVAK4DyLECbhIA+IACoACAAbQhABIgoAgMd8CwgAGwIIABqAgMYBy1AKYBlLUIPQBRBGUAUgAUtQsKCAxxlLXkwQNGQqQB3CKcAKQ7wOSEArQAgACcOIQCsAA85rQSsBgMQrA2tDUEChSwODzkgAKcAIQAtDkAajvA5pwSpBicIIQCsAiAAKQgDHCkKAxk0LSEArQJ6MEYsgK8AQSyGrgAPOa8ErgYDEK4Nrw1BAoAuDkIsgC8ORSyArgJDLIxhLSEArwIiAAwSjBLnLSIADBrnLYwa5y1zMEM1gSAAagdCeYggAKsAKQgDGCkPqwcrCIA+qgBCiYIqAgMdii1BmYIoAgMYrC1C7oepLSAAqAEhALMfmC0gAKgKQAuAATlAJISqAKgGKAwDGKQtQeGAqC1A4UBDgQwW5y1A3kC/QGJBV4EgAGsCQEpCOYWsACkIgD4sAgMdxi1AFY5sAgMY5y0hAC4ILwQDGeUtIACnASEAsx3ULSAApwpAC0A7i6kAqACnBicMAxjgLSEAsxEDHOQtIQCzFUA7lYwWIACZHxguIgAMHPotIwAdH/otYTAhALAAETAhALEA/zAhALIAAS4BMPYAQHWE9wBtCB0mIADCAUAVlwguIADCCiAAQggAMAMZATDEAMIAQgwDGBQuIwAdEwMcGC4jAB0XIACTEGQAwCgIAEGwnqgAdgirAAMUqR8DEAMcMS4hADMSIACoCakJqAoDGakKMy4hADMWIAArCAE6Ax08LiEAsxIzET8uIQCzFjMVQOWQgD59PgMdRy7oMCgCAxxXLiAAKAiqACkIrAAqCPcALAj6JkI0gKsBQReDgD4DHV8uZDBAF4CTLkMXgq0BIAAsCEEPm28uZDAqAgMceC6cMCAAqgcDHKwDrQpnLiAAKgioACwIqQAPMK0FLQj2Pq0AhzADGAE+qgAtCPYAQDmDgDCHMccnhjFA0UCegJYuQJyAsABDPoSeLgowKAIDGKsuQGyIAx2rLiEAMAggAKoA/zoDGeEuSUmBuS4KMEBJgcIu9jBDSYCxLkNJUEeAsQBAOYQDGeQuIQAxEOQuQE1ACYMoCKsA9j6oAEEeg6kAKAj2ACkIRB6AqwBA/0Dch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCKAnQHWMdwiqACgGAx12LysIKQYDGZ8vAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRiRLyAAEhJA/4aoAKkBKginAKoKJxx6L0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHKcvIQhBY5AAOgMZzi+AOgMZ1C8ANHYIhAB3CIUAAAgIAHcIigB2CIIAQRGA4S9AEYHpL/cBQxKBEgD3AEAUhYcx1Cf1APYP9wP3CkAFjvQAdQj3AHQICAADNLc0DTQlNLE0YTRBNDc0ATQhNEB6oCIADQggAN0AIQAOCCAA3gAiAI0B2DAhAI4AAxAhAD4NIADfAOABIACOHxooIADgCiAAXwjhAGAI3wBhBCEAvgADEEMRgQ4eLChOEYEOHz4oThGBjh1QKEgRhSAAXQgiAI0AIABeCEBQQNKhIQA9CAMdvQMPMCEAOgIDGFksiDCKAHIwOgcDGIoKggCBKNMo6yj/KCUp7CuoKwksFSxZLFksSSniKXgq4CqIMCEAPgVAf5IIOgMdkCgbMCEAvQAGMCEAugBbLAAwIQA+BAMZWyx/MIcxoCeIMUCQgncI3QBeBEAKgDMwQh6DAzoDHawoATBBG4AiMEILgwI6Ax24KAIwQQuAETBCC4MBOgMdxygNMEA2gAMwQQ6ARDBCDoNAOgMdWywHMEJCi/YAbTD3AAAwhjEdJogxIQAwECEAsxYzFUM/gDM6QEeIIQC6AVssATD2ACAAagj3AGsIQRhDR4AiOkMTgHwwQGmAiTFAukBpieAAADD3AGAIbSQGMCAAYAIDGBopQa6DGikRML0ABDBAR0NhgBE6QyWAdzBFJUBZgl0I9wBfCEBAgIkxQSODPikNML0ABTBLI4EhADMWQGxAwI07AgMYeikhADwcXCmFMCEAsADRMCEAsQBiKWEwQAaAGTBABoIDECEAPAxAI4z2Pt0AhzADGAE+3wBdCPYAXwj3AIAwhzHHJ0BLieAAIQCyANspBDD3ACEAPAiOMe4mQAuI3QDfAV0Iwj7dAF8IAxhfD44+Sh6AsABQHYLdCgMZ3wpJIICxAFAgggIw3QcDGEohhLIAbjAhAL0ADDBAooVbLAAwIQA9BAMd6ilBoICIMEKrg4A6Ax32KQcwQROAIjBCC4QgOgMdFyohALwKQrKIDCoTMCEAPAIDHBMqvAETKgswQQaCNSq8ATUqQAZAIEPYhBA6Ax1IKiEAvANCIIAuKkIgg0QqEjC8AEQqQyGBCjC8AEB5hQU6Ax09KrwKvApEKkAHhAY6Ax1EKv4wvAdCMIBEMEIwg0A6Ax1bLBMwQJaAOwhAloCKMUALQBuEIADdB10IhzGgJ0AJg+QAdwjjACAAQJaEIABjCPcAZAitJEILQZWADTBBL0JWhJQqIQA8HIoqADBDGYSGMR0mijHZKgEwRwlE2kFDR9qAAzBI2kAWhOAABDBgAgMYwipILYQgAGAIBzoDHdAqQAxALYQAMPcAXQhtJNkqR09BZ4AOMEFnS4+HIQA9CAMd9CohALoBWyyIMEGrg98AgDoDHQArQreZIQC+HhYrIADjCgMZ5ApkCIA+fT4DHQ4r6TBjAgMcLCsJMCAA4wcDGOQKLCshAD4eQyv/MEAIgQMc5ANCFoAlK0IWgPcwQg1KxoYfMCgAHQIDHD8r+DCdB0LKQvqA3wBA+oCkK0BoggY6Ax2WK0BmgAo6QARAhECLh3cwhzFjJ4sxIADuAe8BIABAQoaAPgMdaCsGMGMCAxiWK0GigN8AQI2AXwhAjEAWguAAhzGgJ0AEh+sAdwjqAGoI9gBrCPcAcjBCJ4HgCmAIQhGD4AB3CN8AYARAPIMGMCAA4wDkAUArgvYAZAj3AEBuQRpCo4n6MCgAnQBbLAAwIQA9BAMd4St/MEIlkN8AdwjdAOAAYAgAMAMZATDdAOEA4gHhG+IDYQj2AGII9wBAFUFBj2AIAxnUKyIADBAMEowSKAAXESAAkxDeKzwwIQCuAK8BQAODrACtASgAFxVF7ILdAIg6AxlA6EAKQJaNIABuCPcAbwiGMR0mizEhAD0IAx3+Kw0wvQADMEBagBEwQhyAETpDHIEBMPcAQL+EbSRuMCEAvQAIMEFwQWyBAxkiLEM4goA6Ax0lLEEbgCIwQgqJIDoDHTcsIQC7CgcwOwIDGLsBBzBBIUM4hBA6Ax1LLCEAuwNAEYMDHEcsBjC7AEITgEQwQhOBQDoDHUBMgLwBQrRANoEhADoIQaVAEZPgAGAMAxhoLCAAmRMDHGwsIACZFwgAIADNAHcIzAAhADMWsxYzFbMUQOOhTQIDGJQsGTAhALAA3TAhALEAIABNCPY+zQCHMAMYAT7PAE0I9gBPCPcAgDCHMccnjDEhALIArCwAMCAATAQDGaMsYTBAHYAJMEAdgMkwQQ5AA4GwANEwQAmA/zBACUA/wNQAdwjTAHYI1QDWAdcB5zDYAAMw2QByMFUCAxjTLFUI2gATMCAAWgIDHMcs7TDaB78sIABaGFItcDDWAP4w1wB4MNgABTDZAFItjjAgANUHBDD3AFUIjjHuJowxIADaANsBWgjCPtUAjjDcAFsIAxhbD9wHAzDVBwMY3ApVCPYAXAhDYkAXgloIAx0CLUcuiyAAWggBOgMdDy3OMNYA/zDXADIw2ADZAUEMgwk6Ax0YLQEwQwiCAjoDHSEtRBGDBDoDHSotDzBDCIIDOgMdOC1CNYKQMNgAATBCNYMFOgMdQS0IMEMWgwY6Ax1KLTwwQwiDBzoDHVItBjBACIwgAFgI8wBZCPQAVgj1AFcI9gBTCPcAVAhmJUKxQAZD+Jl2CM8AdQjOAHQI0QBzCNAAUQiAPtIATQiAPlICAx18LUwIUAIDGIMtIABOCPcATwiZLSAAQA6B0gBPCEERiI4tTghMAgMYlS0gAFAI9wBRCEARhkwI9wBNCAgAGjD2AI4wQa2g2SeNMSEAoQB3CKAAHDCiAI4wowAhACAIpAAhCKUA/zCgBwMcoQMkCCUEAxkXLgQwIgekAKUBpQ0jCKUHJAj2ACUIRCOFpwB3CKYAIgj2ACMIRAuFqQClAHcIqACkAAIwTSCUpQCrAHcIpACqACEAJgiqACcIqwD/MKYHAxynAyoIKwQDGREuKAj2ACkIQRqkxyeOMSEAqgAkCIQAJQiFACoIgACoCgMZqQqkCgMZpQrtLQYwIQCiBwMYowqqLYAxdCgIABE0ADQDNAA0szQANAE0ADQVNA80tDRBBYgNNA80bDQANAI0ADQWNA80tTRBC4IXNA80tjRBBYIYNA80tzRBBYIZNA80uDRBBYIaNA80uTRBBYIPNA80bjRBI4IRNA80rDRBBYITNA80rjRBBYIbNA80ujRBF4IcNA80uzRBBYIdNA80vDRBBYIeNA80vTRBBYIfNA80vjRBBYIgNA80vzRBBUAAmRo0/jSdNP408jT+NDM0/zRpNP80mDT/NMM0/zTrNP80EDQANDM0ADRVNAA0dzQANJg0ADRAW4LZNAA0+jRAP70BND40ATRiNAE0hzQBNK80ATTZNAE0BzQCNDk0AjRwNAI0sDQCNPs0AjRYNAM00TQDNII0BDTKNAU0YTQZNP80ADTRNKE0/zQCNMk0zTT/NAE0hTS3NP80BDRhNBE0/zQDNGE0yTT/NAU0hTTRNP80CDTNNIU0/zQGNNE0QQOA3TRAI6MJNN001TT/NAc0IADlAHcI5gDnAQgw6AAgAGUc+i5mCOcHIABlCOkAAxBpDOUAAxBmDekA5gBoCOkAaQPoAGgIAx31LmcICABBi4EANDw0QQFDAIAYNEQGAQECAA6B1A//OgA=",
+	"hex_fahrenheit":"AQACAACgAACNMZot/zSKASAACx03KCIAjBAhADgIAxkXKAMQIQC3DIIwIACVACEAuAEsKCEANwghADUFIAC7ADsIAxkkKMEwQA6BJyhDMEADlSIAjBQBMCEAuAAAMCEANwQDHTUoIQCVFiAAixIgAAsRIACRHHMoAxAiAA0NQSGdAx1EKBAwuwAhAI4BIgCNASAAOwgQOgMZWig7CCA6AxlfKDsIQDoDGWQoOwiAOgMZaShtKCEAMAgiAI4AQASAMQhCBIAyCEIEgDMIQARAJJMiAI0AIACREAkAIAC+Ab8BwAGAMMEAajAhAJkADDCMACIAjAEhAI0BQDxAQKkEMCMAjAAhAB4WnhcjAI4BBTAgAJwA+jCbACEAkRRyMCgAlwB/MKAnIACnAHcIqQCoACgMAxilKCgAFxEDHKkoKAAXFfowKACWADcwngD6MJ0AcjBAFpHrAHcI6gDAMCAAiwAhAJURFRCVFBURCTCdAAYwIQA2AgMYbClArYADHUADhjYIAx3RKP8wIQC1AEEpQAeDAToDHdwoRTBACIEgAMkBQQqDAjoDHQgpdTBER5woDvA5qQAgAGwIIADKACAAbQggAMsAIACoAKsBqBurAw8wqAWrASkIqgCsASgIKgSpACsILAStACkIQzaEAzoDHRIpIABKCEMJjwQ6Ax04KSAAqQEiAIweHikgAKkKIAApDvA5qAADEKgNQAFADYEMHiwpQw2BqwAoCEAwgagAKQRDJYQFOgMdQSkgAEkIQAmXIQA1CCAAqQAIMKgAIAAoCKsAqAMrCAMZYykpCCAASQYgAKsAgDCrBQMQIADJDSAAQA2DXykxMCAAyQZACZOpDUcpgDAhALcAIACLFiEAlRIhALYKIACTHYIpiDEAIIExKAAXGYApQKesswADMCEAsABZMCEAsgAhALEAIACTESAAkxwaLiAAvgoDGb8KPhzRKUAI9wBBCCAAoAB3CKEAIQCdFCEAnRiUKR0QIAAhDg85ogAgDqMA8DmiBKMGAxCjDKIMQQKPIgihAiMIAxwjD6ACIQAcCCAAogCjASIIpACmASEAGwhCB5qmBCMIpAQmCKIAJAijACIIoQcjCAMYIw+gByEI9wAgCMEAdwjAAAkwIQCdACAAPggPOQMdGC5FSoAgMEAlgaQBpgFASJGlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxgOKgkwQAOLECohADQUIAAoCqEAAjD3ACEIjjHuJoIxQD+JpQEgCII+oACOMKEAJQgDGCUPoQdAEYAoCEIRQSmTgj6lACcIAxgnD44+pwCoASAAKQgoAgMcXyolCPYAJwj3AIAwhzHZJ0AYnKsAdwiqAKwAKwitAAAwrRv/ML0AvAAsCKIHLQgDGC0Powc8CAMYPA+kBz0IAxg9D6YHgiogACAI9gBAmVwjgiAAqApAMEBLjjcqIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoIhCKIAIAhA7M/3ACMIwwB3CMIAdDCgJyAAxQB3CMQAQgjGAEMIxwBECEYHIADsACAARwggAO0AIABFCAMYRQoDGc8qIADtBwMwIQA5AgMY1iohALYBIQA5CAMd3CowMLkAIQC5AyEANBzkKiIADBTmKiIADBAhADQQIgAMHAUrIACZH/kqETAhALAAyzAhALEA/zAhALIAIQCzACIADBKMEjwwIQCuAK8BQAODrACtARgufDBAT0FVj8QABjBEAgMYMCwhADMTAzAgAD8CAx0ZK+gwPgIDHDUsQRWIrAB3CK0AvQAGMD0CAxgrLHcwQwqavAAgAO4KAxnvCgkwIAA8AgMcOCsIMLwAEzD3ACAAPQiOMe4mgzEgAK0AAxA8Db0ArQctCqwAQB+FvQB3CKwAAjAtB64AQAeVrwB3CK4APQggAG8CAx1dKyAALAggAG4CAxyUKyAALgggAOoAIAAvCCAA6wBAB4z2AC8I9wByMGMnIAA8CAg6Axl+KwMwLQewAEAmmbEAdwiwADEEAx2FKwYw9gAAMPcAfDBjJyssIADuAe8BIAC8CjwIsACxATAI9gAxCPcAdzBADoB7MEAehrAAdwi8ADAEAxkrLC0IQAiAvABAdoIgAG8O8DlALoEgAG4OQBOFDzmxBLAGAxCwDbENQQKFIDCyALMBtAG1AbYBQICGMQIDHcIrLAgwAgMc4ytAaqCwAj0IAxw9D7ECLgi3AC8IuAAAMLgb/zC6ALkANwiyBzgIAxg4D7MHOQgDGDkPtAc6CAMYOg+1B/srIAAtCLcAPAhSGKEgALYKQDA2AgMcuysyDg85sgAzDrMA8DmyBLMGNA60APA5swS0BjUOtQDwObQEtQbwMLUZtQQDELUbAxS1DLQMswyyDEUGgDIIQcOAMwhAw4oIMCAAvgC/ATUsIQAzFyAAvgG/AXYwQJegwwB3CMIAQwQDGZ0sIABqCCAAbAIgAMQAIABrCAMcawogAG0CIADFAAMUxR8DEAMcVizECcUJxAoDGcUKAxQgAMMfQAqifyzCCcMJwgoDGcMKQwiAPsgARQiAPkgCAx1rLEQIQgIgAMYBAxxGFEYIADADGQEwxwDGAEYMAxh6LCIADBADHH4sIgAMFEBAQBuAyABAIUAegoosQghEAkYegMIAQR6AmSxBHoCdLEAemiEALAgtBAMZpiz/MKwHAxytAyEALggvBAMZryz/MK4HAxyvAyAApwEiAAwetiwgAKcKIAAnCEEoiqkApwAnDAMYwiwhALMTAxzGLCEAsxdBFoGMHs0sSRaG2SwhALMRAxzdLCEAsxVAK4DyLECbhIA+IACoACAAbQhABIgoAgMd8CwgAGwIIABqAgMYBy1AKYBlLUIPQBRBGUAUgAUtQsKCAxxlLXkwQNGQqQB3CKcAKQ7wOSEArQAgACcOIQCsAA85rQSsBgMQrA2tDUEChSwODzkgAKcAIQAtDkAajvA5pwSpBicIIQCsAiAAKQgDHCkKAxk0LSEArQJ6MEYsgK8AQSyGrgAPOa8ErgYDEK4Nrw1BAoAuDkIsgC8ORSyArgJDLIxhLSEArwIiAAwSjBLnLSIADBrnLYwa5y1zMEM1gSAAagdCeYggAKsAKQgDGCkPqwcrCIA+qgBCiYIqAgMdii1BmYIoAgMYrC1C7oepLSAAqAEhALMfmC0gAKgKQAuAATlAJISqAKgGKAwDGKQtQeGAqC1A4UBDgQwW5y1A3kC/QGJBV4EgAGsCQEpCOYWsACkIgD4sAgMdxi1AFY5sAgMY5y0hAC4ILwQDGeUtIACnASEAsx3ULSAApwpAC0A7i6kAqACnBicMAxjgLSEAsxEDHOQtIQCzFUA7lYwWIACZHxguIgAMHPotIwAdH/otYTAhALAAETAhALEA/zAhALIAAS4BMPYAQHWE9wBtCB0mIADCAUAVlwguIADCCiAAQggAMAMZATDEAMIAQgwDGBQuIwAdEwMcGC4jAB0XIACTEGQAwCgIAEGwnqgAdgirAAMUqR8DEAMcMS4hADMSIACoCakJqAoDGakKMy4hADMWIAArCAE6Ax08LiEAsxIzFT8uIQCzFjMVQOWQgD59PgMdRy7oMCgCAxxXLiAAKAiqACkIrAAqCPcALAj6JkI0gKsBQReDgD4DHV8uZDBAF4CTLkMXgq0BIAAsCEEPm28uZDAqAgMceC6cMCAAqgcDHKwDrQpnLiAAKgioACwIqQAPMK0FLQj2Pq0AhzADGAE+qgAtCPYAQDmDgDCHMccnhjFA0UCegJYuQJyAsABDPoSeLgowKAIDGKsuQGyIAx2rLiEAMAggAKoA/zoDGeEuSUmBuS4KMEBJgcIu9jBDSYCxLkNJUEeAsQBAOYQDGeQuIQAxEOQuQE1ACYMoCKsA9j6oAEEeg6kAKAj2ACkIRB6AqwBA/0Dch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCKAnQHWMdwiqACgGAx12LysIKQYDGZ8vAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRiRLyAAEhJA/4aoAKkBKginAKoKJxx6L0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHKcvIQhBY5AAOgMZzi+AOgMZ1C8ANHYIhAB3CIUAAAgIAHcIigB2CIIAQRGA4S9AEYHpL/cBQxKBEgD3AEAUhYcx1Cf1APYP9wP3CkAFjvQAdQj3AHQICAADNLc0DTQlNLE0YTRBNDc0ATQhNEB6oCIADQggAN0AIQAOCCAA3gAiAI0B2DAhAI4AAxAhAD4NIADfAOABIACOHxooIADgCiAAXwjhAGAI3wBhBCEAvgADEEMRgQ4eLChOEYEOHz4oThGBjh1QKEgRhSAAXQgiAI0AIABeCEBQQNKhIQA9CAMdvQMPMCEAOgIDGFksiDCKAHIwOgcDGIoKggCBKNMo6yj/KCUp7CuoKwksFSxZLFksSSniKXgq4CqIMCEAPgVAf5IIOgMdkCgbMCEAvQAGMCEAugBbLAAwIQA+BAMZWyx/MIcxoCeIMUCQgncI3QBeBEAKgDMwQh6DAzoDHawoATBBG4AiMEILgwI6Ax24KAIwQQuAETBCC4MBOgMdxygNMEA2gAMwQQ6ARDBCDoNAOgMdWywHMEJCi/YAbTD3AAAwhjEdJogxIQAwECEAsxYzFUM/gDM6QEeIIQC6AVssATD2ACAAagj3AGsIQRhDR4AiOkMTgHwwQGmAiTFAukBpieAAADD3AGAIbSQGMCAAYAIDGBopQa6DGikRML0ABDBAR0NhgBE6QyWAdzBFJUBZgl0I9wBfCEBAgIkxQSODPikNML0ABTBLI4EhADMWQGxAwI07AgMYeikhADwcXCmFMCEAsADRMCEAsQBiKWEwQAaAGTBABoIDECEAPAxAI4z2Pt0AhzADGAE+3wBdCPYAXwj3AIAwhzHHJ0BLieAAIQCyANspBDD3ACEAPAiOMe4mQAuI3QDfAV0Iwj7dAF8IAxhfD44+Sh6AsABQHYLdCgMZ3wpJIICxAFAgggIw3QcDGEohhLIAbjAhAL0ADDBAooVbLAAwIQA9BAMd6ilBoICIMEKrg4A6Ax32KQcwQROAIjBCC4QgOgMdFyohALwKQrKIDCoTMCEAPAIDHBMqvAETKgswQQaCNSq8ATUqQAZAIEPYhBA6Ax1IKiEAvANCIIAuKkIgg0QqEjC8AEQqQyGBCjC8AEB5hQU6Ax09KrwKvApEKkAHhAY6Ax1EKv4wvAdCMIBEMEIwg0A6Ax1bLBMwQJaAOwhAloCKMUALQBuEIADdB10IhzGgJ0AJg+QAdwjjACAAQJaEIABjCPcAZAitJEILQZWADTBBL0JWhJQqIQA8HIoqADBDGYSGMR0mijHZKgEwRwlE2kFDR9qAAzBI2kAWhOAABDBgAgMYwipILYQgAGAIBzoDHdAqQAxALYQAMPcAXQhtJNkqR09BZ4AOMEFnS4+HIQA9CAMd9CohALoBWyyIMEGrg98AgDoDHQArQreZIQC+HhYrIADjCgMZ5ApkCIA+fT4DHQ4r6TBjAgMcLCsJMCAA4wcDGOQKLCshAD4eQyv/MEAIgQMc5ANCFoAlK0IWgPcwQg1KxoYfMCgAHQIDHD8r+DCdB0LKQvqA3wBA+oCkK0BoggY6Ax2WK0BmgAo6QARAhECLh3cwhzFjJ4sxIADuAe8BIABAQoaAPgMdaCsGMGMCAxiWK0GigN8AQI2AXwhAjEAWguAAhzGgJ0AEh+sAdwjqAGoI9gBrCPcAcjBCJ4HgCmAIQhGD4AB3CN8AYARAPIMGMCAA4wDkAUArgvYAZAj3AEBuQRpCo4n6MCgAnQBbLAAwIQA9BAMd4St/MEIlkN8AdwjdAOAAYAgAMAMZATDdAOEA4gHhG+IDYQj2AGII9wBAFUFBj2AIAxnUKyIADBAMEowSKAAXESAAkxDeKzwwIQCuAK8BQAODrACtASgAFxVF7ILdAIg6AxlA6EAKQJaNIABuCPcAbwiGMR0mizEhAD0IAx3+Kw0wvQADMEBagBEwQhyAETpDHIEBMPcAQL+EbSRuMCEAvQAIMEFwQWyBAxkiLEM4goA6Ax0lLEEbgCIwQgqJIDoDHTcsIQC7CgcwOwIDGLsBBzBBIUM4hBA6Ax1LLCEAuwNAEYMDHEcsBjC7AEITgEQwQhOBQDoDHUBMgLwBQrRANoEhADoIQaVAEZPgAGAMAxhoLCAAmRMDHGwsIACZFwgAIADNAHcIzAAhADMWsxYzFbMUQOOhTQIDGJQsGTAhALAA3TAhALEAIABNCPY+zQCHMAMYAT7PAE0I9gBPCPcAgDCHMccnjDEhALIArCwAMCAATAQDGaMsYTBAHYAJMEAdgMkwQQ5AA4GwANEwQAmA/zBACUA/wNQAdwjTAHYI1QDWAdcB5zDYAAMw2QByMFUCAxjTLFUI2gATMCAAWgIDHMcs7TDaB78sIABaGFItcDDWAP4w1wDEMNgACTDZAFItjjAgANUHBDD3AFUIjjHuJowxIADaANsBWgjCPtUAjjDcAFsIAxhbD9wHAzDVBwMY3ApVCPYAXAhDYkAXgloIAx0CLUcuiyAAWggBOgMdDy2cMNYA/zDXAGQw2ADZAUEMgwk6Ax0YLQEwQwiCAjoDHSEtRBGDBDoDHSotDzBDCIcDOgMdOC3gMNYA/DDXACAwQX1BDYMFOgMdQS0IMEMWgwY6Ax1KLTwwQwiDBzoDHVItBjBACIwgAFgI8wBZCPQAVgj1AFcI9gBTCPcAVAhmJUKxQAZD+Jl2CM8AdQjOAHQI0QBzCNAAUQiAPtIATQiAPlICAx18LUwIUAIDGIMtIABOCPcATwiZLSAAQA6B0gBPCEERiI4tTghMAgMYlS0gAFAI9wBRCEARhkwI9wBNCAgAGjD2AI4wQa2g2SeNMSEAoQB3CKAAHDCiAI4wowAhACAIpAAhCKUA/zCgBwMcoQMkCCUEAxkXLgQwIgekAKUBpQ0jCKUHJAj2ACUIRCOFpwB3CKYAIgj2ACMIRAuFqQClAHcIqACkAAIwTSCUpQCrAHcIpACqACEAJgiqACcIqwD/MKYHAxynAyoIKwQDGREuKAj2ACkIQRqkxyeOMSEAqgAkCIQAJQiFACoIgACoCgMZqQqkCgMZpQrtLQYwIQCiBwMYowqqLYAxdCgIABE0ADQDNAA0szQANAE0ADQVNA80tDRBBYgNNA80bDQANAI0ADQWNA80tTRBC4IXNA80tjRBBYIYNA80tzRBBYIZNA80uDRBBYIaNA80uTRBBYIPNA80bjRBI4IRNA80rDRBBYITNA80rjRBBYIbNA80ujRBF4IcNA80uzRBBYIdNA80vDRBBYIeNA80vTRBBYIfNA80vjRBBYIgNA80vzRBBUAAjNU0/TTBNP40WTT/NM80/zQwNAA0hjQANNM0QEvPATRcNAE0nDQBNNo0ATQWNAI0UTQCNIw0AjTHNAI0AjQDND80AzR9NAM0vTQDNAE0BDRINAQ0lDQENOU0BDQ/NAU0pDQFNBc0BjSeNAY0RDQHNB40CDRdNAk0qzQLNGE0GTT/NAA00TShNP80AjTJNM00/zQBNIU0tzT/NAQ0YTQRNP80AzRhNMk0/zQFNIU00TT/NAg0zTSFNP80BjTRNEEDgN00QCOjCTTdNNU0/zQHNCAA5QB3COYA5wEIMOgAIABlHPouZgjnByAAZQjpAAMQaQzlAAMQZg3pAOYAaAjpAGkD6ABoCAMd9S5nCAgAQYuBADQ8NEEBQwCAGDREBgEBAgAOgdQP/zoA",
+});
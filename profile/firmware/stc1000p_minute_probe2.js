@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_minute_probe2", {
+	"hex_celsius":"AQACAACrAACNMbAt/zSKASAAkRxBKAMQIgANDSAAvQA9CAMdEigQML0AIQCOASIAjQEgAD0IEDoDGSgoPQggOgMZLSg9CEA6AxkyKD0IgDoDGTcoOyghADEIIgCOAEAEgDIIQgSAMwhCBIA0CEAEQCSWIgCNACAAkRAJACAAvgG/AcABgDDBAMIBgDDDAGowIQCZAA4wjAAiAIwBIQCNAUA/QEPcBjAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzDDJyAApwB3CKkAqAAoDAMYdigoABcRAxx6KCgAFxX6MCgAlgA3MJ4A+jCdAHIwwychAKYAdwilAMAwIACLAAkwIQCdACAAkx2jKIgxACCAMSgAFxmhKP8wIQC0AAMwIQCxAFkwIQCzACEAsgAgAJMRIACTHCUtIAC+CgMZvwo+HLgoQAj3AEEIAiYgAMEAdwjAAAUwQCmExCggAEII9wBDCEAMgsMAdwjCAEI2gz4IDzkDHSMtQQ+FKCUgAMUAdwjEAHYwQGayxwB3CMYARAjIAEUIyQBGCEgHIQCpACAASQghAKoAIABHCAMYRwoDGesoIQCqByAAxAEhADUc8iggAMQKIADFASEAtRz5KCAAxQogAEUIxgDEBUQMAxgCKSEANRADHAYpIQA1FCAAQVpDPYB1MEo9gKcAQT2AqABDPYIpKSEAqAdAO4UvKSIADBQxKSIADBBAMIG1EH0wQCRBKotFBAMZPykhALUUIgAMHFwpIACZH1ApETBAq4DLMECpQLRAroe0ACIADBKMEjwwIQCvALABQAODrQCuASMtfjBDJ4/GAAYwRgIDGIcqIQA0EwMwIAA/AgMdcCnoMD4CAxyMKkEViKwAdwitAK4ABjAuAgMYgip4MEMKmq8AIQCrCgMZrAoJMCAALwIDHI8pCDCvABMw9wAgAC4IjzEjJ4ExIACtAAMQLw2uAK0HLQqsAEAfha4AdwisAAIwLQewAEAHlbEAdwiwAC4IIQAsAgMdtCkgACwIIQArAgMc6ykgADAIIQClACAAMQghAKYAQAeM9gAxCPcAcjCGJyAALwgIOgMZ1SkDMC0HsgBAJpmzAHcIsgAzBAMd3CkGMPYAADD3AH4whieCKiEAqwGsASAArwovCLIAswEyCPYAMwj3AHgwQA6AfDBAHoayAHcIrwAyBAMZgiotCEAIgK8AQHaCIQAsDvA5QC6BIQArDkAThQ85swSyBgMQsg2zDUEChSAwtAC1AbYBtwG4AUCAhjMCAx0ZKiwIMgIDHDoqQGqgsgIuCAMcLg+zAjAIuQAxCLoAADC6G/8wvAC7ADkItAc6CAMYOg+1BzsIAxg7D7YHPAgDGDwPtwdSKiAALQi5AC8IUhihIAC4CkAwOAIDHBIqNA4PObQANQ61APA5tAS1BjYOtgDwObUEtgY3DrcA8Dm2BLcG8DC3GbcEAxC3GwMUtwy2DLUMtAxFBoA0CEHDgDUIQMOKCDAgAL4AvwGMKiEANBcgAL4BvwF3MECXoMUAdwjEAEUEAxn0KiEAJQghACcCIADGACEAJggDHCYKIQAoAiAAxwADFMcfAxADHK0qxgnHCcYKAxnHCgMUIADFH0AKpNYqxAnFCcQKAxnFCkUIgD7KAEcIgD5KAgMdwipGCEQCIADIAQMcSBRICAAwAxkBMMkAyABIDAMY0SoiAAwQAxzVKiIADBT0KiAAQBuAygBAIUAeguEqRAhGAkYegMQAQR6A8CpBHoD0KkAegHQwQGedpwB3CKkAIQAtCC4EAxkDK/8wrQcDHK4DIQAvCDAEAxkMK/8wrwcDHLADIACoASIADB4TKyAAqAogACgIQS6KqwCoACgMAxgfKyEAtBMDHCMrIQC0F0EWgYweKitJFoY2KyEAtBEDHDorIQC0FUArgG4rQKGEgD4gAKoAIQAoCEAEjSoCAx1NKyEAJwghACUCAxikKyEAtRxuKyAAKQhACIogAKgAJwgDHCcKIQAmAiAAqwAhACoIQSGBKwiAPkAfhWwrKAghACkCAxykK0BIgAIsQi5AM0E4QBOAgStC50IzgAIsQTOAJQdAM0AVQDCDJwgDGCcPqwdAL0AgQTdAIIeiKyEAKQggACgCAxgCLHowQK+QqwB3CKgAKw7wOSEArgAgACgOIQCtAA85rgStBgMQrQ2uDUECgS0ODzlBMoAuDkAagvA5qASrBkBcia0CIAArCAMcKwoDGdErIQCuAnswRiyAsABBLIavAA85sASvBgMQrw2wDUECgC8OQiyAMA5FLICvAkMsjP4rIQCwAiIADBKMEtAsIgAMGtAsjBrQLHMwQzWEAxCnGwMUpwypDEMEQCNAj0GliCAArAArCAMYKw+sBywIgD6tAEK1gi0CAx0yLEDkQJWBAxhzLECwgFMsQ+SAqgBE5ICsAEKsgK0AQCRAH4FRLCoIQeRAHootCC4EAxlwLCAAqgEhALQfXywgAKoKQAuAATlAH4qtAKoGKgwDGGssIQC0EwMcbywhALQXQG2CDBbQLCAAQFxAO4CoAEGBQTuAqwBCWICuAEDwgi4CAx2NLEAVgicCAxjQLEBagLEsQVpAe4CpAEB7iQMYJgoDGaAsIACnByAAJwiAPq4AQl9AIIOvLCEAKQggAEBdQCGKLwgwBAMZziwgAKkBIQC0Hb0sIACpCkALQF2LpwCoAKkGKQwDGMksIQC0EQMczSwhALQVQF2qjBYgAJkfIy0iAAwc4ywjAB0f4yxhMCEAsQARMCEAsgD/MCEAswAMLSAAxAEjAB4f6iwgAMQKIABECAAwAxkBMMYAxABEDAMY9iwhALQQAxz6LCEAtBRAFIIFLQEw9gBAU4P3ACoIQCYMLUEHgycI9wAoCEAmQSiBHR8TLUkoqB8tIwAdEwMcIy0jAB0XIACTEGQAjSgIACAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxhdLQkwQAOLXy0hADUUIAAoCqEAAjD3ACEIjzEjJ4UxQD+JpQEgCIA+oACOMKEAJQgDGCUPoQdAEYAoCEIRQSmHgD6lACcIAxgnD44+pwCoAUDzhCgCAxyuLSUI9gBAhIKAMI8xBidAGJ2rAHcIqgCsACsIrQAAMK0b/zCuAK8ALAiiBy0IAxgtD6MHLwgDGC8PpAcuCAMYLg+mB9EtIAAgCPYAIQhdI4IgAKgKQDBAS46GLSIODzmhACMOoADwOaEEoAYkDqUA8DmgBKUGJg5Cr4XwMKcZpwQDEKcbAxRApYGgDKEMRQaGIQiiACAIowAiCPcAIwhD2YYhAJ0UIQCdGAguHRAgAEDbiKIAIA6jAPA5ogSjBgMQowyiDEECiCIIoQIjCAMcIw+gAiEAHAggAED2hCIIpACmASEAGwhCB4WmBCMIpAQmCKIAJAhAN4ShByMIAxgjD6AHQIqAIAhAPaCpAHcIqAB2CKsAAxSpHwMQAxxULiEANBIgAKgJqQmoCgMZqQpWLiEANBYgACsIAToDHV8uIQC0EjQRYi4hALQWNBVA24SAPn0+Ax1qLugwQJSJei4gACgIqgApCKwAKgj3ACwIHSdCNICrAUEXg4A+Ax2CLmQwQBeAti5DF4KtASAALAhBD5uSLmQwKgIDHJsunDAgAKoHAxysA60Kii4gACoIqAAsCKkADzCtBS0I6j6tAIcwAxgBPqoALQj2AEA5iYAwjjH0JoYxIACsACEAsQC5Lv8wQANDPoTBLgowKAIDGM4uQGyIAx3OLiEAMQggAKoA/zoDGQQvSUmB3C4KMEBJgeUu9jBDSYDULkNJUEeAsgBAOYQDGQcvIQAyEAcvQE1ACYMoCKsA6j6oAEEeg6kAKAj2ACkIQh6EhzEgAKsAIQCzAEDch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCMMnQHWMdwiqACgGAx2ZLysIKQYDGcIvAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRi0LyAAEhJA/4aoAKkBKginAKoKJxydL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHMovIQhBY4oDNLc0DTQlNLE0YTRBNDc0ATQhNAA0QwCAPDRBAUAAQFegIgANCCAA3AAhAA4IIADdACIAjQHYMCEAjgADECEAOg0gAN4A3wEgAI4fGiggAN8KIABeCOAAXwjeAGAEIQC6AAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABcCCIAjQAgAF0IQFBAr6EhADkIAx25Aw8wIQA2AgMYbyyIMIoAcjA2BwMYigqCAIEo0yjrKP8oJSkCLKgrHywrLG8sbyxJKeIpeCrgKogwIQA6BUB/kgg6Ax2QKBswIQC5AAYwIQC2AHEsADAhADoEAxlxLH8whzHDJ4gxQJCCdwjcAF0EQAqAMzBCHoMDOgMdrCgBMEEbgCIwQguDAjoDHbgoAjBBC4ARMEILgwE6Ax3HKA0wQDaAAzBBDoBEMEIOg0A6Ax1xLAcwQkKL9gBtMPcAADCGMUAmiDEhADEQIQC0FjQVQz+AMzpAR4ghALYBcSwBMPYAIQAlCPcAJghBGENHgCI6QxOAfjBAaYCJMUC6QGmJ3wAAMPcAXwiDJAYwIABfAgMYGilBroMaKREwuQAEMEBHQ2GAETpDJYB4MEUlQFmCXAj3AF4IQECAiTFBI4M+KQ0wuQAFMEsjgSEANBZAbEDAjTcCAxh6KSEAOBxcKYUwIQCxANEwIQCyAGIpYTBABoAZMEAGggMQIQA4DEAjjOo+3ACHMAMYAT7eAFwI9gBeCPcAgDCOMfQmQEuJ3wAhALMA2ykEMPcAIQA4CI8xIydAC4jcAN4BXAjAPtwAXggDGF4Pjj5KHoCxAFAdgtwKAxneCkkggLIAUCCCAjDcBwMYSiGEswBuMCEAuQAMMECihXEsADAhADkEAx3qKUGggIgwQquDgDoDHfYpBzBBE4AiMEILhCA6Ax0XKiEAuApCsogMKhMwIQA4AgMcEyq4ARMqDTBBBoM1KrgBNSoLMEEgQ9iEEDoDHUgqIQC4A0IggC4qQiCDRCoSMLgARCpDIYEMMLgAQHmFBjoDHT0quAq4CkQqQAeEBzoDHUQq/jC4B0IwgEQwQjCDQDoDHXEsEzBAloA3CECWgIoxQAtAG4QgANwHXAiHMcMnQAmD4wB3COIAIABAloQgAGII9wBjCMMkQgtBlUBFQC9CVoSUKiEAOByKKgAwQxmEhjFAJoox2SoBMEcJRNpBQ0fagAMwSNpAFoTfAAUwXwIDGMIqSC2BIABfCECEgNAqQAxALYQAMPcAXAiDJNkqR09BZ4AOMEFnS4+HIQA5CAMd9CohALYBcSyIMEGrg94AgDoDHQArQreZIQC6HhYrIADiCgMZ4wpjCIA+fT4DHQ4r6TBiAgMcLCsJMCAA4gcDGOMKLCshADoeQyv/MEAIgQMc4wNCFoAlK0IWgPcwQg1KxoYfMCgAHQIDHD8r+DCdB0LKQvqA3gBA+oCkK0BoggY6Ax2WK0BmgAw6QARAhECLh3gwhzGGJ4sxIQCrAawBIABAQoaAPgMdaCsGMGICAxiWK0GigN4AQI2AXghAjICLMUDBgYcxwydAG4emAHcIpQAlCPYAJgj3AHIwQSeCIADfCl8IQRFAFoJ3CN4AXwRAPIMGMCAA4gDjAUArgvYAYwj3AEBuQRpCo4n6MCgAnQBxLAAwIQA5BAMd4St/MEIlkN4AdwjcAN8AXwgAMAMZATDcAOAA4QHgG+EDYAj2AGEI9wBAFUFBj18IAxnUKyIADBAMEowSKAAXESAAkxDeKzwwIQCvALABQAODrQCuASgAFxVF7IncAIg6AxlxLNwBIwAeH+8rIADcCkBTQTmK3wDcAFwMAxj7KyMAHhMDHP8rIwAeF0EgQKyNIQArCPcALAiGMUAmjDEhADkIAx0ULA0wuQADMEBwgBEwQjKAETpAMkEcgQEw9wBA1YSDJG4wIQC5AAgwQYZBgoEDGTgsQ06CgDoDHTssQRuAIjBCCokgOgMdTSwhALcKBzA3AgMYtwEHMEEhQziEEDoDHWEsIQC3A0ARgwMcXSwGMLcAQhOARDBCE4FAOgMdQEyAuAFCykA2gSEANghBgUARk98AXwwDGH4sIACZEwMcgiwgAJkXCAAgAMwAdwjLACEANBa0FjQVtBRA+ZdMAgMYqiwZMCEAsQDdMCEAsgAgAEwI6j7MAIcwAxgBPs4ATAj2AE4I9wCAMI4x9CZAm4ezAMIsADAgAEsEAxm5LGEwQB2ACTBAHYDJMEEOQAOBsQDRMEAJgP8wQAlAP8DTAHcI0gB2CNQA1QHWAecw1wADMNgAcjBUAgMY6SxUCNkAEzAgAFkCAxzdLO0w2QfVLCAAWRhoLXAw1QD+MNYAeDDXAAUw2ABoLY4wIADUBwQw9wBUCI8xIyeMMSAA2QDaAVkIwD7UAI4w2wBaCAMYWg/bBwMw1AcDGNsKVAj2AFsIQmKAjTFAF4JZCAMdGC1HLosgAFkIAToDHSUtzjDVAP8w1gAyMNcA2AFBDIMJOgMdLi0BMEMIggI6Ax03LUQRgwM6Ax1ALfowQwiCBDoDHU4tQjWCkDDXAAEwQjWDBToDHVctCDBDFoMGOgMdYC08MEMIgwc6Ax1oLQYwQAiMIABXCPMAWAj0AFUI9QBWCPYAUgj3AFMIfCVCsUAGQ/iZdgjOAHUIzQB0CNAAcwjPAFAIgD7RAEwIgD5RAgMdki1LCE8CAxiZLSAATQj3AE4Iry0gAEAOgdEATghBEYikLU0ISwIDGKstIABPCPcAUAhAEYZLCPcATAgIADAw9gCOMECtgY8xBidArZ3lAHcI5AAyMOYAjjDnACAAZAjoAGUI6QD/MOQHAxzlA2gIaQQDGS0uBDBmB+gA6QHpDWcI6QdoCPYAaQhEI4XrAHcI6gBmCPYAZwhEC4XtAOkAdwjsAOgAAjBNIJTpAO8AdwjoAO4AIABqCO4AawjvAP8w6gcDHOsDbghvBAMZJy5sCPYAbQhAGqWOMfQmjjEgAO4AaAiEAGkIhQBuCIAA7AoDGe0K6AoDGekKAy4GMCAA5gcDGOcKwC2AMUIoCAANNAA0AzQANLQ0ADQBNAA0/jQHNLU0QQWI9DQHNKc0ADQCNAA09jQHNKk0QQWC+DQHNKs0QQWC+jQHNK00QQWC/DQHNK80QQWC/zQHNLY0QSOCQjQPNLc0QQWCQzQPNLg0QQWCRDQPNLk0QQWCRTQPNLo0QQWCRjQPNLs0QQVAAJkaNP40nTT+NPI0/jQzNP80aTT/NJg0/zTDNP806zT/NBA0ADQzNAA0VTQANHc0ADSYNAA0QDGA2TRAT6YANBw0ATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNGE0GTT/NAA00TShNP80AjRAA4UNNAM0yTTNNP80ATRAA5INNAE0YTQRNP80BDRhNMk0/zQFNIU00TT/NAg0zTSFNP80BjTRNEEDgN00QCeGCTQZNME0DTQJNN001TRAlZEAOgMZ+y6AOgMZAS8ANHYIhAB3CIUAAAgIAHcIigB2CIIACABAEYAOL0ARgRYv9wFDEoESAPcAQBSFjzEBJ/UA9g/3A/cKQAWj9AB1CPcAdAgIACEAoAB3CKEAogEIMKMAIQAgHC8vIQiiByEAIAikAAMQJAygAAMQIQ2kAKEAIwikACQDowAjCAMdKi8iCAgAQcJAAAEBAgAOgdQP/zoA",
+	"hex_fahrenheit":"AQACAACrAACNMbEt/zSKASAAkRxBKAMQIgANDSAAvQA9CAMdEigQML0AIQCOASIAjQEgAD0IEDoDGSgoPQggOgMZLSg9CEA6AxkyKD0IgDoDGTcoOyghADEIIgCOAEAEgDIIQgSAMwhCBIA0CEAEQCSWIgCNACAAkRAJACAAvgG/AcABgDDBAMIBgDDDAGowIQCZAA4wjAAiAIwBIQCNAUA/QEPcBjAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzDDJyAApwB3CKkAqAAoDAMYdigoABcRAxx6KCgAFxX6MCgAlgA3MJ4A+jCdAHIwwychAKYAdwilAMAwIACLAAkwIQCdACAAkx2jKIgxACCAMSgAFxmhKP8wIQC0AAMwIQCxAFkwIQCzACEAsgAgAJMRIACTHCUtIAC+CgMZvwo+HLgoQAj3AEEIAiYgAMEAdwjAAAUwQCmExCggAEII9wBDCEAMgsMAdwjCAEI2gz4IDzkDHSMtQQ+FKCUgAMUAdwjEAHYwQGayxwB3CMYARAjIAEUIyQBGCEgHIQCpACAASQghAKoAIABHCAMYRwoDGesoIQCqByAAxAEhADUc8iggAMQKIADFASEAtRz5KCAAxQogAEUIxgDEBUQMAxgCKSEANRADHAYpIQA1FCAAQVpDPYB1MEo9gKcAQT2AqABDPYIpKSEAqAdAO4UvKSIADBQxKSIADBBAMIG1EH0wQCRBKotFBAMZPykhALUUIgAMHFwpIACZH1ApETBAq4DLMECpQLRAroe0ACIADBKMEjwwIQCvALABQAODrQCuASMtfjBDJ4/GAAYwRgIDGIcqIQA0EwMwIAA/AgMdcCnoMD4CAxyMKkEViKwAdwitAK4ABjAuAgMYgip4MEMKmq8AIQCrCgMZrAoJMCAALwIDHI8pCDCvABMw9wAgAC4IjzEkJ4ExIACtAAMQLw2uAK0HLQqsAEAfha4AdwisAAIwLQewAEAHlbEAdwiwAC4IIQAsAgMdtCkgACwIIQArAgMc6ykgADAIIQClACAAMQghAKYAQAeM9gAxCPcAcjCGJyAALwgIOgMZ1SkDMC0HsgBAJpmzAHcIsgAzBAMd3CkGMPYAADD3AH4whieCKiEAqwGsASAArwovCLIAswEyCPYAMwj3AHgwQA6AfDBAHoayAHcIrwAyBAMZgiotCEAIgK8AQHaCIQAsDvA5QC6BIQArDkAThQ85swSyBgMQsg2zDUEChSAwtAC1AbYBtwG4AUCAhjMCAx0ZKiwIMgIDHDoqQGqgsgIuCAMcLg+zAjAIuQAxCLoAADC6G/8wvAC7ADkItAc6CAMYOg+1BzsIAxg7D7YHPAgDGDwPtwdSKiAALQi5AC8IUhihIAC4CkAwOAIDHBIqNA4PObQANQ61APA5tAS1BjYOtgDwObUEtgY3DrcA8Dm2BLcG8DC3GbcEAxC3GwMUtwy2DLUMtAxFBoA0CEHDgDUIQMOKCDAgAL4AvwGMKiEANBcgAL4BvwF3MECXoMUAdwjEAEUEAxn0KiEAJQghACcCIADGACEAJggDHCYKIQAoAiAAxwADFMcfAxADHK0qxgnHCcYKAxnHCgMUIADFH0AKpNYqxAnFCcQKAxnFCkUIgD7KAEcIgD5KAgMdwipGCEQCIADIAQMcSBRICAAwAxkBMMkAyABIDAMY0SoiAAwQAxzVKiIADBT0KiAAQBuAygBAIUAeguEqRAhGAkYegMQAQR6A8CpBHoD0KkAegHQwQGedpwB3CKkAIQAtCC4EAxkDK/8wrQcDHK4DIQAvCDAEAxkMK/8wrwcDHLADIACoASIADB4TKyAAqAogACgIQS6KqwCoACgMAxgfKyEAtBMDHCMrIQC0F0EWgYweKitJFoY2KyEAtBEDHDorIQC0FUArgG4rQKGEgD4gAKoAIQAoCEAEjSoCAx1NKyEAJwghACUCAxikKyEAtRxuKyAAKQhACIogAKgAJwgDHCcKIQAmAiAAqwAhACoIQSGBKwiAPkAfhWwrKAghACkCAxykK0BIgAIsQi5AM0E4QBOAgStC50IzgAIsQTOAJQdAM0AVQDCDJwgDGCcPqwdAL0AgQTdAIIeiKyEAKQggACgCAxgCLHowQK+QqwB3CKgAKw7wOSEArgAgACgOIQCtAA85rgStBgMQrQ2uDUECgS0ODzlBMoAuDkAagvA5qASrBkBcia0CIAArCAMcKwoDGdErIQCuAnswRiyAsABBLIavAA85sASvBgMQrw2wDUECgC8OQiyAMA5FLICvAkMsjP4rIQCwAiIADBKMEtAsIgAMGtAsjBrQLHMwQzWEAxCnGwMUpwypDEMEQCNAj0GliCAArAArCAMYKw+sBywIgD6tAEK1gi0CAx0yLEDkQJWBAxhzLECwgFMsQ+SAqgBE5ICsAEKsgK0AQCRAH4FRLCoIQeRAHootCC4EAxlwLCAAqgEhALQfXywgAKoKQAuAATlAH4qtAKoGKgwDGGssIQC0EwMcbywhALQXQG2CDBbQLCAAQFxAO4CoAEGBQTuAqwBCWICuAEDwgi4CAx2NLEAVgicCAxjQLEBagLEsQVpAe4CpAEB7iQMYJgoDGaAsIACnByAAJwiAPq4AQl9AIIOvLCEAKQggAEBdQCGKLwgwBAMZziwgAKkBIQC0Hb0sIACpCkALQF2LpwCoAKkGKQwDGMksIQC0EQMczSwhALQVQF2qjBYgAJkfIy0iAAwc4ywjAB0f4yxhMCEAsQARMCEAsgD/MCEAswAMLSAAxAEjAB4f6iwgAMQKIABECAAwAxkBMMYAxABEDAMY9iwhALQQAxz6LCEAtBRAFIIFLQEw9gBAU4P3ACoIQCYMLUEHgycI9wAoCEAmQSiBHR8TLUkoqB8tIwAdEwMcIy0jAB0XIACTEGQAjSgIACAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxhdLQkwQAOLXy0hADUUIAAoCqEAAjD3ACEIjzEkJ4UxQD+JpQEgCIE+oACOMKEAJQgDGCUPoQdAEYAoCEIRQSmHgT6lACcIAxgnD44+pwCoAUDzhCgCAxyuLSUI9gBAhIKAMI8xBydAGJ2rAHcIqgCsACsIrQAAMK0b/zCuAK8ALAiiBy0IAxgtD6MHLwgDGC8PpAcuCAMYLg+mB9EtIAAgCPYAIQhdI4IgAKgKQDBAS46GLSIODzmhACMOoADwOaEEoAYkDqUA8DmgBKUGJg5Cr4XwMKcZpwQDEKcbAxRApYGgDKEMRQaGIQiiACAIowAiCPcAIwhD2YYhAJ0UIQCdGAguHRAgAEDbiKIAIA6jAPA5ogSjBgMQowyiDEECiCIIoQIjCAMcIw+gAiEAHAggAED2hCIIpACmASEAGwhCB4WmBCMIpAQmCKIAJAhAN4ShByMIAxgjD6AHQIqAIAhAPaCpAHcIqAB2CKsAAxSpHwMQAxxULiEANBIgAKgJqQmoCgMZqQpWLiEANBYgACsIAToDHV8uIQC0EjQVYi4hALQWNBVA24SAPn0+Ax1qLugwQJSJei4gACgIqgApCKwAKgj3ACwIHSdCNICrAUEXg4A+Ax2CLmQwQBeAti5DF4KtASAALAhBD5uSLmQwKgIDHJsunDAgAKoHAxysA60Kii4gACoIqAAsCKkADzCtBS0I6j6tAIcwAxgBPqoALQj2AEA5iYAwjjH1JoYxIACsACEAsQC5Lv8wQANDPoTBLgowKAIDGM4uQGyIAx3OLiEAMQggAKoA/zoDGQQvSUmB3C4KMEBJgeUu9jBDSYDULkNJUEeAsgBAOYQDGQcvIQAyEAcvQE1ACYMoCKsA6j6oAEEeg6kAKAj2ACkIQh6EhzEgAKsAIQCzAEDch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCMMnQHWMdwiqACgGAx2ZLysIKQYDGcIvAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRi0LyAAEhJA/4aoAKkBKginAKoKJxydL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHMovIQhBY4oDNLc0DTQlNLE0YTRBNDc0ATQhNAA0QwCAPDRBAUAAQFegIgANCCAA3AAhAA4IIADdACIAjQHYMCEAjgADECEAOg0gAN4A3wEgAI4fGiggAN8KIABeCOAAXwjeAGAEIQC6AAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABcCCIAjQAgAF0IQFBAr6EhADkIAx25Aw8wIQA2AgMYbyyIMIoAcjA2BwMYigqCAIEo0yjrKP8oJSkCLKgrHywrLG8sbyxJKeIpeCrgKogwIQA6BUB/kgg6Ax2QKBswIQC5AAYwIQC2AHEsADAhADoEAxlxLH8whzHDJ4gxQJCCdwjcAF0EQAqAMzBCHoMDOgMdrCgBMEEbgCIwQguDAjoDHbgoAjBBC4ARMEILgwE6Ax3HKA0wQDaAAzBBDoBEMEIOg0A6Ax1xLAcwQkKL9gBtMPcAADCGMUAmiDEhADEQIQC0FjQVQz+AMzpAR4ghALYBcSwBMPYAIQAlCPcAJghBGENHgCI6QxOAfjBAaYCJMUC6QGmJ3wAAMPcAXwiDJAYwIABfAgMYGilBroMaKREwuQAEMEBHQ2GAETpDJYB4MEUlQFmCXAj3AF4IQECAiTFBI4M+KQ0wuQAFMEsjgSEANBZAbEDAjTcCAxh6KSEAOBxcKYUwIQCxANEwIQCyAGIpYTBABoAZMEAGggMQIQA4DEAjjOo+3ACHMAMYAT7eAFwI9gBeCPcAgDCOMfUmQEuJ3wAhALMA2ykEMPcAIQA4CI8xJCdAC4jcAN4BXAjBPtwAXggDGF4Pjj5KHoCxAFAdgtwKAxneCkkggLIAUCCCAjDcBwMYSiGEswBuMCEAuQAMMECihXEsADAhADkEAx3qKUGggIgwQquDgDoDHfYpBzBBE4AiMEILhCA6Ax0XKiEAuApCsogMKhMwIQA4AgMcEyq4ARMqDTBBBoM1KrgBNSoLMEEgQ9iEEDoDHUgqIQC4A0IggC4qQiCDRCoSMLgARCpDIYEMMLgAQHmFBjoDHT0quAq4CkQqQAeEBzoDHUQq/jC4B0IwgEQwQjCDQDoDHXEsEzBAloA3CECWgIoxQAtAG4QgANwHXAiHMcMnQAmD4wB3COIAIABAloQgAGII9wBjCMMkQgtBlUBFQC9CVoSUKiEAOByKKgAwQxmEhjFAJoox2SoBMEcJRNpBQ0fagAMwSNpAFoTfAAUwXwIDGMIqSC2BIABfCECEgNAqQAxALYQAMPcAXAiDJNkqR09BZ4AOMEFnS4+HIQA5CAMd9CohALYBcSyIMEGrg94AgDoDHQArQreZIQC6HhYrIADiCgMZ4wpjCIA+fT4DHQ4r6TBiAgMcLCsJMCAA4gcDGOMKLCshADoeQyv/MEAIgQMc4wNCFoAlK0IWgPcwQg1KxoYfMCgAHQIDHD8r+DCdB0LKQvqA3gBA+oCkK0BoggY6Ax2WK0BmgAw6QARAhECLh3gwhzGGJ4sxIQCrAawBIABAQoaAPgMdaCsGMGICAxiWK0GigN4AQI2AXghAjICLMUDBgYcxwydAG4emAHcIpQAlCPYAJgj3AHIwQSeCIADfCl8IQRFAFoJ3CN4AXwRAPIMGMCAA4gDjAUArgvYAYwj3AEBuQRpCo4n6MCgAnQBxLAAwIQA5BAMd4St/MEIlkN4AdwjcAN8AXwgAMAMZATDcAOAA4QHgG+EDYAj2AGEI9wBAFUFBj18IAxnUKyIADBAMEowSKAAXESAAkxDeKzwwIQCvALABQAODrQCuASgAFxVF7IncAIg6AxlxLNwBIwAeH+8rIADcCkBTQTmK3wDcAFwMAxj7KyMAHhMDHP8rIwAeF0EgQKyNIQArCPcALAiGMUAmjDEhADkIAx0ULA0wuQADMEBwgBEwQjKAETpAMkEcgQEw9wBA1YSDJG4wIQC5AAgwQYZBgoEDGTgsQ06CgDoDHTssQRuAIjBCCokgOgMdTSwhALcKBzA3AgMYtwEHMEEhQziEEDoDHWEsIQC3A0ARgwMcXSwGMLcAQhOARDBCE4FAOgMdQEyAuAFCykA2gSEANghBgUARk98AXwwDGH4sIACZEwMcgiwgAJkXCAAgAMwAdwjLACEANBa0FjQVtBRA+ZdMAgMYqiwZMCEAsQDdMCEAsgAgAEwI6j7MAIcwAxgBPs4ATAj2AE4I9wCAMI4x9SZAm4ezAMIsADAgAEsEAxm5LGEwQB2ACTBAHYDJMEEOQAOBsQDRMEAJgP8wQAlAP8DTAHcI0gB2CNQA1QHWAecw1wADMNgAcjBUAgMY6SxUCNkAEzAgAFkCAxzdLO0w2QfVLCAAWRhpLXAw1QD+MNYAxDDXAAkw2ABpLY4wIADUBwQw9wBUCI8xJCeMMSAA2QDaAVkIwT7UAI4w2wBaCAMYWg/bBwMw1AcDGNsKVAj2AFsIQmKAjTFAF4JZCAMdGC1HLosgAFkIAToDHSUtnDDVAP8w1gBkMNcA2AFBDIMJOgMdLi0BMEMIggI6Ax03LUQRhQM6Ax1BLfQw1wABMEIohwQ6Ax1PLeAw1QD8MNYAIDBBfkENgwU6Ax1YLQgwQyCDBjoDHWEtPDBDCIMHOgMdaS0GMEAIjCAAVwjzAFgI9ABVCPUAVgj2AFII9wBTCH0lQrJABkP5mXYIzgB1CM0AdAjQAHMIzwBQCIA+0QBMCIA+UQIDHZMtSwhPAgMYmi0gAE0I9wBOCLAtIABADoHRAE4IQRGIpS1NCEsCAxisLSAATwj3AFAIQBGGSwj3AEwICAAxMPYAjjBAroGPMQcnQK6d5QB3COQAMzDmAI4w5wAgAGQI6ABlCOkA/zDkBwMc5QNoCGkEAxkuLgQwZgfoAOkB6Q1nCOkHaAj2AGkIRCOF6wB3COoAZgj2AGcIRAuF7QDpAHcI7ADoAAIwTSCU6QDvAHcI6ADuACAAagjuAGsI7wD/MOoHAxzrA24IbwQDGSgubAj2AG0IQBqljjH1Jo4xIADuAGgIhABpCIUAbgiAAOwKAxntCugKAxnpCgQuBjAgAOYHAxjnCsEtgDFCKAgADTQANAM0ADS0NAA0ATQANP40BzS1NEEFiPQ0BzSnNAA0AjQANPY0BzSpNEEFgvg0BzSrNEEFgvo0BzStNEEFgvw0BzSvNEEFgv80BzS2NEEjgkM0DzS3NEEFgkQ0DzS4NEEFgkU0DzS5NEEFgkY0DzS6NEEFgkc0DzS7NEEFQADF1TT9NME0/jRZNP80zzT/NDA0ADSGNAA00zQANBo0ATRcNAE0nDQBNNo0ATQWNAI0UTQCNIw0AjTHNAI0AjQDND80AzR9NAM0vTQDNAE0BDRINAQ0lDQENOU0BDQ/NAU0pDQFNBc0BjSeNAY0RDQHNB40CDRdNAk0qzQLNGE0GTT/NAA00TShNP80AjRAA4UNNAM0yTTNNP80ATRAA5INNAE0YTQRNP80BDRhNMk0/zQFNIU00TT/NAg0zTSFNP80BjTRNEEDgN00QCeGCTQZNME0DTQJNN001TRAlZEAOgMZ/C6AOgMZAi8ANHYIhAB3CIUAAAgIAHcIigB2CIIACABAEYAPL0ARgRcv9wFDEoESAPcAQBSFjzECJ/UA9g/3A/cKQAWj9AB1CPcAdAgIACEAoAB3CKEAogEIMKMAIQAgHDAvIQiiByEAIAikAAMQJAygAAMQIQ2kAKEAIwikACQDowAjCAMdKy8iCAgAQcJAAAEBAgAOgdQP/zoA",
+});
@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_ovbsc", {
+	"hex_celsius":"AQACAACrAACNMZ4t/zSKASAAkRxGKAMQIgANDSAAvQA9CAMdEigQML0AIQCOASIAjQEgAD0IEDoDGSgoPQggOgMZLSg9CEA6AxkyKD0IgDoDGTcoOyghAC8IIgCOAEAEgDAIQgSAMQhCBIA1CEAEQCSpIgCNAAAwIQA6BAMdugMgAJEQCQAgAL4BvwHAAYAwwQATIgkwIQCdACAAkx1nKIgxACCAMSgAFxllKP8wIQC1AAMwIQCvAFkwIQCxACEAsAAgAJMRQieadSgcMMwnIADDAHcIwgAhALoAZCUgAJMc+CggAL4KAxm/Cj4ciShACPcAQQjVISAAwQB3CMAAQjeDPggPOQMd9ihBD4D7IEIjgBkwQCmkxQB3CMQAQgjGAEMIxwBECEYHIQClACAARwghAKYAIABFCAMYRQoDGbAoIQCmBz8iQiUgAJkf6SgiABMeziggAD4ezighADIIIABATIKvACEAMwhBBYKwACEANAhBBYCxAEAYkxEe4ighADgICToDGdooOAgBOgMd4igAMPYAIQAtCPcALghJJukoATBAB7IlCPcAJghJJgMwIAA/AgMd8CjoMD4CAxz2KAgwIAC+AL8BIACTEGQAUSgIACAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOrADwOaUErAYDEKwMpQw/MKUFrAElCK4AAxAgDKUArAFBC0ECgB8wQQ6BrQAgCEANhiUIoQD4MCECAxgwKQkwQAOLMikhADYUIAAtCqEAAjD3ACEIjjHvJoExQD+JpQEgCIA+oACOMKEAJQgDGCUPoQdAEYAtCEIRQSmTgD6lACwIAxgsD44+rACtASAALggtAgMcgSklCPYALAj3AIAwjjHSJkAYna8AdwiwALEALwiyAAAwshv/MLMAtAAxCKIHMggDGDIPowc0CAMYNA+kBzMIAxgzD6YHpCkgACAI9gAhCF0jgiAArQpAMEBLjlkpIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwrBmsBAMQrBsDFEClgaAMoQxFBoYhCKIAIAijACII9wAjCEPZhiEAnRQhAJ0Y2ykdECAAQNuIogAgDqMA8DmiBKMGAxCjDKIMQQKIIgihAiMIAxwjD6ACIQAcCCAAQPaEIgikAKYBIQAbCEIHhaYEIwikBCYIogAkCEA3hKEHIwgDGCMPoAdAiusgCAgAajAhAJkADDCMACIAjAEkAIwQIQCNASIAjQEhAI4BBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAFxX6MJYANzCeAPownQDAMCAAiwAIACIAER1FKiEAuAFBLSIAkRxJKkEtIQAtCC4EAxlbKiAASggDHVkqPDDKAP8wIQCtBwMcrgMgAMoDCjAhADgCAxhBLYIwigBnMDgHAxiKCoIAcSqlKroqHytKK64rBiwvLHMsnCwiABEefioAMMwnIQCuAHcIrQABMCEAuABAOIKTHI4qHzBADIOoAHcIpwAdMEAFg6wAdwirAJQqQQaFqgB3CKkAHjDMJyAAQAyKrgCtAC0MAxigKiIAERADHKQqIgARFEBbhKkBqgEiAJMQERBBYYIDHUEtIDBDO4ACMEE7gAEwQziAAjBDMYAbMEMxhQE5rQCuAC4MAxjUKkEzgNgqQDOGIQAmCIA+IACvACEAKAhABIsvAgMd6CohACcIIQAlAgMcFysiAJMUDzBDZIAaMEArgK0AQSuAsABBK4wAKyIAExIDHAQrIgATFmEwIQCyAMkwIQCzAEC1gLQARFyAAzBBXENrgSIAERVAAoETGkIrQS+AsABAL4MCOQMdATCxAEExiDIrIgCREAMcNisiAJEUIQC5AUQqgAQwSSqHAxAhADkNIACuAAMwrgcuCEmWQLRBmICxAEM8gLIAQTyAbytBmoBzK0uagIMrQpqBAxiVK0M6gAQwQTqBIACyAEAsgjIEAx2mK0cPQmOABTBKjkXDQVZBKYAEOUBWgLMAQVaAxitBVoDKK0FWQiOFIQC5CgYwOQIDGN8rSJxBvICzAEMogLQAQSiA7ytB7oDzK0DugMEwQO6AgzBJ7oAGMEEmQOaAJyxBKYC0AEApgAg5QCmAtQBBKYAZLEHmgB0sQOZEIIAHMEqAQtGAtQBDJ4C2AEEngEEsQXqARSxAekTtgBAwQBmAtgBAGYMhACUIIAC3AEDhQOCANghA3YVfLC4INwIDHGssEjBDQ4AIMElDgBEwQy1BR0EtgBA5QEeAtwBBR4CJLEFHgI0sRcKAFDBDMIAJMEKVgREQEzBDKoYgAK4BtwEVMCAANwevAEAwirgAdwivACEALQYDHQ4tIAA4CCEALgZABYQ6MCAASgIDHA4tQbVBFJsuCLkAugEEMLkHAxi6CjgIvAAvCLsAOQi5G90sADwDGeQsIAC8DLsMAT4DHNYs5CwDECAAuw28DUAHiN4sIAA7CAE5rwC7ADsMAxjuLEH+gPIsQP6A0TBA/oCFMED+miAALgqvAPM+rwCHMAMYAT65AC8I9gA5CPcAgDCOMcAmhTEgALoAIQC0ABYtIAC3CjcIrgAEMEC0gKcsQ4iCIQCpAaoBQO6AERVBYYC3AECngDcIQEFBpoAwLUFBgDQtQEGASzBAQUBEgbMA/zBAL4ciABESIQC4AQgAIgCTHGMtQO+EgD4gAKAAIQAoCEAEjiACAx1VLSEAJwghACUCAxhgLSEAKwghAKkAIQAsCEC8QBpARI0IACEANwgDHYEtZDC3AAMUIQCqHwMQAxx7LSkIQCiIIAkgAMgAyAoBMCAAyQCBLSEAQAuWyAAgAMkBIQC3AyIADBAhALUUIgATHpwtTDAhADcCIACgAaANIAihACEMAxiXLUARiQMcmy0iAAwUsC0iAJEcsC0RGbAtQDyAATlAMkEUg6wtIQC1EAMcQAxAKI2RGLUtER29LSIAjBIMEiEAjBAiAIwQGi4gAEgIQjOBAxwgFEAjhiAAoQCiAWQwoQcDGKIKQBCYIACjAKQBIgiAPqYAJAiAPiYCAx3dLSMIIQIgAKYBAxwmFCAASQgDGfotIAAmDAMY6y1AM44DHO8tIgCMFiAAIAwDGPUtIgAMEgMc+S0iAAwWDi5BCoAALkEUgAQuQRRAHoAKLkEUgA4uQBSEIgARHBYuIQCMFEFYQl1AWIsiAIweIS4gAKAKIAAgCAAwAxkBMKEAoABALIYtLiEAtREDHDEuIQC1FUEWgQweOC5JFo9ELiEAtRMDHEguIQC1FwgAIACuAHcIrQB2CK8AAxSuH0Djql0uIQA1EiAArQmuCa0KAxmuCl8uIQA1FiAALwgBOgMdaC4hALUSNRFrLiEAtRY1FSAALgiAPn0+Ax1zLugwLQIDHIMuIAAtCLAALgixADAI9wAxCCYnQjSArwFBF4OAPgMdiy5kMEAXgL8uQxeCsgEgADEIQQ+bmy5kMDACAxykLpwwIACwBwMcsQOyCpMuIAAwCK0AMQiuAA8wsgUyCPM+sgCHMAMYAT6wADII9gBAOYmAMI4xwCaGMSAAsQAhAK8Awi7/MEADQz6Eyi4KMC0CAxjXLkBsiAMd1y4hAC8IIACwAP86AxkNL0lJgeUuCjBASYHuLvYwQ0mA3S5DSUxHgIcxQUeAsABAOYQDGRAvIQAwEBAvQE1ACYMtCK8A8z6tAEEeg64ALQj2AC4IRB6CrwAhALEAQNyHoAB3CKEAAxAgDKIAIQyjAEAEk6QAIQymAAMQpAymDCYIowckCAMYJA+iByMODzmmACIOpADwOaYEpAZEDYIiCKYApAFECIIDEKIMowxFAoYjDaYAIg2kAAMQpg2kDUIClCMNpQAiDawAJQimBywIAxgsD6QHJgihAiQIAxwkD6ACBjChBwMYoAohDkA/gCAOSD+CIwj3ACIIQGi6pwB3CKkAdgioACcIzCcgAKsAdwiqACgGAx2iLysIKQYDGcsvAxAgACcNqgAgACoIIwCRACAAKAgjAJMAFROVExUVIACLE1UwIwCWAKowlgCVFCAAixcjABURIwCVGL0vIAASEiAAKQioAKkBKginAKoKJxymL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHNMvIQhBY4oDNLc0DTQlNLE0YTRBNDc0ATQhNAA0QABATqAiAA0IIADcACEADgggAN0AIgCNAdgwIQCOAAMQIQA+DSAA3gDfASAAjh8aKCAA3wogAF4I4ABfCN4AYAQhAL4AAxBDEYEOHiwoThGBDh8+KE4RgY4dUChIEYUgAFwIIgCNACAAXQhAUECmqiEAPQgDHb0DCTAhADsCAxgGLYgwigByMDsHAxiKCoIAeyjcKPQoNCkTKjAqmioIK5wrIgATHoooIQA+CA85Ax2KKD4I8DkDGYooIgATEggtiDAhAD4FQIiIgDoDHako3AEiAJEcmCggANwKQD+PADADGQEw3QDcAFwMAxikKCIAkRADHKgoIgCRFAgtMzBCHocDOgMdtSgBMCEAuwAILSIwQguDAjoDHcEoAjBBC4ARMEILhgE6Ax3QKA0wIQC9AAMwQQ6ARDBCDoNAOgMdCC0FMEELjAAw9gBtMPcAADCGMUkmiDEhAC8QIQC1FjUVQz+IMzoDGQgtIQC7AQgtIgARHQMpQCqJrwBZMCEAsAAhALEA/zAhALUAKSlAb4ETKRkwQA6AYTBADoBJMEUPh5McICkBMPYAIQAnCPcAKAhAOoGJMSkpQEODIQApCPcAKghBCUNzgCI6RT+AQylJP4PxKSIAER7XKUAGgLEAQAiBIQA4CECGgFcpQEaBrwCFMEAYgPEpQAtAnoBjKUELgMkwQwuCBDoDHYspQWGAgzBBMIA5CEBDld0B3AoDGd0KXAjzPtwAXQgDGF0Phz7dAFwI9gBdCPcAgDCOMcAmiTEgAN4AQEBBJ4IFOgMdsylASYCvAEAqXieDBzoDHb8pwTBDT0ELgwg6Ax3LKZEwQAtADkILggk6Ax3xKUEXQEJAC0DDgeYpSzBDfUOZgPEpQQtAsUQLhgAwIQA9BAMdCCoUML0AQayBAxkFKkBwQAOHCDA4AgMcCCoEMCEAuwARMELegBE6Q95B8oItCPcALghA8oSKMSEAPQgDHSUqQClAOEocoiEAPAggANcAIQA1FrUWNRW1FCEwIABXAgMYiioEMPcAVwiOMe8mijEgANgA2QFYCBo+1wCNMNoAWQgDGFkP2gdXCPYAWghCqUATgNsAQHKAIABAFYDYAEETh40+2QABMFgH1wDaAdoNWQhKG4iwAAIwIADYBwMY2QpYCPYAWQhEEEBSgrEAkyrdMEPRgNUwQAmDbjAhAL0ABjBAc0CGQaiAoipBcYCIMEJ8goA6Ax2tKkEKgCIwQgqJIDoDHb8qIQC8CiIwPAIDGLwBBTBBJEOZhBA6Ax3TKiEAvANAEYMDHM8qITC8AEITgEQwQhOEQDoDHQgtITAhAEAkg+kqPAiHMcwnQF6J4gB3COEABCsiABEd8CogAOEB4gFABoQRHvgqATAgAOEAQQeBkxwAK0CCQQeAAzBBBIAHMEE0QiyAUytAzoA8CEDOgIsxQDyP3QFcCBo+3ABdCAMYXQ+NPt0AAzDcBwMY3QpcCPYAXQhCpEAWlN4AAjBeAgMYOisBMPYAIABhCPcAYgiGMUkmizGVKyAAXggDOgMdSSsCMEcOgAAwRwmEIQA1FrUWNRW1FEAMg2IEAx1mKwMwQNKAWTBA0kDRQCuFYQgBOgMdeStiCAA6QAOAGTBAEUDngbAA/zBDEoICOgMdjCtBEoGMK80wQBKAyTBEEkEJQDFCCYNuMCEAvQAIMEGTgSEAPAhAioMhAD0IAx2nK0H5gIgwQdOD3QCAOgMdsytC35khAL4eySsgAOEKAxniCmIIgD59PgMdwSvpMGECAxzfKwkwIADhBwMY4grfKyEAPh68LP8wQAiBAxziA0IWgNgrQhaA9zBCDYAgAEC9QpaTIADOAHcIzQB2CM8A0AHRAecw0gADMNMATwghOgMd+isDMNIA0wFoLEDsgSAATwhA7ZOMMSAA1ADVAVQIGj7PAI0w1gBVCAMYVQ/WBwMwzwcDGNYKTwj2AFYIQu5BF41UCAMdJyxwMNAA/jDRAHgw0gAFMNMAaCwgAFQIQMCFNCzOMNAA/zDRADIwQTlADIMHOgMdPSwBMEMIQMOBSiw4MEEVgMgwQwyFAzoDHVYsCjDQANEBRAuFBDoDHWAs/zDSAAEwQjiDBToDHWgsHzBAEqkgAFII8wBTCPQAUAj1AFEI9gBNCPcATgggANcAdwjYAHYI2QB1CNoAdAjbAHMIywBbCIA+zABXCIA+TAIDHYosWAhLAgMYkSwgAFoI9wBZCKcsIABADoHMAFkIQRGInCxaCFgCAxijLCAASwj3AFsIQBGCWAj3AFcIQsBBOJriAHcI4QAfMCgAHQIDHLgs+DCdBwcwIQC7AAgtRDAhAD4FIADcAEA6Ax0CLSEwIQA8AgMY1CxA5oj2AGII9wAhADwIhzGPJ4wx/ixACodiBAMd3ywiABEVERIREJMQQQpAt4LsLGIIADpAA4IiABERERZBDECugPosQQyA+ixADIIREpMU/ixBBIGTEAUwQUWK+jAoAJ0ACC0hALsBIQA7CAAwAxkBMEBNnt0AXQwDGBUtIACZEwMcGS0gAJkXCABhNIU0/zQGNGE0yTT/NAA0YTQDNP80AjQZNMk0tzQANBk0hTS3NAY0QAeADTRBB4ANNEEHgCU0QQeAJTRBB4CxNEEHgLE0QQeAYTRBB4BhNEEHgEE0QQeAQTRAB0EzgJE0QTuAkTRCB0FHgME0QQeAwTRBB4DRNEFDQANAP0ADQDtAA0A3h8k0zTT/NAE0ETQZNFk0BDRAAoH/NAU0QDeC/zQDNM00QSeIzTQZNP80BzTNNGE0GTQANBE0QICnBjQeMPYAjjD3AIAwjjHSJo0xIADkAHcI4wAgMOUAjjDmACAAYwjnAGQI6AD/MOMHAxzkA2cIaAQDGRsuBDBlB+cA6AHoDWYI6AdnCPYAaAhEI4XqAHcI6QBlCPYAZghEC4XsAOgAdwjrAOcAAjBNIJToAO4AdwjnAO0AIABpCO0AagjuAP8w6QcDHOoDbQhuBAMZFS5rCPYAbAhBGqHAJo4xIADtAGcIhABoCIUAbQiAAOsKAxnsCucKAxnoCvEtBjAgAOUHAxjmCq4tgDFHKAgAEDQANAM0ADS1NAA0ATQANECRgLY0QQWI/TQHNKU0ADQCNAA0DjQPNKc0QQWCEDQPNKk0QQWCEjQPNKs0QQWCFjQPNLc0QR2CFzQPNLg0QQWCFDQPNK00QRGCGDQPNLk0QQuCGTQPNLo0QQWCGjQPNLs0QQWCGzQPNLw0QQWCHDQPNL00QQWCHTQPNL40QQWCHjQPNL80QQVAAI8aNP40nTT+NPI0/jQzNP80aTT/NJg0/zTDNP806zT/NEBzhzM0ADRVNAA0dzQANJg0ADRAT4LZNAA0+jRAM64BND40ATRiNAE0hzQBNK80ATTZNAE0BzQCNDk0AjRwNAI0sDQCNPs0AjRYNAM00TQDNII0BDTKNAU0ADoDGccugDoDGc0uADR2CIQAdwiFAAAICAB3CIoAdgiCAAgAQBGA2i5AEYHiLvcBQxKBEgD3AEAUhY4xzSb1APYP9wP3CkAFo/QAdQj3AHQICAAhAKAAdwihAKIBCDCjACEAIBz7LiEIogchACAIpAADECQMoAADECENpAChACMIpAAkA6MAIwgDHfYuIggIAEGOTAABAQIADoHUD/86AA==",
+	"hex_fahrenheit":"AQACAACrAACNMZ4t/zSKASAAkRxGKAMQIgANDSAAvQA9CAMdEigQML0AIQCOASIAjQEgAD0IEDoDGSgoPQggOgMZLSg9CEA6AxkyKD0IgDoDGTcoOyghAC8IIgCOAEAEgDAIQgSAMQhCBIA1CEAEQCSpIgCNAAAwIQA6BAMdugMgAJEQCQAgAL4BvwHAAYAwwQATIgkwIQCdACAAkx1nKIgxACCAMSgAFxllKP8wIQC1AAMwIQCvAFkwIQCxACEAsAAgAJMRQieadSgcMMwnIADDAHcIwgAhALoAZCUgAJMc+CggAL4KAxm/Cj4ciShACPcAQQjVISAAwQB3CMAAQjeDPggPOQMd9ihBD4D7IEIjgBkwQCmkxQB3CMQAQgjGAEMIxwBECEYHIQClACAARwghAKYAIABFCAMYRQoDGbAoIQCmBz8iQiUgAJkf6SgiABMeziggAD4ezighADIIIABATIKvACEAMwhBBYKwACEANAhBBYCxAEAYkxEe4ighADgICToDGdooOAgBOgMd4igAMPYAIQAtCPcALghJJukoATBAB7IlCPcAJghJJgMwIAA/AgMd8CjoMD4CAxz2KAgwIAC+AL8BIACTEGQAUSgIACAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOrADwOaUErAYDEKwMpQw/MKUFrAElCK4AAxAgDKUArAFBC0ECgB8wQQ6BrQAgCEANhiUIoQD4MCECAxgwKQkwQAOLMikhADYUIAAtCqEAAjD3ACEIjjHvJoExQD+JpQEgCIA+oACOMKEAJQgDGCUPoQdAEYAtCEIRQSmTgD6lACwIAxgsD44+rACtASAALggtAgMcgSklCPYALAj3AIAwjjHSJkAYna8AdwiwALEALwiyAAAwshv/MLMAtAAxCKIHMggDGDIPowc0CAMYNA+kBzMIAxgzD6YHpCkgACAI9gAhCF0jgiAArQpAMEBLjlkpIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwrBmsBAMQrBsDFEClgaAMoQxFBoYhCKIAIAijACII9wAjCEPZhiEAnRQhAJ0Y2ykdECAAQNuIogAgDqMA8DmiBKMGAxCjDKIMQQKIIgihAiMIAxwjD6ACIQAcCCAAQPaEIgikAKYBIQAbCEIHhaYEIwikBCYIogAkCEA3hKEHIwgDGCMPoAdAiusgCAgAajAhAJkADDCMACIAjAEkAIwQIQCNASIAjQEhAI4BBDAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAFxX6MJYANzCeAPownQDAMCAAiwAIACIAER1FKiEAuAFBLSIAkRxJKkEtIQAtCC4EAxlbKiAASggDHVkqPDDKAP8wIQCtBwMcrgMgAMoDCjAhADgCAxhBLYIwigBnMDgHAxiKCoIAcSqlKroqHytKK64rBiwvLHMsnCwiABEefioAMMwnIQCuAHcIrQABMCEAuABAOIKTHI4qHzBADIOoAHcIpwAdMEAFg6wAdwirAJQqQQaFqgB3CKkAHjDMJyAAQAyKrgCtAC0MAxigKiIAERADHKQqIgARFEBbhKkBqgEiAJMQERBBYYIDHUEtIDBDO4ACMEE7gAEwQziAAjBDMYAbMEMxhQE5rQCuAC4MAxjUKkEzgNgqQDOGIQAmCIA+IACvACEAKAhABIsvAgMd6CohACcIIQAlAgMcFysiAJMUDzBDZIAaMEArgK0AQSuAsABBK4wAKyIAExIDHAQrIgATFmEwIQCyAMkwIQCzAEC1gLQARFyAAzBBXENrgSIAERVAAoETGkIrQS+AsABAL4MCOQMdATCxAEExiDIrIgCREAMcNisiAJEUIQC5AUQqgAQwSSqHAxAhADkNIACuAAMwrgcuCEmWQLRBmICxAEM8gLIAQTyAbytBmoBzK0uagIMrQpqBAxiVK0M6gAQwQTqBIACyAEAsgjIEAx2mK0cPQmOABTBKjkXDQVZBKYAEOUBWgLMAQVaAxitBVoDKK0FWQiOFIQC5CgYwOQIDGN8rSJxBvICzAEMogLQAQSiA7ytB7oDzK0DugMEwQO6AgzBJ7oAGMEEmQOaAJyxBKYC0AEApgAg5QCmAtQBBKYAZLEHmgB0sQOZEIIAHMEqAQtGAtQBDJ4C2AEEngEEsQXqARSxAekTtgBAwQBmAtgBAGYMhACUIIAC3AEDhQOCANghA3YVfLC4INwIDHGssEjBDQ4AIMElDgBEwQy1BR0EtgBA5QEeAtwBBR4CJLEFHgI0sRcKAFDBDMIAJMEKVgREQEzBDKoYgAK4BtwEVMCAANwevAEAwirgAdwivACEALQYDHQ4tIAA4CCEALgZABYQ6MCAASgIDHA4tQbVBFJsuCLkAugEEMLkHAxi6CjgIvAAvCLsAOQi5G90sADwDGeQsIAC8DLsMAT4DHNYs5CwDECAAuw28DUAHiN4sIAA7CAE5rwC7ADsMAxjuLEH+gPIsQP6A0TBA/oCFMED+miAALgqvAPM+rwCHMAMYAT65AC8I9gA5CPcAgDCOMcAmhTEgALoAIQC0ABYtIAC3CjcIrgAEMEC0gKcsQ4iCIQCpAaoBQO6AERVBYYC3AECngDcIQEFBpoAwLUFBgDQtQEGASzBAQUBEgbMA/zBAL4ciABESIQC4AQgAIgCTHGMtQO+EgD4gAKAAIQAoCEAEjiACAx1VLSEAJwghACUCAxhgLSEAKwghAKkAIQAsCEC8QBpARI0IACEANwgDHYEtZDC3AAMUIQCqHwMQAxx7LSkIQCiIIAkgAMgAyAoBMCAAyQCBLSEAQAuWyAAgAMkBIQC3AyIADBAhALUUIgATHpwtTDAhADcCIACgAaANIAihACEMAxiXLUARiQMcmy0iAAwUsC0iAJEcsC0RGbAtQDyAATlAMkEUg6wtIQC1EAMcQAxAKI2RGLUtER29LSIAjBIMEiEAjBAiAIwQGi4gAEgIQjOBAxwgFEAjhiAAoQCiAWQwoQcDGKIKQBCYIACjAKQBIgiAPqYAJAiAPiYCAx3dLSMIIQIgAKYBAxwmFCAASQgDGfotIAAmDAMY6y1AM44DHO8tIgCMFiAAIAwDGPUtIgAMEgMc+S0iAAwWDi5BCoAALkEUgAQuQRRAHoAKLkEUgA4uQBSEIgARHBYuIQCMFEFYQl1AWIsiAIweIS4gAKAKIAAgCAAwAxkBMKEAoABALIYtLiEAtREDHDEuIQC1FUEWgQweOC5JFo9ELiEAtRMDHEguIQC1FwgAIACuAHcIrQB2CK8AAxSuH0Djql0uIQA1EiAArQmuCa0KAxmuCl8uIQA1FiAALwgBOgMdaC4hALUSNRVrLiEAtRY1FSAALgiAPn0+Ax1zLugwLQIDHIMuIAAtCLAALgixADAI9wAxCCYnQjSArwFBF4OAPgMdiy5kMEAXgL8uQxeCsgEgADEIQQ+bmy5kMDACAxykLpwwIACwBwMcsQOyCpMuIAAwCK0AMQiuAA8wsgUyCPM+sgCHMAMYAT6wADII9gBAOYmAMI4xwCaGMSAAsQAhAK8Awi7/MEADQz6Eyi4KMC0CAxjXLkBsiAMd1y4hAC8IIACwAP86AxkNL0lJgeUuCjBASYHuLvYwQ0mA3S5DSUxHgIcxQUeAsABAOYQDGRAvIQAwEBAvQE1ACYMtCK8A8z6tAEEeg64ALQj2AC4IRB6CrwAhALEAQNyHoAB3CKEAAxAgDKIAIQyjAEAEk6QAIQymAAMQpAymDCYIowckCAMYJA+iByMODzmmACIOpADwOaYEpAZEDYIiCKYApAFECIIDEKIMowxFAoYjDaYAIg2kAAMQpg2kDUIClCMNpQAiDawAJQimBywIAxgsD6QHJgihAiQIAxwkD6ACBjChBwMYoAohDkA/gCAOSD+CIwj3ACIIQGi6pwB3CKkAdgioACcIzCcgAKsAdwiqACgGAx2iLysIKQYDGcsvAxAgACcNqgAgACoIIwCRACAAKAgjAJMAFROVExUVIACLE1UwIwCWAKowlgCVFCAAixcjABURIwCVGL0vIAASEiAAKQioAKkBKginAKoKJxymL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHNMvIQhBY4oDNLc0DTQlNLE0YTRBNDc0ATQhNAA0QABATqAiAA0IIADcACEADgggAN0AIgCNAdgwIQCOAAMQIQA+DSAA3gDfASAAjh8aKCAA3wogAF4I4ABfCN4AYAQhAL4AAxBDEYEOHiwoThGBDh8+KE4RgY4dUChIEYUgAFwIIgCNACAAXQhAUECmqiEAPQgDHb0DCTAhADsCAxgGLYgwigByMDsHAxiKCoIAeyjcKPQoNCkTKjAqmioIK5wrIgATHoooIQA+CA85Ax2KKD4I8DkDGYooIgATEggtiDAhAD4FQIiIgDoDHako3AEiAJEcmCggANwKQD+PADADGQEw3QDcAFwMAxikKCIAkRADHKgoIgCRFAgtMzBCHocDOgMdtSgBMCEAuwAILSIwQguDAjoDHcEoAjBBC4ARMEILhgE6Ax3QKA0wIQC9AAMwQQ6ARDBCDoNAOgMdCC0FMEELjAAw9gBtMPcAADCGMUkmiDEhAC8QIQC1FjUVQz+IMzoDGQgtIQC7AQgtIgARHQMpQCqJrwBZMCEAsAAhALEA/zAhALUAKSlAb4ETKRkwQA6AYTBADoBJMEUPh5McICkBMPYAIQAnCPcAKAhAOoGJMSkpQEODIQApCPcAKghBCUNzgCI6RT+AQylJP4PxKSIAER7XKUAGgLEAQAiBIQA4CECGgFcpQEaBrwCFMEAYgPEpQAtAnoBjKUELgMkwQwuCBDoDHYspQWGAgzBBMIA5CEBDld0B3AoDGd0KXAjzPtwAXQgDGF0Phz7dAFwI9gBdCPcAgDCOMcAmiTEgAN4AQEBBJ4IFOgMdsylASYCvAEAqXieDBzoDHb8pwTBDT0ELgwg6Ax3LKZEwQAtADkILggk6Ax3xKUEXQEJAC0DDgeYpSzBDfUOZgPEpQQtAsUQLhgAwIQA9BAMdCCoUML0AQayBAxkFKkBwQAOHCDA4AgMcCCoEMCEAuwARMELegBE6Q95B8oItCPcALghA8oSKMSEAPQgDHSUqQClAOEocoiEAPAggANcAIQA1FrUWNRW1FCEwIABXAgMYiioEMPcAVwiOMe8mijEgANgA2QFYCBo+1wCNMNoAWQgDGFkP2gdXCPYAWghCqUATgNsAQHKAIABAFYDYAEETh40+2QABMFgH1wDaAdoNWQhKG4iwAAIwIADYBwMY2QpYCPYAWQhEEEBSgrEAkyrdMEPRgNUwQAmDbjAhAL0ABjBAc0CGQaiAoipBcYCIMEJ8goA6Ax2tKkEKgCIwQgqJIDoDHb8qIQC8CiIwPAIDGLwBBTBBJEOZhBA6Ax3TKiEAvANAEYMDHM8qITC8AEITgEQwQhOEQDoDHQgtITAhAEAkg+kqPAiHMcwnQF6J4gB3COEABCsiABEd8CogAOEB4gFABoQRHvgqATAgAOEAQQeBkxwAK0CCQQeAAzBBBIAHMEE0QiyAUytAzoA8CEDOgIsxQDyP3QFcCBo+3ABdCAMYXQ+NPt0AAzDcBwMY3QpcCPYAXQhCpEAWlN4AAjBeAgMYOisBMPYAIABhCPcAYgiGMUkmizGVKyAAXggDOgMdSSsCMEcOgAAwRwmEIQA1FrUWNRW1FEAMg2IEAx1mKwMwQNKAWTBA0kDRQCuFYQgBOgMdeStiCAA6QAOAGTBAEUDngbAA/zBDEoICOgMdjCtBEoGMK80wQBKAyTBEEkEJQDFCCYNuMCEAvQAIMEGTgSEAPAhAioMhAD0IAx2nK0H5gIgwQdOD3QCAOgMdsytC35khAL4eySsgAOEKAxniCmIIgD59PgMdwSvpMGECAxzfKwkwIADhBwMY4grfKyEAPh68LP8wQAiBAxziA0IWgNgrQhaA9zBCDYAgAEC9QpaTIADOAHcIzQB2CM8A0AHRAecw0gADMNMATwghOgMd+isDMNIA0wFoLEDsgSAATwhA7ZOMMSAA1ADVAVQIGj7PAI0w1gBVCAMYVQ/WBwMwzwcDGNYKTwj2AFYIQu5BF41UCAMdJyxwMNAA/jDRAMQw0gAJMNMAaCwgAFQIQMCFNCycMNAA/zDRAGQwQTlADIMHOgMdPSwBMEMIQMOBSiw4MEEVgMgwQwyFAzoDHVYsCjDQANEBRAuFBDoDHWAs/zDSAAEwQjiDBToDHWgsHzBAEqkgAFII8wBTCPQAUAj1AFEI9gBNCPcATgggANcAdwjYAHYI2QB1CNoAdAjbAHMIywBbCIA+zABXCIA+TAIDHYosWAhLAgMYkSwgAFoI9wBZCKcsIABADoHMAFkIQRGInCxaCFgCAxijLCAASwj3AFsIQBGCWAj3AFcIQsBBOJriAHcI4QAfMCgAHQIDHLgs+DCdBwcwIQC7AAgtRDAhAD4FIADcAEA6Ax0CLSEwIQA8AgMY1CxA5oj2AGII9wAhADwIhzGPJ4wx/ixACodiBAMd3ywiABEVERIREJMQQQpAt4LsLGIIADpAA4IiABERERZBDECugPosQQyA+ixADIIREpMU/ixBBIGTEAUwQUWK+jAoAJ0ACC0hALsBIQA7CAAwAxkBMEBNnt0AXQwDGBUtIACZEwMcGS0gAJkXCABhNIU0/zQGNGE0yTT/NAA0YTQDNP80AjQZNMk0tzQANBk0hTS3NAY0QAeADTRBB4ANNEEHgCU0QQeAJTRBB4CxNEEHgLE0QQeAYTRBB4BhNEEHgEE0QQeAQTRAB0EzgJE0QTuAkTRCB0FHgME0QQeAwTRBB4DRNEFDQANAP0ADQDtAA0A3h8k0zTT/NAE0ETQZNFk0BDRAAoH/NAU0QDeC/zQDNM00QSeIzTQZNP80BzTNNGE0GTQANBE0QICnBjQeMPYAjjD3AIAwjjHSJo0xIADkAHcI4wAgMOUAjjDmACAAYwjnAGQI6AD/MOMHAxzkA2cIaAQDGRsuBDBlB+cA6AHoDWYI6AdnCPYAaAhEI4XqAHcI6QBlCPYAZghEC4XsAOgAdwjrAOcAAjBNIJToAO4AdwjnAO0AIABpCO0AagjuAP8w6QcDHOoDbQhuBAMZFS5rCPYAbAhBGqHAJo4xIADtAGcIhABoCIUAbQiAAOsKAxnsCucKAxnoCvEtBjAgAOUHAxjmCq4tgDFHKAgAEDQANAM0ADS1NAA0ATQANECRgLY0QQWI/TQHNKU0ADQCNAA0DjQPNKc0QQWCEDQPNKk0QQWCEjQPNKs0QQWCFjQPNLc0QR2CFzQPNLg0QQWCFDQPNK00QRGCGDQPNLk0QQuCGTQPNLo0QQWCGjQPNLs0QQWCGzQPNLw0QQWCHDQPNL00QQWCHTQPNL40QQWCHjQPNL80QQVAAIPVNP00wTT+NED+hs80/zQwNAA0hjQANNM0QC3AATRcNAE0nDQBNNo0ATQWNAI0UTQCNIw0AjTHNAI0AjQDND80AzR9NAM0vTQDNAE0BDRINAQ0lDQENOU0BDQ/NAU0pDQFNBc0BjSeNAY0RDQHNB40CDRdNAk0qzQLNAA6AxnHLoA6AxnNLgA0dgiEAHcIhQAACAgAdwiKAHYIggAIAEARgNouQBGB4i73AUMSgRIA9wBAFIWOMc0m9QD2D/cD9wpABaP0AHUI9wB0CAgAIQCgAHcIoQCiAQgwowAhACAc+y4hCKIHIQAgCKQAAxAkDKAAAxAhDaQAoQAjCKQAJAOjACMIAx32LiIICABBjkwAAQECAA6B1A//OgA=",
+});
@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_probe2", {
+	"hex_celsius":"AQACAACrAACNMc8t/zSKASAAkRxBKAMQIgANDSAAvwA/CAMdEigQML8AIQCOASIAjQEgAD8IEDoDGSgoPwggOgMZLSg/CEA6AxkyKD8IgDoDGTcoOyghADAIIgCOAEAEgDEIQgSAMghCBIAzCEAEQCSWIgCNACAAkRAJACAAwAHBAcIBgDDDAMQBgDDFAGowIQCZAA4wjAAiAIwBIQCNAUA/QEPWBjAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzC4JyAApwB3CKkAqAAoDAMYdigoABcRAxx6KCgAFxX6MCgAlgA3MJ4A+jCdAMAwIACLAAkwIQCdACAAkx2dKIgxACCAMSgAFxmbKP8wIQCzAAMwIQCwAFkwIQCyACEAsQAgAJMRIACTHBotIADACgMZwQpAHLIoQgj3AEMI9yUgAMMAdwjCAAUwQCmEviggAEQI9wBFCEAMgsUAdwjEAEI2g0AIDzkDHRgtQQ+FHSUgAMcAdwjGAHYwQGCyyQB3CMgARgjKAEcIywBICEoHIADtACAASwggAO4AIABJCAMYSQoDGeUoIADuByAAxgEhADQc7CggAMYKIADHASEAtBzzKCAAxwogAEcIyADGBUYMAxj8KCEANBADHAApIQA0FCAAQVpDPYB1MEo9gOsAQT2A7ABDPYIjKSAA7AdAO4UpKSIADBQrKSIADBBAMIG0EH0wQCRBKotHBAMZOSkhALQUIgAMHFYpIACZH0opETBAq4DLMECpQLRAroezACIADBKMEjwwIQCuAK8BQAODrACtARgtfjBDJ4bIAAYwSAIDGI4qIQAzE0Cki8YAQQjHAMgByQFJCIA+gD4DHXkpADBIAkADgeowRwJAA4NgMEYCAxyTKkEkiKwAdwitAK4ABjAuAgMYiip4MEMKga8AeTBDBpitCgMZrAoJMC8CAxycKQgwrwATMPcAIAAuCIcx3yeBMSAAsAADEC8NrgAwB64ALgqwAEAdhbEAdwiwAAIwLgeyAEAHmbMAdwiyADEILAIDHb8pMAgtAgMc7SkgADII9gAzCPcAcjB7JyAALwgIOgMZ2CkDMC4HtABAG5u1AHcItAA1BAMd3ykGMPYAADD3AH4weyeKKiAArQGsAa8KLwi0ALUBNAj2ADUI9wB4MHsngyp8MEAdhrQAdwivADQEAxmDKi4IQAiNrwB3CK4ALA7wObUALQ60AA85tQS0BgMQtA21DUECrSAwtgC3AbgBuQG6ASAAMQg1AgMdFyowCDQCAxw4KiAAMAi0AjEIAxwxD7UCMgi7ADMIvAAAMLwb/zC+AL0AOwi2BzwIAxg8D7cHPQgDGD0PuAc+CAMYPg+5B1AqQJmBuwAvCFIYoSAAugpAMDoCAxwQKjYODzm2ADcOtwDwObYEtwY4DrgA8Dm3BLgGOQ65APA5uAS5BvAwuRm5BAMQuRsDFLkMuAy3DLYMRQaGNgiuADcIrwAuCPYALwhCuoQtCPYALAj3AHkwQAaEwAHBAZMqIQAzF0EFgHcwQJyGxwB3CMYARwQDGQMrcjBACJ/JAHcIyAAgAGsIIADKACAAbAggAMsASAhKAsgASQgDHEkKSwLJAAMUyR8DEAMcvCrICckJyAoDGckKAxQgAMcfQAqk5SrGCccJxgoDGccKRwiAPswASQiAPkwCAx3RKkgIRgIgAMoBAxxKFEoIADADGQEwywDKAEoMAxjgKiIADBADHOQqIgAMFAMrIABAG4DMAEAhQB6C8CpGCEgCRh6AxgBBHoD/KkEegAMrQB5BZoOnAHcIqQB0MEAFnagAdwirACEALAgtBAMZGCv/MKwHAxytAyEALggvBAMZISv/MK4HAxyvAyAAqgEiAAweKCsgAKoKIAAqCEE0iqwAqgAqDAMYNCshALMTAxw4KyEAsxdBFoGMHj8rSRaGSyshALMRAxxPKyEAsxVAK4R+KyAAJwiAPq0AQK+EgD4gAC0CAx1hK0G6hCkCAxitKyEAtBxAE4krCCkCqgAoCAMcKAonAqwAIABuCEAYgq0ALAiAPkAbhXwrKgggAG0CAxytK0BDgAssQiqArQBAMkARg44rKQggAGsCQixAEYgrCCkHqgAnCKwAKAgDGCgPrAdAKEBJQTBAG4erKyAAbQggACoCAxgLLHowQKOFrAB3CKoALA7wOSEAQBaIKg4hAKwADzmtBKwGAxCsDa0NQQKFLA4POSAAqgAhAC0OQBqO8DmqBKwGKgghAKwCIAAsCAMcLAoDGdorIQCtAnswRiyArwBBLIauAA85rwSuBgMQrg2vDUECgC4OQiyALw5FLICuAkMsjAcsIQCvAiIADBKMEsUsIgAMGsUsjBrFLHMwQzWEAxCoGwMUqAyrDEMEgSoIKQdAnIauACwIAxgsD64HLgiAPkBHQaqCLwIDHTcsQdWCLQIDGHQsQKiAVCxB1YCtAELVgK4AQqSArwBAIEAbgVIsLQhB1UAaiiwILQQDGXEsIACtASEAsx9gLCAArQpAC40BOSAArgCvAK0GLQwDGGwsIQCzEwMccCwhALMXQGWFDBbFLCAAKggpAqoAQXeBJwKsAEJQgLAAQOSDMAIDHYosKghB+4DFLEBSgKYsQFKAqQdB+IOnBycIgD6wAEJTQBiApCxB+IEpAgMcQBmKLggvBAMZwywgAKkBIQCzHbIsIACpCkALQFGLpwCrAKkGKQwDGL4sIQCzEQMcwiwhALMVQFGqjBYgAJkfGC0iAAwc2CwjAB0f2CxhMCEAsAARMCEAsQD/MCEAsgABLSAAxgEjAB4f3ywgAMYKIABGCAAwAxkBMMgAxgBGDAMY6ywhALMQAxzvLCEAsxRAFIL6LAEw9gBAU4P3AG4INSYBLUEHg2sI9wBsCDUmQSiBHR8ILUkoqBQtIwAdEwMcGC0jAB0XIACTEGQAhygIACAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxhSLQkwQAOLVC0hADQUIAAoCqEAAjD3ACEIhzHfJ4UxQD+JpQEgCJk+oACOMKEAJQgDGCUPoQdAEYAoCEIRQSmTmT6lACcIAxgnD44+pwCoASAAKQgoAgMcoy0lCPYAJwj3AIAwjzEfJ0AYnasAdwiqAKwAKwitAAAwrRv/MK4ArwAsCKIHLQgDGC0PowcvCAMYLw+kBy4IAxguD6YHxi0gACAI9gAhCF0jgiAAqApAMEBLjnstIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoYhCKIAIAijACII9wAjCEPZhiEAnRQhAJ0Y/S0dECAAQNuIogAgDqMA8DmiBKMGAxCjDKIMQQKIIgihAiMIAxwjD6ACIQAcCCAAQPaEIgikAKYBIQAbCEIHhaYEIwikBCYIogAkCEA3hKEHIwgDGCMPoAdAioAgCEA9oKkAdwioAHYIqwADFKkfAxADHEkuIQAzEiAAqAmpCagKAxmpCksuIQAzFiAAKwgBOgMdVC4hALMSMxFXLiEAsxYzFUDbhIA+fT4DHV8u6DBAlIlvLiAAKAiqACkIrAAqCPcALAgSJ0I0gKsBQReDgD4DHXcuZDBAF4CrLkMXgq0BIAAsCEEPm4cuZDAqAgMckC6cMCAAqgcDHKwDrQp/LiAAKgioACwIqQAPMK0FLQg8Pq0AjzADGAE+qgAtCPYAQDlA+YcNJ4YxIACsACEAsACuLv8wQANDPoS2LgowKAIDGMMuQGyIAx3DLiEAMAggAKoA/zoDGfkuSUmB0S4KMEBJgdou9jBDSYDJLkNJUEeAsQBAOYQDGfwuIQAxEPwuQE1ACYMoCKsAPD6oAEEeg6kAKAj2ACkIQh6EhzEgAKsAIQCyAEDch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCLgnQHWMdwiqACgGAx2OLysIKQYDGbcvAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRipLyAAEhJA/4aoAKkBKginAKoKJxySL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHL8vIQhCY5/mAHcI5wDoAQgw6QAgAGYc6y9nCOgHIABmCOoAAxBqDOYAAxBnDeoA5wBpCOoAagPpAGkIAx3mL2gICAAANAA0QGKgIgANCCAA3gAhAA4IIADfACIAjQHYMCEAjgADECEAOQ0gAOAA4QEgAI4fGiggAOEKIABgCOIAYQjgAGIEIQC5AAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABeCCIAjQAgAF8IQFBAuqEhADgIAx24Aw8wIQA1AgMYjiyIMIoAcjA1BwMYigqCAIEo0yjrKAYpLCkaLMArPixKLI4sjixQKekpjCr0KogwIQA5BUB/kgg6Ax2QKBswIQC4AAYwIQC1AJAsADAhADkEAxmQLH8whzG4J4gxQJCCdwjeAF8EQAqAMzBCHoMDOgMdrCgBMEEbgCIwQguDAjoDHbgoAjBBC4ARMEILgwE6Ax3HKA0wQDaAAzBBDoBEMEIOg0A6Ax2QLAcwQkKL9gBtMPcAADCGMTUmiDEhADAQIQCzFjMVQz+AMzpAR4MhALUBkCxyMEJVgOAAQFWEATD2AF4I9wBgCEEfQ06AIjpDGoB+MEAagIkxQhqJ4QAAMPcAYQiiJAYwIABhAgMYISlBtYMhKREwuAAEMEBOQ2iAETpDJYB4MEUlQGBDQICJMUEjg0UpDTC4AAUwSyOBIQAzFkBzQMeNNgIDGIEpIQA3HGMphTAhALAA0TAhALEAaSlhMEAGgBkwQAaCAxAhADcMQCOMPD7eAI8wAxgBPuAAXgj2AGAI9wCAMI8xDSdAS4nhACEAsgDiKQQw9wAhADcIhzHfJ0ALiN4A4AFeCNk+3gBgCAMYYA+OPkoegLAAUB2C3goDGeAKSSCAsQBQIIICMN4HAxhKIYSyAG4wIQC4AAwwQKKFkCwAMCEAOAQDHfEpQaCAiDBCq4OAOgMd/SkHMEETgCIwQguEIDoDHR4qIQC3CkKyiBMqEzAhADcCAxwaKrcBGioNMEEGgzwqtwE8KgswQSBD2IQQOgMdXCohALcDQiCANSpCIINYKhIwtwBYKkMhjAwwtwB+MIcxuCeKMSAA4AB3CN4A4QAGMGECQBZAhoQGOgMdUSq3CrcKQQeEBzoDHVgq/jC3B0I9gEQwQj2DQDoDHZAsEzBAo4A2CECjQCqA3gBAG4IgAN4HXghCNIPlAHcI5AAgAECjhCAAZAj3AGUI4iRCC0GiQFJAL0JjhKgqIQA3HJ4qADBDGYSGMTUmijHtKgEwRwlE50FDR+eAAzBI50AWhOEABTBhAgMY1ipILYEgAGEIQISA5CpADEAthAAw9wBeCKIk7SpHT0FngA4wQWdLj4chADgIAx0IKyEAtQGQLIgwQauD4ACAOgMdFCtCt5khALkeKisgAOQKAxnlCmUIgD59PgMdIivpMGQCAxxAKwkwIADkBwMY5QpAKyEAOR5XK/8wQAiBAxzlA0IWgDkrQhaA9zBCDUrGhh8wKAAdAgMcUyv4MJ0HQspC+oDgAED6gLwrQGiCBjoDHa4rQGaADDpABECEQIuDeDCHMXsnizFCB4B5MEEHgCAAQEeGgD4DHYErBjBkAgMYritBp4DgAECSgGAIQJFAE4LhAIcxuCdABIbiAHcI4AD2AGII9wByMEIjgeEKYQhCEIDhAEAQgGEEQECDBjAgAOQA5QFAKoL2AGUI9wBAckEaQqeJ+jAoAJ0AkCwAMCEAOAQDHfkrfzBCJZDgAHcI3gDhAGEIADADGQEw3gDiAOMB4hvjA2II9gBjCPcAQBVBQY9hCAMZ7CsiAAwQDBKMEigAFxEgAJMQ9is8MCEArgCvAUADg6wArQEoABcVRfCJ3gCIOgMZkCzeASMAHh8HLCAA3gpAU0E5iuEA3gBeDAMYEywjAB4TAxwXLCMAHhdBIECkgbgnjDFBeoDeAECwjF4I9wBhCIYxNSaMMSEAOAgDHTMsDTC4AAMwQHeAETBCOYAROkA5QSOBATD3AEDghKIkbjAhALgACDBBjUGJgQMZVyxDVYKAOgMdWixBG4AiMEIKiSA6Ax1sLCEAtgoHMDYCAxi2AQcwQSFDOIQQOgMdgCwhALYDQBGDAxx8LAYwtgBCE4BEMEITgUA6Ax1ATIC3AULRQDaBIQA1CEGIQBGt4QBhDAMYnSwgAJkTAxyhLCAAmRcIACAAzgB3CM0AIQAzFrMWMxWzFAYwIABOAgMYySwZMCEAsADdMCEAsQAgAE4IPD7OAI8wAxgBPtAATgj2AFAI9wCAMI8xDSdAm4eyAOEsADAgAE0EAxnYLGEwQB2ACTBAHYDJMEEOQAOBsADRMEAJgP8wQAlAP8DVAHcI1AB2CNYA1wHYAecw2QADMNoAcjBWAgMYCC1WCNsAEzAgAFsCAxz8LO0w2wf0LCAAWxiHLXAw1wD+MNgAeDDZAAUw2gCHLY4wIADWBwQw9wBWCIcx3yeNMSAA2wDcAVsI2T7WAI4w3QBcCAMYXA/dBwMw1gcDGN0KVgj2AF0IQmJBF4JbCAMdNy1HLosgAFsIAToDHUQtzjDXAP8w2AAyMNkA2gFBDIMJOgMdTS0BMEMIggI6Ax1WLUQRgwM6Ax1fLfowQwiCBDoDHW0tQjWCkDDZAAEwQjWDBToDHXYtCDBDFoMGOgMdfy08MEMIgwc6Ax2HLQYwQAiMIABZCPMAWgj0AFcI9QBYCPYAVAj3AFUImyVCsUAGQ/iZdgjQAHUIzwB0CNIAcwjRAFIIgD7TAE4IgD5TAgMdsS1NCFECAxi4LSAATwj3AFAIzi0gAEAOgdMAUAhBEYjDLU8ITQIDGMotIABRCPcAUghAEYZNCPcATggIAE8w9gCOMEGtoB8njTEhAKEAdwigAFEwogCOMKMAIQAgCKQAIQilAP8woAcDHKEDJAglBAMZTC4EMCIHpAClAaUNIwilByQI9gAlCEQjhacAdwimACII9gAjCEILh44xIQCpAKUAdwioAKQAAjBLIEAUlKUAqwB3CKQAqgAhACYIqgAnCKsA/zCmBwMcpwMqCCsEAxlGLigI9gApCEEagA0nQBqhqgAkCIQAJQiFACoIgACoCgMZqQqkCgMZpQoiLgYwIQCiBwMYowrfLYAxQigIAAw0ADQDNAA0szQANAE0ADRMNA80tDRBBYj+NAc0azQANAI0ADRGNA80bTRBBYJINA80rDRBBYJKNA80rjRBBYJNNA80tTRBHYJONA80tjRBBYJPNA80tzRBBYJQNA80uDRBBYJRNA80uTRBBYJSNA80ujRBBUAAmRo0/jSdNP408jT+NDM0/zRpNP80mDT/NMM0/zTrNP80EDQANDM0ADRVNAA0dzQANJg0ADRAK6nZNAA0+jQANBw0ATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNGE0GTT/NAA00TShNP80AjRAA4UNNAM0yTTNNP80ATRAA5INNAE0YTQRNP80BDRhNMk0/zQFNIU00TT/NAg0zTSFNP80BjTRNEEDgN00QCeaCTQZNME0DTQJNN001TT/NAc0ADoDGRQvgDoDGRovADR2CIQAdwiFAAAICAB3CIoAdgiCAAgAQBGAJy9AEYEvL/cBQxKBEgD3AEAUhY8xGif1APYP9wP3CkAFjvQAdQj3AHQICAADNLc0DTQlNLE0YTRBNDc0ATQhNECsgDw0QQFFAAEBAgAOgdQP/zoA",
+	"hex_fahrenheit":"AQACAACrAACNMdAt/zSKASAAkRxBKAMQIgANDSAAvwA/CAMdEigQML8AIQCOASIAjQEgAD8IEDoDGSgoPwggOgMZLSg/CEA6AxkyKD8IgDoDGTcoOyghADAIIgCOAEAEgDEIQgSAMghCBIAzCEAEQCSWIgCNACAAkRAJACAAwAHBAcIBgDDDAMQBgDDFAGowIQCZAA4wjAAiAIwBIQCNAUA/QEPWBjAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAfzC4JyAApwB3CKkAqAAoDAMYdigoABcRAxx6KCgAFxX6MCgAlgA3MJ4A+jCdAMAwIACLAAkwIQCdACAAkx2dKIgxACCAMSgAFxmbKP8wIQCzAAMwIQCwAFkwIQCyACEAsQAgAJMRIACTHBotIADACgMZwQpAHLIoQgj3AEMI9yUgAMMAdwjCAAUwQCmEviggAEQI9wBFCEAMgsUAdwjEAEI2g0AIDzkDHRgtQQ+FHSUgAMcAdwjGAHYwQGCyyQB3CMgARgjKAEcIywBICEoHIADtACAASwggAO4AIABJCAMYSQoDGeUoIADuByAAxgEhADQc7CggAMYKIADHASEAtBzzKCAAxwogAEcIyADGBUYMAxj8KCEANBADHAApIQA0FCAAQVpDPYB1MEo9gOsAQT2A7ABDPYIjKSAA7AdAO4UpKSIADBQrKSIADBBAMIG0EH0wQCRBKotHBAMZOSkhALQUIgAMHFYpIACZH0opETBAq4DLMECpQLRAroezACIADBKMEjwwIQCuAK8BQAODrACtARgtfjBDJ4bIAAYwSAIDGI4qIQAzE0Cki8YAQQjHAMgByQFJCIA+gD4DHXkpADBIAkADgeowRwJAA4NgMEYCAxyTKkEkiKwAdwitAK4ABjAuAgMYiip4MEMKga8AeTBDBpitCgMZrAoJMC8CAxycKQgwrwATMPcAIAAuCIcx3yeBMSAAsAADEC8NrgAwB64ALgqwAEAdhbEAdwiwAAIwLgeyAEAHmbMAdwiyADEILAIDHb8pMAgtAgMc7SkgADII9gAzCPcAcjB7JyAALwgIOgMZ2CkDMC4HtABAG5u1AHcItAA1BAMd3ykGMPYAADD3AH4weyeKKiAArQGsAa8KLwi0ALUBNAj2ADUI9wB4MHsngyp8MEAdhrQAdwivADQEAxmDKi4IQAiNrwB3CK4ALA7wObUALQ60AA85tQS0BgMQtA21DUECrSAwtgC3AbgBuQG6ASAAMQg1AgMdFyowCDQCAxw4KiAAMAi0AjEIAxwxD7UCMgi7ADMIvAAAMLwb/zC+AL0AOwi2BzwIAxg8D7cHPQgDGD0PuAc+CAMYPg+5B1AqQJmBuwAvCFIYoSAAugpAMDoCAxwQKjYODzm2ADcOtwDwObYEtwY4DrgA8Dm3BLgGOQ65APA5uAS5BvAwuRm5BAMQuRsDFLkMuAy3DLYMRQaGNgiuADcIrwAuCPYALwhCuoQtCPYALAj3AHkwQAaEwAHBAZMqIQAzF0EFgHcwQJyGxwB3CMYARwQDGQMrcjBACJ/JAHcIyAAgAGsIIADKACAAbAggAMsASAhKAsgASQgDHEkKSwLJAAMUyR8DEAMcvCrICckJyAoDGckKAxQgAMcfQAqk5SrGCccJxgoDGccKRwiAPswASQiAPkwCAx3RKkgIRgIgAMoBAxxKFEoIADADGQEwywDKAEoMAxjgKiIADBADHOQqIgAMFAMrIABAG4DMAEAhQB6C8CpGCEgCRh6AxgBBHoD/KkEegAMrQB5BZoOnAHcIqQB0MEAFnagAdwirACEALAgtBAMZGCv/MKwHAxytAyEALggvBAMZISv/MK4HAxyvAyAAqgEiAAweKCsgAKoKIAAqCEE0iqwAqgAqDAMYNCshALMTAxw4KyEAsxdBFoGMHj8rSRaGSyshALMRAxxPKyEAsxVAK4R+KyAAJwiAPq0AQK+EgD4gAC0CAx1hK0G6hCkCAxitKyEAtBxAE4krCCkCqgAoCAMcKAonAqwAIABuCEAYgq0ALAiAPkAbhXwrKgggAG0CAxytK0BDgAssQiqArQBAMkARg44rKQggAGsCQixAEYgrCCkHqgAnCKwAKAgDGCgPrAdAKEBJQTBAG4erKyAAbQggACoCAxgLLHowQKOFrAB3CKoALA7wOSEAQBaIKg4hAKwADzmtBKwGAxCsDa0NQQKFLA4POSAAqgAhAC0OQBqO8DmqBKwGKgghAKwCIAAsCAMcLAoDGdorIQCtAnswRiyArwBBLIauAA85rwSuBgMQrg2vDUECgC4OQiyALw5FLICuAkMsjAcsIQCvAiIADBKMEsUsIgAMGsUsjBrFLHMwQzWEAxCoGwMUqAyrDEMEgSoIKQdAnIauACwIAxgsD64HLgiAPkBHQaqCLwIDHTcsQdWCLQIDGHQsQKiAVCxB1YCtAELVgK4AQqSArwBAIEAbgVIsLQhB1UAaiiwILQQDGXEsIACtASEAsx9gLCAArQpAC40BOSAArgCvAK0GLQwDGGwsIQCzEwMccCwhALMXQGWFDBbFLCAAKggpAqoAQXeBJwKsAEJQgLAAQOSDMAIDHYosKghB+4DFLEBSgKYsQFKAqQdB+IOnBycIgD6wAEJTQBiApCxB+IEpAgMcQBmKLggvBAMZwywgAKkBIQCzHbIsIACpCkALQFGLpwCrAKkGKQwDGL4sIQCzEQMcwiwhALMVQFGqjBYgAJkfGC0iAAwc2CwjAB0f2CxhMCEAsAARMCEAsQD/MCEAsgABLSAAxgEjAB4f3ywgAMYKIABGCAAwAxkBMMgAxgBGDAMY6ywhALMQAxzvLCEAsxRAFIL6LAEw9gBAU4P3AG4INSYBLUEHg2sI9wBsCDUmQSiBHR8ILUkoqBQtIwAdEwMcGC0jAB0XIACTEGQAhygIACAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxhSLQkwQAOLVC0hADQUIAAoCqEAAjD3ACEIhzHfJ4UxQD+JpQEgCJo+oACOMKEAJQgDGCUPoQdAEYAoCEIRQSmTmj6lACcIAxgnD44+pwCoASAAKQgoAgMcoy0lCPYAJwj3AIAwjzEgJ0AYnasAdwiqAKwAKwitAAAwrRv/MK4ArwAsCKIHLQgDGC0PowcvCAMYLw+kBy4IAxguD6YHxi0gACAI9gAhCF0jgiAAqApAMEBLjnstIg4POaEAIw6gAPA5oQSgBiQOpQDwOaAEpQYmDkKvhfAwpxmnBAMQpxsDFEClgaAMoQxFBoYhCKIAIAijACII9wAjCEPZhiEAnRQhAJ0Y/S0dECAAQNuIogAgDqMA8DmiBKMGAxCjDKIMQQKIIgihAiMIAxwjD6ACIQAcCCAAQPaEIgikAKYBIQAbCEIHhaYEIwikBCYIogAkCEA3hKEHIwgDGCMPoAdAioAgCEA9oKkAdwioAHYIqwADFKkfAxADHEkuIQAzEiAAqAmpCagKAxmpCksuIQAzFiAAKwgBOgMdVC4hALMSMxVXLiEAsxYzFUDbhIA+fT4DHV8u6DBAlIlvLiAAKAiqACkIrAAqCPcALAgSJ0I0gKsBQReDgD4DHXcuZDBAF4CrLkMXgq0BIAAsCEEPm4cuZDAqAgMckC6cMCAAqgcDHKwDrQp/LiAAKgioACwIqQAPMK0FLQg9Pq0AjzADGAE+qgAtCPYAQDlA+YcOJ4YxIACsACEAsACuLv8wQANDPoS2LgowKAIDGMMuQGyIAx3DLiEAMAggAKoA/zoDGfkuSUmB0S4KMEBJgdou9jBDSYDJLkNJUEeAsQBAOYQDGfwuIQAxEPwuQE1ACYMoCKsAPT6oAEEeg6kAKAj2ACkIQh6EhzEgAKsAIQCyAEDch6AAdwihAAMQIAyiACEMowBABJOkACEMpgADEKQMpgwmCKMHJAgDGCQPogcjDg85pgAiDqQA8DmmBKQGRA2CIgimAKQBRAiCAxCiDKMMRQKGIw2mACINpAADEKYNpA1CApQjDaUAIg2nACUIpgcnCAMYJw+kByYIoQIkCAMcJA+gAgYwoQcDGKAKIQ5AP4AgDkg/giMI9wAiCEBohqcAdwipAHYIqAAnCLgnQHWMdwiqACgGAx2OLysIKQYDGbcvAxAgACcNqgBAt4EjAJEAQJmVIwCTABUTlRMVFSAAixNVMCMAlgCqMJYAlRQgAIsXIwAVESMAlRipLyAAEhJA/4aoAKkBKginAKoKJxySL0GlhqEBogEDECANowAgACMIQCxAKIEVFBMIQA6EpAEgCKYApQEiCEEFiiUEoQAkCCYEogAjCKAAowogHL8vIQhCY5/mAHcI5wDoAQgw6QAgAGYc6y9nCOgHIABmCOoAAxBqDOYAAxBnDeoA5wBpCOoAagPpAGkIAx3mL2gICAAANAA0QGKgIgANCCAA3gAhAA4IIADfACIAjQHYMCEAjgADECEAOQ0gAOAA4QEgAI4fGiggAOEKIABgCOIAYQjgAGIEIQC5AAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABeCCIAjQAgAF8IQFBAuqEhADgIAx24Aw8wIQA1AgMYjiyIMIoAcjA1BwMYigqCAIEo0yjrKAYpLCkaLMArPixKLI4sjixQKekpjCr0KogwIQA5BUB/kgg6Ax2QKBswIQC4AAYwIQC1AJAsADAhADkEAxmQLH8whzG4J4gxQJCCdwjeAF8EQAqAMzBCHoMDOgMdrCgBMEEbgCIwQguDAjoDHbgoAjBBC4ARMEILgwE6Ax3HKA0wQDaAAzBBDoBEMEIOg0A6Ax2QLAcwQkKL9gBtMPcAADCGMTUmiDEhADAQIQCzFjMVQz+AMzpAR4MhALUBkCxyMEJVgOAAQFWEATD2AF4I9wBgCEEfQ06AIjpDGoB+MEAagIkxQhqJ4QAAMPcAYQiiJAYwIABhAgMYISlBtYMhKREwuAAEMEBOQ2iAETpDJYB4MEUlQGBDQICJMUEjg0UpDTC4AAUwSyOBIQAzFkBzQMeNNgIDGIEpIQA3HGMphTAhALAA0TAhALEAaSlhMEAGgBkwQAaCAxAhADcMQCOMPT7eAI8wAxgBPuAAXgj2AGAI9wCAMI8xDidAS4nhACEAsgDiKQQw9wAhADcIhzHfJ0ALiN4A4AFeCNo+3gBgCAMYYA+OPkoegLAAUB2C3goDGeAKSSCAsQBQIIICMN4HAxhKIYSyAG4wIQC4AAwwQKKFkCwAMCEAOAQDHfEpQaCAiDBCq4OAOgMd/SkHMEETgCIwQguEIDoDHR4qIQC3CkKyiBMqEzAhADcCAxwaKrcBGioNMEEGgzwqtwE8KgswQSBD2IQQOgMdXCohALcDQiCANSpCIINYKhIwtwBYKkMhjAwwtwB+MIcxuCeKMSAA4AB3CN4A4QAGMGECQBZAhoQGOgMdUSq3CrcKQQeEBzoDHVgq/jC3B0I9gEQwQj2DQDoDHZAsEzBAo4A2CECjQCqA3gBAG4IgAN4HXghCNIPlAHcI5AAgAECjhCAAZAj3AGUI4iRCC0GiQFJAL0JjhKgqIQA3HJ4qADBDGYSGMTUmijHtKgEwRwlE50FDR+eAAzBI50AWhOEABTBhAgMY1ipILYEgAGEIQISA5CpADEAthAAw9wBeCKIk7SpHT0FngA4wQWdLj4chADgIAx0IKyEAtQGQLIgwQauD4ACAOgMdFCtCt5khALkeKisgAOQKAxnlCmUIgD59PgMdIivpMGQCAxxAKwkwIADkBwMY5QpAKyEAOR5XK/8wQAiBAxzlA0IWgDkrQhaA9zBCDUrGhh8wKAAdAgMcUyv4MJ0HQspC+oDgAED6gLwrQGiCBjoDHa4rQGaADDpABECEQIuDeDCHMXsnizFCB4B5MEEHgCAAQEeGgD4DHYErBjBkAgMYritBp4DgAECSgGAIQJFAE4LhAIcxuCdABIbiAHcI4AD2AGII9wByMEIjgeEKYQhCEIDhAEAQgGEEQECDBjAgAOQA5QFAKoL2AGUI9wBAckEaQqeJ+jAoAJ0AkCwAMCEAOAQDHfkrfzBCJZDgAHcI3gDhAGEIADADGQEw3gDiAOMB4hvjA2II9gBjCPcAQBVBQY9hCAMZ7CsiAAwQDBKMEigAFxEgAJMQ9is8MCEArgCvAUADg6wArQEoABcVRfCJ3gCIOgMZkCzeASMAHh8HLCAA3gpAU0E5iuEA3gBeDAMYEywjAB4TAxwXLCMAHhdBIECkgbgnjDFBeoDeAECwjF4I9wBhCIYxNSaMMSEAOAgDHTMsDTC4AAMwQHeAETBCOYAROkA5QSOBATD3AEDghKIkbjAhALgACDBBjUGJgQMZVyxDVYKAOgMdWixBG4AiMEIKiSA6Ax1sLCEAtgoHMDYCAxi2AQcwQSFDOIQQOgMdgCwhALYDQBGDAxx8LAYwtgBCE4BEMEITgUA6Ax1ATIC3AULRQDaBIQA1CEGIQBGt4QBhDAMYnSwgAJkTAxyhLCAAmRcIACAAzgB3CM0AIQAzFrMWMxWzFAYwIABOAgMYySwZMCEAsADdMCEAsQAgAE4IPT7OAI8wAxgBPtAATgj2AFAI9wCAMI8xDidAm4eyAOEsADAgAE0EAxnYLGEwQB2ACTBAHYDJMEEOQAOBsADRMEAJgP8wQAlAP8DVAHcI1AB2CNYA1wHYAecw2QADMNoAcjBWAgMYCC1WCNsAEzAgAFsCAxz8LO0w2wf0LCAAWxiILXAw1wD+MNgAxDDZAAkw2gCILY4wIADWBwQw9wBWCIcx3yeNMSAA2wDcAVsI2j7WAI4w3QBcCAMYXA/dBwMw1gcDGN0KVgj2AF0IQmJBF4JbCAMdNy1HLosgAFsIAToDHUQtnDDXAP8w2ABkMNkA2gFBDIMJOgMdTS0BMEMIggI6Ax1WLUQRhQM6Ax1gLfQw2QABMEIohwQ6Ax1uLeAw1wD8MNgAIDBBfkENgwU6Ax13LQgwQyCDBjoDHYAtPDBDCIMHOgMdiC0GMEAIjCAAWQjzAFoI9ABXCPUAWAj2AFQI9wBVCJwlQrJABkP5mXYI0AB1CM8AdAjSAHMI0QBSCIA+0wBOCIA+UwIDHbItTQhRAgMYuS0gAE8I9wBQCM8tIABADoHTAFAIQRGIxC1PCE0CAxjLLSAAUQj3AFIIQBGGTQj3AE4ICABQMPYAjjBBrqAgJ40xIQChAHcIoABSMKIAjjCjACEAIAikACEIpQD/MKAHAxyhAyQIJQQDGU0uBDAiB6QApQGlDSMIpQckCPYAJQhEI4WnAHcIpgAiCPYAIwhCC4eOMSEAqQClAHcIqACkAAIwSyBAFJSlAKsAdwikAKoAIQAmCKoAJwirAP8wpgcDHKcDKggrBAMZRy4oCPYAKQhBGoAOJ0AaoaoAJAiEACUIhQAqCIAAqAoDGakKpAoDGaUKIy4GMCEAogcDGKMK4C2AMUIoCAAMNAA0AzQANLM0ADQBNAA0TTQPNLQ0QQWI/jQHNGs0ADQCNAA0RzQPNG00QQWCSTQPNKw0QQWCSzQPNK40QQWCTjQPNLU0QR2CTzQPNLY0QQWCUDQPNLc0QQWCUTQPNLg0QQWCUjQPNLk0QQWCUzQPNLo0QQVAAMXVNP00wTT+NFk0/zTPNP80MDQANIY0ADTTNAA0GjQBNFw0ATScNAE02jQBNBY0AjRRNAI0jDQCNMc0AjQCNAM0PzQDNH00AzS9NAM0ATQENEg0BDSUNAQ05TQEND80BTSkNAU0FzQGNJ40BjRENAc0HjQINF00CTSrNAs0YTQZNP80ADTRNKE0/zQCNEADhQ00AzTJNM00/zQBNEADkg00ATRhNBE0/zQENGE0yTT/NAU0hTTRNP80CDTNNIU0/zQGNNE0QQOA3TRAJ5oJNBk0wTQNNAk03TTVNP80BzQAOgMZFS+AOgMZGy8ANHYIhAB3CIUAAAgIAHcIigB2CIIACABAEYAoL0ARgTAv9wFDEoESAPcAQBSFjzEbJ/UA9g/3A/cKQAWO9AB1CPcAdAgIAAM0tzQNNCU0sTRhNEE0NzQBNCE0QKyAPDRBAUUAAQECAA6B1A//OgA=",
+});
@@ -0,0 +1,4 @@
+stc1000p_loaded("stc1000p_rh", {
+	"hex_celsius":"AQACAACrAACGMRcu/zSKASAAkRxBKAMQIgANDSAArgAuCAMdEigQMK4AIQCOASIAjQEgAC4IEDoDGSgoLgggOgMZLSguCEA6AxkyKC4IgDoDGTcoOyghACQIIgCOAEAEgCUIQgSAJghCBIAnCEAEQCSWIgCNACAAkRAJACAAugG7AbwBgDC9AL4BgDC/AGowIQCZAA4wjAAiAIwBIQCNAUA/QEPPBjAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAFxX6MJYANzCeAPownQAiABESExILMPAlIQCjAHcIogDAMCAAiwAJMCEAnQAgAJMdliiIMQAggDEoABcZlCj/MCEApwADMCEApABZMCEApgAhAKUAIACTESAAkxwsLCAAugoDGbsKOhyrKDwI9wA9CC8kIAC9AHcIvAAFMEAphLcoIAA+CPcAPwhADIK/AHcIvgBCNoM6CA85Ax0qLEEcnCAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxj0KAkwQAOL9ighACgUIAAoCqEAAjD3ACEIhzGQJ4AxQD+JpQEgCOE+oACGMKEAJQgDGCUPoQdAEYAoCEARgYExIABBKZPhPqUAJwgDGCcPhj6nAKgBIAApCCgCAxxFKSUI9gAnCPcAgDCHMXMnQBidqwB3CKoArAArCK0AADCtG/8wsACvACwIogctCAMYLQ+jBy8IAxgvD6QHMAgDGDAPpgdoKSAAIAj2ACEIXSOCIACoCkAwQEuOHSkiDg85oQAjDqAA8DmhBKAGJA6lAPA5oASlBiYOQq+F8DCnGacEAxCnGwMUQKWBoAyhDEUGtiEIogAgCKMAIgj3ACMIwQB3CMAADTDwJSAAwwB3CMIAQAjEAEEIxQBCCEQHIQCgACAARQghAKEAIABDCAMYQwoDGbUpIQChByAAPgj3AD8IIACnAHcIqQApDg85qAAnDqsA8DmoBKsGAxCrDKgMQQKIVzAoB6kA/zCnACsIAxgrD6cHQUmGJwyrACkMqAADEKsbAxRBF0IEQCeOqgAnDqwA8DmqBKwG8DCsGawEAxCsGwMUrAyqDCoIQCmGKwinACwIAxgsD6cHDjBAYkCxiKgAKQiqACcIrAAoCCoHqQAsCEM8owMUpx8DEAMcGSqpAacBJyogACcIgD6APgMdISplMCkCAxwnKmQwIACpAKcBIAApCKgAIQCpAB0wIAA7AgMdMypMMDoCAxzHK0ARg6wArQEhACEIQR+EQSoBMCACAxzJKkEJhX8+Ax1LKvQwIAIDGEAJgiAIIACwAEANiiAArwCxAbIBMAizAC8ItAC1ASAANAhBIptkKjIwMwIDHG0qzjAgALMHAxy0A7UKXCogADUItgADEDMNtwA0DbgAAxC3DbgNNQqzALABIAA4CEEeioMqGTA3AgMcnirnMCAAtwcDHLgDMwhAi5K0AHcIrwAxCLUAMgi5AC8INQexADkIsgA0CAMYNA+yB7IqIAA2CFAUkSAAsAoIMDACAxx7KgMQshsDFDIMrQAxDKwAAxCtGwMUrQysDEQEgSEAKg1BfIApCEF8jjEILQIDHdkqLwgsAiAAsgEDHDIUMAisADIEIQCqAECrn7ABADAgACwEAxnvKiwYsAoDEKwM5SoiABEeAysDMCAAMAKsAawNLAivAC8MAxj+KiIAExIDHAIrIgATFhMrBjBDEIOwADAMAxgPK0EQgBMrQBCNADAhACsEAx1qKyEAIggjBAMZISv/MKIHAxyjA0AxgVMrbzBAhIWwAHcIrAAPMKwFsAFANYVwMC8HrAAiABMaQitBHIsDHUIrIgAREgsw8CUhAKMAdwiiACAALAhAHoyvAHcIsACwCgMZrwowCPYALwj3ACwIsyVqK0AggF0rRBlCREBJgiIAERYMMEMNgSEAKwpAiYUHMCwFIQCrACAArAFAUox5KyAArAogACwMAxh/KyIADBIDHIMrIgAMFkIQgIorQRBCgoaSKyIAjBIDHJYrIgCMFkISgJ0rQhKEADADGQEwsACsAEAphqkrIQCnEwMcrSshAKcXQhaAtCtJFo3AKyEApxEDHMQrIQCnFSAAugG7ASAAmR8qLA8wQIaEwQB3CMAAwgDAAUAin9crIADACiAAwQEiABMe3isgAMEKIABBCMAGQAgDGewrOggQOQMdATDAAEAIAx3vKyAAwAHyKwEwIADAACAAQAhBPZXBAMAAQAwDGP4rIQAnEwMcAiwhACcXIABCCAI6AxkLLMIcFyy6HhcsIQApCEAckMEBADD2AEAI9wBBCG0kKiwgAEIcIiwBMPYAIQAgCPcAIQhACoL/MCEApABAAp2lACEApgAgAJMQZACAKAgAIACgAHcIoQAhAJ0UIQCdGDUsHRAgACEODzmiACAOowDwOaIEowYDEKMMogxBAo8iCKECIwgDHCMPoAIhABwIIACiAKMBIgikAKYBIQAbCEIHj6YEIwikBCYIogAkCKMAIgihByMIAxgjD6AHIQj3ACAIQD2zqQB3CKgAdgirAAMUqR8DEAMcgSwhACcSIACoCakJqAoDGakKgywhACcWIAArCAE6Ax2MLCEApxInEY8sIQCnFicVIAApCIA+fT4DHZcs6DAoAgMcpywgACgIqgApCKwAKgj3ACwISiVCNICrAUEXg4A+Ax2vLGQwQBeA4yxDF4KtASAALAhBD5u/LGQwKgIDHMgsnDAgAKoHAxysA60KtywgACoIqAAsCKkADzCtBS0Irz6tAIcwAxgBPqoALQj2AEA5hYAwhzFhJ4QxIACsAEC8gOYsQcBDPoTuLAowKAIDGPssQGyIAx37LCEAJAggAKoA/zoDGTEtSUmBCS0KMEBJgRIt9jBDSYABLUNJTEeAhTFBR4ClAEA5hAMZNC0hACUQNC1ATUAJgygIqwCvPqgAQR6DqQAoCPYAKQhEHoKrACEApgBA3IegAHcIoQADECAMogAhDKMAQASTpAAhDKYAAxCkDKYMJgijByQIAxgkD6IHIw4POaYAIg6kAPA5pgSkBkQNgiIIpgCkAUQIggMQogyjDEUChiMNpgAiDaQAAxCmDaQNQgKUIw2lACINpwAlCKYHJwgDGCcPpAcmCKECJAgDHCQPoAIGMKEHAxigCiEOQD+AIA5IP4IjCPcAIghAaIanAHcIqQB2CKgAJwjwJUB1jHcIqgAoBgMdxi0rCCkGAxnvLQMQIAAnDaoAQLeBIwCRAECZlSMAkwAVE5UTFRUgAIsTVTAjAJYAqjCWAJUUIACLFyMAFREjAJUY4S0gABISQP+GqACpASoIpwCqCiccyi1BpYahAaIBAxAgDaMAIAAjCEAsQCiBFRQTCEAOhKQBIAimAKUBIghBBYolBKEAJAgmBKIAIwigAKMKIBz3LSEIQWOClzD2AIYwQdmgcyeGMSAA3wB3CN4AmTDgAIYw4QAgAF4I4gBfCOMA/zDeBwMc3wNiCGMEAxmULgQwYAfiAOMB4w1hCOMHYgj2AGMIRCOF5QB3COQAYAj2AGEIRAuF5wDjAHcI5gDiAAIwTSCU4wDpAHcI4gDoACAAZAjoAGUI6QD/MOQHAxzlA2gIaQQDGY4uZgj2AGcIQRqAYSdAGqHoAGIIhABjCIUAaAiAAOYKAxnnCuIKAxnjCmouBjAgAOAHAxjhCicugDFCKAgADDQANAM0ADSnNAA0ATQANL00BzSoNEEFiLk0BzSgNAA0AjQANL40BzSpNEELgrs0BzSiNEELgr80BzSqNEELgsA0BzSrNEEFgsE0BzSsNEEFgsI0BzStNEEFgsM0BzSuNEEFgsQ0BzSvNEEFgsU0BzSwNEEFQADDGjT+NJ00/jTyNP40MzT/NGk0/zSYNP80wzT/NOs0/zQQNAA0MzQANFU0ADR3NAA0mDQANLg0ADTZNAA0+jQANBw0ATQ+NAE0YjQBNIc0ATSvNAE02TQBNAc0AjQ5NAI0cDQCNLA0AjT7NAI0WDQDNNE0AzSCNAQ0yjQFNN00AzT/NAI03TRhNEEDgbc0AzRBA4BhNEADgA00QQeADTRBB4AlNEEHgCU0QQeAsTRBB4CxNEEHgGE0QAelhTTFNNU0BTSFNFk0WTQFNMk0zTT/NAE03TTRNM00AzRhNN00yTQENAA6AxloL4A6AxluLwA0dgiEAHcIhQAACAgAdwiKAHYIggAIAEARgHsvQBGBgy/3AUMSgRIA9wBAFIWHMW4n9QD2D/cD9wpABaf0AHUI9wB0CAgAIADqAHcI6wDsAQgw7QAgAGocnC9rCOwHIABqCO4AAxBuDOoAAxBrDe4A6wBtCO4AbgPtAG0IAx2XL2wICAADNLc0DTQlNEBsg0E0NzQBNCE0QdhIAAIQAKIgAIsTIgANCCAA1wAhAA4IIADYACIAjQHYMCEAjgADECEALw0gANkA2gEgAI4fGiggANoKIABZCNsAWgjZAFsEIQCvAAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABXCCIAjQAgAFgIQFCdIACLFyEALggDHa4DCTAhACwCAxhfK4gwigByMCwHAxiKCoIAeyi9KNUo/ygVKU8pryn9KTsqiDAhAC8FQHmKCDoDHYooGzAhAK4ABDAhAKwAYSszMEIOgwM6Ax2WKAEwQQuAIjBCC4MCOgMdoigCMEELgBEwQguDAToDHbEoDTBAJoADMEEOgEQwQg6DQDoDHWErBTBBC4wAMPYAbTD3AAAwhDFtJIgxIQAkECEApxYnFUM/iTM6AxlhKyEArAFhK28whTHwJYgxQNCJdwjXAA8w1wXYAVcI2QBwMFkH1wBCDoDZAEAOQC6CVwj3AFkIQS5DXYAiOkMpgv8wIQCkAEACgqUAIQCmAEAEgKcAQ2eAETpDFYQAMCEALgQDHUQpQUSAiTFCNYHaAFoKQEeGVwXaAA8wWgXXAHAw1wdAQIQAMPcAVwiFMbMlQBaGWgjXANsBVwj2AFsI9wBAIkALQS5DyICIOkM5hSEALQggANIAIQAnFkCMiqcUEDAgAFICAxioKQQw9wBSCIcxkCdALZHTANQBUwghPtIAhzDVAFQIAxhUD9UHUgj2AFUI9wCAMIcxYSdAE4DWAEB4gCAAQBWA0wBBE4eHPtQAATBTB9IA1QHVDVQIShuIpQACMCAA0wcDGNQKUwj2AFQIRBBAUoGmAG4wQP2ABjBC8UGZgLcpRnKCgDoDHcIpQQpDzYkgOgMd1CkhAK0KEDAtAgMYrQEFMEEkQ8mEEDoDHegpIQCtA0ARgwMc5CkPMK0AQhOARDBCE4FAOgMdQaBC1oPdAHcI3AAHMEEUQJ9ADkCggIoxQBiM2gFXCCE+1wBaCAMYWg+HPtoAAzDXBwMY2gpA2YBaCEJ2QBaO2wACMFsCAxgrKgEw9gAgAFwI9wBdCIQxbSSKMTQqQP1FCUGLgAgwQT1B64TXACEALggDHUYqRY6A2gBAjoBSKkJpmSEArx5oKiAA3AoDGd0KXQiAPn0+Ax1gKukwXAIDHH4qCTAgANwHAxjdCn4qIQAvHkUr/zBACIEDHN0DQhaAdypCFoD3MEINgCAAQGtCU4sgAMkAdwjIAHYIygDLAcwB5zDNAAMwzgBAk4BKCEKSkc8A0AFPCCE+ygCHMNEAUAgDGFAP0QcDMMoHAxjRCkoI9gBRCESTmM8ATwgDHb0qcDDLAP4wzAB4MM0ABTDOAPEqIABPCAE6Ax3KKs4wywD/MMwAMjDNAM4BQQyDBjoDHdMqATBDCIMCOgMd3CpkMEMIgwM6Ax3pKvYwQR6ACjBDDIMEOgMd8SoDMEAIqSAATQjzAE4I9ABLCPUATAj2AEgI9wBJCCAA0gB3CNMAdgjUAHUI1QB0CNYAcwjGAFYIgD7HAFIIgD5HAgMdEytTCEYCAxgaKyAAVQj3AFQIMCsgAEAOgccAVAhBEYglK1UIUwIDGCwrIABGCPcAVghAEYJTCPcAUghCqkE4it0AdwjcAB8wKAAdAgMcQSv4MJ0HBzBB8oBEMEH+g9cAQDoDHVsrQMuI9gBdCPcAIQAtCIUxsyWLMQUwQRWK+jAoAJ0AYSshAKwBIQAsCAAwAxkBMEAditoAWgwDGG4rIACZEwMccisgAJkXCAABAQIADoHUD/86AA==",
+	"hex_fahrenheit":"AQACAACrAACGMRcu/zSKASAAkRxBKAMQIgANDSAArgAuCAMdEigQMK4AIQCOASIAjQEgAC4IEDoDGSgoLgggOgMZLSguCEA6AxkyKC4IgDoDGTcoOyghACQIIgCOAEAEgCUIQgSAJghCBIAnCEAEQCSWIgCNACAAkRAJACAAugG7AbwBgDC9AL4BgDC/AGowIQCZAA4wjAAiAIwBIQCNAUA/QEPPBjAjAIwAIQAeFp4XIwCOAQUwIACcAPowmwAhAJEUcjAoAJcAFxX6MJYANzCeAPownQAiABESExILMPAlIQCjAHcIogDAMCAAiwAJMCEAnQAgAJMdliiIMQAggDEoABcZlCj/MCEApwADMCEApABZMCEApgAhAKUAIACTESAAkxwsLCAAugoDGbsKOhyrKDwI9wA9CC8kIAC9AHcIvAAFMEAphLcoIAA+CPcAPwhADIK/AHcIvgBCNoM6CA85Ax0qLEEcnCAAoAB3CKEAIDCiAKMBpAGmASEODzmlACAOpwDwOaUEpwYDEKcMpQw/MKUFpwElCKkAAxAgDKUApwFBC0ECgB8wQQ6BqAAgCEANhiUIoQD4MCECAxj0KAkwQAOL9ighACgUIAAoCqEAAjD3ACEIhzGQJ4AxQD+JpQEgCOE+oACGMKEAJQgDGCUPoQdAEYAoCEARgYExIABBKZPhPqUAJwgDGCcPhj6nAKgBIAApCCgCAxxFKSUI9gAnCPcAgDCHMXMnQBidqwB3CKoArAArCK0AADCtG/8wsACvACwIogctCAMYLQ+jBy8IAxgvD6QHMAgDGDAPpgdoKSAAIAj2ACEIXSOCIACoCkAwQEuOHSkiDg85oQAjDqAA8DmhBKAGJA6lAPA5oASlBiYOQq+F8DCnGacEAxCnGwMUQKWBoAyhDEUGtiEIogAgCKMAIgj3ACMIwQB3CMAADTDwJSAAwwB3CMIAQAjEAEEIxQBCCEQHIQCgACAARQghAKEAIABDCAMYQwoDGbUpIQChByAAPgj3AD8IIACnAHcIqQApDg85qAAnDqsA8DmoBKsGAxCrDKgMQQKIVzAoB6kA/zCnACsIAxgrD6cHQUmGJwyrACkMqAADEKsbAxRBF0IEQCeOqgAnDqwA8DmqBKwG8DCsGawEAxCsGwMUrAyqDCoIQCmGKwinACwIAxgsD6cHDjBAYkCxiKgAKQiqACcIrAAoCCoHqQAsCEM8owMUpx8DEAMcGSqpAacBJyogACcIgD6APgMdISplMCkCAxwnKmQwIACpAKcBIAApCKgAIQCpAB0wIAA7AgMdMypMMDoCAxzHK0ARg6wArQEhACEIQR+EQSoBMCACAxzJKkEJhX8+Ax1LKvQwIAIDGEAJgiAIIACwAEANiiAArwCxAbIBMAizAC8ItAC1ASAANAhBIptkKjIwMwIDHG0qzjAgALMHAxy0A7UKXCogADUItgADEDMNtwA0DbgAAxC3DbgNNQqzALABIAA4CEEeioMqGTA3AgMcnirnMCAAtwcDHLgDMwhAi5K0AHcIrwAxCLUAMgi5AC8INQexADkIsgA0CAMYNA+yB7IqIAA2CFAUkSAAsAoIMDACAxx7KgMQshsDFDIMrQAxDKwAAxCtGwMUrQysDEQEgSEAKg1BfIApCEF8jjEILQIDHdkqLwgsAiAAsgEDHDIUMAisADIEIQCqAECrn7ABADAgACwEAxnvKiwYsAoDEKwM5SoiABEeAysDMCAAMAKsAawNLAivAC8MAxj+KiIAExIDHAIrIgATFhMrBjBDEIOwADAMAxgPK0EQgBMrQBCNADAhACsEAx1qKyEAIggjBAMZISv/MKIHAxyjA0AxgVMrbzBAhIWwAHcIrAAPMKwFsAFANYVwMC8HrAAiABMaQitBHIsDHUIrIgAREgsw8CUhAKMAdwiiACAALAhAHoyvAHcIsACwCgMZrwowCPYALwj3ACwIsyVqK0AggF0rRBlCREBJgiIAERYMMEMNgSEAKwpAiYUHMCwFIQCrACAArAFAUox5KyAArAogACwMAxh/KyIADBIDHIMrIgAMFkIQgIorQRBCgoaSKyIAjBIDHJYrIgCMFkISgJ0rQhKEADADGQEwsACsAEAphqkrIQCnEwMcrSshAKcXQhaAtCtJFo3AKyEApxEDHMQrIQCnFSAAugG7ASAAmR8qLA8wQIaEwQB3CMAAwgDAAUAin9crIADACiAAwQEiABMe3isgAMEKIABBCMAGQAgDGewrOggQOQMdATDAAEAIAx3vKyAAwAHyKwEwIADAACAAQAhBPZXBAMAAQAwDGP4rIQAnEwMcAiwhACcXIABCCAI6AxkLLMIcFyy6HhcsIQApCEAckMEBADD2AEAI9wBBCG0kKiwgAEIcIiwBMPYAIQAgCPcAIQhACoL/MCEApABAAp2lACEApgAgAJMQZACAKAgAIACgAHcIoQAhAJ0UIQCdGDUsHRAgACEODzmiACAOowDwOaIEowYDEKMMogxBAo8iCKECIwgDHCMPoAIhABwIIACiAKMBIgikAKYBIQAbCEIHj6YEIwikBCYIogAkCKMAIgihByMIAxgjD6AHIQj3ACAIQD2zqQB3CKgAdgirAAMUqR8DEAMcgSwhACcSIACoCakJqAoDGakKgywhACcWIAArCAE6Ax2MLCEApxInFY8sIQCnFicVIAApCIA+fT4DHZcs6DAoAgMcpywgACgIqgApCKwAKgj3ACwISiVCNICrAUEXg4A+Ax2vLGQwQBeA4yxDF4KtASAALAhBD5u/LGQwKgIDHMgsnDAgAKoHAxysA60KtywgACoIqAAsCKkADzCtBS0Irz6tAIcwAxgBPqoALQj2AEA5hYAwhzFhJ4QxIACsAEC8gOYsQcBDPoTuLAowKAIDGPssQGyIAx37LCEAJAggAKoA/zoDGTEtSUmBCS0KMEBJgRIt9jBDSYABLUNJTEeAhTFBR4ClAEA5hAMZNC0hACUQNC1ATUAJgygIqwCvPqgAQR6DqQAoCPYAKQhEHoKrACEApgBA3IegAHcIoQADECAMogAhDKMAQASTpAAhDKYAAxCkDKYMJgijByQIAxgkD6IHIw4POaYAIg6kAPA5pgSkBkQNgiIIpgCkAUQIggMQogyjDEUChiMNpgAiDaQAAxCmDaQNQgKUIw2lACINpwAlCKYHJwgDGCcPpAcmCKECJAgDHCQPoAIGMKEHAxigCiEOQD+AIA5IP4IjCPcAIghAaIanAHcIqQB2CKgAJwjwJUB1jHcIqgAoBgMdxi0rCCkGAxnvLQMQIAAnDaoAQLeBIwCRAECZlSMAkwAVE5UTFRUgAIsTVTAjAJYAqjCWAJUUIACLFyMAFREjAJUY4S0gABISQP+GqACpASoIpwCqCiccyi1BpYahAaIBAxAgDaMAIAAjCEAsQCiBFRQTCEAOhKQBIAimAKUBIghBBYolBKEAJAgmBKIAIwigAKMKIBz3LSEIQWOClzD2AIYwQdmgcyeGMSAA3wB3CN4AmTDgAIYw4QAgAF4I4gBfCOMA/zDeBwMc3wNiCGMEAxmULgQwYAfiAOMB4w1hCOMHYgj2AGMIRCOF5QB3COQAYAj2AGEIRAuF5wDjAHcI5gDiAAIwTSCU4wDpAHcI4gDoACAAZAjoAGUI6QD/MOQHAxzlA2gIaQQDGY4uZgj2AGcIQRqAYSdAGqHoAGIIhABjCIUAaAiAAOYKAxnnCuIKAxnjCmouBjAgAOAHAxjhCicugDFCKAgADDQANAM0ADSnNAA0ATQANL00BzSoNEEFiLk0BzSgNAA0AjQANL40BzSpNEELgrs0BzSiNEELgr80BzSqNEELgsA0BzSrNEEFgsE0BzSsNEEFgsI0BzStNEEFgsM0BzSuNEEFgsQ0BzSvNEEFgsU0BzSwNEEFQADD1TT9NME0/jRZNP80zzT/NDA0ADSGNAA00zQANBo0ATRcNAE0nDQBNNo0ATQWNAI0UTQCNIw0AjTHNAI0AjQDND80AzR9NAM0vTQDNAE0BDRINAQ0lDQENOU0BDQ/NAU0pDQFNBc0BjSeNAY0RDQHNB40CDRdNAk0qzQLNN00AzT/NAI03TRhNEEDgbc0AzRBA4BhNEADgA00QQeADTRBB4AlNEEHgCU0QQeAsTRBB4CxNEEHgGE0QAelhTTFNNU0BTSFNFk0WTQFNMk0zTT/NAE03TTRNM00AzRhNN00yTQENAA6AxloL4A6AxluLwA0dgiEAHcIhQAACAgAdwiKAHYIggAIAEARgHsvQBGBgy/3AUMSgRIA9wBAFIWHMW4n9QD2D/cD9wpABaf0AHUI9wB0CAgAIADqAHcI6wDsAQgw7QAgAGocnC9rCOwHIABqCO4AAxBuDOoAAxBrDe4A6wBtCO4AbgPtAG0IAx2XL2wICAADNLc0DTQlNEBsg0E0NzQBNCE0QdhIAAIQAKIgAIsTIgANCCAA1wAhAA4IIADYACIAjQHYMCEAjgADECEALw0gANkA2gEgAI4fGiggANoKIABZCNsAWgjZAFsEIQCvAAMQQxGBDh4sKE4RgQ4fPihOEYGOHVAoSBGFIABXCCIAjQAgAFgIQFCdIACLFyEALggDHa4DCTAhACwCAxhfK4gwigByMCwHAxiKCoIAeyi9KNUo/ygVKU8pryn9KTsqiDAhAC8FQHmKCDoDHYooGzAhAK4ABDAhAKwAYSszMEIOgwM6Ax2WKAEwQQuAIjBCC4MCOgMdoigCMEELgBEwQguDAToDHbEoDTBAJoADMEEOgEQwQg6DQDoDHWErBTBBC4wAMPYAbTD3AAAwhDFtJIgxIQAkECEApxYnFUM/iTM6AxlhKyEArAFhK28whTHwJYgxQNCJdwjXAA8w1wXYAVcI2QBwMFkH1wBCDoDZAEAOQC6CVwj3AFkIQS5DXYAiOkMpgv8wIQCkAEACgqUAIQCmAEAEgKcAQ2eAETpDFYQAMCEALgQDHUQpQUSAiTFCNYHaAFoKQEeGVwXaAA8wWgXXAHAw1wdAQIQAMPcAVwiFMbMlQBaGWgjXANsBVwj2AFsI9wBAIkALQS5DyICIOkM5hSEALQggANIAIQAnFkCMiqcUEDAgAFICAxioKQQw9wBSCIcxkCdALZHTANQBUwghPtIAhzDVAFQIAxhUD9UHUgj2AFUI9wCAMIcxYSdAE4DWAEB4gCAAQBWA0wBBE4eHPtQAATBTB9IA1QHVDVQIShuIpQACMCAA0wcDGNQKUwj2AFQIRBBAUoGmAG4wQP2ABjBC8UGZgLcpRnKCgDoDHcIpQQpDzYkgOgMd1CkhAK0KEDAtAgMYrQEFMEEkQ8mEEDoDHegpIQCtA0ARgwMc5CkPMK0AQhOARDBCE4FAOgMdQaBC1oPdAHcI3AAHMEEUQJ9ADkCggIoxQBiM2gFXCCE+1wBaCAMYWg+HPtoAAzDXBwMY2gpA2YBaCEJ2QBaO2wACMFsCAxgrKgEw9gAgAFwI9wBdCIQxbSSKMTQqQP1FCUGLgAgwQT1B64TXACEALggDHUYqRY6A2gBAjoBSKkJpmSEArx5oKiAA3AoDGd0KXQiAPn0+Ax1gKukwXAIDHH4qCTAgANwHAxjdCn4qIQAvHkUr/zBACIEDHN0DQhaAdypCFoD3MEINgCAAQGtCU4sgAMkAdwjIAHYIygDLAcwB5zDNAAMwzgBAk4BKCEKSkc8A0AFPCCE+ygCHMNEAUAgDGFAP0QcDMMoHAxjRCkoI9gBRCESTmM8ATwgDHb0qcDDLAP4wzADEMM0ACTDOAPEqIABPCAE6Ax3KKpwwywD/MMwAZDDNAM4BQQyDBjoDHdMqATBDCIICOgMd3CpEEYMDOgMd6Sr2MEEegAowQwyDBDoDHfEqAzBACKkgAE0I8wBOCPQASwj1AEwI9gBICPcASQggANIAdwjTAHYI1AB1CNUAdAjWAHMIxgBWCIA+xwBSCIA+RwIDHRMrUwhGAgMYGisgAFUI9wBUCDArIABADoHHAFQIQRGIJStVCFMCAxgsKyAARgj3AFYIQBGCUwj3AFIIQqpBOIrdAHcI3AAfMCgAHQIDHEEr+DCdBwcwQfKARDBB/oPXAEA6Ax1bK0DLiPYAXQj3ACEALQiFMbMlizEFMEEVivowKACdAGErIQCsASEALAgAMAMZATBAHYraAFoMAxhuKyAAmRMDHHIrIACZFwgAAQECAA6B1A//OgA=",
+});
@@ -0,0 +1,53 @@
+#!/bin/bash
+
+# STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+#
+# Copyright 2014 Mats Staffansson
+#
+# This file is part of STC1000+.
+#
+# STC1000+ is free software: you can redistribute it and/or modify
+# it under the terms of the GNU General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# STC1000+ is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU General Public License
+# along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+
+# Run the cycle benchmark (picbench) on ../src/build/stc1000p_*.hex for all
+# variants in parallel, and write the results to benchmark.txt (or the file
+# given as argument). Functions are named from the .map files if present.
+
+out=${1:-benchmark.txt}
+
+make bench || exit -1
+
+variants=""
+for v in "" _probe2 _com _fo433 _minute _minute_probe2 _minute_com _minute_fo433 _pid _probe2_pid _minute_pid _com_log _packed _com_packed _ovbsc _rh; do
+	variants="$variants celsius$v fahrenheit$v"
+done
+
+for v in $variants; do
+	map=""
+	if [[ -f ../src/build/stc1000p_$v.map ]]; then
+		map="-m ../src/build/stc1000p_$v.map"
+	fi
+	./build/picbench_$v $map ../src/build/stc1000p_$v.hex > build/bench_$v.txt &
+done
+
+status=0
+for job in `jobs -p`; do
+	wait $job || status=-1
+done
+
+echo -e "# variant\titem\tcount\tmin\tavg\tmax" > $out
+for v in $variants; do
+	cat build/bench_$v.txt >> $out
+done
+
+exit $status
@@ -0,0 +1,60 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Included at the end of the host copy of page0.c (see Makefile), to give
+ * the device model access to what is static in the firmware.
+ * Note that int is 16 bits here, use long in the interface.
+ *
+ */
+
+/* Entry of the interrupt vector */
+void sim_interrupt(void){
+	interrupt_service_routine();
+}
+
+#if defined(OVBSC)
+/* Setpoint kept in RAM */
+long sim_setpoint(void){
+	return setpoint;
+}
+#elif defined(MINUTE)
+long sim_setpoint(void){
+	return TEMP_COARSE(setpoint);
+}
+#endif
+
+/* A/D filter and conversion of the main loop, for replay of recorded A/D
+ * values (set sim.ad[SIM_AD_PROBE1] before sim_read_ad()).
+ */
+long sim_filter_shift(void){
+	return FILTER_SHIFT;
+}
+
+long sim_read_ad(long adfilter){
+	// As set up by init()
+	ADCS0 = 1;
+	ADFM = 1;
+	START_TCONV_1();
+	return read_ad(adfilter);
+}
+
+long sim_ad_to_temp(long adfilter){
+	return TEMP_COARSE(ad_to_temp(adfilter));
+}
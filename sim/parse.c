@@ -0,0 +1,148 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Parsing of times, config values and button presses, see parse.h.
+ *
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "parse.h"
+#include "stc1000p.h"
+
+#define MENU_ITEM_NAME(name, led10ch, led1ch, led01ch, type, default_value) \
+	{ #name, EEADR_MENU_ITEM(name), MENU_TYPE_IS_TEMPERATURE(type) },
+
+static const struct {
+	const char *name;
+	unsigned char eeadr;
+	unsigned char decimal;
+} menu_items[] = {
+	MENU_DATA(MENU_ITEM_NAME)
+};
+
+sim_time_t parse_time(const char *s, char **end){
+	double v = strtod(s, end);
+	sim_time_t unit = SIM_SECOND;
+
+	if(*end == s || v < 0){
+		return SIM_NEVER;
+	}
+	switch(**end){
+		case 'd':
+			unit = SIM_DAY;
+			break;
+		case 'h':
+			unit = SIM_HOUR;
+			break;
+		case 'm':
+			unit = SIM_MINUTE;
+			break;
+		case 's':
+			break;
+		default:
+			(*end)--;
+	}
+	(*end)++;
+	return (sim_time_t) (v * unit);
+}
+
+int parse_config(const char *s){
+	char name[16];
+	const char *eq = strchr(s, '=');
+	double value;
+	unsigned char i, eeadr, decimal = 0;
+	int v;
+
+	if(!eq || eq == s || (size_t) (eq - s) >= sizeof(name)){
+		return -1;
+	}
+	memcpy(name, s, eq - s);
+	name[eq - s] = 0;
+	value = atof(eq + 1);
+
+	if(isdigit((unsigned char) name[0])){
+		eeadr = atoi(name);
+#if !(defined(OVBSC) || defined(RH) || defined(PACKED))
+	} else if((!strncmp(name, "SP", 2) || !strncmp(name, "dh", 2)) && strlen(name) == 4 &&
+			name[2] >= '0' && name[2] < '0' + NO_OF_PROFILES && isdigit((unsigned char) name[3])){
+		eeadr = EEADR_PROFILE_SETPOINT(name[2] - '0', name[3] - '0');
+		if(name[0] == 'd'){
+			eeadr++;
+		} else {
+			decimal = 1;
+		}
+#endif
+	} else {
+		for(i=0; i<sizeof(menu_items)/sizeof(menu_items[0]); i++){
+			if(!strcmp(menu_items[i].name, name)){
+				break;
+			}
+		}
+		if(i == sizeof(menu_items)/sizeof(menu_items[0])){
+			return -1;
+		}
+		eeadr = menu_items[i].eeadr;
+		decimal = menu_items[i].decimal;
+	}
+
+	if(eeadr >= SIM_EEPROM_SIZE / 2){
+		return -1;
+	}
+	v = (int) floor((decimal ? value * 10.0 : value) + 0.5);
+	sim.eeprom[eeadr << 1] = v & 0xff;
+	sim.eeprom[(eeadr << 1) + 1] = (v >> 8) & 0xff;
+	return 0;
+}
+
+int parse_press(const char *s, struct press *p){
+	char *end;
+
+	p->time = parse_time(s, &end);
+	p->duration = 300 * SIM_MS;
+	p->buttons = 0;
+	if(p->time == SIM_NEVER || *end++ != ':'){
+		return -1;
+	}
+	for(; *end && *end != ':'; end++){
+		switch(*end){
+			case 'p':
+				p->buttons |= SIM_BTN_PWR;
+				break;
+			case 's':
+				p->buttons |= SIM_BTN_S;
+				break;
+			case 'u':
+				p->buttons |= SIM_BTN_UP;
+				break;
+			case 'd':
+				p->buttons |= SIM_BTN_DOWN;
+				break;
+			default:
+				return -1;
+		}
+	}
+	if(*end == ':'){
+		p->duration = atoi(end + 1) * SIM_MS;
+	}
+	return p->buttons ? 0 : -1;
+}
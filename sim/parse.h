@@ -0,0 +1,55 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Parsing of times, config values and button presses, shared by the
+ * programs running the simulated device.
+ *
+ */
+
+#ifndef __PARSE_H__
+#define __PARSE_H__
+
+#include "sim.h"
+
+struct press {
+	sim_time_t time;
+	sim_time_t duration;
+	unsigned char buttons;
+};
+
+/* Parse time, as number with unit s, m, h or d (default seconds).
+ * return: time in us, or SIM_NEVER if malformed
+ */
+sim_time_t parse_time(const char *s, char **end);
+
+/* Set a config value in the EEPROM of the device, as 'Set' menu item
+ * (temperatures in degrees, e.g. SP=18.5), profile setpoint or duration
+ * (e.g. SP03=20.0 or dh03=48 for profile 0, step 3) or address (raw, 0=185).
+ * return: 0 on success, -1 if unknown or malformed
+ */
+int parse_config(const char *s);
+
+/* Parse button press, time:buttons[:ms] with buttons p, s, u and d
+ * (e.g. 10s:s or 1h:ud:5000), held 300ms unless given.
+ * return: 0 on success, -1 if malformed
+ */
+int parse_press(const char *s, struct press *p);
+
+#endif // __PARSE_H__
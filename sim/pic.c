@@ -0,0 +1,966 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Instruction set simulator of the PIC16F1828, see pic.h.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "pic.h"
+
+/* Core registers, at the start of every bank */
+#define INDF0		0x00
+#define INDF1		0x01
+#define PCL			0x02
+#define STATUS		0x03
+#define FSR0L		0x04
+#define FSR0H		0x05
+#define FSR1L		0x06
+#define FSR1H		0x07
+#define BSR			0x08
+#define WREG		0x09
+#define PCLATH		0x0a
+#define INTCON		0x0b
+
+#define C			0x01
+#define DC			0x02
+#define Z			0x04
+
+/* Program memory and EEPROM in the HEX file (byte addresses) */
+#define HEX_EEPROM_ADDRESS	0x1e000
+#define HEX_CONFIG_ADDRESS	0x10000
+
+#define W			(p->ram[WREG])
+
+static void schedule(struct pic *p){
+	unsigned long long next = p->t0_next;
+
+	if(p->t2_next < next) next = p->t2_next;
+	if(p->t4_next < next) next = p->t4_next;
+	if(p->t6_next < next) next = p->t6_next;
+	if(p->ad_done < next) next = p->ad_done;
+	if(p->ee_done < next) next = p->ee_done;
+	p->next_event = next;
+}
+
+/* Timer 0 */
+
+static unsigned int t0_prescale(struct pic *p){
+	unsigned char option = p->ram[PIC_OPTION_REG];
+	return (option & 0x08) ? 1 : (2 << (option & 0x07));
+}
+
+static unsigned char t0_running(struct pic *p){
+	return !(p->ram[PIC_OPTION_REG] & 0x20);
+}
+
+static unsigned char t0_read(struct pic *p){
+	if(!t0_running(p) || p->cycle <= p->t0_base){
+		return p->t0_value;
+	}
+	return p->t0_value + (p->cycle - p->t0_base) / t0_prescale(p);
+}
+
+/* Restart counting from value (after the two cycle inhibit on writes to TMR0) */
+static void t0_set(struct pic *p, unsigned char value, unsigned int inhibit){
+	p->t0_value = value;
+	p->t0_base = p->cycle + inhibit;
+	p->t0_next = t0_running(p) ? p->t0_base + (256 - value) * (unsigned long long) t0_prescale(p) : PIC_NEVER;
+	schedule(p);
+}
+
+/* Timer 1, counting instruction cycles (only FOSC/4 as clock source, no gate and no overflow interrupt) */
+
+static unsigned short t1_read(struct pic *p){
+	unsigned char con = p->ram[PIC_T1CON];
+
+	if(!(con & 0x01) || (con & 0xc0)){
+		return p->t1_value;
+	}
+	return p->t1_value + ((p->cycle - p->t1_base) >> ((con >> 4) & 0x03));
+}
+
+/* Restart counting from value */
+static void t1_set(struct pic *p, unsigned short value){
+	p->t1_value = value;
+	p->t1_base = p->cycle;
+}
+
+/* Timers 2, 4 and 6: period (PR + 1) * prescale * postscale */
+
+static unsigned long long tx_next(struct pic *p, unsigned long long from, unsigned short tcon, unsigned short pr){
+	static const unsigned char prescale[4] = { 1, 4, 16, 64 };
+	unsigned char con = p->ram[tcon];
+
+	if(!(con & 0x04)){
+		return PIC_NEVER;
+	}
+	return from + (p->ram[pr] + 1) * prescale[con & 0x03] * (((con >> 3) & 0x0f) + 1);
+}
+
+/* Count of timer 4, from the start of the current period (which is PR4 + 1 counts times the postscale) */
+static unsigned char t4_read(struct pic *p){
+	static const unsigned char prescale[4] = { 1, 4, 16, 64 };
+	unsigned char con = p->ram[PIC_T4CON];
+	unsigned long long period = tx_next(p, 0, PIC_T4CON, PIC_PR4);
+
+	if(p->t4_next == PIC_NEVER || p->cycle + period < p->t4_next){
+		return p->ram[PIC_TMR4];
+	}
+	return ((p->cycle + period - p->t4_next) / prescale[con & 0x03]) % (p->ram[PIC_PR4] + 1);
+}
+
+/* Port A pin levels and interrupt on change */
+
+unsigned char pic_porta_pins(struct pic *p){
+	unsigned char tris = p->ram[PIC_TRISA];
+	return (p->ram[PIC_LATA] & ~tris) | (p->porta_in & tris);
+}
+
+static void porta_update(struct pic *p){
+	unsigned char pins = pic_porta_pins(p);
+	unsigned char rising = pins & ~p->porta_pins, falling = ~pins & p->porta_pins;
+
+	p->ram[PIC_IOCAF] |= ((rising & p->ram[PIC_IOCAP]) | (falling & p->ram[PIC_IOCAN])) & 0x3f;
+	p->porta_pins = pins;
+}
+
+void pic_set_porta(struct pic *p, unsigned char levels){
+	p->porta_in = levels;
+	porta_update(p);
+}
+
+/* Peripheral events that are due */
+static void events(struct pic *p){
+	if(p->cycle >= p->t0_next){
+		p->ram[INTCON] |= 0x04;
+		p->t0_value = 0;
+		p->t0_base = p->t0_next;
+		p->t0_next += 256 * (unsigned long long) t0_prescale(p);
+	}
+	if(p->cycle >= p->t2_next){
+		p->ram[PIC_PIR1] |= 0x02;
+		p->t2_next = tx_next(p, p->t2_next, PIC_T2CON, PIC_PR2);
+	}
+	if(p->cycle >= p->t4_next){
+		p->ram[PIC_PIR3] |= 0x02;
+		p->t4_next = tx_next(p, p->t4_next, PIC_T4CON, PIC_PR4);
+	}
+	if(p->cycle >= p->t6_next){
+		p->ram[PIC_PIR3] |= 0x08;
+		p->t6_next = tx_next(p, p->t6_next, PIC_T6CON, PIC_PR6);
+	}
+	if(p->cycle >= p->ad_done){
+		unsigned int ad = p->ad[(p->ram[PIC_ADCON0] >> 2) & 0x1f] & 0x3ff;
+
+		if(p->ram[PIC_ADCON1] & 0x80){
+			p->ram[PIC_ADRESH] = ad >> 8;
+			p->ram[PIC_ADRESL] = ad & 0xff;
+		} else {
+			p->ram[PIC_ADRESH] = ad >> 2;
+			p->ram[PIC_ADRESL] = (ad << 6) & 0xc0;
+		}
+		p->ram[PIC_ADCON0] &= ~0x02;
+		p->ram[PIC_PIR1] |= 0x40;
+		p->ad_done = PIC_NEVER;
+	}
+	if(p->cycle >= p->ee_done){
+		p->eeprom[p->ram[PIC_EEADRL]] = p->ram[PIC_EEDATL];
+		p->eeprom_writes++;
+		p->ram[PIC_EECON1] &= ~0x02;
+		p->ram[PIC_PIR2] |= 0x10;
+		p->ee_done = PIC_NEVER;
+	}
+	schedule(p);
+}
+
+/* Special function registers (0x0c-0x1f in each bank) */
+
+static unsigned char sfr_read(struct pic *p, unsigned short a){
+	switch(a){
+		case PIC_PORTA:
+			return pic_porta_pins(p) & ~p->ram[PIC_ANSELA];
+		case PIC_PORTB:
+			return p->ram[PIC_LATB];
+		case PIC_PORTC:
+			return ((p->ram[PIC_LATC] & ~p->ram[PIC_TRISC]) | (p->portc_in & p->ram[PIC_TRISC])) & ~p->ram[PIC_ANSELC];
+		case PIC_TMR0:
+			return t0_read(p);
+		case PIC_TMR1L:
+			return t1_read(p) & 0xff;
+		case PIC_TMR1H:
+			return t1_read(p) >> 8;
+		case PIC_TMR4:
+			return t4_read(p);
+		case PIC_EECON2:
+			return 0;
+	}
+	return p->ram[a];
+}
+
+static void sfr_write(struct pic *p, unsigned short a, unsigned char v){
+	switch(a){
+		case PIC_PORTA:
+		case PIC_PORTB:
+		case PIC_PORTC:
+			a += PIC_LATA - PIC_PORTA;
+			break;
+		case PIC_TMR0:
+			t0_set(p, v, 2);
+			return;
+		case PIC_TMR1L:
+			t1_set(p, (t1_read(p) & 0xff00) | v);
+			return;
+		case PIC_TMR1H:
+			t1_set(p, (t1_read(p) & 0x00ff) | (v << 8));
+			return;
+		case PIC_T1CON:
+			t1_set(p, t1_read(p));
+			break;
+		case PIC_EECON2:
+			p->ee_unlock = (v == 0x55) ? 1 : (v == 0xaa && p->ee_unlock == 1) ? 2 : 0;
+			return;
+		case PIC_EECON1:
+			/* Data EEPROM only, program memory access is not modelled */
+			if((v & 0x01) && !(v & 0xc0)){
+				p->ram[PIC_EEDATL] = p->eeprom[p->ram[PIC_EEADRL]];
+			}
+			v &= ~0x01;
+			if((v & 0x02) && !(p->ram[PIC_EECON1] & 0x02)){
+				if((v & 0x04) && p->ee_unlock == 2 && !(v & 0xc0)){
+					p->ee_done = p->cycle + PIC_EEPROM_WRITE_CYCLES;
+					schedule(p);
+				} else {
+					v &= ~0x02;
+				}
+			}
+			p->ee_unlock = 0;
+			break;
+		case PIC_ADCON0:
+			if((v & 0x03) == 0x03 && !(p->ram[a] & 0x02)){
+				p->ad_done = p->cycle + PIC_AD_CONVERSION_CYCLES;
+				schedule(p);
+			} else if(!(v & 0x02)){
+				p->ad_done = PIC_NEVER;
+			}
+			break;
+	}
+
+	if(a == PIC_OPTION_REG){
+		unsigned char t0 = t0_read(p);
+		p->ram[a] = v;
+		t0_set(p, t0, 0);
+		return;
+	}
+
+	p->ram[a] = v;
+
+	switch(a){
+		case PIC_T2CON:
+		case PIC_PR2:
+			p->t2_next = tx_next(p, p->cycle, PIC_T2CON, PIC_PR2);
+			schedule(p);
+			break;
+		case PIC_T4CON:
+		case PIC_PR4:
+			p->t4_next = tx_next(p, p->cycle, PIC_T4CON, PIC_PR4);
+			schedule(p);
+			break;
+		case PIC_T6CON:
+		case PIC_PR6:
+			p->t6_next = tx_next(p, p->cycle, PIC_T6CON, PIC_PR6);
+			schedule(p);
+			break;
+		case PIC_LATA:
+		case PIC_TRISA:
+			porta_update(p);
+			break;
+	}
+}
+
+/* Data memory access, by 12 bit banked address */
+
+static unsigned char mem_read(struct pic *p, unsigned short a);
+static void mem_write(struct pic *p, unsigned short a, unsigned char v);
+
+/* Indirect access through FSR (traditional, linear and program memory) */
+static unsigned char fsr_read(struct pic *p, unsigned short fsr){
+	if(fsr < 0x1000){
+		if((fsr & 0x7f) <= INDF1){
+			return 0;
+		}
+		return mem_read(p, fsr);
+	} else if(fsr >= 0x2000 && fsr < 0x29b0){
+		fsr -= 0x2000;
+		return mem_read(p, ((fsr / 80) << 7) | (0x20 + fsr % 80));
+	} else if(fsr >= 0x8000){
+		return p->flash[(fsr - 0x8000) & (PIC_FLASH_WORDS - 1)] & 0xff;
+	}
+	return 0;
+}
+
+static void fsr_write(struct pic *p, unsigned short fsr, unsigned char v){
+	if(fsr < 0x1000){
+		if((fsr & 0x7f) > INDF1){
+			mem_write(p, fsr, v);
+		}
+	} else if(fsr >= 0x2000 && fsr < 0x29b0){
+		fsr -= 0x2000;
+		mem_write(p, ((fsr / 80) << 7) | (0x20 + fsr % 80), v);
+	}
+}
+
+static unsigned short fsr(struct pic *p, unsigned char n){
+	return p->ram[FSR0L + 2 * n] | (p->ram[FSR0H + 2 * n] << 8);
+}
+
+static void fsr_set(struct pic *p, unsigned char n, unsigned short v){
+	p->ram[FSR0L + 2 * n] = v & 0xff;
+	p->ram[FSR0H + 2 * n] = v >> 8;
+}
+
+static unsigned char mem_read(struct pic *p, unsigned short a){
+	unsigned char f = a & 0x7f;
+
+	if(f >= 0x20){
+		return p->ram[f >= 0x70 ? f : a];
+	}
+	switch(f){
+		case INDF0:
+		case INDF1:
+			return fsr_read(p, fsr(p, f));
+		case PCL:
+			return (p->pc + 1) & 0xff;
+		case INTCON:
+			return (p->ram[INTCON] & ~0x01) | ((p->ram[PIC_IOCAF] & 0x3f) ? 0x01 : 0);
+	}
+	if(f < 0x0c){
+		return p->ram[f];
+	}
+	return sfr_read(p, a);
+}
+
+static void mem_write(struct pic *p, unsigned short a, unsigned char v){
+	unsigned char f = a & 0x7f;
+
+	if(f >= 0x20){
+		p->ram[f >= 0x70 ? f : a] = v;
+		return;
+	}
+	switch(f){
+		case INDF0:
+		case INDF1:
+			fsr_write(p, fsr(p, f), v);
+			return;
+		case BSR:
+			v &= 0x1f;
+			break;
+		case PCLATH:
+			v &= 0x7f;
+			break;
+		case STATUS:
+			v = (p->ram[STATUS] & 0x18) | (v & 0x07);
+			break;
+		case INTCON:
+			v &= ~0x01;
+			break;
+	}
+	if(f < 0x0c){
+		p->ram[f] = v;
+	} else {
+		sfr_write(p, a, v);
+	}
+}
+
+/* Stack */
+
+static int push(struct pic *p, unsigned short address){
+	if(p->sp == PIC_STACK_SIZE){
+		return -1;
+	}
+	p->stack[p->sp++] = address;
+	return 0;
+}
+
+static unsigned short pop(struct pic *p){
+	return p->sp ? p->stack[--p->sp] : 0;
+}
+
+/* Interrupt pending (and enabled) */
+static int irq(struct pic *p){
+	unsigned char intcon = p->ram[INTCON];
+
+	if(!(intcon & 0x80)){
+		return 0;
+	}
+	if((intcon & 0x20) && (intcon & 0x04)){
+		return 1;
+	}
+	if((intcon & 0x08) && (p->ram[PIC_IOCAF] & 0x3f)){
+		return 1;
+	}
+	if((intcon & 0x40) && ((p->ram[PIC_PIE1] & p->ram[PIC_PIR1]) || (p->ram[PIC_PIE2] & p->ram[PIC_PIR2]) ||
+			(p->ram[PIC_PIE3] & p->ram[PIC_PIR3]))){
+		return 1;
+	}
+	return 0;
+}
+
+static const unsigned char shadowed[8] = { STATUS, WREG, BSR, PCLATH, FSR0L, FSR0H, FSR1L, FSR1H };
+
+void pic_reset(struct pic *p){
+	unsigned int i;
+
+	memset(p->ram, 0, sizeof(p->ram));
+	p->pc = 0;
+	p->sp = 0;
+	p->ram[STATUS] = 0x18;
+	p->ram[PIC_OPTION_REG] = 0xff;
+	p->ram[PIC_TRISA] = 0x3f;
+	p->ram[PIC_TRISB] = 0xf0;
+	p->ram[PIC_TRISC] = 0xff;
+	p->ram[PIC_ANSELA] = 0x17;
+	p->ram[PIC_ANSELC] = 0xcf;
+	p->ram[PIC_WPUA] = 0x3f;
+	p->ram[PIC_PR2] = p->ram[PIC_PR4] = p->ram[PIC_PR6] = 0xff;
+	p->ram[PIC_OSCCON] = 0x38;
+	p->ram[PIC_WDTCON] = 0x16;
+	p->ram[PIC_CM1CON0] = p->ram[PIC_CM2CON0] = 0x04;
+	p->ram[PIC_TXSTA] = 0x02;
+	p->ee_unlock = 0;
+	p->t0_value = 0;
+	p->t0_base = p->cycle;
+	p->t1_value = 0;
+	p->t1_base = p->cycle;
+	p->t0_next = p->t2_next = p->t4_next = p->t6_next = p->ad_done = p->ee_done = PIC_NEVER;
+	schedule(p);
+	p->porta_pins = pic_porta_pins(p);
+	for(i=0; i<sizeof(shadowed); i++){
+		p->shadow[i] = 0;
+	}
+}
+
+unsigned char pic_read(struct pic *p, unsigned short address){
+	return mem_read(p, address);
+}
+
+/* Intel HEX parsing */
+
+static int hex_byte(const char *s){
+	int v = 0, i;
+
+	for(i=0; i<2; i++){
+		char c = s[i];
+		v <<= 4;
+		if(c >= '0' && c <= '9'){
+			v |= c - '0';
+		} else if(c >= 'A' && c <= 'F'){
+			v |= c - 'A' + 10;
+		} else if(c >= 'a' && c <= 'f'){
+			v |= c - 'a' + 10;
+		} else {
+			return -1;
+		}
+	}
+	return v;
+}
+
+int pic_load_hex(struct pic *p, const char *filename){
+	char line[600];
+	unsigned long ext = 0;
+	FILE *f = fopen(filename, "r");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+
+	while(fgets(line, sizeof(line), f)){
+		int count, address, type, i;
+
+		if(line[0] != ':'){
+			continue;
+		}
+		count = hex_byte(line + 1);
+		address = (hex_byte(line + 3) << 8) | hex_byte(line + 5);
+		type = hex_byte(line + 7);
+		if(count < 0 || address < 0 || type < 0 || strlen(line) < 11 + 2 * (size_t) count){
+			fprintf(stderr, "%s: malformed record\n", filename);
+			fclose(f);
+			return -1;
+		}
+		if(type == 4){
+			ext = (hex_byte(line + 9) << 8) | hex_byte(line + 11);
+		} else if(type == 0){
+			for(i=0; i<count; i++){
+				unsigned long a = (ext << 16) + address + i;
+				unsigned char b = hex_byte(line + 9 + 2 * i);
+
+				if(a < 2 * PIC_FLASH_WORDS){
+					if(a & 1){
+						p->flash[a >> 1] = (p->flash[a >> 1] & 0x00ff) | ((b & 0x3f) << 8);
+					} else {
+						p->flash[a >> 1] = (p->flash[a >> 1] & 0x3f00) | b;
+					}
+				} else if(a >= HEX_EEPROM_ADDRESS && a < HEX_EEPROM_ADDRESS + 2 * PIC_EEPROM_SIZE && !(a & 1)){
+					p->eeprom[(a - HEX_EEPROM_ADDRESS) >> 1] = b;
+				}
+			}
+		}
+	}
+
+	fclose(f);
+	return 0;
+}
+
+/* Execution */
+
+static void flags_add(struct pic *p, unsigned char a, unsigned char b, unsigned char c){
+	unsigned int r = a + b + c;
+	unsigned char s = p->ram[STATUS] & ~(C | DC | Z);
+
+	if(r & 0x100) s |= C;
+	if(((a & 0x0f) + (b & 0x0f) + c) & 0x10) s |= DC;
+	if(!(r & 0xff)) s |= Z;
+	p->ram[STATUS] = s;
+}
+
+static void flag_z(struct pic *p, unsigned char r){
+	if(r){
+		p->ram[STATUS] &= ~Z;
+	} else {
+		p->ram[STATUS] |= Z;
+	}
+}
+
+static void flag_c(struct pic *p, unsigned char c){
+	if(c){
+		p->ram[STATUS] |= C;
+	} else {
+		p->ram[STATUS] &= ~C;
+	}
+}
+
+/* MOVIW/MOVWI with pre/post increment/decrement */
+static unsigned short fsr_step(struct pic *p, unsigned char n, unsigned char mode){
+	unsigned short a = fsr(p, n);
+
+	switch(mode){
+		case 0:
+			fsr_set(p, n, ++a);
+			return a;
+		case 1:
+			fsr_set(p, n, --a);
+			return a;
+		case 2:
+			fsr_set(p, n, a + 1);
+			return a;
+		default:
+			fsr_set(p, n, a - 1);
+			return a;
+	}
+}
+
+int pic_run(struct pic *p, unsigned long long until){
+	while(p->cycle < until){
+		unsigned short op, npc, target;
+		unsigned char cycles = 1;
+
+		if(p->cycle >= p->next_event){
+			events(p);
+		}
+
+		if(irq(p)){
+			unsigned int i;
+
+			for(i=0; i<sizeof(shadowed); i++){
+				p->shadow[i] = p->ram[shadowed[i]];
+			}
+			if(push(p, p->pc) < 0){
+				return -1;
+			}
+			p->ram[INTCON] &= ~0x80;
+			p->pc = 4;
+			p->cycle += 2;
+			if(p->on_interrupt){
+				p->on_interrupt(p);
+			}
+			continue;
+		}
+
+		op = p->flash[p->pc & (PIC_FLASH_WORDS - 1)];
+		npc = p->pc + 1;
+
+		switch(op >> 12){
+		case 0x0: {
+			/* Byte oriented file register operations */
+			unsigned short a = (p->ram[BSR] << 7) | (op & 0x7f);
+			unsigned char d = op & 0x80, f, r;
+
+			if(op < 0x0100){
+				if(op >= 0x0080){
+					/* MOVWF */
+					mem_write(p, a, W);
+					if((op & 0x7f) == PCL){
+						npc = (p->ram[PCLATH] << 8) | W;
+						cycles = 2;
+					}
+					break;
+				}
+				if(op >= 0x0020 && op < 0x0040){
+					p->ram[BSR] = op & 0x1f;
+					break;
+				}
+				if(op >= 0x0010 && op < 0x0020){
+					unsigned char n = (op >> 2) & 1;
+					unsigned short fa = fsr_step(p, n, op & 0x03);
+					if(op & 0x08){
+						fsr_write(p, fa, W);
+					} else {
+						W = fsr_read(p, fa);
+						flag_z(p, W);
+					}
+					break;
+				}
+				switch(op){
+					case 0x0000:
+						break;
+					case 0x0001:
+					case 0x0063:
+						return -1;
+					case 0x0008:
+						if(p->on_return){
+							p->on_return(p);
+						}
+						npc = pop(p);
+						cycles = 2;
+						break;
+					case 0x0009: {
+						unsigned int i;
+						for(i=0; i<sizeof(shadowed); i++){
+							p->ram[shadowed[i]] = p->shadow[i];
+						}
+						p->ram[INTCON] |= 0x80;
+						if(p->on_retfie){
+							p->on_retfie(p);
+						}
+						npc = pop(p);
+						cycles = 2;
+						break;
+					}
+					case 0x000a:
+						target = (p->ram[PCLATH] << 8) | W;
+						if(push(p, npc) < 0){
+							return -1;
+						}
+						if(p->on_call){
+							p->on_call(p, target);
+						}
+						npc = target;
+						cycles = 2;
+						break;
+					case 0x000b:
+						npc = npc + W;
+						cycles = 2;
+						break;
+					case 0x0064:
+						p->ram[STATUS] |= 0x18;
+						if(p->on_clrwdt){
+							p->on_clrwdt(p);
+						}
+						break;
+					default:
+						/* OPTION and TRIS are not used by sdcc */
+						break;
+				}
+				break;
+			}
+
+			switch((op >> 8) & 0x0f){
+				case 0x1:
+					/* CLRW, CLRF */
+					if(d){
+						mem_write(p, a, 0);
+					} else {
+						W = 0;
+					}
+					p->ram[STATUS] |= Z;
+					break;
+				case 0x2:
+					/* SUBWF */
+					f = mem_read(p, a);
+					r = f - W;
+					flags_add(p, f, ~W, 1);
+					goto store;
+				case 0x3:
+					r = mem_read(p, a) - 1;
+					flag_z(p, r);
+					goto store;
+				case 0x4:
+					r = mem_read(p, a) | W;
+					flag_z(p, r);
+					goto store;
+				case 0x5:
+					r = mem_read(p, a) & W;
+					flag_z(p, r);
+					goto store;
+				case 0x6:
+					r = mem_read(p, a) ^ W;
+					flag_z(p, r);
+					goto store;
+				case 0x7:
+					f = mem_read(p, a);
+					r = f + W;
+					flags_add(p, f, W, 0);
+					goto store;
+				case 0x8:
+					r = mem_read(p, a);
+					flag_z(p, r);
+					goto store;
+				case 0x9:
+					r = ~mem_read(p, a);
+					flag_z(p, r);
+					goto store;
+				case 0xa:
+					r = mem_read(p, a) + 1;
+					flag_z(p, r);
+					goto store;
+				case 0xb:
+					r = mem_read(p, a) - 1;
+					if(!r){
+						npc++;
+						cycles = 2;
+					}
+					goto store;
+				case 0xc:
+					f = mem_read(p, a);
+					r = (f >> 1) | ((p->ram[STATUS] & C) << 7);
+					flag_c(p, f & 0x01);
+					goto store;
+				case 0xd:
+					f = mem_read(p, a);
+					r = (f << 1) | (p->ram[STATUS] & C);
+					flag_c(p, f & 0x80);
+					goto store;
+				case 0xe:
+					f = mem_read(p, a);
+					r = (f << 4) | (f >> 4);
+					goto store;
+				case 0xf:
+					r = mem_read(p, a) + 1;
+					if(!r){
+						npc++;
+						cycles = 2;
+					}
+					goto store;
+			}
+			break;
+		store:
+			if(d){
+				mem_write(p, a, r);
+				if((op & 0x7f) == PCL){
+					npc = (p->ram[PCLATH] << 8) | r;
+					cycles = 2;
+				}
+			} else {
+				W = r;
+			}
+			break;
+		}
+		case 0x1: {
+			/* Bit oriented file register operations */
+			unsigned short a = (p->ram[BSR] << 7) | (op & 0x7f);
+			unsigned char bit = 1 << ((op >> 7) & 0x07);
+
+			switch((op >> 10) & 0x03){
+				case 0:
+					mem_write(p, a, mem_read(p, a) & ~bit);
+					break;
+				case 1:
+					mem_write(p, a, mem_read(p, a) | bit);
+					break;
+				case 2:
+					if(!(mem_read(p, a) & bit)){
+						npc++;
+						cycles = 2;
+					}
+					break;
+				case 3:
+					if(mem_read(p, a) & bit){
+						npc++;
+						cycles = 2;
+					}
+					break;
+			}
+			if((op & 0x7f) == PCL && (op & 0x0800) == 0){
+				npc = (p->ram[PCLATH] << 8) | mem_read(p, a);
+				cycles = 2;
+			}
+			break;
+		}
+		case 0x2:
+			/* CALL, GOTO */
+			target = ((p->ram[PCLATH] & 0x78) << 8) | (op & 0x7ff);
+			if(!(op & 0x0800)){
+				if(push(p, npc) < 0){
+					return -1;
+				}
+				if(p->on_call){
+					p->on_call(p, target);
+				}
+			}
+			npc = target;
+			cycles = 2;
+			break;
+		case 0x3: {
+			/* Literal and control operations */
+			unsigned char k = op & 0xff;
+			unsigned short a = (p->ram[BSR] << 7) | (op & 0x7f);
+			unsigned char d = op & 0x80, f, r;
+
+			switch((op >> 8) & 0x0f){
+				case 0x0:
+					W = k;
+					break;
+				case 0x1:
+					if(op & 0x80){
+						/* MOVLP */
+						p->ram[PCLATH] = op & 0x7f;
+					} else {
+						/* ADDFSR */
+						unsigned char n = (op >> 6) & 1;
+						short kk = (op & 0x20) ? (short) (op & 0x3f) - 64 : (short) (op & 0x3f);
+						fsr_set(p, n, fsr(p, n) + kk);
+					}
+					break;
+				case 0x2:
+				case 0x3: {
+					/* BRA */
+					short kk = (op & 0x100) ? (short) (op & 0x1ff) - 512 : (short) (op & 0x1ff);
+					npc = npc + kk;
+					cycles = 2;
+					break;
+				}
+				case 0x4:
+					/* RETLW */
+					W = k;
+					if(p->on_return){
+						p->on_return(p);
+					}
+					npc = pop(p);
+					cycles = 2;
+					break;
+				case 0x5:
+					/* LSLF */
+					f = mem_read(p, a);
+					r = f << 1;
+					flag_c(p, f & 0x80);
+					flag_z(p, r);
+					goto lstore;
+				case 0x6:
+					/* LSRF */
+					f = mem_read(p, a);
+					r = f >> 1;
+					flag_c(p, f & 0x01);
+					flag_z(p, r);
+					goto lstore;
+				case 0x7:
+					/* ASRF */
+					f = mem_read(p, a);
+					r = (f >> 1) | (f & 0x80);
+					flag_c(p, f & 0x01);
+					flag_z(p, r);
+					goto lstore;
+				case 0x8:
+					W |= k;
+					flag_z(p, W);
+					break;
+				case 0x9:
+					W &= k;
+					flag_z(p, W);
+					break;
+				case 0xa:
+					W ^= k;
+					flag_z(p, W);
+					break;
+				case 0xb: {
+					/* SUBWFB */
+					unsigned char c = p->ram[STATUS] & C;
+					f = mem_read(p, a);
+					r = f - W - !c;
+					flags_add(p, f, ~W, c);
+					goto lstore;
+				}
+				case 0xc: {
+					/* SUBLW */
+					unsigned char w = W;
+					W = k - w;
+					flags_add(p, k, ~w, 1);
+					break;
+				}
+				case 0xd: {
+					/* ADDWFC */
+					unsigned char c = p->ram[STATUS] & C;
+					f = mem_read(p, a);
+					r = f + W + c;
+					flags_add(p, f, W, c);
+					goto lstore;
+				}
+				case 0xe: {
+					unsigned char w = W;
+					W = w + k;
+					flags_add(p, w, k, 0);
+					break;
+				}
+				case 0xf: {
+					/* MOVIW/MOVWI k[FSRn] */
+					unsigned char n = (op >> 6) & 1;
+					short kk = (op & 0x20) ? (short) (op & 0x3f) - 64 : (short) (op & 0x3f);
+					unsigned short fa = fsr(p, n) + kk;
+					if(op & 0x80){
+						fsr_write(p, fa, W);
+					} else {
+						W = fsr_read(p, fa);
+						flag_z(p, W);
+					}
+					break;
+				}
+			}
+			break;
+		lstore:
+			if(d){
+				mem_write(p, a, r);
+				if((op & 0x7f) == PCL){
+					npc = (p->ram[PCLATH] << 8) | r;
+					cycles = 2;
+				}
+			} else {
+				W = r;
+			}
+			break;
+		}
+		}
+
+		p->pc = npc & 0x7fff;
+		p->cycle += cycles;
+	}
+	return 0;
+}
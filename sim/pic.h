@@ -0,0 +1,160 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Instruction set simulator of the PIC16F1828 (enhanced mid-range core),
+ * for running the firmware HEX files with cycle counts.
+ *
+ * Every instruction takes one instruction cycle (1us at 4MHz), or two for
+ * branches, calls, returns, skips taken and writes to PCL. The peripherals
+ * used by the firmware are modelled: timers 0/2/4/6, data EEPROM (4ms write
+ * time), A/D converter (conversion in 23 cycles, at FOSC/8), port A and C
+ * inputs and interrupt on change on port A.
+ *
+ */
+
+#ifndef __PIC_H__
+#define __PIC_H__
+
+#define PIC_FLASH_WORDS		4096
+#define PIC_RAM_SIZE		4096	/* 32 banks of 128 bytes */
+#define PIC_EEPROM_SIZE		256
+#define PIC_STACK_SIZE		16
+#define PIC_NEVER			(~0ULL)
+
+/* Special function registers (bank << 7 | address) */
+#define PIC_STATUS			0x003
+#define PIC_WREG			0x009
+#define PIC_PCLATH			0x00a
+#define PIC_INTCON			0x00b
+#define PIC_PORTA			0x00c
+#define PIC_PORTB			0x00d
+#define PIC_PORTC			0x00e
+#define PIC_PIR1			0x011
+#define PIC_PIR2			0x012
+#define PIC_PIR3			0x013
+#define PIC_TMR0			0x015
+#define PIC_TMR1L			0x016
+#define PIC_TMR1H			0x017
+#define PIC_T1CON			0x018
+#define PIC_T1GCON			0x019
+#define PIC_TMR2			0x01a
+#define PIC_PR2				0x01b
+#define PIC_T2CON			0x01c
+#define PIC_TRISA			0x08c
+#define PIC_TRISB			0x08d
+#define PIC_TRISC			0x08e
+#define PIC_PIE1			0x091
+#define PIC_PIE2			0x092
+#define PIC_PIE3			0x093
+#define PIC_OPTION_REG		0x095
+#define PIC_WDTCON			0x097
+#define PIC_OSCCON			0x099
+#define PIC_ADRESL			0x09b
+#define PIC_ADRESH			0x09c
+#define PIC_ADCON0			0x09d
+#define PIC_ADCON1			0x09e
+#define PIC_LATA			0x10c
+#define PIC_LATB			0x10d
+#define PIC_LATC			0x10e
+#define PIC_CM1CON0			0x111
+#define PIC_CM2CON0			0x113
+#define PIC_ANSELA			0x18c
+#define PIC_ANSELC			0x18e
+#define PIC_EEADRL			0x191
+#define PIC_EEADRH			0x192
+#define PIC_EEDATL			0x193
+#define PIC_EEDATH			0x194
+#define PIC_EECON1			0x195
+#define PIC_EECON2			0x196
+#define PIC_RCSTA			0x19d
+#define PIC_TXSTA			0x19e
+#define PIC_WPUA			0x20c
+#define PIC_IOCAP			0x391
+#define PIC_IOCAN			0x392
+#define PIC_IOCAF			0x393
+#define PIC_TMR4			0x415
+#define PIC_PR4				0x416
+#define PIC_T4CON			0x417
+#define PIC_TMR6			0x41c
+#define PIC_PR6				0x41d
+#define PIC_T6CON			0x41e
+
+#define PIC_EEPROM_WRITE_CYCLES		4000
+#define PIC_AD_CONVERSION_CYCLES	23
+
+struct pic {
+	unsigned short flash[PIC_FLASH_WORDS];
+	unsigned char ram[PIC_RAM_SIZE];
+	unsigned char eeprom[PIC_EEPROM_SIZE];
+
+	unsigned short pc;
+	unsigned short stack[PIC_STACK_SIZE];
+	unsigned char sp;						/* number of return addresses on the stack */
+	unsigned char shadow[8];				/* context saved on interrupt */
+	unsigned long long cycle;				/* instruction cycles since power on (us) */
+
+	/* Inputs */
+	unsigned int ad[32];					/* 10 bit A/D result per channel */
+	unsigned char porta_in;					/* levels driven on port A pins from outside */
+	unsigned char portc_in;					/* levels on port C pins (pressed buttons) */
+
+	/* Peripheral state */
+	unsigned char porta_pins;				/* last port A pin levels, for interrupt on change */
+	unsigned long long t0_base;				/* cycle when TMR0 had t0_value */
+	unsigned char t0_value;
+	unsigned long long t1_base;				/* cycle when TMR1 had t1_value */
+	unsigned short t1_value;
+	unsigned long long t0_next, t2_next, t4_next, t6_next, ad_done, ee_done;
+	unsigned long long next_event;
+	unsigned char ee_unlock;
+	unsigned long eeprom_writes;
+
+	/* Hooks (may be NULL) */
+	void *user;
+	void (*on_call)(struct pic *p, unsigned short target);
+	void (*on_return)(struct pic *p);
+	void (*on_interrupt)(struct pic *p);
+	void (*on_retfie)(struct pic *p);
+	void (*on_clrwdt)(struct pic *p);
+};
+
+/* Power on reset, flash and EEPROM are kept */
+void pic_reset(struct pic *p);
+
+/* Load an Intel HEX file, program memory and EEPROM (config words are ignored).
+ * return: 0 on success, -1 on error
+ */
+int pic_load_hex(struct pic *p, const char *filename);
+
+/* Run until the cycle counter reaches the given cycle.
+ * return: 0, or -1 on a stopping condition (RESET, SLEEP or stack overflow)
+ */
+int pic_run(struct pic *p, unsigned long long until);
+
+/* Drive port A pins from outside (pin change interrupt on edges) */
+void pic_set_porta(struct pic *p, unsigned char levels);
+
+/* Read a register (with the side effects of reading it from the core) */
+unsigned char pic_read(struct pic *p, unsigned short address);
+
+/* Pin levels of port A (inputs and outputs) */
+unsigned char pic_porta_pins(struct pic *p);
+
+#endif // __PIC_H__
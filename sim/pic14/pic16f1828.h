@@ -0,0 +1,233 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Host replacement for the sdcc pic14/pic16f1828.h header.
+ *
+ * The special function registers used by the firmware are plain variables
+ * here, backed by the device model in sim.c. Registers with side effects
+ * (EEPROM access, A/D conversion and port inputs) are accessed through a
+ * sync function, that lets the device model act on the register state
+ * before each access.
+ *
+ * The firmware is built with int as 16 bits (as sdcc does for pic14), the
+ * device model and harness (SIM_DEVICE defined) are not.
+ *
+ */
+
+#ifndef __PIC16F1828_H__
+#define __PIC16F1828_H__
+
+/* sdcc keywords and inline assembly */
+#define __code
+#define __at
+#define __naked
+#define __asm
+#define __endasm
+#define _CONFIG1
+#define _CONFIG2
+#define CLRWDT		sim_clrwdt()
+#define RESET		sim_reset()
+
+extern void sim_clrwdt(void);
+extern void sim_reset(void);
+
+/* Registers without bit access */
+extern volatile unsigned char TMR0, TMR1L, TMR1H, T1CON, TMR2, TMR4, TMR6, PR2, PR4, PR6;
+extern volatile unsigned char EEADRL, EEADRH, EEDATL, EEDATH, EECON2;
+extern volatile unsigned char ADRESL, ADRESH, ANSELC, WDTCON;
+
+#define SIM_BITS(name, b0, b1, b2, b3, b4, b5, b6, b7) \
+	typedef union { \
+		struct { \
+			unsigned char b0:1; unsigned char b1:1; unsigned char b2:1; unsigned char b3:1; \
+			unsigned char b4:1; unsigned char b5:1; unsigned char b6:1; unsigned char b7:1; \
+		}; \
+		unsigned char reg; \
+	} __##name##bits_t; \
+	extern volatile __##name##bits_t name##bits;
+
+SIM_BITS(INTCON,	IOCIF,	INTF,	TMR0IF,	IOCIE,	INTE,	TMR0IE,	PEIE,	GIE)
+SIM_BITS(OPTION_REG,PS0,	PS1,	PS2,	PSA,	TMR0SE,	TMR0CS,	INTEDG,	NOT_WPUEN)
+SIM_BITS(PIR1,		TMR1IF,	TMR2IF,	CCP1IF,	SSP1IF,	TXIF,	RCIF,	ADIF,	TMR1GIF)
+SIM_BITS(PIE1,		TMR1IE,	TMR2IE,	CCP1IE,	SSP1IE,	TXIE,	RCIE,	ADIE,	TMR1GIE)
+SIM_BITS(PIR2,		CCP2IF,	PIR2_1,	PIR2_2,	BCL1IF,	EEIF,	C1IF,	C2IF,	OSFIF)
+SIM_BITS(PIR3,		PIR3_0,	TMR4IF,	PIR3_2,	TMR6IF,	CCP3IF,	CCP4IF,	PIR3_6,	PIR3_7)
+SIM_BITS(T1GCON,	T1GSS0,	T1GSS1,	T1GVAL,	T1GGO,	T1GSPM,	T1GTM,	T1GPOL,	TMR1GE)
+SIM_BITS(T2CON,		T2CKPS0,T2CKPS1,TMR2ON,	T2OUTPS0,T2OUTPS1,T2OUTPS2,T2OUTPS3,T2CON_7)
+SIM_BITS(T4CON,		T4CKPS0,T4CKPS1,TMR4ON,	T4OUTPS0,T4OUTPS1,T4OUTPS2,T4OUTPS3,T4CON_7)
+SIM_BITS(T6CON,		T6CKPS0,T6CKPS1,TMR6ON,	T6OUTPS0,T6OUTPS1,T6OUTPS2,T6OUTPS3,T6CON_7)
+SIM_BITS(CM1CON0,	C1SYNC,	C1HYS,	C1SP,	CM1CON0_3,C1POL,C1OE,	C1OUT,	C1ON)
+SIM_BITS(CM2CON0,	C2SYNC,	C2HYS,	C2SP,	CM2CON0_3,C2POL,C2OE,	C2OUT,	C2ON)
+SIM_BITS(TXSTA,		TX9D,	TRMT,	BRGH,	SENDB,	SYNC,	TXEN,	TX9,	CSRC)
+SIM_BITS(RCSTA,		RX9D,	OERR,	FERR,	ADDEN,	CREN,	SREN,	RX9,	SPEN)
+SIM_BITS(ADCON0,	ADON,	ADGO,	CHS0,	CHS1,	CHS2,	CHS3,	CHS4,	ADCON0_7)
+SIM_BITS(ADCON1,	ADPREF0,ADPREF1,ADNREF,	ADCON1_3,ADCS0,	ADCS1,	ADCS2,	ADFM)
+SIM_BITS(EECON1,	RD,		WR,		WREN,	WRERR,	FREE,	LWLO,	CFGS,	EEPGD)
+SIM_BITS(OSCCON,	SCS0,	SCS1,	OSCCON_2,IRCF0,	IRCF1,	IRCF2,	IRCF3,	SPLLEN)
+SIM_BITS(PORTA,		RA0,	RA1,	RA2,	RA3,	RA4,	RA5,	PORTA_6,PORTA_7)
+SIM_BITS(LATA,		LATA0,	LATA1,	LATA2,	LATA3,	LATA4,	LATA5,	LATA_6,	LATA_7)
+SIM_BITS(TRISA,		TRISA0,	TRISA1,	TRISA2,	TRISA3,	TRISA4,	TRISA5,	TRISA_6,TRISA_7)
+SIM_BITS(ANSELA,	ANSA0,	ANSA1,	ANSA2,	ANSELA_3,ANSA4,	ANSELA_5,ANSELA_6,ANSELA_7)
+SIM_BITS(WPUA,		WPUA0,	WPUA1,	WPUA2,	WPUA3,	WPUA4,	WPUA5,	WPUA_6,	WPUA_7)
+SIM_BITS(IOCAP,		IOCAP0,	IOCAP1,	IOCAP2,	IOCAP3,	IOCAP4,	IOCAP5,	IOCAP_6,IOCAP_7)
+SIM_BITS(IOCAN,		IOCAN0,	IOCAN1,	IOCAN2,	IOCAN3,	IOCAN4,	IOCAN5,	IOCAN_6,IOCAN_7)
+SIM_BITS(IOCAF,		IOCAF0,	IOCAF1,	IOCAF2,	IOCAF3,	IOCAF4,	IOCAF5,	IOCAF_6,IOCAF_7)
+SIM_BITS(PORTB,		PORTB_0,PORTB_1,PORTB_2,PORTB_3,RB4,	RB5,	RB6,	RB7)
+SIM_BITS(LATB,		LATB_0,	LATB_1,	LATB_2,	LATB_3,	LATB4,	LATB5,	LATB6,	LATB7)
+SIM_BITS(TRISB,		TRISB_0,TRISB_1,TRISB_2,TRISB_3,TRISB4,	TRISB5,	TRISB6,	TRISB7)
+SIM_BITS(PORTC,		RC0,	RC1,	RC2,	RC3,	RC4,	RC5,	RC6,	RC7)
+SIM_BITS(LATC,		LATC0,	LATC1,	LATC2,	LATC3,	LATC4,	LATC5,	LATC6,	LATC7)
+SIM_BITS(TRISC,		TRISC0,	TRISC1,	TRISC2,	TRISC3,	TRISC4,	TRISC5,	TRISC6,	TRISC7)
+
+#undef SIM_BITS
+
+/* Whole registers */
+#define INTCON		INTCONbits.reg
+#define OPTION_REG	OPTION_REGbits.reg
+#define PIR1		PIR1bits.reg
+#define PIE1		PIE1bits.reg
+#define PIR2		PIR2bits.reg
+#define PIR3		PIR3bits.reg
+#define T1GCON		T1GCONbits.reg
+#define T2CON		T2CONbits.reg
+#define T4CON		T4CONbits.reg
+#define T6CON		T6CONbits.reg
+#define CM1CON0		CM1CON0bits.reg
+#define CM2CON0		CM2CON0bits.reg
+#define TXSTA		TXSTAbits.reg
+#define RCSTA		RCSTAbits.reg
+#define ADCON0		ADCON0bits.reg
+#define ADCON1		ADCON1bits.reg
+#define EECON1		EECON1bits.reg
+#define OSCCON		OSCCONbits.reg
+#define PORTA		PORTAbits.reg
+#define LATA		LATAbits.reg
+#define TRISA		TRISAbits.reg
+#define ANSELA		ANSELAbits.reg
+#define WPUA		WPUAbits.reg
+#define IOCAP		IOCAPbits.reg
+#define IOCAN		IOCANbits.reg
+#define IOCAF		IOCAFbits.reg
+#define PORTB		PORTBbits.reg
+#define LATB		LATBbits.reg
+#define TRISB		TRISBbits.reg
+#define PORTC		PORTCbits.reg
+#define LATC		LATCbits.reg
+#define TRISC		TRISCbits.reg
+
+/* Bits */
+#define GIE			INTCONbits.GIE
+#define PEIE		INTCONbits.PEIE
+#define TMR0IE		INTCONbits.TMR0IE
+#define IOCIE		INTCONbits.IOCIE
+#define TMR0IF		INTCONbits.TMR0IF
+#define IOCIF		INTCONbits.IOCIF
+#define PS0			OPTION_REGbits.PS0
+#define PS1			OPTION_REGbits.PS1
+#define PS2			OPTION_REGbits.PS2
+#define PSA			OPTION_REGbits.PSA
+#define TMR0CS		OPTION_REGbits.TMR0CS
+#define TMR2IF		PIR1bits.TMR2IF
+#define TMR2IE		PIE1bits.TMR2IE
+#define EEIF		PIR2bits.EEIF
+#define TMR4IF		PIR3bits.TMR4IF
+#define TMR6IF		PIR3bits.TMR6IF
+#define TMR1GE		T1GCONbits.TMR1GE
+#define TMR2ON		T2CONbits.TMR2ON
+#define TMR4ON		T4CONbits.TMR4ON
+#define TMR6ON		T6CONbits.TMR6ON
+#define C1SYNC		CM1CON0bits.C1SYNC
+#define C1HYS		CM1CON0bits.C1HYS
+#define C1SP		CM1CON0bits.C1SP
+#define C1POL		CM1CON0bits.C1POL
+#define C2SYNC		CM2CON0bits.C2SYNC
+#define C2HYS		CM2CON0bits.C2HYS
+#define C2SP		CM2CON0bits.C2SP
+#define C2POL		CM2CON0bits.C2POL
+#define TX9			TXSTAbits.TX9
+#define RX9			RCSTAbits.RX9
+#define ADON		ADCON0bits.ADON
+#define ADGO		ADCON0bits.ADGO
+#define ADCS0		ADCON1bits.ADCS0
+#define ADFM		ADCON1bits.ADFM
+#define RD			EECON1bits.RD
+#define WR			EECON1bits.WR
+#define WREN		EECON1bits.WREN
+#define CFGS		EECON1bits.CFGS
+#define EEPGD		EECON1bits.EEPGD
+#define RA1			PORTAbits.RA1
+#define LATA0		LATAbits.LATA0
+#define LATA1		LATAbits.LATA1
+#define LATA4		LATAbits.LATA4
+#define LATA5		LATAbits.LATA5
+#define TRISA1		TRISAbits.TRISA1
+#define WPUA1		WPUAbits.WPUA1
+#define IOCAP1		IOCAPbits.IOCAP1
+#define IOCAF1		IOCAFbits.IOCAF1
+#define RC3			PORTCbits.RC3
+#define RC4			PORTCbits.RC4
+#define RC6			PORTCbits.RC6
+#define RC7			PORTCbits.RC7
+
+/* Bit masks */
+#define _ADON		0x01
+#define _CHS0		0x04
+#define _CHS1		0x08
+#define _ANSA1		0x02
+#define _ANSA2		0x04
+
+#if !defined(SIM_DEVICE)
+
+/* Let the device model act before accesses with side effects */
+extern void sim_eeprom_sync(void);
+extern void sim_adc_sync(void);
+extern void sim_port_sync(void);
+
+#define SIM_SYNC(fn, r)	(*(fn(), &(r)))
+
+#undef EEDATL
+#define EEDATL		SIM_SYNC(sim_eeprom_sync, EEDATL)
+#undef RD
+#define RD			SIM_SYNC(sim_eeprom_sync, EECON1bits).RD
+#undef WR
+#define WR			SIM_SYNC(sim_eeprom_sync, EECON1bits).WR
+#undef WREN
+#define WREN		SIM_SYNC(sim_eeprom_sync, EECON1bits).WREN
+#undef ADGO
+#define ADGO		SIM_SYNC(sim_adc_sync, ADCON0bits).ADGO
+#undef RA1
+#define RA1			SIM_SYNC(sim_port_sync, PORTAbits).RA1
+#undef PORTC
+#define PORTC		SIM_SYNC(sim_port_sync, PORTCbits).reg
+#undef RC3
+#define RC3			SIM_SYNC(sim_port_sync, PORTCbits).RC3
+#undef RC4
+#define RC4			SIM_SYNC(sim_port_sync, PORTCbits).RC4
+#undef RC6
+#define RC6			SIM_SYNC(sim_port_sync, PORTCbits).RC6
+#undef RC7
+#define RC7			SIM_SYNC(sim_port_sync, PORTCbits).RC7
+
+/* sdcc int is 16 bits */
+#define int			short
+
+#endif // !SIM_DEVICE
+
+#endif // __PIC16F1828_H__
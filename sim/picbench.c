@@ -0,0 +1,631 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Run a firmware HEX file on the instruction set simulator with scripted
+ * A/D, button and COM stimuli, and report the cycles spent per function,
+ * per main loop pass and in the interrupt service routine.
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#define SIM_DEVICE
+#include "stc1000p.h"
+#include "pic.h"
+
+#define BENCH_SECOND				1000000ULL
+#define BENCH_MINUTE				(60 * BENCH_SECOND)
+
+/* Port C button inputs and port A outputs */
+#define BTN_PWR				0x80
+#define BTN_S				0x10
+#define BTN_UP				0x40
+#define BTN_DOWN			0x08
+#define AD_PROBE1			2
+#define AD_PROBE2			1
+#define OUT_ALARM			0x01
+#define OUT_COOLING			0x10
+#define OUT_HEATING			0x20
+
+#define MAX_FRAMES			64
+
+struct stats {
+	unsigned long count;
+	unsigned long min, max;
+	unsigned long long sum;
+};
+
+struct frame {
+	unsigned short address;
+	unsigned char depth;
+	unsigned long long start;
+	unsigned long long isr;
+};
+
+static struct pic pic;
+static struct stats functions[PIC_FLASH_WORDS];
+static char *names[PIC_FLASH_WORDS];
+static struct stats isr, loop, tick;
+static struct frame frames[MAX_FRAMES];
+static unsigned int nframes;
+static unsigned long long isr_start, isr_cycles, loop_start, loop_isr;
+static unsigned char loop_tmr4;
+static unsigned long long loop_t4_next;
+
+/* Scripted button presses (time, buttons, duration) */
+static const struct {
+	unsigned long long time;
+	unsigned char buttons;
+	unsigned long long duration;
+} presses[] = {
+	{ 5 * BENCH_SECOND, BTN_S, 300000 },			/* Enter menu */
+	{ 7 * BENCH_SECOND, BTN_UP, 300000 },			/* Browse */
+	{ 9 * BENCH_SECOND, BTN_UP, 300000 },
+	{ 11 * BENCH_SECOND, BTN_DOWN, 300000 },
+	{ 13 * BENCH_SECOND, BTN_S, 300000 },			/* Select item */
+	{ 15 * BENCH_SECOND, BTN_UP, 4 * BENCH_SECOND },	/* Change value (accelerated) */
+	{ 21 * BENCH_SECOND, BTN_DOWN, 4 * BENCH_SECOND },
+	{ 27 * BENCH_SECOND, BTN_S, 300000 },			/* Store */
+	{ 60 * BENCH_SECOND, BTN_UP, 300000 },		/* Show set point */
+	{ 70 * BENCH_SECOND, BTN_DOWN, 300000 },
+	{ 90 * BENCH_SECOND, BTN_PWR, 300000 },		/* Power off */
+	{ 100 * BENCH_SECOND, BTN_PWR, 300000 },		/* and on again */
+};
+
+#define MENU_ITEM_NAME(name, led10ch, led1ch, led01ch, type, default_value) \
+	{ #name, EEADR_MENU_ITEM(name), MENU_TYPE_IS_TEMPERATURE(type) },
+
+static const struct {
+	const char *name;
+	unsigned char eeadr;
+	unsigned char decimal;
+} menu_items[] = {
+	MENU_DATA(MENU_ITEM_NAME)
+};
+
+static void stats_add(struct stats *s, unsigned long v){
+	if(!s->count || v < s->min){
+		s->min = v;
+	}
+	if(v > s->max){
+		s->max = v;
+	}
+	s->sum += v;
+	s->count++;
+}
+
+static void stats_print(const char *item, const struct stats *s){
+	if(s->count){
+		printf("%s\t%s\t%lu\t%lu\t%llu\t%lu\n", SIM_VARIANT, item, s->count, s->min,
+				(s->sum + s->count / 2) / s->count, s->max);
+	}
+}
+
+/* Hooks from the simulator */
+
+static void on_call(struct pic *p, unsigned short target){
+	if(nframes < MAX_FRAMES){
+		frames[nframes].address = target & (PIC_FLASH_WORDS - 1);
+		frames[nframes].depth = p->sp;
+		frames[nframes].start = p->cycle;
+		frames[nframes].isr = isr_cycles;
+	}
+	nframes++;
+}
+
+static void on_return(struct pic *p){
+	if(nframes && nframes <= MAX_FRAMES && frames[nframes - 1].depth == p->sp){
+		struct frame *f = &frames[--nframes];
+		stats_add(&functions[f->address], p->cycle + 2 - f->start - (isr_cycles - f->isr));
+	} else if(nframes > MAX_FRAMES){
+		nframes--;
+	}
+}
+
+static void on_interrupt(struct pic *p){
+	isr_start = p->cycle - 2;
+}
+
+static void on_retfie(struct pic *p){
+	unsigned long c = p->cycle + 2 - isr_start;
+	stats_add(&isr, c);
+	isr_cycles += c;
+}
+
+/* Main loop pass ends when the watchdog is cleared, the pass that handles the
+ * timer 4 flag is the 60ms tick (with the 1s section every 16th time)
+ */
+static void on_clrwdt(struct pic *p){
+	unsigned char tmr4 = p->ram[PIC_PIR3] & 0x02;
+
+	if(loop_start){
+		unsigned long c = p->cycle + 1 - loop_start - (isr_cycles - loop_isr);
+		stats_add(&loop, c);
+		if((loop_tmr4 || loop_t4_next <= p->cycle) && !tmr4){
+			stats_add(&tick, c);
+		}
+	}
+	loop_start = p->cycle + 1;
+	loop_isr = isr_cycles;
+	loop_tmr4 = tmr4;
+	loop_t4_next = p->t4_next;
+}
+
+/* Function names from a gplink map file (-Wl-m), where the symbols in program
+ * memory are given as byte or word addresses depending on gputils version.
+ * The interpretation where more symbols are targets of a CALL is used.
+ */
+static int load_map(const char *filename){
+	char line[256], name[128], address[32], location[32];
+	unsigned long addr[PIC_FLASH_WORDS * 2];
+	char *sym[PIC_FLASH_WORDS * 2];
+	unsigned char called[PIC_FLASH_WORDS] = {0};
+	unsigned int n = 0, i, words = 0, bytes = 0;
+	FILE *f = fopen(filename, "r");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+	while(fgets(line, sizeof(line), f) && n < sizeof(addr)/sizeof(addr[0])){
+		if(sscanf(line, "%127s %31s %31s", name, address, location) == 3 &&
+				!strncmp(address, "0x", 2) && !strcmp(location, "program")){
+			addr[n] = strtoul(address, NULL, 16);
+			sym[n] = strdup(name[0] == '_' ? name + 1 : name);
+			n++;
+		}
+	}
+	fclose(f);
+
+	for(i=0; i<PIC_FLASH_WORDS; i++){
+		if((pic.flash[i] & 0x3800) == 0x2000){
+			called[pic.flash[i] & 0x7ff] = 1;
+		}
+	}
+	for(i=0; i<n; i++){
+		if(addr[i] < PIC_FLASH_WORDS && called[addr[i] & 0x7ff]){
+			words++;
+		}
+		if(!(addr[i] & 1) && addr[i] / 2 < PIC_FLASH_WORDS && called[(addr[i] / 2) & 0x7ff]){
+			bytes++;
+		}
+	}
+	for(i=0; i<n; i++){
+		unsigned long a = bytes > words ? addr[i] / 2 : addr[i];
+		if(a < PIC_FLASH_WORDS && !names[a]){
+			names[a] = sym[i];
+		} else {
+			free(sym[i]);
+		}
+	}
+	return 0;
+}
+
+static int by_name(const void *a, const void *b){
+	return strcmp(names[*(const unsigned short *) a], names[*(const unsigned short *) b]);
+}
+
+static int parse_symbol(const char *s){
+	const char *eq = strchr(s, '=');
+	unsigned long a;
+
+	if(!eq || eq == s || (a = strtoul(eq + 1, NULL, 0)) >= PIC_FLASH_WORDS){
+		return -1;
+	}
+	names[a] = strndup(s, eq - s);
+	return 0;
+}
+
+static int parse_config(const char *s){
+	char name[16];
+	const char *eq = strchr(s, '=');
+	unsigned char i, eeadr;
+	double value;
+	int v;
+
+	if(!eq || eq == s || (size_t) (eq - s) >= sizeof(name)){
+		return -1;
+	}
+	memcpy(name, s, eq - s);
+	name[eq - s] = 0;
+	value = atof(eq + 1);
+
+	if(isdigit((unsigned char) name[0])){
+		eeadr = atoi(name);
+		v = (int) value;
+	} else {
+		for(i=0; i<sizeof(menu_items)/sizeof(menu_items[0]); i++){
+			if(!strcmp(menu_items[i].name, name)){
+				break;
+			}
+		}
+		if(i == sizeof(menu_items)/sizeof(menu_items[0])){
+			return -1;
+		}
+		eeadr = menu_items[i].eeadr;
+		v = (int) (menu_items[i].decimal ? value * 10.0 : value);
+	}
+	if(eeadr >= PIC_EEPROM_SIZE / 2){
+		return -1;
+	}
+	pic.eeprom[eeadr << 1] = v & 0xff;
+	pic.eeprom[(eeadr << 1) + 1] = (v >> 8) & 0xff;
+	return 0;
+}
+
+#if defined(COM)
+/* COM master, bit banging RA1 with the timing of com.ino */
+
+#define COM_HIGH			1
+#define COM_RELEASE			2
+#define COM_SAMPLE			3
+#define COM_MAX_STEPS		(8 * 3 * 10)
+
+static struct {
+	unsigned long long at;
+	unsigned char action;
+} com_steps[COM_MAX_STEPS];
+static unsigned int com_nsteps, com_step;
+static unsigned long long com_t;
+static unsigned char com_tx[6], com_rx[4], com_nrx, com_ntx;
+static unsigned long com_transactions, com_errors;
+static unsigned int com_value;
+
+static void com_add(unsigned long long at, unsigned char action){
+	com_steps[com_nsteps].at = at;
+	com_steps[com_nsteps].action = action;
+	com_nsteps++;
+}
+
+static void com_write_byte(unsigned char data){
+	unsigned char i;
+
+	com_tx[com_ntx++] = data;
+	for(i=0; i<8; i++){
+		com_add(com_t, COM_HIGH);
+		if(!((data << i) & 0x80)){
+			com_add(com_t + 7, COM_RELEASE);
+		}
+		com_add(com_t + 407, COM_RELEASE);
+		com_t += 507;
+	}
+	com_t += 500;
+}
+
+static void com_read_byte(){
+	unsigned char i;
+
+	for(i=0; i<8; i++){
+		com_add(com_t, COM_HIGH);
+		com_add(com_t + 7, COM_RELEASE);
+		com_add(com_t + 207, COM_SAMPLE);
+		com_t += 507;
+	}
+	com_t += 500;
+}
+
+/* Check the reply to the last transaction */
+static void com_check(){
+	unsigned char i, x = 0;
+
+	if(!com_ntx){
+		return;
+	}
+	if(com_tx[0] == COM_WRITE_EEPROM){
+		if(com_rx[0] != COM_ACK){
+			com_errors++;
+		}
+	} else {
+		for(i=0; i<com_ntx; i++){
+			x ^= com_tx[i];
+		}
+		if(com_rx[3] != COM_ACK || com_rx[2] != (x ^ com_rx[0] ^ com_rx[1])){
+			com_errors++;
+		} else if(com_tx[0] == COM_READ_EEPROM){
+			com_value = (com_rx[0] << 8) | com_rx[1];
+		}
+	}
+	com_transactions++;
+}
+
+/* Queue the next transaction of the script: read temperature, outputs and
+ * EEPROM, and write back the value read from EEPROM
+ */
+static void com_start(unsigned long long now){
+	static unsigned char address;
+	unsigned char i;
+
+	com_check();
+
+	com_nsteps = com_step = com_ntx = com_nrx = 0;
+	memset(com_rx, 0, sizeof(com_rx));
+	com_t = now;
+
+	switch(com_transactions % 5){
+		case 0:
+			com_write_byte(COM_READ_TEMP);
+			break;
+		case 1:
+			com_write_byte(COM_READ_COOLING);
+			break;
+		case 2:
+			com_write_byte(COM_READ_HEATING);
+			break;
+		case 3:
+			address = (address + 1) % EEADR_POWER_ON;
+			com_write_byte(COM_READ_EEPROM);
+			com_write_byte(address);
+			break;
+		case 4:
+			com_write_byte(COM_WRITE_EEPROM);
+			com_write_byte(address);
+			com_write_byte(com_value >> 8);
+			com_write_byte(com_value);
+			com_write_byte(COM_WRITE_EEPROM ^ address ^ (com_value >> 8) ^ (com_value & 0xff));
+			com_t += 6000;
+			com_read_byte();
+			return;
+	}
+	for(i=0; i<4; i++){
+		com_read_byte();
+	}
+}
+
+static void com_action(unsigned char action){
+	switch(action){
+		case COM_HIGH:
+			pic_set_porta(&pic, pic.porta_in | 0x02);
+			break;
+		case COM_RELEASE:
+			pic_set_porta(&pic, pic.porta_in & ~0x02);
+			break;
+		case COM_SAMPLE:
+			com_rx[com_nrx / 8] = (com_rx[com_nrx / 8] << 1) | ((pic_porta_pins(&pic) >> 1) & 1);
+			com_nrx++;
+			break;
+	}
+}
+#endif // COM
+
+/* Display digits, as seen while multiplexed (LATB selects digit) */
+static char led_char(unsigned char led){
+	static const unsigned char digits[10] = { LED_0, LED_1, LED_2, LED_3, LED_4, LED_5, LED_6, LED_7, LED_8, LED_9 };
+	unsigned char i;
+
+	led |= 0x01;
+	for(i=0; i<10; i++){
+		if(led == (digits[i] | 0x01)){
+			return '0' + i;
+		}
+	}
+	return led == LED_OFF ? ' ' : '?';
+}
+
+static void usage(const char *cmd){
+	printf("Benchmark STC1000+ firmware (%s) on the PIC16F1828 instruction set simulator.\n", SIM_VARIANT);
+	printf("Usage: %s [-d duration (default=61m)] [-e eeprom.hex] [-m file.map] [-s name=address] [-c item=value] [-t] firmware.hex\n", cmd);
+	printf("  -d  virtual time to run in minutes\n");
+	printf("  -e  EEPROM contents at power on (default %s)\n", SIM_EEDATA);
+	printf("  -m  name functions from gplink map file\n");
+	printf("  -s  name function at (word) address\n");
+	printf("  -c  set a menu item (temperatures in degrees) or config address (raw) before power on\n");
+	printf("  -t  trace display and outputs every second (to stderr)\n");
+	printf("  -a  report all called addresses, also those without a name\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *eeprom = SIM_EEDATA, *map = NULL, *configs[128];
+	unsigned long long duration = 61 * BENCH_MINUTE, t = 0, next_second = 0;
+	unsigned int nconfigs = 0, i, n = 0;
+	unsigned short order[PIC_FLASH_WORDS];
+	unsigned char trace = 0, all = 0, digits[4] = { 0xff, 0xff, 0xff, 0xff };
+	int c;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "d:e:m:s:c:ta")) != -1) {
+		switch(c) {
+			case 'd':
+				duration = (unsigned long long) (atof(optarg) * BENCH_MINUTE);
+				break;
+			case 'e':
+				eeprom = optarg;
+				break;
+			case 'm':
+				map = optarg;
+				break;
+			case 's':
+				if(parse_symbol(optarg) < 0){
+					fprintf(stderr, "Malformed symbol '%s'.\n", optarg);
+					return 1;
+				}
+				break;
+			case 'c':
+				if(nconfigs == sizeof(configs)/sizeof(configs[0])){
+					fprintf(stderr, "Too many config values.\n");
+					return 1;
+				}
+				configs[nconfigs++] = optarg;
+				break;
+			case 't':
+				trace = 1;
+				break;
+			case 'a':
+				all = 1;
+				break;
+			case '?':
+				if (strchr("demsc", optopt)){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc - 1){
+		usage(argv[0]);
+		return 1;
+	}
+
+	/* Erased program memory and EEPROM */
+	for(i=0; i<PIC_FLASH_WORDS; i++){
+		pic.flash[i] = 0x3fff;
+	}
+	memset(pic.eeprom, 0xff, sizeof(pic.eeprom));
+
+	if(pic_load_hex(&pic, argv[optind]) < 0 || pic_load_hex(&pic, eeprom) < 0){
+		return 1;
+	}
+	if(map && load_map(map) < 0){
+		return 1;
+	}
+#if !(defined(OVBSC) || defined(RH))
+	/* Run profile 0, for the hourly profile update */
+	pic.eeprom[EEADR_MENU_ITEM(rn) << 1] = 0;
+	pic.eeprom[(EEADR_MENU_ITEM(rn) << 1) + 1] = 0;
+#endif
+	for(i=0; i<nconfigs; i++){
+		if(parse_config(configs[i]) < 0){
+			fprintf(stderr, "Unknown or malformed config value '%s'.\n", configs[i]);
+			return 1;
+		}
+	}
+
+	pic.on_call = on_call;
+	pic.on_return = on_return;
+	pic.on_interrupt = on_interrupt;
+	pic.on_retfie = on_retfie;
+	pic.on_clrwdt = on_clrwdt;
+	pic_reset(&pic);
+
+	while(t < duration){
+		unsigned long long next = duration;
+
+		/* Stimuli once a second: A/D sweep (triangle, 20 minutes period) and buttons */
+		if(t >= next_second){
+			unsigned long s = t / BENCH_SECOND;
+			unsigned int ad = 200 + (s % 1200 < 600 ? s % 1200 : 1200 - s % 1200);
+
+			pic.ad[AD_PROBE1] = ad;
+			pic.ad[AD_PROBE2] = 1023 - ad;
+
+			if(trace){
+				fprintf(stderr, "%5lu  %c%c%c  %02x  heat %u  cool %u  alarm %u\n", s,
+						led_char(digits[0]), led_char(digits[1]), led_char(digits[2]), digits[3] ^ 0xff,
+						!!(pic.ram[PIC_LATA] & OUT_HEATING), !!(pic.ram[PIC_LATA] & OUT_COOLING),
+						!!(pic.ram[PIC_LATA] & OUT_ALARM));
+			}
+#if defined(COM)
+			if(s % 10 == 5){
+				com_start(t);
+			}
+#endif
+			next_second += BENCH_SECOND;
+		}
+		if(next_second < next){
+			next = next_second;
+		}
+
+		pic.portc_in = 0;
+		for(i=0; i<sizeof(presses)/sizeof(presses[0]); i++){
+			if(t >= presses[i].time && t < presses[i].time + presses[i].duration){
+				pic.portc_in |= presses[i].buttons;
+			}
+			if(presses[i].time > t && presses[i].time < next){
+				next = presses[i].time;
+			}
+			if(presses[i].time + presses[i].duration > t && presses[i].time + presses[i].duration < next){
+				next = presses[i].time + presses[i].duration;
+			}
+		}
+
+#if defined(COM)
+		while(com_step < com_nsteps && com_steps[com_step].at <= t){
+			com_action(com_steps[com_step++].action);
+		}
+		if(com_step < com_nsteps && com_steps[com_step].at < next){
+			next = com_steps[com_step].at;
+		}
+#endif
+
+		/* Sample the multiplexed display (1ms per digit) */
+		if(trace && t + 250 < next){
+			next = t + 250;
+		}
+
+		if(pic_run(&pic, next) < 0){
+			fprintf(stderr, "%s: reset or stack overflow at 0x%04x after %llu cycles\n", SIM_VARIANT, pic.pc, pic.cycle);
+			return 1;
+		}
+		t = pic.cycle;
+
+		if(trace){
+			switch(pic.ram[PIC_LATB] & 0xf0){
+				case 0x10:
+					digits[0] = pic.ram[PIC_LATC];
+					break;
+				case 0x20:
+					digits[1] = pic.ram[PIC_LATC];
+					break;
+				case 0x40:
+					digits[2] = pic.ram[PIC_LATC];
+					break;
+				case 0x80:
+					digits[3] = pic.ram[PIC_LATC];
+					break;
+			}
+		}
+	}
+
+#if defined(COM)
+	com_check();
+	if(com_errors){
+		fprintf(stderr, "%s: %lu of %lu COM transactions failed\n", SIM_VARIANT, com_errors, com_transactions);
+	}
+#endif
+
+	stats_print("tick", &tick);
+	stats_print("loop", &loop);
+	stats_print("isr", &isr);
+	for(i=0; i<PIC_FLASH_WORDS; i++){
+		if(!names[i] && all && functions[i].count){
+			names[i] = malloc(8);
+			sprintf(names[i], "0x%04x", i);
+		}
+		if(names[i]){
+			order[n++] = i;
+		}
+	}
+	qsort(order, n, sizeof(order[0]), by_name);
+	for(i=0; i<n; i++){
+		stats_print(names[order[i]], &functions[order[i]]);
+	}
+
+	return 0;
+}
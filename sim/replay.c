@@ -0,0 +1,455 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Replay recorded A/D values of probe 1 through the A/D filter, ad_to_temp()
+ * and tc correction of the firmware, for a number of filter settings, and
+ * report step response, noise and error against a reference temperature.
+ *
+ * Trace format, one conversion of probe 1 per line (every 120ms on the
+ * device, every other 60ms tick):
+ *
+ *   # comment
+ *   # period=120            time between conversions in ms (optional)
+ *   512 20.00              10 bit A/D value [reference temperature in C]
+ *
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "parse.h"
+#include "stc1000p.h"
+
+/* Conversions per temperature update, every 16th 60ms tick */
+#define CONVERSIONS_PER_UPDATE	8
+#define DEFAULT_PERIOD			120.0
+#define MAX_FILTERS				16
+#define MAX_CONFIGS				64
+/* Reference changes counted as a step (C) */
+#define STEP_MIN				0.5
+/* Reference changes that end a steady period (C) */
+#define STEADY_BAND				0.05
+
+struct trace {
+	unsigned short *ad;
+	float *reference;					/* Celsius, NULL if not recorded */
+	size_t n;
+	double period;						/* ms */
+};
+
+struct filter_result {
+	unsigned long updates;
+	unsigned int steps;
+	double latency, max_latency;		/* s, until 90% of a step */
+	double error, noise, max_error;		/* at steady reference */
+};
+
+static double from_celsius(double t){
+#ifdef FAHRENHEIT
+	return t * 1.8 + 32.0;
+#else
+	return t;
+#endif
+}
+
+static double to_celsius(double t){
+#ifdef FAHRENHEIT
+	return (t - 32.0) / 1.8;
+#else
+	return t;
+#endif
+}
+
+static void usage(const char *cmd){
+	printf("Replay recorded A/D values through the filter and temperature conversion of STC1000+ (%s).\n", SIM_VARIANT);
+	printf("Usage: %s [-f shifts] [-s steady] [-e eeprom.hex] [-c item=value] trace.txt...\n", cmd);
+	printf("       %s -g from:to[:noise[:minutes]]\n", cmd);
+	printf("  -f  filter shifts to compare, e.g. 4,5,6 (default: 4 to %ld, the firmware is %ld,\n", sim_filter_shift() + 1, sim_filter_shift());
+	printf("      larger than %ld marked * as the filter would need 32 bits)\n", sim_filter_shift());
+	printf("  -s  seconds the reference must be constant to count error and noise (default 300)\n");
+	printf("  -e  EEPROM contents (default %s)\n", SIM_EEDATA);
+	printf("  -c  set a menu item (e.g. tc=-0.5) or config address\n");
+	printf("  -g  write a trace with steps between two temperatures (C), A/D noise (counts) and\n");
+	printf("      minutes at each temperature (default 1.0 and 20)\n");
+}
+
+/* Parse a decimal number, faster than strtod() for the plain numbers of a trace.
+ * return: the number, with *end after it (or at s if none)
+ */
+static double parse_number(char *s, char **end){
+	char *p = s;
+	double v = 0, scale = 1;
+	int negative = 0;
+
+	while(*p == ' ' || *p == '\t'){
+		p++;
+	}
+	if(*p == '-' || *p == '+'){
+		negative = *p++ == '-';
+	}
+	if(!isdigit((unsigned char) *p) && !(*p == '.' && isdigit((unsigned char) p[1]))){
+		*end = s;
+		return 0;
+	}
+	while(isdigit((unsigned char) *p)){
+		v = v * 10 + (*p++ - '0');
+	}
+	if(*p == '.'){
+		p++;
+		while(isdigit((unsigned char) *p)){
+			v = v * 10 + (*p++ - '0');
+			scale *= 10;
+		}
+	}
+	if(*p == 'e' || *p == 'E'){
+		return strtod(s, end);
+	}
+	*end = p;
+	return negative ? -v / scale : v / scale;
+}
+
+/* Read a trace file.
+ * return: 0 on success, -1 on error
+ */
+static int load_trace(const char *filename, struct trace *t){
+	FILE *f = fopen(filename, "rb");
+	char *buf, *p, *end;
+	size_t size, lines = 1, i;
+	long len;
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+	fseek(f, 0, SEEK_END);
+	len = ftell(f);
+	fseek(f, 0, SEEK_SET);
+	size = len < 0 ? 0 : len;
+	buf = malloc(size + 1);
+	if(!buf || fread(buf, 1, size, f) != size){
+		perror(filename);
+		fclose(f);
+		free(buf);
+		return -1;
+	}
+	fclose(f);
+	buf[size] = 0;
+
+	for(p = buf; (p = strchr(p, '\n')); p++){
+		lines++;
+	}
+	t->ad = malloc(lines * sizeof(*t->ad));
+	t->reference = malloc(lines * sizeof(*t->reference));
+	t->n = 0;
+	t->period = DEFAULT_PERIOD;
+
+	for(p = buf, i = 1; *p; i++){
+		char *eol = strchr(p, '\n');
+		long ad;
+
+		if(eol){
+			*eol = 0;
+		}
+		while(isspace((unsigned char) *p)){
+			p++;
+		}
+		if(*p == '#'){
+			if(!strncmp(p + 1 + strspn(p + 1, " \t"), "period=", 7)){
+				t->period = atof(strchr(p, '=') + 1);
+			}
+		} else if(*p){
+			double value = parse_number(p, &end);
+
+			ad = (long) value;
+			if(end == p || ad != value || ad < 0 || ad > 1023){
+				fprintf(stderr, "%s:%lu: malformed A/D value.\n", filename, (unsigned long) i);
+				free(buf);
+				return -1;
+			}
+			t->ad[t->n] = ad;
+			p = end;
+			t->reference[t->n] = parse_number(p, &end);
+			if(end == p){
+				if(t->n == 0){
+					free(t->reference);
+					t->reference = NULL;
+				} else if(t->reference){
+					fprintf(stderr, "%s:%lu: missing reference temperature.\n", filename, (unsigned long) i);
+					free(buf);
+					return -1;
+				}
+			}
+			t->n++;
+		}
+		if(!eol){
+			break;
+		}
+		p = eol + 1;
+	}
+	free(buf);
+
+	if(t->period <= 0){
+		fprintf(stderr, "%s: bad period.\n", filename);
+		return -1;
+	}
+	return 0;
+}
+
+/* Run a trace through the filter with the given shift. The firmware code
+ * is used for its own shift, otherwise the same filter is computed here
+ * and scaled to the input of ad_to_temp().
+ */
+static void replay(const struct trace *t, int shift, int correction, double steady, struct filter_result *r){
+	const int firmware_shift = sim_filter_shift();
+	const double period = t->period / 1000.0;
+	unsigned long filter = 512UL << shift;
+	double sum = 0, sum_sq = 0, anchor = 0, from = 0, to = 0;
+	size_t i, last_change = 0, step = 0;
+	unsigned long n = 0;
+	int in_step = 0;
+
+	memset(r, 0, sizeof(*r));
+
+	for(i=0; i<t->n; i++){
+		double temperature, reference;
+		int temp;
+
+		if(shift == firmware_shift){
+			sim.ad[SIM_AD_PROBE1] = t->ad[i];
+			filter = sim_read_ad(filter) & 0xffff;
+		} else {
+			filter = filter - (filter >> shift) + t->ad[i];
+		}
+
+		if(t->reference){
+			if(i > 0 && fabs(t->reference[i] - t->reference[i-1]) >= STEP_MIN){
+				from = t->reference[i-1];
+				to = t->reference[i];
+				step = i;
+				in_step = 1;
+			}
+			if(fabs(t->reference[i] - anchor) > STEADY_BAND){
+				anchor = t->reference[i];
+				last_change = i;
+			}
+		}
+
+		if((i % CONVERSIONS_PER_UPDATE) != CONVERSIONS_PER_UPDATE - 1){
+			continue;
+		}
+
+		/* As in the main loop, 16 bit int */
+		temp = (short) (sim_ad_to_temp(shift <= firmware_shift ? filter << (firmware_shift - shift) : filter >> (shift - firmware_shift)) + correction);
+		temperature = to_celsius(temp / 10.0);
+		r->updates++;
+
+		if(!t->reference){
+			if((i - last_change) * period >= steady){
+				sum += temperature;
+				sum_sq += temperature * temperature;
+				n++;
+			}
+			continue;
+		}
+
+		reference = t->reference[i];
+		if(in_step && (temperature - from) / (to - from) >= 0.9){
+			double latency = (i - step) * period;
+
+			r->latency += latency;
+			if(latency > r->max_latency){
+				r->max_latency = latency;
+			}
+			r->steps++;
+			in_step = 0;
+		}
+		if((i - last_change) * period >= steady){
+			double error = temperature - reference;
+
+			sum += error;
+			sum_sq += error * error;
+			if(fabs(error) > fabs(r->max_error)){
+				r->max_error = error;
+			}
+			n++;
+		}
+	}
+
+	r->latency = r->steps ? r->latency / r->steps : NAN;
+	if(!r->steps){
+		r->max_latency = NAN;
+	}
+	if(n){
+		r->error = sum / n;
+		r->noise = sqrt(fmax(sum_sq / n - r->error * r->error, 0));
+	} else {
+		r->error = r->noise = r->max_error = NAN;
+	}
+	if(!t->reference){
+		r->error = r->max_error = NAN;
+	}
+}
+
+/* Gaussian noise (Box-Muller) */
+static double gauss(void){
+	double u1 = (rand() + 1.0) / (RAND_MAX + 2.0), u2 = rand() / (RAND_MAX + 1.0);
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Write a trace stepping from one temperature to another and back, to stdout.
+ * return: 0 on success, -1 if malformed
+ */
+static int generate(const char *s){
+	double from, to, noise = 1.0, minutes = 20;
+	unsigned long i, n;
+
+	if(sscanf(s, "%lf:%lf:%lf:%lf", &from, &to, &noise, &minutes) < 2 || noise < 0 || minutes <= 0){
+		return -1;
+	}
+	n = (unsigned long) (minutes * 60000.0 / DEFAULT_PERIOD);
+	printf("# Steps %g -> %g -> %gC, A/D noise %g counts\n", from, to, from, noise);
+	printf("# period=%g\n", DEFAULT_PERIOD);
+	for(i=0; i<3*n; i++){
+		double t = (i >= n && i < 2*n) ? to : from;
+		long ad = lround(sim_temperature_to_ad(from_celsius(t)) + noise * gauss());
+
+		printf("%ld %.2f\n", ad < 0 ? 0 : ad > 1023 ? 1023 : ad, t);
+	}
+	return 0;
+}
+
+static void print(double v, const char *format){
+	if(isnan(v)){
+		printf("\t-");
+	} else {
+		putchar('\t');
+		printf(format, v);
+	}
+}
+
+int main(int argc, char *argv[]){
+	const char *eeprom = SIM_EEDATA, *configs[MAX_CONFIGS];
+	int shifts[MAX_FILTERS], nshifts = 0, correction, c, i;
+	unsigned int nconfigs = 0;
+	double steady = 300;
+	char *p, *end;
+
+	sim_init();
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "f:s:e:c:g:")) != -1) {
+		switch(c) {
+			case 'f':
+				for(p = optarg; *p; p = *end ? end + 1 : end){
+					long shift = strtol(p, &end, 10);
+					if(end == p || (*end && *end != ',') || shift < 1 || shift > 10 || nshifts == MAX_FILTERS){
+						fprintf(stderr, "Malformed filter shifts '%s'.\n", optarg);
+						return 1;
+					}
+					shifts[nshifts++] = shift;
+				}
+				break;
+			case 's':
+				steady = atof(optarg);
+				break;
+			case 'e':
+				eeprom = optarg;
+				break;
+			case 'c':
+				if(nconfigs == MAX_CONFIGS){
+					fprintf(stderr, "Too many config values.\n");
+					return 1;
+				}
+				configs[nconfigs++] = optarg;
+				break;
+			case 'g':
+				if(generate(optarg) < 0){
+					fprintf(stderr, "Malformed steps '%s'.\n", optarg);
+					return 1;
+				}
+				return 0;
+			case '?':
+				if (strchr("fsecg", optopt)){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind == argc){
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(nshifts == 0){
+		for(i = 4; i <= sim_filter_shift() + 1; i++){
+			shifts[nshifts++] = i;
+		}
+	}
+
+	if(sim_load_eeprom(eeprom) < 0){
+		fprintf(stderr, "Could not load EEPROM from %s.\n", eeprom);
+		return 1;
+	}
+	for(i=0; i<(int)nconfigs; i++){
+		if(parse_config(configs[i]) < 0){
+			fprintf(stderr, "Unknown or malformed config value '%s'.\n", configs[i]);
+			return 1;
+		}
+	}
+	correction = sim_eeprom_config(EEADR_MENU_ITEM(tc));
+
+	printf("# trace\tshift\tupdates\tsteps\tt90_s\tt90_max_s\terror\tnoise\tmax_error\n");
+	for(; optind < argc; optind++){
+		struct trace t;
+
+		if(load_trace(argv[optind], &t) < 0){
+			return 1;
+		}
+		for(i=0; i<nshifts; i++){
+			struct filter_result r;
+
+			replay(&t, shifts[i], correction, steady, &r);
+			printf("%s\t%d%s\t%lu\t%u", argv[optind], shifts[i], shifts[i] > sim_filter_shift() ? "*" : "", r.updates, r.steps);
+			print(r.latency, "%.1f");
+			print(r.max_latency, "%.1f");
+			/* Temperature differences in the scale of the build */
+			print(from_celsius(r.error) - from_celsius(0), "%.3f");
+			print(from_celsius(r.noise) - from_celsius(0), "%.3f");
+			print(from_celsius(r.max_error) - from_celsius(0), "%.3f");
+			printf("\n");
+		}
+		free(t.ad);
+		free(t.reference);
+	}
+
+	return 0;
+}
@@ -0,0 +1,638 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Run the firmware in closed loop with a thermal model of the vessel, for
+ * many scenarios (settings, profiles and plants) in parallel, and report
+ * how well the temperature is controlled.
+ *
+ * Plant: one heat capacity, heated and cooled by the outputs and losing
+ * heat to the ambient, with the probe as a first order lag behind the
+ * vessel temperature and gaussian noise added to the probe reading. The
+ * cooler power can follow the relay with a first order lag as well (the
+ * cold evaporator keeps cooling after the compressor stops).
+ *
+ */
+
+#include <ctype.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/wait.h>
+#include "parse.h"
+#include "stc1000p.h"
+
+#define MAX_SCENARIOS		100000
+#define MAX_SETTINGS		64
+#define MAX_PRESSES			16
+#define LINE_SIZE			1024
+
+struct scenario {
+	char *name;
+	char *settings[MAX_SETTINGS];		/* key=value, in order */
+	unsigned int nsettings;
+	char *varied;						/* settings taken from lists or ranges */
+};
+
+struct result {
+	int error;
+	double settle;						/* hours until the setpoint was first reached */
+	double over, under;					/* largest deviation above/below setpoint after reaching it */
+	double rms;							/* RMS deviation after reaching setpoint */
+	double in_band;						/* % of time within band after reaching setpoint */
+	double heat_cycles, cool_cycles;	/* per hour */
+	double heat_duty, cool_duty;		/* % of time on */
+};
+
+/* Plant and scenario parameters, temperatures in degrees Celsius */
+struct plant {
+	sim_time_t duration;
+	double capacity;					/* J/K */
+	double heat, heat2, cool;			/* W */
+	double coast;						/* s, time constant of the cooler power */
+	double ua;							/* W/K, loss to ambient */
+	double ambient, t0;
+	double lag;							/* s, probe time constant */
+	double noise;						/* standard deviation of probe reading */
+	double band;
+	unsigned long seed;
+	double ack;							/* s, until alarms are acknowledged and pauses resumed (OVBSC) */
+	struct press presses[MAX_PRESSES];
+	unsigned int npresses;
+};
+
+static struct scenario *scenarios;
+static unsigned int nscenarios;
+static const char *eeprom = SIM_EEDATA;
+
+static void usage(const char *cmd){
+	printf("Run STC1000+ firmware (%s) in closed loop with a thermal model, for many scenarios in parallel.\n", SIM_VARIANT);
+	printf("Usage: %s [-j jobs] [-e eeprom.hex] scenarios.txt...\n", cmd);
+	printf("  -j  number of scenarios to run at the same time (default: number of cores)\n");
+	printf("  -e  EEPROM contents at power on (default %s)\n", SIM_EEDATA);
+	printf("Each line of a scenario file is a name followed by settings key=value, where the value\n");
+	printf("may be a list (a,b,c) or range (from:to:step) to run a scenario for each value:\n");
+	printf("  time=7d   virtual time to run (6h for OVBSC)\n");
+	printf("  cap=100   heat capacity of vessel (kJ/K)\n");
+	printf("  heat=100  heater power (W)\n");
+#if defined(OVBSC)
+	printf("  heat2=0   second heater power (W), on above 100%% output\n");
+	printf("  mode=pr   off, pr (program), ct (thermostat) or co (constant output)\n");
+	printf("  ack=10    seconds until alarms are acknowledged and pauses resumed\n");
+#else
+	printf("  cool=150  cooler power (W)\n");
+	printf("  coast=0   time constant of the cooler power following the relay (s)\n");
+#endif
+	printf("  ua=5      heat loss to ambient (W/K)\n");
+	printf("  amb=20    ambient temperature\n");
+	printf("  t0=20     vessel temperature at start\n");
+	printf("  lag=300   probe time constant (s)\n");
+	printf("  noise=0.05  standard deviation of probe reading\n");
+	printf("  band=0.5  report time within setpoint +/- band\n");
+	printf("  seed=1    seed of the noise\n");
+	printf("  press=time:buttons[:ms]  hold buttons (p, s, u, d)\n");
+	printf("  and config values as for stcsim -c (e.g. SP=18.5, hy=0.3, SP03=20.0, dh03=48)\n");
+}
+
+/* Temperatures in the scale of the build */
+static double to_celsius(double t){
+#ifdef FAHRENHEIT
+	return (t - 32.0) / 1.8;
+#else
+	return t;
+#endif
+}
+
+static double from_celsius(double t){
+#ifdef FAHRENHEIT
+	return t * 1.8 + 32.0;
+#else
+	return t;
+#endif
+}
+
+static double temperature_difference(double t){
+#ifdef FAHRENHEIT
+	return t / 1.8;
+#else
+	return t;
+#endif
+}
+
+/* Setpoint the firmware regulates to (degrees Celsius), or NAN if not regulating */
+static double current_setpoint(void){
+#if defined(OVBSC)
+	return THERMOSTAT && !OFF ? to_celsius(sim_setpoint() / 10.0) : NAN;
+#elif defined(MINUTE)
+	return to_celsius(sim_setpoint() / 10.0);
+#else
+	return to_celsius(sim_eeprom_config(EEADR_MENU_ITEM(SP)) / 10.0);
+#endif
+}
+
+/* Gaussian noise (xorshift and Box-Muller), reproducible per scenario */
+static double gauss(unsigned long *state){
+	double u1, u2;
+
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	u1 = ((*state >> 11) + 1.0) / 9007199254740993.0;
+	*state ^= *state << 13;
+	*state ^= *state >> 7;
+	*state ^= *state << 17;
+	u2 = (*state >> 11) / 9007199254740992.0;
+	return sqrt(-2.0 * log(u1)) * cos(2.0 * M_PI * u2);
+}
+
+/* Apply the settings of a scenario to the plant and the EEPROM.
+ * return: 0 on success, -1 on an unknown or malformed setting
+ */
+static int apply(const struct scenario *s, struct plant *p){
+	unsigned int i;
+	char *end;
+
+	p->duration = 7 * SIM_DAY;
+#if defined(OVBSC)
+	p->capacity = 125e3;
+	p->heat = 2500;
+	p->heat2 = 0;
+	p->ua = 15;
+	p->ambient = 20;
+	p->t0 = 12;
+	p->lag = 30;
+	p->duration = 6 * SIM_HOUR;
+#else
+	p->capacity = 100e3;
+	p->heat = 100;
+	p->cool = 150;
+	p->coast = 0;
+	p->ua = 5;
+	p->ambient = 20;
+	p->t0 = 20;
+	p->lag = 300;
+#endif
+	p->noise = 0.05;
+	p->band = 0.5;
+	p->seed = 1;
+	p->ack = 10;
+	p->npresses = 0;
+
+	for(i=0; i<s->nsettings; i++){
+		const char *k = s->settings[i], *v = strchr(k, '=') + 1;
+		size_t n = v - k - 1;
+
+#define KEY(name)	(n == strlen(name) && !strncmp(k, name, n))
+		if(KEY("time")){
+			p->duration = parse_time(v, &end);
+			if(p->duration == SIM_NEVER || *end){
+				return -1;
+			}
+		} else if(KEY("cap")){
+			p->capacity = atof(v) * 1e3;
+		} else if(KEY("heat")){
+			p->heat = atof(v);
+		} else if(KEY("heat2")){
+			p->heat2 = atof(v);
+		} else if(KEY("cool")){
+			p->cool = atof(v);
+		} else if(KEY("coast")){
+			p->coast = atof(v);
+		} else if(KEY("ua")){
+			p->ua = atof(v);
+		} else if(KEY("amb")){
+			p->ambient = to_celsius(atof(v));
+		} else if(KEY("t0")){
+			p->t0 = to_celsius(atof(v));
+		} else if(KEY("lag")){
+			p->lag = atof(v);
+		} else if(KEY("noise")){
+			p->noise = temperature_difference(atof(v));
+		} else if(KEY("band")){
+			p->band = temperature_difference(atof(v));
+		} else if(KEY("seed")){
+			p->seed = strtoul(v, NULL, 0);
+		} else if(KEY("ack")){
+			p->ack = atof(v);
+		} else if(KEY("press")){
+			if(p->npresses == MAX_PRESSES || parse_press(v, &p->presses[p->npresses]) < 0){
+				return -1;
+			}
+			p->npresses++;
+#if defined(OVBSC)
+		} else if(KEY("mode")){
+			/* As selected by the last item of the menu */
+			OFF = !strcmp(v, "off");
+			RUN_PRG = !strcmp(v, "pr");
+			THERMOSTAT = !strcmp(v, "ct");
+			if(!OFF && !RUN_PRG && !THERMOSTAT && strcmp(v, "co")){
+				return -1;
+			}
+#endif
+		} else if(parse_config(k) < 0){
+			return -1;
+		}
+#undef KEY
+	}
+	if(p->capacity <= 0 || p->lag < 0 || p->coast < 0){
+		return -1;
+	}
+	if(!p->seed){
+		p->seed = 1;
+	}
+	return 0;
+}
+
+/* Run one scenario on a freshly initialized device (in a child process) */
+static void run(const struct scenario *s, struct result *r){
+	struct plant p;
+	/* Outputs change at most once a second, except the OVBSC burst output (every 'Pd' ms) */
+#if defined(OVBSC)
+	const sim_time_t step = 10 * SIM_MS;
+#else
+	const sim_time_t step = SIM_SECOND;
+#endif
+	const double dt = (double) step / SIM_SECOND;
+	double vessel, probe, reading = 0, sp, last_sp = NAN, sum_sq = 0;
+	double heat_on = 0, cool_on = 0, in_band = 0, regulated = 0;
+	unsigned long heat_switches = 0, cool_switches = 0;
+	unsigned char heat = 0, cool = 0, reached = 0;
+	sim_time_t t;
+#if defined(OVBSC)
+	sim_time_t alarm = SIM_NEVER;
+#else
+	double cooling = 0;
+#endif
+	unsigned int i;
+
+	memset(r, 0, sizeof(*r));
+	r->settle = NAN;
+
+	sim_init();
+	if(sim_load_eeprom(eeprom) < 0 || apply(s, &p) < 0){
+		r->error = 1;
+		return;
+	}
+
+	vessel = probe = p.t0;
+
+	for(t = 0; t < p.duration; t += step){
+		double power;
+
+		/* New probe reading once a second */
+		if(t % SIM_SECOND == 0){
+			reading = from_celsius(probe + p.noise * gauss(&p.seed));
+			sim.ad[SIM_AD_PROBE1] = sim.ad[SIM_AD_PROBE2] = sim_temperature_to_ad(reading);
+		}
+
+		sim.buttons = 0;
+		for(i=0; i<p.npresses; i++){
+			if(t >= p.presses[i].time && t < p.presses[i].time + p.presses[i].duration){
+				sim.buttons |= p.presses[i].buttons;
+			}
+		}
+
+		if(sim_run(step) < 0){
+			r->error = 2;
+			return;
+		}
+
+#if defined(OVBSC)
+		/* Heater 2 is on the cooling output */
+		power = SIM_HEATING * p.heat + SIM_COOLING * p.heat2;
+		/* The brewer acknowledges alarms and resumes after a pause (as with the buttons) */
+		if(ALARM || PAUSE){
+			if(alarm == SIM_NEVER){
+				alarm = t;
+			} else if(t - alarm >= p.ack * SIM_SECOND){
+				if(ALARM){
+					ALARM = 0;
+				} else {
+					PAUSE = 0;
+				}
+				alarm = SIM_NEVER;
+			}
+		}
+#else
+		cooling += (SIM_COOLING * p.cool - cooling) * (p.coast > 0 ? 1.0 - exp(-dt / p.coast) : 1.0);
+		power = SIM_HEATING * p.heat - cooling;
+#endif
+		if(SIM_HEATING && !heat){
+			heat_switches++;
+		}
+		if(SIM_COOLING && !cool){
+			cool_switches++;
+		}
+		heat = SIM_HEATING;
+		cool = SIM_COOLING;
+		heat_on += heat * dt;
+		cool_on += cool * dt;
+
+		/* Plant */
+		vessel += (power + p.ua * (p.ambient - vessel)) * dt / p.capacity;
+		probe += (vessel - probe) * (p.lag > 0 ? 1.0 - exp(-dt / p.lag) : 1.0);
+
+		/* Control quality, from when the vessel first reaches the setpoint
+		 * (again after a change of setpoint larger than the band)
+		 */
+		sp = current_setpoint();
+		if(isnan(sp)){
+			continue;
+		}
+		if(isnan(last_sp) || fabs(sp - last_sp) > p.band){
+			reached = 0;
+			last_sp = sp;
+		}
+		if(!reached){
+			if((vessel >= sp) == (p.t0 < sp) || fabs(vessel - sp) < 0.01){
+				reached = 1;
+				if(isnan(r->settle)){
+					r->settle = (double) t / SIM_HOUR;
+				}
+			} else {
+				continue;
+			}
+		}
+		if(vessel - sp > r->over){
+			r->over = vessel - sp;
+		}
+		if(sp - vessel > r->under){
+			r->under = sp - vessel;
+		}
+		sum_sq += (vessel - sp) * (vessel - sp) * dt;
+		regulated += dt;
+		if(fabs(vessel - sp) <= p.band){
+			in_band += dt;
+		}
+	}
+
+	r->rms = regulated > 0 ? sqrt(sum_sq / regulated) : NAN;
+	r->in_band = regulated > 0 ? 100.0 * in_band / regulated : NAN;
+	r->heat_cycles = heat_switches * (double) SIM_HOUR / p.duration;
+	r->cool_cycles = cool_switches * (double) SIM_HOUR / p.duration;
+	r->heat_duty = 100.0 * heat_on * SIM_SECOND / p.duration;
+	r->cool_duty = 100.0 * cool_on * SIM_SECOND / p.duration;
+	r->over = from_celsius(r->over) - from_celsius(0);
+	r->under = from_celsius(r->under) - from_celsius(0);
+	r->rms = from_celsius(r->rms) - from_celsius(0);
+}
+
+/* Scenario files */
+
+static char *join(const char *a, const char *sep, const char *b){
+	char *s = malloc(strlen(a) + strlen(sep) + strlen(b) + 1);
+	sprintf(s, "%s%s%s", a, *a ? sep : "", b);
+	return s;
+}
+
+/* Expand settings with lists or ranges into one scenario per combination */
+static int expand(const char *name, char **tokens, unsigned int ntokens, unsigned int i,
+		char **settings, unsigned int nsettings, const char *varied){
+	char key[64], value[64], *v, *eq;
+	double from, to, by;
+
+	if(i == ntokens){
+		struct scenario *s;
+
+		if(nscenarios == MAX_SCENARIOS){
+			fprintf(stderr, "Too many scenarios.\n");
+			return -1;
+		}
+		s = &scenarios[nscenarios++];
+		s->name = strdup(name);
+		s->nsettings = nsettings;
+		memcpy(s->settings, settings, nsettings * sizeof(settings[0]));
+		s->varied = strdup(varied);
+		return 0;
+	}
+
+	eq = strchr(tokens[i], '=');
+	if(!eq || eq == tokens[i] || (size_t) (eq - tokens[i]) >= sizeof(key) || nsettings == MAX_SETTINGS){
+		fprintf(stderr, "Malformed setting '%s' in scenario %s.\n", tokens[i], name);
+		return -1;
+	}
+	memcpy(key, tokens[i], eq - tokens[i]);
+	key[eq - tokens[i]] = 0;
+	v = eq + 1;
+
+	if(strchr(v, ',')){
+		char *copy = strdup(v), *save, *item;
+
+		for(item = strtok_r(copy, ",", &save); item; item = strtok_r(NULL, ",", &save)){
+			char *setting = join(key, "=", item);
+			char *var = join(varied, " ", setting);
+
+			settings[nsettings] = setting;
+			if(expand(name, tokens, ntokens, i + 1, settings, nsettings + 1, var) < 0){
+				return -1;
+			}
+			free(var);
+		}
+		free(copy);
+		return 0;
+	}
+
+	if(strcmp(key, "press") && sscanf(v, "%lf:%lf:%lf", &from, &to, &by) == 3){
+		unsigned int n, j;
+
+		if(by <= 0 || to < from){
+			fprintf(stderr, "Malformed range '%s' in scenario %s.\n", tokens[i], name);
+			return -1;
+		}
+		n = (unsigned int) floor((to - from) / by + 1e-9) + 1;
+		for(j=0; j<n; j++){
+			char *setting, *var;
+
+			snprintf(value, sizeof(value), "%g", from + j * by);
+			setting = join(key, "=", value);
+			var = join(varied, " ", setting);
+			settings[nsettings] = setting;
+			if(expand(name, tokens, ntokens, i + 1, settings, nsettings + 1, var) < 0){
+				return -1;
+			}
+			free(var);
+		}
+		return 0;
+	}
+
+	settings[nsettings] = tokens[i];
+	return expand(name, tokens, ntokens, i + 1, settings, nsettings + 1, varied);
+}
+
+static int load(const char *filename){
+	char line[LINE_SIZE];
+	unsigned int lineno = 0;
+	FILE *f = fopen(filename, "r");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+	while(fgets(line, sizeof(line), f)){
+		char *tokens[MAX_SETTINGS + 1], *settings[MAX_SETTINGS], *save, *tok;
+		unsigned int ntokens = 0;
+
+		lineno++;
+		if(strchr(line, '#')){
+			*strchr(line, '#') = 0;
+		}
+		for(tok = strtok_r(line, " \t\r\n", &save); tok && ntokens <= MAX_SETTINGS; tok = strtok_r(NULL, " \t\r\n", &save)){
+			tokens[ntokens++] = strdup(tok);
+		}
+		if(ntokens == 0){
+			continue;
+		}
+		if(ntokens > MAX_SETTINGS || strchr(tokens[0], '=')){
+			fprintf(stderr, "%s:%u: expected name and at most %u settings.\n", filename, lineno, MAX_SETTINGS);
+			fclose(f);
+			return -1;
+		}
+		if(expand(tokens[0], tokens + 1, ntokens - 1, 0, settings, 0, "") < 0){
+			fclose(f);
+			return -1;
+		}
+	}
+	fclose(f);
+	return 0;
+}
+
+static void print(double v){
+	if(isnan(v)){
+		printf("\t-");
+	} else {
+		printf("\t%.2f", v);
+	}
+}
+
+int main(int argc, char *argv[]){
+	struct result *results;
+	long jobs = sysconf(_SC_NPROCESSORS_ONLN);
+	unsigned int i, running = 0, failed = 0;
+	struct plant p;
+	int c;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "j:e:")) != -1) {
+		switch(c) {
+			case 'j':
+				jobs = atoi(optarg);
+				break;
+			case 'e':
+				eeprom = optarg;
+				break;
+			case '?':
+				if (strchr("je", optopt)){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind == argc || jobs < 1){
+		usage(argv[0]);
+		return 1;
+	}
+
+	scenarios = calloc(MAX_SCENARIOS, sizeof(*scenarios));
+	for(; optind < argc; optind++){
+		if(load(argv[optind]) < 0){
+			return 1;
+		}
+	}
+
+	/* Check the settings before starting (the firmware is never run here) */
+	for(i=0; i<nscenarios; i++){
+		sim_init();
+		if(apply(&scenarios[i], &p) < 0){
+			fprintf(stderr, "Unknown or malformed setting in scenario %s %s.\n", scenarios[i].name, scenarios[i].varied);
+			return 1;
+		}
+	}
+
+	/* One process per scenario, as the firmware state is global */
+	results = mmap(NULL, nscenarios * sizeof(*results) + 1, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+	if(results == MAP_FAILED){
+		perror("mmap");
+		return 1;
+	}
+	fflush(stdout);
+
+	for(i=0; i<nscenarios; i++){
+		pid_t pid;
+
+		if(running == jobs){
+			wait(NULL);
+			running--;
+		}
+		pid = fork();
+		if(pid < 0){
+			perror("fork");
+			return 1;
+		}
+		if(pid == 0){
+			run(&scenarios[i], &results[i]);
+			_exit(0);
+		}
+		running++;
+	}
+	while(running){
+		wait(NULL);
+		running--;
+	}
+
+#if defined(OVBSC)
+	printf("# scenario\tsettings\tsettle_h\tover\tunder\trms\tin_band_%%\theat_per_h\theat2_per_h\theat_%%\theat2_%%\n");
+#else
+	printf("# scenario\tsettings\tsettle_h\tover\tunder\trms\tin_band_%%\theat_per_h\tcool_per_h\theat_%%\tcool_%%\n");
+#endif
+	for(i=0; i<nscenarios; i++){
+		const struct result *r = &results[i];
+
+		if(r->error){
+			fprintf(stderr, "Scenario %s %s failed (%s).\n", scenarios[i].name, scenarios[i].varied,
+					r->error == 1 ? "EEPROM" : "firmware reset");
+			failed++;
+			continue;
+		}
+		printf("%s\t%s", scenarios[i].name, *scenarios[i].varied ? scenarios[i].varied : "-");
+		print(r->settle);
+		print(r->over);
+		print(r->under);
+		print(r->rms);
+		print(r->in_band);
+		print(r->heat_cycles);
+		print(r->cool_cycles);
+		print(r->heat_duty);
+		print(r->cool_duty);
+		printf("\n");
+	}
+
+	return failed ? 1 : 0;
+}
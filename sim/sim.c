@@ -0,0 +1,514 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include <ucontext.h>
+#include "sim.h"
+#include "stc1000p.h"
+
+/* Special function registers */
+volatile unsigned char TMR0, TMR1L, TMR1H, T1CON, TMR2, TMR4, TMR6, PR2, PR4, PR6;
+volatile unsigned char EEADRL, EEADRH, EEDATL, EEDATH, EECON2;
+volatile unsigned char ADRESL, ADRESH, ANSELC, WDTCON;
+volatile __INTCONbits_t INTCONbits;
+volatile __OPTION_REGbits_t OPTION_REGbits;
+volatile __PIR1bits_t PIR1bits;
+volatile __PIE1bits_t PIE1bits;
+volatile __PIR2bits_t PIR2bits;
+volatile __PIR3bits_t PIR3bits;
+volatile __T1GCONbits_t T1GCONbits;
+volatile __T2CONbits_t T2CONbits;
+volatile __T4CONbits_t T4CONbits;
+volatile __T6CONbits_t T6CONbits;
+volatile __CM1CON0bits_t CM1CON0bits;
+volatile __CM2CON0bits_t CM2CON0bits;
+volatile __TXSTAbits_t TXSTAbits;
+volatile __RCSTAbits_t RCSTAbits;
+volatile __ADCON0bits_t ADCON0bits;
+volatile __ADCON1bits_t ADCON1bits;
+volatile __EECON1bits_t EECON1bits;
+volatile __OSCCONbits_t OSCCONbits;
+volatile __PORTAbits_t PORTAbits;
+volatile __LATAbits_t LATAbits;
+volatile __TRISAbits_t TRISAbits;
+volatile __ANSELAbits_t ANSELAbits;
+volatile __WPUAbits_t WPUAbits;
+volatile __IOCAPbits_t IOCAPbits;
+volatile __IOCANbits_t IOCANbits;
+volatile __IOCAFbits_t IOCAFbits;
+volatile __PORTBbits_t PORTBbits;
+volatile __LATBbits_t LATBbits;
+volatile __TRISBbits_t TRISBbits;
+volatile __PORTCbits_t PORTCbits;
+volatile __LATCbits_t LATCbits;
+volatile __TRISCbits_t TRISCbits;
+
+struct sim_device sim;
+
+/* From the host build of page0.c (main() is renamed) */
+extern void sim_firmware_main(void);
+extern void sim_interrupt(void);
+
+#define FIRMWARE_STACK_SIZE		(256 * 1024)
+
+static ucontext_t host_context, firmware_context;
+static char firmware_stack[FIRMWARE_STACK_SIZE];
+static unsigned char started, halted;
+static sim_time_t stop;
+
+/* Next overflow of each timer */
+static sim_time_t t0_next, t2_next, t4_next, t6_next;
+/* 1ms interrupts still to run after the buttons are released, for the debouncing to see it */
+#define BUTTON_RELEASE_MS		8
+static unsigned char button_release;
+
+#define EEPROM_HEX_ADDRESS		0x1E000UL	/* byte address of EEPROM in HEX files */
+
+/* NTC 10k B3435 (ntc-lut-generator/ntc-10k-3435.txt), -40 to 105C in steps of 5C */
+#define NTC_T_MIN				(-40.0)
+#define NTC_T_STEP				(5.0)
+static const double ntc_r[] = {
+	190953, 145953, 112440, 87285, 68260, 53762, 42636, 34038, 27348, 22108,
+	17979, 14706, 12094, 10000, 8310.8, 6941.1, 5824.9, 4910.6, 4158.3, 3536.2,
+	3019.7, 2588.8, 2228.0, 1924.6, 1668.4, 1451.3, 1266.7, 1109.2, 974.26, 858.33
+};
+#define NTC_POINTS				(sizeof(ntc_r)/sizeof(ntc_r[0]))
+#define NTC_R0					10000.0		/* divider resistor */
+#define AD_MAX					1024
+
+void sim_init(void){
+	memset(&sim, 0, sizeof(sim));
+	memset(sim.eeprom, 0xff, sizeof(sim.eeprom));
+	sim.ad[SIM_AD_PROBE1] = sim.ad[SIM_AD_PROBE2] = sim_temperature_to_ad(
+#ifdef FAHRENHEIT
+			68.0
+#else
+			20.0
+#endif
+	);
+#if defined(COM) || defined(OVBSC)
+	/* Communication timeout and output control count milliseconds */
+	sim.mux = 1;
+#endif
+
+	/* Power on reset values */
+	INTCON = PIR1 = PIE1 = PIR2 = PIR3 = 0;
+	OPTION_REG = 0xff;
+	T1GCON = T1CON = T2CON = T4CON = T6CON = 0;
+	PR2 = PR4 = PR6 = 0xff;
+	TMR0 = TMR1L = TMR1H = TMR2 = TMR4 = TMR6 = 0;
+	CM1CON0 = CM2CON0 = 0x04;
+	TXSTA = 0x02;
+	RCSTA = 0;
+	ADCON0 = ADCON1 = ADRESH = ADRESL = 0;
+	EECON1 = EEADRL = EEADRH = EEDATL = EEDATH = 0;
+	OSCCON = 0x38;
+	LATA = LATB = LATC = 0;
+	TRISA = TRISB = TRISC = 0xff;
+	ANSELA = 0x17;
+	ANSELC = 0xcf;
+	WPUA = 0x3f;
+	IOCAP = IOCAN = IOCAF = 0;
+	WDTCON = 0x16;
+
+	t0_next = t2_next = t4_next = t6_next = SIM_NEVER;
+	started = halted = 0;
+	button_release = 0;
+}
+
+/* Period of timer 2, 4 or 6 in instruction cycles (us) */
+static sim_time_t timer_period(unsigned char con, unsigned char pr){
+	static const unsigned char prescale[] = { 1, 4, 16, 64 };
+	return (sim_time_t) (pr + 1) * prescale[con & 0x3] * (((con >> 3) & 0xf) + 1);
+}
+
+/* Time for timer 0 to overflow from its current count */
+static sim_time_t timer0_period(){
+	return (sim_time_t) (256 - TMR0) << (PSA ? 0 : (OPTION_REG & 0x7) + 1);
+}
+
+/* Start or stop the timers as enabled by the firmware */
+static void schedule(){
+	if(TMR0CS){
+		t0_next = SIM_NEVER;
+	} else if(t0_next == SIM_NEVER){
+		t0_next = sim.now + timer0_period();
+	}
+	/* The buttons are sampled there */
+	if(!TMR2ON || !(sim.mux || sim.buttons || button_release)){
+		t2_next = SIM_NEVER;
+	} else if(t2_next == SIM_NEVER){
+		t2_next = sim.now + timer_period(T2CON, PR2);
+	}
+	if(!TMR4ON){
+		t4_next = SIM_NEVER;
+	} else if(t4_next == SIM_NEVER){
+		t4_next = sim.now + timer_period(T4CON, PR4);
+	}
+	if(!TMR6ON){
+		t6_next = SIM_NEVER;
+	} else if(t6_next == SIM_NEVER){
+		t6_next = sim.now + timer_period(T6CON, PR6);
+	}
+}
+
+static sim_time_t next_event(){
+	sim_time_t next = t0_next;
+
+	if(t2_next < next){
+		next = t2_next;
+	}
+	if(t4_next < next){
+		next = t4_next;
+	}
+	if(t6_next < next){
+		next = t6_next;
+	}
+	return next;
+}
+
+/* Run the interrupt service routine for as long as there are enabled interrupts pending */
+static void interrupt(){
+	while(GIE && ((TMR0IE && TMR0IF) || (IOCIE && IOCAF) || (PEIE && TMR2IE && TMR2IF))){
+		GIE = 0;
+		sim.interrupts++;
+		sim_interrupt();
+		GIE = 1;
+	}
+}
+
+/* The main loop clears the watchdog once per pass, so this is where
+ * virtual time advances to the next timer event.
+ */
+void sim_clrwdt(void){
+	sim_time_t next;
+
+	sim.loops++;
+
+	for(;;){
+		schedule();
+		next = next_event();
+		if(next == SIM_NEVER){
+			/* No timer runs yet (EEPROM migration at start up), so no time passes */
+			return;
+		}
+		if(next <= stop){
+			break;
+		}
+		sim.now = stop;
+		swapcontext(&firmware_context, &host_context);
+		/* Stimuli from the host may have raised interrupts */
+		interrupt();
+	}
+
+	sim.now = next;
+
+	if(t0_next == next){
+		TMR0 = 0;
+		TMR0IF = 1;
+		t0_next = SIM_NEVER;
+	}
+	if(t2_next == next){
+		TMR2IF = 1;
+		t2_next += timer_period(T2CON, PR2);
+		if(sim.buttons){
+			button_release = BUTTON_RELEASE_MS;
+		} else if(button_release){
+			button_release--;
+		}
+	}
+	if(t4_next == next){
+		TMR4IF = 1;
+		t4_next += timer_period(T4CON, PR4);
+	}
+	if(t6_next == next){
+		TMR6IF = 1;
+		t6_next += timer_period(T6CON, PR6);
+	}
+	/* Timer 1 counts instruction cycles (the firmware runs in no time between events) */
+	if(T1CON & 0x01){
+		TMR1L = sim.now & 0xff;
+		TMR1H = (sim.now >> 8) & 0xff;
+	}
+
+	interrupt();
+}
+
+void sim_reset(void){
+	halted = 1;
+	swapcontext(&firmware_context, &host_context);
+}
+
+void sim_eeprom_sync(void){
+	if(RD){
+		if(!CFGS && !EEPGD){
+			EEDATL = sim.eeprom[EEADRL];
+		}
+		RD = 0;
+	}
+	if(WR){
+		if(WREN && !CFGS && !EEPGD){
+			sim.eeprom[EEADRL] = EEDATL;
+			sim.eeprom_writes[EEADRL]++;
+			EEIF = 1;
+		}
+		WR = 0;
+	}
+}
+
+void sim_adc_sync(void){
+	if(ADGO){
+		if(ADON){
+			unsigned int ad = sim.ad[(ADCON0 >> 2) & 0x1f] & 0x3ff;
+			if(ADFM){
+				ADRESH = ad >> 8;
+				ADRESL = ad & 0xff;
+			} else {
+				ADRESH = ad >> 2;
+				ADRESL = (ad & 0x3) << 6;
+			}
+		}
+		ADGO = 0;
+	}
+}
+
+void sim_port_sync(void){
+	RA1 = TRISA1 ? sim.ra1 : LATA1;
+	PORTC = (LATC & ~TRISC) | (sim.buttons & TRISC);
+}
+
+void sim_set_ra1(unsigned char level){
+	level = !!level;
+	if(level != sim.ra1){
+		if((level && IOCAP1) || (!level && (IOCAN & 0x2))){
+			IOCAF1 = 1;
+		}
+		sim.ra1 = level;
+	}
+}
+
+static void firmware_entry(){
+	sim_firmware_main();
+	halted = 1;
+	swapcontext(&firmware_context, &host_context);
+}
+
+int sim_run(sim_time_t us){
+	if(halted){
+		return -1;
+	}
+
+	stop = sim.now + us;
+
+	if(!started){
+		getcontext(&firmware_context);
+		firmware_context.uc_stack.ss_sp = firmware_stack;
+		firmware_context.uc_stack.ss_size = sizeof(firmware_stack);
+		firmware_context.uc_link = NULL;
+		makecontext(&firmware_context, firmware_entry, 0);
+		started = 1;
+	}
+
+	swapcontext(&host_context, &firmware_context);
+
+	return halted ? -1 : 0;
+}
+
+static int hex_byte(const char *s){
+	int v;
+	if(sscanf(s, "%2x", &v) != 1){
+		return -1;
+	}
+	return v;
+}
+
+int sim_load_eeprom(const char *filename){
+	char line[600];
+	unsigned long ext = 0;
+	FILE *f = fopen(filename, "r");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+
+	while(fgets(line, sizeof(line), f)){
+		int count, address, type, i;
+
+		if(line[0] != ':'){
+			continue;
+		}
+		count = hex_byte(line + 1);
+		address = (hex_byte(line + 3) << 8) | hex_byte(line + 5);
+		type = hex_byte(line + 7);
+		if(count < 0 || address < 0 || type < 0 || strlen(line) < 11 + 2 * (size_t) count){
+			fprintf(stderr, "%s: malformed record\n", filename);
+			fclose(f);
+			return -1;
+		}
+		if(type == 4){
+			ext = (hex_byte(line + 9) << 8) | hex_byte(line + 11);
+		} else if(type == 0){
+			for(i=0; i<count; i++){
+				unsigned long a = (ext << 16) + address + i;
+				if(a >= EEPROM_HEX_ADDRESS && a < EEPROM_HEX_ADDRESS + 2 * SIM_EEPROM_SIZE && !(a & 0x1)){
+					sim.eeprom[(a - EEPROM_HEX_ADDRESS) >> 1] = hex_byte(line + 9 + 2 * i);
+				}
+			}
+		}
+	}
+
+	fclose(f);
+	return 0;
+}
+
+static void hex_record(FILE *f, unsigned char count, unsigned int address, unsigned char type, const unsigned char *data){
+	unsigned char sum = count + (address >> 8) + address + type;
+	unsigned char i;
+
+	fprintf(f, ":%02X%04X%02X", count, address, type);
+	for(i=0; i<count; i++){
+		fprintf(f, "%02X", data[i]);
+		sum += data[i];
+	}
+	fprintf(f, "%02X\n", (unsigned char) -sum);
+}
+
+int sim_save_eeprom(const char *filename){
+	unsigned char data[16];
+	unsigned int i, j;
+	FILE *f = fopen(filename, "w");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+
+	data[0] = 0;
+	data[1] = 0;
+	hex_record(f, 2, 0, 4, data);
+	data[1] = EEPROM_HEX_ADDRESS >> 16;
+	hex_record(f, 2, 0, 4, data);
+
+	/* Each EEPROM byte is a RETLW (0x34xx) word */
+	for(i=0; i<SIM_EEPROM_SIZE; i+=8){
+		for(j=0; j<8; j++){
+			data[j << 1] = sim.eeprom[i + j];
+			data[(j << 1) + 1] = 0x34;
+		}
+		hex_record(f, 16, (EEPROM_HEX_ADDRESS & 0xffff) + (i << 1), 0, data);
+	}
+	hex_record(f, 0, 0, 1, data);
+
+	if(fclose(f)){
+		perror(filename);
+		return -1;
+	}
+	return 0;
+}
+
+int sim_eeprom_config(unsigned char eeadr){
+	return (short) (sim.eeprom[eeadr << 1] | (sim.eeprom[(eeadr << 1) + 1] << 8));
+}
+
+unsigned int sim_temperature_to_ad(double temperature){
+	double x, r, ad;
+	unsigned int i;
+
+#ifdef FAHRENHEIT
+	temperature = (temperature - 32.0) / 1.8;
+#endif
+
+	/* Interpolate log(R), extrapolate with the end segments */
+	x = (temperature - NTC_T_MIN) / NTC_T_STEP;
+	i = x < 0 ? 0 : (x >= NTC_POINTS - 1 ? NTC_POINTS - 2 : (unsigned int) x);
+	r = exp(log(ntc_r[i]) + (x - i) * (log(ntc_r[i + 1]) - log(ntc_r[i])));
+
+	ad = floor(AD_MAX * NTC_R0 / (r + NTC_R0) + 0.5);
+	return ad < 0 ? 0 : (ad > AD_MAX - 1 ? AD_MAX - 1 : (unsigned int) ad);
+}
+
+/* Characters that can be told apart on seven segments (decimal point masked) */
+static const struct {
+	unsigned char led;
+	char c;
+} led_chars[] = {
+	{ LED_0, '0' }, { LED_1, '1' }, { LED_2, '2' }, { LED_3, '3' }, { LED_4, '4' },
+	{ LED_5, '5' }, { LED_6, '6' }, { LED_7, '7' }, { LED_8, '8' }, { LED_9, '9' },
+	{ LED_A, 'A' }, { LED_a, 'a' }, { LED_b, 'b' }, { LED_C, 'C' }, { LED_c, 'c' },
+	{ LED_d, 'd' }, { LED_e, 'e' }, { LED_E, 'E' }, { LED_F, 'F' }, { LED_H, 'H' },
+	{ LED_h, 'h' }, { LED_J, 'J' }, { LED_L, 'L' }, { LED_n, 'n' }, { LED_o, 'o' },
+	{ LED_P, 'P' }, { LED_r, 'r' }, { LED_t, 't' }, { LED_U, 'U' }, { LED_u, 'u' },
+	{ LED_y, 'y' }, { LED_OFF, ' ' }
+};
+
+static char led_to_char(unsigned char led){
+	unsigned char i;
+
+	for(i=0; i<sizeof(led_chars)/sizeof(led_chars[0]); i++){
+		if(led_chars[i].led == (led | 0x1)){
+			return led_chars[i].c;
+		}
+	}
+	return '?';
+}
+
+void sim_display(char *text){
+	const unsigned char digits[] = { led_10.raw, led_1.raw, led_01.raw };
+	unsigned char i, lead = 1;
+	char *p = text;
+
+	if(!led_e.e_negative){
+		*p++ = '-';
+	}
+	for(i=0; i<3; i++){
+		char c = led_to_char(digits[i]);
+		if(c != ' ' || !lead){
+			*p++ = c;
+			lead = 0;
+		}
+		if(!(digits[i] & 0x1)){
+			*p++ = '.';
+		}
+	}
+	while(p > text && p[-1] == ' '){
+		p--;
+	}
+	*p = 0;
+}
+
+void sim_display_extras(char *text){
+	static const char * const names[] = { NULL, "point", "C", "heat", NULL, "deg", "set", "cool" };
+	unsigned char i;
+
+	*text = 0;
+	for(i=0; i<8; i++){
+		if(names[i] && !(led_e.raw & (1 << i))){
+			if(*text){
+				strcat(text, " ");
+			}
+			strcat(text, names[i]);
+		}
+	}
+}
@@ -0,0 +1,135 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Simulated PIC16F1828 for running the firmware on the host.
+ *
+ * The firmware runs as a coroutine on a virtual clock (1us resolution, as
+ * the instruction clock at 4MHz). Time only advances when the main loop
+ * clears the watchdog; the clock then jumps to the next timer event, sets
+ * the interrupt flags and runs the interrupt service routine. The main loop
+ * then polls the flags as usual, so weeks of controller time run in seconds.
+ *
+ */
+
+#ifndef __SIM_H__
+#define __SIM_H__
+
+#define SIM_DEVICE
+#include "pic14/pic16f1828.h"
+
+typedef unsigned long long sim_time_t;
+
+#define SIM_MS				1000ULL
+#define SIM_SECOND			(1000ULL * SIM_MS)
+#define SIM_MINUTE			(60ULL * SIM_SECOND)
+#define SIM_HOUR			(60ULL * SIM_MINUTE)
+#define SIM_DAY				(24ULL * SIM_HOUR)
+#define SIM_NEVER			(~0ULL)
+
+/* Buttons (bits of PORTC) */
+#define SIM_BTN_PWR			0x80
+#define SIM_BTN_S			0x10
+#define SIM_BTN_UP			0x40
+#define SIM_BTN_DOWN		0x08
+
+/* A/D channels of the thermistors (AN2, and AN1 for probe 2 / humidity) */
+#define SIM_AD_PROBE1		2
+#define SIM_AD_PROBE2		1
+
+/* Outputs */
+#define SIM_ALARM			LATA0
+#define SIM_COOLING			LATA4
+#define SIM_HEATING			LATA5
+
+#define SIM_EEPROM_SIZE		256
+
+struct sim_device {
+	sim_time_t now;							/* virtual time since power on (us) */
+	unsigned int ad[32];					/* 10 bit A/D result per channel */
+	unsigned char buttons;					/* buttons held down (SIM_BTN_*) */
+	unsigned char ra1;						/* level driven on RA1 from outside */
+	unsigned char mux;						/* run the 1ms (LED multiplexing) interrupt (it also runs while buttons are held) */
+	unsigned char eeprom[SIM_EEPROM_SIZE];
+	unsigned long eeprom_writes[SIM_EEPROM_SIZE];	/* write cycles per byte */
+	unsigned long long loops;				/* main loop iterations */
+	unsigned long long interrupts;			/* interrupt service routine calls */
+};
+
+extern struct sim_device sim;
+
+/* Reset the device model to power on state, with erased EEPROM and the
+ * 1ms interrupt only when the firmware needs it for more than the LEDs.
+ * return: nothing
+ */
+void sim_init(void);
+
+/* Run the firmware (from power on at the first call) until the virtual
+ * clock has advanced by the given time.
+ * return: 0, or -1 if the firmware executed a reset
+ */
+int sim_run(sim_time_t us);
+
+/* Load EEPROM contents from an Intel HEX file (as eedata_*.hex).
+ * return: 0 on success, -1 on error
+ */
+int sim_load_eeprom(const char *filename);
+
+/* Save EEPROM contents as Intel HEX, in the same format.
+ * return: 0 on success, -1 on error
+ */
+int sim_save_eeprom(const char *filename);
+
+/* Config value (int, as eeprom_read_config()) at config address */
+int sim_eeprom_config(unsigned char eeadr);
+
+#if defined(OVBSC) || defined(MINUTE)
+/* Setpoint the firmware keeps in RAM (temperature x10) */
+long sim_setpoint(void);
+#endif
+
+/* FILTER_SHIFT of the firmware A/D filter */
+long sim_filter_shift(void);
+
+/* One A/D conversion of probe 1 (sim.ad[SIM_AD_PROBE1]) into the filter, as read_ad().
+ * return: new filter value
+ */
+long sim_read_ad(long adfilter);
+
+/* Temperature of a filter value, as ad_to_temp() (without tc).
+ * return: temperature x10
+ */
+long sim_ad_to_temp(long adfilter);
+
+/* Drive RA1 from outside (pin change interrupt on edges) */
+void sim_set_ra1(unsigned char level);
+
+/* A/D result for the NTC thermistor (10k, B=3435, 10k to Vdd) at a temperature.
+ * arguments: temperature in degrees of the build scale (Celsius or Fahrenheit)
+ * return: 10 bit A/D result
+ */
+unsigned int sim_temperature_to_ad(double temperature);
+
+/* Decode the display to text, e.g. "-12.5", "SP" or "OFF" (at least 8 chars) */
+void sim_display(char *text);
+
+/* Decode LED extras to text, e.g. "heat set" (at least 32 chars) */
+void sim_display_extras(char *text);
+
+#endif // __SIM_H__
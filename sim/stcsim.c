@@ -0,0 +1,255 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Run the firmware on the simulated device, with fixed sensor inputs and
+ * scripted button presses, and trace the display and outputs.
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "parse.h"
+#include "stc1000p.h"
+
+#define MAX_PRESSES		64
+
+struct output_stats {
+	unsigned long switches;
+	sim_time_t on_time;
+};
+
+static void usage(const char *cmd){
+	printf("Run STC1000+ firmware (%s) on a simulated device.\n", SIM_VARIANT);
+	printf("Usage: %s [-d duration (default=1d)] [-i interval (default=1h)] [-t temperature] [-T temperature2]\n", cmd);
+	printf("          [-a channel=ad] [-e eeprom.hex] [-w eeprom.hex] [-c item=value] [-b time:buttons[:ms]] [-m]\n");
+	printf("  -d  virtual time to run, with unit s, m, h or d (e.g. 14d)\n");
+	printf("  -i  print display and outputs at this interval (0 for summary only)\n");
+	printf("  -t  temperature at probe 1 (default 20C/68F)\n");
+	printf("  -T  temperature at probe 2\n");
+	printf("  -a  raw 10 bit A/D value for a channel (e.g. 1=500 for humidity)\n");
+	printf("  -e  EEPROM contents at power on (default %s)\n", SIM_EEDATA);
+	printf("  -w  save EEPROM contents after the run\n");
+	printf("  -c  set a menu item (temperatures in degrees), profile step (e.g. SP03, dh03) or config address (raw) before power on\n");
+	printf("  -b  hold buttons (p, s, u, d) at a time, e.g. 10s:s or 1h:ud:5000\n");
+	printf("  -m  run the 1ms LED multiplexing interrupt (slower)\n");
+}
+
+static void format_time(char *s, sim_time_t t){
+	unsigned long sec = t / SIM_SECOND;
+	sprintf(s, "%lud %02lu:%02lu:%02lu", sec / 86400, (sec / 3600) % 24, (sec / 60) % 60, sec % 60);
+}
+
+static void sample(struct output_stats *stats, unsigned char *last, unsigned char on, sim_time_t step){
+	if(on != *last){
+		stats->switches++;
+		*last = on;
+	}
+	if(on){
+		stats->on_time += step;
+	}
+}
+
+static void print_stats(const char *name, const struct output_stats *stats, sim_time_t duration){
+	char on[32];
+
+	format_time(on, stats->on_time);
+	printf("%-8s %6lu switches (%.2f/h), on %s (%.1f%%)\n", name, stats->switches,
+			stats->switches * (double) SIM_HOUR / duration, on, 100.0 * stats->on_time / duration);
+}
+
+int main(int argc, char *argv[]){
+	const char *eeprom_in = SIM_EEDATA, *eeprom_out = NULL;
+	const char *configs[128];
+	struct press presses[MAX_PRESSES];
+	unsigned int nconfigs = 0, npresses = 0, i;
+	sim_time_t duration = SIM_DAY, interval = SIM_HOUR, next_trace = 0, t;
+	struct output_stats heating = {0}, cooling = {0}, alarm = {0};
+	unsigned char heat = 0, cool = 0, al = 0;
+	unsigned long max_writes = 0, writes = 0;
+	clock_t start;
+	char *end;
+	int c;
+
+	sim_init();
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "d:i:t:T:a:e:w:c:b:m")) != -1) {
+		switch(c) {
+			case 'd':
+				duration = parse_time(optarg, &end);
+				if(duration == SIM_NEVER || *end){
+					fprintf(stderr, "Malformed duration '%s'.\n", optarg);
+					return 1;
+				}
+				break;
+			case 'i':
+				interval = parse_time(optarg, &end);
+				if(interval == SIM_NEVER || *end){
+					fprintf(stderr, "Malformed interval '%s'.\n", optarg);
+					return 1;
+				}
+				break;
+			case 't':
+				sim.ad[SIM_AD_PROBE1] = sim_temperature_to_ad(atof(optarg));
+				break;
+			case 'T':
+				sim.ad[SIM_AD_PROBE2] = sim_temperature_to_ad(atof(optarg));
+				break;
+			case 'a':
+				i = atoi(optarg);
+				if(i >= sizeof(sim.ad)/sizeof(sim.ad[0]) || !strchr(optarg, '=')){
+					fprintf(stderr, "Malformed A/D input '%s'.\n", optarg);
+					return 1;
+				}
+				sim.ad[i] = atoi(strchr(optarg, '=') + 1) & 0x3ff;
+				break;
+			case 'e':
+				eeprom_in = optarg;
+				break;
+			case 'w':
+				eeprom_out = optarg;
+				break;
+			case 'c':
+				if(nconfigs == sizeof(configs)/sizeof(configs[0])){
+					fprintf(stderr, "Too many config values.\n");
+					return 1;
+				}
+				configs[nconfigs++] = optarg;
+				break;
+			case 'b':
+				if(npresses == MAX_PRESSES || parse_press(optarg, &presses[npresses]) < 0){
+					fprintf(stderr, "Malformed or too many button presses '%s'.\n", optarg);
+					return 1;
+				}
+				npresses++;
+				break;
+			case 'm':
+				sim.mux = 1;
+				break;
+			case '?':
+				if (strchr("ditTaewcb", optopt)){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc){
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(sim_load_eeprom(eeprom_in) < 0){
+		return 1;
+	}
+	for(i=0; i<nconfigs; i++){
+		if(parse_config(configs[i]) < 0){
+			fprintf(stderr, "Unknown or malformed config value '%s'.\n", configs[i]);
+			return 1;
+		}
+	}
+
+	if(interval){
+		printf("#            time  display  extras                   heat  cool  alarm\n");
+	}
+
+	start = clock();
+
+	/* Run in steps of (at most) a second, to count output switching */
+	for(t = 0; t < duration;){
+		sim_time_t next = t + SIM_SECOND;
+
+		if(next > duration){
+			next = duration;
+		}
+		if(interval && next_trace < next){
+			next = next_trace;
+		}
+
+		sim.buttons = 0;
+		for(i=0; i<npresses; i++){
+			if(presses[i].time > t && presses[i].time < next){
+				next = presses[i].time;
+			}
+			if(presses[i].time + presses[i].duration > t && presses[i].time + presses[i].duration < next){
+				next = presses[i].time + presses[i].duration;
+			}
+			if(t >= presses[i].time && t < presses[i].time + presses[i].duration){
+				sim.buttons |= presses[i].buttons;
+			}
+		}
+
+		if(next > t && sim_run(next - t) < 0){
+			printf("Firmware reset at %llu us\n", sim.now);
+			break;
+		}
+
+		sample(&heating, &heat, SIM_HEATING, next - t);
+		sample(&cooling, &cool, SIM_COOLING, next - t);
+		sample(&alarm, &al, SIM_ALARM, next - t);
+		t = next;
+
+		if(interval && t == next_trace){
+			char time[32], display[8], extras[32];
+
+			format_time(time, t);
+			sim_display(display);
+			sim_display_extras(extras);
+			printf("%17s  %-7s  %-24s %4u  %4u  %5u\n", time, display, extras, SIM_HEATING, SIM_COOLING, SIM_ALARM);
+			next_trace += interval;
+		}
+	}
+
+	for(i=0; i<SIM_EEPROM_SIZE; i++){
+		writes += sim.eeprom_writes[i];
+		if(sim.eeprom_writes[i] > max_writes){
+			max_writes = sim.eeprom_writes[i];
+		}
+	}
+
+	{
+		char time[32];
+		format_time(time, sim.now);
+		printf("%s simulated in %.2f s, %llu main loop passes, %llu interrupts\n", time,
+				(double) (clock() - start) / CLOCKS_PER_SEC, sim.loops, sim.interrupts);
+	}
+	print_stats("heating", &heating, t);
+	print_stats("cooling", &cooling, t);
+	print_stats("alarm", &alarm, t);
+	printf("EEPROM   %6lu writes (at most %lu to one byte)\n", writes, max_writes);
+
+	if(eeprom_out && sim_save_eeprom(eeprom_out) < 0){
+		return 1;
+	}
+
+	return 0;
+}
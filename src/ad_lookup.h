@@ -0,0 +1,12 @@
+/* Generated by ntc-lut-generator from ntc-10k-3435.txt, do not edit.
+ * lut -M poly -r 10000.0 -m 1024 -s 32
+ */
+#ifdef FAHRENHEIT
+	const int ad_lookup[] = { 0, -555, -319, -167, -49, 48, 134, 211, 282, 348, 412, 474, 534, 593, 652, 711, 770, 831, 893, 957, 1025, 1096, 1172, 1253, 1343, 1444, 1559, 1694, 1860, 2078, 2397, 2988 };
+	#define AD_LOOKUP_MIN	(-555)
+	#define AD_LOOKUP_MAX	(2988)
+#else  // CELSIUS
+	const int ad_lookup[] = { 0, -486, -355, -270, -205, -151, -104, -61, -21, 16, 51, 85, 119, 152, 184, 217, 250, 284, 318, 354, 391, 431, 473, 519, 569, 624, 688, 763, 856, 977, 1154, 1482 };
+	#define AD_LOOKUP_MIN	(-486)
+	#define AD_LOOKUP_MAX	(1482)
+#endif
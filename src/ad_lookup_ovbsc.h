@@ -0,0 +1,14 @@
+/* Generated by ntc-lut-generator from ntc-10k-3435.txt, do not edit.
+ * lut -M poly -r 10000.0 -m 1024 -s 32 -n 20 -w 20.0:105.0
+ */
+/* Segments start at A/D value / 16 << 2 | log2(segment width / 16), table values are at the segment starts and the end of the last. */
+const unsigned char ad_segments[] = { 0x09, 0x12, 0x23, 0x43, 0x63, 0x82, 0x92, 0xa2, 0xb1, 0xb9, 0xc1, 0xc9, 0xd1, 0xd8, 0xdc, 0xe0, 0xe4, 0xe8, 0xec, 0xf1 };
+#ifdef FAHRENHEIT
+	const int ad_lookup[] = { -555, -319, -49, 282, 534, 770, 893, 1025, 1172, 1253, 1343, 1444, 1559, 1694, 1772, 1860, 1961, 2078, 2220, 2397, 2988 };
+	#define AD_LOOKUP_MIN	(-555)
+	#define AD_LOOKUP_MAX	(2988)
+#else  // CELSIUS
+	const int ad_lookup[] = { -486, -355, -205, -21, 119, 250, 318, 391, 473, 519, 569, 624, 688, 763, 807, 856, 912, 977, 1055, 1154, 1482 };
+	#define AD_LOOKUP_MIN	(-486)
+	#define AD_LOOKUP_MAX	(1482)
+#endif
@@ -22,21 +22,38 @@
 # This is a simple script to make building STC-1000+ releases easier.
 
 # Extract version info from stc1000p.h
-v=`cat stc1000p.h | grep STC1000P_VERSION`
-e=`cat stc1000p.h | grep STC1000P_EEPROM_VERSION`
+v=`cat stc1000p.h | grep "^#define STC1000P_VERSION"`
+e=`cat stc1000p.h | grep "^#define STC1000P_EEPROM_VERSION"`
 
-# Create stc1000p.js
+# Create shared sketch template for the profile page
 function init_js {
+	mkdir -p ../profile/firmware
 	cat picprog.template | sed "s/^#define STC1000P_VERSION.*/$v/" | sed "s/^#define STC1000P_EEPROM_VERSION.*/$e/" | sed "s/'/\\\\\\\'/g" > stc1000p.js.tmp
-	echo "var stc1000p={};" > ../profile/stc1000p.js
-	echo "stc1000p[\"picprog\"]='' +" >> ../profile/stc1000p.js
+	echo "stc1000p_loaded(\"picprog\", '' +" > ../profile/firmware/picprog.js
 	while IFS= read r; do
 		echo "'$r\n' +"; 
-	done < stc1000p.js.tmp >> ../profile/stc1000p.js
-	echo "'';" >> ../profile/stc1000p.js
+	done < stc1000p.js.tmp >> ../profile/firmware/picprog.js
+	echo "'');" >> ../profile/firmware/picprog.js
 	rm -f stc1000p.js.tmp
 }
 
+# Create manifest of the firmware bundles available to the profile page
+function manifest_js {
+	echo "var stc1000p_manifest={\"version\":`echo $v | sed 's/.*(\(.*\)).*/\1/'`, \"eeprom_version\":`echo $e | sed 's/.*(\(.*\)).*/\1/'`, \"variants\":{" > ../profile/firmware/manifest.js
+	for f in ../profile/firmware/stc1000p*.js; do
+		b=`basename $f .js`
+		t=${b#stc1000p_}
+		if [[ $b == "stc1000p" ]]; then
+			t=vanilla
+		fi
+		# Not bundles left from before a variant was taken off the page
+		if [[ " $page " == *" $t "* ]]; then
+			echo "	\"${b#stc1000p}\":\"firmware/$b.js\"," >> ../profile/firmware/manifest.js
+		fi
+	done
+	echo "}};" >> ../profile/firmware/manifest.js
+}
+
 function build_stc1000p_version {
 	
 	if [[ $1 != "" && $1 != "vanilla" ]]; then 
@@ -48,7 +65,7 @@ function build_stc1000p_version {
 	# Build HEX
 	echo "";
 	echo "Building stc1000p$version"
-	make stc1000p$version
+	make stc1000p$version || exit -1
 
 	echo "";
 	echo "Create picprog$version.ino";
@@ -56,65 +73,58 @@ function build_stc1000p_version {
 	# Create sketch and insert version info
 	cat picprog.template | sed "s/^#define STC1000P_VERSION.*/$v/" | sed "s/^#define STC1000P_EEPROM_VERSION.*/$e/" > ../picprog$version.ino
 
-	# Convert firmware HEX data to embed in sketch
+	# Pack firmware HEX data to embed in sketch
 	echo "#if INCLUDE_CELSIUS_HEX_DATA" > stc1000p_hex.tmp; 
-	echo "const char hex_celsius[] PROGMEM = {" >> stc1000p_hex.tmp; 
-	for l in `cat build/stc1000p_celsius$version.hex | sed 's/^://' | sed 's/\(..\)/0\x\1\,/g'`; do 
-		echo "   $l" | sed 's/0x00,0x00,0x00,0x01,0xFF,/0x00,0x00,0x00,0x01,0xFF/' >> stc1000p_hex.tmp; 
-	done; 
-	echo "};" >> stc1000p_hex.tmp
+	../tools/hexpack -n hex_celsius build/stc1000p_celsius$version.hex >> stc1000p_hex.tmp
 	echo "#endif" >> stc1000p_hex.tmp
 
 	echo "#if INCLUDE_FAHRENHEIT_HEX_DATA" >> stc1000p_hex.tmp; 
-	echo "const char hex_fahrenheit[] PROGMEM = {" >> stc1000p_hex.tmp; 
-	for l in `cat build/stc1000p_fahrenheit$version.hex | sed 's/^://' | sed 's/\(..\)/0\x\1\,/g'`; do 
-		echo "   $l" | sed 's/0x00,0x00,0x00,0x01,0xFF,/0x00,0x00,0x00,0x01,0xFF/' >> stc1000p_hex.tmp; 
-	done; 
-	echo "};" >> stc1000p_hex.tmp
+	../tools/hexpack -n hex_fahrenheit build/stc1000p_fahrenheit$version.hex >> stc1000p_hex.tmp
 	echo "#endif" >> stc1000p_hex.tmp
 
-	cat stc1000p_hex.tmp | sed "s/'/\\\\\\\'/g" > stc1000p_hex.js.tmp
-	echo "stc1000p[\"stc1000p$version\"]='' +" >> ../profile/stc1000p.js
-	while IFS= read r; do
-		echo "'$r\n' +"; 
-	done < stc1000p_hex.js.tmp >> ../profile/stc1000p.js
-	echo "'';" >> ../profile/stc1000p.js
-	rm -f stc1000p_hex.js.tmp
+	# Create firmware bundle for the profile page (packed images, base64 encoded),
+	# for the variants whose EEPROM layout the page can generate
+	if [[ " $page " == *" $1 "* ]]; then
+		echo "stc1000p_loaded(\"stc1000p$version\", {" > ../profile/firmware/stc1000p$version.js
+		for n in celsius fahrenheit; do
+			echo "	\"hex_$n\":\"`../tools/hexpack -b build/stc1000p_$n$version.hex | base64 -w0`\"," >> ../profile/firmware/stc1000p$version.js
+		done
+		echo "});" >> ../profile/firmware/stc1000p$version.js
+	fi
 
 	echo "#if INCLUDE_CELSIUS_HEX_DATA" >> stc1000p_hex.tmp; 
-	echo "const char hex_eeprom_celsius[] PROGMEM = {" >> stc1000p_hex.tmp; 
-	for l in `cat build/eedata_celsius$version.hex | sed 's/^://' | sed 's/\(..\)/0\x\1\,/g'`; do 
-		echo "   $l" | sed 's/0x00,0x00,0x00,0x01,0xFF,/0x00,0x00,0x00,0x01,0xFF/' >> stc1000p_hex.tmp; 
-	done; 
-	echo "};" >> stc1000p_hex.tmp
+	../tools/hexpack -n hex_eeprom_celsius build/eedata_celsius$version.hex >> stc1000p_hex.tmp
 	echo "#endif" >> stc1000p_hex.tmp
 
 	echo "#if INCLUDE_FAHRENHEIT_HEX_DATA" >> stc1000p_hex.tmp; 
-	echo "const char hex_eeprom_fahrenheit[] PROGMEM = {" >> stc1000p_hex.tmp; 
-	for l in `cat build/eedata_fahrenheit$version.hex | sed 's/^://' | sed 's/\(..\)/0\x\1\,/g'`; do 
-		echo "   $l" | sed 's/0x00,0x00,0x00,0x01,0xFF,/0x00,0x00,0x00,0x01,0xFF/' >> stc1000p_hex.tmp; 
-	done; 
-	echo "};" >> stc1000p_hex.tmp
+	../tools/hexpack -n hex_eeprom_fahrenheit build/eedata_fahrenheit$version.hex >> stc1000p_hex.tmp
 	echo "#endif" >> stc1000p_hex.tmp
 
 	cat stc1000p_hex.tmp >> ../picprog$version.ino
 	rm -f stc1000p_hex.tmp
 
-	# Print size approximation (from .asm files)
-	echo "";
-	echo "Size";
-	let s=0;
-	for a in `cat build/page0_celsius$version.asm build/page1_celsius$version.asm | grep instructions | sed 's/^.*=  //' | sed 's/ instructions.*//'`;
-	do
-		echo $a;
-		s=$(($s+$a));
-	done;
-	echo "total $s";
+	# Program memory used (from the HEX files), the PIC16F1828 has 4096 words
+	for n in celsius fahrenheit; do
+		s=`../tools/hexpack -s build/stc1000p_$n$version.hex` || exit -1
+		sizes="$sizes
+stc1000p_$n$version	$s words, $((4096-$s)) free"
+		if [[ $s -gt 4096 ]]; then
+			echo "stc1000p_$n$version does not fit, $s words"
+			exit -1
+		fi
+	done
 
 }
 
-all="vanilla probe2 com fo433 minute minute_probe2 minute_com minute_fo433 ovbsc rh"
+# Not all have the 6 profiles of vanilla: the PID variants have Pr0-Pr4, the
+# packed ones Pr0-Pr9, and com_log only Pr0-Pr1 (the log takes the place of
+# Pr2-Pr5, about 32 hours at the default Li of 15 minutes).
+all="vanilla probe2 com fo433 minute minute_probe2 minute_com minute_fo433 pid probe2_pid minute_pid com_log packed com_packed ovbsc rh"
+# Variants offered by the profile page (profile/hextabbed.html). It has no
+# packed profile encoder and no PID or LOG menu layout, so not those.
+page="vanilla probe2 com fo433 minute minute_probe2 minute_com minute_fo433 ovbsc rh"
 targets=""
+sizes=""
 
 if [[ $# == 0 ]]; then
 	targets=$all;
@@ -144,10 +154,19 @@ else
 	done
 fi
 
+# Build the HEX packer used to embed firmware in the sketches
+make -C ../tools hexpack || exit -1
+
 init_js
+# Versions first, the Makefile checks them against stc1000p.h
+manifest_js
 for t in $targets; do
 	build_stc1000p_version $t
 done
+manifest_js
+
+echo "";
+echo "Size$sizes"
 
 make clean
 
@@ -27,14 +27,39 @@
 
 /* Initial EEPROM data */
 __code const int __at(0xF000) eedata[] = {
-#if !(defined(OVBSC) || defined(RH))
+#if defined(PACKED)
+/* Pr0 to Pr9 as step records, 16.0 24h, 17.0 24h, 18.0 24h, 19.0 24h, 20.0 144h, 25.0 48h, 4.0 */
+#define PROFILE_DEFAULT \
+			PROFILE_LONG(160, 24), PROFILE_SHORT(10, 24), PROFILE_SHORT(10, 24), PROFILE_SHORT(10, 24), \
+			PROFILE_SHORT(10, 144), PROFILE_SHORT(50, 48), PROFILE_LONG(40, 0)
+			PROFILE_DEFAULT, PROFILE_DEFAULT, PROFILE_DEFAULT, PROFILE_DEFAULT, PROFILE_DEFAULT,
+			PROFILE_DEFAULT, PROFILE_DEFAULT, PROFILE_DEFAULT, PROFILE_DEFAULT, PROFILE_DEFAULT
+			// The rest of the words before the menu data are free for longer profiles
+};
+
+__code const int __at(0xF000 + (EEADR_MENU << 1)) eedata_menu[] = {
+#elif !(defined(OVBSC) || defined(RH))
 			160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0, // Pr0 (SP0, dh0, ..., dh8, SP9)
 			160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0, // Pr1 (SP0, dh0, ..., dh8, SP9)
+#if NO_OF_PROFILES > 2
 			160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0, // Pr2 (SP0, dh0, ..., dh8, SP9)
 			160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0, // Pr3 (SP0, dh0, ..., dh8, SP9)
 			160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0, // Pr4 (SP0, dh0, ..., dh8, SP9)
+#endif
+#if NO_OF_PROFILES > 5
 			160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0, // Pr5 (SP0, dh0, ..., dh8, SP9)
+#endif
 #endif
 			MENU_DATA(EEPROM_DEFAULTS)
+			// With LOG, the statistics and the log after the menu data are left erased (0xff, reset and empty)
 };
 
+#if !(defined(OVBSC) || defined(RH))
+#if defined(COM)
+/* No clock calibration */
+__code const int __at(0xF000 + (EEADR_CLOCK_TICKS << 1)) eedata_clock_ticks = CLOCK_TICKS_PER_HOUR;
+#endif
+
+/* Power on, with the layout version of this data in the high byte */
+__code const int __at(0xF000 + (EEADR_POWER_ON << 1)) eedata_power_on = EEPROM_POWER_ON_VALUE(1);
+#endif
@@ -26,11 +26,22 @@
 unsigned int __at _CONFIG1 __CONFIG1 = 0xFD4;
 unsigned int __at _CONFIG2 __CONFIG2 = 0x3AFF;
 
-/* Temperature lookup table  */
-#ifdef FAHRENHEIT
-	const int ad_lookup[] = { 0, -555, -319, -167, -49, 48, 134, 211, 282, 348, 412, 474, 534, 593, 652, 711, 770, 831, 893, 957, 1025, 1096, 1172, 1253, 1343, 1444, 1559, 1694, 1860, 2078, 2397, 2987 };
-#else  // CELSIUS
-	const int ad_lookup[] = { 0, -486, -355, -270, -205, -151, -104, -61, -21, 16, 51, 85, 119, 152, 184, 217, 250, 284, 318, 354, 391, 431, 473, 519, 569, 624, 688, 763, 856, 977, 1154, 1482 };
+/* Temperature lookup table, generated by ntc-lut-generator (see Makefile) */
+#if defined(OVBSC)
+/* Non-uniform, least error at mash and boil temperatures */
+#include "ad_lookup_ovbsc.h"
+#else
+#include "ad_lookup.h"
+#endif
+
+/* Check that the control path temperatures (see TEMP_FRAC_BITS) fit in 16 bits, with
+ * corrections, setpoint +- hysteresis and temperature - setpoint (for SA) included.
+ */
+#define CONTROL_TEMP_MAX	((AD_LOOKUP_MAX + TEMP_CORR_MAX) * (1 << TEMP_FRAC_BITS))
+#define CONTROL_TEMP_MIN	((AD_LOOKUP_MIN + TEMP_CORR_MIN) * (1 << TEMP_FRAC_BITS))
+#if (CONTROL_TEMP_MAX - TEMP_MIN * (1 << TEMP_FRAC_BITS)) > 32767 || (CONTROL_TEMP_MIN - TEMP_MAX * (1 << TEMP_FRAC_BITS)) < -32768 \
+	|| ((TEMP_MAX + TEMP_HYST_2_MAX) * (1 << TEMP_FRAC_BITS)) > 32767 || ((TEMP_MIN - TEMP_HYST_2_MAX) * (1 << TEMP_FRAC_BITS)) < -32768
+#error "Control path temperatures overflow 16 bits, decrease TEMP_FRAC_BITS"
 #endif
 
 /* LED character lookup table (0-9) */
@@ -40,6 +51,14 @@ unsigned const char led_lookup[] = { LED_0, LED_1, LED_2, LED_3, LED_4, LED_5, L
 led_e_t led_e = {0xff};
 led_t led_10, led_1, led_01;
 
+/* Button pins (port C) seen pressed since button_menu_fsm() last read them */
+unsigned char button_pins = 0;
+
+/* Debounced button pins, and a 2 bit count per pin of the samples that
+ * differ from it in a row (a vertical counter, bits inverted)
+ */
+static unsigned char button_state = 0, button_ct0 = 0xff, button_ct1 = 0xff;
+
 /* Global state flags for various optimizations (uses fewer instructions and data space vs 1/0 chars) */
 union {
 	unsigned char raw;
@@ -59,7 +78,7 @@ union {
 	};
 } state_flags = {0};
 
-static int temperature=0;
+static int temperature=0; // In control path units (TEMP_FRAC_BITS)
 
 #if defined(OVBSC)
 led_t al_led_10, al_led_1, al_led_01;
@@ -68,22 +87,33 @@ int output=0;
 static int thermostat_output=0;
 #endif
 #if defined(PB2)
-static int temperature2=0;
+static int temperature2=0; // In control path units (TEMP_FRAC_BITS)
 #elif defined(COM)
 static volatile unsigned char com_data=0;
 static volatile unsigned char com_write=0;
 static volatile unsigned char com_tmout=0;
 static volatile unsigned char com_count=0;
 static volatile unsigned char com_state=0;
+#if defined(COM_CLOCK)
+static unsigned int clock_count = 0xffff;	// Ticks since the last COM_CLOCK_MARK (stops at 0xffff)
+static int clock_trim = 0;			// Half the ticks to add per hour (CLOCK_TICKS_PER_HOUR - ticks counted)
+static int clock_step = (CLOCK_TICKS_PER_HOUR >> 1);	// Trim to sum up per 16 ticks added
+static int clock_acc = 0;			// Trim summed up (once per 1s section)
+#endif
 #elif defined(FO433)
 static volatile unsigned char fo433_data=0;
 static unsigned char fo433_state=0;
 static volatile unsigned char fo433_count=0;
 static volatile unsigned char fo433_send_space=0;
-static unsigned char fo433_sec_count = 24;
+static unsigned int fo433_sec_count = 24;
+static unsigned char fo433_ext=0;		// Sending the extended frame
+static unsigned char fo433_backoff=0;		// Interval is 48s << fo433_backoff
+static unsigned char fo433_rand=0;		// Jitter
+static unsigned char fo433_relays=0;		// As last sent
+static int fo433_temp=0;
 #endif
 #if defined(MINUTE)
-int setpoint;
+int setpoint; // In control path units (TEMP_FRAC_BITS)
 unsigned int curr_dur = 0;
 #endif
 #if defined(RH)
@@ -92,6 +122,27 @@ unsigned int curr_dur = 0;
 static unsigned char 	humidity=0;
 static unsigned int 	wait=0;
 #endif
+#if defined(TIMING)
+/* Cycle counts of the hot paths (from timer 1, 1us per count), read with
+ * COM_READ_TIMING. Sections include interrupts taken meanwhile.
+ */
+#define TIMING_LAST		0
+#define TIMING_MIN		1
+#define TIMING_MAX		2
+enum timing_sections {
+	timing_second = 0,	// 1s section of main()
+	timing_menu,		// button_menu_fsm()
+	timing_com,			// handle_com()
+	NO_OF_TIMING_SECTIONS
+};
+static struct {
+	unsigned int section[NO_OF_TIMING_SECTIONS][3];
+	unsigned char isr[3];		// Interrupt service routine (less than 256 cycles)
+	unsigned int tmr4_gap;		// Longest time between handling TMR4IF, in ms (60 when on time)
+} timing;
+static unsigned int timing_ms = 0;	// Counted in the 1ms interrupt
+static unsigned int tmr4_ms = 0;	// timing_ms when TMR4IF was handled last
+#endif
 
 /* Functions.
  * Note: Functions used from other page cannot be static, but functions
@@ -108,6 +159,11 @@ unsigned int eeprom_read_config(unsigned char eeprom_address){
 	unsigned int data = 0;
 	eeprom_address = (eeprom_address << 1);
 
+#if defined(LOG)
+	// A log write may still be in progress
+	while(WR);
+#endif
+
 	do {
 		EEADRL = eeprom_address; // Data Memory Address to read
 		CFGS = 0; // Deselect config space
@@ -120,6 +176,40 @@ unsigned int eeprom_read_config(unsigned char eeprom_address){
 	return data; // Return data
 }
 
+/* Start writing one byte to EEPROM, without waiting for it to complete
+ * (WR is cleared when done).
+ * arguments: EEPROM byte address (0-255), data
+ * return: nothing
+ */
+static void eeprom_write_byte(unsigned char eeprom_address, unsigned char data){
+	// Address to write
+	EEADRL = eeprom_address;
+	// Data to write
+	EEDATL = data;
+	// Deselect configuration space
+	CFGS = 0;
+	//Point to DATA memory
+	EEPGD = 0;
+	// Enable write
+	WREN = 1;
+
+	// Disable interrupts during write
+	GIE = 0;
+
+	// Write magic words to EECON2
+	EECON2 = 0x55;
+	EECON2 = 0xAA;
+
+	// Initiate a write cycle
+	WR = 1;
+
+	// Re-enable interrupts
+	GIE = 1;
+
+	// Disable writes
+	WREN = 0;
+}
+
 /* Store one configuration data to the specified address.
  * arguments: Config address (0-127), data
  * return: nothing
@@ -135,32 +225,7 @@ void eeprom_write_config(unsigned char eeprom_address,unsigned int data)
 	eeprom_address = (eeprom_address << 1);
 
 	do {
-		// Address to write
-	    EEADRL = eeprom_address;
-	    // Data to write
-	    EEDATL = (unsigned char) data;
-	    // Deselect configuration space
-	    CFGS = 0;
-	    //Point to DATA memory
-	    EEPGD = 0;
-	    // Enable write
-	    WREN = 1;
-
-	    // Disable interrupts during write
-	    GIE = 0;
-
-	    // Write magic words to EECON2
-	    EECON2 = 0x55;
-	    EECON2 = 0xAA;
-
-	    // Initiate a write cycle
-	    WR = 1;
-
-	    // Re-enable interrupts
-	    GIE = 1;
-
-	    // Disable writes
-	    WREN = 0;
+		eeprom_write_byte(eeprom_address, (unsigned char) data);
 
 	    // Wait for write to complete
 	    while(WR);
@@ -244,21 +309,41 @@ void value_to_led(int value, unsigned char decimal) {
 }
 
 #if defined OVBSC
-static unsigned char output_counter=0;
+/* Time proportioned output, in windows of 100 slots of Pd ms. The relays
+ * are switched from the timer 2 interrupt, so the window does not stretch
+ * while the main loop is busy. With OUTPUT_BURST, the on slots of each
+ * relay are spread over the window by an error accumulator (burst fire),
+ * else they are the last ones of the window. A new output is taken at the
+ * start of a window, so every window gives exactly the set percentage.
+ */
+static volatile unsigned char output_counter=0;
+static unsigned char slot_ms=100, duty_heat=0, duty_cool=0;
+#if defined(OUTPUT_BURST)
+static unsigned char acc_heat=0, acc_cool=0;
+#endif
+/* Next window, set by output_control() and taken by the interrupt when output_next is set */
+static volatile unsigned char output_next=0, next_ms, next_heat, next_cool;
+
 static void output_control(){
-	static unsigned char o, inv;
-	
-	if(output_counter == 0){
-		output_counter = 100;
+	if(!output_next){
+		unsigned char o, e2;
+
+		o = output < 0 ? -output : output;
+		e2 = 0;
+		if(o > 100){
+			e2 = o - 100;
+			o = 100;
+		}
+		next_ms = eeprom_read_config(EEADR_MENU_ITEM(Pd));
 		if(output < 0){
-			o = -output;
-			inv = 1;
+			next_heat = e2;
+			next_cool = o;
 		}else{
-			o = output;
-			inv = 0;
+			next_heat = o;
+			next_cool = e2;
 		}
+		output_next = 1;
 	}
-	output_counter--;
 
 	LATA0 = 0;
 	led_e.e_point = 1;
@@ -269,27 +354,11 @@ static void output_control(){
 	}
 
 	if(PAUSE || OFF){
-		LATA5 = 0;
-		LATA4 = 0;
 		PUMP_OFF();
+	} else if(PUMP){
+		PUMP_MANUAL();
 	} else {
-		unsigned char e1=(o > output_counter);
-		unsigned char e2=(o > (output_counter+100));
-
-		if(inv){
-			LATA5 = e2;
-			LATA4 = e1;
-		}else{
-			LATA5 = e1;
-			LATA4 = e2;
-		}
-
-		if(PUMP){
-			PUMP_MANUAL();
-		} else {
-			PUMP_OFF();
-		}
-
+		PUMP_OFF();
 	}
 
 	led_e.e_heat = !LATA5;
@@ -298,7 +367,7 @@ static void output_control(){
 
 static void temperature_control(){
 	if(THERMOSTAT){
-		if(temperature < setpoint){
+		if(temperature < TEMP_FINE(setpoint)){
 			output = thermostat_output;
 		} else {
 			output = 0;
@@ -357,7 +426,7 @@ static void program_fsm(){
 			setpoint = eeprom_read_config(EEADR_MENU_ITEM(St)); /* Strike temp */
 			output = eeprom_read_config(EEADR_MENU_ITEM(SO));
 			PUMP=(eeprom_read_config(EEADR_MENU_ITEM(PF)) >> 0) & 0x1;
-			if(temperature >= setpoint){
+			if(temperature >= TEMP_FINE(setpoint)){
 				THERMOSTAT = 1;
 				thermostat_output = eeprom_read_config(EEADR_MENU_ITEM(PO));
 				ALARM = (eeprom_read_config(EEADR_MENU_ITEM(APF)) >> 0) & 0x1;
@@ -385,7 +454,7 @@ static void program_fsm(){
 			output = eeprom_read_config(EEADR_MENU_ITEM(SO));
 			THERMOSTAT = 0;
 			PUMP=(eeprom_read_config(EEADR_MENU_ITEM(PF)) >> 1) & 0x1;
-			if(temperature >= setpoint || (eeprom_read_config(EEADR_MENU_ITEM(Pd1) + (mashstep << 1)) == 0)){
+			if(temperature >= TEMP_FINE(setpoint) || (eeprom_read_config(EEADR_MENU_ITEM(Pd1) + (mashstep << 1)) == 0)){
 				countdown = eeprom_read_config(EEADR_MENU_ITEM(Pd1) + (mashstep << 1)); /* Mash step duration */
 				prg_state = prg_mash;
 			} else if(countdown==0){
@@ -424,7 +493,7 @@ static void program_fsm(){
 			THERMOSTAT = 0;
 			PUMP=(eeprom_read_config(EEADR_MENU_ITEM(PF)) >> 3) & 0x1;
 			output = eeprom_read_config(EEADR_MENU_ITEM(SO)); /* Boil output */
-			if(temperature >= eeprom_read_config(EEADR_MENU_ITEM(Ht))){ /* Boil up temp */
+			if(temperature >= TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(Ht)))){ /* Boil up temp */
 				countdown = eeprom_read_config(EEADR_MENU_ITEM(Hd)); /* Hotbreak duration */
 				prg_state = prg_hotbreak;
 			} else if(countdown==0){
@@ -475,6 +544,60 @@ static void program_fsm(){
 
 #else // !OVBSC !RH
 
+#if defined(PACKED)
+/* The step found by profile_seek() */
+int prof_sp;					// Setpoint
+unsigned int prof_dur;			// Duration, 0 for the last step of the profile
+static int prof_base;			// Setpoint of the step before it (0 for step 0)
+static unsigned char prof_adr;	// Config address of its record
+static unsigned char prof_next;	// Config address of the record after it
+
+/* Find a step of a profile, by walking the records from the start (there is
+ * no index to keep up to date when records move, and this runs once per
+ * hour or on a key press).
+ * arguments: profile, step
+ * return: 0 if found, else the number of steps past the last step of the
+ * profile, which is found instead
+ */
+unsigned char profile_seek(unsigned char profile, unsigned char step){
+	unsigned char adr = 0;
+
+	prof_sp = 0;
+	for(;;){
+		unsigned int rec = eeprom_read_config(adr);
+
+		prof_adr = adr;
+		prof_base = prof_sp;
+		if(rec & 0x8000){
+			// Sign extend the 7 bit delta
+			prof_sp += (int)(((unsigned char)(rec >> 8)) ^ 0xc0) - 0x40;
+			prof_dur = (unsigned char)rec;
+			adr++;
+		} else {
+			prof_sp = (int)(rec ^ 0x4000) - 0x4000;
+			prof_dur = eeprom_read_config(adr + 1);
+			adr += 2;
+		}
+		prof_next = adr;
+
+		// Records running into the menu data, end the profiles there
+		if(adr >= EEADR_MENU){
+			prof_dur = 0;
+		}
+
+		if(profile == 0){
+			if(step == 0 || prof_dur == 0){
+				return step;
+			}
+			step--;
+		} else if(prof_dur == 0){
+			profile--;
+			prof_sp = 0;
+		}
+	}
+}
+#endif
+
 /* To be called once every hour on the hour.
  * Updates EEPROM configuration when running profile.
  */
@@ -484,7 +607,12 @@ static void update_profile(){
 	// Running profile?
 	if (profile_no < THERMOSTAT_MODE) {
 		unsigned char curr_step = eeprom_read_config(EEADR_MENU_ITEM(St));
+#if defined(PACKED)
+		unsigned char last_step;
+		int profile_step_sp;
+#else
 		unsigned char profile_step_eeaddr;
+#endif
 		unsigned int profile_step_dur;
 		int profile_next_step_sp;
 #if defined MINUTE
@@ -498,19 +626,32 @@ static void update_profile(){
 			curr_step = 8;
 		}
 
+#if defined(PACKED)
+		profile_seek(profile_no, curr_step);
+		profile_step_sp = prof_sp;
+		profile_step_dur = prof_dur;
+		profile_seek(profile_no, curr_step + 1);
+		profile_next_step_sp = prof_sp;
+		last_step = (prof_dur == 0);
+#else
 		profile_step_eeaddr = EEADR_PROFILE_SETPOINT(profile_no, curr_step);
 		profile_step_dur = eeprom_read_config(profile_step_eeaddr + 1);
 		profile_next_step_sp = eeprom_read_config(profile_step_eeaddr + 2);
+#endif
 
 		// Reached end of step?
 		if (curr_dur >= profile_step_dur) {
 			// Update setpoint with value from next step
 #if defined MINUTE
-			setpoint = profile_next_step_sp;
+			setpoint = TEMP_FINE(profile_next_step_sp);
 #endif
 			eeprom_write_config(EEADR_MENU_ITEM(SP), profile_next_step_sp);
 			// Is this the last step (next step is number 9 or next step duration is 0)?
+#if defined(PACKED)
+			if (curr_step == 8 || last_step) {
+#else
 			if (curr_step == 8 || eeprom_read_config(profile_step_eeaddr + 3) == 0) {
+#endif
 				// Switch to thermostat mode.
 				eeprom_write_config(EEADR_MENU_ITEM(rn), THERMOSTAT_MODE);
 				return; // Fastest way out...
@@ -521,9 +662,15 @@ static void update_profile(){
 			curr_step++;
 			eeprom_write_config(EEADR_MENU_ITEM(St), curr_step);
 		} else if(eeprom_read_config(EEADR_MENU_ITEM(rP))) { // Is ramping enabled?
+#if !defined(PACKED)
 			int profile_step_sp = eeprom_read_config(profile_step_eeaddr);
+#endif
 			unsigned int t = curr_dur << 6;
+#if defined MINUTE
+			long sp = 0;
+#else
 			long sp = 32;
+#endif
 			unsigned char i;
 
 			// Linear interpolation calculation of new setpoint (64 substeps)
@@ -535,14 +682,14 @@ static void update_profile(){
 			    sp += profile_step_sp;
 			  }
 			}
-			sp >>= 6;
 
 			// Update setpoint
 #if defined MINUTE
-			setpoint = sp;
+			// Keep the fraction, setpoint is in control path units
+			setpoint = sp >> (6 - TEMP_FRAC_BITS);
 		}
 #else
-			eeprom_write_config(EEADR_MENU_ITEM(SP), sp);
+			eeprom_write_config(EEADR_MENU_ITEM(SP), sp >> 6);
 		}
 		// Update duration
 		eeprom_write_config(EEADR_MENU_ITEM(dh), curr_dur);
@@ -550,6 +697,171 @@ static void update_profile(){
 	}
 }
 
+#if defined PID
+/* Unsigned multiplication, by shift and add.
+ * arguments: the factors
+ * return: the product
+ */
+static unsigned long mulu(unsigned int a, unsigned int b){
+	unsigned long p = 0;
+	unsigned char i;
+
+	for(i = 0; i < 16; i++){
+		p <<= 1;
+		if(b & 0x8000){
+			p += a;
+		}
+		b <<= 1;
+	}
+	return p;
+}
+
+/* Unsigned division, by shift and subtract. The quotient must fit in 16 bits.
+ * arguments: dividend, divisor
+ * return: the quotient
+ */
+static unsigned int divu(unsigned long n, unsigned int d){
+	unsigned long dd = ((unsigned long)d) << 15;
+	unsigned int q = 0;
+	unsigned char i;
+
+	for(i = 0; i < 16; i++){
+		q <<= 1;
+		if(n >= dd){
+			n -= dd;
+			q++;
+		}
+		dd >>= 1;
+	}
+	return q;
+}
+
+#define AUTOTUNE_CYCLES		3		// Cycles to settle before the one that is measured
+#define AUTOTUNE_TIMEOUT	15000	// Longest cycle, about 4h
+
+/* PID and autotune state, see temperature_control() and autotune() */
+static unsigned int pid_tick = 0;		// Ticks (about 1s) into the window
+static unsigned int pid_on = 0;			// Ticks of heating in the window
+static int pid_out = 0;					// Output, 0 to proportional band (control path units)
+static int pid_prev = 0;				// Temperature at the start of the window
+static unsigned char pid_seed = 1;		// Take pid_prev from the temperature at the next window
+static long pid_integral = 0;			// Sum of the error each tick
+static unsigned char at_cycles = 0;		// Heating cycles, 0 when autotune is not running
+static unsigned int at_ticks = 0;		// Ticks into the cycle
+static int at_max, at_min;				// Temperature extremes of the cycle
+
+/* Relay feedback autotune, when rn is 'At'. Heats below setpoint - hy and stops
+ * above setpoint + hy. From the period Tu and amplitude a (half peak to peak) of
+ * the cycle after AUTOTUNE_CYCLES, sets PP, PI and Pd by the Pessen 'no overshoot'
+ * rule, Kp = 0.2 Ku, Ti = Tu / 2 and Td = Tu / 3, where Ku = 4 * 0.5 / (pi * a) as the
+ * output swings between 0 and 1. Then, or if a cycle takes longer than
+ * AUTOTUNE_TIMEOUT, switches to thermostat mode.
+ * arguments: setpoint, hysteresis (control path units)
+ * return: nothing
+ */
+static void autotune(int setpoint, int hysteresis){
+	at_ticks++;
+	if(temperature > at_max){
+		at_max = temperature;
+	}
+	if(temperature < at_min){
+		at_min = temperature;
+	}
+
+	if(LATA5){
+		if(temperature > setpoint + hysteresis){
+			LATA5 = 0;
+		}
+	} else if(temperature < setpoint - hysteresis){
+		if(at_cycles > AUTOTUNE_CYCLES){
+			int a = (at_max - at_min) >> 1;
+			unsigned int v;
+
+			// Keeps a << 3 within int
+			if(a > TEMP_FINE(TEMP_HYST_2_MAX)){
+				a = TEMP_FINE(TEMP_HYST_2_MAX);
+			}
+			// Proportional band 1/Kp = pi * a / 0.4 = 7.85 * a, within the range of PP
+			v = TEMP_COARSE((a << 3) - (a >> 3));
+			if(v > TEMP_HYST_2_MAX){
+				v = TEMP_HYST_2_MAX;
+			} else if(v == 0){
+				v = 1;
+			}
+			eeprom_write_config(EEADR_MENU_ITEM(PP), v);
+			// Tu / 2 in minutes, a tick is 0.96s
+			v = divu(at_ticks, 125);
+			eeprom_write_config(EEADR_MENU_ITEM(PI), v ? v : 1);
+			// Tu / 3 in seconds
+			v = divu(((unsigned long)at_ticks) << 3, 25);
+			eeprom_write_config(EEADR_MENU_ITEM(Pd), v > 999 ? 999 : v);
+			at_ticks = AUTOTUNE_TIMEOUT;
+		} else {
+			at_cycles++;
+			at_ticks = 0;
+			at_max = at_min = temperature;
+			LATA5 = 1;
+		}
+	}
+
+	if(at_ticks >= AUTOTUNE_TIMEOUT){
+		LATA5 = 0;
+		pid_integral = 0;
+		eeprom_write_config(EEADR_MENU_ITEM(rn), THERMOSTAT_MODE);
+	}
+}
+#endif
+
+#define ANT_COOL	1		// Measuring the undershoot after cooling
+#define ANT_HEAT	2		// Measuring the overshoot after heating
+#define ANT_NOISE	4		// Rise (fall) that ends the measurement, 0.05 degrees
+#define ANT_SHIFT	2		// Running estimate gain, 1/4 per cycle
+
+/* Overshoot anticipation. After the relay switches off, the temperature keeps
+ * going (compressor still cold, heater and probe lag). This is measured from
+ * the switch off until the temperature turns, and the running estimates are
+ * used to switch off that much before the setpoint is reached.
+ */
+static int ant_cool = 0;			// Estimated undershoot after cooling (control path units)
+static int ant_heat = 0;			// Estimated overshoot after heating
+static int ant_ref;					// Temperature at switch off
+static int ant_peak;				// Largest overshoot since switch off
+static unsigned char ant_dir = 0;	// ANT_COOL or ANT_HEAT while measuring, else 0
+
+/* Start measuring the overshoot, as the relay switches off.
+ * arguments: ANT_COOL or ANT_HEAT
+ * return: nothing
+ */
+static void anticipation_start(unsigned char dir){
+	ant_dir = dir;
+	ant_ref = temperature;
+	ant_peak = 0;
+}
+
+/* Follow the temperature after switch off, and update the estimate when it
+ * has turned (or the relays switch on again).
+ * arguments: none
+ * return: nothing
+ */
+static void anticipation_track(){
+	if(ant_dir){
+		int d = ant_ref - temperature;
+		if(ant_dir == ANT_HEAT){
+			d = -d;
+		}
+		if(d > ant_peak){
+			ant_peak = d;
+		} else if(d < ant_peak - ANT_NOISE || LATA4 || LATA5){
+			if(ant_dir == ANT_COOL){
+				ant_cool += (ant_peak - ant_cool) >> ANT_SHIFT;
+			} else {
+				ant_heat += (ant_peak - ant_heat) >> ANT_SHIFT;
+			}
+			ant_dir = 0;
+		}
+	}
+}
+
 /* Due to a fault in SDCC, static local variables are not initialized
  * properly, so the variables below were moved from temperature_control()
  * and made global.
@@ -558,10 +870,17 @@ unsigned int cooling_delay = 60;  // Initial cooling delay
 unsigned int heating_delay = 60;  // Initial heating delay
 static void temperature_control(){
 #ifndef MINUTE
-	int setpoint = eeprom_read_config(EEADR_MENU_ITEM(SP));
+	int setpoint = TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(SP)));
 #endif
 #if defined PB2
-	int hysteresis2 = eeprom_read_config(EEADR_MENU_ITEM(hy2));
+	int hysteresis2 = TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(hy2)));
+#endif
+	int hysteresis = TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(hy)));
+	// Switch off early by the learned overshoot, but not before the other
+	// side of the hysteresis, where the relay would switch on again
+	int cool_stop = setpoint + (ant_cool < hysteresis ? ant_cool : hysteresis);
+#if !defined PID
+	int heat_stop = setpoint - (ant_heat < hysteresis ? ant_heat : hysteresis);
 #endif
 
 	if(cooling_delay){
@@ -571,16 +890,140 @@ static void temperature_control(){
 		heating_delay--;
 	}
 
+	anticipation_track();
+
 	// Set LED outputs
 	led_e.e_cool = !LATA4;
 	led_e.e_heat = !LATA5;
 
 	// This is the thermostat logic
+#if defined PID
+	if((unsigned char)eeprom_read_config(EEADR_MENU_ITEM(rn)) == AUTOTUNE_MODE){
+		LATA4 = 0;
+		led_e.e_set = at_ticks & 0x1; // Flash to indicate autotune
+		autotune(setpoint, hysteresis);
+		pid_seed = 1;
+		return;
+	}
+	at_cycles = 0;
+	at_ticks = 0;
+
+	// Cooling as without PID, but not while heating
 #if defined PB2
-	if((LATA4 && (temperature <= setpoint || (state_flags.probe2 && (temperature2 < (setpoint - hysteresis2))))) || (LATA5 && (temperature >= setpoint || (state_flags.probe2 && (temperature2 > (setpoint + hysteresis2)))))){
+	if(LATA4 && (temperature <= cool_stop || (state_flags.probe2 && (temperature2 < (setpoint - hysteresis2))))){
 #else
-	if((LATA4 && (temperature <= setpoint )) || (LATA5 && (temperature >= setpoint))){
+	if(LATA4 && temperature <= cool_stop){
 #endif
+		anticipation_start(ANT_COOL);
+		cooling_delay = eeprom_read_config(EEADR_MENU_ITEM(cd)) << 6;
+		cooling_delay = cooling_delay - (cooling_delay >> 4);
+		heating_delay = eeprom_read_config(EEADR_MENU_ITEM(hd)) << 6;
+		heating_delay = heating_delay - (heating_delay >> 4);
+		LATA4 = 0;
+#if defined PB2
+	} else if(LATA4 == 0 && LATA5 == 0 && (temperature > setpoint + hysteresis) && (!state_flags.probe2 || (temperature2 >= setpoint - (hysteresis2 >> 2)))) {
+#else
+	} else if(LATA4 == 0 && LATA5 == 0 && temperature > setpoint + hysteresis) {
+#endif
+		if (cooling_delay) {
+			led_e.e_cool = led_e.e_cool ^ (cooling_delay & 0x1); // Flash to indicate cooling delay
+		} else {
+			LATA4 = 1;
+		}
+	}
+
+	// Heating, time proportioned in windows of Pc ticks. The output is the
+	// error plus integral minus derivative terms, from 0 (off) to the
+	// proportional band (on for the whole window).
+	{
+		int pb = TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(PP)));
+		unsigned int ti = eeprom_read_config(EEADR_MENU_ITEM(PI));
+		int e = setpoint - temperature;
+#if defined PB2
+		unsigned char heat_off = LATA4 || heating_delay || (state_flags.probe2 && (temperature2 > (setpoint + hysteresis2)));
+#else
+		unsigned char heat_off = LATA4 || heating_delay;
+#endif
+
+		if(e > pb){
+			e = pb;
+		} else if(e < -pb){
+			e = -pb;
+		}
+
+		// Integrate the error, but not further up while the output is
+		// saturated or heating is off (anti-windup). The integral term is
+		// kept within 0 to the proportional band.
+		if(ti){
+			ti = (ti << 6) - (ti << 2); // Minutes to ticks
+			if(e < 0 || !(heat_off || pid_out >= pb)){
+				pid_integral += e;
+			}
+			if(pid_integral < 0){
+				pid_integral = 0;
+			} else {
+				unsigned long max = mulu(pb, ti);
+				if(pid_integral > max){
+					pid_integral = max;
+				}
+			}
+		} else {
+			pid_integral = 0;
+		}
+
+		// Start of a window, update the output
+		if(pid_tick == 0){
+			unsigned int window = eeprom_read_config(EEADR_MENU_ITEM(Pc));
+			unsigned long n, max = mulu(pb << 1, window);
+			int d, out = e;
+
+			// No derivative kick at power on or after autotune
+			if(pid_seed){
+				pid_prev = temperature;
+				pid_seed = 0;
+			}
+			d = temperature - pid_prev;
+
+			if(ti){
+				out += divu(pid_integral, ti);
+			}
+
+			// Derivative on the temperature, td * (change over the window) / window
+			pid_prev = temperature;
+			n = mulu(d < 0 ? -d : d, eeprom_read_config(EEADR_MENU_ITEM(Pd)));
+			if(n > max){
+				n = max;
+			}
+			if(d < 0){
+				out += divu(n, window);
+			} else {
+				out -= divu(n, window);
+			}
+
+			if(out < 0){
+				out = 0;
+			} else if(out > pb){
+				out = pb;
+			}
+			pid_out = out;
+			pid_on = out ? divu(mulu(out, window), pb) : 0;
+			pid_tick = window;
+		}
+		pid_tick--;
+
+		LATA5 = 0;
+		if(pid_on){
+			pid_on--;
+			LATA5 = !heat_off;
+		}
+	}
+#else
+#if defined PB2
+	if((LATA4 && (temperature <= cool_stop || (state_flags.probe2 && (temperature2 < (setpoint - hysteresis2))))) || (LATA5 && (temperature >= heat_stop || (state_flags.probe2 && (temperature2 > (setpoint + hysteresis2)))))){
+#else
+	if((LATA4 && (temperature <= cool_stop)) || (LATA5 && (temperature >= heat_stop))){
+#endif
+		anticipation_start(LATA4 ? ANT_COOL : ANT_HEAT);
 		cooling_delay = eeprom_read_config(EEADR_MENU_ITEM(cd)) << 6;
 		cooling_delay = cooling_delay - (cooling_delay >> 4);
 		heating_delay = eeprom_read_config(EEADR_MENU_ITEM(hd)) << 6;
@@ -589,7 +1032,6 @@ static void temperature_control(){
 		LATA5 = 0;
 	}
 	else if(LATA4 == 0 && LATA5 == 0) {
-		int hysteresis = eeprom_read_config(EEADR_MENU_ITEM(hy));
 #ifdef PB2
 		hysteresis2 >>= 2; // Halve hysteresis 2
 		if ((temperature > setpoint + hysteresis) && (!state_flags.probe2 || (temperature2 >= setpoint - hysteresis2))) {
@@ -613,10 +1055,295 @@ static void temperature_control(){
 			}
 		}
 	}
+#endif // PID
 }
 
 #endif // !OVBSC
 
+#if !(defined(OVBSC) || defined(RH))
+#if defined(EEPROM_MIGRATIONS) || defined(PACKED)
+/* Move a block of config data in EEPROM (for layout migration, and the profile records).
+ * arguments: from, to (config addresses), count, fill value for vacated addresses when moving up
+ * return: nothing
+ */
+static void eeprom_move_config(unsigned char from, unsigned char to, unsigned char count, int fill){
+	if(to > from){
+		while(count--){
+			eeprom_write_config(to + count, eeprom_read_config(from + count));
+			ClrWdt();
+		}
+		while(to > from){
+			eeprom_write_config(--to, fill);
+		}
+	} else {
+		for(; count; count--){
+			eeprom_write_config(to++, eeprom_read_config(from++));
+			ClrWdt();
+		}
+	}
+}
+
+#endif
+
+#if defined(EEPROM_MIGRATIONS)
+#define EEPROM_MIGRATION_STEP(version, from, to, count, fill) \
+	if(layout < (version)){ \
+		eeprom_move_config((from), (to), (count), (fill)); \
+	}
+#endif
+
+#if defined(PACKED)
+/* Config words of a step record (see PROFILE_SHORT).
+ * arguments: setpoint of the step before, setpoint and duration of the step
+ * return: 1 or 2
+ */
+static unsigned char profile_rec_len(int base, int sp, unsigned int dur){
+	sp -= base;
+	return (sp >= -64 && sp < 64 && dur < 256) ? 1 : 2;
+}
+
+/* Write a step record.
+ * arguments: config address, setpoint of the step before, setpoint and duration of the step
+ * return: nothing
+ */
+static void profile_put(unsigned char adr, int base, int sp, unsigned int dur){
+	if(profile_rec_len(base, sp, dur) == 1){
+		eeprom_write_config(adr, PROFILE_SHORT(sp - base, dur));
+	} else {
+		eeprom_write_config(adr, sp & 0x7fff);
+		eeprom_write_config(adr + 1, dur);
+	}
+}
+
+/* Set the setpoint or duration of a step (which must exist), moving the
+ * records after it when its length changes. A duration set to 0 makes the
+ * step the last of the profile, and a duration set on the last step adds a
+ * step after it, with the same setpoint. Moving takes two EEPROM byte writes
+ * (about 4ms each) per word, so up to about 1s when the records of all
+ * profiles move. The main loop stalls meanwhile (timer 4 ticks are lost, so
+ * the profile falls behind by as much), only changes from the menu move them.
+ * arguments: profile, config item (SP0, dh0, ..., dh8, SP9), value
+ * return: 0 if there is no room for it (nothing is changed), else 1
+ */
+unsigned char profile_write(unsigned char profile, unsigned char item, int value){
+	unsigned char end, adr, cut, len, next_len = 0;
+	int base, sp, next_sp;
+	unsigned int dur, next_dur = 0;
+	signed char grow;
+
+	// The records of all profiles end after the last step of the last profile
+	profile_seek(NO_OF_PROFILES - 1, 9);
+	end = prof_next;
+
+	profile_seek(profile, item >> 1);
+	adr = prof_adr;
+	base = prof_base;
+	sp = prof_sp;
+	dur = prof_dur;
+	cut = prof_next;
+	if(item & 0x1){
+		if(dur == 0 && value != 0){
+			// Add a last step
+			next_len = 1;
+			next_sp = sp;
+		}
+		dur = value;
+		if(dur == 0){
+			// Remove the steps after it
+			profile_seek(profile, 9);
+			cut = prof_next;
+		}
+	} else {
+		sp = value;
+	}
+	if(dur != 0 && !next_len){
+		// The next step follows the new setpoint
+		profile_seek(profile, (item >> 1) + 1);
+		cut = prof_next;
+		next_sp = prof_sp;
+		next_dur = prof_dur;
+		next_len = profile_rec_len(sp, next_sp, next_dur);
+	}
+
+	// Records from adr up to cut are replaced by len + next_len words
+	len = profile_rec_len(base, sp, dur);
+	grow = len + next_len - (cut - adr);
+	if(grow){
+		if(end + grow > EEADR_MENU){
+			return 0;
+		}
+		eeprom_move_config(cut, cut + grow, end - cut, 0);
+	}
+	profile_put(adr, base, sp, dur);
+	if(next_len){
+		profile_put(adr + len, sp, next_sp, next_dur);
+	}
+	return 1;
+}
+#endif
+
+#if EEPROM_LAYOUT_VARIANT
+/* Menu defaults, as in eepromdata.c */
+#define TO_DEFAULT(name, led10ch, led1ch, led01ch, type, default_value) \
+	default_value,
+
+static const int menu_defaults[] = {
+	MENU_DATA(TO_DEFAULT)
+};
+
+/* Reset the config data that this variant family keeps at other addresses
+ * than the EEPROM data found: the menu items to their defaults (thermostat
+ * mode), and with PACKED the profiles to one step of 0 degrees each, or with
+ * LOG the statistics and log to erased. The fixed size profiles are kept as
+ * they are, they are at the same addresses in all fixed layouts (the step
+ * records of PACKED are not converted).
+ * arguments: none
+ * return: nothing
+ */
+static void eeprom_reset_variant(){
+	unsigned char i;
+
+#if defined(PACKED)
+	for(i = 0; i < NO_OF_PROFILES; i++){
+		eeprom_write_config(i, PROFILE_SHORT(0, 0));
+		ClrWdt();
+	}
+#endif
+	for(i = 0; i < sizeof(menu_defaults)/sizeof(menu_defaults[0]); i++){
+		eeprom_write_config(EEADR_MENU_ITEM(i), menu_defaults[i]);
+		ClrWdt();
+	}
+#if defined(LOG)
+	for(i = EEADR_STATS; i < EEADR_CLOCK_TICKS; i++){
+		eeprom_write_config(i, 0xffff);
+		ClrWdt();
+	}
+#endif
+#if defined(COM)
+	eeprom_write_config(EEADR_CLOCK_TICKS, CLOCK_TICKS_PER_HOUR);
+#endif
+}
+#endif
+
+/* Bring EEPROM data up to the current layout, if it was written by an older firmware.
+ * EEPROM without a layout version was written by 1.09 (layout 12), and is
+ * moved from there. Blank EEPROM (all 0xffff, never initialized) is only
+ * stamped, there is nothing to move. EEPROM of another variant family is
+ * reset by the PACKED, PID and LOG builds (see eeprom_reset_variant()), the
+ * other builds only strip the family.
+ * arguments: none
+ * return: nothing
+ */
+static void eeprom_migrate(){
+	unsigned int pwr_on = eeprom_read_config(EEADR_POWER_ON);
+	unsigned char layout = (pwr_on >> 8);
+
+	if(layout != EEPROM_LAYOUT){
+		if(layout == 0 || layout == 0xff){
+			unsigned char adr = 0;
+			layout = EEPROM_LAYOUT_UNSTAMPED;
+			while(eeprom_read_config(adr) == 0xffff){
+				if(++adr > EEADR_POWER_ON){
+					// Blank
+					layout = 0xff;
+					break;
+				}
+			}
+		}
+		if(layout != 0xff){
+#if EEPROM_LAYOUT_VARIANT
+			// Another family, or 1.09 (which had none of these)
+			if((layout & EEPROM_LAYOUT_VARIANT_MASK) != EEPROM_LAYOUT_VARIANT){
+				eeprom_reset_variant();
+				// Nothing left to move
+				layout = EEPROM_LAYOUT;
+			}
+#endif
+			layout &= ~EEPROM_LAYOUT_VARIANT_MASK;
+		}
+#if defined(EEPROM_MIGRATIONS)
+		EEPROM_MIGRATIONS(EEPROM_MIGRATION_STEP)
+#endif
+#if defined(COM)
+		// Layout 13 added the clock calibration (taken from the end of the log with LOG)
+		if(layout < 13){
+			eeprom_write_config(EEADR_CLOCK_TICKS, CLOCK_TICKS_PER_HOUR);
+		}
+#endif
+		eeprom_write_config(EEADR_POWER_ON, EEPROM_POWER_ON_VALUE(pwr_on & 0x1));
+	}
+}
+#endif
+
+#if defined(COM_CLOCK)
+/* Correct the time base for a clock calibration. The 1s section moves
+ * millisx60 16 ticks ahead (or back) whenever clock_acc reaches clock_step,
+ * so that the profile hours (and minutes) follow real time. Whole 1s sections
+ * keep the A/D sampling and the 1s section itself in step.
+ * arguments: 60ms ticks counted in an hour of real time
+ * return: 1 if used, 0 if out of range (not a calibration)
+ */
+static unsigned char clock_calibrate(unsigned int ticks){
+	if(ticks < CLOCK_TICKS_MIN || ticks > CLOCK_TICKS_MAX){
+		return 0;
+	}
+	// There are ticks / 16 sections per hour, adding 16 ticks per ticks / 2 of
+	// (CLOCK_TICKS_PER_HOUR - ticks) / 2 gives the difference (in int range)
+	clock_trim = (CLOCK_TICKS_PER_HOUR >> 1) - (ticks >> 1);
+	clock_step = (ticks >> 1);
+	return 1;
+}
+#endif
+
+#if defined(TIMING)
+/* Read timer 1, again if the low byte wrapped in between.
+ * arguments: none
+ * return: timer 1 count
+ */
+static unsigned int timing_now(){
+	unsigned char h = TMR1H;
+	unsigned char l = TMR1L;
+	if(TMR1H != h){
+		h = TMR1H;
+		l = TMR1L;
+	}
+	return (((unsigned int)h) << 8) | l;
+}
+
+/* Update last, min and max of a section.
+ * arguments: section, timer 1 count at its start
+ * return: nothing
+ */
+static void timing_end(unsigned char s, unsigned int start){
+	unsigned int *t = timing.section[s];
+	start = timing_now() - start;
+	t[TIMING_LAST] = start;
+	if(start < t[TIMING_MIN]){
+		t[TIMING_MIN] = start;
+	}
+	if(start > t[TIMING_MAX]){
+		t[TIMING_MAX] = start;
+	}
+}
+
+/* Start over, min at its largest value.
+ * arguments: none
+ * return: nothing
+ */
+static void timing_reset(){
+	unsigned char i;
+	for(i=0; i<NO_OF_TIMING_SECTIONS; i++){
+		timing.section[i][TIMING_LAST] = 0;
+		timing.section[i][TIMING_MIN] = 0xffff;
+		timing.section[i][TIMING_MAX] = 0;
+	}
+	timing.isr[TIMING_LAST] = 0;
+	timing.isr[TIMING_MIN] = 0xff;
+	timing.isr[TIMING_MAX] = 0;
+	timing.tmr4_gap = 0;
+}
+#endif
+
 /* Initialize hardware etc, on startup.
  * arguments: none
  * returns: nothing
@@ -672,10 +1399,20 @@ static void init() {
 #if (defined(OVBSC) || defined(RH))
 	TMR4ON = 1;
 #else
-	TMR4ON = eeprom_read_config(EEADR_POWER_ON);
+	eeprom_migrate();
+	TMR4ON = (unsigned char) eeprom_read_config(EEADR_POWER_ON);
+#endif
+#if defined(COM_CLOCK)
+	clock_calibrate(eeprom_read_config(EEADR_CLOCK_TICKS));
+#endif
+	// @4MHz, Timer 4 clock is FOSC/4 -> 1MHz prescale 1:16-> 62.5kHz, 250 (counts 0-PR4) and postscale 1:15 -> 16.66666 Hz or 60ms
+	PR4 = 249;
+
+#if defined(TIMING)
+	// Timer 1 clock is FOSC/4 -> 1MHz, prescale 1:1, enable counter (free running, for timing)
+	T1CON = 0b00000001;
+	timing_reset();
 #endif
-	// @4MHz, Timer 2 clock is FOSC/4 -> 1MHz prescale 1:16-> 62.5kHz, 250 and postscale 1:15 -> 16.66666 Hz or 60ms
-	PR4 = 250;
 
 	// Postscaler 1:7, Enable counter, prescaler 1:64
 	T6CON = 0b00110111;
@@ -684,7 +1421,7 @@ static void init() {
 
 #if defined(MINUTE)
 	// Get initial setpoint
-	setpoint = eeprom_read_config(EEADR_MENU_ITEM(SP));
+	setpoint = TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(SP)));
 #endif
 
 #if defined(RH)
@@ -718,9 +1455,12 @@ static void init() {
  * Handles multiplexing of the LEDs.
  */
 #if defined(OVBSC)
-volatile unsigned char oc = 0;
+static unsigned char oc = 1;
 #endif
 static void interrupt_service_routine(void) __interrupt 0 {
+#if defined(TIMING)
+	unsigned char isr_start = TMR1L;
+#endif
 
 #if defined(COM)
 	if(IOCAF1){
@@ -812,9 +1552,24 @@ static void interrupt_service_routine(void) __interrupt 0 {
 			latb = 0x10;
 		}
 
-		TRISC = 0; // Ensure LED data pins are outputs
 		LATB = 0; // Disable LED's while switching
 
+		// Sample the buttons (on the LED data pins) every millisecond while the LED's are off,
+		// so that a short press between two runs of button_menu_fsm() is not missed. A pin
+		// only changes state after 4 samples in a row that differ from it, so a glitch or
+		// contact bounce is not taken as a press.
+		{
+			unsigned char changed;
+			TRISC = 0b11011000;
+			changed = (PORTC & 0b11011000) ^ button_state;
+			TRISC = 0; // Ensure LED data pins are outputs
+			button_ct0 = ~(button_ct0 & changed);
+			button_ct1 = button_ct0 ^ (button_ct1 & changed);
+			changed &= button_ct0 & button_ct1;
+			button_state ^= changed;
+			button_pins |= button_state;
+		}
+
 		// Multiplex LED's every millisecond
 		switch(latb) {
 			case 0x10:
@@ -835,8 +1590,44 @@ static void interrupt_service_routine(void) __interrupt 0 {
 		LATB = latb;
 
 #if defined(OVBSC)
-		if(oc){
-			oc--;
+		// Next output slot
+		if(--oc == 0){
+			if(output_counter == 0){
+				output_counter = 100;
+				if(output_next){
+					slot_ms = next_ms;
+					duty_heat = next_heat;
+					duty_cool = next_cool;
+					output_next = 0;
+				}
+			}
+			output_counter--;
+			oc = slot_ms;
+
+			if(PAUSE || OFF){
+				LATA5 = 0;
+				LATA4 = 0;
+			} else {
+#if defined(OUTPUT_BURST)
+				acc_heat += duty_heat;
+				if(acc_heat >= 100){
+					acc_heat -= 100;
+					LATA5 = 1;
+				} else {
+					LATA5 = 0;
+				}
+				acc_cool += duty_cool;
+				if(acc_cool >= 100){
+					acc_cool -= 100;
+					LATA4 = 1;
+				} else {
+					LATA4 = 0;
+				}
+#else
+				LATA5 = (duty_heat > output_counter);
+				LATA4 = (duty_cool > output_counter);
+#endif
+			}
 		}
 #endif
 
@@ -851,9 +1642,24 @@ static void interrupt_service_routine(void) __interrupt 0 {
 		}
 #endif // COM
 
+#if defined(TIMING)
+		timing_ms++;
+#endif
+
 		// Clear interrupt flag
 		TMR2IF = 0;
 	}
+
+#if defined(TIMING)
+	isr_start = TMR1L - isr_start;
+	timing.isr[TIMING_LAST] = isr_start;
+	if(isr_start < timing.isr[TIMING_MIN]){
+		timing.isr[TIMING_MIN] = isr_start;
+	}
+	if(isr_start > timing.isr[TIMING_MAX]){
+		timing.isr[TIMING_MAX] = isr_start;
+	}
+#endif
 }
 
 #define START_TCONV_1()		(ADCON0 = _CHS1 | _ADON)
@@ -866,17 +1672,61 @@ static unsigned int read_ad(unsigned int adfilter){
 	return ((adfilter - (adfilter >> FILTER_SHIFT)) + ((ADRESH << 8) | ADRESL));
 }
 
+/* Fill an A/D filter at power on, with the sum of 2^FILTER_SHIFT conversions
+ * (what read_ad() would settle at), on the channel already selected.
+ * read_ad() gets a 60ms tick of acquisition after the channel is selected,
+ * here the first conversion follows right after it, with the hold capacitor
+ * still at the last channel, so it is not used.
+ * arguments: none
+ * return: the filter value
+ */
+static unsigned int read_ad_seed(){
+	unsigned int sum = 0;
+	unsigned char i;
+	ADGO = 1;
+	while(ADGO);
+	for(i=0; i<(1 << FILTER_SHIFT); i++){
+		ADGO = 1;
+		while(ADGO);
+		sum += (ADRESH << 8) | ADRESL;
+	}
+	ADON = 0;
+	return sum;
+}
+
 static int ad_to_temp(unsigned int adfilter){
 	unsigned char i;
-	long temp = 32;
+	long temp = 0;
+#if defined(OVBSC)
+	unsigned char a, b = 0, seg;
+	unsigned char n = sizeof(ad_segments);
+	unsigned char ad16 = adfilter >> (FILTER_SHIFT+4); // A/D value / 16
+#else
 	unsigned char a = ((adfilter >> (FILTER_SHIFT-1)) & 0x3f); // Lower 6 bits
 	unsigned char b = ((adfilter >> (FILTER_SHIFT+5)) & 0x1f); // Upper 5 bits
+#endif
 	unsigned char adfilter_l = adfilter >> 8;
 
 	if ((adfilter_l >= 248) || (adfilter_l <=8 )) {
 		state_flags.ad_badrange = 1;
 	}
 
+#if defined(OVBSC)
+	// Binary search for the segment
+	while(n - b > 1){
+		seg = (b + n) >> 1;
+		if((ad_segments[seg] >> 2) <= ad16){
+			b = seg;
+		} else {
+			n = seg;
+		}
+	}
+
+	// 6 bits of the position within the segment
+	seg = ad_segments[b];
+	a = ((adfilter - ((unsigned int)(seg >> 2) << (FILTER_SHIFT+4))) >> ((seg & 0x3) + 4 + FILTER_SHIFT-6)) & 0x3f;
+#endif
+
 	// Interpolate between lookup table points
 	for (i = 0; i < 64; i++) {
 		if(a <= i) {
@@ -886,8 +1736,9 @@ static int ad_to_temp(unsigned int adfilter){
 		}
 	}
 
-	// Divide by 64 to get back to normal temperature
-	return (temp >> 6);
+	// Divide by 64 to get back to normal temperature, keeping TEMP_FRAC_BITS of the fraction
+	// (TEMP_COARSE() of the result is the same as rounding to 0.1 degrees directly)
+	return (temp >> (6 - TEMP_FRAC_BITS));
 }
 
 #if defined(RH)
@@ -909,9 +1760,10 @@ static void control_rh(){
 
 	unsigned humlimit = 100;
 	
-	if(temperature > 0 && temperature < 500){
+	int t = TEMP_COARSE(temperature);
+
+	if(t > 0 && t < 500){
 		unsigned char i=0, j;
-		int t = temperature;
 		int rh=0;
 		while(t >= 50) {
 			t -= 50;
@@ -982,7 +1834,325 @@ static void control_rh(){
 
 #endif // RH
 
+#if defined(LOG)
+/* Temperature history log, a ring of LOG_SIZE bytes in EEPROM (see stc1000p.h).
+ * Every Li minutes, a sample is added, and the next byte after the newest is
+ * always free (0xff), to find the end again at power on. The records are:
+ *   0x00-0x7f  sample, bits 6-2 temperature change since the last sample
+ *              (-16 to 15, 0.1 degrees), bit 1 heating and bit 0 cooling was
+ *              on at some time during the interval
+ *   0x80       keyframe, followed by temperature and setpoint (0.1 degrees),
+ *              14 bits each as 4 bytes of 7 bits (high first)
+ *   0x81       as 0x80, but written at power on (time is lost before it)
+ *   0x82-0xfe  setpoint change (byte - 0xc0, -62 to 62), before the sample
+ *   0xff       free
+ * Larger changes are spread over the following samples, the temperature and
+ * setpoint of the log (log_t, log_sp) follow the real ones as fast as the
+ * records allow. The bytes are written one at a time from the main loop,
+ * without waiting for the EEPROM write to complete, see log_write().
+ */
+#define LOG_KEYFRAME		0x80
+#define LOG_POWER_ON		0x81
+#define LOG_SP_CHANGE		0xc0
+#define LOG_FREE			0xff
+#define LOG_KEYFRAME_EVERY	64		// Samples between keyframes
+
+static unsigned char log_buf[8];		// Records to write
+static unsigned char log_n = 0;			// Bytes in log_buf
+static unsigned char log_i = 0;			// Bytes of log_buf written
+static unsigned char log_head;			// Ring offset of the first free byte
+static unsigned char log_free = 0;		// Bytes after log_head known to be free
+static unsigned char log_clear = 0;		// Bytes after those that must be freed first
+static unsigned char log_count = 0;		// Samples until the next keyframe
+static unsigned char log_type = LOG_POWER_ON;	// Of the next keyframe
+static unsigned char log_relays = 0;	// Relays on during the interval
+static unsigned int log_ms60 = 0;		// Time into the minute, 60ms units
+static unsigned int log_minutes = 0;	// Minutes into the interval
+static int log_t, log_sp;				// As recorded so far
+
+/* Read one byte from EEPROM.
+ * arguments: EEPROM byte address (0-255)
+ * return: the read data
+ */
+static unsigned char eeprom_read_byte(unsigned char eeprom_address){
+	while(WR);
+	EEADRL = eeprom_address;
+	CFGS = 0;
+	EEPGD = 0;
+	RD = 1;
+	return EEDATL;
+}
+
+/* Ring offset after another.
+ * arguments: ring offset
+ * return: the next ring offset
+ */
+static unsigned char log_next(unsigned char i){
+	i++;
+	return i == LOG_SIZE ? 0 : i;
+}
+
+/* Find the end of the log at power on, the first free byte after one that is not.
+ * arguments: none
+ * return: nothing
+ */
+static void log_init(){
+	unsigned char i = 0, prev = eeprom_read_byte(LOG_START + LOG_SIZE - 1);
+
+	log_head = 0;
+	do {
+		unsigned char b = eeprom_read_byte(LOG_START + i);
+		if(b == LOG_FREE && prev != LOG_FREE){
+			log_head = i;
+			break;
+		}
+		prev = b;
+		i = log_next(i);
+	} while(i);
+}
+
+/* Write the next byte of the queued records, when the EEPROM is not busy. Before
+ * the records are written from log_head, the bytes they take and the one after
+ * are freed (and the rest of a keyframe that is overwritten), so the end is
+ * found again if power is lost in between.
+ * arguments: none
+ * return: nothing
+ */
+static void log_write(){
+	if(log_i == log_n || WR || com_state){
+		return;
+	}
+	if(log_clear){
+		unsigned char j = log_head, k = log_free;
+		unsigned char b;
+
+		while(k--){
+			j = log_next(j);
+		}
+		j = log_next(j);
+		b = eeprom_read_byte(LOG_START + j);
+		if(b == LOG_KEYFRAME || b == LOG_POWER_ON){
+			log_clear += 4;
+		}
+		if(b != LOG_FREE){
+			eeprom_write_byte(LOG_START + j, LOG_FREE);
+		}
+		log_free++;
+		log_clear--;
+	} else {
+		eeprom_write_byte(LOG_START + log_head, log_buf[log_i]);
+		log_i++;
+		log_head = log_next(log_head);
+		log_free--;
+	}
+}
+
+/* Queue a byte for the log.
+ * arguments: record byte
+ * return: nothing
+ */
+static void log_queue(unsigned char b){
+	log_buf[log_n++] = b;
+}
+
+/* Called every second (960ms), to collect the relay state and queue a sample
+ * every Li minutes.
+ * arguments: none
+ * return: nothing
+ */
+static void log_sample(){
+	unsigned int interval = eeprom_read_config(EEADR_MENU_ITEM(Li));
+	int d;
+
+	log_relays |= (LATA5 << 1) | LATA4;
+
+	if(interval == 0){
+		// Off, start over with a power on keyframe when turned on again
+		log_count = log_minutes = 0;
+		log_type = LOG_POWER_ON;
+		return;
+	}
+
+	log_ms60 += 16;
+	if(log_ms60 >= 1000){
+		log_ms60 -= 1000;
+		log_minutes++;
+	}
+	if(log_minutes < interval || log_i != log_n){
+		return;
+	}
+	log_minutes = 0;
+	log_n = log_i = 0;
+
+	if(log_count == 0){
+		log_count = LOG_KEYFRAME_EVERY;
+		if(log_type == LOG_POWER_ON){
+			log_t = TEMP_COARSE(temperature);
+#if defined(MINUTE)
+			log_sp = TEMP_COARSE(setpoint);
+#else
+			log_sp = eeprom_read_config(EEADR_MENU_ITEM(SP));
+#endif
+		}
+		// Other keyframes repeat what is recorded so far, so the samples
+		// before can be decoded backwards from it
+		log_queue(log_type);
+		log_queue((log_t >> 7) & 0x7f);
+		log_queue(log_t & 0x7f);
+		log_queue((log_sp >> 7) & 0x7f);
+		log_queue(log_sp & 0x7f);
+		log_type = LOG_KEYFRAME;
+	}
+	log_count--;
+
+#if defined(MINUTE)
+	d = TEMP_COARSE(setpoint) - log_sp;
+#else
+	d = eeprom_read_config(EEADR_MENU_ITEM(SP)) - log_sp;
+#endif
+	if(d){
+		if(d > 62){
+			d = 62;
+		} else if(d < -62){
+			d = -62;
+		}
+		log_sp += d;
+		log_queue(LOG_SP_CHANGE + d);
+	}
+
+	d = TEMP_COARSE(temperature) - log_t;
+	if(d > 15){
+		d = 15;
+	} else if(d < -16){
+		d = -16;
+	}
+	log_t += d;
+	log_queue(((d << 2) & 0x7c) | log_relays);
+	log_relays = 0;
+
+	// The records need log_n free bytes after log_head
+	log_clear = log_free < log_n ? log_n - log_free : 0;
+}
+
+#endif // LOG
+
 #if defined(COM)
+#if defined(LOG)
+/* Operating statistics since reset, read with COM_READ_STATS. They are
+ * kept over power off, saved to EEPROM (EEADR_STATS) every 16384 seconds
+ * (4.4 hours) and after a reset. Times are in seconds of the 1 second
+ * section (960ms).
+ */
+static struct {
+	unsigned long time;			// Since reset
+	unsigned long cool_time;	// Cooling relay on
+	unsigned long heat_time;	// Heating relay on
+	unsigned long alarm_time;	// Alarm on
+	unsigned int cool_cycles;	// Times the cooling relay switched on
+	unsigned int heat_cycles;	// Times the heating relay switched on
+	int t_min, t_max;			// Temperature range (0.1 degrees)
+} stats;
+static unsigned char stats_relays = 0;	// Relays on at the last update
+static unsigned char stats_save = 0;	// Save at the next update
+
+/* Start over (the EEPROM copy at the next update).
+ * arguments: none
+ * return: nothing
+ */
+static void stats_reset(){
+	stats.time = stats.cool_time = stats.heat_time = stats.alarm_time = 0;
+	stats.cool_cycles = stats.heat_cycles = 0;
+	stats.t_min = 0x7fff;
+	stats.t_max = -0x7fff;
+	stats_save = 1;
+}
+
+/* Read a 32 bit counter from two config addresses, low word first.
+ * arguments: config address
+ * return: the counter
+ */
+static unsigned long stats_read_long(unsigned char eeprom_address){
+	return eeprom_read_config(eeprom_address) | (((unsigned long) eeprom_read_config(eeprom_address + 1)) << 16);
+}
+
+/* Write a 32 bit counter to two config addresses, low word first.
+ * arguments: config address, counter
+ * return: nothing
+ */
+static void stats_write_long(unsigned char eeprom_address, unsigned long data){
+	eeprom_write_config(eeprom_address, (unsigned int) data);
+	eeprom_write_config(eeprom_address + 1, (unsigned int) (data >> 16));
+}
+
+/* Load the statistics saved last, reset if erased.
+ * arguments: none
+ * return: nothing
+ */
+static void stats_init(){
+	if(eeprom_read_config(EEADR_STATS) == 0xffff && eeprom_read_config(EEADR_STATS + 1) == 0xffff){
+		stats_reset();
+		return;
+	}
+	stats.time = stats_read_long(EEADR_STATS);
+	stats.cool_time = stats_read_long(EEADR_STATS + 2);
+	stats.heat_time = stats_read_long(EEADR_STATS + 4);
+	stats.alarm_time = stats_read_long(EEADR_STATS + 6);
+	stats.cool_cycles = eeprom_read_config(EEADR_STATS + 8);
+	stats.heat_cycles = eeprom_read_config(EEADR_STATS + 9);
+	stats.t_min = eeprom_read_config(EEADR_STATS + 10);
+	stats.t_max = eeprom_read_config(EEADR_STATS + 11);
+}
+
+/* Called every second (960ms), before the alarm and relays are updated, so
+ * they are counted for the second that has passed.
+ * arguments: none
+ * return: nothing
+ */
+static void stats_update(){
+	stats.time++;
+	if(LATA4){
+		stats.cool_time++;
+		if(!(stats_relays & 0x1)){
+			stats.cool_cycles++;
+		}
+	}
+	if(LATA5){
+		stats.heat_time++;
+		if(!(stats_relays & 0x2)){
+			stats.heat_cycles++;
+		}
+	}
+	stats_relays = (LATA5 << 1) | LATA4;
+	if(LATA0){
+		stats.alarm_time++;
+	}
+
+	// Not on sensor error
+	if(!state_flags.ad_badrange){
+		int t = TEMP_COARSE(temperature);
+		if(t < stats.t_min){
+			stats.t_min = t;
+		}
+		if(t > stats.t_max){
+			stats.t_max = t;
+		}
+	}
+
+	// Same layout as stats (on the device)
+	if(stats_save || (((unsigned int) stats.time) & 0x3fff) == 0){
+		stats_write_long(EEADR_STATS, stats.time);
+		stats_write_long(EEADR_STATS + 2, stats.cool_time);
+		stats_write_long(EEADR_STATS + 4, stats.heat_time);
+		stats_write_long(EEADR_STATS + 6, stats.alarm_time);
+		eeprom_write_config(EEADR_STATS + 8, stats.cool_cycles);
+		eeprom_write_config(EEADR_STATS + 9, stats.heat_cycles);
+		eeprom_write_config(EEADR_STATS + 10, stats.t_min);
+		eeprom_write_config(EEADR_STATS + 11, stats.t_max);
+		stats_save = 0;
+	}
+}
+#endif // LOG
+
 enum com_states {
 	com_idle = 0,
 	com_recv_addr,
@@ -992,7 +2162,10 @@ enum com_states {
 	com_trans_data1,
 	com_trans_data2,
 	com_trans_checksum,
-	com_trans_ack
+	com_trans_ack,
+	com_trans_log,
+	com_trans_stats,
+	com_trans_timing
 };
 
 /* State machine to handle rx/tx protocol */
@@ -1013,7 +2186,7 @@ static void handle_com(unsigned const char rxdata){
 		if(command == COM_READ_EEPROM || command == COM_WRITE_EEPROM){
 			com_state = com_recv_addr;
 		} else if(rxdata == COM_READ_TEMP){
-			data = temperature;
+			data = TEMP_COARSE(temperature);
 			com_state = com_trans_data1;
 		} else if(rxdata == COM_READ_COOLING){
 			data = LATA4;
@@ -1021,6 +2194,27 @@ static void handle_com(unsigned const char rxdata){
 		} else if(rxdata == COM_READ_HEATING){
 			data = LATA5;
 			com_state = com_trans_data1;
+#if defined(COM_CLOCK)
+		} else if(rxdata == COM_CLOCK_MARK){
+			// Ticks since the previous mark, a calibration if that was an hour ago
+			// (the master waits for the EEPROM write before reading)
+			data = clock_count;
+			if(clock_calibrate(clock_count)){
+				eeprom_write_config(EEADR_CLOCK_TICKS, clock_count);
+			}
+			clock_count = 0;
+			com_state = com_trans_data1;
+#endif
+#if defined(LOG)
+		} else if(rxdata == COM_READ_LOG){
+			com_state = com_trans_log;
+		} else if(rxdata == COM_READ_STATS || rxdata == COM_RESET_STATS){
+			com_state = com_trans_stats;
+#endif
+#if defined(TIMING)
+		} else if(rxdata == COM_READ_TIMING){
+			com_state = com_trans_timing;
+#endif
 		}
 	} else if(com_state == com_recv_addr){
 		addr = rxdata;
@@ -1062,6 +2256,66 @@ static void handle_com(unsigned const char rxdata){
 		com_state++;
 	}
 
+#if defined(LOG)
+	/* Bulk read of the log: log_head, the LOG_SIZE bytes of the ring and the
+	 * xor of all bytes sent (including the command), followed by ACK.
+	 */
+	if(com_state == com_trans_log){
+		unsigned char b = xorsum;
+		if(addr == 0){
+			b = log_head;
+		} else if(addr <= LOG_SIZE){
+			b = eeprom_read_byte(LOG_START - 1 + addr);
+		} else {
+			com_state = com_trans_ack;
+		}
+		xorsum ^= b;
+		addr++;
+		com_data = b;
+		com_write = 1;
+	}
+
+	/* Bulk read of the statistics: the bytes of stats (little endian) and the
+	 * xor of all bytes sent (including the command), followed by ACK. With
+	 * COM_RESET_STATS, they start over after they have been sent.
+	 */
+	if(com_state == com_trans_stats){
+		unsigned char b = xorsum;
+		if(addr < sizeof(stats)){
+			b = ((unsigned char *)&stats)[addr];
+		} else {
+			if(command == COM_RESET_STATS){
+				stats_reset();
+			}
+			com_state = com_trans_ack;
+		}
+		xorsum ^= b;
+		addr++;
+		com_data = b;
+		com_write = 1;
+	}
+#endif
+
+#if defined(TIMING)
+	/* Bulk read of the timing data: the bytes of timing (ints little endian)
+	 * and the xor of all bytes sent (including the command), followed by ACK.
+	 * Then start over, so the next read covers the time since this one.
+	 */
+	if(com_state == com_trans_timing){
+		unsigned char b = xorsum;
+		if(addr < sizeof(timing)){
+			b = ((unsigned char *)&timing)[addr];
+		} else {
+			timing_reset();
+			com_state = com_trans_ack;
+		}
+		xorsum ^= b;
+		addr++;
+		com_data = b;
+		com_write = 1;
+	}
+#endif
+
 }
 
 #elif defined(FO433)
@@ -1075,7 +2329,10 @@ enum fo433_states {
 	fo433_crc
 };
 
-/* Fine offset state machine */
+/* Fine offset state machine.
+ * The extended frame has 0x46 instead of 0x45, the setpoint in place of the
+ * temperature and run mode << 4 | step in place of the humidity.
+ */
 static void fo433_fsm(){
 	static int t;
 	static unsigned char crc;
@@ -1083,16 +2340,28 @@ static void fo433_fsm(){
 	if(fo433_state == fo433_preamble){
 		fo433_data = 0xff;
 	} else if(fo433_state == fo433_devid_high){
-		fo433_data = 0x45;
+		fo433_data = 0x45 + fo433_ext;
 		crc = 0;
 	} else if(fo433_state == fo433_devid_low_temp_high){
 		unsigned char di = ((unsigned char)eeprom_read_config(EEADR_MENU_ITEM(dI))) << 4;
-		t = temperature;
+		if(fo433_ext){
+#if defined(MINUTE)
+			t = TEMP_COARSE(setpoint);
+#else
+			t = eeprom_read_config(EEADR_MENU_ITEM(SP));
+#endif
+		} else {
+			t = TEMP_COARSE(temperature);
+		}
 		fo433_data = (di | ((t >> 8) & 0xf));
 	} else if(fo433_state == fo433_temp_low){
 		fo433_data = (unsigned char) t;
 	} else if(fo433_state == fo433_humidity){
-		fo433_data = (LATA5 << 6) | (LATA4 << 4);
+		if(fo433_ext){
+			fo433_data = (((unsigned char)eeprom_read_config(EEADR_MENU_ITEM(rn))) << 4) | ((unsigned char)eeprom_read_config(EEADR_MENU_ITEM(St)));
+		} else {
+			fo433_data = (LATA5 << 6) | (LATA4 << 4);
+		}
 	} else if(fo433_state == fo433_crc){
 		fo433_data = crc;
 	}
@@ -1117,20 +2386,85 @@ static void fo433_fsm(){
 	TMR0IE = 1;
 	TMR0CS = 0;
 }
+
+/* Start the transmissions, called once a second. Each is sent in three
+ * consecutive seconds (four with the extended frame, alternating with it).
+ * With tr 0, every 48 seconds. Otherwise as soon as the temperature has
+ * changed by FO433_DELTA, or a relay has switched, since the last one, and
+ * while nothing changes, at intervals doubling up to 48 << FO433_BACKOFF_MAX
+ * seconds. 0-7 seconds of jitter (from the noise of the temperature) keep
+ * units from sending at the same time over and over.
+ * arguments: none
+ * return: nothing
+ */
+static void fo433_schedule(){
+	unsigned char mode = eeprom_read_config(EEADR_MENU_ITEM(tr));
+	unsigned char first = (mode == 2) ? 3 : 2;
+	unsigned char relays = (LATA5 << 1) | LATA4;
+	int t = TEMP_COARSE(temperature);
+
+	if(mode && fo433_sec_count > first){
+		int d = t - fo433_temp;
+		if(d < 0){
+			d = -d;
+		}
+		if(d >= FO433_DELTA || relays != fo433_relays){
+			fo433_sec_count = first;
+			fo433_backoff = 0;
+		}
+	}
+
+	if(fo433_sec_count <= first){
+		if(fo433_sec_count == first){
+			fo433_temp = t;
+			fo433_relays = relays;
+		}
+		fo433_ext = (mode == 2) && !(fo433_sec_count & 1);
+		fo433_state = 0;
+	}
+
+	if(fo433_sec_count == 0){
+		fo433_sec_count = 48;
+		if(mode){
+			// 8 bit Galois LFSR, stirred by the temperature
+			fo433_rand = ((fo433_rand >> 1) ^ ((fo433_rand & 1) ? 0xb8 : 0)) ^ (unsigned char)temperature;
+			fo433_sec_count = (48 << fo433_backoff) + (fo433_rand & 7);
+			if(fo433_backoff < FO433_BACKOFF_MAX){
+				fo433_backoff++;
+			}
+		}
+	}
+	fo433_sec_count--;
+}
 #endif // FO433
 
 /*
  * Main entry point.
  */
 void main(void) __naked {
-	unsigned int millisx60 = 0;
-	unsigned int ad_filter = (512L << FILTER_SHIFT);
+	// Odd on the first tick (probe 1 is read), 1s section on the second
+	unsigned int millisx60 = 14;
+	unsigned int ad_filter;
 #if defined(PB2) || defined(RH)
-	unsigned int ad_filter2 = (512L << FILTER_SHIFT);
+	unsigned int ad_filter2;
 #endif
 
 	init();
 
+#if defined(LOG)
+	log_init();
+	stats_init();
+#endif
+
+	// Start the filters at the readings, instead of converging from mid scale
+	// for a minute (and controlling on a wrong temperature meanwhile)
+	START_TCONV_1();
+	ad_filter = read_ad_seed();
+#if defined(PB2) || defined(RH)
+	START_TCONV_2();
+	ad_filter2 = read_ad_seed();
+#endif
+
 	START_TCONV_1();
 
 	//Loop forever
@@ -1143,9 +2477,20 @@ void main(void) __naked {
 			char rxdata = com_data;
 			com_count = 0;
 			GIE = 1;
+#if defined(TIMING)
+			{
+				unsigned int start = timing_now();
+				handle_com(rxdata);
+				timing_end(timing_com, start);
+			}
+#else
  			handle_com(rxdata);
+#endif
 		}
 		GIE = 1;
+#if defined(LOG)
+		log_write();
+#endif
 #elif defined(FO433)
 		/* Send next byte */
 		if((fo433_state <= fo433_crc) && (fo433_count == 0)){
@@ -1157,7 +2502,15 @@ void main(void) __naked {
 		if(TMR6IF) {
 
 			// Handle button press and menu
+#if defined(TIMING)
+			{
+				unsigned int start = timing_now();
+				button_menu_fsm();
+				timing_end(timing_menu, start);
+			}
+#else
 			button_menu_fsm();
+#endif
 
 			if(!TMR4ON){
 				led_e.raw = LED_OFF;
@@ -1170,15 +2523,29 @@ void main(void) __naked {
 		}
 
 #if defined(OVBSC)
-		if(oc==0){
-			oc = eeprom_read_config(EEADR_MENU_ITEM(Pd));
-			output_control();
-		}
+		output_control();
 #endif
 
 		if(TMR4IF) {
+#if defined(TIMING)
+			// A stall of the main loop longer than a period of timer 4 loses
+			// ticks (TMR4IF is only a flag), so time it with the 1ms interrupt
+			unsigned int gap;
+			GIE = 0;
+			gap = timing_ms - tmr4_ms;
+			tmr4_ms = timing_ms;
+			GIE = 1;
+			if(gap > timing.tmr4_gap){
+				timing.tmr4_gap = gap;
+			}
+#endif
 
 			millisx60++;
+#if defined(COM_CLOCK)
+			if(clock_count != 0xffff){
+				clock_count++;
+			}
+#endif
 
 			if(millisx60 & 0x1){
 				ad_filter = read_ad(ad_filter);
@@ -1193,25 +2560,34 @@ void main(void) __naked {
 			// Only run every 16th time called, that is 16x60ms = 960ms
 			// Close enough to 1s for our purposes.
 			if((millisx60 & 0xf) == 0) {
+#if defined(TIMING)
+				unsigned int start = timing_now();
+#endif
+
+#if defined(COM_CLOCK)
+				// Clock calibration, see clock_calibrate()
+				clock_acc += clock_trim;
+				if(clock_acc >= clock_step){
+					clock_acc -= clock_step;
+					millisx60 += 16;
+				} else if(clock_acc <= -clock_step){
+					clock_acc += clock_step;
+					millisx60 -= 16;
+				}
+#endif
 
 #if defined(PB2)
-				temperature2 = ad_to_temp(ad_filter2) + eeprom_read_config(EEADR_MENU_ITEM(tc2));
+				temperature2 = ad_to_temp(ad_filter2) + TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(tc2)));
 				// Disable sensor alarm for probe2 if it is not active
 				state_flags.ad_badrange = state_flags.ad_badrange & state_flags.probe2;
 #endif
-				temperature = ad_to_temp(ad_filter) + eeprom_read_config(EEADR_MENU_ITEM(tc));
+				temperature = ad_to_temp(ad_filter) + TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(tc)));
 #if defined(RH)
 				humidity = ad_to_rh(ad_filter2);
 #endif
 
 #if defined(FO433)
-				if(fo433_sec_count < 3){
-					fo433_state = 0;
-				}
-				if(fo433_sec_count == 0){
-					fo433_sec_count = 48;
-				}
-				fo433_sec_count--;
+				fo433_schedule();
 #endif
 
 #if defined(OVBSC)
@@ -1227,7 +2603,7 @@ void main(void) __naked {
 						if(RUN_PRG && (prg_state == prg_boil || prg_state == prg_wait_strike)){
 							int_to_led(countdown);
 						} else {
-							temperature_to_led(temperature);
+							temperature_to_led(TEMP_COARSE(temperature));
 						}
 					}
 				}
@@ -1249,12 +2625,15 @@ void main(void) __naked {
 					if((show_r_t == 0x2) || ((show_r_t & 0x2) && (millisx60 & 0x20))){
 						int_to_led(humidity);
 					} else if(show_r_t & 0x1){
-						temperature_to_led(temperature);
+						temperature_to_led(TEMP_COARSE(temperature));
 					} else {
 						led_01.raw = led_1.raw = led_10.raw = LED_OFF;
 					}
 				}
 #else
+#if defined(LOG)
+				stats_update();
+#endif
 				// Alarm on sensor error (AD result out of range)
 				if (state_flags.ad_badrange) {
 					LATA0 = 1;
@@ -1290,13 +2669,13 @@ void main(void) __naked {
 						// Update profile every minute
 						if(millisx60 >= 1000){
 							update_profile();
-							millisx60 = 8;
+							millisx60 -= 1000;
 						}
 #else
 						// Update profile every hour
 						if(millisx60 >= 60000){
 							update_profile();
-							millisx60 = 0;
+							millisx60 -= 60000;
 						}
 #endif
 					} else {
@@ -1305,12 +2684,12 @@ void main(void) __naked {
 					}
 
 					{
-						int sa = eeprom_read_config(EEADR_MENU_ITEM(SA));
+						int sa = TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(SA)));
 						if(sa){
 #if defined(MINUTE)
 							int diff = temperature - setpoint;
 #else
-							int diff = temperature - eeprom_read_config(EEADR_MENU_ITEM(SP));
+							int diff = temperature - TEMP_FINE((int)eeprom_read_config(EEADR_MENU_ITEM(SP)));
 #endif
 							if(diff < 0){
 								diff = -diff;
@@ -1337,18 +2716,24 @@ void main(void) __naked {
 #if defined(PB2)
 							led_e.e_point = !SENSOR_SELECT;
 							if(SENSOR_SELECT){
-								temperature_to_led(temperature2);
+								temperature_to_led(TEMP_COARSE(temperature2));
 							} else {
-								temperature_to_led(temperature);
+								temperature_to_led(TEMP_COARSE(temperature));
 							}
 #else
-							temperature_to_led(temperature);
+							temperature_to_led(TEMP_COARSE(temperature));
 #endif
 						}
 						SHOW_SA_ALARM = !SHOW_SA_ALARM;
 					}
 				}
+#if defined(LOG)
+				log_sample();
+#endif
 #endif // !OVBSC
+#if defined(TIMING)
+				timing_end(timing_second, start);
+#endif
 			} // End 1 sec section
 
 			// Reset timer flag
@@ -40,7 +40,15 @@
 
 #ifndef OVBSC
 	/* Help to convert menu item number and config item number to an EEPROM config address */
+#if defined(PACKED)
+	/* (the config item for the profiles, their steps are read and written with profile_seek() and profile_write()) */
+	#define MI_CI_TO_EEADR(mi, ci)		(((mi) < MENU_ITEM_NO) ? (ci) : EEADR_MENU + (ci))
+	/* The last config item of a profile, dh of its last step (to add a step) */
+	#define PROFILE_LAST_ITEM(mi)		profile_last_item(mi)
+#else
 	#define MI_CI_TO_EEADR(mi, ci)		((mi)*19 + (ci))
+	#define PROFILE_LAST_ITEM(mi)		18
+#endif
 
 	extern unsigned int heating_delay;
 	extern unsigned int cooling_delay;
@@ -62,15 +70,22 @@ static const struct s_menu menu[] = {
 	MENU_DATA(TO_STRUCT)
 };
 
+/* Change of config_value per repeat while up/down is held */
+static unsigned char config_step = 1;
+
 /* Helpers to constrain user input  */
 static int range(int x, int min, int max){
+	// Wrap around, but stop at the ends with the larger steps
 	if(x>max)
-		return min;
+		return (config_step == 1) ? min : max;
 	if(x<min)
-		return max;
+		return (config_step == 1) ? max : min;
 	return x;
 }
 
+/* Range (max - min) of the item last checked by check_config_value() */
+static int config_range;
+
 /* Check and constrain a configuration value */
 static int check_config_value(int config_value, unsigned char eeadr){
 	int t_min = 0, t_max=999;
@@ -129,6 +144,8 @@ static int check_config_value(int config_value, unsigned char eeadr){
 #elif defined(FO433)
 		} else if(type == t_deviceid){
 			t_max = 15;
+		} else if(type == t_fo433_tx){
+			t_max = FO433_TX_MAX;
 #endif
 		} else if(type == t_sp_alarm){
 			t_min = SP_ALARM_MIN;
@@ -137,11 +154,19 @@ static int check_config_value(int config_value, unsigned char eeadr){
 			t_max = 8;
 		} else if(type == t_delay){
 			t_max = 60;
+#if defined(PID)
+		} else if(type == t_pid_band){
+			t_min = 1;
+			t_max = TEMP_HYST_2_MAX;
+		} else if(type == t_pid_window){
+			t_min = 10;
+#endif
 		} else if(type == t_runmode){
-			t_max = 6;
+			t_max = RUN_MODE_MAX;
 #endif
 		}
 	}
+	config_range = t_max - t_min;
 	return range(config_value, t_min, t_max);
 }
 
@@ -184,6 +209,12 @@ static void prx_to_led(unsigned char run_mode, unsigned char is_menu){
 		led_10.raw = LED_P;
 		led_1.raw = LED_r;
 		led_01.raw = led_lookup[run_mode];
+#if defined(PID)
+	} else if(run_mode == AUTOTUNE_MODE){
+		led_10.raw = LED_A;
+		led_1.raw = LED_t;
+		led_01.raw = LED_OFF;
+#endif
 	} else {
 		if(is_menu){
 			led_10.raw = LED_S;
@@ -200,6 +231,13 @@ static void prx_to_led(unsigned char run_mode, unsigned char is_menu){
 #define run_mode_to_led(x)	prx_to_led(x,0)
 #define menu_to_led(x)		prx_to_led(x,1)
 
+#if defined(PACKED)
+static unsigned char profile_last_item(unsigned char profile){
+	unsigned char item = (9 - profile_seek(profile, 9)) << 1;
+	return (item < 18) ? item + 1 : 18;
+}
+#endif
+
 #endif
 
 /* States for the menu FSM */
@@ -246,29 +284,27 @@ static unsigned char _buttons = 0;
  */
 void button_menu_fsm(){
 	{
-		unsigned char trisc, latb;
+		unsigned char pins;
 
-		// Disable interrups while reading buttons
+		// Buttons pressed at any time since the last call (debounced in the interrupt)
 		GIE = 0;
-
-		// Save registers that interferes with LED's
-		latb = LATB;
-		trisc = TRISC;
-
-		LATB = 0b00000000; // Turn off LED's
-		TRISC = 0b11011000; // Enable input for buttons
-
-		_buttons = (_buttons << 1) | RC7; // pwr
-		_buttons = (_buttons << 1) | RC4; // s
-		_buttons = (_buttons << 1) | RC6; // up
-		_buttons = (_buttons << 1) | RC3; // down
-
-		// Restore registers
-		LATB = latb;
-		TRISC = trisc;
-
-		// Reenable interrups
+		pins = button_pins;
+		button_pins = 0;
 		GIE = 1;
+
+		_buttons <<= 4;
+		if(pins & 0x80){ // pwr (RC7)
+			_buttons |= 0x08;
+		}
+		if(pins & 0x10){ // s (RC4)
+			_buttons |= 0x04;
+		}
+		if(pins & 0x40){ // up (RC6)
+			_buttons |= 0x02;
+		}
+		if(pins & 0x08){ // down (RC3)
+			_buttons |= 0x01;
+		}
 	}
 
 	if(m_countdown){
@@ -292,7 +328,7 @@ void button_menu_fsm(){
 		if(BTN_PRESSED(BTN_PWR)){
 			m_countdown = 27; // 3 sec
 			menustate = menu_power_down_wait;
-		} else if(_buttons && eeprom_read_config(EEADR_POWER_ON)){
+		} else if(_buttons && (unsigned char) eeprom_read_config(EEADR_POWER_ON)){
 #endif
 			if (BTN_PRESSED(BTN_UP | BTN_DOWN)) {
 				menustate = menu_show_version;
@@ -342,7 +378,7 @@ void button_menu_fsm(){
 		int_to_led(eeprom_read_config(EEADR_COUNTER(eeprom_read_config(EEADR_COUNTER_INDEX))));
 #else
 #ifdef MINUTE
-		temperature_to_led(setpoint);
+		temperature_to_led(TEMP_COARSE(setpoint));
 #else
 		temperature_to_led(eeprom_read_config(EEADR_MENU_ITEM(SP)));
 #endif
@@ -481,6 +517,10 @@ void button_menu_fsm(){
 			led_01.raw = menu[config_item].led_c_01;
 		}
 #endif
+		// After a value is stored or left, and when the item changes, the
+		// next value starts over at the slow rate with single steps
+		PR6 = 250;
+		config_step = 1;
 		m_countdown = 110;
 		menustate = menu_set_config_item;
 		break;
@@ -542,7 +582,7 @@ void button_menu_fsm(){
 		} else if(BTN_RELEASED(BTN_UP)){
 			config_item++;
 			if(menu_item < MENU_ITEM_NO){
-				if(config_item >= 19){
+				if(config_item > PROFILE_LAST_ITEM(menu_item)){
 					config_item = 0;
 				}
 			} else {
@@ -557,8 +597,8 @@ void button_menu_fsm(){
 		} else if(BTN_RELEASED(BTN_DOWN)){
 			config_item--;
 			if(menu_item < MENU_ITEM_NO){
-				if(config_item > 18){
-					config_item = 18;
+				if(config_item > PROFILE_LAST_ITEM(menu_item)){
+					config_item = PROFILE_LAST_ITEM(menu_item);
 				}
 			} else {
 				if(config_item > MENU_SIZE-1){
@@ -579,6 +619,12 @@ chk_skip_menu_item:
 			menustate = menu_show_config_item;
 		} else if(BTN_RELEASED(BTN_S)){
 			unsigned char adr = MI_CI_TO_EEADR(menu_item, config_item);
+#if defined(PACKED)
+			if(menu_item < MENU_ITEM_NO){
+				profile_seek(menu_item, config_item >> 1);
+				config_value = (config_item & 0x1) ? prof_dur : prof_sp;
+			} else
+#endif
 			config_value = eeprom_read_config(adr);
 			config_value = check_config_value(config_value, adr);
 			m_countdown = 110;
@@ -660,25 +706,35 @@ chk_skip_menu_item:
 			unsigned char adr = MI_CI_TO_EEADR(menu_item, config_item);
 #endif
 			if(m_countdown==0){
+				PR6 = 250;
+				config_step = 1;
 				menustate=menu_idle;
 			} else if(BTN_RELEASED(BTN_PWR)){
 				menustate = menu_show_config_item;
 			} else if(BTN_HELD_OR_RELEASED(BTN_UP)) {
-				config_value++;
-				if(config_value > 1000){
+				config_value += config_step;
+				if(config_value > 1000 && config_step == 1){
 					config_value+=9;
 				}
 				/* Jump to exit code shared with BTN_DOWN case */
 				goto chk_cfg_acc_label;
 			} else if(BTN_HELD_OR_RELEASED(BTN_DOWN)) {
-				config_value--;
-				if(config_value > 1000){
+				config_value -= config_step;
+				if(config_value > 1000 && config_step == 1){
 					config_value-=9;
 				}
 chk_cfg_acc_label:
 				config_value = check_config_value(config_value, adr);
+				// Repeat faster while held, then go on with ten times larger steps
+				// from the slow rate (x10, x100, as long as the step is less than the range of the item)
 				if(PR6 > 30){
-					PR6-=8;
+					PR6-=16;
+				} else if(config_step < 100){
+					unsigned char step = (config_step << 3) + (config_step << 1);
+					if(step < config_range){
+						config_step = step;
+						PR6 = 250;
+					}
 				}
 				menustate = menu_show_config_value;
 			} else if(BTN_RELEASED(BTN_S)){
@@ -717,26 +773,42 @@ chk_cfg_acc_label:
 						eeprom_write_config(EEADR_MENU_ITEM(dh), 0);
 #endif
 						if(config_value < THERMOSTAT_MODE){
+#if defined(PACKED)
+							profile_seek(config_value, 0);
+							#define PROFILE_SP0		prof_sp
+							#define PROFILE_DH0		prof_dur
+#else
 							unsigned char eeadr_sp = EEADR_PROFILE_SETPOINT(((unsigned char)config_value), 0);
+							#define PROFILE_SP0		eeprom_read_config(eeadr_sp)
+							#define PROFILE_DH0		eeprom_read_config(eeadr_sp+1)
+#endif
 							// Set intial value for SP
 #if defined(MINUTE)
-							setpoint = eeprom_read_config(eeadr_sp);
+							setpoint = PROFILE_SP0;
 							eeprom_write_config(EEADR_MENU_ITEM(SP), setpoint);
+							setpoint = TEMP_FINE(setpoint);
 #else
-							eeprom_write_config(EEADR_MENU_ITEM(SP), eeprom_read_config(eeadr_sp));
+							eeprom_write_config(EEADR_MENU_ITEM(SP), PROFILE_SP0);
 #endif
 							// Hack in case inital step duration is '0'
-							if(eeprom_read_config(eeadr_sp+1) == 0){
+							if(PROFILE_DH0 == 0){
 								config_value = THERMOSTAT_MODE;
 							}
 						}
 					}
 				}
+#if defined(PACKED)
+				if(menu_item < MENU_ITEM_NO){
+					// Not stored when the profiles are full
+					profile_write(menu_item, config_item, config_value);
+				} else
+#endif
 				eeprom_write_config(adr, config_value);
 #endif // !OVBSC !RH
 				menustate=menu_show_config_item;
 			} else {
 				PR6 = 250;
+				config_step = 1;
 			}
 		}
 		break;
@@ -745,7 +817,7 @@ chk_cfg_acc_label:
 	case menu_power_down_wait:
 		if(m_countdown==0){
 			unsigned char pwr_on = eeprom_read_config(EEADR_POWER_ON);
-			eeprom_write_config(EEADR_POWER_ON, !pwr_on);
+			eeprom_write_config(EEADR_POWER_ON, EEPROM_POWER_ON_VALUE(!pwr_on));
 			if(pwr_on){
 				LATA0 = 0;
 				LATA4 = 0;
@@ -60,8 +60,8 @@
 
 /* Define STC-1000+ version number (XYY, X=major, YY=minor) */
 /* Also, keep track of last version that has changes in EEPROM layout */
-#define STC1000P_VERSION			(109)
-#define STC1000P_EEPROM_VERSION		(12)
+#define STC1000P_VERSION			(110)
+#define STC1000P_EEPROM_VERSION		(14)
 
 /* Clear Watchdog */
 #define ClrWdt() 					{ __asm CLRWDT __endasm; }
@@ -86,6 +86,12 @@
 	#define PUMP_MANUAL()		do { TRISA1=1; LATA1=0; } while(0)
 	// RA1 output, write low.
 	#define PUMP_OFF()			do { TRISA1=0; LATA1=0; } while(0)
+
+	/* With OUTPUT_BURST (make stc1000p_ovbsc_burst), the on time of the
+	 * outputs is spread over the heating period (burst fire), which is only
+	 * for solid state relays. Without it, each output switches at most once
+	 * per period, as mechanical relays need.
+	 */
 #elif defined(RH)
 	#define HEATING				C1POL
 	#define HUMID				C2POL
@@ -93,6 +99,13 @@
 	#define	SHOW_SA_ALARM		RX9
 #endif
 
+/* Temperatures in the control path are in 1/(10 << TEMP_FRAC_BITS) degrees,
+ * for display, COM and EEPROM they are in 0.1 degrees.
+ */
+#define TEMP_FRAC_BITS			3
+#define TEMP_FINE(t)			((t) << TEMP_FRAC_BITS)
+#define TEMP_COARSE(t)			(((t) + (1 << (TEMP_FRAC_BITS-1))) >> TEMP_FRAC_BITS)
+
 /* Define limits for temperatures */
 #ifdef FAHRENHEIT
 	#define TEMP_MAX				(2500)
@@ -123,6 +136,7 @@
 		#define DEFAULT_hy			(10)
 		#define DEFAULT_hy2			(100)
 		#define DEFAULT_SP			(680)
+		#define DEFAULT_PP			(40)
 	#endif
 #else  // CELSIUS
 	#if defined OVBSC
@@ -132,6 +146,7 @@
 		#define DEFAULT_hy			(5)
 		#define DEFAULT_hy2			(50)
 		#define DEFAULT_SP			(200)
+		#define DEFAULT_PP			(20)
 	#endif
 #endif
 
@@ -156,13 +171,20 @@ enum e_item_type {
 	t_hyst_1,
 #if defined(PB2)
 	t_hyst_2,
+#endif
+#if defined(PID)
+	t_pid_band,
 #endif
 	t_sp_alarm,
 #if defined FO433
 	t_deviceid,
+	t_fo433_tx,
 #endif
 	t_step,
 	t_delay,
+#if defined(PID)
+	t_pid_window,
+#endif
 	t_runmode,
 #endif 
 	t_duration,
@@ -175,6 +197,49 @@ enum e_item_type {
 	#define MENU_TYPE_IS_TEMPERATURE(x) 	((x) <= t_sp_alarm)
 #endif
 
+#if defined(PID) && (defined(OVBSC) || defined(RH) || defined(FO433))
+	#error "PID is only for the thermostat builds (standard, PB2 and MINUTE)"
+#endif
+
+#if defined(PID)
+	/* Menu items for PID control of the heating relay (see temperature_control()),
+	 * inserted before rn in the thermostat builds:
+	 * 	PP, proportional band (0.1 degrees), the error at which heating is on for the whole window
+	 * 	PI, integral time (minutes), 0 is off
+	 * 	Pd, derivative time (seconds), 0 is off
+	 * 	Pc, time proportioning window (seconds), 600 is at most 144 relay cycles a day
+	 */
+	#define PID_MENU_DATA(_) \
+		_(PP, 	LED_P, 	LED_P, 	LED_OFF, 	t_pid_band,			DEFAULT_PP)		\
+		_(PI, 	LED_P, 	LED_I, 	LED_OFF, 	t_duration,			30)				\
+		_(Pd, 	LED_P, 	LED_d, 	LED_OFF, 	t_duration,			0)				\
+		_(Pc, 	LED_P, 	LED_c, 	LED_OFF, 	t_pid_window,		600)
+#else
+	#define PID_MENU_DATA(_)
+#endif
+
+#if defined(LOG) && (!defined(COM) || defined(PID))
+	#error "LOG needs COM to read the log, and can not be combined with PID"
+#endif
+
+#if defined(PACKED) && (defined(OVBSC) || defined(RH) || defined(PID) || defined(LOG))
+	#error "PACKED is only for the thermostat builds without PID or LOG"
+#endif
+
+#if defined(TIMING) && !defined(COM)
+	#error "TIMING needs COM to read the timing data"
+#endif
+
+#if defined(LOG)
+	/* Temperature history log (see log_sample()), read with COM_READ_LOG:
+	 * 	Li, log interval (minutes), 0 is off
+	 */
+	#define LOG_MENU_DATA(_) \
+		_(Li, 	LED_L, 	LED_I, 	LED_OFF, 	t_duration,			15)
+#else
+	#define LOG_MENU_DATA(_)
+#endif
+
 #if defined(OVBSC)
 	#define MENU_DATA(_) \
 		_(Sd, 	LED_S, 	LED_d, 	LED_OFF,	t_duration,			0)				\
@@ -232,7 +297,8 @@ enum e_item_type {
 		_(hd, 	LED_h, 	LED_d, 	LED_OFF, 	t_delay,			2)				\
 		_(rP, 	LED_r, 	LED_P, 	LED_OFF, 	t_boolean,			0)				\
 		_(Pb, 	LED_P, 	LED_b, 	LED_2, 		t_boolean,			0)				\
-		_(rn, 	LED_r, 	LED_n, 	LED_OFF, 	t_runmode,			6)
+		PID_MENU_DATA(_)															\
+		_(rn, 	LED_r, 	LED_n, 	LED_OFF, 	t_runmode,			THERMOSTAT_MODE)
 
 #elif defined(FO433)
 
@@ -248,13 +314,28 @@ enum e_item_type {
 		_(hy, 	LED_h, 	LED_y, 	LED_OFF, 	t_hyst_1,			DEFAULT_hy) 	\
 		_(tc, 	LED_t, 	LED_c, 	LED_OFF, 	t_tempdiff,			0)				\
 		_(dI, 	LED_d, 	LED_I, 	LED_OFF, 	t_deviceid,			0)				\
+		_(tr, 	LED_t, 	LED_r, 	LED_OFF, 	t_fo433_tx,			1)				\
 		_(SA, 	LED_S, 	LED_A, 	LED_OFF, 	t_sp_alarm,			0)				\
 		_(St, 	LED_S, 	LED_t, 	LED_OFF, 	t_step,				0)				\
 		_(dh, 	LED_d, 	LED_h, 	LED_OFF, 	t_duration,			0)				\
 		_(cd, 	LED_c, 	LED_d, 	LED_OFF, 	t_delay,			5)				\
 		_(hd, 	LED_h, 	LED_d, 	LED_OFF, 	t_delay,			2)				\
 		_(rP, 	LED_r, 	LED_P, 	LED_OFF, 	t_boolean,			0)				\
-		_(rn, 	LED_r, 	LED_n, 	LED_OFF, 	t_runmode,			6)
+		_(rn, 	LED_r, 	LED_n, 	LED_OFF, 	t_runmode,			THERMOSTAT_MODE)
+
+	/* Transmissions (see fo433_schedule()), by tr:
+	 * 	0, every 48 seconds
+	 * 	1, on a change of FO433_DELTA in temperature or of the relays, else at intervals
+	 * 	   doubling from 48 seconds up to 48 << FO433_BACKOFF_MAX, with 0-7 seconds of jitter
+	 * 	2, as 1, also sending the extended frame (setpoint, run mode and step)
+	 */
+	#define FO433_TX_MAX			2
+	#define FO433_BACKOFF_MAX		3
+#ifdef FAHRENHEIT
+	#define FO433_DELTA				(5)
+#else
+	#define FO433_DELTA				(3)
+#endif
 
 #elif defined(RH)
 
@@ -302,7 +383,9 @@ enum e_item_type {
 		_(cd, 	LED_c, 	LED_d, 	LED_OFF, 	t_delay,			5)				\
 		_(hd, 	LED_h, 	LED_d, 	LED_OFF, 	t_delay,			2)				\
 		_(rP, 	LED_r, 	LED_P, 	LED_OFF, 	t_boolean,			0)				\
-		_(rn, 	LED_r, 	LED_n, 	LED_OFF, 	t_runmode,			6)
+		PID_MENU_DATA(_)															\
+		LOG_MENU_DATA(_)															\
+		_(rn, 	LED_r, 	LED_n, 	LED_OFF, 	t_runmode,			THERMOSTAT_MODE)
 
 #endif
 
@@ -317,15 +400,104 @@ enum menu_enum {
 /* Defines for EEPROM config addresses */
 #if defined(OVBSC) || defined(RH)
 	#define EEADR_MENU				0
+#else
+#if defined(PACKED)
+	/* Profiles as variable length records (see PROFILE_SHORT), in the space of the 6 fixed ones */
+	#define NO_OF_PROFILES			10
+#elif defined(PID)
+	/* One profile less, to make room for the PID menu items */
+	#define NO_OF_PROFILES			5
+#elif defined(LOG)
+	/* Two profiles, the space of the others holds the log */
+	#define NO_OF_PROFILES			2
 #else
 	#define NO_OF_PROFILES			6
+#endif
 	#define MENU_ITEM_NO			NO_OF_PROFILES
 	#define THERMOSTAT_MODE			NO_OF_PROFILES
+#if defined(PID)
+	/* Relay feedback autotune of the PID menu items, shown as 'At' */
+	#define AUTOTUNE_MODE			(THERMOSTAT_MODE + 1)
+	#define RUN_MODE_MAX			AUTOTUNE_MODE
+#else
+	#define RUN_MODE_MAX			THERMOSTAT_MODE
+#endif
 
+#if defined(PACKED)
+	/* The steps of all profiles, one after the other from address 0, each
+	 * profile ending with a step of duration 0 (its setpoint is the last one,
+	 * and it is at most step 9). A step is one word when its setpoint is
+	 * -6.4 to +6.3 degrees from the step before it (from 0 for step 0) and
+	 * the duration is less than 256, else two words with the setpoint and the
+	 * duration. See profile_seek() and profile_write().
+	 */
+	#define PROFILE_SHORT(delta, dur)				(0x8000 | (((delta) & 0x7f) << 8) | (dur))
+	#define PROFILE_LONG(sp, dur)					((sp) & 0x7fff), (dur)
+	#define EEADR_MENU								114
+#else
 	#define EEADR_PROFILE_SETPOINT(profile, step)	(((profile)*19) + ((step)<<1))
 	#define EEADR_PROFILE_DURATION(profile, step)	EEADR_PROFILE_SETPOINT(profile, step) + 1
 	#define EEADR_MENU								EEADR_PROFILE_SETPOINT(NO_OF_PROFILES, 0)
+#endif
 	#define EEADR_POWER_ON							127
+#if defined(COM)
+	/* Clock calibration, 60ms ticks counted in an hour of real time (see
+	 * COM_CLOCK_MARK), no calibration when not CLOCK_TICKS_MIN-CLOCK_TICKS_MAX.
+	 * Part of every COM layout, only used by builds with COM_CLOCK.
+	 */
+	#define EEADR_CLOCK_TICKS						(EEADR_POWER_ON - 1)
+	#define CLOCK_TICKS_PER_HOUR					60000
+	#define CLOCK_TICKS_MIN							58000
+	#define CLOCK_TICKS_MAX							62000
+#endif
+#if defined(LOG)
+	/* Operating statistics (see stats_update()) after the menu data, then the
+	 * log, a ring of bytes up to EEADR_CLOCK_TICKS
+	 */
+	#define EEADR_STATS								(EEADR_MENU_ITEM(rn) + 1)
+	#define STATS_WORDS								12
+	#define EEADR_LOG								(EEADR_STATS + STATS_WORDS)
+	#define LOG_START								(EEADR_LOG << 1)
+	#define LOG_SIZE								((EEADR_CLOCK_TICKS - EEADR_LOG) << 1)
+#endif
+
+	/* The power on flag only uses the low byte, the high byte holds the
+	 * layout version (STC1000P_EEPROM_VERSION, below 64) of the data in
+	 * EEPROM, and in the top two bits the variant family, as the PACKED, PID
+	 * and LOG builds keep the profiles and menu data at other addresses.
+	 */
+	#define EEPROM_LAYOUT_VARIANT_MASK				0xc0
+#if defined(PACKED)
+	#define EEPROM_LAYOUT_VARIANT					0x40
+#elif defined(PID)
+	#define EEPROM_LAYOUT_VARIANT					0x80
+#elif defined(LOG)
+	#define EEPROM_LAYOUT_VARIANT					0xc0
+#else
+	#define EEPROM_LAYOUT_VARIANT					0
+#endif
+	#define EEPROM_LAYOUT							(STC1000P_EEPROM_VERSION | EEPROM_LAYOUT_VARIANT)
+	#define EEPROM_POWER_ON_VALUE(on)				((EEPROM_LAYOUT << 8) | (on))
+
+	/* Layout of EEPROM written by 1.09, which did not stamp the version */
+	#define EEPROM_LAYOUT_UNSTAMPED					12
+
+	/* Layout migrations, run at start up when EEPROM has an older layout version.
+	 * When config data moves, increase STC1000P_EEPROM_VERSION and add a step
+	 * for each block that moved:
+	 *   _(version, from, to, count, fill)
+	 * moves count config values from address 'from' to 'to' and, when moving up
+	 * (that is, something was inserted), sets the vacated addresses to fill.
+	 * For example, a new item after tc (default 0) in layout version 13:
+	 *   #define EEPROM_MIGRATIONS(_) \
+	 *   	_(13, EEADR_MENU_ITEM(tc)+1, EEADR_MENU_ITEM(tc)+2, rn-tc-1, 0)
+	 * Leave undefined when there are no migrations, to save code space.
+	 */
+#if defined(FO433)
+	// Layout 14 added tr after dI
+	#define EEPROM_MIGRATIONS(_) \
+		_(14, EEADR_MENU_ITEM(dI)+1, EEADR_MENU_ITEM(dI)+2, rn-dI-1, 1)
+#endif
 #endif
 
 #if defined(RH)
@@ -379,6 +551,11 @@ enum menu_enum {
 	#define COM_READ_TEMP			0x01
 	#define COM_READ_COOLING		0x02
 	#define COM_READ_HEATING		0x03
+	#define COM_READ_LOG			0x04
+	#define COM_READ_TIMING			0x05
+	#define COM_READ_STATS			0x06
+	#define COM_RESET_STATS			0x07
+	#define COM_CLOCK_MARK			0x08
 	#define COM_ACK					0x9A
 	#define COM_NACK				0x66
 #endif
@@ -434,6 +611,7 @@ typedef union
 
 extern led_e_t led_e;
 extern led_t led_10, led_1, led_01;
+extern unsigned char button_pins;
 extern unsigned const char led_lookup[];
 
 #if defined(MINUTE)
@@ -448,6 +626,13 @@ extern unsigned const char led_lookup[];
 	extern unsigned char mashstep;
 #endif
 
+#if defined(PACKED)
+	extern int prof_sp;
+	extern unsigned int prof_dur;
+	extern unsigned char profile_seek(unsigned char profile, unsigned char step);
+	extern unsigned char profile_write(unsigned char profile, unsigned char item, int value);
+#endif
+
 extern unsigned int eeprom_read_config(unsigned char eeprom_address);
 extern void eeprom_write_config(unsigned char eeprom_address,unsigned int data);
 extern void value_to_led(int value, unsigned char decimal);
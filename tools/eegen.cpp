@@ -0,0 +1,485 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Batch generation of EEPROM images from a table of unit configurations.
+ *
+ * Each line of the table describes one unit:
+ *
+ *   name variant scale [item=value ...]
+ *
+ * where variant is one of the firmware variants in build.sh (vanilla, probe2, ...),
+ * scale is C or F and item is a menu item (SP, hy, dI, ...) or a profile (Pr0-Pr5,
+ * Pr0-Pr9 for the packed variants), given as a comma separated list of setpoints
+ * and durations (SP0,dh0,SP1,...,SP9).
+ * Temperatures are entered with one decimal, as on the display (more are an
+ * error). Everything not given keeps the defaults from eepromdata.c. '#'
+ * starts a comment.
+ *
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <atomic>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+#include "eeprom.h"
+#include "ihex.h"
+#include "pack.h"
+
+struct unit {
+	std::string name;
+	const ee_variant *variant;
+	int fahrenheit;
+	std::vector<int> values;
+	std::vector<int> steps;			/* profiles of packed variants, packed into values when read */
+};
+
+static const char *format = "hex";
+static const char *outdir = ".";
+static const char *sketchdir = "..";
+
+/* Sketches read once per variant, shared by the worker threads */
+static std::map<const ee_variant *, std::string> sketches;
+
+/* Parse a value, with one decimal for temperatures (as on the display).
+ * return: 0 on success, -1 if not a valid number, -2 if it has more decimals than the item
+ */
+static int parse_value(const char *s, unsigned char type, int *value){
+	char *end;
+
+	if(ee_type_has_decimal(type)){
+		double d = strtod(s, &end);
+		if(end == s || *end){
+			return -1;
+		}
+		*value = (int) lround(d * 10.0);
+		if(fabs(d * 10.0 - *value) > 1e-6){
+			return -2;
+		}
+	} else {
+		long l = strtol(s, &end, 10);
+		if(end == s || *end){
+			return -1;
+		}
+		*value = (int) l;
+	}
+
+	return 0;
+}
+
+/* Set and validate a config value (of the given type, in dest).
+ * return: 0 on success, -1 on error (message printed to stderr)
+ */
+static int set_value(unit &u, unsigned char type, int &dest, const char *s, const char *where, const char *item){
+	int value, t_min, t_max, r;
+
+	r = parse_value(s, type, &value);
+	if(r == -2){
+		fprintf(stderr, "%s: %s: '%s' has more than one decimal\n", where, item, s);
+		return -1;
+	} else if(r < 0){
+		fprintf(stderr, "%s: %s: invalid value '%s'\n", where, item, s);
+		return -1;
+	}
+
+	ee_limits(u.variant, type, u.fahrenheit, &t_min, &t_max);
+	if(value < t_min || value > t_max){
+		if(ee_type_has_decimal(type)){
+			fprintf(stderr, "%s: %s: %s out of range (%.1f - %.1f)\n", where, item, s, t_min / 10.0, t_max / 10.0);
+		} else {
+			fprintf(stderr, "%s: %s: %s out of range (%d - %d)\n", where, item, s, t_min, t_max);
+		}
+		return -1;
+	}
+
+	dest = value;
+	return 0;
+}
+
+/* Parse 'item=value' or 'PrN=SP0,dh0,...'.
+ * return: 0 on success, -1 on error (message printed to stderr)
+ */
+static int parse_setting(unit &u, char *setting, const char *where){
+	char *value = strchr(setting, '=');
+	int item;
+
+	if(!value){
+		fprintf(stderr, "%s: expected item=value, got '%s'\n", where, setting);
+		return -1;
+	}
+	*value++ = '\0';
+
+	if(setting[0] == 'P' && setting[1] == 'r' && isdigit(setting[2]) && !setting[3]){
+		unsigned char profile = setting[2] - '0';
+		unsigned char step = 0;
+		char *s, *save;
+
+		if(profile >= u.variant->profiles){
+			fprintf(stderr, "%s: %s: no such profile in %s\n", where, setting, u.variant->name);
+			return -1;
+		}
+		for(s = strtok_r(value, ",", &save); s; s = strtok_r(NULL, ",", &save)){
+			char name[8];
+			if(step >= EE_PROFILE_SIZE){
+				fprintf(stderr, "%s: %s: too many values (SP0,dh0,...,SP9)\n", where, setting);
+				return -1;
+			}
+			snprintf(name, sizeof(name), "%s%d", (step & 1) ? "dh" : "SP", step >> 1);
+			if(set_value(u, (step & 1) ? ee_duration : ee_temperature,
+					(u.variant->packed ? u.steps : u.values)[profile * EE_PROFILE_SIZE + step], s, where, name) < 0){
+				return -1;
+			}
+			step++;
+		}
+		return 0;
+	}
+
+	item = ee_find_menu_item(u.variant, setting);
+	if(item < 0){
+		fprintf(stderr, "%s: no item '%s' in %s\n", where, setting, u.variant->name);
+		return -1;
+	}
+
+	item = ee_menu_address(u.variant, item);
+	return set_value(u, ee_address_type(u.variant, item), u.values[item], value, where, setting);
+}
+
+/* Read the unit table.
+ * return: number of errors
+ */
+static int read_units(const char *filename, std::vector<unit> &units){
+	FILE *f = strcmp(filename, "-") ? fopen(filename, "r") : stdin;
+	char line[1024];
+	unsigned int lineno = 0;
+	int errors = 0;
+
+	if(!f){
+		perror(filename);
+		return 1;
+	}
+
+	while(fgets(line, sizeof(line), f)){
+		char where[256];
+		char *tok, *save, *p;
+		unit u;
+		size_t i;
+		int ok = 1;
+
+		lineno++;
+		snprintf(where, sizeof(where), "%s:%u", filename, lineno);
+		if((p = strchr(line, '#'))){
+			*p = '\0';
+		}
+
+		if(!(tok = strtok_r(line, " \t\r\n", &save))){
+			continue;
+		}
+		u.name = tok;
+		for(p = tok; *p; p++){
+			if(!isalnum(*p) && *p != '_' && *p != '-' && *p != '.'){
+				fprintf(stderr, "%s: invalid unit name '%s'\n", where, tok);
+				ok = 0;
+				break;
+			}
+		}
+		for(i=0; ok && i<units.size(); i++){
+			if(units[i].name == u.name){
+				fprintf(stderr, "%s: duplicate unit name '%s'\n", where, tok);
+				ok = 0;
+			}
+		}
+
+		tok = strtok_r(NULL, " \t\r\n", &save);
+		if(ok && (!tok || !(u.variant = ee_find_variant(tok)))){
+			fprintf(stderr, "%s: unknown firmware variant '%s'\n", where, tok ? tok : "");
+			ok = 0;
+		}
+
+		tok = strtok_r(NULL, " \t\r\n", &save);
+		if(ok && (!tok || (strcmp(tok, "C") && strcmp(tok, "F")))){
+			fprintf(stderr, "%s: temperature scale must be C or F\n", where);
+			ok = 0;
+		}
+
+		if(ok){
+			u.fahrenheit = tok[0] == 'F';
+			ee_defaults(u.variant, u.fahrenheit, u.values);
+			if(u.variant->packed){
+				ee_default_steps(u.variant, u.steps);
+			}
+			while(ok && (tok = strtok_r(NULL, " \t\r\n", &save))){
+				char at[300];
+				// Point at the setting, line:column
+				snprintf(at, sizeof(at), "%s:%u", where, (unsigned int) (tok - line) + 1);
+				ok = parse_setting(u, tok, at) == 0;
+			}
+			if(ok && u.variant->packed && ee_pack_profiles(u.variant, u.steps, u.values) < 0){
+				fprintf(stderr, "%s: the profiles do not fit in %d words\n", where, EE_PROFILE_WORDS);
+				ok = 0;
+			}
+		}
+
+		if(ok){
+			units.push_back(u);
+		} else {
+			errors++;
+		}
+	}
+
+	if(f != stdin){
+		fclose(f);
+	}
+
+	return errors;
+}
+
+/* Read the prebuilt sketch of a variant (picprog_*.ino) */
+static int read_sketch(const ee_variant *v){
+	std::string filename = std::string(sketchdir) + "/picprog" + v->suffix + ".ino";
+	FILE *f = fopen(filename.c_str(), "r");
+	char buf[4096];
+	size_t n;
+
+	if(!f){
+		perror(filename.c_str());
+		return -1;
+	}
+	while((n = fread(buf, 1, sizeof(buf), f)) > 0){
+		sketches[v].append(buf, n);
+	}
+	fclose(f);
+
+	return 0;
+}
+
+/* Set a '#define NAME value' line in the sketch.
+ * return: 0 on success, -1 if not found
+ */
+static int set_define(std::string &sketch, const char *name, const char *value){
+	std::string def = std::string("#define ") + name;
+	size_t start = sketch.find(def), end;
+
+	if(start == std::string::npos){
+		return -1;
+	}
+	end = sketch.find('\n', start);
+	sketch.replace(start, end - start, def + "\t\t" + value);
+
+	return 0;
+}
+
+/* Create sketch with the EEPROM image of the unit, for its temperature scale only.
+ * return: 0 on success, -1 on error
+ */
+static int make_sketch(const unit &u, const std::vector<unsigned char> &packed, std::string &sketch, std::string &error){
+	const char *name = u.fahrenheit ? "hex_eeprom_fahrenheit" : "hex_eeprom_celsius";
+	std::string decl = std::string("const char ") + name + "[] PROGMEM = {";
+	char *buf;
+	size_t size, start, end;
+	FILE *f;
+
+	sketch = sketches.find(u.variant)->second;
+
+	start = sketch.find(decl);
+	end = start == std::string::npos ? start : sketch.find("};\n", start);
+	if(end == std::string::npos){
+		error = std::string("sketch for ") + u.variant->name + " has no " + name;
+		return -1;
+	}
+
+	f = open_memstream(&buf, &size);
+	if(!f){
+		error = strerror(errno);
+		return -1;
+	}
+	pack_print_c(f, name, packed);
+	fclose(f);
+	sketch.replace(start, end + 3 - start, buf, size);
+	free(buf);
+
+	if(set_define(sketch, "INCLUDE_FAHRENHEIT_HEX_DATA", u.fahrenheit ? "1" : "0") < 0 ||
+			set_define(sketch, "INCLUDE_CELSIUS_HEX_DATA", u.fahrenheit ? "0" : "1") < 0){
+		error = std::string("sketch for ") + u.variant->name + " has no INCLUDE_*_HEX_DATA defines";
+		return -1;
+	}
+
+	return 0;
+}
+
+/* Generate the output file of one unit.
+ * return: 0 on success, -1 on error (with error message)
+ */
+static int generate(const unit &u, std::string &error){
+	std::vector<ihex_record> records;
+	std::string filename = std::string(outdir) + "/" + u.name + "." + (strcmp(format, "ino") ? "hex" : "ino");
+
+	ee_records(u.values, records);
+
+	if(!strcmp(format, "ino")){
+		std::vector<unsigned char> packed;
+		std::string sketch;
+		FILE *f;
+
+		if(pack_records(records, packed) < 0 || make_sketch(u, packed, sketch, error) < 0){
+			if(error.empty()){
+				error = "could not pack EEPROM image";
+			}
+			return -1;
+		}
+		f = fopen(filename.c_str(), "w");
+		if(!f || fwrite(sketch.data(), 1, sketch.size(), f) != sketch.size()){
+			error = filename + ": " + strerror(errno);
+			if(f){
+				fclose(f);
+			}
+			return -1;
+		}
+		if(fclose(f)){
+			error = filename + ": " + strerror(errno);
+			return -1;
+		}
+		return 0;
+	}
+
+	if(ihex_write(filename.c_str(), records) < 0){
+		error = "could not write " + filename;
+		return -1;
+	}
+
+	return 0;
+}
+
+static void usage(const char *cmd){
+	printf("Generate EEPROM images (or picprog sketches) for a table of STC-1000+ units.\n");
+	printf("Usage: %s [-f hex|ino] [-o outdir (default=.)] [-s sketchdir (default=..)] [-j jobs] [-c] table\n", cmd);
+	printf("  -f  output Intel HEX EEPROM images (name.hex) or sketches (name.ino)\n");
+	printf("  -o  directory for the generated files\n");
+	printf("  -s  directory of the prebuilt picprog*.ino sketches (for -f ino)\n");
+	printf("  -j  number of parallel jobs (default=number of cores)\n");
+	printf("  -c  only check the table, do not generate anything\n");
+	printf("Table lines: name variant C|F [item=value ...] [PrN=SP0,dh0,...,SP9 ...]\n");
+}
+
+int main(int argc, char *argv[]){
+	std::vector<unit> units;
+	std::vector<std::string> errors;
+	std::vector<std::thread> workers;
+	std::atomic<size_t> next(0);
+	std::atomic<int> failed(0);
+	unsigned int jobs = std::thread::hardware_concurrency();
+	int check = 0;
+	size_t i;
+	int c;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "f:o:s:j:c")) != -1) {
+		switch(c) {
+			case 'f':
+				format = optarg;
+				break;
+			case 'o':
+				outdir = optarg;
+				break;
+			case 's':
+				sketchdir = optarg;
+				break;
+			case 'j':
+				jobs = atoi(optarg);
+				break;
+			case 'c':
+				check = 1;
+				break;
+			case '?':
+				if (optopt == 'f' || optopt == 'o' || optopt == 's' || optopt == 'j'){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc-1 || (strcmp(format, "hex") && strcmp(format, "ino"))){
+		usage(argv[0]);
+		return 1;
+	}
+
+	/* Validate everything before writing anything */
+	if(read_units(argv[optind], units)){
+		return 1;
+	}
+
+	if(check){
+		printf("%zu units OK\n", units.size());
+		return 0;
+	}
+
+	if(!strcmp(format, "ino")){
+		for(i=0; i<units.size(); i++){
+			if(!sketches.count(units[i].variant) && read_sketch(units[i].variant) < 0){
+				return 1;
+			}
+		}
+	}
+
+	if(jobs < 1){
+		jobs = 1;
+	}
+	if(jobs > units.size()){
+		jobs = units.size();
+	}
+
+	errors.resize(units.size());
+	for(i=0; i<jobs; i++){
+		workers.push_back(std::thread([&](){
+			size_t n;
+			while((n = next++) < units.size()){
+				if(generate(units[n], errors[n]) < 0){
+					failed++;
+				}
+			}
+		}));
+	}
+	for(i=0; i<workers.size(); i++){
+		workers[i].join();
+	}
+
+	for(i=0; i<units.size(); i++){
+		if(!errors[i].empty()){
+			fprintf(stderr, "%s: %s\n", units[i].name.c_str(), errors[i].c_str());
+		}
+	}
+	printf("%zu of %zu units written to %s\n", units.size() - failed, units.size(), outdir);
+
+	return failed ? 1 : 0;
+}
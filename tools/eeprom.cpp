@@ -0,0 +1,445 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+#include "eeprom.h"
+
+#define MENU(m)		m, sizeof(m)/sizeof(m[0])
+
+/* DEFAULT_SP, DEFAULT_hy, DEFAULT_hy2, DEFAULT_PP */
+#define SP_DEFAULTS		200, 680
+#define HY_DEFAULTS		5, 10
+#define HY2_DEFAULTS	50, 100
+#define PP_DEFAULTS		20, 40
+
+static const ee_menu_item menu_standard[] = {
+	{ "SP",		ee_temperature,	SP_DEFAULTS },
+	{ "hy",		ee_hyst_1,		HY_DEFAULTS },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "SA",		ee_sp_alarm,	0, 0 },
+	{ "St",		ee_step,		0, 0 },
+	{ "dh",		ee_duration,	0, 0 },
+	{ "cd",		ee_delay,		5, 5 },
+	{ "hd",		ee_delay,		2, 2 },
+	{ "rP",		ee_boolean,		0, 0 },
+	{ "rn",		ee_runmode,		6, 6 },
+};
+
+static const ee_menu_item menu_pb2[] = {
+	{ "SP",		ee_temperature,	SP_DEFAULTS },
+	{ "hy",		ee_hyst_1,		HY_DEFAULTS },
+	{ "hy2",	ee_hyst_2,		HY2_DEFAULTS },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "tc2",	ee_tempdiff,	0, 0 },
+	{ "SA",		ee_sp_alarm,	0, 0 },
+	{ "St",		ee_step,		0, 0 },
+	{ "dh",		ee_duration,	0, 0 },
+	{ "cd",		ee_delay,		5, 5 },
+	{ "hd",		ee_delay,		2, 2 },
+	{ "rP",		ee_boolean,		0, 0 },
+	{ "Pb",		ee_boolean,		0, 0 },
+	{ "rn",		ee_runmode,		6, 6 },
+};
+
+/* PID builds, with one profile less (THERMOSTAT_MODE is 5) */
+static const ee_menu_item menu_standard_pid[] = {
+	{ "SP",		ee_temperature,	SP_DEFAULTS },
+	{ "hy",		ee_hyst_1,		HY_DEFAULTS },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "SA",		ee_sp_alarm,	0, 0 },
+	{ "St",		ee_step,		0, 0 },
+	{ "dh",		ee_duration,	0, 0 },
+	{ "cd",		ee_delay,		5, 5 },
+	{ "hd",		ee_delay,		2, 2 },
+	{ "rP",		ee_boolean,		0, 0 },
+	{ "PP",		ee_pid_band,	PP_DEFAULTS },
+	{ "PI",		ee_duration,	30, 30 },
+	{ "Pd",		ee_duration,	0, 0 },
+	{ "Pc",		ee_pid_window,	600, 600 },
+	{ "rn",		ee_runmode,		5, 5 },
+};
+
+static const ee_menu_item menu_pb2_pid[] = {
+	{ "SP",		ee_temperature,	SP_DEFAULTS },
+	{ "hy",		ee_hyst_1,		HY_DEFAULTS },
+	{ "hy2",	ee_hyst_2,		HY2_DEFAULTS },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "tc2",	ee_tempdiff,	0, 0 },
+	{ "SA",		ee_sp_alarm,	0, 0 },
+	{ "St",		ee_step,		0, 0 },
+	{ "dh",		ee_duration,	0, 0 },
+	{ "cd",		ee_delay,		5, 5 },
+	{ "hd",		ee_delay,		2, 2 },
+	{ "rP",		ee_boolean,		0, 0 },
+	{ "Pb",		ee_boolean,		0, 0 },
+	{ "PP",		ee_pid_band,	PP_DEFAULTS },
+	{ "PI",		ee_duration,	30, 30 },
+	{ "Pd",		ee_duration,	0, 0 },
+	{ "Pc",		ee_pid_window,	600, 600 },
+	{ "rn",		ee_runmode,		5, 5 },
+};
+
+/* COM with the history log, two profiles (THERMOSTAT_MODE is 2) and the log after the menu */
+static const ee_menu_item menu_com_log[] = {
+	{ "SP",		ee_temperature,	SP_DEFAULTS },
+	{ "hy",		ee_hyst_1,		HY_DEFAULTS },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "SA",		ee_sp_alarm,	0, 0 },
+	{ "St",		ee_step,		0, 0 },
+	{ "dh",		ee_duration,	0, 0 },
+	{ "cd",		ee_delay,		5, 5 },
+	{ "hd",		ee_delay,		2, 2 },
+	{ "rP",		ee_boolean,		0, 0 },
+	{ "Li",		ee_duration,	15, 15 },
+	{ "rn",		ee_runmode,		2, 2 },
+};
+
+static const ee_menu_item menu_fo433[] = {
+	{ "SP",		ee_temperature,	SP_DEFAULTS },
+	{ "hy",		ee_hyst_1,		HY_DEFAULTS },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "dI",		ee_deviceid,	0, 0 },
+	{ "tr",		ee_fo433_tx,	1, 1 },
+	{ "SA",		ee_sp_alarm,	0, 0 },
+	{ "St",		ee_step,		0, 0 },
+	{ "dh",		ee_duration,	0, 0 },
+	{ "cd",		ee_delay,		5, 5 },
+	{ "hd",		ee_delay,		2, 2 },
+	{ "rP",		ee_boolean,		0, 0 },
+	{ "rn",		ee_runmode,		6, 6 },
+};
+
+static const ee_menu_item menu_ovbsc[] = {
+	{ "Sd",		ee_duration,	0, 0 },
+	{ "St",		ee_temperature,	670, 153 },
+	{ "SO",		ee_percentage,	150, 150 },
+	{ "Pt1",	ee_temperature,	660, 149 },
+	{ "Pd1",	ee_duration,	15, 15 },
+	{ "Pt2",	ee_temperature,	660, 149 },
+	{ "Pd2",	ee_duration,	30, 30 },
+	{ "Pt3",	ee_temperature,	660, 149 },
+	{ "Pd3",	ee_duration,	15, 15 },
+	{ "Pt4",	ee_temperature,	660, 149 },
+	{ "Pd4",	ee_duration,	0, 0 },
+	{ "Pt5",	ee_temperature,	660, 149 },
+	{ "Pd5",	ee_duration,	0, 0 },
+	{ "Pt6",	ee_temperature,	660, 149 },
+	{ "Pd6",	ee_duration,	0, 0 },
+	{ "PO",		ee_percentage,	50, 50 },
+	{ "Ht",		ee_temperature,	985, 985 },
+	{ "HO",		ee_percentage,	75, 75 },
+	{ "Hd",		ee_duration,	15, 15 },
+	{ "bO",		ee_percentage,	150, 150 },
+	{ "bd",		ee_duration,	90, 90 },
+	{ "hd1",	ee_duration,	60, 60 },
+	{ "hd2",	ee_duration,	45, 45 },
+	{ "hd3",	ee_duration,	15, 15 },
+	{ "hd4",	ee_duration,	5, 5 },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "APF",	ee_apflags,		511, 511 },
+	{ "PF",		ee_pumpflags,	6, 6 },
+	{ "Pd",		ee_period,		50, 50 },
+	{ "cO",		ee_percentage,	80, 80 },
+	{ "cP",		ee_boolean,		0, 0 },
+	{ "cSP",	ee_temperature,	0, 0 },
+	{ "ASd",	ee_duration,	70, 70 },
+};
+
+static const ee_menu_item menu_rh[] = {
+	{ "r0",		ee_rh,			100, 100 },
+	{ "r5",		ee_rh,			100, 100 },
+	{ "r10",	ee_rh,			84, 84 },
+	{ "r15",	ee_rh,			76, 76 },
+	{ "r20",	ee_rh,			73, 73 },
+	{ "r25",	ee_rh,			72, 72 },
+	{ "r30",	ee_rh,			71, 71 },
+	{ "r35",	ee_rh,			72, 72 },
+	{ "r40",	ee_rh,			77, 77 },
+	{ "r45",	ee_rh,			100, 100 },
+	{ "r50",	ee_rh,			100, 100 },
+	{ "don",	ee_duration,	24, 24 },
+	{ "dff",	ee_duration,	6, 6 },
+	{ "tc",		ee_tempdiff,	0, 0 },
+	{ "rhc",	ee_rhdiff,		0, 0 },
+	{ "Srt",	ee_show_r_t,	3, 3 },
+};
+
+static const ee_variant variants[] = {
+	{ "vanilla",		"",					6, MENU(menu_standard),			0, 0, 0 },
+	{ "probe2",			"_probe2",			6, MENU(menu_pb2),				0, 0, 0 },
+	{ "com",			"_com",				6, MENU(menu_standard),			1, 0, 0 },
+	{ "fo433",			"_fo433",			6, MENU(menu_fo433),			0, 0, 0 },
+	{ "minute",			"_minute",			6, MENU(menu_standard),			0, 0, 0 },
+	{ "minute_probe2",	"_minute_probe2",	6, MENU(menu_pb2),				0, 0, 0 },
+	{ "minute_com",		"_minute_com",		6, MENU(menu_standard),			1, 0, 0 },
+	{ "minute_fo433",	"_minute_fo433",	6, MENU(menu_fo433),			0, 0, 0 },
+	{ "pid",			"_pid",				5, MENU(menu_standard_pid),		0, 0, EE_LAYOUT_PID },
+	{ "probe2_pid",		"_probe2_pid",		5, MENU(menu_pb2_pid),			0, 0, EE_LAYOUT_PID },
+	{ "minute_pid",		"_minute_pid",		5, MENU(menu_standard_pid),		0, 0, EE_LAYOUT_PID },
+	{ "com_log",		"_com_log",			2, MENU(menu_com_log),			1, 0, EE_LAYOUT_LOG },
+	{ "packed",			"_packed",			10, MENU(menu_standard),		0, 1, EE_LAYOUT_PACKED },
+	{ "com_packed",		"_com_packed",		10, MENU(menu_standard),		1, 1, EE_LAYOUT_PACKED },
+	{ "ovbsc",			"_ovbsc",			0, MENU(menu_ovbsc),			0, 0, 0 },
+	{ "rh",				"_rh",				0, MENU(menu_rh),				0, 0, 0 },
+};
+
+/* Pr0 (SP0, dh0, ..., dh8, SP9), same for all profiles and both scales */
+static const int default_profile[EE_PROFILE_SIZE] = {
+	160, 24, 170, 24, 180, 24, 190, 24, 200, 144, 250, 48, 40, 0, 0, 0, 0, 0, 0
+};
+
+const ee_variant *ee_find_variant(const char *name){
+	unsigned char i;
+
+	for(i=0; i<sizeof(variants)/sizeof(variants[0]); i++){
+		if(!strcmp(variants[i].name, name)){
+			return &variants[i];
+		}
+	}
+	return NULL;
+}
+
+int ee_find_menu_item(const ee_variant *v, const char *name){
+	unsigned char i;
+
+	for(i=0; i<v->menu_size; i++){
+		if(!strcmp(v->menu[i].name, name)){
+			return i;
+		}
+	}
+	return -1;
+}
+
+unsigned char ee_menu_address(const ee_variant *v, unsigned char item){
+	return (v->packed ? EE_PROFILE_WORDS : v->profiles * EE_PROFILE_SIZE) + item;
+}
+
+unsigned char ee_address_type(const ee_variant *v, unsigned char eeadr){
+	if(eeadr < ee_menu_address(v, 0)){
+		/* The step records of packed profiles have no type of their own */
+		return (v->packed || ((eeadr % EE_PROFILE_SIZE) & 0x1)) ? ee_duration : ee_temperature;
+	}
+	return v->menu[eeadr - ee_menu_address(v, 0)].type;
+}
+
+void ee_limits(const ee_variant *v, unsigned char type, int fahrenheit, int *t_min, int *t_max){
+	*t_min = 0;
+	*t_max = 999;
+
+	switch(type){
+		case ee_temperature:
+			*t_min = -400;
+			*t_max = fahrenheit ? 2500 : 1400;
+			break;
+		case ee_tempdiff:
+			*t_min = fahrenheit ? -100 : -50;
+			*t_max = fahrenheit ? 100 : 50;
+			break;
+		case ee_hyst_1:
+			*t_max = fahrenheit ? 100 : 50;
+			break;
+		case ee_hyst_2:
+			*t_max = fahrenheit ? 500 : 250;
+			break;
+		case ee_sp_alarm:
+			*t_min = fahrenheit ? -800 : -400;
+			*t_max = fahrenheit ? 800 : 400;
+			break;
+		case ee_deviceid:
+			*t_max = 15;
+			break;
+		case ee_fo433_tx:
+			*t_max = 2;
+			break;
+		case ee_step:
+			*t_max = 8;
+			break;
+		case ee_delay:
+			*t_max = 60;
+			break;
+		case ee_runmode:
+			/* th, or At (autotune) in PID builds, which have one profile less */
+			*t_max = v->packed ? v->profiles : 6;
+			break;
+		case ee_boolean:
+			*t_max = 1;
+			break;
+		case ee_percentage:
+			*t_min = -200;
+			*t_max = 200;
+			break;
+		case ee_period:
+			*t_min = 10;
+			*t_max = 200;
+			break;
+		case ee_apflags:
+			*t_max = 511;
+			break;
+		case ee_pumpflags:
+			*t_max = 31;
+			break;
+		case ee_rh:
+			*t_max = 100;
+			break;
+		case ee_rhdiff:
+			*t_min = -10;
+			*t_max = 10;
+			break;
+		case ee_show_r_t:
+			*t_max = 3;
+			break;
+		case ee_pid_band:
+			*t_min = 1;
+			*t_max = fahrenheit ? 500 : 250;
+			break;
+		case ee_pid_window:
+			*t_min = 10;
+			break;
+	}
+}
+
+int ee_type_has_decimal(unsigned char type){
+	return type <= ee_sp_alarm || type == ee_period || type == ee_pid_band;
+}
+
+void ee_default_steps(const ee_variant *v, std::vector<int> &steps){
+	unsigned char i;
+
+	steps.resize(v->profiles * EE_PROFILE_SIZE);
+	for(i=0; i<steps.size(); i++){
+		steps[i] = default_profile[i % EE_PROFILE_SIZE];
+	}
+}
+
+int ee_pack_profiles(const ee_variant *v, const std::vector<int> &steps, std::vector<int> &values){
+	unsigned char profile, step;
+	int adr = 0, i;
+
+	for(profile=0; profile<v->profiles; profile++){
+		int base = 0;
+		for(step=0; step<10; step++){
+			int sp = steps[profile * EE_PROFILE_SIZE + (step << 1)];
+			int dur = (step < 9) ? steps[profile * EE_PROFILE_SIZE + (step << 1) + 1] : 0;
+
+			if(sp - base >= -64 && sp - base < 64 && dur < 256){
+				if(adr + 1 > EE_PROFILE_WORDS){
+					return -1;
+				}
+				values[adr++] = 0x8000 | (((sp - base) & 0x7f) << 8) | dur;
+			} else {
+				if(adr + 2 > EE_PROFILE_WORDS){
+					return -1;
+				}
+				values[adr++] = sp & 0x7fff;
+				values[adr++] = dur;
+			}
+			base = sp;
+			if(dur == 0){
+				break;
+			}
+		}
+	}
+	/* The rest is free, and not part of the image */
+	for(i=adr; i<EE_PROFILE_WORDS; i++){
+		values[i] = EE_UNUSED;
+	}
+	return adr;
+}
+
+void ee_defaults(const ee_variant *v, int fahrenheit, std::vector<int> &values){
+	unsigned char i, adr = 0;
+
+	values.assign(EE_SIZE, EE_UNUSED);
+
+	if(v->packed){
+		std::vector<int> steps;
+		ee_default_steps(v, steps);
+		ee_pack_profiles(v, steps, values);
+		adr = EE_PROFILE_WORDS;
+	} else {
+		for(i=0; i<v->profiles * EE_PROFILE_SIZE; i++){
+			values[adr++] = default_profile[i % EE_PROFILE_SIZE];
+		}
+	}
+	for(i=0; i<v->menu_size; i++){
+		values[adr++] = fahrenheit ? v->menu[i].default_fahrenheit : v->menu[i].default_celsius;
+	}
+	if(v->packed){
+		/* rn is th, after the last profile */
+		values[ee_menu_address(v, ee_find_menu_item(v, "rn"))] = v->profiles;
+	}
+
+	/* Power on, and layout version for migration at start up */
+	if(v->profiles){
+		values[EE_POWER_ON] = ((EE_LAYOUT_VERSION | v->layout) << 8) | 1;
+	}
+	if(v->com){
+		values[EE_CLOCK_TICKS] = EE_CLOCK_TICKS_PER_HOUR;
+	}
+}
+
+void ee_records(const std::vector<int> &values, std::vector<ihex_record> &records){
+	ihex_record r;
+	unsigned char i;
+
+	/* Extended address 0 and 1, as written by gplink */
+	r.bytecount = 2;
+	r.address = 0;
+	r.type = IHEX_EXT_LIN_ADDR;
+	r.data[0] = 0;
+	r.data[1] = 0;
+	records.push_back(r);
+	r.data[1] = 1;
+	records.push_back(r);
+
+	/* Each EEPROM byte is a RETLW (0x34xx) word, config values are little endian ints */
+	r.bytecount = 0;
+	r.address = EE_HEX_ADDRESS;
+	r.type = IHEX_DATA;
+	for(i=0; i<EE_SIZE; i++){
+		if(values[i] == EE_UNUSED){
+			if(r.bytecount){
+				records.push_back(r);
+			}
+			r.address = EE_HEX_ADDRESS + ((i + 1) << 2);
+			r.bytecount = 0;
+			continue;
+		}
+		r.data[r.bytecount++] = values[i] & 0xff;
+		r.data[r.bytecount++] = 0x34;
+		r.data[r.bytecount++] = (values[i] >> 8) & 0xff;
+		r.data[r.bytecount++] = 0x34;
+		if(r.bytecount == IHEX_MAX_DATA){
+			records.push_back(r);
+			r.address += r.bytecount;
+			r.bytecount = 0;
+		}
+	}
+	if(r.bytecount){
+		records.push_back(r);
+	}
+
+	r.bytecount = 0;
+	r.address = 0;
+	r.type = IHEX_EOF;
+	records.push_back(r);
+}
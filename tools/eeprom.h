@@ -0,0 +1,132 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * EEPROM layout of the firmware variants, for building EEPROM images on the host.
+ *
+ * The menu tables mirror MENU_DATA in src/stc1000p.h, the limits mirror
+ * check_config_value() in src/page1.c and the default profiles mirror
+ * src/eepromdata.c. Keep them in sync when the firmware changes.
+ *
+ */
+
+#ifndef _EEPROM_H_
+#define _EEPROM_H_
+
+#include <vector>
+#include "ihex.h"
+
+/* Types of the menu items (e_item_type in stc1000p.h, for all variants) */
+enum ee_item_type {
+	ee_temperature=0,
+	ee_tempdiff,
+	ee_hyst_1,
+	ee_hyst_2,
+	ee_sp_alarm,
+	ee_deviceid,
+	ee_fo433_tx,
+	ee_step,
+	ee_delay,
+	ee_runmode,
+	ee_duration,
+	ee_boolean,
+	ee_percentage,
+	ee_period,
+	ee_apflags,
+	ee_pumpflags,
+	ee_rh,
+	ee_rhdiff,
+	ee_show_r_t,
+	ee_pid_band,
+	ee_pid_window
+};
+
+struct ee_menu_item {
+	const char *name;
+	unsigned char type;
+	int default_celsius;
+	int default_fahrenheit;
+};
+
+struct ee_variant {
+	const char *name;				/* as in build.sh (vanilla, probe2, ...) */
+	const char *suffix;				/* of the HEX files and sketches (_probe2, ...) */
+	unsigned char profiles;			/* number of profiles before the menu data */
+	const ee_menu_item *menu;
+	unsigned char menu_size;
+	int com;						/* COM firmware, with the clock calibration (EE_CLOCK_TICKS) */
+	int packed;						/* profiles as step records in EE_PROFILE_WORDS (see ee_pack_profiles()) */
+	unsigned char layout;			/* EEPROM_LAYOUT_VARIANT, the family in the layout version */
+};
+
+#define EE_PROFILE_SIZE			19	/* SP0, dh0, ..., dh8, SP9 */
+#define EE_PROFILE_WORDS		114	/* config values before the menu data, with packed profiles */
+#define EE_SIZE					128	/* config values (ints) that fit the EEPROM */
+#define EE_HEX_ADDRESS			0xE000	/* byte address of EEPROM in HEX files (ext. address 1) */
+#define EE_UNUSED				0x10000	/* config value not part of the image */
+
+#define EE_LAYOUT_VERSION		14		/* STC1000P_EEPROM_VERSION */
+#define EE_LAYOUT_PACKED		0x40	/* EEPROM_LAYOUT_VARIANT with PACKED */
+#define EE_LAYOUT_PID			0x80	/* EEPROM_LAYOUT_VARIANT with PID */
+#define EE_LAYOUT_LOG			0xc0	/* EEPROM_LAYOUT_VARIANT with LOG */
+#define EE_POWER_ON				127		/* EEADR_POWER_ON, with layout version in high byte */
+#define EE_CLOCK_TICKS			126		/* EEADR_CLOCK_TICKS (COM), 60ms ticks in an hour */
+#define EE_CLOCK_TICKS_PER_HOUR	60000	/* CLOCK_TICKS_PER_HOUR, no calibration */
+
+/* Find variant by name.
+ * return: the variant, or NULL if unknown
+ */
+const ee_variant *ee_find_variant(const char *name);
+
+/* Find menu item by name.
+ * return: index of the item, or -1 if unknown
+ */
+int ee_find_menu_item(const ee_variant *v, const char *name);
+
+/* EEPROM address of the menu item */
+unsigned char ee_menu_address(const ee_variant *v, unsigned char item);
+
+/* Type of the config value at EEPROM address (setpoints and durations in profiles included) */
+unsigned char ee_address_type(const ee_variant *v, unsigned char eeadr);
+
+/* Limits of a config value type (as check_config_value()) */
+void ee_limits(const ee_variant *v, unsigned char type, int fahrenheit, int *t_min, int *t_max);
+
+/* Values with one decimal (entered as 18.5, stored as 185) */
+int ee_type_has_decimal(unsigned char type);
+
+/* Fill values (EE_SIZE) with the defaults of eepromdata.c, EE_UNUSED where not defined */
+void ee_defaults(const ee_variant *v, int fahrenheit, std::vector<int> &values);
+
+/* Fill steps with the default profiles (SP0, dh0, ..., dh8, SP9 of each profile) */
+void ee_default_steps(const ee_variant *v, std::vector<int> &steps);
+
+/* Encode the profiles of a packed variant into the step records at the start
+ * of values (as PROFILE_SHORT and PROFILE_LONG in src/stc1000p.h). A profile
+ * ends at the first duration of 0, the values after it are not stored.
+ * return: config values used, or -1 if they do not fit EE_PROFILE_WORDS
+ */
+int ee_pack_profiles(const ee_variant *v, const std::vector<int> &steps, std::vector<int> &values);
+
+/* Build HEX records for all values that are not EE_UNUSED, in the same
+ * layout as the eedata_*.hex files built from eepromdata.c.
+ */
+void ee_records(const std::vector<int> &values, std::vector<ihex_record> &records);
+
+#endif // _EEPROM_H_
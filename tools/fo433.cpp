@@ -0,0 +1,126 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "fo433.h"
+
+/* CRC-8 of every byte value, built on first use */
+static unsigned char crc_table[256];
+static int crc_table_done = 0;
+
+static void crc_init(){
+	unsigned int i;
+
+	for(i=0; i<256; i++){
+		unsigned char crc = i, j;
+		for(j=0; j<8; j++){
+			crc = (crc & 0x80) ? (crc << 1) ^ 0x31 : (crc << 1);
+		}
+		crc_table[i] = crc;
+	}
+	crc_table_done = 1;
+}
+
+unsigned char fo433_crc(const unsigned char *data, unsigned int len){
+	unsigned char crc = 0;
+
+	if(!crc_table_done){
+		crc_init();
+	}
+	while(len--){
+		crc = crc_table[crc ^ *data++];
+	}
+	return crc;
+}
+
+void fo433_init(fo433_decoder *d){
+	d->time = 0;
+	d->bits = 0;
+	d->nbits = 0;
+	d->pulses = d->frames = d->crc_errors = 0;
+	if(!crc_table_done){
+		crc_init();
+	}
+}
+
+/* Check the last FO433_FRAME_BITS bits for a frame */
+static int frame_check(fo433_decoder *d, fo433_frame *f){
+	unsigned long long b = d->bits;
+	unsigned char data[5];
+	int i, t;
+
+	// Preamble, and the fixed nibble of the device ID
+	if(((b >> 40) & 0xff) != 0xff || ((b >> 36) & 0xf) != 0x4){
+		return 0;
+	}
+	for(i=0; i<5; i++){
+		data[i] = b >> ((4 - i) << 3);
+	}
+	if((data[0] & 0xf) != 0x5 && (data[0] & 0xf) != 0x6){
+		return 0;
+	}
+	if(crc_table[crc_table[crc_table[crc_table[data[0]] ^ data[1]] ^ data[2]] ^ data[3]] != data[4]){
+		d->crc_errors++;
+		return 0;
+	}
+
+	t = ((data[1] & 0xf) << 8) | data[2];
+	f->time = d->time;
+	f->id = (data[0] << 4) | (data[1] >> 4);
+	f->device = data[1] >> 4;
+	f->extended = (data[0] & 0xf) == 0x6;
+	f->temperature = (t ^ 0x800) - 0x800;
+	f->heating = (data[3] >> 6) & 1;
+	f->cooling = (data[3] >> 4) & 1;
+	f->run_mode = data[3] >> 4;
+	f->step = data[3] & 0xf;
+	d->frames++;
+	return 1;
+}
+
+int fo433_pulse(fo433_decoder *d, unsigned int mark, unsigned int space, fo433_frame *f){
+	int found = 0;
+
+	d->pulses++;
+	d->time += mark;
+
+	if(mark >= FO433_MARK_MIN && mark <= FO433_MARK_MAX){
+		d->bits = (d->bits << 1) | (mark < FO433_MARK_SPLIT);
+		if(d->nbits < FO433_FRAME_BITS){
+			d->nbits++;
+		}
+		if(d->nbits == FO433_FRAME_BITS && frame_check(d, f)){
+			// Start over after it, the next frame has its own preamble
+			d->nbits = 0;
+			found = 1;
+		}
+	} else {
+		d->nbits = 0;
+	}
+
+	// A space out of range ends what has been received
+	if(space < FO433_SPACE_MIN || space > FO433_SPACE_MAX){
+		d->nbits = 0;
+	}
+	d->time += space;
+
+	return found;
+}
@@ -0,0 +1,84 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *
+ * Decoder for the Fine Offset frames sent by the FO433 firmware, from the
+ * pulse timing of a 433MHz receiver.
+ *
+ * The timing mirrors the timer 0 interrupt in src/page0.c (FOSC/4 with
+ * prescale 8, so 8us per count), and the frame mirrors fo433_fsm(): the
+ * preamble 0xff, then 0x45 (0x46 for the extended frame), dI << 4 and
+ * the 12 bit temperature (setpoint), the relays (run mode << 4 | step)
+ * and a CRC-8 (polynomial 0x31) of the 4 bytes after the preamble. Each
+ * bit is a mark, short for 1 and long for 0, followed by a space.
+ * Keep them in sync when the firmware changes.
+ *
+ */
+
+#ifndef _FO433_H_
+#define _FO433_H_
+
+#define FO433_TICK_US		8							/* Timer 0 count */
+#define FO433_MARK_1		((256 - 193) * FO433_TICK_US)	/* 504us */
+#define FO433_MARK_0		((256 - 67) * FO433_TICK_US)	/* 1512us */
+#define FO433_SPACE			((256 - 130) * FO433_TICK_US)	/* 1008us */
+
+/* Accepted timing. Bytes are started from the main loop, which may hold
+ * up the space after the last bit of a byte by a few milliseconds.
+ */
+#define FO433_MARK_MIN		(FO433_MARK_1 / 2)
+#define FO433_MARK_SPLIT	((FO433_MARK_1 + FO433_MARK_0) / 2)
+#define FO433_MARK_MAX		(FO433_MARK_0 + FO433_MARK_0 / 2)
+#define FO433_SPACE_MIN		(FO433_SPACE / 2)
+#define FO433_SPACE_MAX		20000
+
+#define FO433_FRAME_BITS	48
+
+/* A decoded frame */
+struct fo433_frame {
+	unsigned long long time;		/* us from the start of the capture, at the end of the frame */
+	unsigned char id;				/* 0x50 | dI, or 0x60 | dI for the extended frame */
+	unsigned char device;			/* dI */
+	unsigned char extended;
+	int temperature;				/* 0.1 degrees, the setpoint in the extended frame */
+	unsigned char heating, cooling;
+	unsigned char run_mode, step;	/* extended frame */
+};
+
+/* Decoder state, one per pulse stream */
+struct fo433_decoder {
+	unsigned long long time;		/* us */
+	unsigned long long bits;		/* the last nbits bits received, newest in bit 0 */
+	unsigned char nbits;
+	unsigned long pulses, frames, crc_errors;
+};
+
+/* CRC-8, polynomial 0x31, initial value 0 (as in fo433_fsm()) */
+unsigned char fo433_crc(const unsigned char *data, unsigned int len);
+
+/* Reset a decoder (and its time and counters) */
+void fo433_init(fo433_decoder *d);
+
+/* Decode a pulse, a mark followed by a space (us).
+ * return: 1 when it completed a frame (with a valid CRC) in *f, else 0
+ */
+int fo433_pulse(fo433_decoder *d, unsigned int mark, unsigned int space, fo433_frame *f);
+
+#endif // _FO433_H_
@@ -0,0 +1,196 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Decode the transmissions of FO433 firmware units from a pulse capture of
+ * a 433MHz receiver, one mark and space (in us) per line, as in the OOK
+ * pulse files of rtl_433 (lines starting with ';' or '#' are skipped).
+ * The capture is read in blocks and decoded as it is read, so there is
+ * no limit on its length.
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "fo433.h"
+
+#define READ_SIZE		65536
+#define REPEAT_US		5000000ULL		/* Frames repeated within this are the same transmission */
+
+/* The last frame from each ID, to drop the repeats */
+struct last_frame {
+	int seen;
+	unsigned long long time;
+	int temperature;
+	unsigned char payload;
+};
+
+static unsigned char buf[READ_SIZE];
+static last_frame last[256];
+
+static void usage(const char *cmd){
+	printf("Decode the transmissions of STC-1000+ FO433 firmware from a 433MHz pulse capture.\n");
+	printf("Usage: %s [-a] file\n", cmd);
+	printf("  -a  print every frame (default is once per transmission, without the repeats)\n");
+	printf("file has one pulse per line, mark and space in us (rtl_433 OOK pulse data).\n");
+	printf("'-' reads standard input.\n");
+}
+
+static void print_temperature(int t){
+	printf("%s%d.%d", t < 0 ? "-" : "", abs(t) / 10, abs(t) % 10);
+}
+
+static void print_frame(const fo433_frame &f){
+	printf("%llu.%03llu\t%u\t%c\t", f.time / 1000000, (f.time / 1000) % 1000, f.device, f.extended ? 's' : 't');
+	print_temperature(f.temperature);
+	if(f.extended){
+		printf("\t%u\t%u\n", f.run_mode, f.step);
+	} else {
+		printf("\t%u\t%u\n", f.heating, f.cooling);
+	}
+}
+
+/* A repeat of the last frame from the same ID? Else remember it. */
+static int repeated(const fo433_frame &f){
+	last_frame &l = last[f.id];
+	unsigned char payload = (f.run_mode << 4) | f.step;
+	int r = l.seen && f.time - l.time < REPEAT_US && l.temperature == f.temperature && l.payload == payload;
+
+	l.seen = 1;
+	l.time = f.time;
+	l.temperature = f.temperature;
+	l.payload = payload;
+	return r;
+}
+
+/* Pulse line parser, fed a character at a time */
+struct parser {
+	unsigned int values[2];
+	unsigned char nvalues, digits, skip, start;
+};
+
+static fo433_decoder decoder;
+static unsigned long records = 0;
+static int all = 0;
+
+static void parse(parser &ps, unsigned char ch){
+	if(ch == '\n'){
+		fo433_frame f;
+		if(ps.digits && ps.nvalues < 2){
+			ps.nvalues++;
+		}
+		if(!ps.skip && ps.nvalues == 2 && fo433_pulse(&decoder, ps.values[0], ps.values[1], &f)){
+			if(all || !repeated(f)){
+				print_frame(f);
+				records++;
+			}
+		}
+		ps.values[0] = ps.values[1] = 0;
+		ps.nvalues = ps.digits = ps.skip = 0;
+		ps.start = 1;
+	} else if(ps.skip){
+		return;
+	} else if(ch >= '0' && ch <= '9'){
+		if(ps.nvalues < 2 && ps.values[ps.nvalues] < 100000000){
+			ps.values[ps.nvalues] = ps.values[ps.nvalues] * 10 + (ch - '0');
+		}
+		ps.digits = 1;
+		ps.start = 0;
+	} else if(ps.start && (ch == ';' || ch == '#')){
+		ps.skip = 1;
+	} else {
+		if(ps.digits && ps.nvalues < 2){
+			ps.nvalues++;
+		}
+		ps.digits = 0;
+		if(ch != ' ' && ch != '\t' && ch != '\r'){
+			// Not a pulse line
+			ps.skip = 1;
+		}
+	}
+}
+
+int main(int argc, char *argv[]){
+	parser ps = { { 0, 0 }, 0, 0, 0, 1 };
+	int c;
+	size_t n;
+	FILE *in;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "a")) != -1) {
+		switch(c) {
+			case 'a':
+				all = 1;
+				break;
+			case '?':
+				if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc-1){
+		usage(argv[0]);
+		return 1;
+	}
+
+	in = strcmp(argv[optind], "-") ? fopen(argv[optind], "rb") : stdin;
+	if(!in){
+		perror(argv[optind]);
+		return 1;
+	}
+
+	fo433_init(&decoder);
+	memset(last, 0, sizeof(last));
+
+	printf("# seconds\tdevice\tframe\ttemperature\theating\tcooling\t(frame s: setpoint\trun mode\tstep)\n");
+
+	while((n = fread(buf, 1, sizeof(buf), in)) > 0){
+		const unsigned char *p = buf, *end = buf + n;
+		while(p < end){
+			parse(ps, *p++);
+		}
+	}
+	// A last line without a line end
+	parse(ps, '\n');
+
+	if(ferror(in)){
+		perror(argv[optind]);
+	}
+	if(in != stdin){
+		fclose(in);
+	}
+
+	fprintf(stderr, "%lu pulses, %lu frames (%lu printed), %lu CRC errors\n", decoder.pulses, decoder.frames, records, decoder.crc_errors);
+
+	return 0;
+}
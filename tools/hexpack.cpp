@@ -0,0 +1,168 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <map>
+#include <vector>
+#include "ihex.h"
+#include "pack.h"
+
+/* Flatten records to a map of (extended address << 16 | address) -> data byte */
+static void flatten(const std::vector<ihex_record> &records, std::map<unsigned long, unsigned char> &mem){
+	unsigned long ext = 0;
+	size_t i;
+
+	for(i=0; i<records.size(); i++){
+		const ihex_record &r = records[i];
+		unsigned char j;
+		if(r.type == IHEX_EXT_LIN_ADDR){
+			ext = ((unsigned long) r.data[0] << 8) | r.data[1];
+		} else if(r.type == IHEX_DATA){
+			for(j=0; j<r.bytecount; j++){
+				mem[(ext << 16) + r.address + j] = r.data[j];
+			}
+		}
+	}
+}
+
+/* Program memory of the PIC16F1828 (4096 words) in HEX byte addresses */
+#define PROGRAM_BYTES	0x2000
+
+static void usage(const char *cmd){
+	printf("Pack an Intel HEX file to the compact image format used by the picprog sketch.\n");
+	printf("Usage: %s [-n name (default=hex_data)] [-b] [-u] [-s] filename\n", cmd);
+	printf("  -n  name of the PROGMEM array\n");
+	printf("  -b  write the packed image as raw binary instead of a C array\n");
+	printf("  -u  unpack a raw binary image (filename) to Intel HEX instead\n");
+	printf("  -s  only print the number of program memory words used\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *name = "hex_data";
+	int binary = 0, unpack = 0, size = 0;
+	std::vector<ihex_record> records, unpacked;
+	std::vector<unsigned char> packed;
+	std::map<unsigned long, unsigned char> mem1, mem2;
+	unsigned long hex_size = 0;
+	size_t i;
+	int c;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "n:bus")) != -1) {
+		switch(c) {
+			case 'n':
+				name = optarg;
+				break;
+			case 'b':
+				binary = 1;
+				break;
+			case 'u':
+				unpack = 1;
+				break;
+			case 's':
+				size = 1;
+				break;
+			case '?':
+				if (optopt == 'n'){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc-1){
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(unpack){
+		FILE *f = fopen(argv[optind], "rb");
+		if(!f){
+			perror(argv[optind]);
+			return 1;
+		}
+		while((c = fgetc(f)) != EOF){
+			packed.push_back(c);
+		}
+		fclose(f);
+		if(unpack_records(packed, unpacked) < 0){
+			fprintf(stderr, "%s: malformed packed image\n", argv[optind]);
+			return 1;
+		}
+		return ihex_write("-", unpacked) < 0;
+	}
+
+	if(ihex_read(argv[optind], records) < 0){
+		return 1;
+	}
+
+	if(size){
+		std::map<unsigned long, unsigned char>::const_iterator it;
+		unsigned long bytes = 0;
+		flatten(records, mem1);
+		for(it = mem1.begin(); it != mem1.end() && it->first < PROGRAM_BYTES; ++it){
+			bytes++;
+		}
+		printf("%lu\n", (bytes + 1) >> 1);
+		return 0;
+	}
+
+	if(pack_records(records, packed) < 0){
+		return 1;
+	}
+
+	/* Make sure the image decodes to exactly the same data */
+	flatten(records, mem1);
+	if(unpack_records(packed, unpacked) < 0){
+		fprintf(stderr, "Internal error, packed image does not decode\n");
+		return 1;
+	}
+	flatten(unpacked, mem2);
+	if(mem1 != mem2){
+		fprintf(stderr, "Internal error, packed image does not match HEX data\n");
+		return 1;
+	}
+
+	for(i=0; i<records.size(); i++){
+		hex_size += records[i].bytecount + 5;
+	}
+	fprintf(stderr, "%s: %lu bytes as HEX records, %zu bytes packed\n", argv[optind], hex_size, packed.size());
+
+	if(binary){
+		fwrite(&packed[0], 1, packed.size(), stdout);
+	} else {
+		pack_print_c(stdout, name, packed);
+	}
+
+	return 0;
+}
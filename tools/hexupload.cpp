@@ -0,0 +1,383 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Host side of the binary upload protocol in picprog.ino ('x' and 'y' commands).
+ *
+ * Every Intel HEX record is sent as a binary frame:
+ *
+ *   SOH, seq, bytecount, address (high, low), recordtype, data[bytecount], CRC16 (high, low)
+ *
+ * where the CRC (CCITT, 0x1021, init 0xFFFF) covers seq through the last data byte.
+ * The sketch answers every frame with a two byte response (ACK/NAK/ERR, seq).
+ * At most BIN_WINDOW frames are in flight, which always fits the 64 byte Arduino
+ * receive buffer, so the image can be streamed at full baudrate without character delays.
+ * On NAK or timeout, transmission restarts from the oldest unacknowledged frame (go-back-N).
+ *
+ */
+
+#include <ctype.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <termios.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/select.h>
+#include <vector>
+#include "ihex.h"
+
+#define BIN_SOH			0x01
+#define BIN_ACK			0x06
+#define BIN_NAK			0x15
+#define BIN_ERR			0x18
+#define BIN_WINDOW		2
+
+#define BIN_CMD_PROGRAM	'x'
+#define BIN_CMD_EEPROM	'y'
+#define BIN_READY		"Waiting for binary data..."
+
+#define ACK_TIMEOUT		1000	/* ms, covers programming 8 words with verify */
+#define MAX_RETRIES		8
+
+static int verbose = 0;
+
+static unsigned int crc16_update(unsigned int crc, unsigned char data){
+	unsigned char i;
+
+	crc ^= ((unsigned int) data) << 8;
+	for(i=0; i<8; i++){
+		if(crc & 0x8000){
+			crc = (crc << 1) ^ 0x1021;
+		} else {
+			crc <<= 1;
+		}
+	}
+	return crc & 0xffff;
+}
+
+static long millis(){
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec * 1000L + ts.tv_nsec / 1000000L;
+}
+
+static speed_t baud_to_speed(long baud){
+	switch(baud){
+		case 9600: return B9600;
+		case 19200: return B19200;
+		case 38400: return B38400;
+		case 57600: return B57600;
+		case 115200: return B115200;
+		case 230400: return B230400;
+		case 500000: return B500000;
+		case 1000000: return B1000000;
+	}
+	return 0;
+}
+
+static int open_port(const char *device, long baud){
+	struct termios tio;
+	speed_t speed = baud_to_speed(baud);
+	int fd;
+
+	if(!speed){
+		fprintf(stderr, "Unsupported baudrate %ld\n", baud);
+		return -1;
+	}
+
+	fd = open(device, O_RDWR | O_NOCTTY);
+	if(fd < 0){
+		perror(device);
+		return -1;
+	}
+
+	if(tcgetattr(fd, &tio) < 0){
+		perror("tcgetattr");
+		close(fd);
+		return -1;
+	}
+	cfmakeraw(&tio);
+	cfsetispeed(&tio, speed);
+	cfsetospeed(&tio, speed);
+	tio.c_cflag |= CLOCAL | CREAD;
+	tio.c_cc[VMIN] = 0;
+	tio.c_cc[VTIME] = 0;
+	if(tcsetattr(fd, TCSANOW, &tio) < 0){
+		perror("tcsetattr");
+		close(fd);
+		return -1;
+	}
+	tcflush(fd, TCIOFLUSH);
+
+	return fd;
+}
+
+/* Read one byte, waiting at most timeout ms.
+ * return: the byte, or -1 on timeout
+ */
+static int read_byte(int fd, long timeout){
+	long end = millis() + timeout;
+
+	while(1){
+		struct timeval tv;
+		fd_set fds;
+		long left = end - millis();
+		unsigned char c;
+
+		if(left < 0){
+			return -1;
+		}
+		FD_ZERO(&fds);
+		FD_SET(fd, &fds);
+		tv.tv_sec = left / 1000;
+		tv.tv_usec = (left % 1000) * 1000;
+		if(select(fd + 1, &fds, NULL, NULL, &tv) > 0 && read(fd, &c, 1) == 1){
+			return c;
+		}
+	}
+}
+
+/* Read a line of text from the sketch, waiting at most timeout ms.
+ * return: 0 if a full line was read, -1 on timeout
+ */
+static int read_line(int fd, char *line, unsigned int size, long timeout){
+	unsigned int n = 0;
+	long end = millis() + timeout;
+
+	while(1){
+		int c = read_byte(fd, end - millis());
+		if(c < 0){
+			line[n] = '\0';
+			return -1;
+		}
+		if(c == '\n'){
+			line[n] = '\0';
+			return 0;
+		}
+		if(c != '\r' && n < size - 1){
+			line[n++] = c;
+		}
+	}
+}
+
+static int write_all(int fd, const unsigned char *buf, size_t len){
+	while(len){
+		ssize_t w = write(fd, buf, len);
+		if(w < 0){
+			if(errno == EINTR){
+				continue;
+			}
+			perror("write");
+			return -1;
+		}
+		buf += w;
+		len -= w;
+	}
+	return 0;
+}
+
+static int send_frame(int fd, const ihex_record &r, unsigned char seq){
+	unsigned char frame[IHEX_MAX_DATA + 9];
+	unsigned int crc = 0xffff;
+	unsigned int i, n = 0;
+
+	frame[n++] = BIN_SOH;
+	frame[n++] = seq;
+	frame[n++] = r.bytecount;
+	frame[n++] = r.address >> 8;
+	frame[n++] = r.address;
+	frame[n++] = r.type;
+	for(i=0; i<r.bytecount; i++){
+		frame[n++] = r.data[i];
+	}
+	for(i=1; i<n; i++){
+		crc = crc16_update(crc, frame[i]);
+	}
+	frame[n++] = crc >> 8;
+	frame[n++] = crc;
+
+	return write_all(fd, frame, n);
+}
+
+/* Stream all records with windowed acknowledgement.
+ * return: 0 on success, -1 on failure
+ */
+static int send_records(int fd, const std::vector<ihex_record> &records){
+	size_t base = 0, next = 0;
+	unsigned int retries = 0;
+	long start = millis();
+
+	while(base < records.size()){
+		int resp, seq;
+
+		while(next < records.size() && next - base < BIN_WINDOW){
+			if(send_frame(fd, records[next], (unsigned char) next) < 0){
+				return -1;
+			}
+			next++;
+		}
+
+		resp = read_byte(fd, ACK_TIMEOUT);
+		seq = resp < 0 ? -1 : read_byte(fd, ACK_TIMEOUT);
+
+		if(resp == BIN_ACK && seq == (unsigned char) base){
+			base++;
+			retries = 0;
+			if(verbose){
+				fprintf(stderr, "\r%zu/%zu records", base, records.size());
+			}
+			continue;
+		}
+
+		if(resp == BIN_ERR){
+			fprintf(stderr, "\nDevice reported programming error at record %zu\n", base);
+			return -1;
+		}
+
+		if(resp == BIN_ACK){
+			/* Stale re-acknowledgement of an already acknowledged frame */
+			continue;
+		}
+
+		/* NAK, timeout or garbage. Go back to oldest unacknowledged frame */
+		if(++retries > MAX_RETRIES){
+			fprintf(stderr, "\nToo many retries at record %zu, giving up\n", base);
+			return -1;
+		}
+		if(verbose){
+			fprintf(stderr, "\n%s at record %zu, resending\n", resp == BIN_NAK ? "NAK" : "Timeout", base);
+		}
+		next = base;
+	}
+
+	if(verbose){
+		fprintf(stderr, "\n");
+	}
+	printf("Uploaded %zu records in %.1f s\n", records.size(), (millis() - start) / 1000.0);
+
+	return 0;
+}
+
+static void usage(const char *cmd){
+	printf("Upload an Intel HEX file to the STC-1000 through the picprog sketch, using the binary protocol.\n");
+	printf("Usage: %s [-p port (default=/dev/ttyUSB0)] [-b baud (default=115200)] [-e] [-v] filename\n", cmd);
+	printf("  -e  upload EEPROM data (eedata_*.hex), default is program memory (stc1000p_*.hex)\n");
+	printf("  -v  show progress\n");
+}
+
+int main(int argc, char *argv[]){
+	const char *port = "/dev/ttyUSB0";
+	long baud = 115200;
+	int eeprom = 0;
+	std::vector<ihex_record> records;
+	char line[256];
+	unsigned char cmd;
+	int fd, c, rv;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "p:b:ev")) != -1) {
+		switch(c) {
+			case 'p':
+				port = optarg;
+				break;
+			case 'b':
+				baud = atol(optarg);
+				break;
+			case 'e':
+				eeprom = 1;
+				break;
+			case 'v':
+				verbose = 1;
+				break;
+			case '?':
+				if (optopt == 'p' || optopt == 'b'){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc-1){
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(ihex_read(argv[optind], records) < 0){
+		return 1;
+	}
+
+	fd = open_port(port, baud);
+	if(fd < 0){
+		return 1;
+	}
+
+	/* Opening the port resets most Arduinos, wait for the banner (or timeout if it does not) */
+	while(read_line(fd, line, sizeof(line), 3000) == 0){
+		if(verbose){
+			printf("%s\n", line);
+		}
+		if(strstr(line, "Send 'd'")){
+			break;
+		}
+	}
+
+	cmd = eeprom ? BIN_CMD_EEPROM : BIN_CMD_PROGRAM;
+	if(write_all(fd, &cmd, 1) < 0){
+		close(fd);
+		return 1;
+	}
+
+	/* Echo text from the sketch until it switches to binary mode */
+	while(1){
+		if(read_line(fd, line, sizeof(line), 3000) < 0){
+			fprintf(stderr, "No response from sketch (is it a picprog sketch with binary upload support?)\n");
+			close(fd);
+			return 1;
+		}
+		printf("%s\n", line);
+		if(!strcmp(line, BIN_READY)){
+			break;
+		}
+	}
+
+	rv = send_records(fd, records);
+
+	/* Echo remaining text until the sketch leaves programming mode */
+	while(read_line(fd, line, sizeof(line), 2000) == 0){
+		printf("%s\n", line);
+		if(strstr(line, "Leaving programming mode")){
+			break;
+		}
+	}
+
+	close(fd);
+
+	return rv < 0 ? 1 : 0;
+}
@@ -0,0 +1,154 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "ihex.h"
+
+static int hex_nibble(char c){
+	if(c >= '0' && c <= '9'){
+		return c - '0';
+	}
+	if(c >= 'A' && c <= 'F'){
+		return c - 'A' + 10;
+	}
+	if(c >= 'a' && c <= 'f'){
+		return c - 'a' + 10;
+	}
+	return -1;
+}
+
+static int parse_hex(const char *s){
+	int h = hex_nibble(s[0]);
+	int l = hex_nibble(s[1]);
+	if(h < 0 || l < 0){
+		return -1;
+	}
+	return (h << 4) | l;
+}
+
+unsigned char ihex_checksum(const ihex_record &r){
+	unsigned char checksum = r.bytecount + (r.address >> 8) + r.address + r.type;
+	unsigned char i;
+
+	for(i=0; i<r.bytecount; i++){
+		checksum += r.data[i];
+	}
+
+	return -checksum;
+}
+
+int ihex_read(const char *filename, std::vector<ihex_record> &records){
+	char line[600];
+	unsigned int lineno = 0;
+	FILE *f = fopen(filename, "r");
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+
+	while(fgets(line, sizeof(line), f)){
+		unsigned char buf[260];
+		unsigned char checksum = 0;
+		unsigned int len, n, i;
+
+		lineno++;
+		len = strcspn(line, "\r\n");
+		if(len == 0){
+			continue;
+		}
+		if(line[0] != ':' || (len & 1) == 0 || len < 11){
+			fprintf(stderr, "%s:%u: malformed record\n", filename, lineno);
+			fclose(f);
+			return -1;
+		}
+
+		n = (len - 1) >> 1;
+		for(i=0; i<n; i++){
+			int b = parse_hex(&line[1 + (i << 1)]);
+			if(b < 0){
+				fprintf(stderr, "%s:%u: invalid hex digit\n", filename, lineno);
+				fclose(f);
+				return -1;
+			}
+			buf[i] = b;
+			checksum += b;
+		}
+
+		if(n != buf[0] + 5u || checksum != 0){
+			fprintf(stderr, "%s:%u: length or checksum error\n", filename, lineno);
+			fclose(f);
+			return -1;
+		}
+
+		/* Split long data records so they fit the sketch buffers */
+		for(i=0; i == 0 || i < buf[0]; i += IHEX_MAX_DATA){
+			ihex_record r;
+			r.bytecount = (buf[0] - i) > IHEX_MAX_DATA ? IHEX_MAX_DATA : (buf[0] - i);
+			r.address = ((buf[1] << 8) | buf[2]) + i;
+			r.type = buf[3];
+			memcpy(r.data, &buf[4 + i], r.bytecount);
+			records.push_back(r);
+		}
+
+		if(buf[3] == IHEX_EOF){
+			break;
+		}
+	}
+
+	fclose(f);
+
+	if(records.empty() || records.back().type != IHEX_EOF){
+		fprintf(stderr, "%s: missing end of file record\n", filename);
+		return -1;
+	}
+
+	return 0;
+}
+
+int ihex_write(const char *filename, const std::vector<ihex_record> &records){
+	FILE *f = strcmp(filename, "-") ? fopen(filename, "w") : stdout;
+	size_t i;
+
+	if(!f){
+		perror(filename);
+		return -1;
+	}
+
+	for(i=0; i<records.size(); i++){
+		const ihex_record &r = records[i];
+		unsigned char j;
+
+		fprintf(f, ":%02X%04X%02X", r.bytecount, r.address & 0xffff, r.type);
+		for(j=0; j<r.bytecount; j++){
+			fprintf(f, "%02X", r.data[j]);
+		}
+		fprintf(f, "%02X\n", ihex_checksum(r));
+	}
+
+	if(f != stdout){
+		fclose(f);
+	}
+
+	return 0;
+}
@@ -0,0 +1,58 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef _IHEX_H_
+#define _IHEX_H_
+
+#include <vector>
+
+/* Intel HEX record types used by SDCC/gputils for the PIC16F1828 */
+#define IHEX_DATA			0x00
+#define IHEX_EOF			0x01
+#define IHEX_EXT_LIN_ADDR	0x04
+
+/* The sketch buffers at most this many data bytes per record */
+#define IHEX_MAX_DATA		16
+
+/* One (binary) Intel HEX record, as handled by handle_hex_file_line() in the sketch */
+struct ihex_record {
+	unsigned char bytecount;
+	unsigned int address;
+	unsigned char type;
+	unsigned char data[IHEX_MAX_DATA];
+};
+
+/* Read an Intel HEX file into records. Data records longer than
+ * IHEX_MAX_DATA are split, so every record fits the sketch buffers.
+ * return: 0 on success, -1 on error (message printed to stderr)
+ */
+int ihex_read(const char *filename, std::vector<ihex_record> &records);
+
+/* Write records as an Intel HEX file ("-" for stdout).
+ * return: 0 on success, -1 on error
+ */
+int ihex_write(const char *filename, const std::vector<ihex_record> &records);
+
+/* Calculate the Intel HEX (two's complement) checksum of a record */
+unsigned char ihex_checksum(const ihex_record &r);
+
+#endif // _IHEX_H_
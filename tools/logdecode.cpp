@@ -0,0 +1,339 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+/*
+ * Decode the temperature history log of the LOG firmware (com_log), as read
+ * with the 'l' command of com.ino (the log end followed by the bytes of the
+ * ring, in hex), or from an EEPROM image (Intel HEX, for example read back
+ * from the device or saved by the simulator). See log_sample() in page0.c
+ * for the format of the records.
+ *
+ */
+
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <vector>
+#include "eeprom.h"
+#include "ihex.h"
+
+#define LOG_KEYFRAME		0x80
+#define LOG_POWER_ON		0x81
+#define LOG_SP_CHANGE		0xc0
+#define LOG_FREE			0xff
+#define STATS_WORDS			12		/* statistics between the menu data and the log */
+
+struct sample {
+	int temperature, setpoint;		/* 0.1 degrees */
+	unsigned char relays;			/* bit 1 heating, bit 0 cooling */
+};
+
+struct session {
+	int complete;					/* starts at power on */
+	std::vector<sample> samples;
+};
+
+static void usage(const char *cmd){
+	printf("Decode the temperature history log of the STC-1000+ LOG firmware.\n");
+	printf("Usage: %s [-i minutes] [-v variant] file\n", cmd);
+	printf("  -i  log interval (Li), for a dump from com.ino (default 15, read from the image otherwise)\n");
+	printf("  -v  firmware variant of an EEPROM image (default com_log)\n");
+	printf("file is the output of the 'l' command of com.ino (hex bytes, the log end first),\n");
+	printf("or an EEPROM image in Intel HEX format. '-' reads standard input.\n");
+}
+
+static int sign_extend(int v, unsigned char bits){
+	return (v ^ (1 << (bits - 1))) - (1 << (bits - 1));
+}
+
+/* Read the hex bytes of a com.ino dump, skipping lines with anything else */
+static int read_dump(FILE *f, std::vector<unsigned char> &bytes){
+	char line[256];
+
+	while(fgets(line, sizeof(line), f)){
+		std::vector<unsigned char> v;
+		char *p = line, *end;
+		int ok = 1;
+
+		while(*p){
+			unsigned long b;
+			while(isspace((unsigned char)*p)){
+				p++;
+			}
+			if(!*p){
+				break;
+			}
+			b = strtoul(p, &end, 16);
+			if(end == p || end - p > 2 || (*end && !isspace((unsigned char)*end))){
+				ok = 0;
+				break;
+			}
+			v.push_back(b);
+			p = end;
+		}
+		if(ok){
+			bytes.insert(bytes.end(), v.begin(), v.end());
+		}
+	}
+	return 0;
+}
+
+/* The log ring of an EEPROM image, with the end found as the firmware does at power on */
+static int read_image(const char *filename, const ee_variant *v, std::vector<unsigned char> &ring,
+		unsigned char *head, int *interval){
+	std::vector<ihex_record> records;
+	unsigned char eeprom[EE_SIZE * 2];
+	unsigned int start = (v->profiles * EE_PROFILE_SIZE + v->menu_size + STATS_WORDS) * 2, i;
+	unsigned long ext = 0;
+	int li;
+
+	if(ihex_read(filename, records) < 0){
+		return -1;
+	}
+	memset(eeprom, LOG_FREE, sizeof(eeprom));
+	for(i=0; i<records.size(); i++){
+		const ihex_record &r = records[i];
+		unsigned char j;
+		if(r.type == IHEX_EXT_LIN_ADDR){
+			ext = (r.data[0] << 8) | r.data[1];
+		} else if(r.type == IHEX_DATA && ext == 1){
+			/* Each EEPROM byte is the low byte of a word */
+			for(j=0; j<r.bytecount; j+=2){
+				unsigned int a = r.address + j;
+				if(a >= EE_HEX_ADDRESS && a < EE_HEX_ADDRESS + sizeof(eeprom) * 2){
+					eeprom[(a - EE_HEX_ADDRESS) >> 1] = r.data[j];
+				}
+			}
+		}
+	}
+
+	li = ee_find_menu_item(v, "Li");
+	if(li < 0){
+		fprintf(stderr, "%s: variant %s has no log\n", filename, v->name);
+		return -1;
+	}
+	li = ee_menu_address(v, li) * 2;
+	*interval = eeprom[li] | (eeprom[li + 1] << 8);
+
+	ring.assign(eeprom + start, eeprom + EE_CLOCK_TICKS * 2);
+	*head = 0;
+	for(i=0; i<ring.size(); i++){
+		if(ring[i] == LOG_FREE && ring[(i + ring.size() - 1) % ring.size()] != LOG_FREE){
+			*head = i;
+			break;
+		}
+	}
+	return 0;
+}
+
+/* Number of samples (not set point changes) in records */
+static unsigned int count_samples(const std::vector<unsigned char> &records){
+	unsigned int i, n = 0;
+	for(i=0; i<records.size(); i++){
+		n += (records[i] < 0x80);
+	}
+	return n;
+}
+
+/* Decode the ring into sessions (from power on to power off), oldest first.
+ * Samples before the first keyframe are decoded backwards from it, unless it
+ * is a power on keyframe (then the end of that session is not known).
+ */
+static unsigned int decode(const std::vector<unsigned char> &ring, unsigned char head, std::vector<session> &sessions){
+	std::vector<unsigned char> pending;
+	unsigned int n = ring.size(), i, lost = 0;
+	int known = 0, t = 0, sp = 0;
+
+	for(i=1; i<n; i++){
+		unsigned char b = ring[(head + i) % n];
+
+		if(b == LOG_FREE){
+			continue;
+		}
+		if(b == LOG_KEYFRAME || b == LOG_POWER_ON){
+			unsigned char p[4], j;
+			for(j=0; j<4 && i+1<n; j++){
+				p[j] = ring[(head + ++i) % n];
+				if(p[j] & 0x80){
+					break;
+				}
+			}
+			if(j < 4){
+				/* Cut short, by power loss while writing */
+				break;
+			}
+			t = sign_extend((p[0] << 7) | p[1], 14);
+			sp = sign_extend((p[2] << 7) | p[3], 14);
+
+			if(b == LOG_POWER_ON || sessions.empty()){
+				session s;
+				s.complete = (b == LOG_POWER_ON);
+				sessions.push_back(s);
+			}
+			if(!known && !pending.empty()){
+				if(b == LOG_POWER_ON){
+					lost += count_samples(pending);
+				} else {
+					/* The keyframe repeats the state after the last sample before it */
+					std::vector<sample> &out = sessions.back().samples;
+					int bt = t, bsp = sp;
+					size_t k = pending.size();
+					while(k--){
+						unsigned char r = pending[k];
+						if(r < 0x80){
+							sample s = { bt, bsp, (unsigned char)(r & 0x3) };
+							out.insert(out.begin(), s);
+							bt -= sign_extend((r >> 2) & 0x1f, 5);
+						} else {
+							bsp -= r - LOG_SP_CHANGE;
+						}
+					}
+				}
+			}
+			pending.clear();
+			known = 1;
+		} else if(!known){
+			pending.push_back(b);
+		} else if(b & 0x80){
+			sp += b - LOG_SP_CHANGE;
+		} else {
+			sample s;
+			t += sign_extend((b >> 2) & 0x1f, 5);
+			s.temperature = t;
+			s.setpoint = sp;
+			s.relays = b & 0x3;
+			sessions.back().samples.push_back(s);
+		}
+	}
+
+	if(!known){
+		lost += count_samples(pending);
+	}
+	return lost;
+}
+
+static void print_temperature(int t){
+	printf("%s%d.%d", t < 0 ? "-" : "", abs(t) / 10, abs(t) % 10);
+}
+
+int main(int argc, char *argv[]){
+	const char *variant = "com_log";
+	const ee_variant *v;
+	std::vector<unsigned char> ring;
+	std::vector<session> sessions;
+	unsigned char head = 0;
+	int interval = 15, image = 0, c;
+	unsigned int lost, i, j;
+	FILE *f;
+
+	opterr = 0;
+
+	while((c=getopt(argc, argv, "i:v:")) != -1) {
+		switch(c) {
+			case 'i':
+				interval = atoi(optarg);
+				break;
+			case 'v':
+				variant = optarg;
+				break;
+			case '?':
+				if (optopt == 'i' || optopt == 'v'){
+					fprintf(stderr, "Option -%c requires an argument.\n", optopt);
+				} else if (isprint (optopt)) {
+					fprintf(stderr, "Unknown option '-%c'.\n", optopt);
+				} else {
+					fprintf(stderr, "Unknown option character '\\x%x'.\n", optopt);
+				}
+				/* fall through */
+			default:
+				usage(argv[0]);
+				return 1;
+		}
+	}
+
+	if(optind != argc-1){
+		usage(argv[0]);
+		return 1;
+	}
+
+	if(!(v = ee_find_variant(variant))){
+		fprintf(stderr, "Unknown variant '%s'\n", variant);
+		return 1;
+	}
+
+	f = strcmp(argv[optind], "-") ? fopen(argv[optind], "r") : stdin;
+	if(!f){
+		perror(argv[optind]);
+		return 1;
+	}
+	c = fgetc(f);
+	image = (c == ':');
+	ungetc(c, f);
+
+	if(image){
+		if(f != stdin){
+			fclose(f);
+		}
+		if(read_image(argv[optind], v, ring, &head, &interval) < 0){
+			return 1;
+		}
+	} else {
+		std::vector<unsigned char> bytes;
+		read_dump(f, bytes);
+		if(f != stdin){
+			fclose(f);
+		}
+		if(bytes.size() < 2 || bytes[0] >= bytes.size() - 1){
+			fprintf(stderr, "%s: no log dump found\n", argv[optind]);
+			return 1;
+		}
+		head = bytes[0];
+		ring.assign(bytes.begin() + 1, bytes.end());
+	}
+
+	lost = decode(ring, head, sessions);
+
+	printf("# session\tminute\ttemperature\tsetpoint\theating\tcooling\n");
+	for(i=0; i<sessions.size(); i++){
+		const session &s = sessions[i];
+		if(!s.complete){
+			printf("# session %u: start not in the log, minutes from the first sample\n", i + 1);
+		}
+		for(j=0; j<s.samples.size(); j++){
+			printf("%u\t%u\t", i + 1, j * interval);
+			print_temperature(s.samples[j].temperature);
+			printf("\t");
+			print_temperature(s.samples[j].setpoint);
+			printf("\t%d\t%d\n", (s.samples[j].relays >> 1) & 1, s.samples[j].relays & 1);
+		}
+	}
+	if(lost){
+		fprintf(stderr, "%u samples before the oldest power on could not be decoded\n", lost);
+	}
+	if(interval <= 0){
+		fprintf(stderr, "Log interval is 0 (off), minutes are not valid\n");
+	}
+
+	return 0;
+}
@@ -0,0 +1,235 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <string.h>
+#include "pack.h"
+
+/* Greedy LZ encoding of words[start..end), with the whole preceding stream as history */
+static void pack_words(const std::vector<unsigned int> &words, size_t start, std::vector<unsigned char> &packed){
+	size_t i = start;
+	size_t lit_start = start;
+
+	while(i <= words.size()){
+		size_t best_len = 0, best_dist = 0;
+		size_t d;
+
+		if(i < words.size()){
+			for(d=1; d<=PACK_WINDOW && d<=i; d++){
+				size_t l = 0;
+				while(i + l < words.size() && l < PACK_MAX_COPY && words[i + l - d] == words[i + l]){
+					l++;
+				}
+				if(l > best_len){
+					best_len = l;
+					best_dist = d;
+				}
+			}
+		}
+
+		/* Flush pending literals before a copy, at the end, or when the run is full */
+		if(best_len >= PACK_MIN_COPY || i == words.size() || i - lit_start == PACK_MAX_LITERAL){
+			while(lit_start < i){
+				size_t n = i - lit_start;
+				if(n > PACK_MAX_LITERAL){
+					n = PACK_MAX_LITERAL;
+				}
+				packed.push_back(PACK_LITERAL | (n - 1));
+				while(n--){
+					packed.push_back(words[lit_start] & 0xff);
+					packed.push_back(words[lit_start] >> 8);
+					lit_start++;
+				}
+			}
+		}
+
+		if(i == words.size()){
+			break;
+		}
+
+		if(best_len >= PACK_MIN_COPY){
+			packed.push_back(PACK_COPY | (best_len - PACK_MIN_COPY));
+			packed.push_back(best_dist - 1);
+			i += best_len;
+			lit_start = i;
+		} else {
+			i++;
+		}
+	}
+}
+
+int pack_records(const std::vector<ihex_record> &records, std::vector<unsigned char> &packed){
+	std::vector<unsigned int> words;
+	size_t seg_start = 0;
+	unsigned int next_address = 0;
+	int in_segment = 0;
+	size_t i;
+
+	for(i=0; i<records.size(); i++){
+		const ihex_record &r = records[i];
+		unsigned char j;
+
+		if(r.type == IHEX_DATA){
+			if(r.bytecount & 1){
+				fprintf(stderr, "Odd byte count in data record at 0x%04X\n", r.address);
+				return -1;
+			}
+			if(!in_segment || r.address != next_address){
+				if(in_segment){
+					pack_words(words, seg_start, packed);
+				}
+				packed.push_back(PACK_ADDR);
+				packed.push_back(r.address >> 8);
+				packed.push_back(r.address);
+				seg_start = words.size();
+				in_segment = 1;
+			}
+			for(j=0; j<r.bytecount; j+=2){
+				words.push_back(r.data[j] | (r.data[j + 1] << 8));
+			}
+			next_address = r.address + r.bytecount;
+			continue;
+		}
+
+		if(in_segment){
+			pack_words(words, seg_start, packed);
+			in_segment = 0;
+		}
+
+		if(r.type == IHEX_EXT_LIN_ADDR){
+			if(r.bytecount != 2 || r.data[0] != 0){
+				fprintf(stderr, "Unsupported extended linear address record\n");
+				return -1;
+			}
+			packed.push_back(PACK_EXT_ADDR);
+			packed.push_back(r.data[1]);
+		} else if(r.type == IHEX_EOF){
+			packed.push_back(PACK_END);
+			return 0;
+		} else {
+			fprintf(stderr, "Unsupported record type %02X\n", r.type);
+			return -1;
+		}
+	}
+
+	fprintf(stderr, "Missing end of file record\n");
+	return -1;
+}
+
+int unpack_records(const std::vector<unsigned char> &packed, std::vector<ihex_record> &records){
+	std::vector<unsigned int> history;
+	ihex_record r;
+	size_t p = 0;
+
+	r.bytecount = 0;
+	r.address = 0;
+	r.type = IHEX_DATA;
+
+	while(p < packed.size()){
+		unsigned char c = packed[p++];
+
+		if(c & (PACK_LITERAL | PACK_COPY)){
+			unsigned int n, dist = 0;
+			if(c & PACK_LITERAL){
+				n = (c & 0x7f) + 1;
+				if(p + 2 * n > packed.size()){
+					return -1;
+				}
+			} else {
+				n = (c & 0x3f) + PACK_MIN_COPY;
+				if(p >= packed.size()){
+					return -1;
+				}
+				dist = packed[p++] + 1;
+				if(dist > history.size()){
+					return -1;
+				}
+			}
+			while(n--){
+				unsigned int word;
+				if(dist){
+					word = history[history.size() - dist];
+				} else {
+					word = packed[p] | (packed[p + 1] << 8);
+					p += 2;
+				}
+				history.push_back(word);
+				r.data[r.bytecount++] = word;
+				r.data[r.bytecount++] = word >> 8;
+				if(r.bytecount == IHEX_MAX_DATA){
+					records.push_back(r);
+					r.address += r.bytecount;
+					r.bytecount = 0;
+				}
+			}
+			continue;
+		}
+
+		if(r.bytecount){
+			records.push_back(r);
+			r.address += r.bytecount;
+			r.bytecount = 0;
+		}
+
+		if(c == PACK_ADDR){
+			if(p + 2 > packed.size()){
+				return -1;
+			}
+			r.address = (packed[p] << 8) | packed[p + 1];
+			p += 2;
+		} else if(c == PACK_EXT_ADDR){
+			ihex_record e;
+			if(p >= packed.size()){
+				return -1;
+			}
+			e.bytecount = 2;
+			e.address = 0;
+			e.type = IHEX_EXT_LIN_ADDR;
+			e.data[0] = 0;
+			e.data[1] = packed[p++];
+			records.push_back(e);
+		} else if(c == PACK_END){
+			ihex_record e;
+			e.bytecount = 0;
+			e.address = 0;
+			e.type = IHEX_EOF;
+			records.push_back(e);
+			return 0;
+		} else {
+			return -1;
+		}
+	}
+
+	return -1;
+}
+
+void pack_print_c(FILE *f, const char *name, const std::vector<unsigned char> &packed){
+	size_t i;
+
+	fprintf(f, "const char %s[] PROGMEM = {", name);
+	for(i=0; i<packed.size(); i++){
+		if((i & 0xf) == 0){
+			fprintf(f, "\n   ");
+		}
+		fprintf(f, "0x%02X%s", packed[i], (i + 1 < packed.size()) ? "," : "");
+	}
+	fprintf(f, "\n};\n");
+}
@@ -0,0 +1,68 @@
+/*
+ * STC1000+, improved firmware and Arduino based firmware uploader for the STC-1000 dual stage thermostat.
+ *
+ * Copyright 2014 Mats Staffansson
+ *
+ * This file is part of STC1000+.
+ *
+ * STC1000+ is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * STC1000+ is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with STC1000+.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ * Packed image format, as decoded by upload_hex_from_progmem() in the picprog sketch.
+ *
+ * The image is a stream of commands, each starting with a control byte:
+ *
+ *   0x00              End of image (HEX end of file record)
+ *   0x01 e            Extended linear address e (HEX record type 04, upper byte 0)
+ *   0x02 ah al        Set HEX (byte) address for the following words
+ *   0b1nnnnnnn        n+1 literal words follow, low byte first (1-128 words)
+ *   0b01nnnnnn d      Copy n+2 words, starting d+1 words back in the decoded stream (2-65 words)
+ *
+ * Words are the 14-bit PIC program words (or EEPROM data bytes with the 0x34 RETLW
+ * high byte) in the order they appear in the HEX file. Copies refer to the last
+ * PACK_WINDOW decoded words, regardless of address, and may overlap (run length).
+ *
+ */
+
+#ifndef _PACK_H_
+#define _PACK_H_
+
+#include <stdio.h>
+#include <vector>
+#include "ihex.h"
+
+#define PACK_END			0x00
+#define PACK_EXT_ADDR		0x01
+#define PACK_ADDR			0x02
+#define PACK_COPY			0x40
+#define PACK_LITERAL		0x80
+
+#define PACK_WINDOW			256
+#define PACK_MIN_COPY		2
+#define PACK_MAX_COPY		65
+#define PACK_MAX_LITERAL	128
+
+/* Pack HEX records.
+ * return: 0 on success, -1 on error (message printed to stderr)
+ */
+int pack_records(const std::vector<ihex_record> &records, std::vector<unsigned char> &packed);
+
+/* Unpack to HEX records (at most IHEX_MAX_DATA bytes each), as the sketch does.
+ * return: 0 on success, -1 on malformed data
+ */
+int unpack_records(const std::vector<unsigned char> &packed, std::vector<ihex_record> &records);
+
+/* Print packed data as a PROGMEM array for the sketch */
+void pack_print_c(FILE *f, const char *name, const std::vector<unsigned char> &packed);
+
+#endif // _PACK_H_